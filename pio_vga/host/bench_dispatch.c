@@ -0,0 +1,450 @@
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "pio_vga_line_timing.h"
+#include "pio_vga_video_mode.h"
+#include "render_threads.h"
+#include "village_scene.h"
+
+// Checks and measures the line job dispatcher used by `pio_vga_fifth.c`.
+//
+// First every frame is drawn on a single thread to give reference output and the cost of every
+// line. Then for one and two render threads the frames are drawn again with the dispatcher
+// handing out jobs in the order `dma_irh` requests them. Output is read from the line buffers
+// twice per line as the line DMA would and compared against the reference. This checks scheduling
+// and buffer handling but not timing, the output side waits for each line to be drawn (the host
+// may not have a spare CPU for each thread).
+//
+// Timing is checked by simulating the dispatcher with one and two cores against the display line
+// cadence, using the measured line costs plus an extra per line load. For a range of line buffer
+// ring depths the largest extra load that gives no underruns is found, along with the underruns
+// seen when a band of lines is made more expensive (as a cluster of sprites would) to show how far
+// a deeper ring lets cheap lines make up for expensive ones.
+//
+// With `-t` the two core simulation with the spike band is run once more recording line timing
+// as `pio_vga_fifth.c` does, writing a summary every SIM_TIMING_SUMMARY_FRAMES frames in the text
+// form the Pico prints for `decode_line_timing` to report on.
+
+#define FRAME_LINES 525
+// Every drawn line is output for two VGA lines
+#define LINE_REPEAT 2
+// Frame line index when `new_frame` is signalled (the end of display line 479), frame lines
+// start with the VIDEO_DUMMY_LINES dummy display lines
+#define NEW_FRAME_LINE (VIDEO_DUMMY_LINES + SCREEN_HEIGHT * LINE_REPEAT)
+#define SIM_TIMING_SUMMARY_FRAMES 10
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-f frames] [-n extra_sprites] [-k scale] [-b buffers] [-c spike_ns]\n"
+        "       [-y spike_start] [-h spike_height] [-t timing_file]\n"
+        "  -f  Number of frames to draw (default 60)\n"
+        "  -n  Extra sprites scattered over the map on top of the demo characters (default 0)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n"
+        "  -b  Line buffers used when checking threaded output (default 8)\n"
+        "  -c  Extra cost of each line in the spike band in ns (default 2x the line budget)\n"
+        "  -y  First line of the spike band (default 100)\n"
+        "  -h  Number of lines in the spike band (default 8)\n"
+        "  -t  Write simulated line timing summaries to this file ('-' for stdout)\n",
+        prog);
+}
+
+// Lines requested as the first display line begins, the first lines of a frame
+static int first_frame_requests(int num_line_buffers) {
+    return line_dispatch_requests_at(-VIDEO_DUMMY_LINES, -VIDEO_DUMMY_LINES, num_line_buffers,
+        SCREEN_HEIGHT, LINE_REPEAT);
+}
+
+static int num_frames;
+static uint32_t* line_costs;
+static uint32_t end_of_frame_cost;
+static uint32_t spike_ns;
+static int spike_start;
+static int spike_height;
+// Where simulated line timing summaries are written
+static FILE* timing_file;
+
+// Frames scroll diagonally across the map, bouncing at the edges
+static void set_frame_scroll(int frame) {
+    int x_range = village_max_x_scroll() * 2;
+    int y_range = village_max_y_scroll() * 2;
+    int x = (frame * 3) % x_range;
+    int y = (frame * 2) % y_range;
+
+    set_village_scroll(x <= village_max_x_scroll() ? x : x_range - x,
+        y <= village_max_y_scroll() ? y : y_range - y);
+}
+
+static int threaded_frame;
+
+static void threaded_end_of_frame() {
+    set_frame_scroll(++threaded_frame);
+}
+
+static uint32_t frame_checksum(uint16_t (*frame)[SCREEN_WIDTH]) {
+    return bench_fnv1a(BENCH_FNV1A_INIT, frame, SCREEN_HEIGHT * SCREEN_WIDTH * sizeof(uint16_t));
+}
+
+// Draw every frame on the dispatcher with `num_cores` threads and a ring of `num_line_buffers`
+// line buffers, comparing output with `reference`. Returns the number of errors found.
+static int run_threaded(int num_cores, int num_line_buffers, const uint32_t* reference) {
+    uint16_t (*line_buffers)[SCREEN_WIDTH] = calloc(num_line_buffers, sizeof(*line_buffers));
+    uint16_t (*frame)[SCREEN_WIDTH] = calloc(SCREEN_HEIGHT, sizeof(*frame));
+
+    line_dispatch_t dispatch;
+    line_dispatch_init(&dispatch, num_cores, SCREEN_HEIGHT);
+    threaded_frame = 0;
+    set_frame_scroll(0);
+
+    int num_overwritten = 0;
+    int num_mismatched_frames = 0;
+
+    // As `setup_video` the first lines are requested before output starts
+    for(int i = 0;i < first_frame_requests(num_line_buffers); ++i) {
+        line_dispatch_request(&dispatch);
+    }
+
+    render_threads_start(&dispatch, line_buffers, num_line_buffers, draw_village_line,
+        threaded_end_of_frame);
+    render_threads_notify();
+
+    for(int frame_num = 0;frame_num < num_frames; ++frame_num) {
+        for(int display_line = -VIDEO_DUMMY_LINES + 1;display_line < SCREEN_HEIGHT * LINE_REPEAT;
+            ++display_line) {
+
+            int num_requests = line_dispatch_requests_at(display_line, -VIDEO_DUMMY_LINES,
+                num_line_buffers, SCREEN_HEIGHT, LINE_REPEAT);
+            for(int i = 0;i < num_requests; ++i) {
+                line_dispatch_request(&dispatch);
+            }
+            render_threads_notify();
+
+            if (display_line < 0) {
+                continue;
+            }
+
+            int line = display_line / 2;
+            uint16_t* line_buffer = line_buffers[line % num_line_buffers];
+
+            if ((display_line & 1) == 0) {
+                while (!line_dispatch_line_drawn(&dispatch, frame_num, line)) {
+                    sched_yield();
+                }
+
+                memcpy(frame[line], line_buffer, sizeof(frame[line]));
+            } else if (memcmp(frame[line], line_buffer, sizeof(frame[line])) != 0) {
+                // Buffer changed between the two times the line is output
+                ++num_overwritten;
+            }
+        }
+
+        if (frame_checksum(frame) != reference[frame_num]) {
+            ++num_mismatched_frames;
+        }
+
+        // Display line 479 is done, signal the new frame and request the first lines of the next
+        render_threads_new_frame();
+        for(int i = 0;i < first_frame_requests(num_line_buffers); ++i) {
+            line_dispatch_request(&dispatch);
+        }
+    }
+
+    render_threads_stop();
+
+    printf("%d render thread(s), %d line buffers: %d frames, %d mismatched frames, %d lines "
+        "overwritten while being output\n", num_cores, num_line_buffers, num_frames,
+        num_mismatched_frames, num_overwritten);
+
+    free(line_buffers);
+    free(frame);
+
+    return num_mismatched_frames + num_overwritten;
+}
+
+// Simulate drawing every frame on `num_cores` cores into a ring of `num_line_buffers` line
+// buffers, with each line costing `extra_ns` more than measured and lines in the spike band
+// costing a further `band_ns`. Time advances with the display, starting as the display reaches
+// the end of the frame before the first so the first frame gets the vertical blanking period to
+// draw its first lines in like every other. Underruns are counted by the dispatcher as the output
+// side reports each line. If `timing` isn't NULL line timing is recorded in it, with summaries
+// written to `timing_file`.
+static line_underrun_stats_t simulate_underruns(int num_cores, int num_line_buffers, double scale,
+    uint32_t extra_ns, uint32_t band_ns, line_timing_t* timing) {
+
+    line_dispatch_t dispatch;
+    line_dispatch_init(&dispatch, num_cores, SCREEN_HEIGHT);
+
+    bool busy[MAX_RENDER_CORES] = {false};
+    uint64_t busy_until[MAX_RENDER_CORES];
+    // Line a core is drawing or -1 for end of frame processing
+    int busy_line[MAX_RENDER_CORES];
+    bool new_frame = false;
+    int frame_being_drawn[MAX_RENDER_CORES] = {0};
+    uint64_t now = 0;
+
+    for(int i = 0;i < first_frame_requests(num_line_buffers); ++i) {
+        if (timing) {
+            line_timing_requested(timing, 0);
+        }
+
+        line_dispatch_request(&dispatch);
+    }
+
+    int first_line = NEW_FRAME_LINE + 1;
+    int end_line = num_frames * FRAME_LINES + NEW_FRAME_LINE + 1;
+
+    for(int sim_line = first_line;sim_line < end_line; ++sim_line) {
+        uint64_t line_start = (uint64_t)(sim_line - first_line) * VGA_LINE_TIME_NS;
+
+        // Run the cores until the start of this display line
+        while (true) {
+            for(int core = 0;core < num_cores; ++core) {
+                int line;
+                if (busy[core]) {
+                    continue;
+                }
+
+                if (line_dispatch_take_job(&dispatch, core, &line)) {
+                    uint32_t cost = line_costs[(frame_being_drawn[core] % num_frames) *
+                        SCREEN_HEIGHT + line] * scale + extra_ns;
+                    if (line >= spike_start && line < spike_start + spike_height) {
+                        cost += band_ns;
+                    }
+
+                    busy[core] = true;
+                    busy_line[core] = line;
+                    busy_until[core] = now + cost;
+
+                    if (timing) {
+                        line_timing_render_start(timing, line, now / 1000);
+                    }
+                } else if (core == 0 && new_frame && line_dispatch_frame_drawn(&dispatch)) {
+                    busy[core] = true;
+                    busy_line[core] = -1;
+                    busy_until[core] = now + end_of_frame_cost * scale;
+                }
+            }
+
+            int next_core = -1;
+            for(int core = 0;core < num_cores; ++core) {
+                if (busy[core] &&
+                    (next_core == -1 || busy_until[core] < busy_until[next_core])) {
+                    next_core = core;
+                }
+            }
+
+            if (next_core == -1 || busy_until[next_core] > line_start) {
+                now = line_start;
+                break;
+            }
+
+            now = busy_until[next_core];
+            busy[next_core] = false;
+
+            if (busy_line[next_core] == -1) {
+                new_frame = false;
+                line_dispatch_release_frame(&dispatch);
+            } else {
+                if (timing) {
+                    line_timing_render_end(timing, busy_line[next_core], now / 1000);
+                }
+
+                line_dispatch_job_done(&dispatch, next_core);
+                if (busy_line[next_core] + num_cores >= SCREEN_HEIGHT) {
+                    ++frame_being_drawn[next_core];
+                }
+            }
+        }
+
+        // Frame lines 0 to VIDEO_DUMMY_LINES - 1 are the dummy display lines
+        int frame_line = sim_line % FRAME_LINES;
+        int display_line = frame_line - VIDEO_DUMMY_LINES;
+
+        if (frame_line == NEW_FRAME_LINE) {
+            // As `dma_irh` at the end of display line 479
+            line_dispatch_frame_output(&dispatch);
+            new_frame = true;
+
+            if (timing) {
+                line_timing_summary_t summary;
+                line_timing_frame_output(timing);
+
+                // The main loop on the Pico would print this over the following frames
+                if (line_timing_take_summary(timing, &summary)) {
+                    char text[LINE_TIMING_TEXT_LENGTH + 1];
+
+                    line_timing_format_summary(&summary, text);
+                    fputs(text, timing_file);
+                }
+            }
+
+            display_line = -VIDEO_DUMMY_LINES;
+        } else if (frame_line > NEW_FRAME_LINE || frame_line == 0) {
+            continue;
+        }
+
+        if (display_line >= 0 && (display_line & 1) == 0) {
+            bool drawn = line_dispatch_line_output(&dispatch, display_line / 2);
+
+            if (timing) {
+                line_timing_line_output(timing, display_line / 2, drawn, line_start / 1000);
+            }
+        }
+
+        int num_requests = line_dispatch_requests_at(display_line, -VIDEO_DUMMY_LINES,
+            num_line_buffers, SCREEN_HEIGHT, LINE_REPEAT);
+        for(int i = 0;i < num_requests; ++i) {
+            if (timing) {
+                line_timing_requested(timing, line_start / 1000);
+            }
+
+            line_dispatch_request(&dispatch);
+        }
+    }
+
+    return dispatch.underrun_stats;
+}
+
+// Binary search for the largest extra per line load with no underruns
+static uint32_t find_max_extra_load(int num_cores, int num_line_buffers, double scale) {
+    uint32_t low = 0;
+    uint32_t high = LINE_RENDER_BUDGET_NS * 4;
+
+    if (simulate_underruns(num_cores, num_line_buffers, scale, 0, 0, NULL).total_underruns != 0) {
+        return 0;
+    }
+
+    while (high - low > 100) {
+        uint32_t mid = (low + high) / 2;
+
+        if (simulate_underruns(num_cores, num_line_buffers, scale, mid, 0,
+            NULL).total_underruns == 0) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+int main(int argc, char** argv) {
+    int num_extra_sprites = 0;
+    int num_line_buffers = 8;
+    double scale = 1.0;
+    num_frames = 60;
+    spike_ns = LINE_RENDER_BUDGET_NS * 2;
+    spike_start = 100;
+    spike_height = 8;
+    const char* timing_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:n:k:b:c:y:h:t:")) != -1) {
+        switch (opt) {
+            case 'f': num_frames = atoi(optarg); break;
+            case 'n': num_extra_sprites = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            case 'b': num_line_buffers = atoi(optarg); break;
+            case 'c': spike_ns = atoi(optarg); break;
+            case 'y': spike_start = atoi(optarg); break;
+            case 'h': spike_height = atoi(optarg); break;
+            case 't': timing_path = optarg; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_frames < 1 || num_extra_sprites < 0 || scale <= 0.0 || num_line_buffers < 2 ||
+        spike_start < 0 || spike_height < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    setup_village_scene(num_extra_sprites);
+
+    uint32_t* reference = calloc(num_frames, sizeof(uint32_t));
+    line_costs = calloc((size_t)num_frames * SCREEN_HEIGHT, sizeof(uint32_t));
+    uint16_t (*frame)[SCREEN_WIDTH] = calloc(SCREEN_HEIGHT, sizeof(*frame));
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    end_of_frame_cost = 0;
+
+    // Single threaded reference output and line costs
+    for(int frame_num = 0;frame_num < num_frames; ++frame_num) {
+        uint64_t start = bench_now_ns();
+        set_frame_scroll(frame_num);
+        uint64_t elapsed = bench_now_ns() - start;
+        if (frame_num == 0 || elapsed < end_of_frame_cost) {
+            end_of_frame_cost = elapsed;
+        }
+
+        // Take the fastest of a few draws of each line so host preemption doesn't show up as
+        // line cost
+        for(int line = 0;line < SCREEN_HEIGHT; ++line) {
+            uint32_t line_cost = UINT32_MAX;
+
+            for(int i = 0;i < 3; ++i) {
+                start = bench_now_ns();
+                draw_village_line(line, frame[line]);
+                elapsed = bench_now_ns() - start;
+                elapsed = elapsed > timer_overhead ? elapsed - timer_overhead : 0;
+
+                if (elapsed < line_cost) {
+                    line_cost = elapsed;
+                }
+            }
+
+            line_costs[frame_num * SCREEN_HEIGHT + line] = line_cost;
+        }
+
+        reference[frame_num] = frame_checksum(frame);
+    }
+
+    int num_errors = 0;
+    for(int num_cores = 1;num_cores <= MAX_RENDER_CORES; ++num_cores) {
+        num_errors += run_threaded(num_cores, num_line_buffers, reference);
+    }
+
+    printf("simulated timing, scale %.2f, end of frame %lu ns, %u ns line budget\n", scale,
+        (unsigned long)(end_of_frame_cost * scale), LINE_RENDER_BUDGET_NS);
+    printf("spike band: lines %d - %d cost %u ns extra\n", spike_start,
+        spike_start + spike_height - 1, spike_ns);
+    printf("cores buffers  max extra load   spike: frames with underruns  max/frame  total\n");
+    for(int num_cores = 1;num_cores <= MAX_RENDER_CORES; ++num_cores) {
+        for(int buffers = 2;buffers <= 32; buffers *= 2) {
+            uint32_t max_extra = find_max_extra_load(num_cores, buffers, scale);
+            line_underrun_stats_t stats =
+                simulate_underruns(num_cores, buffers, scale, 0, spike_ns, NULL);
+
+            printf("%5d %7d %8u (%.2fx) %22u/%-6u %10u %6u\n", num_cores, buffers, max_extra,
+                (double)max_extra / LINE_RENDER_BUDGET_NS, stats.frames_with_underruns,
+                stats.frames, stats.max_frame_underruns, stats.total_underruns);
+        }
+    }
+
+    if (timing_path) {
+        timing_file = (strcmp(timing_path, "-") == 0) ? stdout : fopen(timing_path, "w");
+        if (!timing_file) {
+            fprintf(stderr, "Could not open %s\n", timing_path);
+            return 1;
+        }
+
+        line_timing_t timing;
+        line_timing_init(&timing, SCREEN_HEIGHT, SIM_TIMING_SUMMARY_FRAMES);
+        line_underrun_stats_t stats =
+            simulate_underruns(MAX_RENDER_CORES, num_line_buffers, scale, 0, spike_ns, &timing);
+        printf("line timing of %d cores, %d line buffers with the spike band written to %s "
+            "(%u underruns)\n", MAX_RENDER_CORES, num_line_buffers, timing_path,
+            stats.total_underruns);
+
+        if (timing_file != stdout) {
+            fclose(timing_file);
+        }
+    }
+
+    free(reference);
+    free(line_costs);
+    free(frame);
+
+    return num_errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,492 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "pio_vga_entities.h"
+#include "village_scene.h"
+
+// Time the entity updates `end_of_frame` does for a crowd of characters on a large map. Reports:
+//  - The cost per entity update of each movement kind's pass in `pio_vga_entities.c`, every
+//    entity updated every frame
+//  - The same for the array of structs `process_entity` the demo used before, branching on the
+//    movement type and pointing the entity's sprite at its frame on every update
+//  - A mixed crowd of patrolling and wandering entities updated as the demo does, a tick every
+//    `-t` frames and at most `-b` entities a frame, with NUM_SPRITES sprites following entities.
+//    Each frame's update and sprite sync is reported against the vblank.
+//  - Culling mixed crowds of growing size on maps growing with them, so about `-v` entities are
+//    in view at a time, while the view bounces around the map as the demo's scroll does. The grid
+//    cull and sprite sync, and building the sprite line index, are timed per frame against
+//    checking every entity against the view. The grid cull must find every entity in view.
+//
+// A checksum of the mixed crowd's final positions is reported, it should only change when the
+// movement rules do.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-n entities] [-m map_tiles] [-f frames] [-t tick_frames] [-b budget] "
+        "[-g cell_tiles] [-v in_view] [-k scale]\n"
+        "  -n  Number of entities (default 2048)\n"
+        "  -m  Width and height of the map in tiles, up to %d (default 512)\n"
+        "  -f  Number of frames per test (default 600)\n"
+        "  -t  Frames per entity tick in the mixed crowd (default 4)\n"
+        "  -b  Most entities updated per frame in the mixed crowd (default 512)\n"
+        "  -g  Grid cell size in tiles, a power of two (default 8)\n"
+        "  -v  Entities in view on average when culling (default 32)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog, INT16_MAX / TILE_WIDTH);
+}
+
+static uint32_t rand_state = 0x2545f491;
+
+static int bench_rand(int range) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return (rand_state >> 8) % range;
+}
+
+// Characters in the sprite sheet
+#define NUM_CHARACTERS 6
+
+// Patrolling entities walk between 16 and 160 pixels
+#define MIN_PATROL 16
+#define PATROL_RANGE 144
+
+static int map_pixels;
+
+static void set_bench_sprite_frame(sprite_info_t* sprite, int sheet_frame) {
+    set_sprite_frame(sprite, village_sprite_ptr(0), sheet_frame);
+}
+
+// Add an entity of `move_type` at a random position on the map
+static void add_random_entity(entity_system_t* entities, move_type_e move_type) {
+    int x = bench_rand(map_pixels - MIN_PATROL - PATROL_RANGE);
+    int y = bench_rand(map_pixels - MIN_PATROL - PATROL_RANGE);
+    int distance = MIN_PATROL + bench_rand(PATROL_RANGE);
+    int upper_bound = (move_type == kMoveTypeVertical ? y : x) + distance;
+
+    entity_add(entities, move_type, x, y, upper_bound, bench_rand(NUM_CHARACTERS));
+}
+
+static bool setup_entities(entity_system_t* entities, const int capacity[kNumMoveTypes],
+    int tick_frames, int frame_budget) {
+
+    if (!entity_system_init(entities, capacity, tick_frames, frame_budget)) {
+        return false;
+    }
+
+    entity_system_set_wander_area(entities, 0, 0, map_pixels - SPRITE_WIDTH,
+        map_pixels - village_sprite_height());
+
+    for(int kind = 0;kind < kNumMoveTypes; ++kind) {
+        for(int i = 0;i < capacity[kind]; ++i) {
+            add_random_entity(entities, kind);
+        }
+    }
+
+    return true;
+}
+
+// Share `num_entities` between the movement kinds as a crowd, mostly wandering
+static void mixed_capacity(int num_entities, int capacity[kNumMoveTypes]) {
+    capacity[kMoveTypeHorizontal] = num_entities / 8;
+    capacity[kMoveTypeVertical] = num_entities / 8;
+    capacity[kMoveTypeNone] = num_entities / 16;
+    capacity[kMoveTypeWander] = num_entities - capacity[kMoveTypeHorizontal] -
+        capacity[kMoveTypeVertical] - capacity[kMoveTypeNone];
+}
+
+// Update `num_entities` entities of a single kind every frame, returning ns per entity update
+static double time_kind(move_type_e move_type, int num_entities, int num_frames) {
+    int capacity[kNumMoveTypes] = {0};
+    entity_system_t entities;
+
+    capacity[move_type] = num_entities;
+    if (!setup_entities(&entities, capacity, 1, num_entities)) {
+        return 0.0;
+    }
+
+    uint64_t start = bench_now_ns();
+    for(int frame = 0;frame < num_frames; ++frame) {
+        entity_system_update(&entities);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    uint32_t updates = entities.total_updates;
+
+    entity_system_free(&entities);
+
+    return updates ? (double)elapsed / updates : 0.0;
+}
+
+// The array of structs entity and `process_entity` from before `pio_vga_entities.c`, with every
+// entity moving every frame. Each entity has a sprite.
+typedef struct {
+    int sprite_idx;
+    int character_idx;
+    int anim_frame;
+    move_type_e move_type;
+    int move_lower_bound;
+    int move_upper_bound;
+    bool move_increase;
+    bool enabled;
+} aos_entity_t;
+
+static void aos_process_entity(aos_entity_t* entity, sprite_info_t* sprites, int frame) {
+    bool new_anim = false;
+    sprite_info_t* sprite = &sprites[entity->sprite_idx];
+
+    if (entity->move_increase) {
+        if (entity->move_type == kMoveTypeHorizontal) {
+            sprite->x++;
+            if (sprite->x == entity->move_upper_bound) {
+                entity->move_increase = false;
+                new_anim = true;
+            }
+        } else {
+            sprite->y++;
+            if (sprite->y == entity->move_upper_bound) {
+                entity->move_increase = false;
+                new_anim = true;
+            }
+        }
+    } else {
+        if (entity->move_type == kMoveTypeHorizontal) {
+            sprite->x--;
+            if (sprite->x == entity->move_lower_bound) {
+                entity->move_increase = true;
+                new_anim = true;
+            }
+        } else {
+            sprite->y--;
+            if (sprite->y == entity->move_lower_bound) {
+                entity->move_increase = true;
+                new_anim = true;
+            }
+        }
+    }
+
+    walk_anim_e anim;
+    if (entity->move_type == kMoveTypeHorizontal) {
+        anim = entity->move_increase ? kWalkAnimRight : kWalkAnimLeft;
+    } else {
+        anim = entity->move_increase ? kWalkAnimDown : kWalkAnimUp;
+    }
+
+    int next_frame = entity->anim_frame;
+    if (new_anim) {
+        next_frame = 0;
+    } else if ((frame % 2) == 0) {
+        next_frame = entity->anim_frame + 1;
+        if ((next_frame % FRAMES_PER_WALK_ANIM) == 0) {
+            next_frame = 0;
+        }
+    }
+    entity->anim_frame = next_frame;
+
+    set_bench_sprite_frame(sprite, entity->character_idx * ANIMS_FRAMES_PER_CHARACTER +
+        anim * FRAMES_PER_WALK_ANIM + next_frame);
+}
+
+// Update `num_entities` alternately horizontal and vertical entities every frame with
+// `aos_process_entity`, returning ns per entity update
+static double time_aos(int num_entities, int num_frames) {
+    aos_entity_t* aos_entities = calloc(num_entities, sizeof(aos_entity_t));
+    sprite_info_t* sprites = calloc(num_entities, sizeof(sprite_info_t));
+
+    if (!aos_entities || !sprites) {
+        free(aos_entities);
+        free(sprites);
+        return 0.0;
+    }
+
+    for(int i = 0;i < num_entities; ++i) {
+        aos_entity_t* entity = &aos_entities[i];
+        int x = bench_rand(map_pixels - MIN_PATROL - PATROL_RANGE);
+        int y = bench_rand(map_pixels - MIN_PATROL - PATROL_RANGE);
+        int distance = MIN_PATROL + bench_rand(PATROL_RANGE);
+
+        entity->sprite_idx = i;
+        entity->character_idx = bench_rand(NUM_CHARACTERS);
+        entity->move_type = (i & 1) ? kMoveTypeVertical : kMoveTypeHorizontal;
+        entity->move_lower_bound = entity->move_type == kMoveTypeHorizontal ? x : y;
+        entity->move_upper_bound = entity->move_lower_bound + distance;
+        entity->move_increase = true;
+        entity->enabled = true;
+
+        sprites[i].x = x;
+        sprites[i].y = y;
+        sprites[i].height = village_sprite_height();
+        sprites[i].format = kPixelFormatRGB555;
+    }
+
+    uint64_t start = bench_now_ns();
+    for(int frame = 0;frame < num_frames; ++frame) {
+        for(int i = 0;i < num_entities; ++i) {
+            if (aos_entities[i].enabled && aos_entities[i].move_type != kMoveTypeNone) {
+                aos_process_entity(&aos_entities[i], sprites, frame);
+            }
+        }
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    free(aos_entities);
+    free(sprites);
+
+    return (double)elapsed / ((uint64_t)num_entities * num_frames);
+}
+
+// Grid bytes per entity, its neighbours in its cell's list and its cell
+#define GRID_ENTITY_BYTES 6
+
+// Entities whose sprite is in the view found by checking every one
+static int count_in_view(const entity_system_t* entities, int view_x, int view_y) {
+    int num_in_view = 0;
+
+    for(int i = 0;i < entities->max_entities; ++i) {
+        int x = entities->x[i];
+        int y = entities->y[i];
+
+        if ((x + SPRITE_WIDTH > view_x) && (x < view_x + SCREEN_WIDTH) &&
+            (y + village_sprite_height() > view_y) && (y < view_y + SCREEN_HEIGHT)) {
+            ++num_in_view;
+        }
+    }
+
+    return num_in_view;
+}
+
+// Cull a mixed crowd of `population` on a map sized so about `in_view` are in view, bouncing the
+// view around the map a pixel a frame. Prints a row of the culling table, returns false if the
+// grid cull and checking every entity disagree or an entity in view was left without a sprite
+// while there were sprites free.
+static bool time_culling(int population, int cell_tiles, int in_view, int num_frames,
+    int tick_frames, int frame_budget, double scale) {
+
+    int screen_tiles = (SCREEN_WIDTH / TILE_WIDTH) * (SCREEN_HEIGHT / TILE_HEIGHT);
+    int map_tiles = 32;
+    while (map_tiles * map_tiles * in_view < population * screen_tiles &&
+        map_tiles < INT16_MAX / TILE_WIDTH) {
+        ++map_tiles;
+    }
+
+    int capacity[kNumMoveTypes];
+    entity_system_t entities;
+
+    mixed_capacity(population, capacity);
+    map_pixels = map_tiles * TILE_WIDTH;
+    rand_state = 0x2545f491;
+
+    if (!setup_entities(&entities, capacity, tick_frames, frame_budget)) {
+        fprintf(stderr, "Could not allocate %d entities\n", population);
+        return false;
+    }
+
+    if (!entity_system_build_grid(&entities, map_tiles, map_tiles, cell_tiles)) {
+        fprintf(stderr, "Could not build a grid of %d tile cells\n", cell_tiles);
+        entity_system_free(&entities);
+        return false;
+    }
+
+    init_sprites();
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        screen_sprites[i].height = village_sprite_height();
+        screen_sprites[i].format = kPixelFormatRGB555;
+    }
+    entity_system_set_cull_sprites(&entities, 0, NUM_SPRITES, SPRITE_WIDTH,
+        village_sprite_height());
+
+    int max_x_scroll = map_pixels - SCREEN_WIDTH - 1;
+    int max_y_scroll = map_pixels - SCREEN_HEIGHT - 1;
+    int x_scroll = 0;
+    int y_scroll = 0;
+    int x_step = 1;
+    int y_step = 1;
+
+    uint64_t cull_ns = 0;
+    uint64_t index_ns = 0;
+    uint64_t scan_ns = 0;
+    uint64_t num_visible = 0;
+    uint64_t num_cells = 0;
+    bool ok = true;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        entity_system_update(&entities);
+
+        x_step = x_scroll == max_x_scroll ? -1 : (x_scroll == 0 ? 1 : x_step);
+        y_step = y_scroll == max_y_scroll ? -1 : (y_scroll == 0 ? 1 : y_step);
+        x_scroll += x_step;
+        y_scroll += y_step;
+        sprite_scroll_x = x_scroll;
+        sprite_scroll_y = y_scroll;
+
+        uint32_t overflow = entities.cull_overflow;
+
+        uint64_t start = bench_now_ns();
+        entity_system_cull_sprites(&entities, x_scroll, y_scroll, SCREEN_WIDTH, SCREEN_HEIGHT);
+        entity_system_sync_sprites(&entities, set_bench_sprite_frame);
+        uint64_t culled = bench_now_ns();
+        build_sprite_line_index();
+        uint64_t indexed = bench_now_ns();
+        int scan_visible = count_in_view(&entities, x_scroll, y_scroll);
+        uint64_t scanned = bench_now_ns();
+
+        cull_ns += culled - start;
+        index_ns += indexed - culled;
+        scan_ns += scanned - indexed;
+        num_visible += entities.cull_visible;
+        num_cells += entities.cull_cells;
+
+        int num_bound = 0;
+        for(int i = 0;i < NUM_SPRITES; ++i) {
+            if (entities.sprite_entity[i] >= 0 && screen_sprites[i].enabled) {
+                ++num_bound;
+            }
+        }
+
+        if (scan_visible != entities.cull_visible ||
+            num_bound != entities.cull_visible - (int)(entities.cull_overflow - overflow)) {
+            ok = false;
+        }
+    }
+
+    int grid_bytes = entities.grid_width * entities.grid_height * sizeof(int16_t) +
+        population * GRID_ENTITY_BYTES;
+
+    printf("  %8d %9d %8.1f %6.1f %9.0f %10.0f %11.0f %9.1f%s\n", population, map_tiles,
+        (double)num_visible / num_frames, (double)num_cells / num_frames,
+        (cull_ns * scale) / num_frames, (index_ns * scale) / num_frames,
+        (scan_ns * scale) / num_frames, grid_bytes / 1024.0, ok ? "" : " MISMATCH");
+
+    if (entities.cull_overflow) {
+        printf("    %u entities in view had no sprite free\n", entities.cull_overflow);
+    }
+
+    entity_system_free(&entities);
+
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    int num_entities = 2048;
+    int map_tiles = 512;
+    int num_frames = 600;
+    int tick_frames = 4;
+    int frame_budget = 512;
+    int cell_tiles = 8;
+    int in_view = 32;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:m:f:t:b:g:v:k:")) != -1) {
+        switch (opt) {
+            case 'n': num_entities = atoi(optarg); break;
+            case 'm': map_tiles = atoi(optarg); break;
+            case 'f': num_frames = atoi(optarg); break;
+            case 't': tick_frames = atoi(optarg); break;
+            case 'b': frame_budget = atoi(optarg); break;
+            case 'g': cell_tiles = atoi(optarg); break;
+            case 'v': in_view = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_entities < NUM_SPRITES || map_tiles < 32 || map_tiles > INT16_MAX / TILE_WIDTH ||
+        num_frames < 1 || tick_frames < 1 || frame_budget < 1 || cell_tiles < 1 ||
+        in_view < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    map_pixels = map_tiles * TILE_WIDTH;
+    init_sprites();
+
+    printf("%d entities on a %dx%d tile map, %d frames\n\n", num_entities, map_tiles, map_tiles,
+        num_frames);
+
+    const char* kind_names[NUM_MOVING_TYPES] = {"horizontal", "vertical", "wander"};
+    printf("ns per entity update, every entity updated every frame:\n");
+    for(int kind = 0;kind < NUM_MOVING_TYPES; ++kind) {
+        printf("  %-24s %6.2f\n", kind_names[kind],
+            time_kind(kind, num_entities, num_frames) * scale);
+    }
+    printf("  %-24s %6.2f\n\n", "aos process_entity", time_aos(num_entities, num_frames) * scale);
+
+    // A mixed crowd with sprites following entities spread through it
+    int capacity[kNumMoveTypes];
+    mixed_capacity(num_entities, capacity);
+
+    entity_system_t entities;
+    rand_state = 0x2545f491;
+    if (!setup_entities(&entities, capacity, tick_frames, frame_budget)) {
+        fprintf(stderr, "Could not allocate %d entities\n", num_entities);
+        return 1;
+    }
+
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        screen_sprites[i].height = village_sprite_height();
+        screen_sprites[i].format = kPixelFormatRGB555;
+        screen_sprites[i].enabled = true;
+        entity_system_bind_sprite(&entities, i, (i * num_entities) / NUM_SPRITES);
+    }
+
+    bench_samples_t samples;
+    bench_samples_init(&samples, num_frames);
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    uint64_t total_ns = 0;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        uint64_t start = bench_now_ns();
+        entity_system_update(&entities);
+        if (entities.frame_updates) {
+            entity_system_sync_sprites(&entities, set_bench_sprite_frame);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+
+        elapsed = elapsed > timer_overhead ? elapsed - timer_overhead : 0;
+        total_ns += elapsed;
+        bench_samples_add(&samples, elapsed);
+    }
+
+    char name[128];
+    snprintf(name, sizeof(name), "mixed crowd, tick every %d frames, budget %d per frame",
+        tick_frames, frame_budget);
+    bench_samples_report(name, &samples, VBLANK_TIME_NS, scale);
+
+    int num_moving = entity_system_num_moving(&entities);
+    printf("  %d horizontal, %d vertical, %d wandering, %d stationary, %d sprites\n",
+        capacity[kMoveTypeHorizontal], capacity[kMoveTypeVertical], capacity[kMoveTypeWander],
+        capacity[kMoveTypeNone], NUM_SPRITES);
+    printf("  ticks %u (%u late), %u updates, %.2f ns per entity update\n", entities.tick,
+        entities.late_ticks, entities.total_updates,
+        entities.total_updates ? (total_ns * scale) / entities.total_updates : 0.0);
+    printf("  moving entities walk a pixel every %.1f frames\n",
+        entities.tick ? (double)num_frames / entities.tick : 0.0);
+
+    int entity_bytes = 5 * sizeof(int16_t) + 2 * sizeof(int8_t) + 4 * sizeof(uint8_t);
+    printf("  %d bytes per entity (%d more with the grid), %d bytes for all %d (%d moving)\n",
+        entity_bytes, GRID_ENTITY_BYTES, entity_bytes * entities.max_entities,
+        entities.max_entities, num_moving);
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    checksum = bench_fnv1a(checksum, entities.x, entities.max_entities * sizeof(int16_t));
+    checksum = bench_fnv1a(checksum, entities.y, entities.max_entities * sizeof(int16_t));
+    checksum = bench_fnv1a(checksum, entities.anim_frame, entities.max_entities);
+    printf("positions checksum %08x\n", checksum);
+
+    bench_samples_free(&samples);
+    entity_system_free(&entities);
+
+    printf("\nculling, %dx%d tile cells, ns per frame:\n", cell_tiles, cell_tiles);
+    printf("  %8s %9s %8s %6s %9s %10s %11s %9s\n", "entities", "map tiles", "in view", "cells",
+        "grid cull", "line index", "scan all", "grid KB");
+
+    bool ok = true;
+    for(int population = num_entities / 4;population <= num_entities * 4 &&
+        population <= MAX_GRID_ENTITIES; population *= 4) {
+
+        ok &= time_culling(population, cell_tiles, in_view, num_frames, tick_frames,
+            frame_budget, scale);
+    }
+
+    return ok ? 0 : 1;
+}
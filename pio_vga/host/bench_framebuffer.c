@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Compare the CPU cost per frame of the scanline renderer with an 8bpp framebuffer, following the
+// demo's bouncing scroll over the 8bpp village scene. Modes are:
+//  - scanline: Tilemap and sprites drawn a line at a time, as the demo does
+//  - framebuffer redraw: Every frame the visible tiles and sprites are copied into a full screen
+//    framebuffer which is then expanded a line at a time. Must match the scanline output.
+//  - framebuffer static: Only expanding the framebuffer, for a frame where nothing changed
+//  - hybrid: The scanline scene with a transparent framebuffer window of particles over the
+//    bottom of the screen, the particles being moved and redrawn every frame
+//
+// Per frame costs are given against the time a single render core has to draw a frame
+// (SCREEN_HEIGHT line render budgets).
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-f frames] [-n particles] [-k scale]\n"
+        "  -f  Number of frames per mode (default 600)\n"
+        "  -n  Number of particles in the hybrid window (default 256)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+typedef enum {
+    kModeScanline,
+    kModeFramebufferRedraw,
+    kModeFramebufferStatic,
+    kModeHybrid,
+    kNumModes
+} mode_e;
+
+static const char* mode_names[kNumModes] = {
+    "scanline", "framebuffer redraw", "framebuffer static", "hybrid"
+};
+
+#define WINDOW_HEIGHT 96
+#define PARTICLE_SHIFT 4
+
+typedef struct {
+    int x;
+    int y;
+    int dx;
+    int dy;
+} particle_t;
+
+static particle_t* particles;
+static int num_particles = 256;
+
+// The framebuffer's palette holds the tile colours followed by the sprite colours (without the
+// sprite palette's transparent colour 0)
+static uint16_t shared_colours[256];
+static palette_t shared_palette = {shared_colours, 0, NULL};
+static int sprite_colour_offset;
+
+static const uint16_t particle_colours[] = {0x0000, 0x7fff, 0x03ff, 0x01ff, 0x001f};
+static palette_t particle_palette = {particle_colours, 5, NULL};
+
+static void setup_shared_palette() {
+    const palette_t* tile_palette = village_tilemap.palette;
+
+    memcpy(shared_colours, tile_palette->colours, tile_palette->num_colours * sizeof(uint16_t));
+    sprite_colour_offset = tile_palette->num_colours - 1;
+    memcpy(shared_colours + tile_palette->num_colours, sprite_palette->colours + 1,
+        (sprite_palette->num_colours - 1) * sizeof(uint16_t));
+    shared_palette.num_colours = tile_palette->num_colours + sprite_palette->num_colours - 1;
+}
+
+// Copy the visible tiles and the sprites of the scene into the framebuffer as the scanline
+// renderer would draw them. Sprites are drawn last first so the first is on top.
+static void draw_scene_to_framebuffer() {
+    int x_scroll = tilemap_scroll_x;
+    int y_scroll = tilemap_scroll_y;
+    int tile_bytes = TILE_WIDTH * TILE_HEIGHT;
+
+    for(int tile_y = y_scroll / TILE_HEIGHT;tile_y * TILE_HEIGHT < y_scroll + SCREEN_HEIGHT;
+        ++tile_y) {
+
+        for(int tile_x = x_scroll / TILE_WIDTH;tile_x * TILE_WIDTH < x_scroll + SCREEN_WIDTH;
+            ++tile_x) {
+
+            uint16_t tile = village_tilemap.tiles[tile_y * village_tilemap.width + tile_x];
+            framebuffer_blit(&framebuffer, village_tilemap.tileset_indexed + tile * tile_bytes,
+                TILE_WIDTH, TILE_HEIGHT, tile_x * TILE_WIDTH - x_scroll,
+                tile_y * TILE_HEIGHT - y_scroll, false, 0);
+        }
+    }
+
+    for(int i = NUM_SPRITES - 1;i >= 0; --i) {
+        const sprite_info_t* sprite = &screen_sprites[i];
+
+        if (sprite->enabled) {
+            framebuffer_blit(&framebuffer, sprite->data_ptr, SPRITE_WIDTH, sprite->height,
+                sprite->x - sprite_scroll_x, sprite->y - sprite_scroll_y, true,
+                sprite_colour_offset);
+        }
+    }
+}
+
+static void setup_particles() {
+    uint32_t rand_state = 0x1234567;
+
+    for(int i = 0;i < num_particles; ++i) {
+        rand_state = rand_state * 1664525u + 1013904223u;
+        particles[i].x = ((rand_state >> 8) % SCREEN_WIDTH) << PARTICLE_SHIFT;
+        particles[i].dx = ((rand_state >> 20) % 33) - 16;
+        rand_state = rand_state * 1664525u + 1013904223u;
+        particles[i].y = ((rand_state >> 8) % WINDOW_HEIGHT) << PARTICLE_SHIFT;
+        particles[i].dy = ((rand_state >> 20) % 33) - 16;
+    }
+}
+
+// Erase, move and redraw every particle, bouncing them off the edges of the window
+static void update_particles() {
+    for(int i = 0;i < num_particles; ++i) {
+        particle_t* particle = &particles[i];
+
+        framebuffer_plot(&framebuffer, particle->x >> PARTICLE_SHIFT,
+            particle->y >> PARTICLE_SHIFT, 0);
+
+        particle->x += particle->dx;
+        particle->y += particle->dy;
+
+        if ((particle->x < 0) || (particle->x >= SCREEN_WIDTH << PARTICLE_SHIFT)) {
+            particle->dx = -particle->dx;
+            particle->x += particle->dx * 2;
+        }
+
+        if ((particle->y < 0) || (particle->y >= WINDOW_HEIGHT << PARTICLE_SHIFT)) {
+            particle->dy = -particle->dy;
+            particle->y += particle->dy * 2;
+        }
+
+        framebuffer_plot(&framebuffer, particle->x >> PARTICLE_SHIFT,
+            particle->y >> PARTICLE_SHIFT, 1 + (i % 4));
+    }
+}
+
+static bool setup_mode(mode_e mode) {
+    framebuffer.enabled = false;
+    setup_village_scene(0);
+
+    switch (mode) {
+        case kModeFramebufferRedraw:
+        case kModeFramebufferStatic:
+            setup_shared_palette();
+
+            if (!build_framebuffer(&framebuffer, SCREEN_WIDTH, SCREEN_HEIGHT)) {
+                return false;
+            }
+
+            framebuffer.palette = &shared_palette;
+            framebuffer.colour_zero_transparent = false;
+            framebuffer.enabled = true;
+            break;
+        case kModeHybrid:
+            if (!build_framebuffer(&framebuffer, SCREEN_WIDTH, WINDOW_HEIGHT)) {
+                return false;
+            }
+
+            framebuffer.y = SCREEN_HEIGHT - WINDOW_HEIGHT;
+            framebuffer.palette = &particle_palette;
+            framebuffer.colour_zero_transparent = true;
+            framebuffer.enabled = true;
+            setup_particles();
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+// Draw `num_frames` frames in a mode returning a checksum of the output and the total time taken
+static uint32_t run_mode(mode_e mode, int num_frames, uint64_t timer_overhead,
+    uint64_t* total_ns) {
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    int x_scroll = 0;
+    int y_scroll = 0;
+    bool x_inc = true;
+    bool y_inc = true;
+
+    *total_ns = 0;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        // The static framebuffer keeps the first frame's scroll, the others follow the demo
+        if ((mode != kModeFramebufferStatic) || (frame == 0)) {
+            set_village_scroll(x_scroll, y_scroll);
+        }
+
+        // In framebuffer modes the sprites are part of the framebuffer so aren't drawn on top of
+        // it, set an empty sprite index (and put it back after) to leave them out
+        bool sprites_in_framebuffer = (mode == kModeFramebufferRedraw) ||
+            (mode == kModeFramebufferStatic);
+
+        uint64_t start = bench_now_ns();
+
+        if ((mode == kModeFramebufferRedraw) || ((mode == kModeFramebufferStatic) && !frame)) {
+            draw_scene_to_framebuffer();
+        } else if (mode == kModeHybrid) {
+            update_particles();
+        }
+
+        if (sprites_in_framebuffer) {
+            memset(sprite_line_count, 0, sizeof(sprite_line_count));
+        }
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            draw_village_line(line_y, line_buffer);
+            checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+        }
+
+        uint64_t elapsed = bench_now_ns() - start;
+        *total_ns += elapsed > timer_overhead ? elapsed - timer_overhead : 0;
+
+        if (sprites_in_framebuffer) {
+            build_sprite_line_index();
+        }
+
+        if (y_scroll == village_max_y_scroll()) {
+            y_inc = false;
+        } else if (y_scroll == 0) {
+            y_inc = true;
+        }
+
+        if (x_scroll == village_max_x_scroll()) {
+            x_inc = false;
+        } else if (x_scroll == 0) {
+            x_inc = true;
+        }
+
+        y_scroll += y_inc ? 1 : -1;
+        x_scroll += x_inc ? 1 : -1;
+    }
+
+    return checksum;
+}
+
+int main(int argc, char** argv) {
+    int num_frames = 600;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:n:k:")) != -1) {
+        switch (opt) {
+            case 'f': num_frames = atoi(optarg); break;
+            case 'n': num_particles = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_frames < 1 || num_particles < 0 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    particles = malloc((num_particles ? num_particles : 1) * sizeof(particle_t));
+    if (!particles) {
+        fprintf(stderr, "Could not allocate particles\n");
+        return 1;
+    }
+
+    // Framebuffer pixels index a single palette, 8bpp tiles and sprites share it
+    set_village_pixel_format(kPixelFormat8bpp, false);
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    double frame_budget_us = SCREEN_HEIGHT * (LINE_RENDER_BUDGET_NS / 1000.0);
+    uint32_t checksums[kNumModes];
+
+    printf("%d frames per mode, %d particles, timer overhead %lu ns, scale %.2f\n", num_frames,
+        num_particles, (unsigned long)timer_overhead, scale);
+    printf("%-20s %14s %14s %12s %10s\n", "mode", "framebuffer KB", "us per frame", "of budget",
+        "checksum");
+
+    for(int mode = 0;mode < kNumModes; ++mode) {
+        if (!setup_mode(mode)) {
+            fprintf(stderr, "Could not allocate framebuffer\n");
+            return 1;
+        }
+
+        uint64_t total_ns;
+        checksums[mode] = run_mode(mode, num_frames, timer_overhead, &total_ns);
+        double frame_us = (total_ns * scale / 1000.0) / num_frames;
+
+        printf("%-20s %14.1f %14.1f %11.2f%% %10x\n", mode_names[mode],
+            framebuffer.enabled ? framebuffer.width * framebuffer.height / 1000.0 : 0.0,
+            frame_us, 100.0 * frame_us / frame_budget_us, checksums[mode]);
+
+        framebuffer.enabled = false;
+        free_framebuffer(&framebuffer);
+    }
+
+    free(particles);
+
+    bool matched = checksums[kModeFramebufferRedraw] == checksums[kModeScanline];
+    printf("framebuffer redraw output %s the scanline output\n",
+        matched ? "matches" : "DOESN'T MATCH");
+
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "pio_vga_render.h"
+#include "test_tilemap.h"
+#include "village_tileset.h"
+
+// Time `draw_tilemap_layers_line` on a three layer scene built from the village map and tileset:
+//  - A back layer of the village map at half parallax standing in for a sky
+//  - The village map itself with its most common colour (the grass) keyed out
+//  - A sparse foreground 'canopy' at 1.25x parallax, a quarter of its tiles taken from the village
+//    map with the grass keyed out and the rest fully transparent
+//
+// The output is checked against a plain back to front painter that draws every layer pixel by
+// pixel, which is also timed along with how many pixels it writes per line.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-l layers] [-s scroll_step] [-k scale]\n"
+        "  -l  Number of layers to draw, 1 to 3 (default 3)\n"
+        "  -s  Step between scroll offsets in pixels (default 8)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+#define TILE_PIXELS (TILE_WIDTH * TILE_HEIGHT)
+
+static uint16_t* layer_tileset;
+static uint16_t* canopy_tiles;
+static int painter_pixel_writes;
+
+static int compare_colours(const void* a, const void* b) {
+    return *(const uint16_t*)a - *(const uint16_t*)b;
+}
+
+// Most frequently used colour in the tileset
+static uint16_t most_common_colour() {
+    int num_pixels = num_tiles * TILE_PIXELS;
+    uint16_t* sorted = malloc(num_pixels * sizeof(uint16_t));
+    memcpy(sorted, tileset, num_pixels * sizeof(uint16_t));
+    qsort(sorted, num_pixels, sizeof(uint16_t), compare_colours);
+
+    uint16_t best_colour = sorted[0];
+    int best_run = 0;
+    for(int i = 0;i < num_pixels;) {
+        int run = 1;
+        while (i + run < num_pixels && sorted[i + run] == sorted[i]) {
+            ++run;
+        }
+
+        if (run > best_run) {
+            best_run = run;
+            best_colour = sorted[i];
+        }
+
+        i += run;
+    }
+
+    free(sorted);
+
+    return best_colour;
+}
+
+static void setup_layer(int layer_idx, const uint16_t* tiles, int parallax, bool keyed,
+    uint16_t key) {
+
+    tilemap_layer_t* layer = &tilemap_layers[layer_idx];
+
+    layer->tilemap.width = tilemap_width;
+    layer->tilemap.height = tilemap_height;
+    layer->tilemap.tiles = tiles;
+    layer->tilemap.tileset = layer_tileset;
+    layer->tilemap.tileset_shifted = NULL;
+    layer->tilemap.x_scroll = 0;
+    layer->tilemap.y_scroll = 0;
+    layer->parallax_x = parallax;
+    layer->parallax_y = parallax;
+    layer->has_colour_key = keyed;
+    layer->colour_key = key;
+    layer->tile_row_opaque = NULL;
+    layer->enabled = true;
+
+    if (keyed) {
+        build_tilemap_layer_opacity(layer, num_tiles + 1);
+    }
+
+    // The back layer covers the whole screen so uses the aligned fast path, give it the shifted
+    // tileset it uses for odd X scroll positions
+    if (layer_idx == 0) {
+        build_shifted_tileset(&layer->tilemap, num_tiles + 1);
+    }
+}
+
+static void setup_layers(int num_layers) {
+    uint16_t key = most_common_colour();
+
+    // The village tileset plus one fully transparent tile on the end
+    layer_tileset = aligned_alloc(4, (num_tiles + 1) * TILE_PIXELS * sizeof(uint16_t));
+    memcpy(layer_tileset, tileset, num_tiles * TILE_PIXELS * sizeof(uint16_t));
+    for(int i = 0;i < TILE_PIXELS; ++i) {
+        layer_tileset[num_tiles * TILE_PIXELS + i] = key;
+    }
+
+    int map_tiles = tilemap_width * tilemap_height;
+    canopy_tiles = malloc(map_tiles * sizeof(uint16_t));
+    uint32_t rand_state = 1;
+    for(int i = 0;i < map_tiles; ++i) {
+        rand_state = rand_state * 1103515245 + 12345;
+        canopy_tiles[i] = ((rand_state >> 16) & 3) == 0 ? tilemap_tiles[(i * 7) % map_tiles] :
+            num_tiles;
+    }
+
+    num_tilemap_layers = num_layers;
+    setup_layer(0, tilemap_tiles, PARALLAX_ONE / 2, false, 0);
+    if (num_layers > 1) {
+        setup_layer(1, tilemap_tiles, PARALLAX_ONE, true, key);
+    }
+    if (num_layers > 2) {
+        setup_layer(2, canopy_tiles, PARALLAX_ONE + PARALLAX_ONE / 4, true, key);
+    }
+}
+
+// Reference drawing, every layer back to front pixel by pixel
+static void draw_layers_painter(uint16_t line_y, uint16_t* line_buffer) {
+    for(int i = 0;i < num_tilemap_layers; ++i) {
+        const tilemap_layer_t* layer = &tilemap_layers[i];
+        int map_width = layer->tilemap.width * TILE_WIDTH;
+        int map_height = layer->tilemap.height * TILE_HEIGHT;
+        int layer_y = (line_y + layer->tilemap.y_scroll +
+            ((tilemap_scroll_y * layer->parallax_y) >> PARALLAX_SHIFT)) % map_height;
+        int layer_x = (layer->tilemap.x_scroll +
+            ((tilemap_scroll_x * layer->parallax_x) >> PARALLAX_SHIFT)) % map_width;
+
+        const uint16_t* tilemap_line = get_tilemap_line(layer_y / TILE_HEIGHT, layer->tilemap);
+
+        for(int x = 0;x < SCREEN_WIDTH; ++x) {
+            int pixel_x = (layer_x + x) % map_width;
+            uint16_t tile_num = tilemap_line[pixel_x / TILE_WIDTH];
+            uint16_t colour = get_tile_line(tile_num, layer_y % TILE_HEIGHT,
+                layer->tilemap.tileset)[pixel_x % TILE_WIDTH];
+
+            if (!layer->has_colour_key || colour != layer->colour_key) {
+                line_buffer[x] = colour;
+                ++painter_pixel_writes;
+            }
+        }
+    }
+}
+
+typedef void (*layers_draw_fn)(uint16_t line_y, uint16_t* line_buffer);
+
+// Draw every line at every scroll offset with `draw_fn`, adding line times to `samples` and
+// returning a checksum of the output
+static uint32_t run_layers(layers_draw_fn draw_fn, int scroll_step, uint64_t timer_overhead,
+    bench_samples_t* samples) {
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    int max_x_scroll = tilemap_width * TILE_WIDTH - SCREEN_WIDTH - 1;
+    int max_y_scroll = tilemap_height * TILE_HEIGHT - SCREEN_HEIGHT - 1;
+
+    for(int y_scroll = 0;y_scroll <= max_y_scroll; y_scroll += scroll_step) {
+        for(int x_scroll = 0;x_scroll <= max_x_scroll; x_scroll += scroll_step) {
+            tilemap_scroll_x = x_scroll;
+            tilemap_scroll_y = y_scroll;
+
+            for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+                uint64_t start = bench_now_ns();
+                draw_fn(line_y, line_buffer);
+                uint64_t elapsed = bench_now_ns() - start;
+
+                elapsed = elapsed > timer_overhead ? elapsed - timer_overhead : 0;
+                bench_samples_add(samples, elapsed);
+                checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+            }
+        }
+    }
+
+    return checksum;
+}
+
+int main(int argc, char** argv) {
+    int num_layers = 3;
+    int scroll_step = 8;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "l:s:k:")) != -1) {
+        switch (opt) {
+            case 'l': num_layers = atoi(optarg); break;
+            case 's': scroll_step = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_layers < 1 || num_layers > 3 || scroll_step < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    setup_layers(num_layers);
+
+    size_t max_lines = (size_t)((tilemap_width * TILE_WIDTH - SCREEN_WIDTH) / scroll_step + 1) *
+        ((tilemap_height * TILE_HEIGHT - SCREEN_HEIGHT) / scroll_step + 1) * SCREEN_HEIGHT;
+
+    bench_samples_t samples;
+    bench_samples_init(&samples, max_lines);
+    if (samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate sample buffer\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    printf("%d layers, timer overhead %lu ns, scale %.2f\n", num_layers,
+        (unsigned long)timer_overhead, scale);
+
+    uint32_t layers_checksum = run_layers(draw_tilemap_layers_line, scroll_step, timer_overhead,
+        &samples);
+    bench_samples_report("front to back layers", &samples, LINE_RENDER_BUDGET_NS, scale);
+    size_t num_lines = samples.num_samples;
+
+    samples.num_samples = 0;
+    painter_pixel_writes = 0;
+    uint32_t painter_checksum = run_layers(draw_layers_painter, scroll_step, timer_overhead,
+        &samples);
+    bench_samples_report("back to front painter", &samples, LINE_RENDER_BUDGET_NS, scale);
+
+    printf("painter writes %.1f pixels per line, front to back writes each pixel once\n",
+        (double)painter_pixel_writes / num_lines);
+    printf("output checksums: layers %08x, painter %08x%s\n", layers_checksum, painter_checksum,
+        layers_checksum == painter_checksum ? "" : " MISMATCH");
+
+    bench_samples_free(&samples);
+
+    return layers_checksum == painter_checksum ? 0 : 1;
+}
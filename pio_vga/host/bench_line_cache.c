@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Time drawing frames of the village scene with and without the line cache, where lines nothing
+// changed on are copied from the previous frame rather than drawn. Scenarios are:
+//  - still: Nothing changes, as a menu or paused screen
+//  - walkers: The camera is still while the characters walk about as the demo's entities do
+//  - tile edits: The camera is still while a tile of the map is changed every frame
+//  - scrolling: The camera moves a pixel every frame as the demo does, so every line is drawn
+//
+// Each scenario's output must match drawing every line. The time freed per frame is what's left
+// of the frame's render time for game logic, audio mixing and so on.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-f frames] [-k scale]\n"
+        "  -f  Number of frames per scenario (default 240)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+typedef enum {
+    kScenarioStill,
+    kScenarioWalkers,
+    kScenarioTileEdits,
+    kScenarioScrolling,
+    kNumScenarios
+} scenario_e;
+
+static const char* scenario_names[kNumScenarios] = {"still", "walkers", "tile edits", "scrolling"};
+
+#define START_X_SCROLL 64
+#define START_Y_SCROLL 48
+// Characters walk this many pixels back and forth
+#define WALK_DISTANCE 32
+
+// Writable copy of the village map for the tile edits scenario
+static uint16_t* edited_tiles = NULL;
+
+static void setup_scenario(scenario_e scenario) {
+    setup_village_scene(0);
+
+    if (scenario == kScenarioTileEdits) {
+        size_t map_bytes = village_tilemap.width * village_tilemap.height * sizeof(uint16_t);
+        memcpy(edited_tiles, village_tilemap.tiles, map_bytes);
+        village_tilemap.tiles = edited_tiles;
+        tilemap_layers[0].tilemap.tiles = edited_tiles;
+    }
+
+    set_village_scroll(START_X_SCROLL, START_Y_SCROLL);
+}
+
+// Change the scene for frame `frame` of a scenario
+static void step_scenario(scenario_e scenario, int frame) {
+    switch (scenario) {
+        case kScenarioWalkers:
+            // As `process_entity` characters move a pixel every 4 frames, alternately
+            // horizontally and vertically
+            if ((frame % 4) == 0) {
+                int step = ((frame / 4) % (WALK_DISTANCE * 2)) < WALK_DISTANCE ? 1 : -1;
+
+                for(int i = 0;i < NUM_SPRITES && screen_sprites[i].enabled; ++i) {
+                    if (i & 1) {
+                        screen_sprites[i].y += step;
+                    } else {
+                        screen_sprites[i].x += step;
+                    }
+                }
+            }
+
+            build_sprite_line_index();
+            break;
+        case kScenarioTileEdits: {
+            // Swap a tile on screen with its neighbour, working through the visible tiles
+            int tile_x = START_X_SCROLL / TILE_WIDTH + (frame * 7) % TILES_PER_LINE;
+            int tile_y = START_Y_SCROLL / TILE_HEIGHT + (frame / 3) % (SCREEN_HEIGHT / TILE_HEIGHT);
+            uint16_t* tile = &edited_tiles[tile_y * village_tilemap.width + tile_x];
+            uint16_t swapped = tile[0];
+            tile[0] = tile[1];
+            tile[1] = swapped;
+
+            mark_layer_tile_dirty(0, tile_y);
+            break;
+        }
+        case kScenarioScrolling:
+            set_village_scroll(START_X_SCROLL + frame, START_Y_SCROLL + frame / 2);
+            break;
+        default:
+            break;
+    }
+}
+
+// Draw `num_frames` frames of a scenario returning a checksum of the output and adding the time
+// taken to draw each frame to `frame_samples`
+static uint32_t run_scenario(scenario_e scenario, int num_frames, bool cached,
+    bench_samples_t* frame_samples, uint64_t timer_overhead) {
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+
+    setup_scenario(scenario);
+
+    if (cached && !build_line_cache()) {
+        fprintf(stderr, "Could not allocate line cache\n");
+        exit(1);
+    }
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        step_scenario(scenario, frame);
+
+        uint64_t start = bench_now_ns();
+        update_line_cache();
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            if (!get_cached_line(line_y, line_buffer)) {
+                draw_village_line(line_y, line_buffer);
+                store_cached_line(line_y, line_buffer);
+            }
+        }
+
+        uint64_t elapsed = bench_now_ns() - start;
+        bench_samples_add(frame_samples, elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+
+        // The output is checksummed outside of the timed drawing, the same for both runs
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            if (!get_cached_line(line_y, line_buffer)) {
+                draw_village_line(line_y, line_buffer);
+            }
+
+            checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+        }
+    }
+
+    return checksum;
+}
+
+int main(int argc, char** argv) {
+    int num_frames = 240;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:k:")) != -1) {
+        switch (opt) {
+            case 'f': num_frames = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_frames < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    setup_village_scene(0);
+    edited_tiles = malloc(village_tilemap.width * village_tilemap.height * sizeof(uint16_t));
+
+    bench_samples_t drawn_samples, cached_samples;
+    bench_samples_init(&drawn_samples, num_frames);
+    bench_samples_init(&cached_samples, num_frames);
+    if (!edited_tiles || drawn_samples.max_samples == 0 || cached_samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate buffers\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    int num_mismatches = 0;
+
+    printf("%d frames per scenario, timer overhead %lu ns, scale %.2f\n", num_frames,
+        (unsigned long)timer_overhead, scale);
+    printf("%-12s %12s %16s %16s %16s\n", "scenario", "lines reused", "drawn us/frame",
+        "cached us/frame", "freed us/frame");
+
+    for(int scenario = 0;scenario < kNumScenarios; ++scenario) {
+        drawn_samples.num_samples = 0;
+        cached_samples.num_samples = 0;
+
+        uint32_t drawn_checksum = run_scenario(scenario, num_frames, false, &drawn_samples,
+            timer_overhead);
+        uint32_t cached_checksum = run_scenario(scenario, num_frames, true, &cached_samples,
+            timer_overhead);
+
+        double drawn_us = 0.0;
+        double cached_us = 0.0;
+        for(int i = 0;i < num_frames; ++i) {
+            drawn_us += drawn_samples.samples[i] * scale / 1000.0;
+            cached_us += cached_samples.samples[i] * scale / 1000.0;
+        }
+        drawn_us /= num_frames;
+        cached_us /= num_frames;
+
+        double reused = 100.0 * line_cache.reused_lines /
+            (line_cache.reused_lines + line_cache.drawn_lines);
+
+        printf("%-12s %11.1f%% %16.1f %16.1f %16.1f%s\n", scenario_names[scenario], reused,
+            drawn_us, cached_us, drawn_us - cached_us,
+            drawn_checksum == cached_checksum ? "" : " MISMATCH");
+
+        if (drawn_checksum != cached_checksum) {
+            ++num_mismatches;
+        }
+
+        free_line_cache();
+    }
+
+    bench_samples_free(&drawn_samples);
+    bench_samples_free(&cached_samples);
+    free(edited_tiles);
+
+    return num_mismatches == 0 ? 0 : 1;
+}
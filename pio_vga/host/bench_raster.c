@@ -0,0 +1,198 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Time the village scene with and without raster effects and check the effects against drawing
+// each line with its scroll and colour transform applied by hand. The effects used are:
+//  - Lines 0 - 39 scrolled at half speed, as a split screen status area might be
+//  - A darkening gradient over lines 40 - 103 using MAX_RASTER_COLOUR_TRANSFORMS - 1 transforms
+//  - A wave rippling the tilemap and sprites horizontally and the tilemap vertically from line 160
+//
+// Effects for each frame are written into `raster_fx_next` and swapped in with `swap_raster_fx`
+// as `end_of_frame` would.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-s scroll_step] [-k scale]\n"
+        "  -s  Step between scroll offsets in pixels (default 4)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+#define SPLIT_LINES 40
+#define GRADIENT_START 40
+#define GRADIENT_STEP_LINES 8
+#define WAVE_START 160
+#define WAVE_AMPLITUDE 4
+
+// Scroll offsets are kept at least this far from the edges of the map so the waves and the
+// reference drawing never go off the map
+#define SCROLL_MARGIN (WAVE_AMPLITUDE * 2)
+
+static void setup_colour_transforms() {
+    for(int transform = 1;transform < MAX_RASTER_COLOUR_TRANSFORMS; ++transform) {
+        int brightness = RASTER_COLOUR_ONE - (transform * RASTER_COLOUR_ONE) / 10;
+        int scale[3] = {brightness, brightness, brightness};
+        // Tint the darker lines blue
+        int offset[3] = {0, 0, transform / 2};
+
+        set_raster_colour_transform(transform, scale, offset);
+    }
+}
+
+static void write_frame_fx(raster_fx_table_t* table, int frame, int x_scroll) {
+    clear_raster_fx(table);
+
+    for(int line = 0;line < SCREEN_HEIGHT; ++line) {
+        raster_line_fx_t* line_fx = &table->lines[line];
+
+        if (line < SPLIT_LINES) {
+            line_fx->layer_x_scroll[0] = -(x_scroll / 2);
+            line_fx->sprite_x_scroll = -(x_scroll / 2);
+        }
+
+        int gradient_step = (line - GRADIENT_START) / GRADIENT_STEP_LINES;
+        if (line >= GRADIENT_START && gradient_step < MAX_RASTER_COLOUR_TRANSFORMS - 1) {
+            line_fx->colour_transform = gradient_step + 1;
+        }
+
+        if (line >= WAVE_START) {
+            double phase = (line + frame) * 0.3;
+            line_fx->layer_x_scroll[0] = lround(sin(phase) * WAVE_AMPLITUDE);
+            line_fx->layer_y_scroll[0] = lround(cos(phase) * WAVE_AMPLITUDE / 2);
+            line_fx->sprite_x_scroll = line_fx->layer_x_scroll[0];
+        }
+    }
+}
+
+// Draw a line with the effects from `line_fx` applied directly rather than through the table
+static void draw_reference_line(int line_y, const raster_line_fx_t* line_fx, int x_scroll,
+    int y_scroll, uint16_t* line_buffer) {
+
+    tilemap_info_t tilemap = village_tilemap;
+    tilemap.x_scroll = x_scroll + line_fx->layer_x_scroll[0];
+    tilemap.y_scroll = y_scroll + line_fx->layer_y_scroll[0];
+    draw_tilemap_line_memcpy(line_y, tilemap, line_buffer);
+
+    // The current table is empty while the reference is drawn so only the scroll set here applies
+    sprite_scroll_x = x_scroll + line_fx->sprite_x_scroll;
+    draw_sprites_line(line_y, line_buffer);
+    sprite_scroll_x = x_scroll;
+
+    if (line_fx->colour_transform != 0) {
+        const raster_colour_transform_t* transform =
+            &raster_colour_transforms[line_fx->colour_transform];
+
+        for(int x = 0;x < SCREEN_WIDTH; ++x) {
+            int red = line_buffer[x] & 0x1f;
+            int green = (line_buffer[x] >> 5) & 0x1f;
+            int blue = (line_buffer[x] >> 10) & 0x1f;
+
+            line_buffer[x] = transform->red[red] | transform->green[green] |
+                transform->blue[blue];
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    int scroll_step = 4;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:k:")) != -1) {
+        switch (opt) {
+            case 's': scroll_step = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (scroll_step < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    setup_village_scene(0);
+    setup_colour_transforms();
+
+    int max_x_scroll = village_max_x_scroll() - SCROLL_MARGIN;
+    int max_y_scroll = village_max_y_scroll() - SCROLL_MARGIN;
+    size_t max_lines = (size_t)((max_x_scroll - SCROLL_MARGIN) / scroll_step + 1) *
+        ((max_y_scroll - SCROLL_MARGIN) / scroll_step + 1) * SCREEN_HEIGHT;
+
+    bench_samples_t plain_samples;
+    bench_samples_t fx_samples;
+    bench_samples_init(&plain_samples, max_lines);
+    bench_samples_init(&fx_samples, max_lines);
+    if (plain_samples.max_samples == 0 || fx_samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate sample buffer\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    uint16_t __attribute__ ((aligned (4))) reference_buffer[SCREEN_WIDTH];
+    int num_mismatched_lines = 0;
+    int frame = 0;
+
+    for(int y_scroll = SCROLL_MARGIN;y_scroll <= max_y_scroll; y_scroll += scroll_step) {
+        for(int x_scroll = SCROLL_MARGIN;x_scroll <= max_x_scroll; x_scroll += scroll_step) {
+            set_village_scroll(x_scroll, y_scroll);
+
+            // Without effects, both tables are empty at this point
+            for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+                uint64_t start = bench_now_ns();
+                draw_village_line(line_y, line_buffer);
+                uint64_t elapsed = bench_now_ns() - start;
+
+                bench_samples_add(&plain_samples,
+                    elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+            }
+
+            // With effects, swapped in as `end_of_frame` would
+            write_frame_fx(raster_fx_next, frame, x_scroll);
+            swap_raster_fx();
+
+            for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+                uint64_t start = bench_now_ns();
+                draw_village_line(line_y, line_buffer);
+                uint64_t elapsed = bench_now_ns() - start;
+
+                bench_samples_add(&fx_samples,
+                    elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+
+                // Swap the empty table back in to draw the reference line
+                const raster_line_fx_t line_fx = raster_fx->lines[line_y];
+                swap_raster_fx();
+                draw_reference_line(line_y, &line_fx, x_scroll, y_scroll, reference_buffer);
+                swap_raster_fx();
+
+                for(int x = 0;x < SCREEN_WIDTH; ++x) {
+                    if (line_buffer[x] != reference_buffer[x]) {
+                        ++num_mismatched_lines;
+                        break;
+                    }
+                }
+            }
+
+            // Back to no effects for the next frame
+            clear_raster_fx(raster_fx_next);
+            swap_raster_fx();
+            ++frame;
+        }
+    }
+
+    printf("%d frames, timer overhead %lu ns, scale %.2f\n", frame,
+        (unsigned long)timer_overhead, scale);
+    bench_samples_report("no raster effects", &plain_samples, LINE_RENDER_BUDGET_NS, scale);
+    bench_samples_report("raster effects", &fx_samples, LINE_RENDER_BUDGET_NS, scale);
+    printf("%d lines differ from the reference drawing\n", num_mismatched_lines);
+
+    bench_samples_free(&plain_samples);
+    bench_samples_free(&fx_samples);
+
+    return num_mismatched_lines == 0 ? 0 : 1;
+}
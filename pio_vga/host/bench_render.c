@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Render whole frames of the village scene at every scroll offset the demo can reach, timing each
+// scanline individually and reporting the distribution against the two VGA line render budget.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-n extra_sprites] [-s scroll_step] [-p bpp] [-l] [-k scale]\n"
+        "  -n  Extra sprites scattered over the map on top of the demo characters (default 0)\n"
+        "  -s  Step between scroll offsets in pixels, 1 renders every offset (default 1)\n"
+        "  -p  Bits per pixel of the tiles and sprites, 16 (RGB555), 8 or 4 (default 16)\n"
+        "  -l  Expand 4bpp pixel pairs with palette lookups rather than a nibble at a time\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+int main(int argc, char** argv) {
+    int num_extra_sprites = 0;
+    int scroll_step = 1;
+    int bpp = 16;
+    bool palette_pairs = false;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:p:lk:")) != -1) {
+        switch (opt) {
+            case 'n': num_extra_sprites = atoi(optarg); break;
+            case 's': scroll_step = atoi(optarg); break;
+            case 'p': bpp = atoi(optarg); break;
+            case 'l': palette_pairs = true; break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (scroll_step < 1 || num_extra_sprites < 0 || scale <= 0.0 ||
+        (bpp != 16 && bpp != 8 && bpp != 4)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    set_village_pixel_format(bpp == 16 ? kPixelFormatRGB555 :
+        bpp == 8 ? kPixelFormat8bpp : kPixelFormat4bpp, palette_pairs);
+    setup_village_scene(num_extra_sprites);
+
+    size_t num_frames = (size_t)((village_max_x_scroll() / scroll_step) + 1) *
+        ((village_max_y_scroll() / scroll_step) + 1);
+
+    bench_samples_t line_samples;
+    bench_samples_init(&line_samples, num_frames * SCREEN_HEIGHT);
+    if (line_samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate sample buffer\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    uint32_t checksum = BENCH_FNV1A_INIT;
+
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+
+    for(int y_scroll = 0;y_scroll <= village_max_y_scroll(); y_scroll += scroll_step) {
+        for(int x_scroll = 0;x_scroll <= village_max_x_scroll(); x_scroll += scroll_step) {
+            set_village_scroll(x_scroll, y_scroll);
+
+            for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+                uint64_t start = bench_now_ns();
+                draw_village_line(line_y, line_buffer);
+                uint64_t elapsed = bench_now_ns() - start;
+
+                elapsed = elapsed > timer_overhead ? elapsed - timer_overhead : 0;
+                bench_samples_add(&line_samples, elapsed);
+                checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+            }
+        }
+    }
+
+    int num_sprites = 0;
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        num_sprites += screen_sprites[i].enabled;
+    }
+
+    printf("%zu frames, %d sprites, timer overhead %lu ns, scale %.2f\n", num_frames,
+        num_sprites, (unsigned long)timer_overhead, scale);
+    printf("%dbpp tiles and sprites, %d bytes of asset data\n", bpp, village_asset_bytes());
+    bench_samples_report("line render", &line_samples, LINE_RENDER_BUDGET_NS, scale);
+    printf("output checksum %08x\n", checksum);
+
+    bench_samples_free(&line_samples);
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Compare drawing the village scene into RGB555 line buffers with drawing it into RGB332 line
+// buffers for `line_out_rgb332`, following the demo's bouncing scroll. Variants are:
+//  - RGB555 lines from the 8bpp data, as the demo draws them
+//  - RGB332 lines from the 8bpp data, expanded through the palettes' RGB332 lookups
+//  - RGB332 lines from the RGB332 data, tile rows and sprite spans copied straight in
+//  - RGB332 lines from the RGB555 data, converted a pixel at a time
+//
+// Every variant's output is checksummed as RGB332 (RGB555 lines converted with
+// `rgb555_to_rgb332`) so all of them must give the same checksum. Along with the time per line
+// the bytes of each line buffer and sent by the line DMA per frame (every line is output twice)
+// are reported.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-f frames] [-n extra_sprites] [-k scale]\n"
+        "  -f  Number of frames per variant (default 300)\n"
+        "  -n  Extra characters added to the scene (default 0)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+typedef struct {
+    const char* name;
+    pixel_format_t format;
+    bool rgb332_lines;
+} variant_t;
+
+static const variant_t variants[] = {
+    {"RGB555 lines, 8bpp data", kPixelFormat8bpp, false},
+    {"RGB332 lines, 8bpp data", kPixelFormat8bpp, true},
+    {"RGB332 lines, RGB332 data", kPixelFormatRGB332, true},
+    {"RGB332 lines, RGB555 data", kPixelFormatRGB555, true}
+};
+
+#define NUM_VARIANTS (sizeof(variants) / sizeof(variants[0]))
+#define LINE_OUTPUT_REPEAT 2
+
+// Draw `num_frames` frames of a variant adding line times to `samples`, returns a checksum of the
+// output as RGB332
+static uint32_t run_variant(const variant_t* variant, int num_frames, int num_extra_sprites,
+    uint64_t timer_overhead, bench_samples_t* samples) {
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    uint8_t __attribute__ ((aligned (4))) rgb332_line_buffer[SCREEN_WIDTH];
+    int x_scroll = 0;
+    int y_scroll = 0;
+    bool x_inc = true;
+    bool y_inc = true;
+
+    set_village_pixel_format(variant->format, false);
+    setup_village_scene(num_extra_sprites);
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        set_village_scroll(x_scroll, y_scroll);
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            uint64_t start = bench_now_ns();
+
+            if (variant->rgb332_lines) {
+                draw_village_line_rgb332(line_y, rgb332_line_buffer);
+            } else {
+                draw_village_line(line_y, line_buffer);
+            }
+
+            uint64_t elapsed = bench_now_ns() - start;
+            bench_samples_add(samples, elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+
+            if (!variant->rgb332_lines) {
+                for(int x = 0;x < SCREEN_WIDTH; ++x) {
+                    rgb332_line_buffer[x] = rgb555_to_rgb332(line_buffer[x]);
+                }
+            }
+
+            checksum = bench_fnv1a(checksum, rgb332_line_buffer, sizeof(rgb332_line_buffer));
+        }
+
+        if (y_scroll == village_max_y_scroll()) {
+            y_inc = false;
+        } else if (y_scroll == 0) {
+            y_inc = true;
+        }
+
+        if (x_scroll == village_max_x_scroll()) {
+            x_inc = false;
+        } else if (x_scroll == 0) {
+            x_inc = true;
+        }
+
+        y_scroll += y_inc ? 1 : -1;
+        x_scroll += x_inc ? 1 : -1;
+    }
+
+    return checksum;
+}
+
+int main(int argc, char** argv) {
+    int num_frames = 300;
+    int num_extra_sprites = 0;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:n:k:")) != -1) {
+        switch (opt) {
+            case 'f': num_frames = atoi(optarg); break;
+            case 'n': num_extra_sprites = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_frames < 1 || num_extra_sprites < 0 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    bench_samples_t samples;
+    bench_samples_init(&samples, (size_t)num_frames * SCREEN_HEIGHT);
+    if (samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate sample buffer\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    printf("%d frames per variant, %d extra sprites, timer overhead %lu ns, scale %.2f\n",
+        num_frames, num_extra_sprites, (unsigned long)timer_overhead, scale);
+
+    uint32_t checksums[NUM_VARIANTS];
+    bool matched = true;
+
+    for(size_t i = 0;i < NUM_VARIANTS; ++i) {
+        int pixel_bytes = variants[i].rgb332_lines ? 1 : 2;
+
+        samples.num_samples = 0;
+        checksums[i] = run_variant(&variants[i], num_frames, num_extra_sprites, timer_overhead,
+            &samples);
+        bench_samples_report(variants[i].name, &samples, LINE_RENDER_BUDGET_NS, scale);
+        printf("  line buffer %d bytes, line DMA %d KB per frame, data %d bytes, "
+            "checksum %08x\n", SCREEN_WIDTH * pixel_bytes,
+            SCREEN_WIDTH * pixel_bytes * SCREEN_HEIGHT * LINE_OUTPUT_REPEAT / 1024,
+            village_asset_bytes(), checksums[i]);
+
+        matched = matched && (checksums[i] == checksums[0]);
+    }
+
+    printf("RGB332 output %s the RGB555 output converted to RGB332\n",
+        matched ? "matches" : "DOESN'T MATCH");
+
+    bench_samples_free(&samples);
+
+    return matched ? 0 : 1;
+}
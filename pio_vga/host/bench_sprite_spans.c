@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Compare drawing sprites pixel by pixel (checking each against `transparent_colour`) with drawing
+// them from their precomputed opaque spans. A row of MAX_SPRITES_PER_LINE sprites is placed across
+// the top of the screen (some partially off either edge) and every line of it drawn using every
+// sprite image. The cost per sprite line gives how many sprites fit in a line's render budget.
+// With `-f` every sprite is drawn flipped horizontally and vertically.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-r repeats] [-k scale] [-f]\n"
+        "  -r  Number of times to draw every sprite image (default 200)\n"
+        "  -f  Flip every sprite horizontally and vertically\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+// Draw every line of the sprite row for every sprite image, recording the time taken for each
+// line. Returns a checksum of the output.
+static uint32_t draw_sprite_rows(int repeats, bench_samples_t* samples, uint64_t timer_overhead) {
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+
+    for(int repeat = 0;repeat < repeats; ++repeat) {
+        for(int image = 0;image < village_num_sprite_images(); ++image) {
+            for(int i = 0;i < MAX_SPRITES_PER_LINE; ++i) {
+                screen_sprites[i].data_ptr =
+                    village_sprite_ptr((image + i) % village_num_sprite_images());
+            }
+
+            for(int line_y = 0;line_y < village_sprite_height(); ++line_y) {
+                memset(line_buffer, 0, sizeof(line_buffer));
+
+                uint64_t start = bench_now_ns();
+                draw_sprites_line(line_y, line_buffer);
+                uint64_t elapsed = bench_now_ns() - start;
+
+                bench_samples_add(samples, elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+                checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+            }
+        }
+    }
+
+    return checksum;
+}
+
+static void report_sprites_per_line(const char* name, bench_samples_t* samples, double scale) {
+    // Samples are sorted by `bench_samples_report`
+    double median_ns = samples->samples[samples->num_samples / 2] * scale;
+    double per_sprite_ns = median_ns / MAX_SPRITES_PER_LINE;
+
+    printf("  %s: %.1f ns per sprite line, %.0f sprites fit in the line budget\n", name,
+        per_sprite_ns, LINE_RENDER_BUDGET_NS / per_sprite_ns);
+}
+
+int main(int argc, char** argv) {
+    int repeats = 200;
+    double scale = 1.0;
+    bool flip = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "r:k:f")) != -1) {
+        switch (opt) {
+            case 'r': repeats = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            case 'f': flip = true; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (repeats < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    setup_village_scene(0);
+    set_village_scroll(0, 0);
+
+    // A row of sprites across the top of the screen. Spread a little wider than the screen so the
+    // first and last are clipped.
+    init_sprites();
+    int spacing = (SCREEN_WIDTH + SPRITE_WIDTH) / MAX_SPRITES_PER_LINE;
+    for(int i = 0;i < MAX_SPRITES_PER_LINE; ++i) {
+        screen_sprites[i].x = i * spacing - SPRITE_WIDTH / 2;
+        screen_sprites[i].y = 0;
+        screen_sprites[i].height = village_sprite_height();
+        screen_sprites[i].data_ptr = village_sprite_ptr(0);
+        screen_sprites[i].flip_x = flip;
+        screen_sprites[i].flip_y = flip;
+        screen_sprites[i].enabled = true;
+    }
+    build_sprite_line_index();
+
+    size_t num_samples = (size_t)repeats * village_num_sprite_images() * village_sprite_height();
+    bench_samples_t pixel_samples, span_samples;
+    bench_samples_init(&pixel_samples, num_samples);
+    bench_samples_init(&span_samples, num_samples);
+    if (pixel_samples.max_samples == 0 || span_samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate sample buffers\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+
+    free_sprite_spans();
+    uint32_t pixel_checksum = draw_sprite_rows(repeats, &pixel_samples, timer_overhead);
+
+    if (!build_village_sprite_spans()) {
+        fprintf(stderr, "Could not build sprite spans\n");
+        return 1;
+    }
+    uint32_t span_checksum = draw_sprite_rows(repeats, &span_samples, timer_overhead);
+
+    printf("%d %ssprites per line, %d rows of spans, %d spans, timer overhead %lu ns, "
+        "scale %.2f\n", MAX_SPRITES_PER_LINE, flip ? "flipped " : "", sprite_spans.num_rows,
+        sprite_spans.row_spans[sprite_spans.num_rows], (unsigned long)timer_overhead, scale);
+    bench_samples_report("per pixel sprites line", &pixel_samples, LINE_RENDER_BUDGET_NS, scale);
+    bench_samples_report("span sprites line", &span_samples, LINE_RENDER_BUDGET_NS, scale);
+    printf("median:\n");
+    report_sprites_per_line("per pixel", &pixel_samples, scale);
+    report_sprites_per_line("spans", &span_samples, scale);
+    printf("output checksums: per pixel %08x, spans %08x\n", pixel_checksum, span_checksum);
+
+    bench_samples_free(&pixel_samples);
+    bench_samples_free(&span_samples);
+
+    return pixel_checksum == span_checksum ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Compare determining the sprites on each scanline by scanning all of `screen_sprites` against
+// the per scanline index built once per frame. The sprite table size is fixed at compile time by
+// NUM_SPRITES, the Makefile builds this benchmark for several table sizes.
+//
+// With enough sprites some lines have more than MAX_SPRITES_PER_LINE on them, the sprite lines the
+// index leaves out each frame are reported. `-r` rotates which are left out (flicker
+// multiplexing), in which case the scan, which always drops the same ones, isn't compared. Finally
+// the scene is held still for MULTIPLEX_FRAMES frames counting the sprite lines never drawn in any
+// of them, every one left out with kSpriteOverflowDropLast but none should be with rotation.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-n sprites] [-s scroll_step] [-k scale] [-r]\n"
+        "  -n  Number of enabled sprites, at most %d (default %d)\n"
+        "  -r  Rotate which sprites are dropped from full lines each frame\n"
+        "  -s  Step between scroll offsets in pixels (default 8)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog, NUM_SPRITES, NUM_SPRITES);
+}
+
+#define MULTIPLEX_FRAMES 60
+
+static uint8_t sprite_line_drawn[NUM_SPRITES][SCREEN_HEIGHT];
+
+// Build the index MULTIPLEX_FRAMES times without moving anything, returning the number of sprite
+// lines on screen that were never in it
+static int count_never_drawn_sprite_lines() {
+    memset(sprite_line_drawn, 0, sizeof(sprite_line_drawn));
+
+    for(int frame = 0;frame < MULTIPLEX_FRAMES; ++frame) {
+        build_sprite_line_index();
+
+        for(int line = 0;line < SCREEN_HEIGHT; ++line) {
+            for(int i = 0;i < sprite_line_count[line]; ++i) {
+                sprite_line_drawn[sprite_line_index[line][i]][line] = 1;
+            }
+        }
+    }
+
+    int num_never_drawn = 0;
+    for(int sprite = 0;sprite < NUM_SPRITES; ++sprite) {
+        if (!screen_sprites[sprite].enabled) {
+            continue;
+        }
+
+        int first_line = screen_sprites[sprite].y - sprite_scroll_y;
+        for(int line = 0;line < screen_sprites[sprite].height; ++line) {
+            int screen_line = first_line + line;
+
+            if (screen_line >= 0 && screen_line < SCREEN_HEIGHT &&
+                !sprite_line_drawn[sprite][screen_line]) {
+                ++num_never_drawn;
+            }
+        }
+    }
+
+    return num_never_drawn;
+}
+
+int main(int argc, char** argv) {
+    int num_sprites = NUM_SPRITES;
+    int scroll_step = 8;
+    double scale = 1.0;
+    bool rotate = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:k:r")) != -1) {
+        switch (opt) {
+            case 'n': num_sprites = atoi(optarg); break;
+            case 's': scroll_step = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            case 'r': rotate = true; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (scroll_step < 1 || num_sprites < 0 || num_sprites > NUM_SPRITES || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Fill the sprite table then disable sprites beyond the requested number
+    setup_village_scene(NUM_SPRITES);
+    for(int i = num_sprites;i < NUM_SPRITES; ++i) {
+        screen_sprites[i].enabled = false;
+    }
+
+    sprite_overflow_policy = rotate ? kSpriteOverflowRotate : kSpriteOverflowDropLast;
+
+    size_t num_frames = (size_t)((village_max_x_scroll() / scroll_step) + 1) *
+        ((village_max_y_scroll() / scroll_step) + 1);
+
+    bench_samples_t scan_samples, index_samples, build_samples;
+    bench_samples_init(&scan_samples, num_frames * SCREEN_HEIGHT);
+    bench_samples_init(&index_samples, num_frames * SCREEN_HEIGHT);
+    bench_samples_init(&build_samples, num_frames);
+    if (scan_samples.max_samples == 0 || index_samples.max_samples == 0 ||
+        build_samples.max_samples == 0) {
+        fprintf(stderr, "Could not allocate sample buffers\n");
+        return 1;
+    }
+
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    size_t num_mismatched_lines = 0;
+    uint64_t total_dropped_sprite_lines = 0;
+    uint32_t max_dropped_sprite_lines = 0;
+    uint64_t total_overflow_lines = 0;
+
+    uint16_t __attribute__ ((aligned (4))) tilemap_line_buffer[SCREEN_WIDTH];
+    uint16_t __attribute__ ((aligned (4))) scan_line_buffer[SCREEN_WIDTH];
+    uint16_t __attribute__ ((aligned (4))) index_line_buffer[SCREEN_WIDTH];
+
+    for(int y_scroll = 0;y_scroll <= village_max_y_scroll(); y_scroll += scroll_step) {
+        for(int x_scroll = 0;x_scroll <= village_max_x_scroll(); x_scroll += scroll_step) {
+            uint64_t start = bench_now_ns();
+            set_village_scroll(x_scroll, y_scroll);
+            uint64_t elapsed = bench_now_ns() - start;
+            bench_samples_add(&build_samples,
+                elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+
+            total_dropped_sprite_lines += sprite_overflow_stats.dropped_sprite_lines;
+            total_overflow_lines += sprite_overflow_stats.overflow_lines;
+            if (sprite_overflow_stats.dropped_sprite_lines > max_dropped_sprite_lines) {
+                max_dropped_sprite_lines = sprite_overflow_stats.dropped_sprite_lines;
+            }
+
+            for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+                // Tilemap drawing isn't timed, only sprite drawing
+                draw_tilemap_line(line_y, village_tilemap, tilemap_line_buffer);
+                memcpy(scan_line_buffer, tilemap_line_buffer, sizeof(tilemap_line_buffer));
+                memcpy(index_line_buffer, tilemap_line_buffer, sizeof(tilemap_line_buffer));
+
+                start = bench_now_ns();
+                draw_sprites_line_unindexed(line_y, scan_line_buffer);
+                elapsed = bench_now_ns() - start;
+                bench_samples_add(&scan_samples,
+                    elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+
+                start = bench_now_ns();
+                draw_sprites_line(line_y, index_line_buffer);
+                elapsed = bench_now_ns() - start;
+                bench_samples_add(&index_samples,
+                    elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+
+                if (!rotate &&
+                    memcmp(scan_line_buffer, index_line_buffer, sizeof(scan_line_buffer)) != 0) {
+                    ++num_mismatched_lines;
+                }
+            }
+        }
+    }
+
+    printf("%zu frames, %d of %d sprites enabled, timer overhead %lu ns, scale %.2f\n", num_frames,
+        num_sprites, NUM_SPRITES, (unsigned long)timer_overhead, scale);
+    bench_samples_report("scan sprites line", &scan_samples, LINE_RENDER_BUDGET_NS, scale);
+    bench_samples_report("indexed sprites line", &index_samples, LINE_RENDER_BUDGET_NS, scale);
+    bench_samples_report("index build per frame", &build_samples, VBLANK_TIME_NS, scale);
+    printf("sprite lines dropped per frame: mean %.1f, max %u, over %.1f lines\n",
+        (double)total_dropped_sprite_lines / num_frames, max_dropped_sprite_lines,
+        (double)total_overflow_lines / num_frames);
+
+    if (rotate) {
+        printf("dropped sprites rotated, not compared against the scan\n");
+    } else {
+        printf("lines differing between scan and index: %zu\n", num_mismatched_lines);
+    }
+
+    set_village_scroll(0, 0);
+    printf("sprite lines on screen never drawn in %d frames without scrolling: %d\n",
+        MULTIPLEX_FRAMES, count_never_drawn_sprite_lines());
+
+    bench_samples_free(&scan_samples);
+    bench_samples_free(&index_samples);
+    bench_samples_free(&build_samples);
+
+    return num_mismatched_lines == 0 ? 0 : 1;
+}
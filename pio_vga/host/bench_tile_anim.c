@@ -0,0 +1,295 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+#include "pio_vga_tile_anim.h"
+
+// Measure animated tiles (see `pio_vga_tile_anim.h`) on the village tilemap in RGB555 and 8bpp:
+//  - `draw_tilemap_line` at every X scroll and a range of Y scrolls with no tile indirection table,
+//    with a table mapping every tile to itself and with the flowers animated as in
+//    `pio_vga_fifth.c`, each line drawn through all three in turn. The per tile drawing loops are
+//    the same in every case, a table only adds looking up the line's tiles before them, so the
+//    difference between the first two is that lookup. Both must give identical output.
+//  - The village scene drawn through the line cache for a number of frames at a fixed scroll with
+//    the animations updated every frame, as `end_of_frame` does. Each frame must match the map
+//    with the animated tiles rewritten in place, drawn without a table or line cache. Reports the
+//    time taken by each update, the table writes and the lines the line cache redrew.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-s scroll_step] [-f frames] [-k scale]\n"
+        "  -s  Step between Y scroll offsets in pixels, every X offset is drawn (default 8)\n"
+        "  -f  Number of animated frames to check (default 600)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+// Flower tiles swapping colour, as in `pio_vga_fifth.c`. The tileset has no frames drawn for
+// animation so the flowers cycle through the flower tiles that are there.
+static const uint16_t small_flower_frames[] = {15, 31};
+static const uint16_t small_flower_alt_frames[] = {31, 15};
+static const uint16_t flower_frames[] = {20, 21};
+static const uint16_t flower_alt_frames[] = {21, 20};
+
+static int scroll_step;
+static uint64_t timer_overhead;
+
+static void add_flower_anims(tile_anims_t* anims) {
+    tile_anims_add(anims, 15, small_flower_frames, 2, 20);
+    tile_anims_add(anims, 31, small_flower_alt_frames, 2, 20);
+    tile_anims_add(anims, 20, flower_frames, 2, 32);
+    tile_anims_add(anims, 21, flower_alt_frames, 2, 32);
+}
+
+// Number of tile numbers used by the village tilemap
+static int village_map_tiles() {
+    int num_tiles = 0;
+
+    for(int i = 0;i < village_tilemap.width * village_tilemap.height; ++i) {
+        if (village_tilemap.tiles[i] >= num_tiles) {
+            num_tiles = village_tilemap.tiles[i] + 1;
+        }
+    }
+
+    return num_tiles;
+}
+
+// Tile indirection tables `draw_tilemap_line` is timed with
+enum { kNoTable, kIdentityTable, kAnimatedTable, kNumTables };
+static const char* table_names[kNumTables] = {"no table", "identity table", "flowers animated"};
+
+// Draw every line of the village tilemap at every X scroll and every `scroll_step` Y scroll
+// through each of `tile_remaps`, adding line times to `samples` and checksums of the output to
+// `checksums`. Each line is drawn through every table in turn so they're timed under the same
+// conditions.
+static void run_tilemap(const uint16_t* const* tile_remaps, bench_samples_t* samples,
+    uint32_t* checksums) {
+
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    tilemap_info_t tilemap = village_tilemap;
+
+    for(int table = 0;table < kNumTables; ++table) {
+        checksums[table] = BENCH_FNV1A_INIT;
+    }
+
+    for(int y_scroll = 0;y_scroll <= village_max_y_scroll(); y_scroll += scroll_step) {
+        for(int x_scroll = 0;x_scroll <= village_max_x_scroll(); ++x_scroll) {
+            tilemap.x_scroll = x_scroll;
+            tilemap.y_scroll = y_scroll;
+
+            for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+                for(int table = 0;table < kNumTables; ++table) {
+                    tilemap.tile_remap = tile_remaps[table];
+
+                    uint64_t start = bench_now_ns();
+                    draw_tilemap_line(line_y, tilemap, line_buffer);
+                    uint64_t elapsed = bench_now_ns() - start;
+
+                    elapsed = elapsed > timer_overhead ? elapsed - timer_overhead : 0;
+                    bench_samples_add(&samples[table], elapsed);
+                    checksums[table] =
+                        bench_fnv1a(checksums[table], line_buffer, sizeof(line_buffer));
+                }
+            }
+        }
+    }
+}
+
+// Draw a frame of the village scene through the line cache, returning a checksum of the output
+static uint32_t draw_cached_frame() {
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+
+    update_line_cache();
+
+    for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+        if (!get_cached_line(line_y, line_buffer)) {
+            draw_village_line(line_y, line_buffer);
+            store_cached_line(line_y, line_buffer);
+        }
+
+        checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+    }
+
+    return checksum;
+}
+
+// Draw a frame of the village scene with the tiles of the layer's tilemap rewritten to the tiles
+// `anims` shows, without the table or line cache, returning a checksum of the output
+static uint32_t draw_rewritten_frame(const tile_anims_t* anims, uint16_t* rewritten) {
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    tilemap_info_t saved = tilemap_layers[0].tilemap;
+
+    for(int i = 0;i < village_tilemap.width * village_tilemap.height; ++i) {
+        rewritten[i] = anims->remap[village_tilemap.tiles[i]];
+    }
+
+    tilemap_layers[0].tilemap.tiles = rewritten;
+    tilemap_layers[0].tilemap.tile_remap = NULL;
+
+    for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+        draw_village_line(line_y, line_buffer);
+        checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+    }
+
+    tilemap_layers[0].tilemap = saved;
+
+    return checksum;
+}
+
+// Run `num_frames` animated frames through the line cache checking each against the rewritten map.
+// Returns the number of frames that didn't match.
+static int check_animation(int num_frames, double scale) {
+    tile_anims_t anims;
+    bench_samples_t samples;
+    uint16_t* rewritten = malloc(village_tilemap.width * village_tilemap.height * sizeof(uint16_t));
+
+    bench_samples_init(&samples, num_frames);
+    if (!rewritten || samples.max_samples == 0 || !build_line_cache() ||
+        !tile_anims_init(&anims, 0, village_map_tiles())) {
+
+        fprintf(stderr, "Could not allocate the animation check\n");
+        exit(1);
+    }
+
+    add_flower_anims(&anims);
+
+    // Part way into the map, so the line cache has to find the rows on screen
+    set_village_scroll(village_max_x_scroll() / 3, village_max_y_scroll() / 2);
+
+    int num_animated_rows = 0;
+    for(int row = 0;row < anims.num_rows; ++row) {
+        num_animated_rows += anims.animated_rows[row];
+    }
+
+    int num_mismatched = 0;
+    line_cache.drawn_lines = 0;
+    line_cache.reused_lines = 0;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        uint32_t checksum = draw_cached_frame();
+
+        if (checksum != draw_rewritten_frame(&anims, rewritten)) {
+            ++num_mismatched;
+        }
+
+        uint64_t start = bench_now_ns();
+        tile_anims_update(&anims);
+        uint64_t elapsed = bench_now_ns() - start;
+        bench_samples_add(&samples, elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+    }
+
+    char name[128];
+    snprintf(name, sizeof(name), "update, %d animations over %d of %d tilemap rows",
+        anims.num_anims, num_animated_rows, anims.num_rows);
+    bench_samples_report(name, &samples, VBLANK_TIME_NS, scale);
+    printf("  %d frames, %u table writes, %.1f lines redrawn per frame, %d frames mismatched\n",
+        num_frames, anims.frame_changes, (double)line_cache.drawn_lines / num_frames,
+        num_mismatched);
+
+    tile_anims_free(&anims);
+    free_line_cache();
+    bench_samples_free(&samples);
+    free(rewritten);
+
+    return num_mismatched;
+}
+
+int main(int argc, char** argv) {
+    int num_frames = 600;
+    double scale = 1.0;
+    scroll_step = 8;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:f:k:")) != -1) {
+        switch (opt) {
+            case 's': scroll_step = atoi(optarg); break;
+            case 'f': num_frames = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (scroll_step < 1 || num_frames < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    size_t max_lines = (size_t)(village_max_x_scroll() + 1) *
+        ((village_max_y_scroll() / scroll_step) + 1) * SCREEN_HEIGHT;
+
+    bench_samples_t samples[kNumTables];
+    for(int table = 0;table < kNumTables; ++table) {
+        bench_samples_init(&samples[table], max_lines);
+        if (samples[table].max_samples == 0) {
+            fprintf(stderr, "Could not allocate sample buffer\n");
+            return 1;
+        }
+    }
+
+    timer_overhead = bench_timer_overhead_ns();
+    printf("timer overhead %lu ns, scale %.2f\n", (unsigned long)timer_overhead, scale);
+
+    const pixel_format_t formats[] = {kPixelFormatRGB555, kPixelFormat8bpp};
+    const char* format_names[] = {"RGB555", "8bpp"};
+    int num_mismatches = 0;
+
+    for(int format = 0;format < 2; ++format) {
+        set_village_pixel_format(formats[format], false);
+        setup_village_scene(0);
+
+        // The animated table is set up last so it's left as the layer's table, unused here
+        tile_anims_t identity;
+        tile_anims_t animated;
+        if (!tile_anims_init(&identity, 0, village_map_tiles()) ||
+            !tile_anims_init(&animated, 0, village_map_tiles())) {
+            fprintf(stderr, "Could not allocate tile indirection table\n");
+            return 1;
+        }
+
+        add_flower_anims(&animated);
+        tile_anims_update(&animated);
+
+        const uint16_t* tile_remaps[kNumTables] = {NULL, identity.remap, animated.remap};
+        uint32_t checksums[kNumTables];
+
+        for(int table = 0;table < kNumTables; ++table) {
+            samples[table].num_samples = 0;
+        }
+
+        run_tilemap(tile_remaps, samples, checksums);
+        printf("\n");
+
+        for(int table = 0;table < kNumTables; ++table) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s, %s", format_names[format], table_names[table]);
+            bench_samples_report(name, &samples[table], LINE_RENDER_BUDGET_NS, scale);
+        }
+
+        printf("output checksums: no table %08x, identity table %08x%s\n", checksums[kNoTable],
+            checksums[kIdentityTable],
+            checksums[kNoTable] == checksums[kIdentityTable] ? "" : " MISMATCH");
+
+        if (checksums[kNoTable] != checksums[kIdentityTable]) {
+            ++num_mismatches;
+        }
+
+        tile_anims_free(&animated);
+        tile_anims_free(&identity);
+        num_mismatches += check_animation(num_frames, scale);
+    }
+
+    for(int table = 0;table < kNumTables; ++table) {
+        bench_samples_free(&samples[table]);
+    }
+
+    if (num_mismatches) {
+        printf("%d runs or frames didn't match\n", num_mismatches);
+        return 1;
+    }
+
+    return 0;
+}
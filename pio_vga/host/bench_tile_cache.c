@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Measure the tile row caches used when the tileset is left in flash. The village scene is drawn
+// following the demo's diagonal bouncing scroll, with one cache per render core (line `n` drawn
+// through cache `n % cores`), at a range of cache sizes. Each size is run with the rows of every
+// line prefetched just before it's drawn, as the demo does while a core is idle, and without so
+// rows are only fetched on demand.
+//
+// A desktop CPU has no flash to stall on so nothing is timed. What matters is how many tile rows
+// are read from the tileset while a line is being drawn, on the Pico each of those may be an XIP
+// miss on the line's critical path. Output must match drawing without caches. RGB555 lines at odd
+// X scroll positions are drawn from the shifted tileset, which is in SRAM, so only even lines use
+// the caches there.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-p bpp] [-c cores] [-f frames]\n"
+        "  -p  Bits per pixel of the tiles and sprites, 16 (RGB555), 8 or 4 (default 8)\n"
+        "  -c  Number of render cores, each with its own cache (default 2)\n"
+        "  -f  Number of frames to draw (default 600)\n",
+        prog);
+}
+
+static const int cache_sizes[] = {16, 32, 64, 128, 256};
+#define NUM_CACHE_SIZES (sizeof(cache_sizes) / sizeof(cache_sizes[0]))
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t prefetch_fills;
+} cache_totals_t;
+
+// Draw `num_frames` frames scrolling as `end_of_frame` in `pio_vga_fifth.c` does, returning a
+// checksum of the output. With `prefetch` set every line is prefetched before it's drawn.
+static uint32_t run_frames(int num_frames, bool prefetch) {
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    int x_scroll = 0;
+    int y_scroll = 0;
+    bool x_inc = true;
+    bool y_inc = true;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        set_village_scroll(x_scroll, y_scroll);
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            if (prefetch) {
+                prefetch_tilemap_layers_line(line_y);
+            }
+
+            draw_village_line(line_y, line_buffer);
+            checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+        }
+
+        if (y_scroll == village_max_y_scroll()) {
+            y_inc = false;
+        } else if (y_scroll == 0) {
+            y_inc = true;
+        }
+
+        if (x_scroll == village_max_x_scroll()) {
+            x_inc = false;
+        } else if (x_scroll == 0) {
+            x_inc = true;
+        }
+
+        y_scroll += y_inc ? 1 : -1;
+        x_scroll += x_inc ? 1 : -1;
+    }
+
+    return checksum;
+}
+
+static cache_totals_t get_cache_totals() {
+    cache_totals_t totals = {0};
+
+    for(int i = 0;i < village_tilemap.num_row_caches; ++i) {
+        totals.hits += village_tilemap.row_caches[i].hits;
+        totals.misses += village_tilemap.row_caches[i].misses;
+        totals.prefetch_fills += village_tilemap.row_caches[i].prefetch_fills;
+    }
+
+    return totals;
+}
+
+int main(int argc, char** argv) {
+    int bpp = 8;
+    int num_cores = 2;
+    int num_frames = 600;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "p:c:f:")) != -1) {
+        switch (opt) {
+            case 'p': bpp = atoi(optarg); break;
+            case 'c': num_cores = atoi(optarg); break;
+            case 'f': num_frames = atoi(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if ((bpp != 16 && bpp != 8 && bpp != 4) || num_cores < 1 || num_frames < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    set_village_pixel_format(bpp == 16 ? kPixelFormatRGB555 :
+        bpp == 8 ? kPixelFormat8bpp : kPixelFormat4bpp, false);
+    setup_village_scene(0);
+
+    uint32_t reference_checksum = run_frames(num_frames, false);
+    int num_lines = num_frames * SCREEN_HEIGHT;
+
+    printf("%dbpp tileset, %d cores, %d frames\n", bpp, num_cores, num_frames);
+    printf("%d bytes of tile and sprite data left in flash rather than copied to SRAM at boot\n",
+        village_asset_bytes());
+    printf("%8s %10s %10s %8s %16s %16s\n", "entries", "SRAM bytes", "prefetch", "hit rate",
+        "misses per line", "fills per line");
+
+    int num_mismatches = 0;
+
+    for(int size = 0;size < NUM_CACHE_SIZES; ++size) {
+        for(int prefetch = 0;prefetch < 2; ++prefetch) {
+            if (!build_village_tile_row_caches(num_cores, cache_sizes[size])) {
+                fprintf(stderr, "Could not allocate tile row caches\n");
+                return 1;
+            }
+
+            uint32_t checksum = run_frames(num_frames, prefetch);
+            cache_totals_t totals = get_cache_totals();
+            int cache_bytes = num_cores * cache_sizes[size] *
+                (village_tilemap.row_caches[0].row_bytes + sizeof(uint32_t));
+
+            printf("%8d %10d %10s %7.2f%% %16.2f %16.2f%s\n", cache_sizes[size], cache_bytes,
+                prefetch ? "idle" : "none",
+                100.0 * totals.hits / (totals.hits + totals.misses),
+                (double)totals.misses / num_lines, (double)totals.prefetch_fills / num_lines,
+                checksum == reference_checksum ? "" : " MISMATCH");
+
+            if (checksum != reference_checksum) {
+                ++num_mismatches;
+            }
+
+            free_village_tile_row_caches();
+        }
+    }
+
+    return num_mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Measure the compressed tilesets (see the Compressed Tilesets section of `pio_vga_render.c`) in
+// RGB555 (`village_tileset_lz.h`) and 8bpp (`village_tileset_8bpp_lz.h`):
+//  - The compression ratio, counting the offset of every tile, with every tile checked to decode
+//    exactly to the uncompressed tileset
+//  - The time to decode a tile, against copying an uncompressed one
+//  - The village scene drawn following the demo's diagonal bouncing scroll through tile decode
+//    caches of a range of sizes, one per render core. Each size is run with every line prefetched
+//    just before it's drawn, as the demo does while a core is idle, and without. Misses are tiles
+//    decoded while a line is drawn, each one stalling the line. With prefetching the most tiles
+//    decoded by a single prefetch shows how much must fit into a core's idle time, separately for
+//    each core's first line of a frame (whose tiles weren't decoded ahead) and the rest.
+//
+// While the caches are built the scene has no uncompressed or shifted tileset (RGB555 lines at
+// odd X scroll positions are shifted as they're copied from the decoded tiles), so the ratio is
+// the whole saving. Output must match drawing from the uncompressed tileset.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-c cores] [-f frames] [-k scale]\n"
+        "  -c  Number of render cores, each with its own cache (default 2)\n"
+        "  -f  Number of frames to draw (default 600)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+static const int cache_sizes[] = {16, 32, 64, 128};
+#define NUM_CACHE_SIZES (sizeof(cache_sizes) / sizeof(cache_sizes[0]))
+
+// Times each tile is decoded when timing
+#define DECODE_REPEATS 200
+
+typedef struct {
+    uint32_t misses;
+    uint32_t stalled_lines;
+    uint32_t prefetch_decodes;
+    // Most tiles decoded by one prefetch for a core's first line of the frame, which has nothing
+    // decoded ahead of it, and for any other line
+    uint32_t max_first_prefetch_decodes;
+    uint32_t max_prefetch_decodes;
+} decode_totals_t;
+
+static uint32_t total_misses() {
+    uint32_t misses = 0;
+
+    for(int i = 0;i < village_tilemap.num_decode_caches; ++i) {
+        misses += village_tilemap.decode_caches[i].misses;
+    }
+
+    return misses;
+}
+
+static uint32_t total_prefetch_decodes() {
+    uint32_t decodes = 0;
+
+    for(int i = 0;i < village_tilemap.num_decode_caches; ++i) {
+        decodes += village_tilemap.decode_caches[i].prefetch_decodes;
+    }
+
+    return decodes;
+}
+
+// Draw `num_frames` frames scrolling as `end_of_frame` in `pio_vga_fifth.c` does, returning a
+// checksum of the output. With `prefetch` set every line is prefetched before it's drawn. Decode
+// cache counts are added to `totals` when there are caches.
+static uint32_t run_frames(int num_frames, bool prefetch, decode_totals_t* totals) {
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    bool caches = village_tilemap.decode_caches != NULL;
+    int x_scroll = 0;
+    int y_scroll = 0;
+    bool x_inc = true;
+    bool y_inc = true;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        set_village_scroll(x_scroll, y_scroll);
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            if (prefetch) {
+                uint32_t decodes = caches ? total_prefetch_decodes() : 0;
+                prefetch_tilemap_layers_line(line_y);
+                decodes = caches ? total_prefetch_decodes() - decodes : 0;
+
+                uint32_t* max_decodes = line_y < village_tilemap.num_decode_caches ?
+                    &totals->max_first_prefetch_decodes : &totals->max_prefetch_decodes;
+                if (decodes > *max_decodes) {
+                    *max_decodes = decodes;
+                }
+            }
+
+            uint32_t misses = caches ? total_misses() : 0;
+            draw_village_line(line_y, line_buffer);
+
+            if (caches && total_misses() != misses) {
+                ++totals->stalled_lines;
+            }
+
+            checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+        }
+
+        if (y_scroll == village_max_y_scroll()) {
+            y_inc = false;
+        } else if (y_scroll == 0) {
+            y_inc = true;
+        }
+
+        if (x_scroll == village_max_x_scroll()) {
+            x_inc = false;
+        } else if (x_scroll == 0) {
+            x_inc = true;
+        }
+
+        y_scroll += y_inc ? 1 : -1;
+        x_scroll += x_inc ? 1 : -1;
+    }
+
+    if (caches) {
+        totals->misses += total_misses();
+        totals->prefetch_decodes += total_prefetch_decodes();
+    }
+
+    return checksum;
+}
+
+// Check every tile of the compressed tileset decodes to `tileset`, the uncompressed one, then
+// report the compression ratio and decode time. Returns false if a tile didn't match.
+static bool check_compression(const char* name, const uint8_t* tileset, double scale) {
+    const compressed_tileset_t* compressed = village_tilemap.tileset_compressed;
+    int tile_bytes = village_tilemap.decode_caches[0].tile_bytes;
+    uint32_t decoded[TILE_ROW_WORDS * TILE_HEIGHT];
+    int num_mismatched = 0;
+
+    for(int tile = 0;tile < compressed->num_tiles; ++tile) {
+        decode_compressed_tile(&village_tilemap, tile, decoded);
+
+        if (memcmp(decoded, tileset + tile * tile_bytes, tile_bytes) != 0) {
+            ++num_mismatched;
+        }
+    }
+
+    uint64_t start = bench_now_ns();
+    for(int repeat = 0;repeat < DECODE_REPEATS; ++repeat) {
+        for(int tile = 0;tile < compressed->num_tiles; ++tile) {
+            decode_compressed_tile(&village_tilemap, tile, decoded);
+            __asm__ volatile("" : : "r"(decoded) : "memory");
+        }
+    }
+    uint64_t decode_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for(int repeat = 0;repeat < DECODE_REPEATS; ++repeat) {
+        for(int tile = 0;tile < compressed->num_tiles; ++tile) {
+            memcpy(decoded, tileset + tile * tile_bytes, tile_bytes);
+            __asm__ volatile("" : : "r"(decoded) : "memory");
+        }
+    }
+    uint64_t copy_ns = bench_now_ns() - start;
+
+    int num_decodes = DECODE_REPEATS * compressed->num_tiles;
+    int raw_bytes = compressed->num_tiles * tile_bytes;
+    int data_bytes = compressed->offsets[compressed->num_tiles];
+    int offset_bytes = (compressed->num_tiles + 1) * sizeof(uint32_t);
+
+    printf("%s: %d tiles, %d bytes compressed to %d (%d data, %d offsets), ratio %.2f%s\n", name,
+        compressed->num_tiles, raw_bytes, data_bytes + offset_bytes, data_bytes, offset_bytes,
+        (double)raw_bytes / (data_bytes + offset_bytes),
+        num_mismatched ? ", MISMATCH" : "");
+    printf("  %.1f ns to decode a tile, %.1f ns to copy one uncompressed\n",
+        (decode_ns * scale) / num_decodes, (copy_ns * scale) / num_decodes);
+
+    if (num_mismatched) {
+        printf("  %d tiles didn't decode to the uncompressed tileset\n", num_mismatched);
+    }
+
+    return num_mismatched == 0;
+}
+
+int main(int argc, char** argv) {
+    int num_cores = 2;
+    int num_frames = 600;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:f:k:")) != -1) {
+        switch (opt) {
+            case 'c': num_cores = atoi(optarg); break;
+            case 'f': num_frames = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_cores < 1 || num_frames < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const pixel_format_t formats[] = {kPixelFormatRGB555, kPixelFormat8bpp};
+    const char* format_names[] = {"RGB555 village_tileset.h", "8bpp village_tileset_8bpp.h"};
+    int num_mismatches = 0;
+    int num_lines = num_frames * SCREEN_HEIGHT;
+
+    for(int format = 0;format < 2; ++format) {
+        set_village_pixel_format(formats[format], false);
+        setup_village_scene(0);
+
+        uint32_t reference_checksum = run_frames(num_frames, false, NULL);
+        // Building the caches drops the uncompressed tileset from the scene
+        const uint8_t* uncompressed = formats[format] == kPixelFormatRGB555 ?
+            (const uint8_t*)village_tilemap.tileset : village_tilemap.tileset_indexed;
+
+        if (!build_village_tile_decode_caches(num_cores, cache_sizes[0])) {
+            fprintf(stderr, "Could not allocate tile decode caches\n");
+            return 1;
+        }
+
+        if (!check_compression(format_names[format], uncompressed, scale)) {
+            ++num_mismatches;
+        }
+
+        printf("  %d cores, %d frames\n", num_cores, num_frames);
+        printf("  %8s %10s %10s %16s %14s %16s %14s\n", "entries", "SRAM bytes", "prefetch",
+            "misses per line", "stalled lines", "decodes per line", "max prefetch");
+        printf("  %8s %10s %10s %16s %14s %16s %14s\n", "", "", "", "", "", "",
+            "first / other");
+
+        for(int size = 0;size < NUM_CACHE_SIZES; ++size) {
+            for(int prefetch = 0;prefetch < 2; ++prefetch) {
+                if (!build_village_tile_decode_caches(num_cores, cache_sizes[size])) {
+                    fprintf(stderr, "Could not allocate tile decode caches\n");
+                    return 1;
+                }
+
+                decode_totals_t totals = {0};
+                uint32_t checksum = run_frames(num_frames, prefetch, &totals);
+                int cache_bytes = num_cores * cache_sizes[size] *
+                    (village_tilemap.decode_caches[0].tile_bytes + sizeof(uint16_t));
+
+                printf("  %8d %10d %10s %16.3f %13.2f%% %16.3f %8u / %3u%s\n", cache_sizes[size],
+                    cache_bytes, prefetch ? "idle" : "none", (double)totals.misses / num_lines,
+                    (100.0 * totals.stalled_lines) / num_lines,
+                    (double)(totals.misses + totals.prefetch_decodes) / num_lines,
+                    totals.max_first_prefetch_decodes, totals.max_prefetch_decodes,
+                    checksum == reference_checksum ? "" : " MISMATCH");
+
+                if (checksum != reference_checksum) {
+                    ++num_mismatches;
+                }
+            }
+        }
+
+        free_village_tile_decode_caches();
+        printf("\n");
+    }
+
+    if (num_mismatches) {
+        printf("%d runs didn't match the uncompressed tileset\n", num_mismatches);
+        return 1;
+    }
+
+    return 0;
+}
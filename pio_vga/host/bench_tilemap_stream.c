@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+#include "pio_vga_tilemap_stream.h"
+#include "village_chunked_map.h"
+
+// Stream the 1024 x 1024 tile map in `village_chunked_map.h` through a window of resident chunks
+// (see `pio_vga_tilemap_stream.h`) while the view bounces around it at a range of speeds. Each
+// frame the stream is updated, as `end_of_frame` does, then the tilemap layer drawn from the
+// window. Output must match drawing the same frames from the whole map expanded into RAM.
+//
+// Reports the chunks loaded per frame, visible chunks that had to be loaded late (with a full
+// chunk of margin and a couple of loads a frame there should be none at these speeds), the time
+// taken by each update against the vblank and the SRAM and flash used against the expanded map.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-f frames] [-l max_loads] [-k scale]\n"
+        "  -f  Number of frames per speed (default 600)\n"
+        "  -l  Most margin chunks loaded per frame (default 2)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog);
+}
+
+// Pixels scrolled per frame, in X with Y at three quarters of the speed
+static const int scroll_speeds[] = {1, 2, 4, 8, 16};
+#define NUM_SCROLL_SPEEDS (sizeof(scroll_speeds) / sizeof(scroll_speeds[0]))
+
+static chunked_map_t chunked_map;
+
+// Move `pos` by `*delta` bouncing back off 0 and `max_pos`
+static int bounce(int pos, int* delta, int max_pos) {
+    pos += *delta;
+
+    if (pos < 0 || pos > max_pos) {
+        *delta = -*delta;
+        pos = pos < 0 ? -pos : 2 * max_pos - pos;
+    }
+
+    return pos;
+}
+
+// Draw `num_frames` frames of the tilemap layer bouncing around the map at `speed` pixels a frame.
+// With `stream` set the stream is updated before each frame (timing it into `samples`), otherwise
+// the layer is drawing the expanded map. Returns a checksum of the output.
+static uint32_t run_frames(int num_frames, int speed, tilemap_stream_t* stream,
+    bench_samples_t* samples) {
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    uint16_t __attribute__ ((aligned (4))) line_buffer[SCREEN_WIDTH];
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    int map_width = chunked_map.width_chunks * chunked_map.chunk_tiles * TILE_WIDTH;
+    int map_height = chunked_map.height_chunks * chunked_map.chunk_tiles * TILE_HEIGHT;
+    // Start in the middle of the map so every direction is crossed before bouncing
+    int x_scroll = map_width / 2;
+    int y_scroll = map_height / 2;
+    int dx = speed;
+    int dy = (speed * 3 + 3) / 4;
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        tilemap_scroll_x = x_scroll;
+        tilemap_scroll_y = y_scroll;
+
+        if (stream) {
+            uint64_t start = bench_now_ns();
+            tilemap_stream_update(stream, x_scroll, y_scroll);
+            uint64_t elapsed = bench_now_ns() - start;
+
+            bench_samples_add(samples, elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+        }
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            draw_tilemap_layers_line(line_y, line_buffer);
+            checksum = bench_fnv1a(checksum, line_buffer, sizeof(line_buffer));
+        }
+
+        x_scroll = bounce(x_scroll, &dx, map_width - SCREEN_WIDTH);
+        y_scroll = bounce(y_scroll, &dy, map_height - SCREEN_HEIGHT);
+    }
+
+    return checksum;
+}
+
+int main(int argc, char** argv) {
+    int num_frames = 600;
+    int max_loads = 2;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:l:k:")) != -1) {
+        switch (opt) {
+            case 'f': num_frames = atoi(optarg); break;
+            case 'l': max_loads = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (num_frames < 1 || max_loads < 0 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    chunked_map.width_chunks = village_map_width_chunks;
+    chunked_map.height_chunks = village_map_height_chunks;
+    chunked_map.chunk_tiles = village_map_chunk_tiles;
+    chunked_map.chunk_index = village_map_chunk_index;
+    chunked_map.chunks = village_map_chunks;
+    chunked_map.num_chunks = village_map_num_chunks;
+
+    // Only the tilemap layer is drawn, sprites are left out
+    setup_village_scene(0);
+
+    int map_tiles_x = chunked_map.width_chunks * chunked_map.chunk_tiles;
+    int map_tiles_y = chunked_map.height_chunks * chunked_map.chunk_tiles;
+    uint16_t* full_map = malloc(map_tiles_x * map_tiles_y * sizeof(uint16_t));
+
+    if (!full_map) {
+        fprintf(stderr, "Could not allocate the expanded map\n");
+        return 1;
+    }
+
+    for(int y = 0;y < map_tiles_y; ++y) {
+        for(int x = 0;x < map_tiles_x; ++x) {
+            full_map[y * map_tiles_x + x] = chunked_map_tile(&chunked_map, x, y);
+        }
+    }
+
+    tilemap_info_t full_tilemap = tilemap_layers[0].tilemap;
+    full_tilemap.tiles = full_map;
+    full_tilemap.width = map_tiles_x;
+    full_tilemap.height = map_tiles_y;
+
+    int chunk_tile_bytes = chunked_map.chunk_tiles * chunked_map.chunk_tiles * sizeof(uint16_t);
+    int index_bytes = chunked_map.width_chunks * chunked_map.height_chunks * sizeof(uint16_t);
+
+    printf("%d x %d tile map, %d x %d chunks of %d x %d tiles, %d stored, %d frames per speed\n",
+        map_tiles_x, map_tiles_y, chunked_map.width_chunks, chunked_map.height_chunks,
+        chunked_map.chunk_tiles, chunked_map.chunk_tiles, chunked_map.num_chunks, num_frames);
+    printf("expanded map %d bytes, chunked map %d bytes of flash (%d index, %d chunks)\n\n",
+        map_tiles_x * map_tiles_y * (int)sizeof(uint16_t),
+        index_bytes + chunked_map.num_chunks * chunk_tile_bytes, index_bytes,
+        chunked_map.num_chunks * chunk_tile_bytes);
+
+    bench_samples_t samples;
+    bench_samples_init(&samples, num_frames);
+    int num_mismatches = 0;
+
+    for(int speed = 0;speed < NUM_SCROLL_SPEEDS; ++speed) {
+        tilemap_layers[0].tilemap = full_tilemap;
+        uint32_t reference_checksum = run_frames(num_frames, scroll_speeds[speed], NULL, NULL);
+
+        tilemap_stream_t stream;
+        if (!tilemap_stream_init(&stream, &chunked_map, &tilemap_layers[0].tilemap, max_loads)) {
+            fprintf(stderr, "Could not setup the tilemap stream\n");
+            return 1;
+        }
+
+        samples.num_samples = 0;
+        uint32_t checksum = run_frames(num_frames, scroll_speeds[speed], &stream, &samples);
+
+        char name[128];
+        snprintf(name, sizeof(name), "%d px per frame, %d x %d chunk window in %d bytes of SRAM",
+            scroll_speeds[speed], stream.window_chunks_x, stream.window_chunks_y,
+            tilemap_stream_window_bytes(&stream));
+        bench_samples_report(name, &samples, VBLANK_TIME_NS, scale);
+        printf("  %u chunks loaded, %.2f per frame (max %d), %u late%s\n\n", stream.chunk_loads,
+            (double)stream.chunk_loads / num_frames, stream.max_frame_loads, stream.late_chunks,
+            checksum == reference_checksum ? "" : ", MISMATCH");
+
+        if (checksum != reference_checksum) {
+            ++num_mismatches;
+        }
+
+        tilemap_stream_free(&stream);
+    }
+
+    bench_samples_free(&samples);
+    free(full_map);
+
+    if (num_mismatches) {
+        printf("%d speeds didn't match the expanded map\n", num_mismatches);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bench_util.h"
+
+uint64_t bench_now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+uint64_t bench_timer_overhead_ns() {
+    uint64_t min_overhead = UINT64_MAX;
+
+    for(int i = 0;i < 10000; ++i) {
+        uint64_t start = bench_now_ns();
+        uint64_t end = bench_now_ns();
+
+        if (end - start < min_overhead) {
+            min_overhead = end - start;
+        }
+    }
+
+    return min_overhead;
+}
+
+void bench_samples_init(bench_samples_t* samples, size_t max_samples) {
+    samples->samples = malloc(max_samples * sizeof(uint32_t));
+    samples->num_samples = 0;
+    samples->max_samples = samples->samples ? max_samples : 0;
+}
+
+void bench_samples_free(bench_samples_t* samples) {
+    free(samples->samples);
+    samples->samples = NULL;
+    samples->num_samples = 0;
+    samples->max_samples = 0;
+}
+
+static int compare_samples(const void* a, const void* b) {
+    uint32_t sample_a = *(const uint32_t*)a;
+    uint32_t sample_b = *(const uint32_t*)b;
+
+    return (sample_a > sample_b) - (sample_a < sample_b);
+}
+
+void bench_samples_report(const char* name, bench_samples_t* samples, uint32_t budget_ns,
+    double scale) {
+
+    if (samples->num_samples == 0) {
+        printf("%s: no samples\n", name);
+        return;
+    }
+
+    qsort(samples->samples, samples->num_samples, sizeof(uint32_t), compare_samples);
+
+    size_t num_over_budget = 0;
+    for(size_t i = 0;i < samples->num_samples; ++i) {
+        if (samples->samples[i] * scale > budget_ns) {
+            ++num_over_budget;
+        }
+    }
+
+    const char* stat_names[] = {"min", "median", "p99", "max"};
+    size_t stat_idx[] = {
+        0,
+        samples->num_samples / 2,
+        (samples->num_samples * 99) / 100,
+        samples->num_samples - 1
+    };
+
+    printf("%s: %zu samples, budget %u ns\n", name, samples->num_samples, budget_ns);
+    for(int i = 0;i < 4; ++i) {
+        double value = samples->samples[stat_idx[i]] * scale;
+        printf("  %-6s %10.0f ns %7.2f%%\n", stat_names[i], value, (value * 100.0) / budget_ns);
+    }
+    printf("  over budget: %zu (%.4f%%)\n", num_over_budget,
+        (num_over_budget * 100.0) / samples->num_samples);
+}
+
+uint32_t bench_fnv1a(uint32_t hash, const void* data, size_t len) {
+    const uint8_t* bytes = data;
+
+    for(size_t i = 0;i < len; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x01000193u;
+    }
+
+    return hash;
+}
+
+bool bench_write_ppm(const char* path, const uint16_t* pixels, int width, int height) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+    uint8_t* rgb = malloc(width * 3);
+    for(int y = 0;y < height && rgb; ++y) {
+        const uint16_t* row = pixels + y * width;
+
+        // Red is in the low bits, each channel is widened to 8 bits
+        for(int x = 0;x < width; ++x) {
+            int r = row[x] & 0x1f;
+            int g = (row[x] >> 5) & 0x1f;
+            int b = (row[x] >> 10) & 0x1f;
+
+            rgb[x * 3] = (r << 3) | (r >> 2);
+            rgb[x * 3 + 1] = (g << 3) | (g >> 2);
+            rgb[x * 3 + 2] = (b << 3) | (b >> 2);
+        }
+
+        fwrite(rgb, 3, width, file);
+    }
+
+    bool written = rgb && !ferror(file);
+    free(rgb);
+
+    return (fclose(file) == 0) && written;
+}
@@ -0,0 +1,55 @@
+#ifndef __BENCH_UTIL_H__
+#define __BENCH_UTIL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// A 640x480@60 VGA line is 800 pixel clocks at 25.175 MHz. The pipeline draws each 320 pixel
+// line into a buffer that is output twice (line doubling) so every line has two VGA lines to be
+// rendered in.
+#define VGA_LINE_TIME_NS 31778
+#define LINE_RENDER_BUDGET_NS (2 * VGA_LINE_TIME_NS)
+// Time between the final visible line of one frame and the first of the next (45 of the 525
+// lines in a frame), where `end_of_frame` work happens.
+#define VBLANK_TIME_NS (45 * VGA_LINE_TIME_NS)
+
+// Monotonic timestamp in nanoseconds
+uint64_t bench_now_ns();
+
+// Smallest observed gap between two back to back `bench_now_ns` calls. Subtracted from every
+// sample so short line renders aren't dominated by timer overhead.
+uint64_t bench_timer_overhead_ns();
+
+typedef struct {
+    uint32_t* samples;
+    size_t num_samples;
+    size_t max_samples;
+} bench_samples_t;
+
+void bench_samples_init(bench_samples_t* samples, size_t max_samples);
+void bench_samples_free(bench_samples_t* samples);
+
+static inline void bench_samples_add(bench_samples_t* samples, uint32_t sample) {
+    if (samples->num_samples < samples->max_samples) {
+        samples->samples[samples->num_samples++] = sample;
+    }
+}
+
+// Print min/median/p99/max of the samples (sorting them in the process) along with each figure
+// as a percentage of `budget_ns` and the number of samples that exceeded it. `scale` is applied to
+// every sample first, use it to approximate a slower target from host timings.
+void bench_samples_report(const char* name, bench_samples_t* samples, uint32_t budget_ns,
+    double scale);
+
+// FNV-1a hash over a buffer, used to checksum rendered output so optimisations can be checked for
+// pixel exactness between runs.
+uint32_t bench_fnv1a(uint32_t hash, const void* data, size_t len);
+
+#define BENCH_FNV1A_INIT 0x811c9dc5u
+
+// Write `width` x `height` RGB555 pixels as a binary PPM image, returns false if the file couldn't
+// be written
+bool bench_write_ppm(const char* path, const uint16_t* pixels, int width, int height);
+
+#endif
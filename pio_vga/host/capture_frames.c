@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "render_threads.h"
+#include "village_scene.h"
+#include "virtual_display.h"
+
+// Host build of the video loop of `pio_vga_fifth.c`. The village scene is drawn by render threads
+// taking jobs from the line dispatcher, as the render cores do, and output through the virtual
+// display (see `virtual_display.h`) which follows the sync timing and `dma_irh` for the chosen
+// video mode. Each frame is captured as the monitor would show it, line repeats and border
+// included, and can be written as a PPM image.
+//
+// A checksum of every captured frame is reported, it should be the same whatever the number of
+// render threads and line buffers. Exits with an error if a line buffer changed between the
+// repeated outputs of a line.
+
+#define SYS_CLOCK_HZ 125000000
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-m mode] [-c cores] [-b buffers] [-f frames] [-n extra_sprites] "
+        "[-o prefix]\n"
+        "  -m  Video mode, 0 to %d (default 0, 640x480 drawing 320x240)\n"
+        "  -c  Render threads, 1 or 2 (default 2)\n"
+        "  -b  Line buffers in the ring (default 8)\n"
+        "  -f  Number of frames to capture (default 60)\n"
+        "  -n  Extra characters added to the scene (default 0)\n"
+        "  -o  Write every frame to <prefix>NNNN.ppm\n",
+        prog, kNumVideoModes - 1);
+}
+
+static int x_scroll;
+static int y_scroll;
+static bool x_inc;
+static bool y_inc;
+
+// Bounce the scroll around the map a pixel a frame, as `end_of_frame` does
+static void capture_end_of_frame() {
+    if (y_scroll == village_max_y_scroll()) {
+        y_inc = false;
+    } else if (y_scroll == 0) {
+        y_inc = true;
+    }
+
+    if (x_scroll == village_max_x_scroll()) {
+        x_inc = false;
+    } else if (x_scroll == 0) {
+        x_inc = true;
+    }
+
+    y_scroll += y_inc ? 1 : -1;
+    x_scroll += x_inc ? 1 : -1;
+    set_village_scroll(x_scroll, y_scroll);
+}
+
+int main(int argc, char** argv) {
+    int mode_id = kVideoMode640x480;
+    int num_cores = 2;
+    int num_line_buffers = 8;
+    int num_frames = 60;
+    int num_extra_sprites = 0;
+    const char* prefix = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "m:c:b:f:n:o:")) != -1) {
+        switch (opt) {
+            case 'm': mode_id = atoi(optarg); break;
+            case 'c': num_cores = atoi(optarg); break;
+            case 'b': num_line_buffers = atoi(optarg); break;
+            case 'f': num_frames = atoi(optarg); break;
+            case 'n': num_extra_sprites = atoi(optarg); break;
+            case 'o': prefix = optarg; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (mode_id < 0 || mode_id >= kNumVideoModes || num_cores < 1 ||
+        num_cores > MAX_RENDER_CORES || num_line_buffers < 2 || num_frames < 1 ||
+        num_extra_sprites < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    video_timing_t timing;
+    if (!build_video_timing(&video_modes[mode_id], SYS_CLOCK_HZ, &timing)) {
+        fprintf(stderr, "Video mode %s can't be output\n", video_modes[mode_id].name);
+        return 1;
+    }
+
+    setup_village_scene(num_extra_sprites);
+    x_scroll = 0;
+    y_scroll = 0;
+    set_village_scroll(x_scroll, y_scroll);
+
+    uint16_t (*line_buffers)[SCREEN_WIDTH] = calloc(num_line_buffers, sizeof(*line_buffers));
+    line_dispatch_t dispatch;
+    virtual_display_t display;
+
+    line_dispatch_init(&dispatch, num_cores, SCREEN_HEIGHT);
+    if (!line_buffers ||
+        !virtual_display_init(&display, &timing, &dispatch, line_buffers, num_line_buffers)) {
+        fprintf(stderr, "Could not allocate the display\n");
+        return 1;
+    }
+
+    render_threads_start(&dispatch, line_buffers, num_line_buffers, draw_village_line,
+        capture_end_of_frame);
+    render_threads_notify();
+
+    uint32_t checksum = BENCH_FNV1A_INIT;
+    bool written = true;
+    uint64_t start = bench_now_ns();
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        virtual_display_output_frame(&display);
+        checksum = bench_fnv1a(checksum, display.frame,
+            display.width * display.height * sizeof(uint16_t));
+
+        if (prefix) {
+            char path[4096];
+            snprintf(path, sizeof(path), "%s%04d.ppm", prefix, frame);
+
+            if (!virtual_display_write_ppm(&display, path)) {
+                fprintf(stderr, "Could not write %s\n", path);
+                written = false;
+                break;
+            }
+        }
+    }
+
+    uint64_t elapsed = bench_now_ns() - start;
+    render_threads_stop();
+
+    printf("%s, %d render thread(s), %d line buffers: %u frames of %dx%d in %.1f ms per frame\n",
+        timing.mode->name, num_cores, num_line_buffers, display.num_frames, display.width,
+        display.height, elapsed / 1e6 / num_frames);
+    printf("lines changed between repeats %u, underruns %u, frames checksum %08x\n",
+        display.num_changed_repeats, dispatch.underrun_stats.total_underruns, checksum);
+
+    bool ok = written && (display.num_changed_repeats == 0);
+
+    virtual_display_free(&display);
+    free(line_buffers);
+
+    return ok ? 0 : 1;
+}
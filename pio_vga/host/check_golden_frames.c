@@ -0,0 +1,511 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "village_scene.h"
+
+// Renders a fixed set of village scenes covering the scrolling and sprite edge cases (odd and
+// partial tile scrolls, the far edges of the map, sprites straddling every screen edge, flipped
+// sprites and more sprites on a line than MAX_SPRITES_PER_LINE) and checks them against the
+// reference frames stored in `golden_frames.txt`. A reference is a checksum of every line so a
+// mismatch reports the lines that changed, use `-o` to write the frames out to look at.
+//
+// Scenes are drawn as `draw_line` draws them and, where the pixel format allows, through the
+// other tilemap drawing paths (`draw_tilemap_line` and `draw_tilemap_line_memcpy` under the
+// sprites), every one of which must match the reference.
+//
+// Each scene also has a budget for the time to draw a frame on the host (the fastest of several
+// draws, in ns) and fails if it takes longer, so an optimisation has to be both pixel exact and no
+// slower. A scene over its budget is timed again for up to OVER_BUDGET_RETRIES more rounds, taking
+// the fastest draw of them all, so host preemption during one round isn't reported as a slowdown.
+// Budgets are only comparable on the machine they were set on, `-k` scales the timings to account
+// for a slower or faster one. Scenes that don't match and scenes over budget are counted apart.
+//
+// `-u` stores the current frames as the references for every scene, keeping the budgets of scenes
+// that have one. `-t` sets every budget to BUDGET_MARGIN times the current time, run it after an
+// optimisation to lock the gain in. Exits with an error if any scene fails.
+
+#define GOLDEN_FILE "golden_frames.txt"
+// Budgets are set this much above the time measured
+#define BUDGET_MARGIN 1.5
+// Further rounds of `-r` draws timed before a scene is reported over its budget
+#define OVER_BUDGET_RETRIES 4
+#define LINES_PER_ROW 8
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-u] [-t] [-g golden_file] [-o prefix] [-r repeats] [-k scale]\n"
+        "  -u  Store the current frames as the references\n"
+        "  -t  Set every budget to %.1fx the current frame time\n"
+        "  -g  Reference file (default " GOLDEN_FILE ")\n"
+        "  -o  Write every scene's frame to <prefix><scene>.ppm\n"
+        "  -r  Draws of each frame timed, the fastest is taken (default 50)\n"
+        "  -k  Multiply host timings by this to approximate a slower target (default 1.0)\n",
+        prog, BUDGET_MARGIN);
+}
+
+typedef enum {
+    // The characters `pio_vga_fifth.c` starts with
+    kSpritesDemo,
+    // Sprites straddling and just beyond every edge and corner of the screen
+    kSpritesEdges,
+    kSpritesEdgesFlipped,
+    // MAX_SPRITES_PER_LINE + 4 overlapping sprites on the same lines, some raised in priority
+    kSpritesCrowdedLine
+} sprite_layout_t;
+
+// Scroll positions below 0 count back from the largest, -1 being the far edge of the map
+typedef struct {
+    const char* name;
+    pixel_format_t format;
+    bool rgb332_lines;
+    int x_scroll;
+    int y_scroll;
+    sprite_layout_t sprites;
+} golden_scene_t;
+
+static const golden_scene_t scenes[] = {
+    {"origin", kPixelFormatRGB555, false, 0, 0, kSpritesDemo},
+    {"odd_x", kPixelFormatRGB555, false, 1, 0, kSpritesDemo},
+    {"partial_tiles", kPixelFormatRGB555, false, 7, 5, kSpritesDemo},
+    {"tile_end", kPixelFormatRGB555, false, 15, 15, kSpritesDemo},
+    {"right_aligned", kPixelFormatRGB555, false, -16, -1, kSpritesDemo},
+    {"far_edge", kPixelFormatRGB555, false, -1, -1, kSpritesDemo},
+    {"edge_sprites", kPixelFormatRGB555, false, 3, 2, kSpritesEdges},
+    {"edge_sprites_flipped", kPixelFormatRGB555, false, 3, 2, kSpritesEdgesFlipped},
+    {"crowded_line", kPixelFormatRGB555, false, 0, 0, kSpritesCrowdedLine},
+    {"far_edge_8bpp", kPixelFormat8bpp, false, -1, -1, kSpritesEdges},
+    {"edge_sprites_8bpp", kPixelFormat8bpp, false, 5, 9, kSpritesEdgesFlipped},
+    {"crowded_line_4bpp", kPixelFormat4bpp, false, 9, 3, kSpritesCrowdedLine},
+    {"partial_tiles_rgb332", kPixelFormatRGB332, true, 7, 5, kSpritesEdges},
+    {"far_edge_8bpp_rgb332", kPixelFormat8bpp, true, -1, -1, kSpritesEdgesFlipped}
+};
+
+#define NUM_SCENES (sizeof(scenes) / sizeof(scenes[0]))
+
+// Ways of drawing a frame that must all give the same output
+typedef enum {
+    kDrawLine,
+    kDrawTilemap,
+    kDrawTilemapMemcpy,
+    kNumDrawPaths
+} draw_path_t;
+
+static const char* draw_path_names[kNumDrawPaths] = {"draw_line", "draw_tilemap_line",
+    "draw_tilemap_line_memcpy"};
+
+typedef struct {
+    char name[64];
+    uint32_t budget_ns;
+    uint32_t frame_checksum;
+    uint32_t line_checksums[SCREEN_HEIGHT];
+} golden_frame_t;
+
+// Screen positions of the sprites in the edge layouts, the last two are fully off screen
+static const int edge_positions[][2] = {
+    {-8, 40}, {-15, 80}, {312, 40}, {319, 100}, {100, -9}, {200, -17}, {60, 231}, {150, 239},
+    {-8, -9}, {312, 231}, {-16, 120}, {320, 160}
+};
+
+#define NUM_EDGE_SPRITES (sizeof(edge_positions) / sizeof(edge_positions[0]))
+
+static void setup_scene(const golden_scene_t* scene) {
+    set_village_pixel_format(scene->format, false);
+    setup_village_scene(0);
+    sprite_overflow_policy = kSpriteOverflowDropLast;
+
+    int x_scroll = scene->x_scroll < 0 ? village_max_x_scroll() + 1 + scene->x_scroll :
+        scene->x_scroll;
+    int y_scroll = scene->y_scroll < 0 ? village_max_y_scroll() + 1 + scene->y_scroll :
+        scene->y_scroll;
+
+    if (scene->sprites != kSpritesDemo) {
+        for(int i = 0;i < NUM_SPRITES; ++i) {
+            screen_sprites[i].enabled = false;
+        }
+    }
+
+    if (scene->sprites == kSpritesEdges || scene->sprites == kSpritesEdgesFlipped) {
+        for(size_t i = 0;i < NUM_EDGE_SPRITES; ++i) {
+            place_village_sprite(i, x_scroll + edge_positions[i][0],
+                y_scroll + edge_positions[i][1], (i * 7) % village_num_sprite_images());
+
+            if (scene->sprites == kSpritesEdgesFlipped) {
+                screen_sprites[i].flip_x = (i & 1) == 0;
+                screen_sprites[i].flip_y = (i & 2) == 0;
+            }
+        }
+    } else if (scene->sprites == kSpritesCrowdedLine) {
+        for(int i = 0;i < MAX_SPRITES_PER_LINE + 4; ++i) {
+            place_village_sprite(i, x_scroll - 8 + i * 14, y_scroll + 100 + (i % 3),
+                (i * 5) % village_num_sprite_images());
+            screen_sprites[i].priority = (i % 7) == 3;
+        }
+    }
+
+    set_village_scroll(x_scroll, y_scroll);
+}
+
+static bool scene_has_path(const golden_scene_t* scene, draw_path_t path) {
+    if (scene->rgb332_lines) {
+        return path == kDrawLine;
+    }
+
+    // The memcpy path copies RGB555 tile rows
+    return path != kDrawTilemapMemcpy || scene->format == kPixelFormatRGB555;
+}
+
+// Draw a frame of the current scene into `frame`, RGB555 lines or RGB332 lines packed as bytes
+static void draw_frame(const golden_scene_t* scene, draw_path_t path,
+    uint16_t (*frame)[SCREEN_WIDTH]) {
+
+    for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+        if (scene->rgb332_lines) {
+            draw_village_line_rgb332(line_y, (uint8_t*)frame[line_y]);
+            continue;
+        }
+
+        switch (path) {
+            case kDrawTilemap:
+                draw_tilemap_line(line_y, village_tilemap, frame[line_y]);
+                draw_sprites_line(line_y, frame[line_y]);
+                break;
+            case kDrawTilemapMemcpy:
+                draw_tilemap_line_memcpy(line_y, village_tilemap, frame[line_y]);
+                draw_sprites_line(line_y, frame[line_y]);
+                break;
+            default:
+                draw_village_line(line_y, frame[line_y]);
+                break;
+        }
+    }
+}
+
+// Fastest of `repeats` draws of the current scene into `frame` as `draw_line` draws it, in ns less
+// `timer_overhead` and multiplied by `scale`
+static uint64_t time_frame(const golden_scene_t* scene, uint16_t (*frame)[SCREEN_WIDTH],
+    int repeats, uint64_t timer_overhead, double scale) {
+
+    uint64_t frame_ns = UINT64_MAX;
+
+    for(int repeat = 0;repeat < repeats; ++repeat) {
+        uint64_t start = bench_now_ns();
+        draw_frame(scene, kDrawLine, frame);
+        uint64_t elapsed = bench_now_ns() - start;
+
+        if (elapsed < frame_ns) {
+            frame_ns = elapsed;
+        }
+    }
+
+    return (frame_ns > timer_overhead ? frame_ns - timer_overhead : 0) * scale;
+}
+
+static void checksum_frame(const golden_scene_t* scene, uint16_t (*frame)[SCREEN_WIDTH],
+    golden_frame_t* golden) {
+
+    size_t line_bytes = scene->rgb332_lines ? SCREEN_WIDTH : SCREEN_WIDTH * sizeof(uint16_t);
+
+    golden->frame_checksum = BENCH_FNV1A_INIT;
+    for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+        golden->line_checksums[line_y] = bench_fnv1a(BENCH_FNV1A_INIT, frame[line_y], line_bytes);
+        golden->frame_checksum = bench_fnv1a(golden->frame_checksum, frame[line_y], line_bytes);
+    }
+}
+
+// Print the lines of `frame` that differ from `golden`, returns the number of them
+static int report_line_differences(const golden_frame_t* golden, const golden_frame_t* frame) {
+    int num_different = 0;
+
+    for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+        if (frame->line_checksums[line_y] != golden->line_checksums[line_y]) {
+            if (num_different < 16) {
+                printf("%s%d", num_different ? ", " : " lines ", line_y);
+            }
+
+            ++num_different;
+        }
+    }
+
+    if (num_different > 16) {
+        printf(" and %d more", num_different - 16);
+    }
+
+    return num_different;
+}
+
+static bool write_frame(const char* prefix, const golden_scene_t* scene,
+    uint16_t (*frame)[SCREEN_WIDTH]) {
+
+    char path[4096];
+    uint16_t (*rgb555)[SCREEN_WIDTH] = frame;
+    uint16_t (*expanded)[SCREEN_WIDTH] = NULL;
+
+    snprintf(path, sizeof(path), "%s%s.ppm", prefix, scene->name);
+
+    // Widen RGB332 lines to RGB555 for the image
+    if (scene->rgb332_lines) {
+        expanded = malloc(SCREEN_HEIGHT * sizeof(*expanded));
+        if (!expanded) {
+            return false;
+        }
+
+        for(int y = 0;y < SCREEN_HEIGHT; ++y) {
+            const uint8_t* line = (const uint8_t*)frame[y];
+
+            for(int x = 0;x < SCREEN_WIDTH; ++x) {
+                int r = line[x] & 7;
+                int g = (line[x] >> 3) & 7;
+                int b = line[x] >> 6;
+
+                expanded[y][x] = ((r * 31 + 3) / 7) | (((g * 31 + 3) / 7) << 5) |
+                    ((b * 31 + 1) / 3) << 10;
+            }
+        }
+
+        rgb555 = expanded;
+    }
+
+    bool written = bench_write_ppm(path, rgb555[0], SCREEN_WIDTH, SCREEN_HEIGHT);
+    free(expanded);
+
+    return written;
+}
+
+static int load_golden(const char* path, golden_frame_t* golden, int max_frames) {
+    FILE* file = fopen(path, "r");
+    int num_frames = 0;
+    char token[64];
+
+    if (!file) {
+        return 0;
+    }
+
+    while (num_frames < max_frames && fscanf(file, " %63s", token) == 1) {
+        if (token[0] == '#') {
+            // Comment, skip the rest of the line
+            int c;
+            while ((c = fgetc(file)) != EOF && c != '\n') {
+            }
+            continue;
+        }
+
+        golden_frame_t* frame = &golden[num_frames];
+        bool read = (strcmp(token, "scene") == 0) &&
+            (fscanf(file, " %63s %u %x", frame->name, &frame->budget_ns,
+                &frame->frame_checksum) == 3);
+
+        for(int line_y = 0;read && line_y < SCREEN_HEIGHT; ++line_y) {
+            read = fscanf(file, " %x", &frame->line_checksums[line_y]) == 1;
+        }
+
+        if (!read) {
+            fprintf(stderr, "%s: malformed entry after %d scenes\n", path, num_frames);
+            break;
+        }
+
+        ++num_frames;
+    }
+
+    fclose(file);
+
+    return num_frames;
+}
+
+static bool save_golden(const char* path, const golden_frame_t* golden, int num_frames) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+
+    fprintf(file, "# Reference frames for check_golden_frames. Each scene has its budget for\n"
+        "# drawing a frame in host nanoseconds, a checksum of the frame and FNV-1a checksums\n"
+        "# of each of its lines. Regenerate with `./check_golden_frames -u` (frames) or `-t`\n"
+        "# (budgets).\n");
+
+    for(int i = 0;i < num_frames; ++i) {
+        fprintf(file, "scene %s %u %08x\n", golden[i].name, golden[i].budget_ns,
+            golden[i].frame_checksum);
+
+        for(int line_y = 0;line_y < SCREEN_HEIGHT; ++line_y) {
+            fprintf(file, "%s%08x", (line_y % LINES_PER_ROW) ? " " : "  ",
+                golden[i].line_checksums[line_y]);
+
+            if ((line_y % LINES_PER_ROW) == LINES_PER_ROW - 1) {
+                fprintf(file, "\n");
+            }
+        }
+    }
+
+    bool written = !ferror(file);
+
+    return (fclose(file) == 0) && written;
+}
+
+static golden_frame_t* find_golden(golden_frame_t* golden, int num_frames, const char* name) {
+    for(int i = 0;i < num_frames; ++i) {
+        if (strcmp(golden[i].name, name) == 0) {
+            return &golden[i];
+        }
+    }
+
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    bool update_frames = false;
+    bool update_budgets = false;
+    const char* golden_path = GOLDEN_FILE;
+    const char* prefix = NULL;
+    int repeats = 50;
+    double scale = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "utg:o:r:k:")) != -1) {
+        switch (opt) {
+            case 'u': update_frames = true; break;
+            case 't': update_budgets = true; break;
+            case 'g': golden_path = optarg; break;
+            case 'o': prefix = optarg; break;
+            case 'r': repeats = atoi(optarg); break;
+            case 'k': scale = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (repeats < 1 || scale <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    golden_frame_t golden[NUM_SCENES];
+    golden_frame_t updated[NUM_SCENES];
+    int num_golden = load_golden(golden_path, golden, NUM_SCENES);
+    uint16_t (*frame)[SCREEN_WIDTH] = malloc(SCREEN_HEIGHT * sizeof(*frame));
+    uint64_t timer_overhead = bench_timer_overhead_ns();
+    int num_mismatched = 0;
+    int num_over_budget = 0;
+    int num_errors = 0;
+
+    printf("%d reference frames in %s, timings scaled by %.2f\n", num_golden, golden_path, scale);
+    printf("%-22s %-8s %10s %10s %6s\n", "scene", "frame", "time us", "budget us", "used");
+
+    for(size_t i = 0;i < NUM_SCENES; ++i) {
+        const golden_scene_t* scene = &scenes[i];
+        const golden_frame_t* reference = find_golden(golden, num_golden, scene->name);
+        golden_frame_t* result = &updated[i];
+        bool frame_ok = true;
+
+        setup_scene(scene);
+        snprintf(result->name, sizeof(result->name), "%s", scene->name);
+
+        // Time the frame as `draw_line` draws it
+        uint64_t frame_ns = time_frame(scene, frame, repeats, timer_overhead, scale);
+        checksum_frame(scene, frame, result);
+
+        if (prefix && !write_frame(prefix, scene, frame)) {
+            fprintf(stderr, "Could not write the frame of %s\n", scene->name);
+            ++num_errors;
+        }
+
+        // Every other path must match `draw_line`
+        for(int path = kDrawLine + 1;path < kNumDrawPaths; ++path) {
+            golden_frame_t path_result;
+
+            if (!scene_has_path(scene, path)) {
+                continue;
+            }
+
+            memset(frame, 0, SCREEN_HEIGHT * sizeof(*frame));
+            draw_frame(scene, path, frame);
+            checksum_frame(scene, frame, &path_result);
+
+            if (path_result.frame_checksum != result->frame_checksum) {
+                printf("%-22s %s differs from draw_line:", scene->name, draw_path_names[path]);
+                report_line_differences(result, &path_result);
+                printf("\n");
+                frame_ok = false;
+            }
+        }
+
+        const char* frame_status = "ok";
+        if (!reference) {
+            frame_status = update_frames ? "new" : "missing";
+            frame_ok = frame_ok && update_frames;
+        } else if (reference->frame_checksum != result->frame_checksum) {
+            frame_status = update_frames ? "updated" : "CHANGED";
+            frame_ok = frame_ok && update_frames;
+        }
+
+        if (reference && !update_budgets) {
+            result->budget_ns = reference->budget_ns;
+        } else {
+            result->budget_ns = frame_ns * BUDGET_MARGIN;
+        }
+
+        // Only a scene that stays over budget through the retries is over budget
+        int retries = 0;
+        while (frame_ns > result->budget_ns && retries < OVER_BUDGET_RETRIES) {
+            uint64_t retry_ns = time_frame(scene, frame, repeats, timer_overhead, scale);
+
+            if (retry_ns < frame_ns) {
+                frame_ns = retry_ns;
+            }
+
+            ++retries;
+        }
+
+        bool time_ok = frame_ns <= result->budget_ns;
+
+        printf("%-22s %-8s %10.1f %10.1f %5.0f%%%s", scene->name, frame_status, frame_ns / 1000.0,
+            result->budget_ns / 1000.0, frame_ns * 100.0 / result->budget_ns,
+            time_ok ? "" : " OVER BUDGET");
+
+        if (retries) {
+            printf(" (fastest of %d rounds)", retries + 1);
+        }
+
+        if (reference && !update_frames &&
+            (reference->frame_checksum != result->frame_checksum)) {
+            report_line_differences(reference, result);
+        }
+
+        printf("\n");
+
+        if (!frame_ok) {
+            ++num_mismatched;
+        }
+
+        if (!time_ok) {
+            ++num_over_budget;
+        }
+
+        // Without -u the stored frame stays the reference
+        if (reference && !update_frames) {
+            memcpy(result->line_checksums, reference->line_checksums,
+                sizeof(result->line_checksums));
+            result->frame_checksum = reference->frame_checksum;
+        }
+    }
+
+    free(frame);
+
+    if (update_frames || update_budgets) {
+        if (!save_golden(golden_path, updated, NUM_SCENES)) {
+            fprintf(stderr, "Could not write %s\n", golden_path);
+            return 1;
+        }
+
+        printf("%s written\n", golden_path);
+    }
+
+    if (!num_mismatched && !num_over_budget && !num_errors) {
+        printf("All scenes match their references and budgets\n");
+        return 0;
+    }
+
+    printf("FAILED: %d mismatched, %d over budget\n", num_mismatched, num_over_budget);
+
+    return 1;
+}
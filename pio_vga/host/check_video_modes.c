@@ -0,0 +1,322 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "pio_vga_video_mode.h"
+
+// Check the sync command words and timing line state machine generated for every video mode
+// against the mode's specified timings. The command words are decoded and a frame is stepped
+// through line by line as `dma_irh` would, timing each pin level as the `sync_out` program would
+// hold it. Checked:
+//  - Every line lasts the specified line time to within a cycle of rounding and the line and frame
+//    rates are within 0.5% of the specification
+//  - The hsync pulse has the specified polarity and length (to within a cycle) on every line and
+//    hsync is idle for the rest of the line
+//  - vsync is active, with the specified polarity, for exactly the specified number of lines at
+//    the start of the frame and idle for every other line
+//  - Only active lines raise the line IRQ, once per line, and the frame has the specified number of
+//    lines with the drawn lines (and the dummy lines before them) inside the visible area and back
+//    porch
+//  - The drawn pixels, given the line program's timing, are centred in the visible area and leave
+//    at least half of each porch clear, with the line program ready again before the next line
+//  - Sending each timing segment's command words by DMA, as the chained sync DMA in
+//    `pio_vga_fifth.c` does (the read address wrapping every line), gives the same lines as the
+//    line state machine over several frames
+//
+// Also reported are the sync interrupts per second the DMA chain saves, one per line.
+//
+// Exits with a non zero status if any check fails.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-c sys_clock_mhz]\n"
+        "  -c  System clock in MHz the modes are generated for (default 125)\n",
+        prog);
+}
+
+static int num_failures;
+
+static void fail(const video_mode_t* mode, const char* message, double value, double expected) {
+    printf("  %s: %s (%.3f, expected %.3f)\n", mode->name, message, value, expected);
+    ++num_failures;
+}
+
+typedef struct {
+    bool hsync;
+    bool vsync;
+    int delay;
+    uint16_t exec;
+} sync_command_t;
+
+static sync_command_t decode_sync_command(uint32_t word) {
+    return (sync_command_t){
+        .hsync = (word & SYNC_PIN_HSYNC) != 0,
+        .vsync = (word & SYNC_PIN_VSYNC) != 0,
+        .delay = (word >> 2) & SYNC_COMMAND_MAX_DELAY,
+        .exec = word >> 16
+    };
+}
+
+// Check the four command words of a line, returns true if the line raises the line IRQ
+static bool check_line(const video_timing_t* timing, const uint32_t* words, bool vsync_line) {
+    const video_mode_t* mode = timing->mode;
+    double cycles_per_clock = (double)timing->sys_clock_hz / mode->pixel_clock_hz;
+    int h_total = mode->h_sync + mode->h_back_porch + mode->h_visible + mode->h_front_porch;
+    int line_cycles = 0;
+    int sync_cycles = 0;
+    int irq_start = -1;
+
+    for(int i = 0;i < SYNC_WORDS_PER_LINE; ++i) {
+        sync_command_t command = decode_sync_command(words[i]);
+        int cycles = command.delay + SYNC_COMMAND_CYCLES;
+        bool hsync_active = command.hsync == mode->h_sync_positive;
+        bool vsync_active = command.vsync == mode->v_sync_positive;
+
+        if (hsync_active) {
+            if (line_cycles != sync_cycles) {
+                fail(mode, "hsync pulse doesn't begin the line", i, 0);
+            }
+
+            sync_cycles += cycles;
+        }
+
+        if (vsync_active != vsync_line) {
+            fail(mode, "vsync level changes within a line", i, 0);
+        }
+
+        if (command.exec == SYNC_EXEC_LINE_IRQ) {
+            if (irq_start >= 0) {
+                fail(mode, "line IRQ raised twice in a line", i, 0);
+            }
+
+            irq_start = line_cycles;
+        } else if (command.exec != SYNC_EXEC_NOP) {
+            fail(mode, "unexpected instruction executed", command.exec, SYNC_EXEC_NOP);
+        }
+
+        line_cycles += cycles;
+    }
+
+    if (fabs(line_cycles - h_total * cycles_per_clock) > 1.0) {
+        fail(mode, "line cycles", line_cycles, h_total * cycles_per_clock);
+    }
+
+    if (fabs(sync_cycles - mode->h_sync * cycles_per_clock) > 1.0) {
+        fail(mode, "hsync cycles", sync_cycles, mode->h_sync * cycles_per_clock);
+    }
+
+    if (irq_start < 0) {
+        return false;
+    }
+
+    // Where the line program puts the drawn pixels, in cycles from the start of the line
+    double pixel_start = irq_start + LINE_PROGRAM_LEAD_CYCLES;
+    double pixel_end = pixel_start + mode->width * timing->pixel_cycles;
+    double visible_start = (mode->h_sync + mode->h_back_porch) * cycles_per_clock;
+    double visible_end = visible_start + mode->h_visible * cycles_per_clock;
+    double min_back_porch = mode->h_back_porch * cycles_per_clock / 2;
+    double min_front_porch = mode->h_front_porch * cycles_per_clock / 2;
+
+    if (pixel_start - sync_cycles < min_back_porch) {
+        fail(mode, "pixels start too early", pixel_start - sync_cycles, min_back_porch);
+    }
+
+    if (line_cycles - pixel_end < min_front_porch) {
+        fail(mode, "pixels end too late", line_cycles - pixel_end, min_front_porch);
+    }
+
+    if (fabs((pixel_start - visible_start) - (visible_end - pixel_end)) > 2.0) {
+        fail(mode, "pixels not centred", pixel_start - visible_start, visible_end - pixel_end);
+    }
+
+    // The next line's IRQ is raised at the same point of the next line
+    if (pixel_end + LINE_PROGRAM_TAIL_CYCLES > line_cycles + irq_start) {
+        fail(mode, "line program not ready for the next line", pixel_end + LINE_PROGRAM_TAIL_CYCLES,
+            line_cycles + irq_start);
+    }
+
+    return true;
+}
+
+// Send `num_frames` frames of command words as the sync DMA chain would, a control block per timing
+// segment with the read address wrapping on a ring of (1 << SYNC_WORDS_RING_BITS) bytes, and
+// compare every line with the words the line state machine gives
+static void check_dma_chain(const video_timing_t* timing, int num_frames) {
+    const video_mode_t* mode = timing->mode;
+    uint32_t ring_mask = (1 << SYNC_WORDS_RING_BITS) - 1;
+    timing_line_state_t state;
+    const uint32_t* expected = timing_line_start(&state, timing);
+    int num_mismatches = 0;
+
+    if (SYNC_WORDS_PER_LINE * sizeof(uint32_t) != ring_mask + 1) {
+        fail(mode, "command words of a line don't fill the DMA ring", ring_mask + 1,
+            SYNC_WORDS_PER_LINE * sizeof(uint32_t));
+    }
+
+    for(int type = 0;type < kNumSyncLineTypes; ++type) {
+        if ((uintptr_t)timing->words[type] & ring_mask) {
+            fail(mode, "command words not aligned for the DMA ring", type, 0);
+        }
+    }
+
+    for(int frame = 0;frame < num_frames; ++frame) {
+        for(int i = 0;i < timing->num_segments; ++i) {
+            const timing_segment_t* segment = &timing->segments[i];
+            uintptr_t read_addr = (uintptr_t)timing->words[segment->type];
+            uint32_t transfers = timing_segment_transfers(segment);
+
+            for(uint32_t transfer = 0;transfer < transfers; ++transfer) {
+                uint32_t word = *(const uint32_t*)read_addr;
+                read_addr = (read_addr & ~(uintptr_t)ring_mask) |
+                    ((read_addr + sizeof(uint32_t)) & ring_mask);
+
+                num_mismatches += word != expected[transfer % SYNC_WORDS_PER_LINE];
+
+                if ((transfer % SYNC_WORDS_PER_LINE) == SYNC_WORDS_PER_LINE - 1) {
+                    expected = timing_line_next(&state);
+                }
+            }
+        }
+    }
+
+    if (num_mismatches) {
+        fail(mode, "DMA chain command words differ from the line state machine", num_mismatches,
+            0);
+    }
+}
+
+static void check_mode(const video_mode_t* mode, uint32_t sys_clock_hz) {
+    video_timing_t timing;
+
+    if (!build_video_timing(mode, sys_clock_hz, &timing)) {
+        printf("  %s: can't be generated at %u Hz\n", mode->name, sys_clock_hz);
+        ++num_failures;
+        return;
+    }
+
+    // Check the words of each type of line, noting those that raise the line IRQ
+    bool raises_irq[kNumSyncLineTypes];
+
+    for(int type = 0;type < kNumSyncLineTypes; ++type) {
+        raises_irq[type] = check_line(&timing, timing.words[type], type == kSyncLineVsync);
+    }
+
+    int v_total = mode->v_sync + mode->v_back_porch + mode->v_visible + mode->v_front_porch;
+    int first_visible_line = mode->v_sync + mode->v_back_porch;
+    int vsync_lines = 0;
+    int active_lines = 0;
+    int first_active_line = -1;
+    int last_active_line = -1;
+
+    // Step through a frame and the first line of the next as `dma_irh` would
+    timing_line_state_t state;
+    const uint32_t* words = timing_line_start(&state, &timing);
+
+    for(int line = 0;line <= v_total; ++line) {
+        int type = words == timing.words[kSyncLineVsync] ? kSyncLineVsync :
+            words == timing.words[kSyncLineActive] ? kSyncLineActive : kSyncLineBlank;
+
+        if (line == v_total) {
+            if (type != kSyncLineVsync) {
+                fail(mode, "frame lines", line, v_total);
+            }
+
+            break;
+        }
+
+        if (type == kSyncLineVsync) {
+            if (line >= mode->v_sync) {
+                fail(mode, "vsync line outside the vsync pulse", line, mode->v_sync);
+            }
+
+            ++vsync_lines;
+        }
+
+        if (raises_irq[type]) {
+            if (first_active_line < 0) {
+                first_active_line = line;
+            } else if (last_active_line != line - 1) {
+                fail(mode, "active lines aren't contiguous", line, last_active_line + 1);
+            }
+
+            last_active_line = line;
+            ++active_lines;
+        }
+
+        words = timing_line_next(&state);
+    }
+
+    if (vsync_lines != mode->v_sync) {
+        fail(mode, "vsync lines", vsync_lines, mode->v_sync);
+    }
+
+    if (active_lines != timing.display_lines + VIDEO_DUMMY_LINES) {
+        fail(mode, "active lines", active_lines, timing.display_lines + VIDEO_DUMMY_LINES);
+    }
+
+    int first_drawn_line = first_active_line + VIDEO_DUMMY_LINES;
+    int expected_first_drawn = first_visible_line + (mode->v_visible - timing.display_lines) / 2;
+
+    if (first_drawn_line != expected_first_drawn) {
+        fail(mode, "first drawn line", first_drawn_line, expected_first_drawn);
+    }
+
+    if ((first_active_line < mode->v_sync) ||
+        (last_active_line >= first_visible_line + mode->v_visible)) {
+        fail(mode, "active lines outside the back porch and visible area", first_active_line,
+            mode->v_sync);
+    }
+
+    double h_total = mode->h_sync + mode->h_back_porch + mode->h_visible + mode->h_front_porch;
+    double line_khz = sys_clock_hz / 1000.0 / timing.line_cycles;
+    double spec_line_khz = mode->pixel_clock_hz / 1000.0 / h_total;
+    double frame_hz = line_khz * 1000.0 / v_total;
+    double spec_frame_hz = spec_line_khz * 1000.0 / v_total;
+
+    if (fabs(line_khz / spec_line_khz - 1.0) > 0.005) {
+        fail(mode, "line rate kHz", line_khz, spec_line_khz);
+    }
+
+    if (fabs(frame_hz / spec_frame_hz - 1.0) > 0.005) {
+        fail(mode, "frame rate Hz", frame_hz, spec_frame_hz);
+    }
+
+    check_dma_chain(&timing, 3);
+
+    printf("%-20s %8d %10.3f %9.3f %9.3f %13d %11d %7d %9.0f\n", mode->name, timing.line_cycles,
+        line_khz, frame_hz, spec_frame_hz, timing.pixel_cycles, first_drawn_line,
+        timing.num_segments, v_total * frame_hz);
+}
+
+int main(int argc, char** argv) {
+    double sys_clock_mhz = 125.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:")) != -1) {
+        switch (opt) {
+            case 'c': sys_clock_mhz = atof(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (sys_clock_mhz <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint32_t sys_clock_hz = lround(sys_clock_mhz * 1000000.0);
+
+    printf("System clock %u Hz\n", sys_clock_hz);
+    printf("%-20s %8s %10s %9s %9s %13s %11s %7s %9s\n", "mode", "cycles", "line kHz", "frame Hz",
+        "spec Hz", "pixel cycles", "first line", "blocks", "IRQs/s");
+
+    for(int mode = 0;mode < kNumVideoModes; ++mode) {
+        check_mode(&video_modes[mode], sys_clock_hz);
+    }
+
+    printf("blocks: DMA control blocks per frame, IRQs/s: sync interrupts per second the DMA chain "
+        "saves\n");
+    printf("%s\n", num_failures ? "FAILED" : "All modes match their specifications");
+
+    return num_failures ? 1 : 0;
+}
@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pio_vga_line_timing.h"
+
+// Decodes the line timing summaries `pio_vga_fifth.c` prints with USE_LINE_TIMING (and
+// `bench_dispatch -t` writes) from a captured serial log, ignoring any other text in it. Prints a
+// line per summary then the histograms and missed deadlines over every summary together.
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+        "Usage: %s [-v] [log_file ...]\n"
+        "  -v  Also print the histograms and the frames with missed deadlines of every summary\n"
+        "Reads standard input if no log files are given.\n",
+        prog);
+}
+
+typedef struct {
+    int num_summaries;
+    int num_bad;
+    int num_dropped;
+    uint32_t last_sequence;
+    uint32_t num_frames;
+    uint32_t num_lines;
+    uint32_t missed_lines;
+    uint32_t frames_with_misses;
+    uint32_t max_frame_misses;
+    uint16_t max_wait_us;
+    uint16_t max_render_us;
+    uint16_t min_slack_us;
+    uint32_t wait_hist[LINE_TIMING_BUCKETS];
+    uint32_t render_hist[LINE_TIMING_BUCKETS];
+    uint32_t slack_hist[LINE_TIMING_BUCKETS];
+} timing_totals_t;
+
+static void add_summary(timing_totals_t* totals, const line_timing_summary_t* summary) {
+    if (totals->num_summaries && summary->sequence != totals->last_sequence + 1) {
+        totals->num_dropped += summary->sequence - totals->last_sequence - 1;
+    }
+
+    totals->last_sequence = summary->sequence;
+    ++totals->num_summaries;
+    totals->num_frames += summary->num_frames;
+    totals->num_lines += summary->num_lines;
+    totals->missed_lines += summary->missed_lines;
+    totals->frames_with_misses += summary->frames_with_misses;
+
+    for(int i = 0;i < summary->num_frames; ++i) {
+        if (summary->frame_misses[i] > totals->max_frame_misses) {
+            totals->max_frame_misses = summary->frame_misses[i];
+        }
+    }
+
+    if (summary->max_wait_us > totals->max_wait_us) {
+        totals->max_wait_us = summary->max_wait_us;
+    }
+
+    if (summary->max_render_us > totals->max_render_us) {
+        totals->max_render_us = summary->max_render_us;
+    }
+
+    if (summary->min_slack_us < totals->min_slack_us) {
+        totals->min_slack_us = summary->min_slack_us;
+    }
+
+    for(int i = 0;i < LINE_TIMING_BUCKETS; ++i) {
+        totals->wait_hist[i] += summary->wait_hist[i];
+        totals->render_hist[i] += summary->render_hist[i];
+        totals->slack_hist[i] += summary->slack_hist[i];
+    }
+}
+
+// Lower edge of the bucket holding the `percent`th percentile
+static uint32_t hist_percentile(const uint32_t* hist, int shift, double percent) {
+    uint32_t total = 0;
+    for(int i = 0;i < LINE_TIMING_BUCKETS; ++i) {
+        total += hist[i];
+    }
+
+    uint32_t count = 0;
+    for(int i = 0;i < LINE_TIMING_BUCKETS; ++i) {
+        count += hist[i];
+        if (count > 0 && count >= total * percent / 100.0) {
+            return i << shift;
+        }
+    }
+
+    return 0;
+}
+
+static void print_histograms(const uint32_t* wait, const uint32_t* render, const uint32_t* slack) {
+    uint32_t totals[3] = {0};
+    const uint32_t* hists[3] = {wait, render, slack};
+    const int shifts[3] = {LINE_TIMING_WAIT_SHIFT, LINE_TIMING_RENDER_SHIFT,
+        LINE_TIMING_SLACK_SHIFT};
+
+    for(int h = 0;h < 3; ++h) {
+        for(int i = 0;i < LINE_TIMING_BUCKETS; ++i) {
+            totals[h] += hists[h][i];
+        }
+    }
+
+    printf("  %-15s %-8s  %-15s %-8s  %-15s %-8s\n", "wait us", "lines", "render us", "lines",
+        "slack us", "lines");
+
+    for(int i = 0;i < LINE_TIMING_BUCKETS; ++i) {
+        printf(" ");
+
+        for(int h = 0;h < 3; ++h) {
+            char range[16];
+            int low = i << shifts[h];
+
+            if (i == LINE_TIMING_BUCKETS - 1) {
+                snprintf(range, sizeof(range), "%d+", low);
+            } else {
+                snprintf(range, sizeof(range), "%d-%d", low, ((i + 1) << shifts[h]) - 1);
+            }
+
+            printf(" %-15s %5u %2u%%", range, hists[h][i],
+                totals[h] ? (unsigned)(hists[h][i] * 100 / totals[h]) : 0);
+        }
+
+        printf("\n");
+    }
+}
+
+static void print_summary(const line_timing_summary_t* summary, bool verbose) {
+    printf("#%u: %u frames, %u lines, %u missed in %u frames, wait max %u us, render max %u us "
+        "(line %u), ", summary->sequence, summary->num_frames, summary->num_lines,
+        summary->missed_lines, summary->frames_with_misses, summary->max_wait_us,
+        summary->max_render_us, summary->max_render_line);
+
+    if (summary->min_slack_us == UINT16_MAX) {
+        printf("no lines drawn in time\n");
+    } else {
+        printf("slack min %u us (line %u)\n", summary->min_slack_us, summary->min_slack_line);
+    }
+
+    if (!verbose) {
+        return;
+    }
+
+    uint32_t hists[3][LINE_TIMING_BUCKETS];
+    for(int i = 0;i < LINE_TIMING_BUCKETS; ++i) {
+        hists[0][i] = summary->wait_hist[i];
+        hists[1][i] = summary->render_hist[i];
+        hists[2][i] = summary->slack_hist[i];
+    }
+
+    print_histograms(hists[0], hists[1], hists[2]);
+
+    if (summary->frames_with_misses) {
+        printf("  missed deadlines (frame: lines):");
+        for(int i = 0;i < summary->num_frames; ++i) {
+            if (summary->frame_misses[i]) {
+                printf(" %d: %u", i, summary->frame_misses[i]);
+            }
+        }
+        printf("\n");
+    }
+}
+
+static void decode_file(FILE* file, timing_totals_t* totals, bool verbose) {
+    char* line = NULL;
+    size_t line_size = 0;
+
+    while (getline(&line, &line_size, file) != -1) {
+        const char* text = strstr(line, LINE_TIMING_TEXT_PREFIX);
+        line_timing_summary_t summary;
+
+        if (!text) {
+            continue;
+        }
+
+        if (!line_timing_parse_summary(text, &summary) ||
+            (summary.wait_shift != LINE_TIMING_WAIT_SHIFT) ||
+            (summary.render_shift != LINE_TIMING_RENDER_SHIFT) ||
+            (summary.slack_shift != LINE_TIMING_SLACK_SHIFT)) {
+            ++totals->num_bad;
+            continue;
+        }
+
+        print_summary(&summary, verbose);
+        add_summary(totals, &summary);
+    }
+
+    free(line);
+}
+
+int main(int argc, char** argv) {
+    bool verbose = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+            case 'v': verbose = true; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    timing_totals_t totals = {0};
+    totals.min_slack_us = UINT16_MAX;
+
+    if (optind == argc) {
+        decode_file(stdin, &totals, verbose);
+    }
+
+    for(int i = optind;i < argc; ++i) {
+        FILE* file = fopen(argv[i], "r");
+        if (!file) {
+            fprintf(stderr, "Could not open %s\n", argv[i]);
+            return 1;
+        }
+
+        decode_file(file, &totals, verbose);
+        fclose(file);
+    }
+
+    if (totals.num_summaries == 0) {
+        fprintf(stderr, "No line timing summaries found (%d unreadable)\n", totals.num_bad);
+        return 1;
+    }
+
+    printf("%d summaries (%d dropped, %d unreadable): %u frames, %u lines\n",
+        totals.num_summaries, totals.num_dropped, totals.num_bad, totals.num_frames,
+        totals.num_lines);
+    printf("missed deadlines: %u lines in %u frames, at most %u in a frame\n",
+        totals.missed_lines, totals.frames_with_misses, totals.max_frame_misses);
+    printf("wait   p50 %u us, p99 %u us, max %u us\n",
+        hist_percentile(totals.wait_hist, LINE_TIMING_WAIT_SHIFT, 50),
+        hist_percentile(totals.wait_hist, LINE_TIMING_WAIT_SHIFT, 99), totals.max_wait_us);
+    printf("render p50 %u us, p99 %u us, max %u us\n",
+        hist_percentile(totals.render_hist, LINE_TIMING_RENDER_SHIFT, 50),
+        hist_percentile(totals.render_hist, LINE_TIMING_RENDER_SHIFT, 99),
+        totals.max_render_us);
+
+    if (totals.min_slack_us == UINT16_MAX) {
+        printf("slack  no lines drawn in time\n");
+    } else {
+        printf("slack  p1 %u us, p50 %u us, min %u us\n",
+            hist_percentile(totals.slack_hist, LINE_TIMING_SLACK_SHIFT, 1),
+            hist_percentile(totals.slack_hist, LINE_TIMING_SLACK_SHIFT, 50),
+            totals.min_slack_us);
+    }
+
+    printf("(percentiles are the lower edge of their histogram bucket)\n");
+    print_histograms(totals.wait_hist, totals.render_hist, totals.slack_hist);
+
+    return 0;
+}
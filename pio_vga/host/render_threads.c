@@ -0,0 +1,138 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include "render_threads.h"
+
+static line_dispatch_t* render_dispatch;
+static uint16_t (*render_line_buffers)[SCREEN_WIDTH];
+static int render_num_line_buffers;
+static render_draw_line_fn render_draw_line;
+static render_end_of_frame_fn render_end_of_frame;
+
+static pthread_t render_threads[MAX_RENDER_CORES];
+static pthread_mutex_t render_event_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t render_event_cond = PTHREAD_COND_INITIALIZER;
+
+// Protected by `render_event_mutex`
+static bool render_events[MAX_RENDER_CORES];
+static bool render_stop;
+static bool new_frame;
+
+// Block until an event has been signalled for `core` since it last waited, equivalent of `__wfe`.
+// Returns false when the threads are being stopped.
+static bool wait_for_event(int core) {
+    pthread_mutex_lock(&render_event_mutex);
+
+    while (!render_events[core] && !render_stop) {
+        pthread_cond_wait(&render_event_cond, &render_event_mutex);
+    }
+
+    render_events[core] = false;
+    bool keep_running = !render_stop;
+
+    pthread_mutex_unlock(&render_event_mutex);
+
+    return keep_running;
+}
+
+void render_threads_notify() {
+    pthread_mutex_lock(&render_event_mutex);
+
+    for(int core = 0;core < MAX_RENDER_CORES; ++core) {
+        render_events[core] = true;
+    }
+
+    pthread_cond_broadcast(&render_event_cond);
+    pthread_mutex_unlock(&render_event_mutex);
+}
+
+void render_threads_new_frame() {
+    pthread_mutex_lock(&render_event_mutex);
+    new_frame = true;
+    pthread_mutex_unlock(&render_event_mutex);
+
+    render_threads_notify();
+}
+
+static bool draw_next_line(int core) {
+    int line;
+
+    if (!line_dispatch_take_job(render_dispatch, core, &line)) {
+        return false;
+    }
+
+    render_draw_line(line, render_line_buffers[line % render_num_line_buffers]);
+    line_dispatch_job_done(render_dispatch, core);
+
+    return true;
+}
+
+static bool new_frame_pending() {
+    pthread_mutex_lock(&render_event_mutex);
+    bool do_end_of_frame = new_frame;
+    pthread_mutex_unlock(&render_event_mutex);
+
+    return do_end_of_frame;
+}
+
+static void clear_new_frame() {
+    pthread_mutex_lock(&render_event_mutex);
+    new_frame = false;
+    pthread_mutex_unlock(&render_event_mutex);
+}
+
+static void* render_thread(void* arg) {
+    int core = (int)(intptr_t)arg;
+
+    do {
+        while (true) {
+            if (draw_next_line(core)) {
+                if (core != 0) {
+                    render_threads_notify();
+                }
+                continue;
+            }
+
+            // As `video_loop`, only thread 0 does end of frame processing and only once every
+            // line of the frame is drawn
+            if (core == 0 && new_frame_pending() && line_dispatch_frame_drawn(render_dispatch)) {
+                render_end_of_frame();
+                line_dispatch_release_frame(render_dispatch);
+                clear_new_frame();
+                render_threads_notify();
+                continue;
+            }
+
+            break;
+        }
+    } while (wait_for_event(core));
+
+    return NULL;
+}
+
+void render_threads_start(line_dispatch_t* dispatch, uint16_t (*line_buffers)[SCREEN_WIDTH],
+    int num_line_buffers, render_draw_line_fn draw_line, render_end_of_frame_fn end_of_frame) {
+
+    render_dispatch = dispatch;
+    render_line_buffers = line_buffers;
+    render_num_line_buffers = num_line_buffers;
+    render_draw_line = draw_line;
+    render_end_of_frame = end_of_frame;
+    render_stop = false;
+    new_frame = false;
+
+    for(int core = 0;core < dispatch->num_cores; ++core) {
+        render_events[core] = false;
+        pthread_create(&render_threads[core], NULL, render_thread, (void*)(intptr_t)core);
+    }
+}
+
+void render_threads_stop() {
+    pthread_mutex_lock(&render_event_mutex);
+    render_stop = true;
+    pthread_cond_broadcast(&render_event_cond);
+    pthread_mutex_unlock(&render_event_mutex);
+
+    for(int core = 0;core < render_dispatch->num_cores; ++core) {
+        pthread_join(render_threads[core], NULL);
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef __RENDER_THREADS_H__
+#define __RENDER_THREADS_H__
+
+#include <stdint.h>
+#include "pio_vga_line_dispatch.h"
+#include "pio_vga_render.h"
+
+// Host backend for the line job dispatcher. Runs one thread per render core executing the same
+// loops as `video_loop` and `render_core1_loop` in `pio_vga_fifth.c`, with a per thread event flag
+// standing in for `__sev`/`__wfe`. Whatever plays the part of the video interrupt handler calls
+// `line_dispatch_request` followed by `render_threads_notify`, and `render_threads_new_frame` at
+// the end of each frame.
+
+typedef void (*render_draw_line_fn)(int line_y, uint16_t* line_buffer);
+typedef void (*render_end_of_frame_fn)();
+
+// Start `dispatch->num_cores` threads drawing lines into `line_buffers` (line `n` is drawn into
+// `line_buffers[n % num_line_buffers]`). Thread 0 also calls `end_of_frame` when a new frame has
+// been signalled and every line of the current frame is drawn.
+void render_threads_start(line_dispatch_t* dispatch, uint16_t (*line_buffers)[SCREEN_WIDTH],
+    int num_line_buffers, render_draw_line_fn draw_line, render_end_of_frame_fn end_of_frame);
+
+// Wake all render threads, equivalent of `__sev`
+void render_threads_notify();
+
+// Signal the end of a frame, equivalent of `dma_irh` setting `new_frame`
+void render_threads_new_frame();
+
+// Stop and join all the render threads
+void render_threads_stop();
+
+#endif
@@ -0,0 +1,342 @@
+#include <stddef.h>
+#include "village_scene.h"
+#include "sprite_data.h"
+#include "sprite_data_4bpp.h"
+#include "sprite_data_8bpp.h"
+#include "sprite_data_rgb332.h"
+#include "test_tilemap.h"
+#include "village_tileset.h"
+#include "village_tileset_4bpp.h"
+#include "village_tileset_8bpp.h"
+#include "village_tileset_8bpp_lz.h"
+#include "village_tileset_lz.h"
+#include "village_tileset_rgb332.h"
+
+// Each character has 4 walk animations of 3 frames, the downward walk is the third animation
+#define FRAMES_PER_CHARACTER 12
+#define WALK_DOWN_FIRST_FRAME 6
+
+tilemap_info_t village_tilemap;
+
+static pixel_format_t village_format = kPixelFormatRGB555;
+static bool village_palette_pairs = false;
+static palette_t village_tile_palette;
+static palette_t village_sprite_palette;
+
+void set_village_pixel_format(pixel_format_t format, bool palette_pairs) {
+    village_format = format;
+    village_palette_pairs = palette_pairs;
+}
+
+// Sprite images in the current format and the number of them. Indexed sprites have repeated and
+// mirrored frames left out so have fewer images than frames.
+static const void* village_format_sprite_images(int* num_images) {
+    switch (village_format) {
+        case kPixelFormat8bpp:
+            *num_images = sprite_8bpp_count;
+            return sprite_8bpp_data;
+        case kPixelFormat4bpp:
+            *num_images = sprite_4bpp_count;
+            return sprite_4bpp_data;
+        case kPixelFormatRGB332:
+            *num_images = sprite_rgb332_count;
+            return sprite_rgb332_data;
+        default:
+            *num_images = num_sprite;
+            return sprite_data;
+    }
+}
+
+// Point a sprite at frame `frame_idx` of the sprite sheet in the current format
+static void set_village_sprite_frame(sprite_info_t* sprite, int frame_idx) {
+    int num_images;
+    const void* images = village_format_sprite_images(&num_images);
+
+    switch (village_format) {
+        case kPixelFormat8bpp:
+            set_sprite_frame(sprite, images, sprite_8bpp_frames[frame_idx]);
+            break;
+        case kPixelFormat4bpp:
+            set_sprite_frame(sprite, images, sprite_4bpp_frames[frame_idx]);
+            sprite->palette_bank =
+                sprite_4bpp_banks[sprite_4bpp_frames[frame_idx] & SPRITE_FRAME_IMAGE_MASK];
+            break;
+        case kPixelFormatRGB332:
+            set_sprite_frame(sprite, images, sprite_rgb332_frames[frame_idx]);
+            break;
+        default:
+            set_sprite_frame(sprite, images, frame_idx);
+            break;
+    }
+}
+
+// Point the tilemap and sprites at the data and palettes for the current format. Indexed palettes
+// get RGB332 lookups so the scene can be drawn with `draw_village_line_rgb332`.
+static void setup_village_format() {
+    free_palette_pairs(&village_tile_palette);
+    free_palette_pairs(&village_sprite_palette);
+    free_palette_rgb332(&village_tile_palette);
+    free_palette_rgb332(&village_sprite_palette);
+
+    village_tilemap.tileset_format = village_format;
+    village_tilemap.tile_banks = NULL;
+    village_tilemap.palette = &village_tile_palette;
+    sprite_palette = &village_sprite_palette;
+
+    switch (village_format) {
+        case kPixelFormat8bpp:
+            village_tilemap.tileset_indexed = tileset_8bpp_data;
+            village_tile_palette = (palette_t){tileset_8bpp_palette, tileset_8bpp_num_colours};
+            village_sprite_palette = (palette_t){sprite_8bpp_palette, sprite_8bpp_num_colours};
+            break;
+        case kPixelFormat4bpp:
+            village_tilemap.tileset_indexed = tileset_4bpp_data;
+            village_tilemap.tile_banks = tileset_4bpp_banks;
+            village_tile_palette = (palette_t){tileset_4bpp_palette,
+                tileset_4bpp_num_banks * PALETTE_BANK_COLOURS};
+            village_sprite_palette = (palette_t){sprite_4bpp_palette,
+                sprite_4bpp_num_banks * PALETTE_BANK_COLOURS};
+
+            if (village_palette_pairs) {
+                build_palette_pairs(&village_tile_palette);
+                build_palette_pairs(&village_sprite_palette);
+            }
+            break;
+        case kPixelFormatRGB332:
+            village_tilemap.tileset_indexed = tileset_rgb332_data;
+            village_tilemap.palette = NULL;
+            sprite_palette = NULL;
+            return;
+        default:
+            village_tilemap.tileset_indexed = NULL;
+            village_tilemap.palette = NULL;
+            sprite_palette = NULL;
+            return;
+    }
+
+    build_palette_rgb332(&village_tile_palette);
+    build_palette_rgb332(&village_sprite_palette);
+}
+
+int village_asset_bytes() {
+    int pairs_bytes = village_palette_pairs ?
+        (tileset_4bpp_num_banks + sprite_4bpp_num_banks) * 256 * sizeof(uint32_t) : 0;
+
+    switch (village_format) {
+        case kPixelFormat8bpp:
+            return sizeof(tileset_8bpp_data) + sizeof(tileset_8bpp_palette) +
+                sizeof(sprite_8bpp_data) + sizeof(sprite_8bpp_palette) +
+                sizeof(sprite_8bpp_frames);
+        case kPixelFormat4bpp:
+            return sizeof(tileset_4bpp_data) + sizeof(tileset_4bpp_palette) +
+                sizeof(tileset_4bpp_banks) + sizeof(sprite_4bpp_data) +
+                sizeof(sprite_4bpp_palette) + sizeof(sprite_4bpp_banks) +
+                sizeof(sprite_4bpp_frames) + pairs_bytes;
+        case kPixelFormatRGB332:
+            return sizeof(tileset_rgb332_data) + sizeof(sprite_rgb332_data) +
+                sizeof(sprite_rgb332_frames);
+        default:
+            return sizeof(tileset) + sizeof(sprite_data);
+    }
+}
+
+const uint16_t* village_sprite_ptr(int sprite_idx) {
+    return sprite_data + sprite_idx * SPRITE_WIDTH * sprite_height;
+}
+
+int village_num_sprite_images() {
+    return num_sprite;
+}
+
+int village_sprite_height() {
+    return sprite_height;
+}
+
+bool build_village_sprite_spans() {
+    int num_images;
+    const void* images = village_format_sprite_images(&num_images);
+
+    return build_sprite_spans_format(images, num_images * sprite_height, village_format);
+}
+
+bool build_village_shifted_tileset() {
+    bool built = build_shifted_tileset(&village_tilemap, num_tiles);
+    tilemap_layers[0].tilemap.tileset_shifted = village_tilemap.tileset_shifted;
+
+    return built;
+}
+
+bool build_village_tile_row_caches(int num_caches, int num_entries) {
+    bool built = build_tile_row_caches(&village_tilemap, num_caches, num_entries);
+    tilemap_layers[0].tilemap.row_caches = village_tilemap.row_caches;
+    tilemap_layers[0].tilemap.num_row_caches = village_tilemap.num_row_caches;
+
+    return built;
+}
+
+void free_village_tile_row_caches() {
+    free_tile_row_caches(&village_tilemap);
+    tilemap_layers[0].tilemap.row_caches = NULL;
+    tilemap_layers[0].tilemap.num_row_caches = 0;
+}
+
+// Point the tilemap layer at the tileset, shifted tileset and tile decode caches of
+// `village_tilemap`
+static void set_village_layer_tileset() {
+    tilemap_info_t* tilemap = &tilemap_layers[0].tilemap;
+
+    tilemap->tileset = village_tilemap.tileset;
+    tilemap->tileset_indexed = village_tilemap.tileset_indexed;
+    tilemap->tileset_shifted = village_tilemap.tileset_shifted;
+    tilemap->tileset_compressed = village_tilemap.tileset_compressed;
+    tilemap->decode_caches = village_tilemap.decode_caches;
+    tilemap->num_decode_caches = village_tilemap.num_decode_caches;
+}
+
+bool build_village_tile_decode_caches(int num_caches, int num_entries) {
+    static compressed_tileset_t compressed;
+
+    // Only the RGB555 and 8bpp tilesets are compressed
+    if (village_format == kPixelFormatRGB555) {
+        compressed.data = tileset_lz_data;
+        compressed.offsets = tileset_lz_offsets;
+        compressed.num_tiles = tileset_lz_count;
+    } else if (village_format == kPixelFormat8bpp) {
+        compressed.data = tileset_8bpp_lz_data;
+        compressed.offsets = tileset_8bpp_lz_offsets;
+        compressed.num_tiles = tileset_8bpp_lz_count;
+    } else {
+        return false;
+    }
+
+    village_tilemap.tileset_compressed = &compressed;
+    bool built = build_tile_decode_caches(&village_tilemap, num_caches, num_entries);
+
+    if (built) {
+        // Everything is drawn from the decoded tiles, drop the uncompressed and shifted tilesets
+        // so nothing can be drawn from them by mistake
+        village_tilemap.tileset = NULL;
+        village_tilemap.tileset_indexed = NULL;
+        free_shifted_tileset(&village_tilemap);
+    } else {
+        village_tilemap.tileset_compressed = NULL;
+    }
+
+    set_village_layer_tileset();
+
+    return built;
+}
+
+void free_village_tile_decode_caches() {
+    if (village_tilemap.tileset_compressed) {
+        village_tilemap.tileset = tileset;
+        village_tilemap.tileset_indexed =
+            village_format == kPixelFormat8bpp ? tileset_8bpp_data : NULL;
+        build_shifted_tileset(&village_tilemap, num_tiles);
+    }
+
+    free_tile_decode_caches(&village_tilemap);
+    village_tilemap.tileset_compressed = NULL;
+    set_village_layer_tileset();
+}
+
+void place_village_sprite(int sprite_idx, int x, int y, int frame_idx) {
+    screen_sprites[sprite_idx].x = x;
+    screen_sprites[sprite_idx].y = y;
+    screen_sprites[sprite_idx].height = sprite_height;
+    screen_sprites[sprite_idx].format = village_format;
+    set_village_sprite_frame(&screen_sprites[sprite_idx], frame_idx);
+    screen_sprites[sprite_idx].enabled = true;
+}
+
+void setup_village_scene(int num_extra_sprites) {
+    village_tilemap.width = tilemap_width;
+    village_tilemap.height = tilemap_height;
+    village_tilemap.tiles = tilemap_tiles;
+    village_tilemap.tileset = tileset;
+    village_tilemap.x_scroll = 0;
+    village_tilemap.y_scroll = 0;
+    // Any tile row or decode caches hold tiles of the previous setup
+    free_tile_row_caches(&village_tilemap);
+    free_tile_decode_caches(&village_tilemap);
+    village_tilemap.tileset_compressed = NULL;
+    setup_village_format();
+
+    // As `setup_tilemap` the village tilemap is the only layer
+    tilemap_layers[0] = (tilemap_layer_t){
+        .tilemap = village_tilemap,
+        .parallax_x = PARALLAX_ONE,
+        .parallax_y = PARALLAX_ONE,
+        .enabled = true
+    };
+    num_tilemap_layers = 1;
+    tilemap_scroll_x = 0;
+    tilemap_scroll_y = 0;
+    build_village_shifted_tileset();
+
+    init_sprites();
+    build_village_sprite_spans();
+
+    // Tile X, tile Y and character of the entities set up by `setup_entities`
+    const int start_chars[][3] = {
+        {2, 2, 0}, {4, 7, 1}, {7, 8, 2}, {4, 15, 3}, {18, 4, 4}, {2, 12, 5}, {7, 24, 0}
+    };
+    const int num_start_chars = sizeof(start_chars) / sizeof(start_chars[0]);
+
+    int sprite_idx = 0;
+    for(int i = 0;i < num_start_chars; ++i) {
+        place_village_sprite(sprite_idx++, start_chars[i][0] * TILE_WIDTH,
+            start_chars[i][1] * TILE_HEIGHT, start_chars[i][2] * FRAMES_PER_CHARACTER + WALK_DOWN_FIRST_FRAME);
+    }
+
+    int map_pixel_width = tilemap_width * TILE_WIDTH - SPRITE_WIDTH;
+    int map_pixel_height = tilemap_height * TILE_HEIGHT - sprite_height;
+
+    uint32_t rand_state = 0x1234567;
+    for(int i = 0;i < num_extra_sprites && sprite_idx < NUM_SPRITES; ++i) {
+        rand_state = rand_state * 1664525u + 1013904223u;
+        int x = (rand_state >> 8) % map_pixel_width;
+        rand_state = rand_state * 1664525u + 1013904223u;
+        int y = (rand_state >> 8) % map_pixel_height;
+
+        place_village_sprite(sprite_idx++, x, y, i % num_sprite);
+    }
+}
+
+int village_max_x_scroll() {
+    return tilemap_width * TILE_WIDTH - SCREEN_WIDTH - 1;
+}
+
+int village_max_y_scroll() {
+    return tilemap_height * TILE_HEIGHT - SCREEN_HEIGHT - 1;
+}
+
+void set_village_scroll(int x_scroll, int y_scroll) {
+    village_tilemap.x_scroll = x_scroll;
+    village_tilemap.y_scroll = y_scroll;
+    tilemap_scroll_x = x_scroll;
+    tilemap_scroll_y = y_scroll;
+    sprite_scroll_x = x_scroll;
+    sprite_scroll_y = y_scroll;
+
+    build_sprite_line_index();
+}
+
+void draw_village_line(int line_y, uint16_t* line_buffer) {
+    if (!framebuffer_covers_line(&framebuffer, line_y)) {
+        draw_tilemap_layers_line(line_y, line_buffer);
+    }
+
+    draw_framebuffer_line(line_y, &framebuffer, line_buffer);
+    draw_sprites_line(line_y, line_buffer);
+    apply_raster_colour_transform(line_y, line_buffer);
+}
+
+void draw_village_line_rgb332(int line_y, uint8_t* line_buffer) {
+    if (!framebuffer_covers_line(&framebuffer, line_y)) {
+        draw_tilemap_layers_line_rgb332(line_y, line_buffer);
+    }
+
+    draw_framebuffer_line_rgb332(line_y, &framebuffer, line_buffer);
+    draw_sprites_line_rgb332(line_y, line_buffer);
+}
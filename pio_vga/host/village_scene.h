@@ -0,0 +1,71 @@
+#ifndef __VILLAGE_SCENE_H__
+#define __VILLAGE_SCENE_H__
+
+#include "pio_vga_render.h"
+
+// The village tilemap and characters from `pio_vga_fifth.c` set up for host side rendering.
+
+// The village tilemap, also set up as the only tilemap layer (`tilemap_layers[0]`)
+extern tilemap_info_t village_tilemap;
+
+// Pixel format of the tileset and sprites used by the next `setup_village_scene`, RGB555 by
+// default. With `palette_pairs` 4bpp palettes get pair lookups (see `build_palette_pairs`).
+// Indexed data comes from the `_8bpp.h` and `_4bpp.h` headers, where 4bpp has a few pixels changed
+// to fit the tiles into palette banks so doesn't render exactly the same scene. RGB332 data comes
+// from the `_rgb332.h` headers and can only be drawn with `draw_village_line_rgb332`.
+void set_village_pixel_format(pixel_format_t format, bool palette_pairs);
+
+// Bytes of tile and sprite data, palettes and palette lookups for the current pixel format
+int village_asset_bytes();
+
+// Place the characters `pio_vga_fifth.c` starts with at their initial positions, followed by
+// `num_extra_sprites` further characters scattered over the map (at fixed pseudo-random
+// positions, so every run renders the same scene). The total is capped at NUM_SPRITES.
+void setup_village_scene(int num_extra_sprites);
+
+// Enable sprite `sprite_idx` at map position `x`, `y` showing frame `frame_idx` of the sprite
+// sheet in the current pixel format. Call `set_village_scroll` afterwards to index it.
+void place_village_sprite(int sprite_idx, int x, int y, int frame_idx);
+
+// Pointer to the RGB555 image data of a sprite from `sprite_data.h`, the number of sprite images
+// and their height
+const uint16_t* village_sprite_ptr(int sprite_idx);
+int village_num_sprite_images();
+int village_sprite_height();
+
+// Build the opaque spans for all of the sprite data in the current pixel format,
+// `setup_village_scene` does this. Use `free_sprite_spans` to draw sprites without spans.
+bool build_village_sprite_spans();
+
+// Build the shifted tileset for `village_tilemap` and the tilemap layer drawing it,
+// `setup_village_scene` does this.
+bool build_village_shifted_tileset();
+
+// Build tile row caches for `village_tilemap` and the tilemap layer drawing it (see
+// `build_tile_row_caches`), the scene has none unless this is called after `setup_village_scene`
+bool build_village_tile_row_caches(int num_caches, int num_entries);
+void free_village_tile_row_caches();
+
+// Draw `village_tilemap` and the tilemap layer drawing it from the compressed tileset (from
+// `village_tileset_lz.h` or `village_tileset_8bpp_lz.h`) through tile decode caches (see
+// `build_tile_decode_caches`). Only RGB555 and 8bpp tilesets are compressed, returns false for
+// the other formats or if the caches couldn't be allocated. While the caches are built the
+// uncompressed and shifted tilesets are dropped, freeing the caches brings them back.
+bool build_village_tile_decode_caches(int num_caches, int num_entries);
+void free_village_tile_decode_caches();
+
+// Largest X and Y scroll the demo reaches when bouncing around the map
+int village_max_x_scroll();
+int village_max_y_scroll();
+
+// Set tilemap and sprite scroll together and rebuild the sprite line index as `end_of_frame` in
+// `pio_vga_fifth.c` does
+void set_village_scroll(int x_scroll, int y_scroll);
+
+// Draw a scanline of the scene, identical to `draw_line` in `pio_vga_fifth.c`
+void draw_village_line(int line_y, uint16_t* line_buffer);
+// Draw a scanline of the scene into an RGB332 line buffer, as `draw_line` in `pio_vga_fifth.c`
+// does with USE_RGB332_OUTPUT
+void draw_village_line_rgb332(int line_y, uint8_t* line_buffer);
+
+#endif
@@ -0,0 +1,197 @@
+#include <math.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_util.h"
+#include "render_threads.h"
+#include "virtual_display.h"
+
+static bool line_raises_irq(const uint32_t* words) {
+    for(int i = 0;i < SYNC_WORDS_PER_LINE; ++i) {
+        if ((words[i] >> 16) == SYNC_EXEC_LINE_IRQ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Find the drawn pixel shown in each column of the visible area, from where the active line's
+// command words raise the line IRQ and the line program's timing
+static void map_columns(virtual_display_t* display) {
+    const video_timing_t* timing = display->timing;
+    const video_mode_t* mode = timing->mode;
+    const uint32_t* words = timing->words[kSyncLineActive];
+    double cycles_per_clock = (double)timing->sys_clock_hz / mode->pixel_clock_hz;
+    int line_cycles = 0;
+    int irq_start = 0;
+
+    for(int i = 0;i < SYNC_WORDS_PER_LINE; ++i) {
+        if ((words[i] >> 16) == SYNC_EXEC_LINE_IRQ) {
+            irq_start = line_cycles;
+        }
+
+        line_cycles += ((words[i] >> 2) & SYNC_COMMAND_MAX_DELAY) + SYNC_COMMAND_CYCLES;
+    }
+
+    double visible_start = (mode->h_sync + mode->h_back_porch) * cycles_per_clock;
+    double pixel_start = irq_start + LINE_PROGRAM_LEAD_CYCLES;
+
+    // Each column shows the pixel being output at its centre
+    for(int x = 0;x < display->width; ++x) {
+        double cycle = visible_start + (x + 0.5) * cycles_per_clock;
+        double pixel = floor((cycle - pixel_start) / timing->pixel_cycles);
+
+        display->column_pixels[x] = (pixel >= 0 && pixel < mode->width) ? (int)pixel : -1;
+    }
+}
+
+// Request the line jobs needed as `display_line` begins, as `request_lines`
+static void request_lines(virtual_display_t* display, int display_line) {
+    int num_requests = line_dispatch_requests_at(display_line, -VIDEO_DUMMY_LINES,
+        display->num_line_buffers, SCREEN_HEIGHT, display->timing->mode->line_repeat);
+
+    if (num_requests) {
+        for(int i = 0;i < num_requests; ++i) {
+            line_dispatch_request(display->dispatch);
+        }
+
+        render_threads_notify();
+    }
+}
+
+bool virtual_display_init(virtual_display_t* display, const video_timing_t* timing,
+    line_dispatch_t* dispatch, uint16_t (*line_buffers)[SCREEN_WIDTH], int num_line_buffers) {
+
+    const video_mode_t* mode = timing->mode;
+
+    display->timing = timing;
+    display->dispatch = dispatch;
+    display->line_buffers = line_buffers;
+    display->num_line_buffers = num_line_buffers;
+    // Keep the start of the output word aligned for the line DMA, 2 RGB555 pixels per word
+    display->line_data_offset = ((SCREEN_WIDTH - mode->width) / 2) & ~1;
+
+    display->current_display_line = -VIDEO_DUMMY_LINES;
+    display->line_read = NULL;
+
+    display->line_words = timing_line_start(&display->line_state, timing);
+    display->frame_line = 0;
+    display->frame_lines = mode->v_sync + mode->v_back_porch + mode->v_visible +
+        mode->v_front_porch;
+    display->first_visible_line = mode->v_sync + mode->v_back_porch;
+
+    display->width = mode->h_visible;
+    display->height = mode->v_visible;
+    display->column_pixels = malloc(display->width * sizeof(int16_t));
+    display->frame = calloc(display->width * display->height, sizeof(uint16_t));
+    if (!display->column_pixels || !display->frame) {
+        virtual_display_free(display);
+        return false;
+    }
+
+    map_columns(display);
+
+    display->num_frames = 0;
+    display->num_changed_repeats = 0;
+
+    request_lines(display, display->current_display_line);
+
+    return true;
+}
+
+void virtual_display_free(virtual_display_t* display) {
+    free(display->column_pixels);
+    free(display->frame);
+    display->column_pixels = NULL;
+    display->frame = NULL;
+}
+
+// The line DMA has sent a line, set up the next as `dma_irh` does
+static void line_dma_interrupt(virtual_display_t* display) {
+    const video_timing_t* timing = display->timing;
+    int line_repeat = timing->mode->line_repeat;
+
+    if (display->current_display_line == timing->display_lines - 1) {
+        // Final line of this frame has completed so signal new frame and setup for next
+        line_dispatch_frame_output(display->dispatch);
+        render_threads_new_frame();
+
+        display->current_display_line = -VIDEO_DUMMY_LINES;
+        request_lines(display, display->current_display_line);
+        display->line_read = NULL;
+        return;
+    }
+
+    display->current_display_line++;
+    request_lines(display, display->current_display_line);
+
+    int line = display->current_display_line / line_repeat;
+
+    if (display->current_display_line < 0) {
+        display->line_read = NULL;
+        return;
+    }
+
+    if (display->current_display_line == line * line_repeat) {
+        // The render threads run at the host's pace so wait for the line rather than underrun
+        while (!line_dispatch_line_drawn(display->dispatch, display->dispatch->output_frame,
+            line)) {
+            sched_yield();
+        }
+
+        line_dispatch_line_output(display->dispatch, line);
+    }
+
+    display->line_read = display->line_buffers[line % display->num_line_buffers] +
+        display->line_data_offset;
+}
+
+// Output the current VGA line onto the frame then step the line state machine
+static void output_line(virtual_display_t* display) {
+    const video_mode_t* mode = display->timing->mode;
+    bool line_irq = line_raises_irq(display->line_words);
+    const uint16_t* pixels = line_irq ? display->line_read : NULL;
+    int row = display->frame_line - display->first_visible_line;
+
+    if (row >= 0 && row < display->height) {
+        uint16_t* out = display->frame + row * display->width;
+
+        for(int x = 0;x < display->width; ++x) {
+            int pixel = display->column_pixels[x];
+            out[x] = (pixels && pixel >= 0) ? pixels[pixel] : 0;
+        }
+    }
+
+    if (pixels) {
+        // Each line is read from its buffer `line_repeat` times, it mustn't change in between
+        size_t line_bytes = mode->width * sizeof(uint16_t);
+
+        if ((display->current_display_line % mode->line_repeat) == 0) {
+            memcpy(display->repeat_check, pixels, line_bytes);
+        } else if (memcmp(display->repeat_check, pixels, line_bytes) != 0) {
+            ++display->num_changed_repeats;
+        }
+    }
+
+    if (line_irq) {
+        line_dma_interrupt(display);
+    }
+
+    display->line_words = timing_line_next(&display->line_state);
+    if (++display->frame_line == display->frame_lines) {
+        display->frame_line = 0;
+    }
+}
+
+void virtual_display_output_frame(virtual_display_t* display) {
+    do {
+        output_line(display);
+    } while (display->frame_line != 0);
+
+    ++display->num_frames;
+}
+
+bool virtual_display_write_ppm(const virtual_display_t* display, const char* path) {
+    return bench_write_ppm(path, display->frame, display->width, display->height);
+}
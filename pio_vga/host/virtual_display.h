@@ -0,0 +1,70 @@
+#ifndef __VIRTUAL_DISPLAY_H__
+#define __VIRTUAL_DISPLAY_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pio_vga_line_dispatch.h"
+#include "pio_vga_render.h"
+#include "pio_vga_video_mode.h"
+
+// Host stand in for the PIO programs, line DMA and monitor of `pio_vga_fifth.c`. Every VGA line
+// of a frame is stepped through with the timing line state machine, and the sync command words of
+// each line are decoded to find where the line IRQ starts the line program. The pixels the line
+// DMA would send are sampled onto the mode's visible area as a monitor would show them, so borders,
+// centring, pixel and line repeats all appear in the captured frame.
+//
+// As each line's pixels finish the line DMA interrupt is run, following `dma_irh`: it steps the
+// display line, requests line jobs from the dispatcher with `line_dispatch_requests_at` (waking
+// the render threads, see `render_threads.h`), signals the new frame and picks the next line
+// buffer to read. The host render threads can't keep to the Pico's timing so the interrupt waits
+// for a line to be drawn before its buffer is read rather than counting an underrun.
+
+typedef struct {
+    const video_timing_t* timing;
+    line_dispatch_t* dispatch;
+    uint16_t (*line_buffers)[SCREEN_WIDTH];
+    int num_line_buffers;
+    // Pixel of each line buffer the output begins from, as `line_data_offset`
+    int line_data_offset;
+
+    // Line DMA interrupt state, as `dma_irh`. `line_read` is NULL while outputting the zero buffer.
+    int current_display_line;
+    const uint16_t* line_read;
+
+    // Line state machine and the line of the frame it's on, from the start of the vsync pulse
+    timing_line_state_t line_state;
+    const uint32_t* line_words;
+    int frame_line;
+    int frame_lines;
+    int first_visible_line;
+
+    // Drawn pixel shown in each column of the visible area, -1 for the border
+    int16_t* column_pixels;
+
+    // The frame being captured, `width` x `height` RGB555 pixels (the mode's visible area)
+    uint16_t* frame;
+    int width;
+    int height;
+
+    // Frames completed so far
+    uint32_t num_frames;
+    // Lines whose buffer changed between the first and a repeated output of the line
+    uint32_t num_changed_repeats;
+    // Pixels of the latest line's first output, to check repeats against
+    uint16_t repeat_check[SCREEN_WIDTH];
+} virtual_display_t;
+
+// Setup a display for `timing` reading lines drawn by the render threads into `line_buffers` (a
+// ring of `num_line_buffers`) for `dispatch`. Requests the first lines of the first frame as
+// `setup_video` does, start the render threads after this. Returns false if out of memory.
+bool virtual_display_init(virtual_display_t* display, const video_timing_t* timing,
+    line_dispatch_t* dispatch, uint16_t (*line_buffers)[SCREEN_WIDTH], int num_line_buffers);
+void virtual_display_free(virtual_display_t* display);
+
+// Output VGA lines until a whole frame, from the start of its vsync pulse, is in `display->frame`
+void virtual_display_output_frame(virtual_display_t* display);
+
+// Write the captured frame as a binary PPM, returns false if the file couldn't be written
+bool virtual_display_write_ppm(const virtual_display_t* display, const char* path);
+
+#endif
@@ -0,0 +1,125 @@
+import argparse
+import csv
+import sys
+
+# Builds a large chunked map (see `pio_vga_tilemap_stream.h`) from the village map in
+# `test_map.csv` and writes it to `village_chunked_map.h`. Doesn't need Pillow.
+#
+# The map is made of blocks of BLOCK_TILES x BLOCK_TILES tiles, each the village placed at one of a
+# few offsets on a background of tile 0, the offset picked pseudo-randomly per block. The map is
+# split into chunks of `--chunk` tiles square and chunks with the same tiles are only stored once,
+# the chunk index giving the stored chunk at each chunk position. With the block size a multiple of
+# the chunk size a map of any size needs only a few stored chunks.
+
+BLOCK_TILES = 32
+VILLAGE_OFFSETS = [(0, 0), (4, 0), (0, 5), (4, 5)]
+
+
+def load_tilemap_csv(csv_filename):
+    with open(csv_filename) as csv_file:
+        rows = [[int(tile_num) for tile_num in row] for row in csv.reader(csv_file)]
+
+    return {'width': len(rows[0]), 'height': len(rows), 'rows': rows}
+
+
+def build_block(village, offset):
+    block = [[0] * BLOCK_TILES for _ in range(BLOCK_TILES)]
+
+    for y in range(village['height']):
+        for x in range(village['width']):
+            block_x = x + offset[0]
+            block_y = y + offset[1]
+
+            if block_x < BLOCK_TILES and block_y < BLOCK_TILES:
+                block[block_y][block_x] = village['rows'][y][x]
+
+    return block
+
+
+def build_map(village, width, height):
+    blocks = [build_block(village, offset) for offset in VILLAGE_OFFSETS]
+    rand_state = 0x1234567
+    block_variants = {}
+
+    def tile_at(x, y):
+        nonlocal rand_state
+        block_pos = (x // BLOCK_TILES, y // BLOCK_TILES)
+
+        if block_pos not in block_variants:
+            rand_state = (rand_state * 1664525 + 1013904223) & 0xffffffff
+            block_variants[block_pos] = (rand_state >> 16) % len(blocks)
+
+        return blocks[block_variants[block_pos]][y % BLOCK_TILES][x % BLOCK_TILES]
+
+    return [[tile_at(x, y) for x in range(width)] for y in range(height)]
+
+
+def chunk_map(tile_rows, chunk_tiles):
+    width_chunks = len(tile_rows[0]) // chunk_tiles
+    height_chunks = len(tile_rows) // chunk_tiles
+    chunks = []
+    chunk_nums = {}
+    index = []
+
+    for chunk_y in range(height_chunks):
+        for chunk_x in range(width_chunks):
+            chunk = tuple(tile_rows[chunk_y * chunk_tiles + y][chunk_x * chunk_tiles + x]
+                for y in range(chunk_tiles) for x in range(chunk_tiles))
+
+            if chunk not in chunk_nums:
+                chunk_nums[chunk] = len(chunks)
+                chunks.append(chunk)
+
+            index.append(chunk_nums[chunk])
+
+    return width_chunks, height_chunks, chunks, index
+
+
+def write_values(c_header_file, values, per_line):
+    for i in range(0, len(values), per_line):
+        c_header_file.write('  ' + ', '.join(f'{value}' for value in values[i:i + per_line]) +
+            ',\n')
+
+
+def chunked_map_to_c_header(width_chunks, height_chunks, chunk_tiles, chunks, index,
+    c_header_filename):
+
+    with open(c_header_filename, 'w') as c_header_file:
+        c_header_file.write(f'int village_map_width_chunks = {width_chunks};\n')
+        c_header_file.write(f'int village_map_height_chunks = {height_chunks};\n')
+        c_header_file.write(f'int village_map_chunk_tiles = {chunk_tiles};\n')
+        c_header_file.write(f'int village_map_num_chunks = {len(chunks)};\n\n')
+
+        c_header_file.write('const uint16_t village_map_chunk_index[] = {\n')
+        write_values(c_header_file, index, width_chunks)
+        c_header_file.write('};\n\n')
+
+        c_header_file.write('const uint16_t village_map_chunks[] = {\n')
+        for chunk in chunks:
+            write_values(c_header_file, list(chunk), chunk_tiles)
+        c_header_file.write('};\n')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Build a large chunked map from the village map')
+    parser.add_argument('--width', type=int, default=1024, help='Map width in tiles')
+    parser.add_argument('--height', type=int, default=1024, help='Map height in tiles')
+    parser.add_argument('--chunk', type=int, default=16,
+        help='Chunk width and height in tiles, a power of two dividing the block size')
+    args = parser.parse_args()
+
+    if (args.chunk & (args.chunk - 1)) or BLOCK_TILES % args.chunk or \
+        args.width % args.chunk or args.height % args.chunk:
+        print(f'Error chunk size must be a power of two dividing {BLOCK_TILES} and the map size')
+        sys.exit(1)
+
+    village = load_tilemap_csv('test_map.csv')
+    tile_rows = build_map(village, args.width, args.height)
+    width_chunks, height_chunks, chunks, index = chunk_map(tile_rows, args.chunk)
+
+    print(f'{args.width} x {args.height} tiles, {width_chunks} x {height_chunks} chunks, '
+        f'{len(chunks)} stored')
+    chunked_map_to_c_header(width_chunks, height_chunks, args.chunk, chunks, index,
+        'village_chunked_map.h')
+
+    sys.exit(0)
@@ -0,0 +1,137 @@
+import argparse
+import sys
+from palette_data import read_rgb555_c_header, write_c_array
+
+# Compresses the tilesets in `village_tileset.h` (RGB555) and `village_tileset_8bpp.h` a tile at a
+# time into `village_tileset_lz.h` and `village_tileset_8bpp_lz.h`, decoded by
+# `decode_compressed_tile` in `pio_vga_render.c`. Doesn't need Pillow.
+#
+# Tiles are compressed as a sequence of units, a pixel for RGB555 and 8bpp (a pair of pixels for
+# 4bpp). Each op is a token byte, the top two bits the op and the low six the number of units
+# less one:
+#  - Literal: the units follow
+#  - Fill: the unit that follows repeated
+#  - Copy the row above: the units a tile row back, pixel art tiles often repeat a row or part of
+#    one
+#  - Copy back: the units a number of units back, given less one by the byte that follows
+#
+# A copy may overlap the units it writes, repeating a short pattern. The encoder is greedy, taking
+# whichever op saves the most bytes at each unit.
+
+TILE_WIDTH = 16
+TILE_HEIGHT = 16
+
+OP_LITERAL = 0x00
+OP_FILL = 0x40
+OP_COPY_ROW_ABOVE = 0x80
+OP_COPY_BACK = 0xc0
+
+MAX_OP_UNITS = 64
+MAX_COPY_OFFSET = 256
+
+
+def match_length(units, pos, offset):
+    length = 0
+    while pos + length < len(units) and length < MAX_OP_UNITS and \
+        units[pos + length] == units[pos + length - offset]:
+        length += 1
+
+    return length
+
+
+def compress_tile(units, unit_bytes, row_units):
+    out = []
+    literals = []
+
+    def unit_to_bytes(unit):
+        return [(unit >> (8 * i)) & 0xff for i in range(unit_bytes)]
+
+    def flush_literals():
+        for i in range(0, len(literals), MAX_OP_UNITS):
+            run = literals[i:i + MAX_OP_UNITS]
+            out.append(OP_LITERAL | (len(run) - 1))
+            for unit in run:
+                out.extend(unit_to_bytes(unit))
+        literals.clear()
+
+    pos = 0
+    while pos < len(units):
+        # The bytes each op would save over writing its units as literals
+        fill_length = match_length(units, pos + 1, 1) + 1 if pos + 1 < len(units) else 1
+        fill_length = min(fill_length, MAX_OP_UNITS)
+        best = (fill_length * unit_bytes - (1 + unit_bytes), OP_FILL, fill_length, 0)
+
+        if pos >= row_units:
+            length = match_length(units, pos, row_units)
+            best = max(best, (length * unit_bytes - 1, OP_COPY_ROW_ABOVE, length, 0))
+
+        for offset in range(1, min(pos, MAX_COPY_OFFSET) + 1):
+            length = match_length(units, pos, offset)
+            best = max(best, (length * unit_bytes - 2, OP_COPY_BACK, length, offset))
+
+        saving, op, length, offset = best
+        if saving <= 0:
+            literals.append(units[pos])
+            pos += 1
+            continue
+
+        flush_literals()
+        out.append(op | (length - 1))
+
+        if op == OP_FILL:
+            out.extend(unit_to_bytes(units[pos]))
+        elif op == OP_COPY_BACK:
+            out.append(offset - 1)
+
+        pos += length
+
+    flush_literals()
+
+    return out
+
+
+def compress_tileset(pixels, pixel_bytes):
+    # Returns the compressed data and the offset of each tile's data, plus one for the end
+    tile_pixels = TILE_WIDTH * TILE_HEIGHT
+    data = []
+    offsets = []
+
+    for tile in range(0, len(pixels), tile_pixels):
+        offsets.append(len(data))
+        data.extend(compress_tile(pixels[tile:tile + tile_pixels], pixel_bytes, TILE_WIDTH))
+
+    offsets.append(len(data))
+
+    return data, offsets
+
+
+def write_compressed_c_header(c_header_filename, name, preamble, data, offsets):
+    with open(c_header_filename, 'w') as c_header_file:
+        c_header_file.write(preamble + '\n')
+        c_header_file.write(f'int {name}_count = {len(offsets) - 1};\n')
+        c_header_file.write(f'int {name}_bytes = {len(data)};\n\n')
+        write_c_array(c_header_file, 'uint32_t', f'{name}_offsets', offsets, 8, 8)
+        c_header_file.write('\n')
+        write_c_array(c_header_file, 'uint8_t', f'{name}_data', data)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description='Compress the RGB555 and 8bpp village tilesets a tile at a time')
+    parser.parse_args()
+
+    for header, array_name, pixel_bytes, name in [
+        ('village_tileset', 'tileset', 2, 'tileset_lz'),
+        ('village_tileset_8bpp', 'tileset_8bpp_data', 1, 'tileset_8bpp_lz')]:
+
+        preamble, pixels = read_rgb555_c_header(f'{header}.h', array_name)
+        data, offsets = compress_tileset(pixels, pixel_bytes)
+        write_compressed_c_header(f'{header}_lz.h', name, preamble, data, offsets)
+
+        raw_bytes = len(pixels) * pixel_bytes
+        compressed_bytes = len(data) + len(offsets) * 4
+        print(f'{header}.h: {raw_bytes} bytes compressed to {compressed_bytes} '
+            f'({len(data)} data, {len(offsets) * 4} offsets), ratio '
+            f'{raw_bytes / compressed_bytes:.2f}')
+
+    sys.exit(0)
@@ -1,4 +1,6 @@
+import argparse
 from PIL import Image
+import palette_data
 
 def load_spritesheet(spritesheet_image_filename, sprite_width, sprite_height):
     spritesheet_image = Image.open(spritesheet_image_filename)
@@ -40,7 +42,7 @@ def spritesheet_to_c_header(spritesheet, c_header_filename, name):
     num_sprites = spritesheet['width'] * spritesheet['height']
     c_header_file.write(f'int num_{name} = {num_sprites};\n')
     c_header_file.write(f'int {name}_height = {spritesheet["sprite_height"]};\n\n')
-    c_header_file.write(f'uint16_t {name}_data[] = {{\n')
+    c_header_file.write(f'const uint16_t {name}_data[] = {{\n')
 
     for sprite in range(num_sprites):
         sprite_image = get_sprite_image(sprite, spritesheet)
@@ -49,7 +51,30 @@ def spritesheet_to_c_header(spritesheet, c_header_filename, name):
     c_header_file.write('};')
     c_header_file.close()
 
+def spritesheet_to_indexed_c_headers(spritesheet, c_header_prefix, name, mirror_tolerance=None):
+    num_sprites = spritesheet['width'] * spritesheet['height']
+    sprite_images = []
+
+    for sprite in range(num_sprites):
+        sprite_image = get_sprite_image(sprite, spritesheet)
+        sprite_images.append([rgb_to_rgb555(sprite_image.getpixel((x, y))[:3])
+            for y in range(sprite_image.height) for x in range(sprite_image.width)])
+
+    palette_data.write_indexed_c_headers(sprite_images, name, c_header_prefix,
+        palette_data.TRANSPARENT_RGB555,
+        extra_defs=f'int {name}_{{fmt}}_height = {spritesheet["sprite_height"]};\n',
+        frame_width=spritesheet['sprite_width'], mirror_tolerance=mirror_tolerance)
+
 # Read in 16x18 sprites from 'char_sheet.png' and write them out to
-# 'sprite_data.h' for direct use in a C program
+# 'sprite_data.h' for direct use in a C program, along with indexed versions in
+# 'sprite_data_8bpp.h' and 'sprite_data_4bpp.h'. With '--drop-mirrored' the
+# indexed versions leave out frames that mirror earlier ones, the left walk
+# frames are mirrors of the right ones.
+parser = argparse.ArgumentParser(description='Generate sprite data headers from char_sheet.png')
+palette_data.add_mirror_args(parser)
+args = parser.parse_args()
+
 test_spritesheet = load_spritesheet('char_sheet.png', 16, 18)
 spritesheet_to_c_header(test_spritesheet, 'sprite_data.h', 'sprite')
+spritesheet_to_indexed_c_headers(test_spritesheet, 'sprite_data', 'sprite',
+    palette_data.mirror_tolerance_arg(args))
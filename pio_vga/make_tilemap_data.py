@@ -1,6 +1,7 @@
 import csv
 from PIL import Image
 from PIL import ImageShow
+import palette_data
 
 TILE_WIDTH = 16
 TILE_HEIGHT = 16
@@ -75,12 +76,23 @@ def write_tile_image_to_c_header(tile_image, c_header_file):
             pix_rgb555 = rgb_to_rgb555(pix_rgb)
             c_header_file.write(f'  0x{pix_rgb555:04x},\n')
 
+def tile_image_to_rgb555(tile_image):
+    return [rgb_to_rgb555(tile_image.getpixel((x, y))[:3]) for y in range(TILE_HEIGHT)
+        for x in range(TILE_WIDTH)]
+
+def tileset_to_indexed_c_headers(tileset, c_header_prefix):
+    num_tiles = tileset['width'] * tileset['height']
+    tile_images = [tile_image_to_rgb555(get_tile_image(tile, tileset)) for tile in
+        range(num_tiles)]
+    palette_data.write_indexed_c_headers(tile_images, 'tileset', c_header_prefix)
+
 def tileset_to_c_header(tileset, c_header_filename):
     c_header_file = open(c_header_filename, 'w')
 
     num_tiles = tileset['width'] * tileset['height']
     c_header_file.write(f'int num_tiles = {num_tiles};\n\n')
-    c_header_file.write('uint16_t tileset[] = {\n')
+    # Aligned so tile rows can be copied as 32-bit words
+    c_header_file.write('const uint16_t __attribute__ ((aligned (4))) tileset[] = {\n')
 
     for tile in range(num_tiles):
         tile_image = get_tile_image(tile, tileset)
@@ -94,7 +106,7 @@ def tilemap_to_c_header(tilemap, c_header_filename):
 
     c_header_file.write(f"int tilemap_width = {tilemap['width']};\n")
     c_header_file.write(f"int tilemap_height = {tilemap['height']};\n")
-    c_header_file.write("uint8_t tilemap_tiles = {\n")
+    c_header_file.write("const uint16_t tilemap_tiles[] = {\n")
 
     for tile in tilemap['tiles']:
         c_header_file.write(f"  {tile},\n")
@@ -103,12 +115,14 @@ def tilemap_to_c_header(tilemap, c_header_filename):
 
 # Load tilemap from 'test_map.csv' and tileset from 'village-tiles.png'. Write
 # the data from both out to 'test_tilemap.h' and 'village_tileset.h'
-# respectively for direct using in a C program. A map preview is drawn to
-# 'map-render.png'
+# respectively for direct using in a C program, along with indexed versions of
+# the tileset in 'village_tileset_8bpp.h' and 'village_tileset_4bpp.h'. A map
+# preview is drawn to 'map-render.png'
 test_tilemap = load_tilemap_csv('test_map.csv')
 village_tileset = load_tileset('village_tiles.png')
 map_image = render_tilemap(test_tilemap, village_tileset)
 print(f"{test_tilemap['width']} x {test_tilemap['height']}")
 tileset_to_c_header(village_tileset, 'village_tileset.h')
+tileset_to_indexed_c_headers(village_tileset, 'village_tileset')
 tilemap_to_c_header(test_tilemap, 'test_tilemap.h')
 map_image.save('map_render.png')
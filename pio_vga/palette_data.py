@@ -0,0 +1,315 @@
+import argparse
+import re
+import sys
+
+# Conversion of RGB555 images (tiles or sprite frames, given as lists of RGB555 pixel values) to
+# the indexed formats drawn by `pio_vga_render.c`, used by `make_tilemap_data.py` and
+# `make_sprite_data.py`. Doesn't need Pillow so when run directly it converts the existing RGB555
+# headers `village_tileset.h` and `sprite_data.h` to their indexed versions.
+#
+# 8bpp images share a single palette of up to 256 colours with one byte per pixel.
+#
+# 4bpp images have two pixels per byte (the leftmost in the low nibble) and each one uses a bank
+# of 16 colours from a palette of up to 32 banks. Images are packed into banks sharing as many
+# colours as possible. An image with too many colours to fit in a bank has its least used colours
+# replaced with the nearest remaining colour, so 4bpp conversion can be lossy.
+#
+# Sprites reserve index 0 (of every bank for 4bpp) for the transparent colour.
+#
+# RGB332 images aren't indexed, every pixel is converted to one byte (red in bits 0 - 2, green in
+# bits 3 - 5 and blue in bits 6 - 7) as `rgb555_to_rgb332` in `pio_vga_render.h` converts it. The
+# transparent colour becomes TRANSPARENT_RGB332 and any other colour converting to that is moved
+# to the neighbouring green.
+#
+# Sprite headers also get a frame table, `<name>_<fmt>_frames`, giving the image drawn for each
+# frame of the sheet. Bits 0 - 13 of an entry are the image index, bit 14 flips the image
+# horizontally and bit 15 vertically (`SPRITE_FRAME_` in `pio_vga_render.h`). With
+# `--drop-mirrored` any frame that repeats or mirrors an earlier one isn't stored, its table entry
+# flips the earlier image instead. `--mirror-tolerance` lets frames differing from a flipped
+# earlier frame in up to that many pixels be dropped as well, which changes those pixels.
+
+TRANSPARENT_RGB555 = 0x7c1f
+TRANSPARENT_RGB332 = 0xc7
+
+BANK_COLOURS = 16
+MAX_BANKS = 32
+
+FRAME_FLIP_X = 0x4000
+FRAME_FLIP_Y = 0x8000
+
+
+def rgb555_distance(a, b):
+    return sum((((a >> shift) & 0x1f) - ((b >> shift) & 0x1f)) ** 2 for shift in (0, 5, 10))
+
+
+def rgb555_to_rgb332(colour):
+    red = ((colour & 0x1f) * 7 + 15) // 31
+    green = (((colour >> 5) & 0x1f) * 7 + 15) // 31
+    blue = (((colour >> 10) & 0x1f) * 3 + 15) // 31
+    rgb332 = red | (green << 3) | (blue << 6)
+
+    if rgb332 == TRANSPARENT_RGB332 and colour != TRANSPARENT_RGB555:
+        rgb332 ^= 1 << 3
+
+    return rgb332
+
+
+def nearest_colour(colour, colours):
+    return min(colours, key=lambda c: rgb555_distance(colour, c))
+
+
+def to_8bpp(images, reserved_colour=None):
+    palette = [] if reserved_colour is None else [reserved_colour]
+    palette_index = {colour: index for index, colour in enumerate(palette)}
+    indexed_images = []
+
+    for image in images:
+        indexed = []
+        for pixel in image:
+            if pixel not in palette_index:
+                palette_index[pixel] = len(palette)
+                palette.append(pixel)
+            indexed.append(palette_index[pixel])
+
+        indexed_images.append(indexed)
+
+    if len(palette) > 256:
+        print(f'Error {len(palette)} colours, 8bpp supports at most 256')
+        return None
+
+    return {'palette': palette, 'images': indexed_images}
+
+
+def reduce_colours(image, max_colours, reserved_colour):
+    # Replace the least used colours of an image with their nearest remaining colour until it has
+    # at most `max_colours` colours other than `reserved_colour`. Returns the new image and the
+    # number of pixels changed.
+    counts = {}
+    for pixel in image:
+        counts[pixel] = counts.get(pixel, 0) + 1
+
+    others = sorted((c for c in counts if c != reserved_colour), key=lambda c: -counts[c])
+    keep = others[:max_colours]
+    replacements = {c: nearest_colour(c, keep) for c in others[max_colours:]}
+
+    return ([replacements.get(pixel, pixel) for pixel in image],
+        sum(counts[c] for c in replacements))
+
+
+def to_4bpp(images, reserved_colour=None):
+    banks = []
+    image_banks = [0] * len(images)
+    images = list(images)
+    num_changed = 0
+
+    # Place the images with the most colours first, each into the bank it adds fewest colours to
+    order = sorted(range(len(images)), key=lambda i: -len(set(images[i])))
+    for image_idx in order:
+        image, changed = reduce_colours(images[image_idx],
+            BANK_COLOURS - (reserved_colour is not None), reserved_colour)
+        num_changed += changed
+        colours = set(image)
+
+        fits = [b for b in range(len(banks)) if len(banks[b] | colours) <= BANK_COLOURS]
+        if fits:
+            bank = min(fits, key=lambda b: len(banks[b] | colours) - len(banks[b]))
+        elif len(banks) < MAX_BANKS:
+            bank = len(banks)
+            banks.append(set() if reserved_colour is None else {reserved_colour})
+        else:
+            # Out of banks, use the bank sharing the most colours and map the rest onto it
+            bank = max(range(len(banks)), key=lambda b: len(banks[b] & colours))
+            bank_colours = list(banks[bank])
+            mapped = [p if p in banks[bank] else nearest_colour(p, bank_colours) for p in image]
+            num_changed += sum(1 for a, b in zip(image, mapped) if a != b)
+            image = mapped
+            colours = set(image)
+
+        banks[bank] |= colours
+        images[image_idx] = image
+        image_banks[image_idx] = bank
+
+    # Order each bank's colours with any reserved colour first, then pad it to a full bank
+    bank_palettes = []
+    for bank in banks:
+        colours = sorted(bank, key=lambda c: (c != reserved_colour, c))
+        bank_palettes.append(colours + [0] * (BANK_COLOURS - len(colours)))
+
+    packed_images = []
+    for image, bank in zip(images, image_banks):
+        index = {colour: i for i, colour in enumerate(bank_palettes[bank])}
+        packed_images.append([index[image[i]] | (index[image[i + 1]] << 4)
+            for i in range(0, len(image), 2)])
+
+    return {'palette': [c for bank in bank_palettes for c in bank], 'num_banks': len(banks),
+            'image_banks': image_banks, 'images': packed_images, 'num_changed': num_changed}
+
+
+def flip_image(image, width, flip_x, flip_y):
+    height = len(image) // width
+    return [image[(height - 1 - y if flip_y else y) * width + (width - 1 - x if flip_x else x)]
+        for y in range(height) for x in range(width)]
+
+
+def drop_mirrored_images(images, width, tolerance=0):
+    # Find the images that repeat or mirror an earlier image, differing in at most `tolerance`
+    # pixels. Returns the remaining images, a frame table entry for every original image and the
+    # number of pixels changed by dropping images that didn't match exactly.
+    kept = []
+    frames = []
+    num_changed = 0
+
+    for image in images:
+        best = None
+        for kept_idx, kept_image in enumerate(kept):
+            for flags in (0, FRAME_FLIP_X, FRAME_FLIP_Y, FRAME_FLIP_X | FRAME_FLIP_Y):
+                flipped = flip_image(kept_image, width, flags & FRAME_FLIP_X,
+                    flags & FRAME_FLIP_Y)
+                diff = sum(1 for a, b in zip(image, flipped) if a != b)
+                if diff <= tolerance and (best is None or diff < best[0]):
+                    best = (diff, kept_idx | flags)
+
+        if best is None:
+            frames.append(len(kept))
+            kept.append(image)
+        else:
+            frames.append(best[1])
+            num_changed += best[0]
+
+    return kept, frames, num_changed
+
+
+def write_c_array(c_header_file, c_type, name, values, per_line=16, digits=2):
+    c_header_file.write(f'const {c_type} {name}[] = {{\n')
+    for i in range(0, len(values), per_line):
+        line = ', '.join(f'0x{v:0{digits}x}' for v in values[i:i + per_line])
+        c_header_file.write(f'  {line},\n')
+    c_header_file.write('};\n')
+
+
+def write_frame_table(c_header_file, name, fmt, frames):
+    if frames is None:
+        return
+
+    c_header_file.write(f'int {name}_{fmt}_num_frames = {len(frames)};\n')
+    write_c_array(c_header_file, 'uint16_t', f'{name}_{fmt}_frames', frames, 8, 4)
+    c_header_file.write('\n')
+
+
+def write_8bpp_c_header(c_header_filename, name, data, preamble='', extra_defs='', frames=None):
+    c_header_file = open(c_header_filename, 'w')
+    c_header_file.write(preamble)
+    c_header_file.write(f'int {name}_8bpp_count = {len(data["images"])};\n')
+    c_header_file.write(extra_defs.format(fmt='8bpp'))
+    c_header_file.write(f'int {name}_8bpp_num_colours = {len(data["palette"])};\n\n')
+    write_c_array(c_header_file, 'uint16_t', f'{name}_8bpp_palette', data['palette'], 8, 4)
+    c_header_file.write('\n')
+    write_frame_table(c_header_file, name, '8bpp', frames)
+    write_c_array(c_header_file, 'uint8_t __attribute__ ((aligned (4)))', f'{name}_8bpp_data',
+        [p for image in data['images'] for p in image])
+    c_header_file.close()
+
+
+def write_4bpp_c_header(c_header_filename, name, data, preamble='', extra_defs='', frames=None):
+    c_header_file = open(c_header_filename, 'w')
+    c_header_file.write(preamble)
+    c_header_file.write(f'int {name}_4bpp_count = {len(data["images"])};\n')
+    c_header_file.write(extra_defs.format(fmt='4bpp'))
+    c_header_file.write(f'int {name}_4bpp_num_banks = {data["num_banks"]};\n\n')
+    write_c_array(c_header_file, 'uint16_t', f'{name}_4bpp_palette', data['palette'], 8, 4)
+    c_header_file.write('\n')
+    write_c_array(c_header_file, 'uint8_t', f'{name}_4bpp_banks', data['image_banks'])
+    c_header_file.write('\n')
+    write_frame_table(c_header_file, name, '4bpp', frames)
+    write_c_array(c_header_file, 'uint8_t __attribute__ ((aligned (4)))', f'{name}_4bpp_data',
+        [p for image in data['images'] for p in image])
+    c_header_file.close()
+
+
+def write_rgb332_c_header(c_header_filename, name, images, preamble='', extra_defs='',
+    frames=None):
+    c_header_file = open(c_header_filename, 'w')
+    c_header_file.write(preamble)
+    c_header_file.write(f'int {name}_rgb332_count = {len(images)};\n')
+    c_header_file.write(extra_defs.format(fmt='rgb332'))
+    c_header_file.write('\n')
+    write_frame_table(c_header_file, name, 'rgb332', frames)
+    write_c_array(c_header_file, 'uint8_t __attribute__ ((aligned (4)))', f'{name}_rgb332_data',
+        [rgb555_to_rgb332(p) for image in images for p in image])
+    c_header_file.close()
+
+
+def write_indexed_c_headers(images, name, header_prefix, reserved_colour=None, preamble='',
+    extra_defs='', frame_width=None, mirror_tolerance=None):
+    # Write `<header_prefix>_8bpp.h`, `<header_prefix>_4bpp.h` and `<header_prefix>_rgb332.h` for
+    # a list of RGB555 images.
+    # `extra_defs` is written into both with `{fmt}` replaced by the format. With `frame_width`
+    # (the width of the images) a frame table is written too, dropping repeated and mirrored
+    # images unless `mirror_tolerance` is None.
+    frames = None
+    if frame_width is not None:
+        frames = list(range(len(images)))
+
+        if mirror_tolerance is not None:
+            num_frames = len(images)
+            images, frames, num_changed = drop_mirrored_images(images, frame_width,
+                mirror_tolerance)
+            print(f'{name}: {num_frames - len(images)} of {num_frames} frames dropped as ' \
+                f'repeats or mirrors, {num_changed} pixels changed')
+
+    data_8bpp = to_8bpp(images, reserved_colour)
+    if data_8bpp is not None:
+        write_8bpp_c_header(f'{header_prefix}_8bpp.h', name, data_8bpp, preamble, extra_defs,
+            frames)
+        print(f'{name} 8bpp: {len(data_8bpp["palette"])} colours')
+
+    data_4bpp = to_4bpp(images, reserved_colour)
+    write_4bpp_c_header(f'{header_prefix}_4bpp.h', name, data_4bpp, preamble, extra_defs, frames)
+    print(f'{name} 4bpp: {data_4bpp["num_banks"]} banks, {data_4bpp["num_changed"]} pixels ' \
+        'changed to fit')
+
+    write_rgb332_c_header(f'{header_prefix}_rgb332.h', name, images, preamble, extra_defs, frames)
+    print(f'{name} rgb332: {len(set(rgb555_to_rgb332(p) for image in images for p in image))} ' \
+        'colours')
+
+
+def read_rgb555_c_header(c_header_filename, array_name):
+    # Return the leading comment lines and pixel values of an RGB555 header written by the
+    # generators
+    text = open(c_header_filename).read()
+    preamble = ''.join(line + '\n' for line in text.splitlines() if line.startswith('//'))
+    body = text[text.index(f'{array_name}[] = {{'):]
+    return preamble, [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]+)', body)]
+
+
+def split_images(pixels, image_pixels):
+    return [pixels[i:i + image_pixels] for i in range(0, len(pixels), image_pixels)]
+
+
+def add_mirror_args(parser):
+    parser.add_argument('--drop-mirrored', action='store_true',
+        help='Don\'t store sprite frames repeating or mirroring an earlier frame')
+    parser.add_argument('--mirror-tolerance', type=int, default=0,
+        help='Pixels a frame may differ from a mirrored earlier frame and still be dropped')
+
+
+def mirror_tolerance_arg(args):
+    return args.mirror_tolerance if args.drop_mirrored else None
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description='Regenerate the indexed headers from the RGB555 headers')
+    add_mirror_args(parser)
+    args = parser.parse_args()
+
+    preamble, pixels = read_rgb555_c_header('village_tileset.h', 'tileset')
+    write_indexed_c_headers(split_images(pixels, 16 * 16), 'tileset', 'village_tileset',
+        preamble=preamble + '\n')
+
+    preamble, pixels = read_rgb555_c_header('sprite_data.h', 'sprite_data')
+    write_indexed_c_headers(split_images(pixels, 16 * 18), 'sprite', 'sprite_data',
+        TRANSPARENT_RGB555, preamble + '\n', 'int sprite_{fmt}_height = 18;\n', 16,
+        mirror_tolerance_arg(args))
+
+    sys.exit(0)
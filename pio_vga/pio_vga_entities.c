@@ -0,0 +1,621 @@
+#include <stdlib.h>
+#include "pio_vga_entities.h"
+
+// Wandering entities walk for between WANDER_MIN_STEPS and WANDER_MIN_STEPS + WANDER_STEP_RANGE - 1
+// updates before picking a new direction, one pick in WANDER_DIRECTIONS + 1 is to stand still
+#define WANDER_MIN_STEPS 16
+#define WANDER_STEP_RANGE 32
+#define WANDER_DIRECTIONS 4
+
+// Movement of each walk animation, indexed by walk_anim_e
+static const int8_t walk_dx[4] = {0, 1, 0, -1};
+static const int8_t walk_dy[4] = {-1, 0, 1, 0};
+
+static const uint8_t next_walk_frame[FRAMES_PER_WALK_ANIM] = {1, 2, 0};
+
+bool entity_system_init(entity_system_t* entities, const int capacity[kNumMoveTypes],
+    int tick_frames, int frame_budget) {
+
+    int max_entities = 0;
+    for(int kind = 0;kind < kNumMoveTypes; ++kind) {
+        entities->kind_first[kind] = max_entities;
+        entities->kind_capacity[kind] = capacity[kind];
+        entities->kind_count[kind] = 0;
+        max_entities += capacity[kind];
+    }
+
+    // No sprites are bound or culled, even should the allocation fail, so a system left empty by
+    // running out of memory is never asked for an entity's position
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        entities->sprite_entity[i] = -1;
+        entities->sprite_sheet_frame[i] = -1;
+    }
+
+    entity_system_set_cull_sprites(entities, 0, 0, 0, 0);
+
+    entities->max_entities = max_entities;
+    entities->x = malloc(max_entities * sizeof(int16_t));
+    entities->y = malloc(max_entities * sizeof(int16_t));
+    entities->lower_bound = malloc(max_entities * sizeof(int16_t));
+    entities->upper_bound = malloc(max_entities * sizeof(int16_t));
+    entities->dx = malloc(max_entities * sizeof(int8_t));
+    entities->dy = malloc(max_entities * sizeof(int8_t));
+    entities->wander_steps = malloc(max_entities * sizeof(uint8_t));
+    entities->character = malloc(max_entities * sizeof(uint8_t));
+    entities->anim = malloc(max_entities * sizeof(uint8_t));
+    entities->anim_frame = malloc(max_entities * sizeof(uint8_t));
+    entities->entity_sprite = malloc(max_entities * sizeof(int16_t));
+
+    // No grid until `entity_system_build_grid`
+    entities->cell_head = NULL;
+    entities->cell_next = NULL;
+    entities->cell_prev = NULL;
+    entities->entity_cell = NULL;
+
+    if (!entities->x || !entities->y || !entities->lower_bound || !entities->upper_bound ||
+        !entities->dx || !entities->dy || !entities->wander_steps || !entities->character ||
+        !entities->anim || !entities->anim_frame || !entities->entity_sprite) {
+        entity_system_free(entities);
+        return false;
+    }
+
+    entity_system_set_wander_area(entities, INT16_MIN, INT16_MIN, INT16_MAX, INT16_MAX);
+    entities->rand_state = 0x6c078965;
+
+    entities->tick_frames = tick_frames;
+    entities->frame_budget = frame_budget;
+    entities->anim_ticks = 2;
+
+    entities->frame = 0;
+    entities->tick = 0;
+    // Let the first tick start on the first frame
+    entities->tick_start_frame = -tick_frames;
+    entities->tick_position = 0;
+
+    entities->frame_updates = 0;
+    entities->total_updates = 0;
+    entities->late_ticks = 0;
+
+    entities->cull_cells = 0;
+    entities->cull_visible = 0;
+    entities->cull_overflow = 0;
+
+    return true;
+}
+
+static void free_grid(entity_system_t* entities) {
+    free(entities->cell_head);
+    free(entities->cell_next);
+    free(entities->cell_prev);
+    free(entities->entity_cell);
+
+    entities->cell_head = NULL;
+    entities->cell_next = NULL;
+    entities->cell_prev = NULL;
+    entities->entity_cell = NULL;
+}
+
+void entity_system_free(entity_system_t* entities) {
+    free(entities->x);
+    free(entities->y);
+    free(entities->lower_bound);
+    free(entities->upper_bound);
+    free(entities->dx);
+    free(entities->dy);
+    free(entities->wander_steps);
+    free(entities->character);
+    free(entities->anim);
+    free(entities->anim_frame);
+    free(entities->entity_sprite);
+    free_grid(entities);
+
+    entities->x = NULL;
+    entities->y = NULL;
+    entities->lower_bound = NULL;
+    entities->upper_bound = NULL;
+    entities->dx = NULL;
+    entities->dy = NULL;
+    entities->wander_steps = NULL;
+    entities->character = NULL;
+    entities->anim = NULL;
+    entities->anim_frame = NULL;
+    entities->entity_sprite = NULL;
+    entities->max_entities = 0;
+
+    for(int kind = 0;kind < kNumMoveTypes; ++kind) {
+        entities->kind_capacity[kind] = 0;
+        entities->kind_count[kind] = 0;
+    }
+}
+
+// Cell of the grid covering map position `x`, `y`, positions off the map get the nearest cell
+static int grid_cell(const entity_system_t* entities, int x, int y) {
+    int cell_x = x >> entities->grid_x_shift;
+    int cell_y = y >> entities->grid_y_shift;
+
+    cell_x = cell_x < 0 ? 0 : (cell_x >= entities->grid_width ? entities->grid_width - 1 : cell_x);
+    cell_y = cell_y < 0 ? 0 :
+        (cell_y >= entities->grid_height ? entities->grid_height - 1 : cell_y);
+
+    return cell_y * entities->grid_width + cell_x;
+}
+
+static void grid_insert(entity_system_t* entities, int entity, int cell) {
+    int head = entities->cell_head[cell];
+
+    entities->cell_next[entity] = head;
+    entities->cell_prev[entity] = -1;
+    if (head >= 0) {
+        entities->cell_prev[head] = entity;
+    }
+
+    entities->cell_head[cell] = entity;
+    entities->entity_cell[entity] = cell;
+}
+
+static void grid_remove(entity_system_t* entities, int entity) {
+    int next = entities->cell_next[entity];
+    int prev = entities->cell_prev[entity];
+
+    if (prev >= 0) {
+        entities->cell_next[prev] = next;
+    } else {
+        entities->cell_head[entities->entity_cell[entity]] = next;
+    }
+
+    if (next >= 0) {
+        entities->cell_prev[next] = prev;
+    }
+}
+
+// Move entities `first` up to `end` to the cells they've walked into
+static void update_cells(entity_system_t* entities, int first, int end) {
+    for(int i = first;i < end; ++i) {
+        int cell = grid_cell(entities, entities->x[i], entities->y[i]);
+
+        if (cell != entities->entity_cell[i]) {
+            grid_remove(entities, i);
+            grid_insert(entities, i, cell);
+        }
+    }
+}
+
+// Returns `value`'s log base 2 if it's a power of two, otherwise -1
+static int exact_log2(int value) {
+    int shift = 0;
+
+    while ((1 << shift) < value) {
+        ++shift;
+    }
+
+    return (value > 0 && (1 << shift) == value) ? shift : -1;
+}
+
+bool entity_system_build_grid(entity_system_t* entities, int map_width, int map_height,
+    int cell_tiles) {
+
+    free_grid(entities);
+
+    int cell_shift = exact_log2(cell_tiles);
+    int grid_width = (map_width + cell_tiles - 1) / cell_tiles;
+    int grid_height = (map_height + cell_tiles - 1) / cell_tiles;
+    int num_cells = grid_width * grid_height;
+
+    // Cells are indexed with 16 bits
+    if (cell_shift < 0 || num_cells < 1 || num_cells > UINT16_MAX + 1 ||
+        entities->max_entities > MAX_GRID_ENTITIES) {
+        return false;
+    }
+
+    entities->grid_x_shift = cell_shift + exact_log2(TILE_WIDTH);
+    entities->grid_y_shift = cell_shift + exact_log2(TILE_HEIGHT);
+    entities->grid_width = grid_width;
+    entities->grid_height = grid_height;
+
+    entities->cell_head = malloc(num_cells * sizeof(int16_t));
+    entities->cell_next = malloc(entities->max_entities * sizeof(int16_t));
+    entities->cell_prev = malloc(entities->max_entities * sizeof(int16_t));
+    entities->entity_cell = malloc(entities->max_entities * sizeof(uint16_t));
+
+    if (!entities->cell_head || !entities->cell_next || !entities->cell_prev ||
+        !entities->entity_cell) {
+        free_grid(entities);
+        return false;
+    }
+
+    for(int cell = 0;cell < num_cells; ++cell) {
+        entities->cell_head[cell] = -1;
+    }
+
+    for(int kind = 0;kind < kNumMoveTypes; ++kind) {
+        int first = entities->kind_first[kind];
+
+        for(int i = first;i < first + entities->kind_count[kind]; ++i) {
+            grid_insert(entities, i, grid_cell(entities, entities->x[i], entities->y[i]));
+        }
+    }
+
+    return true;
+}
+
+void entity_system_set_wander_area(entity_system_t* entities, int min_x, int min_y, int max_x,
+    int max_y) {
+
+    entities->wander_min_x = min_x;
+    entities->wander_min_y = min_y;
+    entities->wander_max_x = max_x;
+    entities->wander_max_y = max_y;
+}
+
+int entity_add(entity_system_t* entities, move_type_e move_type, int x, int y, int upper_bound,
+    int character_idx) {
+
+    if (entities->kind_count[move_type] == entities->kind_capacity[move_type]) {
+        return -1;
+    }
+
+    int entity = entities->kind_first[move_type] + entities->kind_count[move_type]++;
+
+    entities->x[entity] = x;
+    entities->y[entity] = y;
+    entities->lower_bound[entity] = 0;
+    entities->upper_bound[entity] = 0;
+    entities->dx[entity] = 0;
+    entities->dy[entity] = 0;
+    // Wandering entities pick a direction on their first update
+    entities->wander_steps[entity] = 0;
+    entities->character[entity] = character_idx;
+    entities->anim[entity] = kWalkAnimDown;
+    entities->anim_frame[entity] = 0;
+    entities->entity_sprite[entity] = -1;
+
+    switch (move_type) {
+        case kMoveTypeHorizontal:
+            entities->lower_bound[entity] = x;
+            entities->upper_bound[entity] = upper_bound;
+            entities->dx[entity] = 1;
+            entities->anim[entity] = kWalkAnimRight;
+            break;
+        case kMoveTypeVertical:
+            entities->lower_bound[entity] = y;
+            entities->upper_bound[entity] = upper_bound;
+            entities->dy[entity] = 1;
+            break;
+        default:
+            break;
+    }
+
+    if (entities->cell_head) {
+        grid_insert(entities, entity, grid_cell(entities, x, y));
+    }
+
+    return entity;
+}
+
+int entity_system_num_moving(const entity_system_t* entities) {
+    int num_moving = 0;
+
+    for(int kind = 0;kind < NUM_MOVING_TYPES; ++kind) {
+        num_moving += entities->kind_count[kind];
+    }
+
+    return num_moving;
+}
+
+// Walk horizontal entities `first` up to `end` a pixel, turning around at their bounds
+static void update_horizontal(entity_system_t* entities, int first, int end, bool animate) {
+    int16_t* x = entities->x;
+    int8_t* dx = entities->dx;
+    const int16_t* lower_bound = entities->lower_bound;
+    const int16_t* upper_bound = entities->upper_bound;
+    uint8_t* anim = entities->anim;
+    uint8_t* anim_frame = entities->anim_frame;
+
+    for(int i = first;i < end; ++i) {
+        int new_x = x[i] + dx[i];
+        int frame = animate ? next_walk_frame[anim_frame[i]] : anim_frame[i];
+
+        x[i] = new_x;
+        if (new_x == upper_bound[i] || new_x == lower_bound[i]) {
+            // Turn around and start the walk animation for the new direction
+            dx[i] = -dx[i];
+            anim[i] = dx[i] > 0 ? kWalkAnimRight : kWalkAnimLeft;
+            frame = 0;
+        }
+
+        anim_frame[i] = frame;
+    }
+}
+
+// As `update_horizontal` for vertical entities
+static void update_vertical(entity_system_t* entities, int first, int end, bool animate) {
+    int16_t* y = entities->y;
+    int8_t* dy = entities->dy;
+    const int16_t* lower_bound = entities->lower_bound;
+    const int16_t* upper_bound = entities->upper_bound;
+    uint8_t* anim = entities->anim;
+    uint8_t* anim_frame = entities->anim_frame;
+
+    for(int i = first;i < end; ++i) {
+        int new_y = y[i] + dy[i];
+        int frame = animate ? next_walk_frame[anim_frame[i]] : anim_frame[i];
+
+        y[i] = new_y;
+        if (new_y == upper_bound[i] || new_y == lower_bound[i]) {
+            dy[i] = -dy[i];
+            anim[i] = dy[i] > 0 ? kWalkAnimDown : kWalkAnimUp;
+            frame = 0;
+        }
+
+        anim_frame[i] = frame;
+    }
+}
+
+// Walk wandering entities `first` up to `end` a pixel in their direction, picking a new one once
+// they've walked for long enough and turning around at the edges of the wander area
+static void update_wanderers(entity_system_t* entities, int first, int end, bool animate) {
+    int16_t* x = entities->x;
+    int16_t* y = entities->y;
+    int8_t* dx = entities->dx;
+    int8_t* dy = entities->dy;
+    uint8_t* wander_steps = entities->wander_steps;
+    uint8_t* anim = entities->anim;
+    uint8_t* anim_frame = entities->anim_frame;
+    uint32_t rand_state = entities->rand_state;
+
+    for(int i = first;i < end; ++i) {
+        if (wander_steps[i] == 0) {
+            rand_state = rand_state * 1664525u + 1013904223u;
+            int direction = (rand_state >> 16) % (WANDER_DIRECTIONS + 1);
+
+            if (direction == WANDER_DIRECTIONS) {
+                // Stand still, facing the same way
+                dx[i] = 0;
+                dy[i] = 0;
+            } else {
+                dx[i] = walk_dx[direction];
+                dy[i] = walk_dy[direction];
+                anim[i] = direction;
+            }
+
+            wander_steps[i] = WANDER_MIN_STEPS + (rand_state >> 27);
+            anim_frame[i] = 0;
+        }
+
+        --wander_steps[i];
+
+        int new_x = x[i] + dx[i];
+        if (new_x < entities->wander_min_x || new_x > entities->wander_max_x) {
+            dx[i] = -dx[i];
+            new_x = x[i] + dx[i];
+            anim[i] ^= 2;
+        }
+
+        int new_y = y[i] + dy[i];
+        if (new_y < entities->wander_min_y || new_y > entities->wander_max_y) {
+            dy[i] = -dy[i];
+            new_y = y[i] + dy[i];
+            anim[i] ^= 2;
+        }
+
+        x[i] = new_x;
+        y[i] = new_y;
+
+        // Standing entities show the first frame of their animation
+        if ((dx[i] | dy[i]) == 0) {
+            anim_frame[i] = 0;
+        } else if (animate) {
+            anim_frame[i] = next_walk_frame[anim_frame[i]];
+        }
+    }
+
+    entities->rand_state = rand_state;
+}
+
+// Update moving entities `first` up to `end` of the current tick, counting through the moving
+// kinds in order. Each kind's share is updated by its own pass.
+static void update_moving(entity_system_t* entities, int first, int end, bool animate) {
+    int kind_start = 0;
+
+    for(int kind = 0;kind < NUM_MOVING_TYPES; ++kind) {
+        int kind_end = kind_start + entities->kind_count[kind];
+        int from = first > kind_start ? first : kind_start;
+        int to = end < kind_end ? end : kind_end;
+
+        if (from < to) {
+            int offset = entities->kind_first[kind] - kind_start;
+
+            switch (kind) {
+                case kMoveTypeHorizontal:
+                    update_horizontal(entities, from + offset, to + offset, animate);
+                    break;
+                case kMoveTypeVertical:
+                    update_vertical(entities, from + offset, to + offset, animate);
+                    break;
+                case kMoveTypeWander:
+                    update_wanderers(entities, from + offset, to + offset, animate);
+                    break;
+            }
+
+            if (entities->cell_head) {
+                update_cells(entities, from + offset, to + offset);
+            }
+        }
+
+        kind_start = kind_end;
+    }
+}
+
+void entity_system_update(entity_system_t* entities) {
+    uint32_t frame = entities->frame++;
+
+    entities->frame_updates = 0;
+
+    if (entities->tick_position == 0) {
+        if ((frame - entities->tick_start_frame) < (uint32_t)entities->tick_frames) {
+            return;
+        }
+
+        entities->tick_start_frame = frame;
+    }
+
+    int num_moving = entity_system_num_moving(entities);
+    int first = entities->tick_position;
+    int end = num_moving - first < entities->frame_budget ? num_moving :
+        first + entities->frame_budget;
+    // As the tick counts from 0 the first animation step is on the second tick
+    bool animate = ((entities->tick + 1) % entities->anim_ticks) == 0;
+
+    update_moving(entities, first, end, animate);
+
+    entities->frame_updates = end - first;
+    entities->total_updates += end - first;
+
+    if (end < num_moving) {
+        entities->tick_position = end;
+        return;
+    }
+
+    // Tick complete, if it ran into the frame the next should have started on it's late
+    if ((frame - entities->tick_start_frame) >= (uint32_t)entities->tick_frames) {
+        ++entities->late_ticks;
+    }
+
+    entities->tick_position = 0;
+    ++entities->tick;
+}
+
+void entity_system_bind_sprite(entity_system_t* entities, int sprite_idx, int entity) {
+    int old_entity = entities->sprite_entity[sprite_idx];
+
+    if (old_entity >= 0) {
+        entities->entity_sprite[old_entity] = -1;
+    }
+
+    if (entity >= 0) {
+        int old_sprite = entities->entity_sprite[entity];
+
+        if (old_sprite >= 0) {
+            entities->sprite_entity[old_sprite] = -1;
+        }
+
+        entities->entity_sprite[entity] = sprite_idx;
+    }
+
+    entities->sprite_entity[sprite_idx] = entity;
+    entities->sprite_sheet_frame[sprite_idx] = -1;
+}
+
+void entity_system_set_cull_sprites(entity_system_t* entities, int first_sprite, int num_sprites,
+    int width, int height) {
+
+    entities->cull_first_sprite = first_sprite;
+    entities->cull_num_sprites = num_sprites;
+    entities->cull_width = width;
+    entities->cull_height = height;
+}
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} cull_view_t;
+
+static inline bool entity_in_view(const entity_system_t* entities, int entity,
+    const cull_view_t* view) {
+
+    int x = entities->x[entity];
+    int y = entities->y[entity];
+
+    return (x + entities->cull_width > view->x) && (x < view->x + view->width) &&
+        (y + entities->cull_height > view->y) && (y < view->y + view->height);
+}
+
+void entity_system_cull_sprites(entity_system_t* entities, int view_x, int view_y, int view_width,
+    int view_height) {
+
+    cull_view_t view = {view_x, view_y, view_width, view_height};
+    int first_sprite = entities->cull_first_sprite;
+    int end_sprite = first_sprite + entities->cull_num_sprites;
+
+    // Take sprites back from entities that have left the view
+    for(int i = first_sprite;i < end_sprite; ++i) {
+        int entity = entities->sprite_entity[i];
+
+        if (entity >= 0 && !entity_in_view(entities, entity, &view)) {
+            entity_system_bind_sprite(entities, i, -1);
+            screen_sprites[i].enabled = false;
+        }
+    }
+
+    entities->cull_cells = 0;
+    entities->cull_visible = 0;
+
+    if (!entities->cell_head) {
+        return;
+    }
+
+    // Visit the cells holding entities whose sprite could reach into the view
+    int first_cell = grid_cell(entities, view_x - entities->cull_width + 1,
+        view_y - entities->cull_height + 1);
+    int last_cell = grid_cell(entities, view_x + view_width - 1, view_y + view_height - 1);
+    int first_cell_x = first_cell % entities->grid_width;
+    int last_cell_x = last_cell % entities->grid_width;
+    int free_sprite = first_sprite;
+
+    for(int row = first_cell - first_cell_x;row <= last_cell - last_cell_x;
+        row += entities->grid_width) {
+
+        for(int cell = row + first_cell_x;cell <= row + last_cell_x; ++cell) {
+            ++entities->cull_cells;
+
+            for(int entity = entities->cell_head[cell];entity >= 0;
+                entity = entities->cell_next[entity]) {
+
+                if (!entity_in_view(entities, entity, &view)) {
+                    continue;
+                }
+
+                ++entities->cull_visible;
+
+                if (entities->entity_sprite[entity] >= 0) {
+                    continue;
+                }
+
+                while (free_sprite < end_sprite && entities->sprite_entity[free_sprite] >= 0) {
+                    ++free_sprite;
+                }
+
+                if (free_sprite == end_sprite) {
+                    ++entities->cull_overflow;
+                    continue;
+                }
+
+                entity_system_bind_sprite(entities, free_sprite, entity);
+                screen_sprites[free_sprite].enabled = true;
+            }
+        }
+    }
+}
+
+void entity_system_sync_sprites(entity_system_t* entities, entity_set_frame_fn set_frame) {
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        int entity = entities->sprite_entity[i];
+
+        if (entity < 0) {
+            continue;
+        }
+
+        sprite_info_t* sprite = &screen_sprites[i];
+        int sheet_frame = entity_sheet_frame(entities, entity);
+
+        sprite->x = entities->x[entity];
+        sprite->y = entities->y[entity];
+
+        if (sheet_frame != entities->sprite_sheet_frame[i]) {
+            set_frame(sprite, sheet_frame);
+            entities->sprite_sheet_frame[i] = sheet_frame;
+        }
+    }
+}
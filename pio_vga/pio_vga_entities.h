@@ -0,0 +1,202 @@
+#ifndef __PIO_VGA_ENTITIES_H__
+#define __PIO_VGA_ENTITIES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pio_vga_render.h"
+
+/**************************************************************************************************
+ *                             Entities                                                           *
+ * Characters walking around the map. Entity state is held as a structure of arrays, an array per *
+ * field, with the entities of each movement kind in a contiguous range of their own. Each kind   *
+ * is updated by its own pass over its range: a tight loop touching only the fields that kind     *
+ * needs, with no branching on the kind per entity.                                               *
+ *                                                                                                *
+ * Entities are updated in ticks, each moving every moving entity a pixel. A tick starts every    *
+ * `tick_frames` frames and is spread over as many frames as it takes updating at most            *
+ * `frame_budget` entities a frame, so the work done in the vblank is bounded however many        *
+ * entities there are. Should there be more than `tick_frames * frame_budget` moving entities     *
+ * ticks take longer and every entity slows down together, rather than `end_of_frame` overrunning *
+ * the vblank.                                                                                    *
+ *                                                                                                *
+ * Entities don't need a sprite, a large map can have far more entities than NUM_SPRITES. Sprites *
+ * bound to an entity are moved and animated to follow it by `entity_system_sync_sprites`.        *
+ *                                                                                                *
+ * Entities are registered in a uniform grid over the map (`entity_system_build_grid`), cells of  *
+ * a power of two tiles square, moving between cells as they walk. Once a frame                   *
+ * `entity_system_cull_sprites` visits only the cells overlapping the viewport, handing a pool of *
+ * sprites out to the entities in view and taking them back from those that left it. So the       *
+ * sprites, and the work finding them, scale with how many entities are on screen rather than on  *
+ * the map.                                                                                       *
+ **************************************************************************************************/
+
+// Each character in the sprite sheet has 4 walk animations, each a walk cycle in a different
+// direction. Wandering entities use the animation as their direction.
+typedef enum {
+    kWalkAnimUp = 0,
+    kWalkAnimRight = 1,
+    kWalkAnimDown = 2,
+    kWalkAnimLeft = 3
+} walk_anim_e;
+
+#define FRAMES_PER_WALK_ANIM 3
+#define ANIMS_FRAMES_PER_CHARACTER (FRAMES_PER_WALK_ANIM * 4)
+
+// How an entity moves. Horizontal and vertical entities walk back and forth between two bounds,
+// wandering entities walk in a random direction (or stand still) for a random number of updates
+// before picking another, staying within the wander area. The moving kinds come first.
+typedef enum {
+    kMoveTypeHorizontal,
+    kMoveTypeVertical,
+    kMoveTypeWander,
+    kMoveTypeNone,
+    kNumMoveTypes
+} move_type_e;
+
+#define NUM_MOVING_TYPES kMoveTypeNone
+
+// Entities are indexed with 16 bits in the grid
+#define MAX_GRID_ENTITIES INT16_MAX
+
+typedef struct {
+    int max_entities;
+    // First entity of each kind's range, the entities it has room for and the number added
+    int kind_first[kNumMoveTypes];
+    int kind_capacity[kNumMoveTypes];
+    int kind_count[kNumMoveTypes];
+
+    // Per entity fields, `max_entities` of each. Positions are map pixel coordinates.
+    int16_t* x;
+    int16_t* y;
+    // Bounds of the X (horizontal) or Y (vertical) coordinate walked between, unused otherwise
+    int16_t* lower_bound;
+    int16_t* upper_bound;
+    // Pixels moved in X and Y each update, -1, 0 or 1
+    int8_t* dx;
+    int8_t* dy;
+    // Updates left before a wandering entity picks a new direction
+    uint8_t* wander_steps;
+    uint8_t* character;
+    // Current walk animation (a walk_anim_e) and frame within it
+    uint8_t* anim;
+    uint8_t* anim_frame;
+
+    // Map area wandering entities stay in, the bounds are inclusive
+    int wander_min_x;
+    int wander_min_y;
+    int wander_max_x;
+    int wander_max_y;
+    uint32_t rand_state;
+
+    // A tick starts every `tick_frames` frames, updating at most `frame_budget` entities a frame.
+    // Walk animations advance every `anim_ticks` ticks.
+    int tick_frames;
+    int frame_budget;
+    int anim_ticks;
+
+    // Frames seen by `entity_system_update` and ticks completed
+    uint32_t frame;
+    uint32_t tick;
+    // Frame the current (or last) tick started on and how many moving entities it's updated, 0
+    // when no tick is in progress
+    uint32_t tick_start_frame;
+    int tick_position;
+
+    // Entities updated by the last frame and in total, and ticks that took more than
+    // `tick_frames` frames
+    int frame_updates;
+    uint32_t total_updates;
+    uint32_t late_ticks;
+
+    // Entity each sprite follows (-1 for none) and the sprite sheet frame it was last pointed at
+    int16_t sprite_entity[NUM_SPRITES];
+    int16_t sprite_sheet_frame[NUM_SPRITES];
+    // Sprite following each entity, -1 for none
+    int16_t* entity_sprite;
+
+    // The grid, `grid_width` x `grid_height` cells of `1 << grid_x_shift` by `1 << grid_y_shift`
+    // pixels. `cell_head` is NULL until the grid is built.
+    int grid_x_shift;
+    int grid_y_shift;
+    int grid_width;
+    int grid_height;
+    // First entity in each cell and each entity's neighbours in its cell's list, -1 for none
+    int16_t* cell_head;
+    int16_t* cell_next;
+    int16_t* cell_prev;
+    // Cell each entity is registered in
+    uint16_t* entity_cell;
+
+    // Sprites `entity_system_cull_sprites` hands out and the size of an entity's sprite, an entity
+    // is in view if any of its sprite is
+    int cull_first_sprite;
+    int cull_num_sprites;
+    int cull_width;
+    int cull_height;
+    // Cells visited and entities in view in the last cull, and entities in view that got no
+    // sprite as the pool ran out (in total)
+    int cull_cells;
+    int cull_visible;
+    uint32_t cull_overflow;
+} entity_system_t;
+
+// Allocate room for `capacity[kind]` entities of each movement kind, updated a tick every
+// `tick_frames` frames with at most `frame_budget` entity updates a frame. Walk animations advance
+// every other tick and the wander area is unbounded until `entity_system_set_wander_area`. Returns
+// false if out of memory.
+bool entity_system_init(entity_system_t* entities, const int capacity[kNumMoveTypes],
+    int tick_frames, int frame_budget);
+void entity_system_free(entity_system_t* entities);
+
+void entity_system_set_wander_area(entity_system_t* entities, int min_x, int min_y, int max_x,
+    int max_y);
+
+// Add an entity of `move_type` at `x`, `y` drawn as `character_idx`. Horizontal and vertical
+// entities start at their lower bound walking towards `upper_bound` (an X or Y coordinate), it's
+// unused by the other kinds. Returns the entity's index or -1 if its kind is full.
+int entity_add(entity_system_t* entities, move_type_e move_type, int x, int y, int upper_bound,
+    int character_idx);
+
+// Moving entities in total
+int entity_system_num_moving(const entity_system_t* entities);
+
+// Sprite sheet frame showing `entity`'s current walk animation frame
+static inline int entity_sheet_frame(const entity_system_t* entities, int entity) {
+    return entities->character[entity] * ANIMS_FRAMES_PER_CHARACTER +
+        entities->anim[entity] * FRAMES_PER_WALK_ANIM + entities->anim_frame[entity];
+}
+
+// Called once a frame from `end_of_frame`, runs this frame's share of the current tick
+void entity_system_update(entity_system_t* entities);
+
+// Make sprite `sprite_idx` follow `entity`, or no entity with -1. The sprite's height, format and
+// enable are left to the caller. An entity is followed by one sprite at most.
+void entity_system_bind_sprite(entity_system_t* entities, int sprite_idx, int entity);
+
+// Build the grid over a map of `map_width` x `map_height` tiles with cells `cell_tiles` tiles
+// square (a power of two) and register every entity in it, those added later are registered as
+// they're added. Entities off the map are registered in the nearest cell. Returns false if out of
+// memory, `cell_tiles` isn't a power of two or there are more than MAX_GRID_ENTITIES entities.
+bool entity_system_build_grid(entity_system_t* entities, int map_width, int map_height,
+    int cell_tiles);
+
+// Have `entity_system_cull_sprites` hand out sprites `first_sprite` to `first_sprite +
+// num_sprites - 1` to entities whose `width` x `height` sprite is in view. Their height and format
+// are left to the caller, the cull enables and disables them.
+void entity_system_set_cull_sprites(entity_system_t* entities, int first_sprite, int num_sprites,
+    int width, int height);
+
+// Bind the cull sprites to the entities in the `view_width` x `view_height` pixel viewport at map
+// position `view_x`, `view_y` (the sprite scroll), using the grid. Sprites of entities still in
+// view stay with them. Call before `entity_system_sync_sprites` once the frame's scroll is known.
+void entity_system_cull_sprites(entity_system_t* entities, int view_x, int view_y, int view_width,
+    int view_height);
+
+// Points a sprite at a sprite sheet frame
+typedef void (*entity_set_frame_fn)(sprite_info_t* sprite, int sheet_frame);
+
+// Move every bound sprite to its entity's position, calling `set_frame` for those whose sprite
+// sheet frame has changed
+void entity_system_sync_sprites(entity_system_t* entities, entity_set_frame_fn set_frame);
+
+#endif
@@ -6,116 +6,229 @@
 #include "hardware/sync.h"
 #include "hardware/dma.h"
 #include "hardware/irq.h"
-#include "video_second.pio.h"
-#include "sprite_data.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "pico/multicore.h"
+#include "video_fifth.pio.h"
+#include "pio_vga_render.h"
+#include "pio_vga_entities.h"
+#include "pio_vga_line_dispatch.h"
+#include "pio_vga_line_timing.h"
+#include "pio_vga_tile_anim.h"
+#include "pio_vga_tilemap_stream.h"
+#include "pio_vga_video_mode.h"
+#include "sprite_data_8bpp.h"
 #include "test_tilemap.h"
-#include "village_tileset.h"
+#include "village_chunked_map.h"
+#include "village_tileset_8bpp.h"
+#include "village_tileset_8bpp_lz.h"
+#include "village_tileset_rgb332.h"
 
 /**************************************************************************************************
  *                             Video Code                                                         *
  * The below code is responsible for setting up the PIO to generate a VGA signal. There is no     *
- * framebuffer, scanlines must be generated on demand and draw into  `line_data_buffer_odd` and   *
- * `line_data_buffer_even`                                                                        *
+ * framebuffer, scanlines must be generated on demand and drawn into `line_data_buffers`, a ring  *
+ * of line buffers. Line jobs are handed out to NUM_RENDER_CORES cores by `line_dispatch`.        *
+ * Sync timing is generated from the VIDEO_MODE descriptor (see `pio_vga_video_mode.h`).          *
  **************************************************************************************************/
 
-#define SCREEN_WIDTH 320
-#define SCREEN_HEIGHT 240
-
-uint32_t __attribute__ ((aligned (4))) visible_line_timing_buffer[4];
-uint32_t __attribute__ ((aligned (4))) vblank_porch_buffer[4];
-uint32_t __attribute__ ((aligned (4))) vblank_sync_buffer[4];
+// Video mode output, one of `video_mode_id_t`. Every mode draws SCREEN_HEIGHT lines, modes drawing
+// fewer than SCREEN_WIDTH pixels output the middle of each line.
+#define VIDEO_MODE kVideoMode640x480
+
+// Number of cores drawing lines, 1 to draw everything on core0 or 2 to split lines between both
+// cores (core0 even lines, core1 odd lines).
+#define NUM_RENDER_CORES 2
+
+// Depth of the ring of line buffers drawn into. One buffer is being output while the render cores
+// draw ahead into the others. It needs to be at least 2 per render core for every core to always
+// have a line to draw (so each line gets 2 VGA lines per core to be drawn in), beyond that the
+// extra depth lets expensive lines borrow time from cheap ones. Check
+// `line_dispatch.underrun_stats` for lines that weren't drawn in time and increase this if needed.
+#define NUM_LINE_BUFFERS 8
+
+// Set to 1 to keep finished lines from frame to frame (in 150KB of SRAM) so lines nothing changed
+// on are copied rather than drawn again, freeing render time on still screens and menus. The demo
+// scrolls every frame so every line changes and it gains nothing here.
+#define USE_LINE_CACHE 0
+
+// Set to 1 to send the sync command words by DMA alone. A control channel reprograms the sync
+// channel from a list of control blocks, one per run of lines sharing their command words, and a
+// reset channel restarts the list every frame, so sync output needs no interrupts at all. Set to 0
+// to pick every line's command words in `dma_irh`, an interrupt per line (525 a frame at 640x480).
+#define USE_SYNC_DMA_CHAIN 1
+
+// Set to 1 to print, once a second, the spread of the intervals between line DMA interrupts in
+// system clock cycles. Compare with and without USE_SYNC_DMA_CHAIN to see the interrupt latency
+// jitter the sync interrupts add.
+#define PRINT_LINE_IRQ_JITTER 0
+
+// Set to 1 to timestamp every line's request, render start, render end and output against the
+// microsecond timer (see `pio_vga_line_timing.h`) and print a summary of the wait, render time,
+// slack and missed deadlines every LINE_TIMING_SUMMARY_FRAMES frames. Decode the printed output
+// with `host/decode_line_timing`. It costs a few timer reads and stores per line so can be left
+// on. The summary is printed LINE_TIMING_PRINT_CHARS at a time once per frame so printing never
+// waits long on a UART.
+#define USE_LINE_TIMING 1
+#define LINE_TIMING_SUMMARY_FRAMES 60
+#define LINE_TIMING_PRINT_CHARS 32
+
+// Set to 1 to draw a shower of sparks into an 8bpp framebuffer window over the bottom of the
+// screen, composited over the tilemap and under the characters. Takes SCREEN_WIDTH *
+// SPARKS_WINDOW_HEIGHT bytes of SRAM.
+#define USE_FRAMEBUFFER_WINDOW 0
+
+// Set to 1 to output RGB332 pixels on 8 pins with `line_out_rgb332` rather than RGB555 on 15,
+// freeing GPIO 10 - 16. Lines are drawn a byte per pixel from the RGB332 tileset, halving the line
+// buffers, the line DMA and the bytes written drawing each line. Raster colour transforms and the
+// line cache are RGB555 only so aren't used (USE_LINE_CACHE is ignored).
+#define USE_RGB332_OUTPUT 0
+
+// Set to 1 to scroll around the 1024 x 1024 tile map in `village_chunked_map.h` rather than the
+// village alone, streamed from flash a chunk at a time through a window of resident chunks (see
+// `pio_vga_tilemap_stream.h`). At most CHUNK_LOADS_PER_FRAME chunks off screen are loaded in an
+// `end_of_frame`. The entities stay on the village in the top left of the map.
+#define USE_CHUNKED_MAP 0
+#define CHUNK_LOADS_PER_FRAME 2
+
+// Set to 1 to animate the flowers through the tilemap layer's tile indirection table (see
+// `pio_vga_tile_anim.h`), moved on once a frame in `end_of_frame`
+#define USE_ANIMATED_TILES 0
+
+#if USE_RGB332_OUTPUT
+typedef uint8_t line_pixel_t;
+#else
+typedef uint16_t line_pixel_t;
+#endif
+
+// Pixels in each word the line DMA sends to the line program
+#define LINE_WORD_PIXELS (4 / sizeof(line_pixel_t))
+
+// Sync command words and the line they're for, generated by `setup_video_timing`
+video_timing_t video_timing;
+timing_line_state_t timing_line_state;
+
+// Output for the dummy lines before the first drawn line, which may be in a visible border
+uint32_t __attribute__ ((aligned (4))) line_data_zero_buffer = 0;
+line_pixel_t __attribute__ ((aligned (4))) line_data_buffers[NUM_LINE_BUFFERS][SCREEN_WIDTH];
+// Pixel of each line buffer the output begins from and the display lines each line is output for,
+// copied from the video mode (which is in flash) for the interrupt handler
+int line_data_offset;
+int line_repeat;
+
+// A control block for the sync channel, written to its alias 0 registers with the final write
+// (`ctrl`) triggering it
+typedef struct {
+    const uint32_t* read_addr;
+    volatile void* write_addr;
+    uint32_t transfer_count;
+    uint32_t ctrl;
+} sync_control_block_t;
 
-uint32_t __attribute__ ((aligned (4))) line_data_zero_buffer = 0xffffffff;
-uint16_t __attribute__ ((aligned (4))) line_data_buffer_even[320];
-uint16_t __attribute__ ((aligned (4))) line_data_buffer_odd[320];
+// One control block per timing segment, aligned for the control channel's write ring
+sync_control_block_t __attribute__ ((aligned (16))) sync_control_blocks[MAX_TIMING_SEGMENTS];
+// Read by the reset channel to restart the control channel at the first block
+const sync_control_block_t* sync_control_blocks_start = sync_control_blocks;
 
 uint32_t sync_dma_chan;
+uint32_t sync_ctrl_dma_chan;
+uint32_t sync_reset_dma_chan;
 uint32_t line_dma_chan;
 dma_channel_config line_dma_chan_config;
 
 volatile bool new_frame;
-volatile bool new_line_needed;
-volatile int next_line;
+line_dispatch_t line_dispatch;
+line_timing_t line_timing;
 
-int current_timing_line;
 int current_display_line;
 
-void setup_line_timing_buffers() {
-    // Sync command words for visible lines
-    // Hsync pulse Execute nop, delay 474, vsync = 1, hsync = 0
-    visible_line_timing_buffer[0] =
-        (pio_encode_nop() << 16) | (474 << 2) | 2;
-    // Back porch, execute nop, delay 223, vsync = 1, hsync = 1
-    visible_line_timing_buffer[1] =
-        (pio_encode_nop() << 16) | (223 << 2) | 3;
-    // Visible line, execute irq 4, delay 3205, vsync = 1, hsync = 1
-    visible_line_timing_buffer[2] =
-        (pio_encode_irq_set(false, 4) << 16) | (3205 << 2) | 3;
-    // Front porch, execute nop, delay 74, vsync = 1, hsync = 1
-    visible_line_timing_buffer[3] =
-        (pio_encode_nop() << 16) | (74 << 2) | 3;
-
-    // Non visible lines use same timings for uniformity, always execute nop as
-    // no pixels are output.
-    // Sync command words for vsync front and back porch
-    vblank_porch_buffer[0] =
-        (pio_encode_nop() << 16) | (474 << 2) | 2;
-    vblank_porch_buffer[1] =
-        (pio_encode_nop() << 16) | (223 << 2) | 3;
-    vblank_porch_buffer[2] =
-        (pio_encode_nop() << 16) | (3205 << 2) | 3;
-    vblank_porch_buffer[3] =
-        (pio_encode_nop() << 16) | (74 << 2) | 3;
-
-    // Sync command words for vsync sync pulse
-    vblank_sync_buffer[0] =
-        (pio_encode_nop() << 16) | (474 << 2) | 0;
-    vblank_sync_buffer[1] =
-        (pio_encode_nop() << 16) | (223 << 2) | 1;
-    vblank_sync_buffer[2] =
-        (pio_encode_nop() << 16) | (3205 << 2) | 1;
-    vblank_sync_buffer[3] =
-        (pio_encode_nop() << 16) | (74 << 2) | 1;
+void setup_video_timing() {
+    const video_mode_t* mode = &video_modes[VIDEO_MODE];
+
+    // The generated command words execute these instructions
+    hard_assert((pio_encode_nop() == SYNC_EXEC_NOP) &&
+        (pio_encode_irq_set(false, 4) == SYNC_EXEC_LINE_IRQ));
+
+    if ((mode->height != SCREEN_HEIGHT) || (mode->width > SCREEN_WIDTH) ||
+        (mode->width % LINE_WORD_PIXELS) ||
+        !build_video_timing(mode, clock_get_hz(clk_sys), &video_timing)) {
+        panic("Video mode %s can't be output\n", mode->name);
+    }
+
+    // Keep the start of the output word aligned for the line DMA
+    line_data_offset = ((SCREEN_WIDTH - mode->width) / 2) & ~(LINE_WORD_PIXELS - 1);
+    line_repeat = mode->line_repeat;
 }
 
-void __not_in_flash_func(dma_irh)() {
-    if (dma_hw->ints0 & (1u << sync_dma_chan)) {
-        dma_hw->ints0 = 1u << sync_dma_chan;
+// Request the line jobs needed as `display_line` begins, see `line_dispatch_requests_at`
+static inline void request_lines(int display_line) {
+    int num_requests = line_dispatch_requests_at(display_line, -VIDEO_DUMMY_LINES,
+        NUM_LINE_BUFFERS, SCREEN_HEIGHT, line_repeat);
 
-        if (current_timing_line < 524) {
-            current_timing_line++;
-        } else {
-            current_timing_line = 0;
-        }
+    if (num_requests) {
+        uint16_t now_us = time_us_32();
 
-        // `current_timing_line` is the line we're about to stream out sync
-        // command words for
-        if (current_timing_line == 0 || (current_timing_line == 1)) {
-            // VSync pulse for lines 0 and 1
-            dma_channel_set_read_addr(sync_dma_chan, vblank_sync_buffer, true);
-        } else if (current_timing_line < 32) {
-            // VGA back porch following VSync pulse (lines 2 - 34).
-            // Stops early for 3 dummy lines (at line 31).
-            dma_channel_set_read_addr(sync_dma_chan, vblank_porch_buffer, true);
-        } else if (current_timing_line < 515) {
-            // Dummy lines for final 3 lines of back porch (32 - 34) and visible
-            // lines following back porch (lines 35 - 514)
-            dma_channel_set_read_addr(sync_dma_chan, visible_line_timing_buffer, true);
-        } else {
-            // Front porch following visible lines (lines 515 - 524)
-            dma_channel_set_read_addr(sync_dma_chan, vblank_porch_buffer, true);
+        for(int i = 0;i < num_requests; ++i) {
+            if (USE_LINE_TIMING) {
+                line_timing_requested(&line_timing, now_us);
+            }
+
+            line_dispatch_request(&line_dispatch);
         }
+
+        // Wake up any render core waiting for a job
+        __sev();
+    }
+}
+
+// Smallest and largest intervals between line DMA interrupts, over the visible lines since the
+// last reset, in system clock cycles
+uint32_t line_irq_min_interval;
+uint32_t line_irq_max_interval;
+uint32_t last_line_irq_time;
+
+static inline void record_line_irq_interval() {
+    // SysTick counts down from 0xffffff at the system clock
+    uint32_t now = systick_hw->cvr;
+    uint32_t interval = (last_line_irq_time - now) & 0xffffff;
+    last_line_irq_time = now;
+
+    // The interval into the first visible line follows the dummy lines from the zero buffer,
+    // only intervals between visible lines are compared
+    if (current_display_line > 0) {
+        line_irq_min_interval = MIN(line_irq_min_interval, interval);
+        line_irq_max_interval = MAX(line_irq_max_interval, interval);
+    }
+}
+
+void __not_in_flash_func(dma_irh)() {
+    if (!USE_SYNC_DMA_CHAIN && (dma_hw->ints0 & (1u << sync_dma_chan))) {
+        dma_hw->ints0 = 1u << sync_dma_chan;
+
+        // Stream out the sync command words for the next line
+        dma_channel_set_read_addr(sync_dma_chan, timing_line_next(&timing_line_state), true);
     }
 
     if (dma_hw->ints0 & (1u << line_dma_chan)) {
         dma_hw->ints0 = 1u << line_dma_chan;
 
-        if (current_display_line == 479) {
+        if (PRINT_LINE_IRQ_JITTER) {
+            record_line_irq_interval();
+        }
+
+        if (current_display_line == video_timing.display_lines - 1) {
             // Final line of this frame has completed so signal new frame and setup for next.
             new_frame = true;
+            line_dispatch_frame_output(&line_dispatch);
+            if (USE_LINE_TIMING) {
+                line_timing_frame_output(&line_timing);
+            }
+            __sev();
 
-            // 3 dummy lines before real lines
-            current_display_line = -3;
+            // Dummy lines before real lines
+            current_display_line = -VIDEO_DUMMY_LINES;
+            // All line buffers are now free, request the first lines of the next frame
+            request_lines(current_display_line);
 
             // Setup Line DMA channel to read zero lines for dummy lines and set it going.
             // Disable read increment so just read zero over and over for dummy lines.
@@ -129,15 +242,8 @@ void __not_in_flash_func(dma_irh)() {
 
         current_display_line++;
 
-        // Need a new line every two display lines
-        if ((current_display_line & 1) == 0) {
-            // At display lines 478 & 479 we're drawing the final line so don't need
-            // to request a new line
-            if (current_display_line != 478) {
-                new_line_needed = true;
-                next_line = (current_display_line / 2) + 1;
-            }
-        }
+        // Need a new line every `line_repeat` display lines
+        request_lines(current_display_line);
 
         if (current_display_line == 0) {
             // Beginning visible lines, turn on read increment for line DMA
@@ -145,14 +251,25 @@ void __not_in_flash_func(dma_irh)() {
             dma_channel_set_config(line_dma_chan, &line_dma_chan_config, false);
         }
 
+        // Check the line about to be output has been drawn, counting an underrun if not
+        int line = current_display_line / line_repeat;
+
+        if ((current_display_line >= 0) && (current_display_line == line * line_repeat)) {
+            bool drawn = line_dispatch_line_output(&line_dispatch, line);
+
+            if (USE_LINE_TIMING) {
+                line_timing_line_output(&line_timing, line, drawn, time_us_32());
+            }
+        }
+
         // Negative lines are dummy lines so output from zero buffer, otherwise
-        // choose even or odd line depending upon current display line
+        // choose the line buffer for the line being displayed (each line displayed
+        // `line_repeat` times)
         if (current_display_line < 0) {
             dma_channel_set_read_addr(line_dma_chan, &line_data_zero_buffer, true);
-        } else if (current_display_line & 2) {
-            dma_channel_set_read_addr(line_dma_chan, line_data_buffer_odd, true);
         } else {
-            dma_channel_set_read_addr(line_dma_chan, line_data_buffer_even, true);
+            dma_channel_set_read_addr(line_dma_chan,
+                line_data_buffers[line % NUM_LINE_BUFFERS] + line_data_offset, true);
         }
     }
 }
@@ -160,10 +277,10 @@ void __not_in_flash_func(dma_irh)() {
 // Specify where sync and pixel pins are on the pico, this gives
 // hsync == 0
 // vsync == 1
-// pixel = 2 - 16
+// pixel = 2 - 16 (2 - 9 with USE_RGB332_OUTPUT), red on the lowest pins and blue on the highest
 const uint VID_PINS_BASE_SYNC = 0;
 const uint VID_PINS_BASE_LINE = 2;
-const uint NUM_VID_PINS_LINE = 15;
+const uint NUM_VID_PINS_LINE = USE_RGB332_OUTPUT ? 8 : 15;
 
 const uint sync_sm = 0;
 const uint line_sm = 1;
@@ -189,18 +306,91 @@ void video_pio_init(PIO pio) {
     sm_config_set_fifo_join(&sync_c, PIO_FIFO_JOIN_TX);
     pio_sm_init(pio, sync_sm, sync_prog_offset, &sync_c);
 
-    // Setup line SM
-    uint line_prog_offset = pio_add_program(pio, &line_out_program);
+    // Setup line SM, with the delay of the pixel output instruction set to give the mode's cycles
+    // per pixel (jmp targets are relocated by `pio_add_program` so are left as assembled)
+    pio_program_t line_program = USE_RGB332_OUTPUT ? line_out_rgb332_program : line_out_program;
+    uint pixel_out = USE_RGB332_OUTPUT ? line_out_rgb332_offset_pixel_out :
+        line_out_offset_pixel_out;
+
+    uint16_t line_instructions[line_program.length];
+    memcpy(line_instructions, line_program.instructions, sizeof(line_instructions));
+    line_instructions[pixel_out] = (line_instructions[pixel_out] & ~pio_encode_delay(31)) |
+        pio_encode_delay(video_timing.pixel_cycles - LINE_PROGRAM_MIN_PIXEL_CYCLES);
+
+    line_program.instructions = line_instructions;
+
+    uint line_prog_offset = pio_add_program(pio, &line_program);
     pio_sm_set_consecutive_pindirs(pio, line_sm, VID_PINS_BASE_LINE, NUM_VID_PINS_LINE, true);
-    pio_sm_config line_c = line_out_program_get_default_config(line_prog_offset);
+    pio_sm_config line_c = USE_RGB332_OUTPUT ?
+        line_out_rgb332_program_get_default_config(line_prog_offset) :
+        line_out_program_get_default_config(line_prog_offset);
     sm_config_set_out_pins(&line_c, VID_PINS_BASE_LINE, NUM_VID_PINS_LINE);
     sm_config_set_clkdiv(&line_c, 1.0f);
     // Join FIFOs together to get an 8 entry TX FIFO
     sm_config_set_fifo_join(&line_c, PIO_FIFO_JOIN_TX);
-    // Setup autopull, pull new word after 32 bits shifted out (one pull per two
-    // pixels)
+    // Setup autopull, pull new word after 32 bits shifted out (one pull per
+    // LINE_WORD_PIXELS pixels)
     sm_config_set_out_shift(&line_c, true, false, 32);
     pio_sm_init(pio, line_sm, line_prog_offset, &line_c);
+
+    // Load y with the pixels per line - 1 for the pixel counter
+    pio_sm_put_blocking(pio, line_sm, video_timing.mode->width - 1);
+    pio_sm_exec(pio, line_sm, pio_encode_pull(false, false));
+    pio_sm_exec(pio, line_sm, pio_encode_mov(pio_y, pio_osr));
+}
+
+// Fill in a control block per timing segment. Each has the sync channel send the segment's command
+// words, reading its line's words round and round, then chain to the control channel to load the
+// next block. The final block chains to the reset channel instead, which points the control
+// channel back at the first block.
+void setup_sync_control_blocks(PIO pio, dma_channel_config* sync_dma_chan_config) {
+    for(int i = 0;i < video_timing.num_segments; ++i) {
+        const timing_segment_t* segment = &video_timing.segments[i];
+        bool last_segment = i == video_timing.num_segments - 1;
+
+        channel_config_set_ring(sync_dma_chan_config, false, SYNC_WORDS_RING_BITS);
+        channel_config_set_chain_to(sync_dma_chan_config,
+            last_segment ? sync_reset_dma_chan : sync_ctrl_dma_chan);
+
+        sync_control_blocks[i] = (sync_control_block_t){
+            .read_addr = video_timing.words[segment->type],
+            .write_addr = &pio->txf[sync_sm],
+            .transfer_count = timing_segment_transfers(segment),
+            .ctrl = channel_config_get_ctrl_value(sync_dma_chan_config)
+        };
+    }
+
+    // Control channel writes a block to the sync channel's alias 0 registers each time it's
+    // triggered, its write address wrapping back to the first register
+    dma_channel_config ctrl_config = dma_channel_get_default_config(sync_ctrl_dma_chan);
+    channel_config_set_transfer_data_size(&ctrl_config, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl_config, true);
+    channel_config_set_write_increment(&ctrl_config, true);
+    channel_config_set_ring(&ctrl_config, true, 4);
+
+    dma_channel_configure(
+        sync_ctrl_dma_chan,
+        &ctrl_config,
+        &dma_hw->ch[sync_dma_chan].read_addr, // Write to sync channel alias 0
+        sync_control_blocks, // Begin with the vsync lines
+        sizeof(sync_control_block_t) / sizeof(uint32_t), // One control block each trigger
+        false // Don't start yet
+    );
+
+    // Reset channel points the control channel back at the first block, triggering it
+    dma_channel_config reset_config = dma_channel_get_default_config(sync_reset_dma_chan);
+    channel_config_set_transfer_data_size(&reset_config, DMA_SIZE_32);
+    channel_config_set_read_increment(&reset_config, false);
+    channel_config_set_write_increment(&reset_config, false);
+
+    dma_channel_configure(
+        sync_reset_dma_chan,
+        &reset_config,
+        &dma_hw->ch[sync_ctrl_dma_chan].al3_read_addr_trig,
+        &sync_control_blocks_start,
+        1,
+        false // Started by the final control block's chain
+    );
 }
 
 void video_dma_init(PIO pio) {
@@ -217,15 +407,21 @@ void video_dma_init(PIO pio) {
     // Transfer when there's space in the sync SM FIFO
     channel_config_set_dreq(&sync_dma_chan_config, pio_get_dreq(pio, sync_sm, true));
 
-    // Setup the channel and set it going
-    dma_channel_configure(
-        sync_dma_chan,
-        &sync_dma_chan_config,
-        &pio->txf[sync_sm], // Write to PIO TX FIFO
-        vblank_sync_buffer, // Begin with vblank sync line
-        4, // 4 command words in each sync buffer
-        false // Don't start yet
-    );
+    if (USE_SYNC_DMA_CHAIN) {
+        sync_ctrl_dma_chan = dma_claim_unused_channel(true);
+        sync_reset_dma_chan = dma_claim_unused_channel(true);
+        setup_sync_control_blocks(pio, &sync_dma_chan_config);
+    } else {
+        // Setup the channel, `dma_irh` gives it the words for each line after this
+        dma_channel_configure(
+            sync_dma_chan,
+            &sync_dma_chan_config,
+            &pio->txf[sync_sm], // Write to PIO TX FIFO
+            timing_line_start(&timing_line_state, &video_timing), // Begin with vsync line
+            SYNC_WORDS_PER_LINE, // 4 command words for each line
+            false // Don't start yet
+        );
+    }
 
     // Setup channel to feed line SM
     line_dma_chan = dma_claim_unused_channel(true);
@@ -245,568 +441,631 @@ void video_dma_init(PIO pio) {
         line_dma_chan,
         &line_dma_chan_config,
         &pio->txf[line_sm], // Write to PIO TX FIFO
-        &line_data_zero_buffer, // First line output will be white line
-        160, // Transfer complete contents of `line_data_buffer`
+        &line_data_zero_buffer, // First line output will be a black dummy line
+        video_timing.mode->width / LINE_WORD_PIXELS, // Transfer the output pixels of a line buffer
         false // Don't start yet
     );
 
     // Setup interrupt handler for line and sync DMA channels
     dma_channel_set_irq0_enabled(line_dma_chan, true);
-    dma_channel_set_irq0_enabled(sync_dma_chan, true);
+    dma_channel_set_irq0_enabled(sync_dma_chan, !USE_SYNC_DMA_CHAIN);
     irq_set_exclusive_handler(DMA_IRQ_0, dma_irh);
     irq_set_enabled(DMA_IRQ_0, true);
 }
 
 void setup_video() {
     new_frame = false;
-    new_line_needed = false;
-    current_timing_line = 0;
-    current_display_line = -3;
+    setup_video_timing();
+    line_dispatch_init(&line_dispatch, NUM_RENDER_CORES, SCREEN_HEIGHT);
+    line_timing_init(&line_timing, SCREEN_HEIGHT, LINE_TIMING_SUMMARY_FRAMES);
+    current_display_line = -VIDEO_DUMMY_LINES;
+    request_lines(current_display_line);
 
-    setup_line_timing_buffers();
     video_pio_init(video_pio);
     video_dma_init(video_pio);
 }
 
 void start_video() {
-    dma_channel_start(sync_dma_chan);
+    if (PRINT_LINE_IRQ_JITTER) {
+        // SysTick free running from the system clock to time line interrupts
+        systick_hw->rvr = 0xffffff;
+        systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+        line_irq_min_interval = UINT32_MAX;
+        line_irq_max_interval = 0;
+    }
+
+    dma_channel_start(USE_SYNC_DMA_CHAIN ? sync_ctrl_dma_chan : sync_dma_chan);
     dma_channel_start(line_dma_chan);
 
     pio_sm_set_enabled(video_pio, line_sm, true);
     pio_sm_set_enabled(video_pio, sync_sm, true);
 }
 
-void draw_line(int line_y, uint16_t* line_buffer);
+void draw_line(int line_y, line_pixel_t* line_buffer);
 void end_of_frame();
 
-void video_loop() {
-    while(1) {
-        // Wait for an interrupt to occur
-        __wfi();
-
-        // Temporarily disable interrupts to avoid race conditions around
-        // `new_line_needed` being written
-        uint32_t interrupt_status = save_and_disable_interrupts();
-
-        // Check if a new line is needed, if so clear the flag (so the loop doesn't immediately try to
-        // draw it again)
-        bool do_draw_line = new_line_needed;
-        if (new_line_needed) {
-            new_line_needed = false;
-        }
+// Tile rows are drawn through a cache per render core, see `prefetch_next_line`. 128 entries per
+// cache is enough for every row the demo draws to have been prefetched (see
+// `host/bench_tile_cache`).
+#define TILE_ROW_CACHE_ENTRIES 128
+
+// Set to 1 to keep the 8bpp tileset compressed in flash (`village_tileset_8bpp_lz.h`, 11KB rather
+// than 28KB) and decode it a tile at a time into a cache per render core, in place of the tile
+// row caches. `prefetch_next_line` decodes the tiles ahead of the lines needing them, with
+// TILE_DECODE_CACHE_ENTRIES tiles (256 bytes each) per cache no line waits on a decode (see
+// `host/bench_tile_decode`). Ignored with USE_RGB332_OUTPUT.
+#define USE_COMPRESSED_TILESET 0
+#define TILE_DECODE_CACHE_ENTRIES 64
+
+// The last job each core prefetched the tile rows for
+uint32_t prefetched_job[NUM_RENDER_CORES];
+
+// The tileset is left in flash so tile rows are read through the XIP cache. Bring the rows for the
+// next line `core` will draw into its tile row cache while it has nothing else to do so XIP misses
+// happen here rather than while the line is being drawn against its deadline. Only done once the
+// line's job has been released, so the scene the line will be drawn from is fixed.
+void prefetch_next_line(int core) {
+    uint32_t job;
+    int line;
+
+    if (!line_dispatch_peek_released(&line_dispatch, core, &job, &line) ||
+        (job == prefetched_job[core])) {
+        return;
+    }
 
-        // Check if a new frame is needed, if so clean the flag (so the loop doesn't immediately signal
-        // a new frame again)
-        bool do_end_of_frame = new_frame;
-        if (new_frame) {
-            new_frame = false;
-        }
+    prefetch_tilemap_layers_line(line);
+    prefetched_job[core] = job;
+}
 
-        // Reenable interrupts
-        restore_interrupts(interrupt_status);
+// Draw the next line job for `core` if there is one available. Returns true if a line was drawn.
+bool render_core_draw_next_line(int core) {
+    int line;
 
-        // If a new line is required call `draw_line` to fill the relevant line buffer
-        if (do_draw_line) {
-            if (next_line & 1) {
-                draw_line(next_line, line_data_buffer_odd);
-            } else {
-                draw_line(next_line, line_data_buffer_even);
-            }
-        }
+    if (!line_dispatch_take_job(&line_dispatch, core, &line)) {
+        return false;
+    }
 
-        if (do_end_of_frame) {
-            end_of_frame();
-        }
+    if (USE_LINE_TIMING) {
+        line_timing_render_start(&line_timing, line, time_us_32());
     }
-}
 
-/**************************************************************************************************
- *                                      Sprite Code                                               *
- * Code to draw sprites into a scanline buffer. `screen_sprites` contains all visible sprites.    *
- * The 'active sprites' for a scanline are determined and the appropriate pixels from the sprite  *
- * for scanline copied into the scanline buffer where pixels of the `transparent_colour` are      *
- * skipped allowing transparency in the sprites.                                                  *
- **************************************************************************************************/
+    draw_line(line, line_data_buffers[line % NUM_LINE_BUFFERS]);
 
-typedef struct {
-    uint16_t* data_ptr;
-    unsigned int height;
-    int x;
-    int y;
-    bool enabled;
-} sprite_info_t;
-
-#define NUM_SPRITES 128
-#define MAX_SPRITES_PER_LINE 20
-#define SPRITE_WIDTH 16
+    if (USE_LINE_TIMING) {
+        line_timing_render_end(&line_timing, line, time_us_32());
+    }
 
-sprite_info_t screen_sprites[NUM_SPRITES];
-int sprite_scroll_x = 0;
-int sprite_scroll_y = 0;
+    line_dispatch_job_done(&line_dispatch, core);
 
-const uint16_t transparent_colour = 0x7c1f;
+    return true;
+}
 
-void init_sprites() {
-    for(int i = 0;i < NUM_SPRITES; ++i) {
-        screen_sprites[i].enabled = false;
+// Core1 only draws lines, sleeping until the interrupt handler signals more are needed
+void render_core1_loop() {
+    while(1) {
+        if (render_core_draw_next_line(1)) {
+            // Let core0 know in case it's waiting on the frame being drawn
+            __sev();
+        } else {
+            prefetch_next_line(1);
+            __wfe();
+        }
     }
 }
 
-typedef struct {
-    // Single line of sprite data for scanline sprite is active for
-    uint16_t* line_data;
-    // Screen X coordinate sprite starts at
-    uint16_t x;
-} active_sprite_t;
-
-active_sprite_t cur_active_sprites[MAX_SPRITES_PER_LINE];
-
-// Return true is scanline with Y coordiate `line_y` contains `sprite`
-bool is_sprite_on_line(sprite_info_t sprite, uint16_t line_y) {
-    return (sprite.y <= line_y) && (line_y < sprite.y + sprite.height);
-}
+// Print the spread of the line interrupt intervals once every 60 frames, starting afresh after
+void print_line_irq_jitter() {
+    static int frames = 0;
 
-active_sprite_t calc_active_sprite_info(sprite_info_t sprite, uint16_t line_y) {
-    int sprite_line = line_y - sprite.y;
+    if (++frames < 60) {
+        return;
+    }
 
-    return (active_sprite_t){
-        .line_data = sprite.data_ptr + sprite_line * SPRITE_WIDTH,
-        .x = sprite.x
-    };
+    uint32_t saved_irq = save_and_disable_interrupts();
+    uint32_t min_interval = line_irq_min_interval;
+    uint32_t max_interval = line_irq_max_interval;
+    line_irq_min_interval = UINT32_MAX;
+    line_irq_max_interval = 0;
+    restore_interrupts(saved_irq);
+
+    printf("Line IRQ interval %lu - %lu cycles, jitter %lu cycles (%s)\n",
+        (unsigned long)min_interval, (unsigned long)max_interval,
+        (unsigned long)(max_interval - min_interval),
+        USE_SYNC_DMA_CHAIN ? "sync DMA chain" : "sync IRQ");
+    frames = 0;
 }
 
-int determine_active_sprites(uint16_t line_y) {
-    int num_active_sprites = 0;
+// Print the latest line timing summary a piece at a time, LINE_TIMING_PRINT_CHARS per call
+void print_line_timing() {
+    static char text[LINE_TIMING_TEXT_LENGTH + 1];
+    static int text_length = 0;
+    static int printed = 0;
 
-    // Iterate through all sprites
-    for(int i = 0;i < NUM_SPRITES; ++i) {
-        if (screen_sprites[i].enabled && is_sprite_on_line(screen_sprites[i], line_y)) {
-            // If sprite is enabled and is on the given scanline add it to the active sprites
-            cur_active_sprites[num_active_sprites++] =
-                calc_active_sprite_info(screen_sprites[i], line_y);
+    if (printed == text_length) {
+        line_timing_summary_t summary;
 
-            if (num_active_sprites == MAX_SPRITES_PER_LINE) {
-                break;
-            }
+        if (!line_timing_take_summary(&line_timing, &summary)) {
+            return;
         }
+
+        text_length = line_timing_format_summary(&summary, text);
+        printed = 0;
     }
 
-    return num_active_sprites;
+    int length = MIN(LINE_TIMING_PRINT_CHARS, text_length - printed);
+    printf("%.*s", length, text + printed);
+    printed += length;
 }
 
-void draw_sprite_to_line(uint16_t* line_buffer, active_sprite_t sprite) {
-    // Determine where on the scanline the sprite starts (start_line_x) and which pixel from the
-    // active sprite line will be drawn first (sprite_draw_x).
-    int sprite_draw_x;
-    int start_line_x;
-
-    // Sprite position given in absolute coordinates. Determine where it is on the screen given
-    // the current scroll
-    int screen_x = sprite.x - sprite_scroll_x;
-
-    if (screen_x < 0) {
-        // Sprite starts off screen so the sprite starts at the beginning of the scanline and the
-        // first visible sprite pixel is determined from how far off screen the sprite is.
-        sprite_draw_x = -screen_x;
-        start_line_x = 0;
-    } else {
-        // Sprite starts on screen, so the first pixel from the sprite line will be drawn and the
-        // sprite starts on scanline at it's X coordinate.
-        sprite_draw_x = 0;
-        start_line_x = screen_x;
+void video_loop() {
+    if (NUM_RENDER_CORES > 1) {
+        multicore_launch_core1(render_core1_loop);
     }
 
-    // Determine where on the scanline the sprite ends.
-    int end_line_x = MIN(screen_x + SPRITE_WIDTH, SCREEN_WIDTH);
-
-    // Copy sprite pixels to scanline skipping transparent pixels
-    for(int line_x = start_line_x; line_x < end_line_x; ++line_x, ++sprite_draw_x) {
-        if (sprite.line_data[sprite_draw_x] != transparent_colour) {
-            line_buffer[line_x] = sprite.line_data[sprite_draw_x];
+    while(1) {
+        // Lines take priority over end of frame processing as they have the tightest deadlines
+        if (render_core_draw_next_line(0)) {
+            continue;
         }
-    }
-}
 
-// Draw all sprites (up to MAX_SPRITES_PRE_LINE) that are on a scanline in its line buffer
-void draw_sprites_line(uint16_t line_y, uint16_t* line_buffer) {
-    // Translate line_y screen coordinate into absolute sprite coordinate using the scroll
-    line_y += sprite_scroll_y;
+        // End of frame processing alters the scene so can only begin once every line of the
+        // frame is drawn (core1 may still be working on one). Lines for the next frame aren't
+        // handed out until it's done.
+        if (new_frame && line_dispatch_frame_drawn(&line_dispatch)) {
+            new_frame = false;
+            end_of_frame();
+            line_dispatch_release_frame(&line_dispatch);
+            __sev();
 
-    int num_active_sprites = determine_active_sprites(line_y);
+            if (PRINT_LINE_IRQ_JITTER) {
+                print_line_irq_jitter();
+            }
 
-    for(int i = num_active_sprites - 1;i >= 0; --i) {
-        draw_sprite_to_line(line_buffer, cur_active_sprites[i]);
-    };
+            if (USE_LINE_TIMING) {
+                print_line_timing();
+            }
+
+            continue;
+        }
+
+        // Wait for an interrupt or core1 to signal there's something to do. The interrupt handler
+        // uses `__sev` so a request arriving after the checks above isn't missed.
+        prefetch_next_line(0);
+        __wfe();
+    }
 }
 
 /**************************************************************************************************
- *                                 Tilemap Code                                                   *
- * Code to draw a tilemap into a scanline buffer. All information about a tilemap is held in a    *
- * structure `tilemap_info_t`. Tiles are a fixed 16x16 size.                                      *
+ *                                 Application Code                                               *
+ * Using the video code above and the sprite and tilemap code from `pio_vga_render.c` draw a      *
+ * scrolling tilemap with a bunch of animated sprites walking around it                           *
  **************************************************************************************************/
 
-typedef struct {
-    // Width and height in tiles
-    int width;
-    int height;
-
-    // Pointer to tile data. Each uint16_t specifies which tile from the tileset should be
-    // displayed. Storage is row major order, so consecutive elements of a row of tiles are next to
-    // one another.
-    uint16_t* tiles;
-    // Tileset data in RGB555 format
-    uint16_t* tileset;
-
-    // X and Y scroll in pixels for the tilemap
-    int y_scroll;
-    int x_scroll;
-} tilemap_info_t;
-
-#define TILE_WIDTH 16
-#define TILE_HEIGHT 16
-#define TILES_PER_LINE (SCREEN_WIDTH / TILE_WIDTH)
-
-// Return a pointer to a row of tiles from a tilemap. Line is specified in terms of tiles.
-inline uint16_t* get_tilemap_line(int line, tilemap_info_t tilemap) {
-    return tilemap.tiles + line * tilemap.width;
-}
+// Tiles and sprites are 8bpp, drawn through these palettes. Half the size of RGB555 data and
+// unlike 4bpp needs no pixels changing to fit into palette banks. With USE_RGB332_OUTPUT the
+// tileset is RGB332 instead and sprites are drawn through `character_palette`'s RGB332 lookup.
+palette_t tile_palette;
+palette_t character_palette;
 
-// Return a pointer to a row of pixels from a tile in a tileset
-inline uint16_t* get_tile_line(uint16_t tile_num, int tile_y, uint16_t* tileset) {
-    return tileset + tile_num * TILE_WIDTH * TILE_HEIGHT + tile_y * TILE_WIDTH;
+// Point a sprite at a frame of the sprite sheet. Frames mirroring earlier ones (e.g. the left walk
+// frames, mirrors of the right ones) aren't stored so are drawn by flipping the earlier frame.
+void set_sprite_sheet_frame(sprite_info_t* sprite, int frame_idx) {
+    set_sprite_frame(sprite, sprite_8bpp_data, sprite_8bpp_frames[frame_idx]);
 }
 
-// Given a scanline Y, draw the relevant pixels from the tilemap into the scanline buffer
-void draw_tilemap_line(uint16_t line_y, tilemap_info_t tilemap, uint16_t* line_buffer) {
-    // Translate from screen pixel coordinates to tile pixel coordinates using the scroll
-    int layer_y = line_y + tilemap.y_scroll;
-    int layer_x = tilemap.x_scroll;
-
-    // Determine the tilemap Y of the line
-    int tilemap_y = layer_y / TILE_HEIGHT;
-    // Determine the pixel Y of the line within a tile
-    int tile_y = layer_y % TILE_HEIGHT;
-
-    // Determine the tilemap X of the leftmost pixel
-    int tilemap_x = layer_x / TILE_WIDTH;
-    // Determine the pixel X of the leftmost pixel within the first tile
-    int first_tile_x = layer_x % TILE_HEIGHT;
-
-    // Due to scroll the first and last tiles in the screen may only be partially displayed.
-    // Determine with width of the first and last tiles
-    int first_tile_visible_width = TILE_WIDTH - first_tile_x;
-    int last_tile_visible_width = first_tile_x;
-
-    // Obtain a pointer to the tilemap data for this line
-    uint16_t* tilemap_line = get_tilemap_line(tilemap_y, tilemap) + tilemap_x;
-    // Draw the first tile to the line, this is a special case as it may not be full width
-    // Get a pointer to the pixels for the line in the first tile, offset by first_tile_x
-    uint16_t* first_tile_line = get_tile_line(*tilemap_line, tile_y, tilemap.tileset) + first_tile_x;
-    // Draw it to the buffer by copying the pixels
-    memcpy(line_buffer, first_tile_line, first_tile_visible_width * 2);
-
-    ++tilemap_line;
-    line_buffer += first_tile_visible_width;
-
-    // Draw the remaining tiles in the line
-    for(int tile = 1;tile < TILES_PER_LINE; ++tile) {
-        // Get a pointer to the pixels for the line in the tile
-        uint16_t* tile_line = get_tile_line(*tilemap_line, tile_y, tilemap.tileset);
-        // Draw it to the buffer by copying the pixels
-        memcpy(line_buffer, tile_line, TILE_WIDTH * 2);
-        line_buffer += TILE_WIDTH;
-        ++tilemap_line;
-    }
-
-    // When the first tile is only a partial tile, so is the final tile. Draw that final partial
-    // tile here if required.
-    if(first_tile_x != 0) {
-        uint16_t* last_tile_line = get_tile_line(*tilemap_line, tile_y, tilemap.tileset);
-        memcpy(line_buffer, last_tile_line, last_tile_visible_width * 2);
-    }
-}
+// Entities (see `pio_vga_entities.h`) walk characters around the map, each moving a pixel every
+// ENTITY_TICK_FRAMES frames with at most ENTITY_FRAME_BUDGET entities updated in one
+// `end_of_frame`. The demo has few enough entities that every tick is done in a single frame.
+#define ENTITY_TICK_FRAMES 4
+#define ENTITY_FRAME_BUDGET 64
+// Entities are registered in a grid of cells this many tiles square. Every sprite is handed out
+// to entities in view by `entity_system_cull_sprites`.
+#define ENTITY_GRID_CELL_TILES 4
+// Villagers wandering the map alongside the characters walking back and forth
+#define NUM_VILLAGERS 16
 
-/**************************************************************************************************
- *                                 Application Code                                               *
- * Using the video and sprite code from above draw a test pattern on screen along with a bunch of *
- * animated sprites                                                                               *
- **************************************************************************************************/
+entity_system_t entities;
+
+// Given a tile X and Y, a movement type, an upper bound for the movement in tiles (lower bound
+// taken from the start coordinates) and a character, add an entity
+void setup_entity(int start_tile_x, int start_tile_y, move_type_e move_type, int move_upper_bound,
+    int character_idx) {
 
-// Given the index of a sprite return a pointer to the beginning of its image data
-uint16_t* calc_sprite_ptr(int sprite_idx) {
-    int num_sprite_pixels = SPRITE_WIDTH * sprite_height;
+    // Our upper move bound is given in terms of tiles, convert that to a pixel coordinate
+    int upper_bound =
+        move_upper_bound * (move_type == kMoveTypeHorizontal ? TILE_WIDTH : TILE_HEIGHT);
 
-    return sprite_data + sprite_idx * num_sprite_pixels;
+    entity_add(&entities, move_type, start_tile_x * TILE_WIDTH, start_tile_y * TILE_HEIGHT,
+        upper_bound, character_idx);
 }
 
-// Our test sprites have 4 different animations, each are walk cycles going in different directions
-typedef enum {
-    kWalkAnimUp = 0,
-    kWalkAnimRight = 1,
-    kWalkAnimDown = 2,
-    kWalkAnimLeft = 3
-} walk_anim_e;
-
-#define FRAMES_PER_WALK_ANIM 3
-#define ANIMS_FRAMES_PER_CHARACTER (FRAMES_PER_WALK_ANIM * 4)
-
-// There's different characters in our sprite sheet. Given a character index, the animation and the
-// frame of that animation return a pointer to the appropriate sprite.
-uint16_t* calc_char_sprite_ptr(int character_idx, walk_anim_e anim, int anim_frame) {
-    return calc_sprite_ptr(
-        character_idx * ANIMS_FRAMES_PER_CHARACTER + anim * FRAMES_PER_WALK_ANIM + anim_frame);
+// Bind sprites to the entities in view, wherever the scroll has left them, and have the sprites
+// follow their entities
+void cull_entity_sprites() {
+    entity_system_cull_sprites(&entities, sprite_scroll_x, sprite_scroll_y, SCREEN_WIDTH,
+        SCREEN_HEIGHT);
+    entity_system_sync_sprites(&entities, set_sprite_sheet_frame);
 }
 
-// A very basic 'entity' system. This will allow us to place some moving animated sprites that walk
-// around our tile map
+void setup_entities() {
+    // Setup a few entities to walk around the map
+    init_sprites();
+    // Should a crowd gather on a line with more than MAX_SPRITES_PER_LINE characters, flicker
+    // them rather than hide the same ones until the crowd disperses
+    sprite_overflow_policy = kSpriteOverflowRotate;
+
+    const int capacity[kNumMoveTypes] = {
+        [kMoveTypeHorizontal] = 4,
+        [kMoveTypeVertical] = 3,
+        [kMoveTypeWander] = NUM_VILLAGERS,
+        [kMoveTypeNone] = 0
+    };
 
-// Each entity is either stationary or moving in a horizontal or verical direction
-typedef enum {
-    kMoveTypeNone,
-    kMoveTypeHorizontal,
-    kMoveTypeVertical,
-} move_type_e;
+    if (!entity_system_init(&entities, capacity, ENTITY_TICK_FRAMES, ENTITY_FRAME_BUDGET)) {
+        panic("Out of memory setting up the entities\n");
+    }
 
-// Entity data. Each entity has an associated sprite that it controls. The entity processing code
-// move the sprite around (horizontally or vertically) playing the appropriate walk animation
-typedef struct {
-    // Index of the sprite associated with the entity
-    int sprite_idx;
+    setup_entity(2, 2, kMoveTypeVertical, 8, 0);
+    setup_entity(4, 7, kMoveTypeHorizontal, 14, 1);
+    setup_entity(7, 8, kMoveTypeHorizontal, 15, 2);
+    setup_entity(4, 15, kMoveTypeHorizontal, 10, 3);
+    setup_entity(18, 4, kMoveTypeVertical, 7, 4);
+    setup_entity(2, 12, kMoveTypeVertical, 22, 5);
+    setup_entity(7, 24, kMoveTypeHorizontal, 14, 0);
+
+    // Scatter the villagers over the map, keeping them on it
+    int map_width = tilemap_width * TILE_WIDTH;
+    int map_height = tilemap_height * TILE_HEIGHT;
+    uint32_t rand_state = 0x1234567;
+
+    entity_system_set_wander_area(&entities, 0, 0, map_width - SPRITE_WIDTH,
+        map_height - sprite_8bpp_height);
+
+    for(int i = 0;i < NUM_VILLAGERS; ++i) {
+        rand_state = rand_state * 1664525u + 1013904223u;
+        int x = (rand_state >> 8) % (map_width - SPRITE_WIDTH);
+        rand_state = rand_state * 1664525u + 1013904223u;
+        int y = (rand_state >> 8) % (map_height - sprite_8bpp_height);
+
+        entity_add(&entities, kMoveTypeWander, x, y, 0, i % 6);
+    }
 
-    // Index of the character the entity is using
-    int character_idx;
-    // Which frame within the current animation is being displayed (which animation can be
-    // determined from the move_type and whether we're increasing or decreasing position)
-    int anim_frame;
+    // Every sprite is available to the entities in view, `cull_entity_sprites` enables them
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        screen_sprites[i].height = sprite_8bpp_height;
+        screen_sprites[i].format = kPixelFormat8bpp;
+    }
 
-    // The entity either doesn't move at all or moves strictly horizontally or vertically. This
-    // specifies the bounds for the movement (X coordinate bound for horizontal movement, Y
-    // coordinate bound for vertical movement) and whether we're increasing or decreasing the
-    // relevant coordinate for the movement.
-    move_type_e move_type;
-    int move_lower_bound;
-    int move_upper_bound;
-    bool move_increase;
+    entity_system_build_grid(&entities, tilemap_width, tilemap_height, ENTITY_GRID_CELL_TILES);
+    entity_system_set_cull_sprites(&entities, 0, NUM_SPRITES, SPRITE_WIDTH, sprite_8bpp_height);
+    cull_entity_sprites();
+}
 
-    // When true entity should be processed
-    bool enabled;
-} entity_t;
+// Run this frame's share of the entity updates, sprites follow once the scroll is updated
+void process_entities() {
+    entity_system_update(&entities);
+}
 
-#define NUM_ENTITIES 8
+// Sparks fly up from the middle of the bottom of the screen and fall back, drawn into a
+// transparent framebuffer window. Positions and velocities are fixed point with SPARK_SHIFT
+// fractional bits.
+#define SPARKS_WINDOW_HEIGHT 80
+#define NUM_SPARKS 64
+#define SPARK_SHIFT 4
+#define SPARK_LIFETIME 64
 
-entity_t entities[NUM_ENTITIES];
+typedef struct {
+    int x;
+    int y;
+    int dx;
+    int dy;
+    int age;
+} spark_t;
 
-// Given a tile X and Y, a movement type, an upper bound for the movement in tiles (lower bound
-// taken from the start coordinates) and a character, setup an entity and sprite using the supplied
-// indexes
-void setup_entity(int start_tile_x, int start_tile_y, move_type_e move_type, int move_upper_bound,
-    int character_idx, int entity_idx, int sprite_idx) {
-
-    // Determine which animation to start with depending upon the movement type
-    walk_anim_e initial_anim;
-    switch(move_type) {
-        case kMoveTypeNone: initial_anim = kWalkAnimDown; break;
-        case kMoveTypeHorizontal: initial_anim = kWalkAnimRight; break;
-        case kMoveTypeVertical: initial_anim = kWalkAnimDown; break;
-    }
-
-    int start_x = start_tile_x * TILE_WIDTH;
-    int start_y = start_tile_y * TILE_HEIGHT;
-
-    entities[entity_idx].sprite_idx = sprite_idx;
-    entities[entity_idx].character_idx = character_idx;
-    entities[entity_idx].anim_frame = 0;
-    entities[entity_idx].move_type = move_type;
-    // Our lower move bound is the start X for horizontal movement, and a Y coordinate otherwise
-    entities[entity_idx].move_lower_bound = move_type == kMoveTypeHorizontal ? start_x : start_y;
-    // Our upper move bound is given in terms of tiles, cover that to a pixel coordinate
-    entities[entity_idx].move_upper_bound =
-        move_upper_bound * (move_type == kMoveTypeHorizontal ? TILE_WIDTH : TILE_HEIGHT);
-    entities[entity_idx].move_increase = true;
-    entities[entity_idx].enabled = true;
+spark_t sparks[NUM_SPARKS];
+uint32_t spark_rand_state = 0x2545f491;
 
-    // Setup the sprite being used by the entity
-    screen_sprites[sprite_idx].x = start_x;
-    screen_sprites[sprite_idx].y = start_y;
-    screen_sprites[sprite_idx].height = sprite_height;
-    screen_sprites[sprite_idx].data_ptr = calc_char_sprite_ptr(character_idx, initial_anim, 0);
-    screen_sprites[sprite_idx].enabled = true;
+// Sparks fade from white through yellow and orange to red, colour 0 is transparent
+const uint16_t spark_colours[] = {0x0000, 0x7fff, 0x03ff, 0x01ff, 0x001f};
+palette_t spark_palette;
 
+int spark_rand(int range) {
+    spark_rand_state = spark_rand_state * 1664525u + 1013904223u;
+    return (spark_rand_state >> 16) % range;
 }
 
-void setup_entities() {
-    // Setup a few entities to walk around the map
-    init_sprites();
+void launch_spark(spark_t* spark) {
+    spark->x = (SCREEN_WIDTH / 2) << SPARK_SHIFT;
+    spark->y = (SPARKS_WINDOW_HEIGHT - 1) << SPARK_SHIFT;
+    spark->dx = spark_rand(64) - 32;
+    spark->dy = -(spark_rand(32) + 24);
+    spark->age = 0;
+}
 
-    int cur_sprite_idx = 0;
-    int cur_entity_idx = 0;
+void setup_sparks() {
+    if (!build_framebuffer(&framebuffer, SCREEN_WIDTH, SPARKS_WINDOW_HEIGHT)) {
+        return;
+    }
 
-    setup_entity(2, 2, kMoveTypeVertical, 8, 0, cur_entity_idx++, cur_sprite_idx++);
-    setup_entity(4, 7, kMoveTypeHorizontal, 14, 1, cur_entity_idx++, cur_sprite_idx++);
-    setup_entity(7, 8, kMoveTypeHorizontal, 15, 2, cur_entity_idx++, cur_sprite_idx++);
-    setup_entity(4, 15, kMoveTypeHorizontal, 10, 3, cur_entity_idx++, cur_sprite_idx++);
-    setup_entity(18, 4, kMoveTypeVertical, 7, 4, cur_entity_idx++, cur_sprite_idx++);
-    setup_entity(2, 12, kMoveTypeVertical, 22, 5, cur_entity_idx++, cur_sprite_idx++);
-    setup_entity(7, 24, kMoveTypeHorizontal, 14, 0, cur_entity_idx++, cur_sprite_idx++);
-}
+    spark_palette.colours = spark_colours;
+    spark_palette.num_colours = sizeof(spark_colours) / sizeof(spark_colours[0]);
+    spark_palette.pairs = NULL;
+    spark_palette.rgb332 = NULL;
 
-int entity_frame = 0;
+    if (USE_RGB332_OUTPUT) {
+        build_palette_rgb332(&spark_palette);
+    }
 
-void process_entity(entity_t* entity) {
-    // Keep a count of times process_entity is called. To have things move at a reasonable speed
-    // we want to move the sprites less than once per frame (60 Hz framerate so that would be a
-    // speed of 60 pixels/s). Animation also needs to run at a different speed otherwise the walk
-    // cycle looks too quick.
-    ++entity_frame;
+    framebuffer.y = SCREEN_HEIGHT - SPARKS_WINDOW_HEIGHT;
+    framebuffer.palette = &spark_palette;
+    framebuffer.colour_zero_transparent = true;
+    framebuffer.enabled = true;
 
-    if ((entity_frame % 4) != 0) {
-        // Only do an update every 4 frames
-        return;
+    // Stagger the sparks so they don't all launch together
+    for(int i = 0;i < NUM_SPARKS; ++i) {
+        launch_spark(&sparks[i]);
+        sparks[i].age = spark_rand(SPARK_LIFETIME);
     }
+}
 
-    // Set to true when we switch walking animations (when the entity reaches its upper or lower
-    // bounds).
-    bool new_anim = false;
+void update_sparks() {
+    for(int i = 0;i < NUM_SPARKS; ++i) {
+        spark_t* spark = &sparks[i];
 
-    sprite_info_t* sprite = &screen_sprites[entity->sprite_idx];
+        // Erase the spark from where it was, move it (with a little gravity) and draw it again
+        framebuffer_plot(&framebuffer, spark->x >> SPARK_SHIFT, spark->y >> SPARK_SHIFT, 0);
 
-    // Given the setting of move_increase and move_type alter X or Y appropriately. Check to see if
-    // entity is hitting its upper or lower bound and if so start moving it in the oppposite
-    // direction.
-    if (entity->move_increase) {
-        if (entity->move_type == kMoveTypeHorizontal) {
-            sprite->x++;
-            if (sprite->x == entity->move_upper_bound) {
-                entity->move_increase = false;
-                new_anim = true;
-            }
-        } else {
-            sprite->y++;
-            if (sprite->y == entity->move_upper_bound) {
-                entity->move_increase = false;
-                new_anim = true;
-            }
-        }
-    } else {
-        if (entity->move_type == kMoveTypeHorizontal) {
-            sprite->x--;
-            if (sprite->x == entity->move_lower_bound) {
-                entity->move_increase = true;
-                new_anim = true;
-            }
-        } else {
-            sprite->y--;
-            if (sprite->y == entity->move_lower_bound) {
-                entity->move_increase = true;
-                new_anim = true;
-            }
+        spark->x += spark->dx;
+        spark->y += spark->dy;
+        spark->dy += 1;
+        spark->age++;
+
+        if ((spark->age >= SPARK_LIFETIME) || (spark->y >= SPARKS_WINDOW_HEIGHT << SPARK_SHIFT)) {
+            launch_spark(spark);
         }
+
+        int colour = 1 + (spark->age * (spark_palette.num_colours - 1)) / SPARK_LIFETIME;
+        framebuffer_plot(&framebuffer, spark->x >> SPARK_SHIFT, spark->y >> SPARK_SHIFT, colour);
     }
 
-    // Given the move_type and whether we are incrementing or decrementing position determine
-    // which walking animation must be used.
-    walk_anim_e anim;
-    if (entity->move_type == kMoveTypeHorizontal) {
-        anim = entity->move_increase ? kWalkAnimRight : kWalkAnimLeft;
-    } else {
-        anim = entity->move_increase ? kWalkAnimDown : kWalkAnimUp;
+    // The line cache doesn't look at framebuffer pixels
+    mark_lines_dirty(framebuffer.y, framebuffer.y + framebuffer.height);
+}
+
+chunked_map_t chunked_map;
+tilemap_stream_t tilemap_stream;
+compressed_tileset_t compressed_tileset;
+tile_anims_t tile_anims;
+
+// The tileset has no frames drawn for animation so the flowers swap between the flower tiles
+// there are, each tile number showing both in turn
+const uint16_t small_flower_frames[] = {15, 31};
+const uint16_t small_flower_alt_frames[] = {31, 15};
+const uint16_t flower_frames[] = {20, 21};
+const uint16_t flower_alt_frames[] = {21, 20};
+
+// Size of the map scrolled around in pixels
+int map_pixel_width;
+int map_pixel_height;
+
+// Setup our test tilemap to display the tilemap data in 'test_tilemap.h' (or with USE_CHUNKED_MAP
+// the window onto the chunked map) as the only tilemap layer, scrolled by `tilemap_scroll_x` and
+// `tilemap_scroll_y`
+void setup_tilemap() {
+    tilemap_layer_t* layer = &tilemap_layers[0];
+
+    layer->tilemap.width = tilemap_width;
+    layer->tilemap.height = tilemap_height;
+    layer->tilemap.tiles = tilemap_tiles;
+    map_pixel_width = tilemap_width * TILE_WIDTH;
+    map_pixel_height = tilemap_height * TILE_HEIGHT;
+
+    chunked_map.width_chunks = village_map_width_chunks;
+    chunked_map.height_chunks = village_map_height_chunks;
+    chunked_map.chunk_tiles = village_map_chunk_tiles;
+    chunked_map.chunk_index = village_map_chunk_index;
+    chunked_map.chunks = village_map_chunks;
+    chunked_map.num_chunks = village_map_num_chunks;
+
+    // The window takes the place of the tilemap, loaded with the chunks the first frame shows
+    if (USE_CHUNKED_MAP &&
+        tilemap_stream_init(&tilemap_stream, &chunked_map, &layer->tilemap,
+            CHUNK_LOADS_PER_FRAME)) {
+        map_pixel_width = chunked_map.width_chunks * chunked_map.chunk_tiles * TILE_WIDTH;
+        map_pixel_height = chunked_map.height_chunks * chunked_map.chunk_tiles * TILE_HEIGHT;
+        tilemap_stream_update(&tilemap_stream, tilemap_scroll_x, tilemap_scroll_y);
     }
 
-    // Calculate the next animation frame for the entity, begin by keeping it the same
-    int next_frame = entity->anim_frame;
-    if (new_anim) {
-        // For a new animation start at the first frame
-        next_frame = 0;
+    layer->tilemap.tileset = NULL;
+    layer->tilemap.tileset_shifted = NULL;
+    layer->tilemap.tileset_format = USE_RGB332_OUTPUT ? kPixelFormatRGB332 : kPixelFormat8bpp;
+    layer->tilemap.tileset_indexed = USE_RGB332_OUTPUT ? tileset_rgb332_data :
+        (USE_COMPRESSED_TILESET ? NULL : tileset_8bpp_data);
+    layer->tilemap.tile_banks = NULL;
+    layer->tilemap.palette = &tile_palette;
+    layer->tilemap.y_scroll = 0;
+    layer->tilemap.x_scroll = 0;
+    layer->parallax_x = PARALLAX_ONE;
+    layer->parallax_y = PARALLAX_ONE;
+    layer->has_colour_key = false;
+    layer->tile_row_opaque = NULL;
+    layer->enabled = true;
+    num_tilemap_layers = 1;
+
+    tile_palette.colours = tileset_8bpp_palette;
+    tile_palette.num_colours = tileset_8bpp_num_colours;
+    tile_palette.pairs = NULL;
+    tile_palette.rgb332 = NULL;
+
+    // The demo scrolls diagonally a pixel every frame so half of all frames have an odd X scroll.
+    // The 8bpp tileset is shifted into place as it's expanded so needs no shifted tileset (nor
+    // does the RGB332 tileset, its rows are copied a byte at a time).
+
+    // Every line drawn by core `n` is a line `n` modulo NUM_RENDER_CORES so give each core its own
+    // cache
+    if (USE_COMPRESSED_TILESET && !USE_RGB332_OUTPUT) {
+        compressed_tileset.data = tileset_8bpp_lz_data;
+        compressed_tileset.offsets = tileset_8bpp_lz_offsets;
+        compressed_tileset.num_tiles = tileset_8bpp_lz_count;
+        layer->tilemap.tileset_compressed = &compressed_tileset;
+        build_tile_decode_caches(&layer->tilemap, NUM_RENDER_CORES, TILE_DECODE_CACHE_ENTRIES);
     } else {
-        if ((entity_frame % 8) == 0) {
-            // Go to the next frame of animation. Only do this every 8 entity frames so the
-            // animation doesn't run too quickly.
-            next_frame = entity->anim_frame + 1;
-            if ((next_frame % FRAMES_PER_WALK_ANIM) == 0) {
-                next_frame = 0;
-            }
-        }
+        build_tile_row_caches(&layer->tilemap, NUM_RENDER_CORES, TILE_ROW_CACHE_ENTRIES);
     }
-    entity->anim_frame = next_frame;
 
-    // Determine the new sprite data pointer given the entities character index, the animation we
-    // want and the frame
-    sprite->data_ptr = calc_char_sprite_ptr(entity->character_idx, anim, next_frame);
-}
-
-// Go through all enabled entities that are move and process them
-void process_entities() {
-    for(int i = 0;i < NUM_ENTITIES; ++i) {
-        if (entities[i].enabled && entities[i].move_type != kMoveTypeNone) {
-            process_entity(&entities[i]);
-        }
+    layer->tilemap.tile_remap = NULL;
+    if (USE_ANIMATED_TILES && tile_anims_init(&tile_anims, 0, tileset_8bpp_count)) {
+        tile_anims_add(&tile_anims, 15, small_flower_frames, 2, 20);
+        tile_anims_add(&tile_anims, 31, small_flower_alt_frames, 2, 20);
+        tile_anims_add(&tile_anims, 20, flower_frames, 2, 32);
+        tile_anims_add(&tile_anims, 21, flower_alt_frames, 2, 32);
     }
 }
 
-tilemap_info_t test_tilemap;
+#if USE_RGB332_OUTPUT
+void draw_line(int line_y, uint8_t* line_buffer) {
+    // As the RGB555 `draw_line` below without the line cache or colour transforms
+    if (!framebuffer_covers_line(&framebuffer, line_y)) {
+        draw_tilemap_layers_line_rgb332(line_y, line_buffer);
+    }
 
-// Setup our test tilemap to display the tilemap data in 'test_tilemap.h'
-void setup_tilemap() {
-    test_tilemap.width = tilemap_width;
-    test_tilemap.height = tilemap_height;
-    test_tilemap.tiles = tilemap_tiles;
-    test_tilemap.tileset = tileset;
-    test_tilemap.y_scroll = 0;
-    test_tilemap.x_scroll = 0;
+    draw_framebuffer_line_rgb332(line_y, &framebuffer, line_buffer);
+    draw_sprites_line_rgb332(line_y, line_buffer);
 }
-
+#else
 void draw_line(int line_y, uint16_t* line_buffer) {
-    // For each line first draw the tilemap then the sprites over the top
-    draw_tilemap_line(line_y, test_tilemap, line_buffer);
+    // Lines unchanged since the previous frame come straight from the line cache, when there is one
+    if (get_cached_line(line_y, line_buffer)) {
+        return;
+    }
+
+    // For each line first draw the tilemap, unless the framebuffer covers it, then any of the
+    // framebuffer on the line and the sprites over the top, then apply any colour transform the
+    // raster effects give the line
+    if (!framebuffer_covers_line(&framebuffer, line_y)) {
+        draw_tilemap_layers_line(line_y, line_buffer);
+    }
+
+    draw_framebuffer_line(line_y, &framebuffer, line_buffer);
     draw_sprites_line(line_y, line_buffer);
+    apply_raster_colour_transform(line_y, line_buffer);
+
+    store_cached_line(line_y, line_buffer);
 }
+#endif
 
 bool y_inc = true;
 bool x_inc = true;
 
 void end_of_frame() {
-    // Process all the entities
+    // Process this frame's share of the entity updates
     process_entities();
 
+    if (USE_FRAMEBUFFER_WINDOW) {
+        update_sparks();
+    }
+
     // Scroll the tilemap and sprites around together. Moving in both X and Y directions and
     // bouncing back when we reach the limits of the map. The extra - 1 adds a bit of variety to
     // the bouncing (without it they both share a large common divisor and it ends up bouncing in
     // same places over and over).
-    if (test_tilemap.y_scroll == ((tilemap_height * TILE_HEIGHT) - SCREEN_HEIGHT) - 1) {
+    if (tilemap_scroll_y == (map_pixel_height - SCREEN_HEIGHT) - 1) {
         y_inc = false;
-    } else if(test_tilemap.y_scroll == 0) {
+    } else if(tilemap_scroll_y == 0) {
         y_inc = true;
     }
 
-    if (test_tilemap.x_scroll == ((tilemap_width * TILE_WIDTH) - SCREEN_WIDTH) - 1) {
+    if (tilemap_scroll_x == (map_pixel_width - SCREEN_WIDTH) - 1) {
         x_inc = false;
-    } else if (test_tilemap.x_scroll == 0) {
+    } else if (tilemap_scroll_x == 0) {
         x_inc = true;
     }
 
     if (y_inc) {
-        test_tilemap.y_scroll++;
+        tilemap_scroll_y++;
         sprite_scroll_y++;
     } else {
-        test_tilemap.y_scroll--;
+        tilemap_scroll_y--;
         sprite_scroll_y--;
     }
 
     if (x_inc) {
-        test_tilemap.x_scroll++;
+        tilemap_scroll_x++;
         sprite_scroll_x++;
     } else {
-        test_tilemap.x_scroll--;
+        tilemap_scroll_x--;
         sprite_scroll_x--;
     }
 
+    // Swap in the raster effects prepared in `raster_fx_next` for the next frame (the demo has
+    // none so both tables stay empty)
+    swap_raster_fx();
+
+    // Bring in the chunks the next frame shows before any of its lines are drawn
+    if (USE_CHUNKED_MAP) {
+        tilemap_stream_update(&tilemap_stream, tilemap_scroll_x, tilemap_scroll_y);
+
+        // Only the line cache needs the rows holding animated tiles, rescanning the window costs
+        // too much to do otherwise
+        if (USE_ANIMATED_TILES && USE_LINE_CACHE && tilemap_stream.frame_loads) {
+            tile_anims_find_rows(&tile_anims);
+        }
+    }
+
+    // One table write moves an animated tile on everywhere it appears
+    if (USE_ANIMATED_TILES) {
+        tile_anims_update(&tile_anims);
+    }
+
+    // Entities and sprite scroll are now fixed for the next frame, hand out sprites to the entities
+    // in view then bucket the sprites by scanline
+    cull_entity_sprites();
+    build_sprite_line_index();
+
+    // Find the lines that changed and must be drawn. `line_cache.frame_reused_lines` lines won't be
+    // drawn, leaving the render cores free for that much longer.
+    update_line_cache();
 }
 
 int main() {
+    // The timer starts counting at reset so this is how long booting took, including copying
+    // initialised data into SRAM. Assets are const so stay in flash and aren't part of that.
+    uint64_t boot_time_us = time_us_64();
+
+    stdio_init_all();
+    printf("Boot took %llu us\n", boot_time_us);
+
+    for(int core = 0;core < NUM_RENDER_CORES; ++core) {
+        prefetched_job[core] = UINT32_MAX;
+    }
+
     setup_video();
     start_video();
+    // Sprites are drawn using their opaque spans, build them for the whole sprite sheet
+    character_palette.colours = sprite_8bpp_palette;
+    character_palette.num_colours = sprite_8bpp_num_colours;
+    character_palette.pairs = NULL;
+    character_palette.rgb332 = NULL;
+    sprite_palette = &character_palette;
+
+    if (USE_RGB332_OUTPUT) {
+        build_palette_rgb332(&character_palette);
+    }
+
+    build_sprite_spans_format(sprite_8bpp_data, sprite_8bpp_count * sprite_8bpp_height,
+        kPixelFormat8bpp);
     setup_entities();
     setup_tilemap();
+    build_sprite_line_index();
+
+    if (USE_FRAMEBUFFER_WINDOW) {
+        setup_sparks();
+    }
+
+    if (USE_LINE_CACHE && !USE_RGB332_OUTPUT) {
+        build_line_cache();
+        update_line_cache();
+    }
 
     video_loop();
 }
@@ -326,7 +326,7 @@ void video_loop() {
  **************************************************************************************************/
 
 typedef struct {
-    uint16_t* data_ptr;
+    const uint16_t* data_ptr;
     unsigned int height;
     int x;
     int y;
@@ -349,7 +349,7 @@ void init_sprites() {
 
 typedef struct {
     // Single line of sprite data for scanline sprite is active for
-    uint16_t* line_data;
+    const uint16_t* line_data;
     // Screen X coordinate sprite starts at
     uint16_t x;
 } active_sprite_t;
@@ -433,7 +433,7 @@ void draw_sprites_line(uint16_t line_y, uint16_t* line_buffer) {
  * animated sprites                                                                               *
  **************************************************************************************************/
 
-uint16_t* calc_sprite_ptr(int sprite_idx) {
+const uint16_t* calc_sprite_ptr(int sprite_idx) {
     int num_sprite_pixels = SPRITE_WIDTH * sprite_height;
 
     return sprite_data + sprite_idx * num_sprite_pixels;
@@ -0,0 +1,78 @@
+#include "pio_vga_line_dispatch.h"
+
+static inline uint32_t load_acquire(const uint32_t* counter) {
+    return __atomic_load_n(counter, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_release(uint32_t* counter, uint32_t value) {
+    __atomic_store_n(counter, value, __ATOMIC_RELEASE);
+}
+
+void line_dispatch_init(line_dispatch_t* dispatch, int num_cores, int num_lines) {
+    dispatch->num_cores = num_cores;
+    dispatch->num_lines = num_lines;
+    dispatch->jobs_requested = 0;
+    dispatch->jobs_released = num_lines;
+
+    for(int core = 0;core < num_cores; ++core) {
+        dispatch->next_job[core] = core;
+        dispatch->next_line[core] = core;
+    }
+
+    dispatch->output_frame = 0;
+    dispatch->output_frame_underruns = 0;
+    dispatch->underrun_stats = (line_underrun_stats_t){0};
+}
+
+bool line_dispatch_take_job(line_dispatch_t* dispatch, int core, int* line) {
+    uint32_t job = dispatch->next_job[core];
+
+    if (!line_dispatch_job_before(job, load_acquire(&dispatch->jobs_requested)) ||
+        !line_dispatch_job_before(job, load_acquire(&dispatch->jobs_released))) {
+        return false;
+    }
+
+    *line = dispatch->next_line[core];
+
+    return true;
+}
+
+bool line_dispatch_peek_released(line_dispatch_t* dispatch, int core, uint32_t* job, int* line) {
+    *job = dispatch->next_job[core];
+
+    if (!line_dispatch_job_before(*job, load_acquire(&dispatch->jobs_released))) {
+        return false;
+    }
+
+    *line = dispatch->next_line[core];
+
+    return true;
+}
+
+void line_dispatch_job_done(line_dispatch_t* dispatch, int core) {
+    // Every core takes every `num_cores`th job and `num_lines` is a multiple of `num_cores` so the
+    // core's next line is a fixed step on, wrapping at the end of the frame.
+    int next_line = dispatch->next_line[core] + dispatch->num_cores;
+    if (next_line >= dispatch->num_lines) {
+        next_line -= dispatch->num_lines;
+    }
+
+    dispatch->next_line[core] = next_line;
+    store_release(&dispatch->next_job[core], dispatch->next_job[core] + dispatch->num_cores);
+}
+
+bool line_dispatch_frame_drawn(line_dispatch_t* dispatch) {
+    uint32_t jobs_released = dispatch->jobs_released;
+
+    for(int core = 0;core < dispatch->num_cores; ++core) {
+        if (line_dispatch_job_before(load_acquire(&dispatch->next_job[core]), jobs_released)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void line_dispatch_release_frame(line_dispatch_t* dispatch) {
+    store_release(&dispatch->jobs_released, dispatch->jobs_released + dispatch->num_lines);
+}
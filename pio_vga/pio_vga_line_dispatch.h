@@ -0,0 +1,162 @@
+#ifndef __PIO_VGA_LINE_DISPATCH_H__
+#define __PIO_VGA_LINE_DISPATCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**************************************************************************************************
+ *                             Line Job Dispatcher                                                *
+ * Hands out scanline drawing jobs to one or more render cores. The video interrupt requests      *
+ * jobs (one per scanline, in order) and each core takes every `num_cores`th job, so with two     *
+ * cores one draws even lines and the other odd lines. Jobs for a frame are only handed out once  *
+ * the frame has been released (after `end_of_frame` processing) and the end of frame processing *
+ * only begins once every job of the previous frame has been drawn, so lines are never drawn      *
+ * while the scene is being updated.                                                              *
+ *                                                                                                *
+ * Every counter has a single writer (the requester, core 0 or the core owning the entry) so no   *
+ * atomic read-modify-write is needed, making this usable on the RP2040 between both cores and    *
+ * the interrupt handler as well as between host threads. None of the functions block, waiting    *
+ * for work is left to the caller (`__wfe` on the Pico, a condition variable on the host).        *
+ *                                                                                                *
+ * Lines are drawn into a ring of line buffers, as deep as the caller likes. Lines are requested  *
+ * as soon as their buffer is free (see `line_dispatch_requests_at`) so a deeper ring lets the    *
+ * render cores run further ahead of the display, with cheap lines making up for expensive ones.  *
+ * The output side reports each line as it begins outputting it and a line not drawn by then is   *
+ * counted as an underrun.                                                                        *
+ **************************************************************************************************/
+
+#define MAX_RENDER_CORES 2
+
+typedef struct {
+    // Frames output so far
+    uint32_t frames;
+    // Underruns in the most recently output frame
+    uint32_t last_frame_underruns;
+    // Most underruns seen in a single frame
+    uint32_t max_frame_underruns;
+    // Number of frames that had at least one underrun
+    uint32_t frames_with_underruns;
+    uint32_t total_underruns;
+} line_underrun_stats_t;
+
+typedef struct {
+    int num_cores;
+    int num_lines;
+
+    // Number of jobs requested so far, written by the requester only
+    uint32_t jobs_requested;
+    // Jobs before this may be drawn, advanced a frame at a time by `line_dispatch_release_frame`
+    uint32_t jobs_released;
+
+    // The next job each core will draw and the line it is for. Written by that core only.
+    uint32_t next_job[MAX_RENDER_CORES];
+    int next_line[MAX_RENDER_CORES];
+
+    // Frame being output and its underruns so far, written by the output side only
+    uint32_t output_frame;
+    uint32_t output_frame_underruns;
+    // Underrun statistics, updated at the end of every output frame
+    line_underrun_stats_t underrun_stats;
+} line_dispatch_t;
+
+// Job counters wrap so compare them by the sign of their difference
+static inline bool line_dispatch_job_before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+// Setup the dispatcher for `num_cores` cores (1 up to MAX_RENDER_CORES) and frames of `num_lines`
+// lines, which must be a multiple of `num_cores`. The first frame is released immediately.
+void line_dispatch_init(line_dispatch_t* dispatch, int num_cores, int num_lines);
+
+// Request the next line job. Called from the line request interrupt so kept inline (the Pico's
+// interrupt handler runs from RAM).
+static inline void line_dispatch_request(line_dispatch_t* dispatch) {
+    __atomic_store_n(&dispatch->jobs_requested, dispatch->jobs_requested + 1, __ATOMIC_RELEASE);
+}
+
+// If the next job for `core` has been requested and released return true and give the line to
+// draw in `line`. Call `line_dispatch_job_done` once it's drawn.
+bool line_dispatch_take_job(line_dispatch_t* dispatch, int core, int* line);
+void line_dispatch_job_done(line_dispatch_t* dispatch, int core);
+
+// If the next job for `core` has been released, requested or not, return true and give the job and
+// the line it's for. Lets a core prepare for the line it will draw next while it waits for it to
+// be requested.
+bool line_dispatch_peek_released(line_dispatch_t* dispatch, int core, uint32_t* job, int* line);
+
+// True when every released job has been drawn so it's safe to update the scene for the next frame
+bool line_dispatch_frame_drawn(line_dispatch_t* dispatch);
+
+// Release the jobs for the next frame, called once end of frame processing is complete
+void line_dispatch_release_frame(line_dispatch_t* dispatch);
+
+// True if `line` of frame `frame` (frames counted from 0 at `line_dispatch_init`) has been drawn
+static inline bool line_dispatch_line_drawn(line_dispatch_t* dispatch, uint32_t frame, int line) {
+    uint32_t job = frame * dispatch->num_lines + line;
+    int core = line % dispatch->num_cores;
+
+    return line_dispatch_job_before(job,
+        __atomic_load_n(&dispatch->next_job[core], __ATOMIC_ACQUIRE));
+}
+
+// Called by the output side as it begins outputting `line`. Returns false and counts an underrun
+// if the line hasn't been drawn yet (whatever the buffer last held will be output instead).
+static inline bool line_dispatch_line_output(line_dispatch_t* dispatch, int line) {
+    if (line_dispatch_line_drawn(dispatch, dispatch->output_frame, line)) {
+        return true;
+    }
+
+    ++dispatch->output_frame_underruns;
+
+    return false;
+}
+
+// Called by the output side once the final line of a frame has been output
+static inline void line_dispatch_frame_output(line_dispatch_t* dispatch) {
+    line_underrun_stats_t* stats = &dispatch->underrun_stats;
+    uint32_t underruns = dispatch->output_frame_underruns;
+
+    ++stats->frames;
+    stats->last_frame_underruns = underruns;
+    stats->total_underruns += underruns;
+
+    if (underruns) {
+        ++stats->frames_with_underruns;
+    }
+
+    if (underruns > stats->max_frame_underruns) {
+        stats->max_frame_underruns = underruns;
+    }
+
+    ++dispatch->output_frame;
+    dispatch->output_frame_underruns = 0;
+}
+
+// Number of line jobs to request as display line `display_line` begins, for a ring of
+// `num_line_buffers` line buffers. Display lines run from `first_display_line` (-VIDEO_DUMMY_LINES
+// for the line program, see `pio_vga_video_mode.h`) to `num_lines * line_repeat - 1` with the
+// negative lines being dummy lines before the visible lines and every line output `line_repeat`
+// times.
+//
+// Every buffer is free once the final line of a frame has been output so the first
+// `num_line_buffers` lines of the next frame are all requested then (as `first_display_line`
+// begins), giving them the vertical blanking period to be drawn in. After that a line is requested
+// for each buffer as it finishes being output (every `line_repeat` display lines from display line
+// `line_repeat`), always `num_line_buffers - 1` lines ahead of the line about to be output.
+// Towards the end of the frame there are no more lines left to request.
+static inline int line_dispatch_requests_at(int display_line, int first_display_line,
+    int num_line_buffers, int num_lines, int line_repeat) {
+
+    if (display_line == first_display_line) {
+        return num_line_buffers < num_lines ? num_line_buffers : num_lines;
+    }
+
+    if ((display_line >= line_repeat) && ((display_line % line_repeat) == 0) &&
+        ((display_line / line_repeat) + num_line_buffers - 1 < num_lines)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,115 @@
+#include <string.h>
+#include "pio_vga_line_timing.h"
+
+static void reset_summary(line_timing_summary_t* summary, uint32_t sequence) {
+    memset(summary, 0, sizeof(*summary));
+
+    summary->magic = LINE_TIMING_MAGIC;
+    summary->sequence = sequence;
+    summary->min_slack_us = UINT16_MAX;
+    summary->wait_shift = LINE_TIMING_WAIT_SHIFT;
+    summary->render_shift = LINE_TIMING_RENDER_SHIFT;
+    summary->slack_shift = LINE_TIMING_SLACK_SHIFT;
+    summary->num_buckets = LINE_TIMING_BUCKETS;
+}
+
+void line_timing_init(line_timing_t* timing, int num_lines, int summary_frames) {
+    timing->num_lines = num_lines;
+    timing->summary_frames = summary_frames;
+    timing->next_request_line = 0;
+    timing->frame_misses = 0;
+    timing->sequence = 0;
+    timing->current = 0;
+    timing->recording = true;
+    timing->completed_ready = false;
+    timing->paused = false;
+
+    memset(timing->requested_us, 0, sizeof(timing->requested_us));
+    memset(timing->start_us, 0, sizeof(timing->start_us));
+    memset(timing->end_us, 0, sizeof(timing->end_us));
+    reset_summary(&timing->summaries[0], 0);
+    reset_summary(&timing->summaries[1], 0);
+}
+
+bool line_timing_take_summary(line_timing_t* timing, line_timing_summary_t* summary) {
+    // While paused the output side doesn't write to the current summary or swap buffers, so it
+    // can be reset here
+    if (__atomic_load_n(&timing->paused, __ATOMIC_ACQUIRE)) {
+        reset_summary(&timing->summaries[timing->current], 0);
+        __atomic_store_n(&timing->paused, false, __ATOMIC_RELEASE);
+    }
+
+    if (!__atomic_load_n(&timing->completed_ready, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+
+    // Nor does it swap buffers while a summary is ready. It sets the sequence number of a buffer
+    // as it starts on it.
+    line_timing_summary_t* completed = &timing->summaries[timing->current ^ 1];
+    *summary = *completed;
+    reset_summary(completed, 0);
+    __atomic_store_n(&timing->completed_ready, false, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+static const char hex_digits[] = "0123456789abcdef";
+
+int line_timing_format_summary(const line_timing_summary_t* summary, char* text) {
+    const uint8_t* bytes = (const uint8_t*)summary;
+    char* out = text;
+
+    memcpy(out, LINE_TIMING_TEXT_PREFIX, strlen(LINE_TIMING_TEXT_PREFIX));
+    out += strlen(LINE_TIMING_TEXT_PREFIX);
+
+    for(size_t i = 0;i < sizeof(*summary); ++i) {
+        *out++ = hex_digits[bytes[i] >> 4];
+        *out++ = hex_digits[bytes[i] & 0xf];
+    }
+
+    *out++ = '\n';
+    *out = '\0';
+
+    return out - text;
+}
+
+static int hex_digit_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+bool line_timing_parse_summary(const char* text, line_timing_summary_t* summary) {
+    uint8_t* bytes = (uint8_t*)summary;
+
+    if (strncmp(text, LINE_TIMING_TEXT_PREFIX, strlen(LINE_TIMING_TEXT_PREFIX)) != 0) {
+        return false;
+    }
+
+    text += strlen(LINE_TIMING_TEXT_PREFIX);
+
+    for(size_t i = 0;i < sizeof(*summary); ++i) {
+        int high = hex_digit_value(text[i * 2]);
+        int low = (high < 0) ? -1 : hex_digit_value(text[i * 2 + 1]);
+
+        if (low < 0) {
+            return false;
+        }
+
+        bytes[i] = (high << 4) | low;
+    }
+
+    return (summary->magic == LINE_TIMING_MAGIC) &&
+        (summary->num_buckets == LINE_TIMING_BUCKETS) &&
+        (summary->num_frames <= LINE_TIMING_MAX_FRAMES);
+}
@@ -0,0 +1,234 @@
+#ifndef __PIO_VGA_LINE_TIMING_H__
+#define __PIO_VGA_LINE_TIMING_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**************************************************************************************************
+ *                             Line Timing                                                        *
+ * Records when each line job is requested, when a render core starts and finishes drawing it and *
+ * when the output side begins outputting it, against a free running microsecond timer (the low   *
+ * 16 bits of `time_us_32()` on the Pico, the caller passes the time in). Each line's deadline is *
+ * the moment it's output, a line not drawn by then is a missed deadline.                         *
+ *                                                                                                *
+ * Timestamps go in a per line table and are only turned into statistics by the output side as    *
+ * each line is output, so the render cores pay a timer read and a store per line. Every          *
+ * `summary_frames` frames the output side swaps between two summary buffers, leaving the         *
+ * completed one for the main loop to take and send (see `line_timing_format_summary`). The       *
+ * output side runs in the line interrupt so it only flips an index, the main loop copies the     *
+ * completed summary out and resets the buffer ready for the next swap.                           *
+ *                                                                                                *
+ * Like the dispatcher every field has a single writer: the output side owns everything but the   *
+ * render start and end tables, each line of which is written by the core drawing it. A drawn     *
+ * line's timestamps are published by `line_dispatch_job_done` before the output side reads them. *
+ **************************************************************************************************/
+
+// Most lines per frame and frames per summary
+#define LINE_TIMING_MAX_LINES 256
+#define LINE_TIMING_MAX_FRAMES 64
+
+// Each histogram has 16 buckets, bucket `n` counting times from `n << shift` us up to the next
+// with the final bucket also counting everything longer
+#define LINE_TIMING_BUCKETS 16
+// Request to render start
+#define LINE_TIMING_WAIT_SHIFT 5
+// Render start to end
+#define LINE_TIMING_RENDER_SHIFT 3
+// Render end to output
+#define LINE_TIMING_SLACK_SHIFT 5
+
+// "LTS1" as a little endian word
+#define LINE_TIMING_MAGIC 0x3153544cu
+
+// Statistics over `num_frames` frames. Sent as its bytes (little endian on the Pico and hosts) so
+// the decoder reads it with this same struct, the fields are ordered so there's no padding.
+typedef struct {
+    uint32_t magic;
+    // Summaries completed before this one, a gap means the main loop didn't take some in time
+    uint32_t sequence;
+    uint16_t num_frames;
+    // Lines output and how many of them hadn't been drawn by then
+    uint16_t num_lines;
+    uint16_t missed_lines;
+    uint16_t frames_with_misses;
+    // Extremes over the lines drawn in time
+    uint16_t max_wait_us;
+    uint16_t max_render_us;
+    uint16_t min_slack_us;
+    // Line with the longest render and the one with the least slack
+    uint8_t max_render_line;
+    uint8_t min_slack_line;
+    // LINE_TIMING_*_SHIFT and LINE_TIMING_BUCKETS the histograms were gathered with
+    uint8_t wait_shift;
+    uint8_t render_shift;
+    uint8_t slack_shift;
+    uint8_t num_buckets;
+    // Histograms over the lines drawn in time
+    uint16_t wait_hist[LINE_TIMING_BUCKETS];
+    uint16_t render_hist[LINE_TIMING_BUCKETS];
+    uint16_t slack_hist[LINE_TIMING_BUCKETS];
+    // Missed deadlines in each frame, saturating at 255
+    uint8_t frame_misses[LINE_TIMING_MAX_FRAMES];
+} line_timing_summary_t;
+
+// Text form of a summary: "LTS " followed by the summary's bytes in hex and a newline. Hex keeps
+// it intact through stdio's newline translation and lets it be mixed with other printed text.
+#define LINE_TIMING_TEXT_PREFIX "LTS "
+#define LINE_TIMING_TEXT_LENGTH (4 + sizeof(line_timing_summary_t) * 2 + 1)
+
+typedef struct {
+    int num_lines;
+    int summary_frames;
+
+    // Line the next requested job is for, written by the requester (the output side) only
+    int next_request_line;
+    // Timestamps of each line's most recent request, render start and render end
+    uint16_t requested_us[LINE_TIMING_MAX_LINES];
+    uint16_t start_us[LINE_TIMING_MAX_LINES];
+    uint16_t end_us[LINE_TIMING_MAX_LINES];
+
+    // Written by the output side only. `summaries[current]` is being gathered, the other buffer is
+    // the completed summary or, once taken, reset ready to swap to. Lines are only recorded while
+    // `recording`.
+    uint32_t frame_misses;
+    uint32_t sequence;
+    int current;
+    bool recording;
+    line_timing_summary_t summaries[2];
+    // Set by the output side on swapping buffers, cleared by the taker once it's copied the
+    // completed summary out and reset its buffer. The output side won't swap until then.
+    bool completed_ready;
+    // Set by the output side when a summary completes before the last was taken. It stops
+    // recording until the taker has reset `summaries[current]` and cleared this, then starts
+    // afresh at the next frame. The summary and the frames in between are dropped.
+    bool paused;
+} line_timing_t;
+
+// Setup for frames of `num_lines` lines (up to LINE_TIMING_MAX_LINES) and a summary every
+// `summary_frames` frames (1 up to LINE_TIMING_MAX_FRAMES)
+void line_timing_init(line_timing_t* timing, int num_lines, int summary_frames);
+
+// Called for every line job requested, along with `line_dispatch_request`
+static inline void line_timing_requested(line_timing_t* timing, uint16_t now_us) {
+    int line = timing->next_request_line;
+
+    timing->requested_us[line] = now_us;
+    timing->next_request_line = (line + 1 == timing->num_lines) ? 0 : line + 1;
+}
+
+// Called by a render core as it starts and finishes drawing `line`, before
+// `line_dispatch_job_done`
+static inline void line_timing_render_start(line_timing_t* timing, int line, uint16_t now_us) {
+    timing->start_us[line] = now_us;
+}
+
+static inline void line_timing_render_end(line_timing_t* timing, int line, uint16_t now_us) {
+    timing->end_us[line] = now_us;
+}
+
+static inline int line_timing_bucket(uint16_t time_us, int shift) {
+    int bucket = time_us >> shift;
+
+    return bucket < LINE_TIMING_BUCKETS ? bucket : LINE_TIMING_BUCKETS - 1;
+}
+
+// Called by the output side as it begins outputting `line`, with whether it had been drawn (as
+// `line_dispatch_line_output` returns)
+static inline void line_timing_line_output(line_timing_t* timing, int line, bool drawn,
+    uint16_t now_us) {
+
+    line_timing_summary_t* summary = &timing->summaries[timing->current];
+
+    if (!timing->recording) {
+        return;
+    }
+
+    ++summary->num_lines;
+
+    if (!drawn) {
+        ++summary->missed_lines;
+        ++timing->frame_misses;
+        return;
+    }
+
+    uint16_t wait = timing->start_us[line] - timing->requested_us[line];
+    uint16_t render = timing->end_us[line] - timing->start_us[line];
+    uint16_t slack = now_us - timing->end_us[line];
+
+    ++summary->wait_hist[line_timing_bucket(wait, LINE_TIMING_WAIT_SHIFT)];
+    ++summary->render_hist[line_timing_bucket(render, LINE_TIMING_RENDER_SHIFT)];
+    ++summary->slack_hist[line_timing_bucket(slack, LINE_TIMING_SLACK_SHIFT)];
+
+    if (wait > summary->max_wait_us) {
+        summary->max_wait_us = wait;
+    }
+
+    if (render > summary->max_render_us) {
+        summary->max_render_us = render;
+        summary->max_render_line = line;
+    }
+
+    if (slack < summary->min_slack_us) {
+        summary->min_slack_us = slack;
+        summary->min_slack_line = line;
+    }
+}
+
+// Completes the current summary, called by `line_timing_frame_output` every `summary_frames`
+// frames. Inline as it runs in the line interrupt, it swaps to the other buffer if the last
+// summary has been taken or pauses recording if not.
+static inline void line_timing_complete_summary(line_timing_t* timing) {
+    ++timing->sequence;
+
+    if (__atomic_load_n(&timing->completed_ready, __ATOMIC_ACQUIRE)) {
+        timing->recording = false;
+        __atomic_store_n(&timing->paused, true, __ATOMIC_RELEASE);
+        return;
+    }
+
+    timing->current ^= 1;
+    timing->summaries[timing->current].sequence = timing->sequence;
+    __atomic_store_n(&timing->completed_ready, true, __ATOMIC_RELEASE);
+}
+
+// Called by the output side once the final line of a frame has been output
+static inline void line_timing_frame_output(line_timing_t* timing) {
+    line_timing_summary_t* summary = &timing->summaries[timing->current];
+    uint32_t misses = timing->frame_misses;
+
+    // Once the taker has reset the paused summary start again from the next frame
+    if (!timing->recording) {
+        if (!__atomic_load_n(&timing->paused, __ATOMIC_ACQUIRE)) {
+            summary->sequence = timing->sequence;
+            timing->frame_misses = 0;
+            timing->recording = true;
+        }
+
+        return;
+    }
+
+    summary->frame_misses[summary->num_frames] = misses < 255 ? misses : 255;
+    if (misses) {
+        ++summary->frames_with_misses;
+    }
+
+    timing->frame_misses = 0;
+
+    if (++summary->num_frames == timing->summary_frames) {
+        line_timing_complete_summary(timing);
+    }
+}
+
+// If a summary has been completed since the last call copy it to `summary` and return true. Also
+// resets a paused summary so recording can restart. Called by the main loop, never the output
+// side.
+bool line_timing_take_summary(line_timing_t* timing, line_timing_summary_t* summary);
+
+// Write the text form of `summary` to `text` (LINE_TIMING_TEXT_LENGTH + 1 chars), returns its
+// length
+int line_timing_format_summary(const line_timing_summary_t* summary, char* text);
+
+// Read a summary from the text form at the start of `text`, returns false if it isn't one
+bool line_timing_parse_summary(const char* text, line_timing_summary_t* summary);
+
+#endif
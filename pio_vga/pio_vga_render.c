@@ -0,0 +1,2249 @@
+#include <stdlib.h>
+#include <string.h>
+#include "pio_vga_render.h"
+
+#ifndef MIN
+#define MIN(a, b) ((b) < (a) ? (b) : (a))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) ((b) > (a) ? (b) : (a))
+#endif
+
+// Tile and line buffer words are accessed through this so the compiler doesn't assume they can't
+// alias the uint16_t pixels they hold
+typedef uint32_t __attribute__ ((may_alias)) pixel_pair_t;
+
+/**************************************************************************************************
+ *                                 Pixel Formats                                                  *
+ * Indexed tile and sprite data is expanded to RGB555 a pixel pair at a time as it's drawn. An    *
+ * 8bpp pair is two palette lookups, a 4bpp pair is a single byte so with `palette_t::pairs`      *
+ * built it's a single lookup.                                                                    *
+ **************************************************************************************************/
+
+bool build_palette_pairs(palette_t* palette) {
+    free_palette_pairs(palette);
+
+    int num_banks = (palette->num_colours + PALETTE_BANK_COLOURS - 1) / PALETTE_BANK_COLOURS;
+    uint32_t* pairs = malloc(num_banks * 256 * sizeof(uint32_t));
+    if (!pairs) {
+        return false;
+    }
+
+    for(int bank = 0;bank < num_banks; ++bank) {
+        const uint16_t* colours = palette->colours + bank * PALETTE_BANK_COLOURS;
+
+        for(int byte = 0;byte < 256; ++byte) {
+            pairs[bank * 256 + byte] = colours[byte & 0xf] | ((uint32_t)colours[byte >> 4] << 16);
+        }
+    }
+
+    palette->pairs = pairs;
+
+    return true;
+}
+
+void free_palette_pairs(palette_t* palette) {
+    free(palette->pairs);
+    palette->pairs = NULL;
+}
+
+// Expand `num_pairs` pixel pairs of a row of indexed data, starting from pair `first_pair`, into
+// `out`
+static inline void expand_indexed_pairs(const uint8_t* row, int first_pair, int num_pairs,
+    pixel_format_t format, const palette_t* palette, int bank, pixel_pair_t* out) {
+
+    if (format == kPixelFormat8bpp) {
+        const uint16_t* colours = palette->colours;
+        row += first_pair * 2;
+
+        for(int pair = 0;pair < num_pairs; ++pair) {
+            out[pair] = colours[row[pair * 2]] | ((uint32_t)colours[row[pair * 2 + 1]] << 16);
+        }
+    } else if (palette->pairs) {
+        const uint32_t* pairs = palette->pairs + bank * 256;
+        row += first_pair;
+
+        for(int pair = 0;pair < num_pairs; ++pair) {
+            out[pair] = pairs[row[pair]];
+        }
+    } else {
+        const uint16_t* colours = palette->colours + bank * PALETTE_BANK_COLOURS;
+        row += first_pair;
+
+        for(int pair = 0;pair < num_pairs; ++pair) {
+            out[pair] = colours[row[pair] & 0xf] | ((uint32_t)colours[row[pair] >> 4] << 16);
+        }
+    }
+}
+
+// As `expand_indexed_pairs` for a whole row of `num_pairs` pairs, written to `out` mirrored
+// horizontally. Each pair is the same lookups as an unflipped one with its pixels swapped.
+static inline void expand_indexed_pairs_flipped(const uint8_t* row, int num_pairs,
+    pixel_format_t format, const palette_t* palette, int bank, pixel_pair_t* out) {
+
+    out += num_pairs - 1;
+
+    if (format == kPixelFormat8bpp) {
+        const uint16_t* colours = palette->colours;
+
+        for(int pair = 0;pair < num_pairs; ++pair) {
+            out[-pair] = colours[row[pair * 2 + 1]] | ((uint32_t)colours[row[pair * 2]] << 16);
+        }
+    } else if (palette->pairs) {
+        const uint32_t* pairs = palette->pairs + bank * 256;
+
+        for(int pair = 0;pair < num_pairs; ++pair) {
+            uint32_t expanded = pairs[row[pair]];
+            out[-pair] = (expanded >> 16) | (expanded << 16);
+        }
+    } else {
+        const uint16_t* colours = palette->colours + bank * PALETTE_BANK_COLOURS;
+
+        for(int pair = 0;pair < num_pairs; ++pair) {
+            out[-pair] = colours[row[pair] >> 4] | ((uint32_t)colours[row[pair] & 0xf] << 16);
+        }
+    }
+}
+
+/**************************************************************************************************
+ *                                      Sprite Code                                               *
+ * Code to draw sprites into a scanline buffer. `screen_sprites` contains all visible sprites.    *
+ * The 'active sprites' for a scanline are determined and the appropriate pixels from the sprite  *
+ * for scanline copied into the scanline buffer where pixels of the `transparent_colour` are      *
+ * skipped allowing transparency in the sprites.                                                  *
+ **************************************************************************************************/
+
+sprite_info_t screen_sprites[NUM_SPRITES];
+int sprite_scroll_x = 0;
+int sprite_scroll_y = 0;
+
+const uint16_t transparent_colour = 0x7c1f;
+
+palette_t* sprite_palette = NULL;
+
+void init_sprites() {
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        screen_sprites[i].enabled = false;
+        screen_sprites[i].format = kPixelFormatRGB555;
+        screen_sprites[i].palette_bank = 0;
+        screen_sprites[i].flip_x = false;
+        screen_sprites[i].flip_y = false;
+        screen_sprites[i].priority = 0;
+    }
+}
+
+void set_sprite_frame(sprite_info_t* sprite, const void* images, uint16_t frame) {
+    int image_bytes = pixel_row_bytes(sprite->format, SPRITE_WIDTH) * sprite->height;
+
+    sprite->data_ptr = (const uint8_t*)images + (frame & SPRITE_FRAME_IMAGE_MASK) * image_bytes;
+    sprite->flip_x = (frame & SPRITE_FRAME_FLIP_X) != 0;
+    sprite->flip_y = (frame & SPRITE_FRAME_FLIP_Y) != 0;
+}
+
+sprite_span_sheet_t sprite_spans;
+
+// Return true if pixel `x` of a row of sprite data is opaque
+static inline bool is_sprite_pixel_opaque(const uint8_t* row_data, int x, pixel_format_t format) {
+    switch (format) {
+        case kPixelFormat8bpp: return row_data[x] != 0;
+        case kPixelFormat4bpp: return ((row_data[x / 2] >> ((x & 1) * 4)) & 0xf) != 0;
+        case kPixelFormatRGB332: return row_data[x] != RGB332_TRANSPARENT;
+        default: return ((const uint16_t*)row_data)[x] != transparent_colour;
+    }
+}
+
+bool build_sprite_spans(const uint16_t* data, int num_rows) {
+    return build_sprite_spans_format(data, num_rows, kPixelFormatRGB555);
+}
+
+// Find the opaque spans in every row of `num_rows` rows of sprite data at `data` and store them in
+// `sprite_spans` so sprites using that data are drawn with `draw_sprite_spans_to_line`. Any
+// previously built spans are freed. Returns false (leaving no spans built) if memory couldn't be
+// allocated for them.
+bool build_sprite_spans_format(const void* data, int num_rows, pixel_format_t format) {
+    free_sprite_spans();
+
+    int row_bytes = pixel_row_bytes(format, SPRITE_WIDTH);
+
+    // First pass counts the spans so they can be allocated in one go
+    int num_spans = 0;
+    for(int row = 0;row < num_rows; ++row) {
+        const uint8_t* row_data = (const uint8_t*)data + row * row_bytes;
+
+        for(int x = 0;x < SPRITE_WIDTH; ++x) {
+            bool opaque = is_sprite_pixel_opaque(row_data, x, format);
+            bool prev_opaque = (x != 0) && is_sprite_pixel_opaque(row_data, x - 1, format);
+
+            if (opaque && !prev_opaque) {
+                ++num_spans;
+            }
+        }
+    }
+
+    if (num_spans > UINT16_MAX) {
+        return false;
+    }
+
+    uint16_t* row_spans = malloc((num_rows + 1) * sizeof(uint16_t));
+    // Always allocate at least one span so a sheet with no opaque pixels still gets a valid pointer
+    sprite_span_t* spans = malloc((num_spans ? num_spans : 1) * sizeof(sprite_span_t));
+    if (!row_spans || !spans) {
+        free(row_spans);
+        free(spans);
+        return false;
+    }
+
+    // Second pass records where each span starts and how long it is
+    int span_idx = 0;
+    for(int row = 0;row < num_rows; ++row) {
+        const uint8_t* row_data = (const uint8_t*)data + row * row_bytes;
+        row_spans[row] = span_idx;
+
+        int x = 0;
+        while (x < SPRITE_WIDTH) {
+            if (!is_sprite_pixel_opaque(row_data, x, format)) {
+                ++x;
+                continue;
+            }
+
+            int start = x;
+            while (x < SPRITE_WIDTH && is_sprite_pixel_opaque(row_data, x, format)) {
+                ++x;
+            }
+
+            spans[span_idx++] = (sprite_span_t){.start = start, .length = x - start};
+        }
+    }
+    row_spans[num_rows] = span_idx;
+
+    sprite_spans = (sprite_span_sheet_t){
+        .data = data,
+        .format = format,
+        .row_bytes = row_bytes,
+        .num_rows = num_rows,
+        .row_spans = row_spans,
+        .spans = spans
+    };
+
+    return true;
+}
+
+void free_sprite_spans() {
+    free(sprite_spans.row_spans);
+    free(sprite_spans.spans);
+    sprite_spans = (sprite_span_sheet_t){0};
+}
+
+active_sprite_t cur_active_sprites[MAX_SPRITES_PER_LINE];
+
+// Return true is scanline with Y coordiate `line_y` contains `sprite`
+static bool is_sprite_on_line(sprite_info_t sprite, uint16_t line_y) {
+    return (sprite.y <= line_y) && (line_y < sprite.y + sprite.height);
+}
+
+static active_sprite_t calc_active_sprite_info(sprite_info_t sprite, uint16_t line_y) {
+    int sprite_line = line_y - sprite.y;
+    if (sprite.flip_y) {
+        sprite_line = sprite.height - 1 - sprite_line;
+    }
+
+    int row_bytes = pixel_row_bytes(sprite.format, SPRITE_WIDTH);
+    const uint8_t* line_data = (const uint8_t*)sprite.data_ptr + sprite_line * row_bytes;
+
+    active_sprite_t active_sprite = {
+        .line_data = line_data,
+        .format = sprite.format,
+        .palette_bank = sprite.palette_bank,
+        .spans = NULL,
+        .num_spans = 0,
+        .flip_x = sprite.flip_x,
+        .x = sprite.x
+    };
+
+    // If the line comes from the data spans were built for, find the spans for it
+    if (sprite_spans.data && (sprite.format == sprite_spans.format) &&
+        (line_data >= sprite_spans.data) &&
+        (line_data < sprite_spans.data + sprite_spans.num_rows * row_bytes)) {
+
+        int span_row = (line_data - sprite_spans.data) / row_bytes;
+        uint16_t first_span = sprite_spans.row_spans[span_row];
+        active_sprite.spans = sprite_spans.spans + first_span;
+        active_sprite.num_spans = sprite_spans.row_spans[span_row + 1] - first_span;
+    }
+
+    return active_sprite;
+}
+
+int determine_active_sprites(uint16_t line_y) {
+    int num_active_sprites = 0;
+
+    // Iterate through all sprites
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        if (screen_sprites[i].enabled && is_sprite_on_line(screen_sprites[i], line_y)) {
+            // If sprite is enabled and is on the given scanline add it to the active sprites
+            cur_active_sprites[num_active_sprites++] =
+                calc_active_sprite_info(screen_sprites[i], line_y);
+
+            if (num_active_sprites == MAX_SPRITES_PER_LINE) {
+                break;
+            }
+        }
+    }
+
+    return num_active_sprites;
+}
+
+// Draw a sprite line by copying each of its opaque spans from `pixels`, clipping them to the
+// screen. The spans of a flipped sprite are mirrored, with `pixels` either already flipped or, when
+// `reverse_pixels` is set, unflipped RGB555 pixels each span is copied from in reverse.
+// Pixels and the line buffer are `pixel_bytes` bytes per pixel (RGB555 or RGB332).
+static inline void draw_sprite_spans_to_line(void* line_buffer, active_sprite_t sprite,
+    const void* pixels, int pixel_bytes, bool reverse_pixels) {
+
+    int screen_x = sprite.x - sprite_scroll_x;
+
+    for(int i = 0;i < sprite.num_spans; ++i) {
+        int span_start = sprite.spans[i].start;
+        if (sprite.flip_x) {
+            span_start = SPRITE_WIDTH - span_start - sprite.spans[i].length;
+        }
+
+        int span_end = span_start + sprite.spans[i].length;
+
+        // Clip the span so it only covers pixels that are on screen
+        if (screen_x + span_start < 0) {
+            span_start = -screen_x;
+        }
+
+        if (screen_x + span_end > SCREEN_WIDTH) {
+            span_end = SCREEN_WIDTH - screen_x;
+        }
+
+        if (span_start < span_end && reverse_pixels) {
+            const uint16_t* span_pixels = (const uint16_t*)pixels + SPRITE_WIDTH - 1 - span_start;
+            uint16_t* span_out = (uint16_t*)line_buffer + screen_x + span_start;
+
+            for(int x = 0;x < span_end - span_start; ++x) {
+                span_out[x] = span_pixels[-x];
+            }
+        } else if (span_start < span_end) {
+            memcpy((uint8_t*)line_buffer + (screen_x + span_start) * pixel_bytes,
+                (const uint8_t*)pixels + span_start * pixel_bytes,
+                (span_end - span_start) * pixel_bytes);
+        }
+    }
+}
+
+void draw_sprite_to_line(uint16_t* line_buffer, active_sprite_t sprite) {
+    // Indexed lines are expanded to RGB555 first. Colour 0 is `transparent_colour` so the expanded
+    // line is drawn exactly as an RGB555 one would be. Horizontally flipped indexed lines are
+    // flipped as they're expanded. Flipped RGB555 lines are read in reverse as they're drawn, so
+    // they cost no more per pixel than unflipped ones.
+    uint16_t __attribute__ ((aligned (4))) expanded[SPRITE_WIDTH];
+    const uint16_t* pixels = sprite.line_data;
+    bool reverse_pixels = sprite.flip_x && sprite.format == kPixelFormatRGB555;
+
+    if (sprite.format != kPixelFormatRGB555) {
+        if (sprite.flip_x) {
+            expand_indexed_pairs_flipped(sprite.line_data, SPRITE_WIDTH / 2, sprite.format,
+                sprite_palette, sprite.palette_bank, (pixel_pair_t*)expanded);
+        } else {
+            expand_indexed_pairs(sprite.line_data, 0, SPRITE_WIDTH / 2, sprite.format,
+                sprite_palette, sprite.palette_bank, (pixel_pair_t*)expanded);
+        }
+        pixels = expanded;
+    }
+
+    if (sprite.spans) {
+        draw_sprite_spans_to_line(line_buffer, sprite, pixels, 2, reverse_pixels);
+        return;
+    }
+
+    // Determine where on the scanline the sprite starts (start_line_x) and which pixel from the
+    // active sprite line will be drawn first (sprite_draw_x).
+    int sprite_draw_x;
+    int start_line_x;
+
+    // Sprite position given in absolute coordinates. Determine where it is on the screen given
+    // the current scroll
+    int screen_x = sprite.x - sprite_scroll_x;
+
+    if (screen_x < 0) {
+        // Sprite starts off screen so the sprite starts at the beginning of the scanline and the
+        // first visible sprite pixel is determined from how far off screen the sprite is.
+        sprite_draw_x = -screen_x;
+        start_line_x = 0;
+    } else {
+        // Sprite starts on screen, so the first pixel from the sprite line will be drawn and the
+        // sprite starts on scanline at it's X coordinate.
+        sprite_draw_x = 0;
+        start_line_x = screen_x;
+    }
+
+    // Determine where on the scanline the sprite ends.
+    int end_line_x = MIN(screen_x + SPRITE_WIDTH, SCREEN_WIDTH);
+
+    // A reversed line is read from its last pixel backwards
+    int sprite_draw_step = 1;
+    if (reverse_pixels) {
+        sprite_draw_x = SPRITE_WIDTH - 1 - sprite_draw_x;
+        sprite_draw_step = -1;
+    }
+
+    // Copy sprite pixels to scanline skipping transparent pixels
+    for(int line_x = start_line_x; line_x < end_line_x;
+        ++line_x, sprite_draw_x += sprite_draw_step) {
+
+        if (pixels[sprite_draw_x] != transparent_colour) {
+            line_buffer[line_x] = pixels[sprite_draw_x];
+        }
+    }
+}
+
+uint16_t sprite_line_index[SCREEN_HEIGHT][MAX_SPRITES_PER_LINE];
+uint8_t sprite_line_count[SCREEN_HEIGHT];
+
+sprite_overflow_policy_t sprite_overflow_policy = kSpriteOverflowDropLast;
+sprite_overflow_stats_t sprite_overflow_stats;
+uint16_t sprite_line_dropped[SCREEN_HEIGHT];
+
+// Number of times the index has been built, picks which sprites kSpriteOverflowRotate drops
+static uint32_t sprite_overflow_frame = 0;
+
+// Enabled sprites, highest priority first then in `screen_sprites` order
+static uint16_t sprite_priority_order[NUM_SPRITES];
+static uint16_t sprite_priority_first[256];
+
+// For kSpriteOverflowRotate, the number of sprites of the priority being added that are on each
+// line, how many of those have been added so far, how many free slots the line had before any of
+// them were and where the window of them kept starts
+static uint16_t line_priority_sprites[SCREEN_HEIGHT];
+static uint16_t line_priority_seen[SCREEN_HEIGHT];
+static uint8_t line_priority_free[SCREEN_HEIGHT];
+static uint16_t line_priority_window[SCREEN_HEIGHT];
+
+// Fill `sprite_priority_order` with a counting sort on priority, returns the number of enabled
+// sprites
+static int sort_sprites_by_priority() {
+    memset(sprite_priority_first, 0, sizeof(sprite_priority_first));
+
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        if (screen_sprites[i].enabled) {
+            ++sprite_priority_first[screen_sprites[i].priority];
+        }
+    }
+
+    int num_enabled = 0;
+    for(int priority = 255;priority >= 0; --priority) {
+        int num_sprites = sprite_priority_first[priority];
+        sprite_priority_first[priority] = num_enabled;
+        num_enabled += num_sprites;
+    }
+
+    for(int i = 0;i < NUM_SPRITES; ++i) {
+        if (screen_sprites[i].enabled) {
+            sprite_priority_order[sprite_priority_first[screen_sprites[i].priority]++] = i;
+        }
+    }
+
+    return num_enabled;
+}
+
+// Range of screen lines a sprite covers given the current `sprite_scroll_y`, clipped to the
+// screen. Empty (`*end_line <= *first_line`) for a sprite that's off screen.
+static void get_sprite_screen_lines(const sprite_info_t* sprite, int* first_line, int* end_line) {
+    *first_line = sprite->y - sprite_scroll_y;
+    *end_line = *first_line + sprite->height;
+
+    if (*first_line < 0) {
+        *first_line = 0;
+    }
+
+    if (*end_line > SCREEN_HEIGHT) {
+        *end_line = SCREEN_HEIGHT;
+    }
+}
+
+// Returns true if the next sprite (of the priority being added) on `line` is kept. With
+// kSpriteOverflowRotate, when the sprites of this priority on the line won't all fit the ones kept
+// are a window of them whose start moves on by the number kept every frame.
+static bool keep_line_sprite(int line) {
+    if (sprite_overflow_policy != kSpriteOverflowRotate) {
+        return sprite_line_count[line] < MAX_SPRITES_PER_LINE;
+    }
+
+    int num_sprites = line_priority_sprites[line];
+    int seen = line_priority_seen[line]++;
+    if (seen == 0) {
+        int num_free = MAX_SPRITES_PER_LINE - sprite_line_count[line];
+        line_priority_free[line] = num_free;
+        line_priority_window[line] = ((sprite_overflow_frame % num_sprites) * num_free) %
+            num_sprites;
+    }
+
+    if (num_sprites <= line_priority_free[line]) {
+        return true;
+    }
+
+    int window_pos = seen - line_priority_window[line];
+    if (window_pos < 0) {
+        window_pos += num_sprites;
+    }
+
+    return window_pos < line_priority_free[line];
+}
+
+// Bucket every enabled sprite into the screen lines it covers given the current `sprite_scroll_y`.
+// Cost is proportional to the total height of the enabled sprites rather than to NUM_SPRITES *
+// SCREEN_HEIGHT, as scanning the whole of `screen_sprites` for every line would be (plus a pass
+// over the sprites of each priority with kSpriteOverflowRotate). Must be rebuilt whenever sprites
+// or the sprite scroll change, which should only happen between frames (e.g. in `end_of_frame`).
+void build_sprite_line_index() {
+    memset(sprite_line_count, 0, sizeof(sprite_line_count));
+    memset(sprite_line_dropped, 0, sizeof(sprite_line_dropped));
+    sprite_overflow_stats = (sprite_overflow_stats_t){0};
+
+    int num_enabled = sort_sprites_by_priority();
+
+    // Sprites are added a priority at a time, highest first
+    int priority_end;
+    for(int priority_first = 0;priority_first < num_enabled; priority_first = priority_end) {
+        uint8_t priority = screen_sprites[sprite_priority_order[priority_first]].priority;
+
+        priority_end = priority_first + 1;
+        while (priority_end < num_enabled &&
+            screen_sprites[sprite_priority_order[priority_end]].priority == priority) {
+            ++priority_end;
+        }
+
+        if (sprite_overflow_policy == kSpriteOverflowRotate) {
+            memset(line_priority_sprites, 0, sizeof(line_priority_sprites));
+            memset(line_priority_seen, 0, sizeof(line_priority_seen));
+
+            for(int i = priority_first;i < priority_end; ++i) {
+                int first_line, end_line;
+                get_sprite_screen_lines(&screen_sprites[sprite_priority_order[i]], &first_line,
+                    &end_line);
+
+                for(int line = first_line; line < end_line; ++line) {
+                    ++line_priority_sprites[line];
+                }
+            }
+        }
+
+        for(int i = priority_first;i < priority_end; ++i) {
+            int first_line, end_line;
+            get_sprite_screen_lines(&screen_sprites[sprite_priority_order[i]], &first_line,
+                &end_line);
+
+            for(int line = first_line; line < end_line; ++line) {
+                if (keep_line_sprite(line)) {
+                    sprite_line_index[line][sprite_line_count[line]++] = sprite_priority_order[i];
+                } else {
+                    if (sprite_line_dropped[line]++ == 0) {
+                        ++sprite_overflow_stats.overflow_lines;
+                    }
+
+                    ++sprite_overflow_stats.dropped_sprite_lines;
+                }
+            }
+        }
+    }
+
+    ++sprite_overflow_frame;
+}
+
+// Draw all sprites (up to MAX_SPRITES_PER_LINE) that are on a scanline in its line buffer using
+// the index built by `build_sprite_line_index`.
+void draw_sprites_line(uint16_t line_y, uint16_t* line_buffer) {
+    int num_active_sprites = sprite_line_count[line_y];
+    uint16_t* line_sprites = sprite_line_index[line_y];
+
+    // Translate line_y screen coordinate into absolute sprite coordinate using the scroll
+    uint16_t sprite_line_y = line_y + sprite_scroll_y;
+    int line_x_scroll = raster_fx->lines[line_y].sprite_x_scroll;
+
+    for(int i = num_active_sprites - 1;i >= 0; --i) {
+        active_sprite_t sprite =
+            calc_active_sprite_info(screen_sprites[line_sprites[i]], sprite_line_y);
+        sprite.x -= line_x_scroll;
+        draw_sprite_to_line(line_buffer, sprite);
+    }
+}
+
+// As `draw_sprites_line` but determines the sprites on the line by scanning all of
+// `screen_sprites` rather than using the index. Kept for comparison in benchmarks.
+void draw_sprites_line_unindexed(uint16_t line_y, uint16_t* line_buffer) {
+    int line_x_scroll = raster_fx->lines[line_y].sprite_x_scroll;
+
+    // Translate line_y screen coordinate into absolute sprite coordinate using the scroll
+    line_y += sprite_scroll_y;
+
+    int num_active_sprites = determine_active_sprites(line_y);
+
+    for(int i = num_active_sprites - 1;i >= 0; --i) {
+        cur_active_sprites[i].x -= line_x_scroll;
+        draw_sprite_to_line(line_buffer, cur_active_sprites[i]);
+    };
+}
+
+/**************************************************************************************************
+ *                                 Tilemap Code                                                   *
+ * Code to draw a tilemap into a scanline buffer. All information about a tilemap is held in a    *
+ * structure `tilemap_info_t`. Tiles are a fixed 16x16 size.                                      *
+ **************************************************************************************************/
+
+// Number of tiles a line starting `first_tile_x` pixels into its first tile covers
+static inline int line_tile_count(int first_tile_x) {
+    return first_tile_x != 0 ? TILES_PER_LINE + 1 : TILES_PER_LINE;
+}
+
+// Return the tileset tile drawn for tile `tile_num` of a tilemap, through its tile indirection
+// table when it has one
+static inline uint16_t get_drawn_tile(const tilemap_info_t* tilemap, uint16_t tile_num) {
+    return tilemap->tile_remap ? tilemap->tile_remap[tile_num] : tile_num;
+}
+
+// Return the tileset tiles drawn for the `num_tiles` tiles from `tilemap_x` in tilemap row
+// `tilemap_y`, which mustn't wrap around the edge of the tilemap. Without a tile indirection table
+// that's the tilemap row itself. With one the whole run is looked up into `remapped` up front so
+// the per tile loops drawing the line are the same either way, an unanimated tilemap only pays for
+// the one test per line.
+static inline const uint16_t* get_drawn_tilemap_line(const tilemap_info_t* tilemap, int tilemap_y,
+    int tilemap_x, int num_tiles, uint16_t* remapped) {
+
+    const uint16_t* tilemap_line = get_tilemap_line(tilemap_y, *tilemap) + tilemap_x;
+    const uint16_t* tile_remap = tilemap->tile_remap;
+
+    if (!tile_remap) {
+        return tilemap_line;
+    }
+
+    for(int tile = 0;tile < num_tiles; ++tile) {
+        remapped[tile] = tile_remap[tilemap_line[tile]];
+    }
+
+    return remapped;
+}
+
+// Given a scanline Y, draw the relevant pixels from the tilemap into the scanline buffer
+void draw_tilemap_line_memcpy(uint16_t line_y, tilemap_info_t tilemap, uint16_t* line_buffer) {
+    // Translate from screen pixel coordinates to tile pixel coordinates using the scroll
+    int layer_y = line_y + tilemap.y_scroll;
+    int layer_x = tilemap.x_scroll;
+
+    // Determine the tilemap Y of the line
+    int tilemap_y = layer_y / TILE_HEIGHT;
+    // Determine the pixel Y of the line within a tile
+    int tile_y = layer_y % TILE_HEIGHT;
+
+    // Determine the tilemap X of the leftmost pixel
+    int tilemap_x = layer_x / TILE_WIDTH;
+    // Determine the pixel X of the leftmost pixel within the first tile
+    int first_tile_x = layer_x % TILE_WIDTH;
+
+    // Due to scroll the first and last tiles in the screen may only be partially displayed.
+    // Determine with width of the first and last tiles
+    int first_tile_visible_width = TILE_WIDTH - first_tile_x;
+    int last_tile_visible_width = first_tile_x;
+
+    // Obtain a pointer to the tiles drawn for this line
+    uint16_t remapped[TILES_PER_LINE + 1];
+    const uint16_t* tilemap_line = get_drawn_tilemap_line(&tilemap, tilemap_y, tilemap_x,
+        line_tile_count(first_tile_x), remapped);
+    // Draw the first tile to the line, this is a special case as it may not be full width
+    // Get a pointer to the pixels for the line in the first tile, offset by first_tile_x
+    const uint16_t* first_tile_line =
+        get_tile_line(*tilemap_line, tile_y, tilemap.tileset) + first_tile_x;
+    // Draw it to the buffer by copying the pixels
+    memcpy(line_buffer, first_tile_line, first_tile_visible_width * 2);
+
+    ++tilemap_line;
+    line_buffer += first_tile_visible_width;
+
+    // Draw the remaining tiles in the line
+    for(int tile = 1;tile < TILES_PER_LINE; ++tile) {
+        // Get a pointer to the pixels for the line in the tile
+        const uint16_t* tile_line = get_tile_line(*tilemap_line, tile_y, tilemap.tileset);
+        // Draw it to the buffer by copying the pixels
+        memcpy(line_buffer, tile_line, TILE_WIDTH * 2);
+        line_buffer += TILE_WIDTH;
+        ++tilemap_line;
+    }
+
+    // When the first tile is only a partial tile, so is the final tile. Draw that final partial
+    // tile here if required.
+    if(first_tile_x != 0) {
+        const uint16_t* last_tile_line = get_tile_line(*tilemap_line, tile_y, tilemap.tileset);
+        memcpy(line_buffer, last_tile_line, last_tile_visible_width * 2);
+    }
+}
+
+bool build_shifted_tileset(tilemap_info_t* tilemap, int num_tiles) {
+    free_shifted_tileset(tilemap);
+
+    if (tilemap->tileset_format != kPixelFormatRGB555) {
+        return false;
+    }
+
+    uint32_t* tileset_shifted =
+        malloc(num_tiles * TILE_HEIGHT * TILE_ROW_WORDS * sizeof(uint32_t));
+    if (!tileset_shifted) {
+        return false;
+    }
+
+    for(int row = 0;row < num_tiles * TILE_HEIGHT; ++row) {
+        const uint16_t* row_data = tilemap->tileset + row * TILE_WIDTH;
+        uint32_t* row_shifted = tileset_shifted + row * TILE_ROW_WORDS;
+
+        // Words are little endian so the leftmost pixel of a pair is in the bottom half
+        for(int word = 0;word < TILE_ROW_WORDS - 1; ++word) {
+            row_shifted[word] = row_data[word * 2 + 1] | ((uint32_t)row_data[word * 2 + 2] << 16);
+        }
+
+        row_shifted[TILE_ROW_WORDS - 1] = row_data[TILE_WIDTH - 1] | ((uint32_t)row_data[0] << 16);
+    }
+
+    tilemap->tileset_shifted = tileset_shifted;
+
+    return true;
+}
+
+void free_shifted_tileset(tilemap_info_t* tilemap) {
+    free(tilemap->tileset_shifted);
+    tilemap->tileset_shifted = NULL;
+}
+
+// Return a row of a tile straight from the tileset, in the tileset's format
+static inline const void* get_tileset_row(const tilemap_info_t* tilemap, uint16_t tile_num,
+    int tile_y) {
+
+    if (tilemap->tileset_format == kPixelFormatRGB555) {
+        return get_tile_line(tile_num, tile_y, tilemap->tileset);
+    }
+
+    return get_indexed_tile_line(tile_num, tile_y, tilemap);
+}
+
+// Return the tile row cache screen line `line_y` is drawn through, NULL if there are none
+static inline tile_row_cache_t* get_line_row_cache(const tilemap_info_t* tilemap,
+    uint16_t line_y) {
+
+    return tilemap->row_caches ? &tilemap->row_caches[line_y % tilemap->num_row_caches] : NULL;
+}
+
+// Entry of a cache a tile row goes in. A line needs the same row of many tiles so rows of the same
+// tile_y never collide (while there are at least as many entries as tiles), with each tile_y
+// moving the tiles to a different part of the cache.
+static inline int tile_row_cache_entry(const tile_row_cache_t* cache, uint16_t tile_num,
+    int tile_y) {
+
+    return (tile_num ^ (tile_y * (cache->num_entries / TILE_HEIGHT))) & (cache->num_entries - 1);
+}
+
+// Return the cache entry holding a tile row, filling it from the tileset if `fill` is set and it
+// isn't present (otherwise returning NULL). `hit` is set when the row was already present.
+static inline const uint32_t* lookup_tile_row_cache(const tilemap_info_t* tilemap,
+    tile_row_cache_t* cache, uint16_t tile_num, int tile_y, bool* hit) {
+
+    int entry = tile_row_cache_entry(cache, tile_num, tile_y);
+    uint32_t tag = tile_num * TILE_HEIGHT + tile_y + 1;
+    uint32_t* row = cache->rows + entry * (cache->row_bytes / 4);
+
+    *hit = cache->tags[entry] == tag;
+    if (!*hit) {
+        memcpy(row, get_tileset_row(tilemap, tile_num, tile_y), cache->row_bytes);
+        cache->tags[entry] = tag;
+    }
+
+    return row;
+}
+
+// Return the tile decode cache screen line `line_y` is drawn through
+static inline tile_decode_cache_t* get_line_decode_cache(const tilemap_info_t* tilemap,
+    uint16_t line_y) {
+
+    return &tilemap->decode_caches[line_y % tilemap->num_decode_caches];
+}
+
+static inline uint8_t* tile_decode_cache_tile(tile_decode_cache_t* cache, int entry) {
+    return (uint8_t*)cache->tiles + entry * cache->tile_bytes;
+}
+
+// Return the cache entry holding a decoded tile, decoding it if it isn't present. `hit` is set
+// when the tile was already present.
+static inline const uint8_t* lookup_tile_decode_cache(const tilemap_info_t* tilemap,
+    tile_decode_cache_t* cache, uint16_t tile_num, bool* hit) {
+
+    int entry = cache->tile_entry[tile_num];
+
+    *hit = entry >= 0;
+    if (!*hit) {
+        while (cache->referenced[cache->next_entry]) {
+            cache->referenced[cache->next_entry] = 0;
+            cache->next_entry = cache->next_entry + 1 == cache->num_entries ?
+                0 : cache->next_entry + 1;
+        }
+
+        entry = cache->next_entry;
+        cache->next_entry = entry + 1 == cache->num_entries ? 0 : entry + 1;
+
+        if (cache->entry_tile[entry] >= 0) {
+            cache->tile_entry[cache->entry_tile[entry]] = -1;
+        }
+
+        decode_compressed_tile(tilemap, tile_num, tile_decode_cache_tile(cache, entry));
+        cache->entry_tile[entry] = tile_num;
+        cache->tile_entry[tile_num] = entry;
+    }
+
+    cache->referenced[entry] = 1;
+
+    return tile_decode_cache_tile(cache, entry);
+}
+
+// Return a row of a tile to draw on screen line `line_y`, decoded through the line's tile decode
+// cache if the tileset is compressed, otherwise through the line's tile row cache if the tilemap
+// has them
+static inline const void* get_cached_tile_row(const tilemap_info_t* tilemap, uint16_t line_y,
+    uint16_t tile_num, int tile_y) {
+
+    if (tilemap->decode_caches) {
+        tile_decode_cache_t* decode_cache = get_line_decode_cache(tilemap, line_y);
+        bool hit;
+        const uint8_t* tile = lookup_tile_decode_cache(tilemap, decode_cache, tile_num, &hit);
+
+        if (hit) {
+            ++decode_cache->hits;
+        } else {
+            ++decode_cache->misses;
+        }
+
+        return tile + tile_y * (decode_cache->tile_bytes / TILE_HEIGHT);
+    }
+
+    tile_row_cache_t* cache = get_line_row_cache(tilemap, line_y);
+    if (!cache) {
+        return get_tileset_row(tilemap, tile_num, tile_y);
+    }
+
+    bool hit;
+    const uint32_t* row = lookup_tile_row_cache(tilemap, cache, tile_num, tile_y, &hit);
+
+    if (hit) {
+        ++cache->hits;
+    } else {
+        ++cache->misses;
+    }
+
+    return row;
+}
+
+// Copy a whole tile row of pixel pairs, written out in full so it's a straight run of word loads
+// and stores
+static inline void copy_tile_row_words(pixel_pair_t* dst, const pixel_pair_t* src) {
+    dst[0] = src[0];
+    dst[1] = src[1];
+    dst[2] = src[2];
+    dst[3] = src[3];
+    dst[4] = src[4];
+    dst[5] = src[5];
+    dst[6] = src[6];
+    dst[7] = src[7];
+}
+
+// With an even X scroll every pixel pair in the line buffer is a pixel pair in the tileset
+static void draw_tilemap_line_even(const uint16_t* tilemap_line, uint16_t line_y, int tile_y,
+    int first_tile_x, const tilemap_info_t* tilemap, pixel_pair_t* line_words) {
+
+    // Pixel pairs of the first tile that are scrolled off the left of the screen
+    int first_word = first_tile_x / 2;
+
+    const pixel_pair_t* tile_line = get_cached_tile_row(tilemap, line_y, *tilemap_line++, tile_y);
+    for(int word = first_word;word < TILE_ROW_WORDS; ++word) {
+        *line_words++ = tile_line[word];
+    }
+
+    for(int tile = 1;tile < TILES_PER_LINE; ++tile) {
+        tile_line = get_cached_tile_row(tilemap, line_y, *tilemap_line++, tile_y);
+        copy_tile_row_words(line_words, tile_line);
+        line_words += TILE_ROW_WORDS;
+    }
+
+    if (first_word != 0) {
+        tile_line = get_cached_tile_row(tilemap, line_y, *tilemap_line, tile_y);
+        for(int word = 0;word < first_word; ++word) {
+            *line_words++ = tile_line[word];
+        }
+    }
+}
+
+// With an odd X scroll pixel pairs in the line buffer are pixels (1, 2) to (13, 14) of a tile,
+// which are words 0 - 6 of the shifted tile row, or pixel 15 of one tile and pixel 0 of the next,
+// which is made from the final word of both shifted tile rows.
+static void draw_tilemap_line_odd(const uint16_t* tilemap_line, int tile_y, int first_tile_x,
+    uint32_t* tileset_shifted, pixel_pair_t* line_words) {
+
+    // Shifted words of the first tile that are scrolled off the left of the screen
+    int first_word = (first_tile_x - 1) / 2;
+
+    pixel_pair_t* prev_tile_line =
+        get_shifted_tile_line(*tilemap_line++, tile_y, tileset_shifted);
+    for(int word = first_word;word < TILE_ROW_WORDS - 1; ++word) {
+        *line_words++ = prev_tile_line[word];
+    }
+
+    for(int tile = 1;tile <= TILES_PER_LINE; ++tile) {
+        pixel_pair_t* tile_line = get_shifted_tile_line(*tilemap_line++, tile_y, tileset_shifted);
+
+        *line_words++ = (prev_tile_line[TILE_ROW_WORDS - 1] & 0xffff) |
+            (tile_line[TILE_ROW_WORDS - 1] & 0xffff0000);
+
+        // The final tile is only partially visible
+        if (tile == TILES_PER_LINE) {
+            for(int word = 0;word < first_word; ++word) {
+                *line_words++ = tile_line[word];
+            }
+            break;
+        }
+
+        for(int word = 0;word < TILE_ROW_WORDS - 1; ++word) {
+            line_words[word] = tile_line[word];
+        }
+        line_words += TILE_ROW_WORDS - 1;
+        prev_tile_line = tile_line;
+    }
+}
+
+// As `draw_tilemap_line_odd` for RGB555 tile rows with no shifted copy, those decoded from a
+// compressed tileset. Every pixel pair in the line buffer is the second pixel of one pair of a
+// tile row and the first of the next, so each pair is shifted into place as it's copied, carrying
+// the half left over on to the next word.
+static void draw_tilemap_line_odd_unshifted(const uint16_t* tilemap_line, uint16_t line_y,
+    int tile_y, int first_tile_x, const tilemap_info_t* tilemap, pixel_pair_t* line_words) {
+
+    int first_pair = first_tile_x / 2;
+
+    const pixel_pair_t* tile_line = get_cached_tile_row(tilemap, line_y, *tilemap_line++, tile_y);
+    uint32_t carry = tile_line[first_pair] >> 16;
+    for(int pair = first_pair + 1;pair < TILE_ROW_WORDS; ++pair) {
+        *line_words++ = carry | (tile_line[pair] << 16);
+        carry = tile_line[pair] >> 16;
+    }
+
+    for(int tile = 1;tile <= TILES_PER_LINE; ++tile) {
+        // Only the pairs up to and including the one holding the final visible pixel are needed
+        // from the last tile
+        int end_pair = tile == TILES_PER_LINE ? first_pair + 1 : TILE_ROW_WORDS;
+        tile_line = get_cached_tile_row(tilemap, line_y, *tilemap_line++, tile_y);
+
+        for(int pair = 0;pair < end_pair; ++pair) {
+            *line_words++ = carry | (tile_line[pair] << 16);
+            carry = tile_line[pair] >> 16;
+        }
+    }
+}
+
+// Return the palette bank used by a tile of an indexed tileset
+static inline int get_tile_bank(uint16_t tile_num, const tilemap_info_t* tilemap) {
+    return tilemap->tileset_format == kPixelFormat4bpp ? tilemap->tile_banks[tile_num] : 0;
+}
+
+// Expand pixel pairs [`first_pair`, `end_pair`) of a row of an indexed tile into `out`
+static inline void expand_tile_pairs(const uint8_t* row, uint16_t tile_num, int first_pair,
+    int end_pair, const tilemap_info_t* tilemap, pixel_pair_t* out) {
+
+    expand_indexed_pairs(row, first_pair, end_pair - first_pair, tilemap->tileset_format,
+        tilemap->palette, get_tile_bank(tile_num, tilemap), out);
+}
+
+// As `expand_tile_pairs` for a tile row drawn on screen line `line_y`
+static inline void expand_line_tile_pairs(uint16_t line_y, uint16_t tile_num, int tile_y,
+    int first_pair, int end_pair, const tilemap_info_t* tilemap, pixel_pair_t* out) {
+
+    expand_tile_pairs(get_cached_tile_row(tilemap, line_y, tile_num, tile_y), tile_num, first_pair,
+        end_pair, tilemap, out);
+}
+
+// Indexed tile rows are expanded a pixel pair at a time. With an even X scroll they're expanded
+// straight into the line buffer. With an odd X scroll every pixel pair in the line buffer is the
+// second pixel of one expanded pair and the first of the next so pairs are expanded into a
+// temporary row and shifted into place, carrying the half left over on to the next word.
+static void draw_tilemap_line_indexed(const uint16_t* tilemap_line, uint16_t line_y, int tile_y,
+    int first_tile_x, const tilemap_info_t* tilemap, pixel_pair_t* line_words) {
+
+    int first_pair = first_tile_x / 2;
+
+    if (!(first_tile_x & 1)) {
+        expand_line_tile_pairs(line_y, *tilemap_line++, tile_y, first_pair, TILE_ROW_WORDS,
+            tilemap, line_words);
+        line_words += TILE_ROW_WORDS - first_pair;
+
+        for(int tile = 1;tile < TILES_PER_LINE; ++tile) {
+            expand_line_tile_pairs(line_y, *tilemap_line++, tile_y, 0, TILE_ROW_WORDS, tilemap,
+                line_words);
+            line_words += TILE_ROW_WORDS;
+        }
+
+        if (first_pair != 0) {
+            expand_line_tile_pairs(line_y, *tilemap_line, tile_y, 0, first_pair, tilemap,
+                line_words);
+        }
+
+        return;
+    }
+
+    pixel_pair_t expanded[TILE_ROW_WORDS];
+    expand_line_tile_pairs(line_y, *tilemap_line++, tile_y, first_pair, TILE_ROW_WORDS, tilemap,
+        expanded);
+
+    uint32_t carry = expanded[0] >> 16;
+    for(int pair = 1;pair < TILE_ROW_WORDS - first_pair; ++pair) {
+        *line_words++ = carry | (expanded[pair] << 16);
+        carry = expanded[pair] >> 16;
+    }
+
+    for(int tile = 1;tile <= TILES_PER_LINE; ++tile) {
+        // Only the pairs up to and including the one holding the final visible pixel are needed
+        // from the last tile
+        int end_pair = tile == TILES_PER_LINE ? first_pair + 1 : TILE_ROW_WORDS;
+        expand_line_tile_pairs(line_y, *tilemap_line++, tile_y, 0, end_pair, tilemap, expanded);
+
+        for(int pair = 0;pair < end_pair; ++pair) {
+            *line_words++ = carry | (expanded[pair] << 16);
+            carry = expanded[pair] >> 16;
+        }
+    }
+}
+
+void draw_tilemap_line(uint16_t line_y, tilemap_info_t tilemap, uint16_t* line_buffer) {
+    if ((tilemap.x_scroll & 1) && !tilemap.tileset_shifted && !tilemap.tileset_compressed &&
+        (tilemap.tileset_format == kPixelFormatRGB555)) {
+
+        draw_tilemap_line_memcpy(line_y, tilemap, line_buffer);
+        return;
+    }
+
+    // Translate from screen pixel coordinates to tile pixel coordinates using the scroll
+    int layer_y = line_y + tilemap.y_scroll;
+    int tilemap_y = layer_y / TILE_HEIGHT;
+    int tile_y = layer_y % TILE_HEIGHT;
+    int tilemap_x = tilemap.x_scroll / TILE_WIDTH;
+    int first_tile_x = tilemap.x_scroll % TILE_WIDTH;
+
+    uint16_t remapped[TILES_PER_LINE + 1];
+    const uint16_t* tilemap_line = get_drawn_tilemap_line(&tilemap, tilemap_y, tilemap_x,
+        line_tile_count(first_tile_x), remapped);
+
+    if (tilemap.tileset_format != kPixelFormatRGB555) {
+        draw_tilemap_line_indexed(tilemap_line, line_y, tile_y, first_tile_x, &tilemap,
+            (pixel_pair_t*)line_buffer);
+    } else if ((first_tile_x & 1) && tilemap.tileset_compressed) {
+        draw_tilemap_line_odd_unshifted(tilemap_line, line_y, tile_y, first_tile_x, &tilemap,
+            (pixel_pair_t*)line_buffer);
+    } else if (first_tile_x & 1) {
+        draw_tilemap_line_odd(tilemap_line, tile_y, first_tile_x, tilemap.tileset_shifted,
+            (pixel_pair_t*)line_buffer);
+    } else {
+        draw_tilemap_line_even(tilemap_line, line_y, tile_y, first_tile_x, &tilemap,
+            (pixel_pair_t*)line_buffer);
+    }
+}
+
+/**************************************************************************************************
+ *                                 Tilemap Layers                                                 *
+ * Up to MAX_TILEMAP_LAYERS tilemaps drawn over one another, each with its own scroll, parallax   *
+ * factor and colour key. Layers are drawn front to back keeping a mask of the pixels of the    *
+ * line already covered by an opaque pixel so no pixel is drawn twice. The back layer should be   *
+ * opaque, any pixels no layer covers are left as they were.                                      *
+ **************************************************************************************************/
+
+tilemap_layer_t tilemap_layers[MAX_TILEMAP_LAYERS];
+int num_tilemap_layers = 0;
+int tilemap_scroll_x = 0;
+int tilemap_scroll_y = 0;
+
+// Return a row of RGB555 pixels from a row of a tile in the tileset's format, indexed rows are
+// expanded into `expanded`
+static inline const uint16_t* get_tile_row_pixels(const void* row, uint16_t tile_num,
+    const tilemap_info_t* tilemap, uint16_t* expanded) {
+
+    if (tilemap->tileset_format == kPixelFormatRGB555) {
+        return row;
+    }
+
+    expand_tile_pairs(row, tile_num, 0, TILE_ROW_WORDS, tilemap, (pixel_pair_t*)expanded);
+
+    return expanded;
+}
+
+bool build_tilemap_layer_opacity(tilemap_layer_t* layer, int num_tiles) {
+    free_tilemap_layer_opacity(layer);
+
+    uint16_t* tile_row_opaque = malloc(num_tiles * TILE_HEIGHT * sizeof(uint16_t));
+    if (!tile_row_opaque) {
+        return false;
+    }
+
+    // RGB332 tiles are compared with the colour key as it's drawn in RGB332
+    bool rgb332 = layer->tilemap.tileset_format == kPixelFormatRGB332;
+    uint8_t rgb332_key = rgb555_to_rgb332(layer->colour_key);
+
+    // Compressed tiles are decoded a tile at a time
+    uint32_t decoded_tile[TILE_ROW_WORDS * TILE_HEIGHT];
+    int row_bytes = pixel_row_bytes(layer->tilemap.tileset_format, TILE_WIDTH);
+
+    for(int row = 0;row < num_tiles * TILE_HEIGHT; ++row) {
+        uint16_t __attribute__ ((aligned (4))) expanded[TILE_WIDTH];
+        uint16_t tile_num = row / TILE_HEIGHT;
+        const void* tileset_row;
+
+        if (layer->tilemap.tileset_compressed) {
+            if (row % TILE_HEIGHT == 0) {
+                decode_compressed_tile(&layer->tilemap, tile_num, decoded_tile);
+            }
+
+            tileset_row = (const uint8_t*)decoded_tile + (row % TILE_HEIGHT) * row_bytes;
+        } else {
+            tileset_row = get_tileset_row(&layer->tilemap, tile_num, row % TILE_HEIGHT);
+        }
+        const uint16_t* row_data = rgb332 ? NULL :
+            get_tile_row_pixels(tileset_row, tile_num, &layer->tilemap, expanded);
+        uint16_t opaque = 0;
+
+        for(int x = 0;x < TILE_WIDTH; ++x) {
+            if (rgb332 ? (((const uint8_t*)tileset_row)[x] != rgb332_key) :
+                (row_data[x] != layer->colour_key)) {
+
+                opaque |= 1 << x;
+            }
+        }
+
+        tile_row_opaque[row] = opaque;
+    }
+
+    layer->tile_row_opaque = tile_row_opaque;
+
+    return true;
+}
+
+void free_tilemap_layer_opacity(tilemap_layer_t* layer) {
+    free(layer->tile_row_opaque);
+    layer->tile_row_opaque = NULL;
+}
+
+// Bit LAYER_COVER_OFFSET + x of the cover mask is set once screen pixel x is covered. Pixels off
+// either side of the screen start covered so tiles partially off screen need no clipping.
+#define LAYER_COVER_OFFSET TILE_WIDTH
+#define LAYER_COVER_WORDS ((LAYER_COVER_OFFSET + SCREEN_WIDTH + TILE_WIDTH + 31) / 32)
+#define TILE_ROW_ALL_OPAQUE ((1 << TILE_WIDTH) - 1)
+
+// Return the TILE_WIDTH bits of the cover mask starting at `bit`
+static inline uint32_t get_cover_bits(const uint32_t* cover, int bit) {
+    int word = bit / 32;
+    int shift = bit % 32;
+    uint32_t bits = cover[word] >> shift;
+
+    if (shift > 32 - TILE_WIDTH) {
+        bits |= cover[word + 1] << (32 - shift);
+    }
+
+    return bits & TILE_ROW_ALL_OPAQUE;
+}
+
+// Set TILE_WIDTH bits of the cover mask starting at `bit`
+static inline void set_cover_bits(uint32_t* cover, int bit, uint32_t bits) {
+    int word = bit / 32;
+    int shift = bit % 32;
+
+    cover[word] |= bits << shift;
+
+    if (shift > 32 - TILE_WIDTH) {
+        cover[word + 1] |= bits >> (32 - shift);
+    }
+}
+
+// Wrap a layer pixel coordinate into the range [0, size)
+static inline int wrap_layer_pos(int pos, int size) {
+    pos %= size;
+
+    return pos < 0 ? pos + size : pos;
+}
+
+static inline bool layer_has_transparency(const tilemap_layer_t* layer) {
+    return layer->has_colour_key && layer->tile_row_opaque;
+}
+
+// Draw the pixels of a layer's line that aren't covered yet and mark its opaque pixels covered.
+// Returns the number of pixels newly covered.
+static int draw_layer_line_covered(const tilemap_layer_t* layer, uint16_t line_y, int layer_x,
+    int layer_y, uint32_t* cover, uint16_t* line_buffer) {
+
+    const tilemap_info_t* tilemap = &layer->tilemap;
+    int tile_y = layer_y % TILE_HEIGHT;
+    int tilemap_x = layer_x / TILE_WIDTH;
+    int first_tile_x = layer_x % TILE_WIDTH;
+    const uint16_t* tilemap_line = get_tilemap_line(layer_y / TILE_HEIGHT, *tilemap);
+
+    bool transparency = layer_has_transparency(layer);
+    // When the first tile is only partially visible so is an extra tile at the end
+    int num_tiles = line_tile_count(first_tile_x);
+    int newly_covered = 0;
+
+    for(int tile = 0;tile < num_tiles; ++tile) {
+        int screen_x = tile * TILE_WIDTH - first_tile_x;
+        int cover_bit = LAYER_COVER_OFFSET + screen_x;
+        uint16_t tile_num = get_drawn_tile(tilemap, tilemap_line[tilemap_x]);
+
+        if (++tilemap_x == tilemap->width) {
+            tilemap_x = 0;
+        }
+
+        uint32_t opaque = transparency ?
+            layer->tile_row_opaque[tile_num * TILE_HEIGHT + tile_y] : TILE_ROW_ALL_OPAQUE;
+        uint32_t draw = opaque & ~get_cover_bits(cover, cover_bit);
+
+        if (draw == 0) {
+            continue;
+        }
+
+        uint16_t __attribute__ ((aligned (4))) expanded[TILE_WIDTH];
+        const uint16_t* tile_line = get_tile_row_pixels(
+            get_cached_tile_row(tilemap, line_y, tile_num, tile_y), tile_num, tilemap, expanded);
+
+        if (draw == TILE_ROW_ALL_OPAQUE) {
+            memcpy(line_buffer + screen_x, tile_line, TILE_WIDTH * 2);
+        } else {
+            for(int x = 0;x < TILE_WIDTH; ++x) {
+                if (draw & (1 << x)) {
+                    line_buffer[screen_x + x] = tile_line[x];
+                }
+            }
+        }
+
+        set_cover_bits(cover, cover_bit, draw);
+        newly_covered += __builtin_popcount(draw);
+    }
+
+    return newly_covered;
+}
+
+// Find the layer pixel coordinates of the leftmost pixel of screen line `line_y` in layer
+// `layer_idx`, given its scroll, parallax and the line's raster effects
+static inline void get_layer_line_pos(int layer_idx, uint16_t line_y, int* layer_x,
+    int* layer_y) {
+
+    const tilemap_layer_t* layer = &tilemap_layers[layer_idx];
+    const tilemap_info_t* tilemap = &layer->tilemap;
+    const raster_line_fx_t* line_fx = &raster_fx->lines[line_y];
+
+    *layer_x = wrap_layer_pos(tilemap->x_scroll + line_fx->layer_x_scroll[layer_idx] +
+        ((tilemap_scroll_x * layer->parallax_x) >> PARALLAX_SHIFT),
+        tilemap->width * TILE_WIDTH);
+    *layer_y = wrap_layer_pos(line_y + tilemap->y_scroll + line_fx->layer_y_scroll[layer_idx] +
+        ((tilemap_scroll_y * layer->parallax_y) >> PARALLAX_SHIFT),
+        tilemap->height * TILE_HEIGHT);
+}
+
+void draw_tilemap_layers_line(uint16_t line_y, uint16_t* line_buffer) {
+    uint32_t cover[LAYER_COVER_WORDS] = {0};
+    set_cover_bits(cover, 0, TILE_ROW_ALL_OPAQUE);
+    set_cover_bits(cover, LAYER_COVER_OFFSET + SCREEN_WIDTH, TILE_ROW_ALL_OPAQUE);
+    int uncovered = SCREEN_WIDTH;
+
+    for(int i = num_tilemap_layers - 1;(i >= 0) && (uncovered > 0); --i) {
+        const tilemap_layer_t* layer = &tilemap_layers[i];
+        const tilemap_info_t* tilemap = &layer->tilemap;
+
+        if (!layer->enabled) {
+            continue;
+        }
+
+        int layer_x;
+        int layer_y;
+        get_layer_line_pos(i, line_y, &layer_x, &layer_y);
+
+        // Nothing in front covers any of the line and this layer is opaque so draw all of it with
+        // aligned copies, provided the line doesn't wrap around the edge of the tilemap.
+        if ((uncovered == SCREEN_WIDTH) && !layer_has_transparency(layer) &&
+            (layer_x / TILE_WIDTH + TILES_PER_LINE < tilemap->width)) {
+
+            tilemap_info_t line_tilemap = *tilemap;
+            line_tilemap.x_scroll = layer_x;
+            line_tilemap.y_scroll = layer_y - line_y;
+            draw_tilemap_line(line_y, line_tilemap, line_buffer);
+
+            return;
+        }
+
+        uncovered -= draw_layer_line_covered(layer, line_y, layer_x, layer_y, cover, line_buffer);
+    }
+}
+
+/**************************************************************************************************
+ *                                 Compressed Tilesets                                            *
+ * Tilesets can be stored compressed a tile at a time (see `make_compressed_tileset.py`) in a     *
+ * fraction of the flash. A tile is a sequence of units, pixels (pixel pairs for 4bpp), written   *
+ * by ops. Each op is a token byte, the top two bits the op and the low six the number of units   *
+ * less one:                                                                                      *
+ *  - Literal: the units follow                                                                   *
+ *  - Fill: the unit that follows repeated                                                        *
+ *  - Copy the row above: the units a tile row back                                               *
+ *  - Copy back: the units a number of units back, given less one by the byte that follows        *
+ *                                                                                                *
+ * Whole tiles are decoded into small SRAM caches, one per core, and lines are drawn from there.  *
+ * A tile's rows are drawn on TILE_HEIGHT lines so the decoding is spread out: prefetching a line *
+ * decodes any of its own tiles missing plus a share of the tiles of the tilemap row below, so by *
+ * the time a line reaches the next tilemap row its tiles are normally decoded already. A miss    *
+ * while drawing decodes the tile there and then, stalling the line. Indexed and RGB332 tilesets  *
+ * are drawn entirely through the caches, as are RGB555 tilesets: at odd X scroll positions each  *
+ * decoded row is shifted by a pixel as it's copied out, so neither the uncompressed tileset nor  *
+ * a shifted one is needed.                                                                       *
+ **************************************************************************************************/
+
+enum {
+    kTileOpLiteral = 0,
+    kTileOpFill = 1,
+    kTileOpCopyRowAbove = 2,
+    kTileOpCopyBack = 3
+};
+
+#define TILE_OP_SHIFT 6
+#define TILE_OP_UNITS_MASK 0x3f
+
+bool build_tile_decode_caches(tilemap_info_t* tilemap, int num_caches, int num_entries) {
+    free_tile_decode_caches(tilemap);
+
+    int tile_bytes = pixel_row_bytes(tilemap->tileset_format, TILE_WIDTH) * TILE_HEIGHT;
+    tile_decode_cache_t* caches = calloc(num_caches, sizeof(tile_decode_cache_t));
+    if (!caches) {
+        return false;
+    }
+
+    int num_tiles = tilemap->tileset_compressed->num_tiles;
+
+    for(int i = 0;i < num_caches; ++i) {
+        caches[i].num_entries = num_entries;
+        caches[i].tile_bytes = tile_bytes;
+        caches[i].entry_tile = malloc(num_entries * sizeof(int32_t));
+        caches[i].tile_entry = malloc(num_tiles * sizeof(int16_t));
+        caches[i].referenced = calloc(num_entries, sizeof(uint8_t));
+        caches[i].next_entry = 0;
+        caches[i].tiles = malloc(num_entries * tile_bytes);
+
+        if (!caches[i].entry_tile || !caches[i].tile_entry || !caches[i].referenced ||
+            !caches[i].tiles) {
+
+            tilemap->decode_caches = caches;
+            tilemap->num_decode_caches = i + 1;
+            free_tile_decode_caches(tilemap);
+
+            return false;
+        }
+
+        for(int entry = 0;entry < num_entries; ++entry) {
+            caches[i].entry_tile[entry] = -1;
+        }
+
+        for(int tile = 0;tile < num_tiles; ++tile) {
+            caches[i].tile_entry[tile] = -1;
+        }
+    }
+
+    tilemap->decode_caches = caches;
+    tilemap->num_decode_caches = num_caches;
+
+    return true;
+}
+
+void free_tile_decode_caches(tilemap_info_t* tilemap) {
+    for(int i = 0;tilemap->decode_caches && i < tilemap->num_decode_caches; ++i) {
+        free(tilemap->decode_caches[i].entry_tile);
+        free(tilemap->decode_caches[i].tile_entry);
+        free(tilemap->decode_caches[i].referenced);
+        free(tilemap->decode_caches[i].tiles);
+    }
+
+    free(tilemap->decode_caches);
+    tilemap->decode_caches = NULL;
+    tilemap->num_decode_caches = 0;
+}
+
+void reset_tile_decode_cache_stats(const tilemap_info_t* tilemap) {
+    for(int i = 0;i < tilemap->num_decode_caches; ++i) {
+        tilemap->decode_caches[i].hits = 0;
+        tilemap->decode_caches[i].misses = 0;
+        tilemap->decode_caches[i].prefetch_decodes = 0;
+    }
+}
+
+// Copy `len` bytes from `src` to `dst`, where `src` is before `dst`. Where they overlap the copy
+// goes a byte at a time in order, repeating the bytes between them.
+static inline void copy_back_bytes(uint8_t* dst, const uint8_t* src, int len) {
+    if (dst - src >= len) {
+        memcpy(dst, src, len);
+        return;
+    }
+
+    for(int i = 0;i < len; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+void decode_compressed_tile(const tilemap_info_t* tilemap, uint16_t tile_num, void* tile) {
+    const compressed_tileset_t* compressed = tilemap->tileset_compressed;
+    const uint8_t* src = compressed->data + compressed->offsets[tile_num];
+    const uint8_t* src_end = compressed->data + compressed->offsets[tile_num + 1];
+    int unit_bytes = tilemap->tileset_format == kPixelFormatRGB555 ? 2 : 1;
+    int row_bytes = pixel_row_bytes(tilemap->tileset_format, TILE_WIDTH);
+    uint8_t* dst = tile;
+
+    while (src < src_end) {
+        uint8_t token = *src++;
+        int len = ((token & TILE_OP_UNITS_MASK) + 1) * unit_bytes;
+
+        switch (token >> TILE_OP_SHIFT) {
+            case kTileOpLiteral:
+                memcpy(dst, src, len);
+                src += len;
+                break;
+            case kTileOpFill:
+                if (unit_bytes == 1) {
+                    memset(dst, *src, len);
+                } else {
+                    for(int i = 0;i < len; i += 2) {
+                        dst[i] = src[0];
+                        dst[i + 1] = src[1];
+                    }
+                }
+                src += unit_bytes;
+                break;
+            case kTileOpCopyRowAbove:
+                copy_back_bytes(dst, dst - row_bytes, len);
+                break;
+            case kTileOpCopyBack:
+                copy_back_bytes(dst, dst - (*src++ + 1) * unit_bytes, len);
+                break;
+        }
+
+        dst += len;
+    }
+}
+
+// Decode any of `num_tiles` tiles starting from `tilemap_x` in tilemap row `tilemap_y` missing from
+// `cache`, wrapping around the edge of the tilemap
+static void prefetch_decoded_tile_run(const tilemap_info_t* tilemap, tile_decode_cache_t* cache,
+    int tilemap_x, int tilemap_y, int num_tiles) {
+
+    const uint16_t* tilemap_line = get_tilemap_line(tilemap_y, *tilemap);
+
+    for(int tile = 0;tile < num_tiles; ++tile) {
+        bool hit;
+        lookup_tile_decode_cache(tilemap, cache, get_drawn_tile(tilemap, tilemap_line[tilemap_x]),
+            &hit);
+
+        if (!hit) {
+            ++cache->prefetch_decodes;
+        }
+
+        if (++tilemap_x == tilemap->width) {
+            tilemap_x = 0;
+        }
+    }
+}
+
+// Decode the tiles of screen line `line_y`, showing row `tile_y` of `num_tiles` tiles starting from
+// `tilemap_x` in tilemap row `tilemap_y`, plus this line's share of the tiles below them. A core
+// draws every `num_decode_caches` line so its lines in a tilemap row share out the tiles of the row
+// below, over the lines of the row that are on screen.
+static void prefetch_decoded_tiles(const tilemap_info_t* tilemap, tile_decode_cache_t* cache,
+    uint16_t line_y, int tilemap_x, int tilemap_y, int tile_y, int num_tiles) {
+
+    prefetch_decoded_tile_run(tilemap, cache, tilemap_x, tilemap_y, num_tiles);
+
+    // Nothing to do when the row below starts off the bottom of the screen
+    if (line_y - tile_y + TILE_HEIGHT >= SCREEN_HEIGHT) {
+        return;
+    }
+
+    // The top row on screen may start part way through
+    int first_tile_y = line_y < tile_y ? tile_y - line_y : 0;
+    int num_rows = TILE_HEIGHT - first_tile_y;
+    int num_caches = tilemap->num_decode_caches;
+    int share = (tile_y - first_tile_y) - (tile_y - first_tile_y) % num_caches;
+    int first_tile = (share * num_tiles) / num_rows;
+    int end_tile = ((share + num_caches) * num_tiles) / num_rows;
+
+    if (end_tile > num_tiles) {
+        end_tile = num_tiles;
+    }
+
+    if (first_tile < end_tile) {
+        prefetch_decoded_tile_run(tilemap, cache, (tilemap_x + first_tile) % tilemap->width,
+            tilemap_y + 1 == tilemap->height ? 0 : tilemap_y + 1, end_tile - first_tile);
+    }
+}
+
+/**************************************************************************************************
+ *                                 Tile Row Cache                                                 *
+ * Tilesets can be left in flash, read through the XIP cache, rather than copied into SRAM. An    *
+ * XIP miss stalls the core for a flash read so the tile rows a line needs are copied into a      *
+ * small SRAM cache ahead of the line being drawn, while the core would otherwise sit idle, and   *
+ * drawn from there. Rows are only read from flash while drawing if they weren't prefetched or    *
+ * were evicted before use. Each cache belongs to a single core so needs no locking.              *
+ **************************************************************************************************/
+
+bool build_tile_row_caches(tilemap_info_t* tilemap, int num_caches, int num_entries) {
+    free_tile_row_caches(tilemap);
+
+    int row_bytes = pixel_row_bytes(tilemap->tileset_format, TILE_WIDTH);
+    tile_row_cache_t* caches = calloc(num_caches, sizeof(tile_row_cache_t));
+    if (!caches) {
+        return false;
+    }
+
+    for(int i = 0;i < num_caches; ++i) {
+        caches[i].num_entries = num_entries;
+        caches[i].row_bytes = row_bytes;
+        caches[i].tags = calloc(num_entries, sizeof(uint32_t));
+        caches[i].rows = malloc(num_entries * row_bytes);
+
+        if (!caches[i].tags || !caches[i].rows) {
+            tilemap->row_caches = caches;
+            tilemap->num_row_caches = i + 1;
+            free_tile_row_caches(tilemap);
+
+            return false;
+        }
+    }
+
+    tilemap->row_caches = caches;
+    tilemap->num_row_caches = num_caches;
+
+    return true;
+}
+
+void free_tile_row_caches(tilemap_info_t* tilemap) {
+    for(int i = 0;tilemap->row_caches && i < tilemap->num_row_caches; ++i) {
+        free(tilemap->row_caches[i].tags);
+        free(tilemap->row_caches[i].rows);
+    }
+
+    free(tilemap->row_caches);
+    tilemap->row_caches = NULL;
+    tilemap->num_row_caches = 0;
+}
+
+void reset_tile_row_cache_stats(const tilemap_info_t* tilemap) {
+    for(int i = 0;i < tilemap->num_row_caches; ++i) {
+        tilemap->row_caches[i].hits = 0;
+        tilemap->row_caches[i].misses = 0;
+        tilemap->row_caches[i].prefetch_fills = 0;
+    }
+}
+
+// Bring row `tile_y` of `num_tiles` tiles starting from `tilemap_x` in tilemap row `tilemap_y`
+// into `cache`, wrapping around the edge of the tilemap
+static void prefetch_tile_rows(const tilemap_info_t* tilemap, tile_row_cache_t* cache,
+    int tilemap_x, int tilemap_y, int tile_y, int num_tiles) {
+
+    const uint16_t* tilemap_line = get_tilemap_line(tilemap_y, *tilemap);
+
+    for(int tile = 0;tile < num_tiles; ++tile) {
+        bool hit;
+        lookup_tile_row_cache(tilemap, cache, get_drawn_tile(tilemap, tilemap_line[tilemap_x]),
+            tile_y, &hit);
+
+        if (!hit) {
+            ++cache->prefetch_fills;
+        }
+
+        if (++tilemap_x == tilemap->width) {
+            tilemap_x = 0;
+        }
+    }
+}
+
+// Prefetch the tiles of screen line `line_y` of a tilemap, at tilemap pixel position `layer_x`,
+// `layer_y`, into its tile decode or row caches
+static void prefetch_line_tiles(const tilemap_info_t* tilemap, uint16_t line_y, int layer_x,
+    int layer_y) {
+
+    int num_tiles = line_tile_count(layer_x % TILE_WIDTH);
+
+    if (tilemap->decode_caches) {
+        prefetch_decoded_tiles(tilemap, get_line_decode_cache(tilemap, line_y), line_y,
+            layer_x / TILE_WIDTH, layer_y / TILE_HEIGHT, layer_y % TILE_HEIGHT, num_tiles);
+    } else if (tilemap->row_caches) {
+        prefetch_tile_rows(tilemap, get_line_row_cache(tilemap, line_y), layer_x / TILE_WIDTH,
+            layer_y / TILE_HEIGHT, layer_y % TILE_HEIGHT, num_tiles);
+    }
+}
+
+void prefetch_tilemap_line(uint16_t line_y, tilemap_info_t tilemap) {
+    prefetch_line_tiles(&tilemap, line_y, tilemap.x_scroll, line_y + tilemap.y_scroll);
+}
+
+void prefetch_tilemap_layers_line(uint16_t line_y) {
+    for(int i = num_tilemap_layers - 1;i >= 0; --i) {
+        const tilemap_layer_t* layer = &tilemap_layers[i];
+
+        if (!layer->enabled) {
+            continue;
+        }
+
+        if (layer->tilemap.decode_caches || layer->tilemap.row_caches) {
+            int layer_x;
+            int layer_y;
+            get_layer_line_pos(i, line_y, &layer_x, &layer_y);
+
+            prefetch_line_tiles(&layer->tilemap, line_y, layer_x, layer_y);
+        }
+
+        // Nothing behind an opaque layer is drawn
+        if (!layer_has_transparency(layer)) {
+            break;
+        }
+    }
+}
+
+/**************************************************************************************************
+ *                                 Raster Effects                                                 *
+ * Tables of per scanline effects, in the manner of the SNES's HDMA. Each line of a table can     *
+ * offset the scroll of every tilemap layer and of the sprites and pick a colour transform to be  *
+ * applied to the finished line. The drawing code looks up its line in the table so effects such  *
+ * as wavy water, split scrolling or gradients need no code of their own. Tables are double       *
+ * buffered, the next frame's table is filled in while the current one is in use.                 *
+ **************************************************************************************************/
+
+static raster_fx_table_t raster_fx_tables[2];
+raster_fx_table_t* raster_fx = &raster_fx_tables[0];
+raster_fx_table_t* raster_fx_next = &raster_fx_tables[1];
+
+raster_colour_transform_t raster_colour_transforms[MAX_RASTER_COLOUR_TRANSFORMS];
+
+void swap_raster_fx() {
+    raster_fx_table_t* table = raster_fx;
+    raster_fx = raster_fx_next;
+    raster_fx_next = table;
+}
+
+void clear_raster_fx(raster_fx_table_t* table) {
+    memset(table, 0, sizeof(raster_fx_table_t));
+}
+
+void set_raster_colour_transform(int transform, const int scale[3], const int offset[3]) {
+    uint16_t* channels[3] = {
+        raster_colour_transforms[transform].red,
+        raster_colour_transforms[transform].green,
+        raster_colour_transforms[transform].blue
+    };
+
+    for(int channel = 0;channel < 3; ++channel) {
+        for(int value = 0;value < 32; ++value) {
+            int transformed = ((value * scale[channel]) / RASTER_COLOUR_ONE) + offset[channel];
+
+            if (transformed < 0) {
+                transformed = 0;
+            } else if (transformed > 31) {
+                transformed = 31;
+            }
+
+            channels[channel][value] = transformed << (channel * 5);
+        }
+    }
+}
+
+void apply_raster_colour_transform(uint16_t line_y, uint16_t* line_buffer) {
+    int transform_idx = raster_fx->lines[line_y].colour_transform;
+
+    if (transform_idx == 0) {
+        return;
+    }
+
+    const raster_colour_transform_t* transform = &raster_colour_transforms[transform_idx];
+
+    for(int x = 0;x < SCREEN_WIDTH; ++x) {
+        uint16_t pixel = line_buffer[x];
+
+        line_buffer[x] = transform->red[pixel & 0x1f] | transform->green[(pixel >> 5) & 0x1f] |
+            transform->blue[(pixel >> 10) & 0x1f];
+    }
+}
+
+/**************************************************************************************************
+ *                                 Framebuffer                                                    *
+ * An 8bpp framebuffer drawn into with random access and expanded through its palette a line at a *
+ * time, either over the whole screen or as a window over the tilemap layers. Opaque lines are    *
+ * expanded a pixel pair at a time as 8bpp tiles are, transparent ones skip runs of 4 transparent *
+ * pixels with a single word test.                                                                *
+ **************************************************************************************************/
+
+framebuffer_t framebuffer;
+
+bool build_framebuffer(framebuffer_t* fb, int width, int height) {
+    free_framebuffer(fb);
+
+    fb->pixels = calloc(width * height, 1);
+    if (!fb->pixels) {
+        return false;
+    }
+
+    fb->width = width;
+    fb->height = height;
+    fb->x = 0;
+    fb->y = 0;
+
+    return true;
+}
+
+void free_framebuffer(framebuffer_t* fb) {
+    free(fb->pixels);
+    fb->pixels = NULL;
+    fb->width = 0;
+    fb->height = 0;
+}
+
+void framebuffer_clear(framebuffer_t* fb, uint8_t colour) {
+    memset(fb->pixels, colour, fb->width * fb->height);
+}
+
+// Bresenham's line algorithm, every pixel is clipped as it's plotted
+void framebuffer_draw_line(framebuffer_t* fb, int x0, int y0, int x1, int y1, uint8_t colour) {
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int step_x = x0 < x1 ? 1 : -1;
+    int step_y = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+
+    while (true) {
+        framebuffer_plot(fb, x0, y0, colour);
+
+        if ((x0 == x1) && (y0 == y1)) {
+            break;
+        }
+
+        int error2 = error * 2;
+        if (error2 >= dy) {
+            error += dy;
+            x0 += step_x;
+        }
+
+        if (error2 <= dx) {
+            error += dx;
+            y0 += step_y;
+        }
+    }
+}
+
+void framebuffer_blit(framebuffer_t* fb, const uint8_t* image, int width, int height, int x, int y,
+    bool colour_zero_transparent, int colour_offset) {
+
+    // Clip the image to the framebuffer
+    int first_x = MAX(0, -x);
+    int end_x = MIN(width, fb->width - x);
+    int first_y = MAX(0, -y);
+    int end_y = MIN(height, fb->height - y);
+
+    for(int image_y = first_y;image_y < end_y; ++image_y) {
+        const uint8_t* src = image + image_y * width;
+        uint8_t* dst = fb->pixels + (y + image_y) * fb->width + x;
+
+        if (!colour_zero_transparent && (colour_offset == 0)) {
+            memcpy(dst + first_x, src + first_x, end_x - first_x);
+            continue;
+        }
+
+        for(int image_x = first_x;image_x < end_x; ++image_x) {
+            uint8_t index = src[image_x];
+
+            if (index != 0) {
+                dst[image_x] = index + colour_offset;
+            } else if (!colour_zero_transparent) {
+                dst[image_x] = 0;
+            }
+        }
+    }
+}
+
+bool framebuffer_covers_line(const framebuffer_t* fb, uint16_t line_y) {
+    return fb->enabled && !fb->colour_zero_transparent && (fb->x <= 0) &&
+        (fb->x + fb->width >= SCREEN_WIDTH) && (line_y >= fb->y) && (line_y < fb->y + fb->height);
+}
+
+void draw_framebuffer_line(uint16_t line_y, const framebuffer_t* fb, uint16_t* line_buffer) {
+    int fb_y = line_y - fb->y;
+
+    if (!fb->enabled || (fb_y < 0) || (fb_y >= fb->height)) {
+        return;
+    }
+
+    // Clip the framebuffer row to the screen, `out` and `row` are both indexed by framebuffer X
+    int first_x = MAX(0, -fb->x);
+    int end_x = MIN(fb->width, SCREEN_WIDTH - fb->x);
+    const uint8_t* row = fb->pixels + fb_y * fb->width;
+    const uint16_t* colours = fb->palette->colours;
+    uint16_t* out = line_buffer + fb->x;
+
+    if (first_x >= end_x) {
+        return;
+    }
+
+    if (!fb->colour_zero_transparent) {
+        int x = first_x;
+
+        // Expand pairs where they land on aligned words of the line buffer, with any single pixels
+        // at either end done on their own
+        if ((fb->x + x) & 1) {
+            out[x] = colours[row[x]];
+            ++x;
+        }
+
+        int num_pairs = (end_x - x) / 2;
+        expand_indexed_pairs(row + x, 0, num_pairs, kPixelFormat8bpp, fb->palette, 0,
+            (pixel_pair_t*)(out + x));
+        x += num_pairs * 2;
+
+        if (x < end_x) {
+            out[x] = colours[row[x]];
+        }
+
+        return;
+    }
+
+    for(int x = first_x;x < end_x; x += 4) {
+        int num_pixels = MIN(4, end_x - x);
+
+        if (num_pixels == 4) {
+            uint32_t quad;
+            memcpy(&quad, row + x, sizeof(quad));
+
+            if (quad == 0) {
+                continue;
+            }
+        }
+
+        for(int i = 0;i < num_pixels; ++i) {
+            uint8_t index = row[x + i];
+
+            if (index != 0) {
+                out[x + i] = colours[index];
+            }
+        }
+    }
+}
+
+/**************************************************************************************************
+ *                                 Line Cache                                                     *
+ * Finished lines are kept from frame to frame. Rather than tracking every change as it's made,   *
+ * once a frame the scene is compared with a copy of the state the cached lines were drawn from.  *
+ * Anything that moves the whole screen redraws every line, sprites and raster effects only       *
+ * redraw the lines they're on.                                                                   *
+ **************************************************************************************************/
+
+line_cache_t line_cache;
+
+static inline void set_line_bits(uint32_t* bits, int first_line, int end_line) {
+    if (first_line < 0) {
+        first_line = 0;
+    }
+
+    if (end_line > SCREEN_HEIGHT) {
+        end_line = SCREEN_HEIGHT;
+    }
+
+    for(int line = first_line;line < end_line; ++line) {
+        bits[line / 32] |= 1u << (line % 32);
+    }
+}
+
+static inline bool is_line_bit_set(const uint32_t* bits, int line) {
+    return (bits[line / 32] >> (line % 32)) & 1;
+}
+
+bool build_line_cache() {
+    free_line_cache();
+
+    uint16_t* lines = malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t));
+    sprite_info_t* sprites = malloc(NUM_SPRITES * sizeof(sprite_info_t));
+    if (!lines || !sprites) {
+        free(lines);
+        free(sprites);
+        return false;
+    }
+
+    // Nothing is cached yet so every line is drawn until the next update, and on the frame after it
+    set_line_bits(line_cache.redraw, 0, SCREEN_HEIGHT);
+    set_line_bits(line_cache.marked, 0, SCREEN_HEIGHT);
+    line_cache.sprites = sprites;
+    line_cache.lines = lines;
+
+    return true;
+}
+
+void free_line_cache() {
+    free(line_cache.lines);
+    free(line_cache.sprites);
+    line_cache = (line_cache_t){0};
+}
+
+void mark_lines_dirty(int first_line, int end_line) {
+    set_line_bits(line_cache.marked, first_line, end_line);
+}
+
+void mark_layer_tile_dirty(int layer_idx, int tile_y) {
+    for(int line = 0;line < SCREEN_HEIGHT; ++line) {
+        int layer_x, layer_y;
+        get_layer_line_pos(layer_idx, line, &layer_x, &layer_y);
+
+        if (layer_y / TILE_HEIGHT == tile_y) {
+            set_line_bits(line_cache.marked, line, line + 1);
+        }
+    }
+}
+
+void update_line_cache() {
+    if (!line_cache.lines) {
+        return;
+    }
+
+    memcpy(line_cache.redraw, line_cache.marked, sizeof(line_cache.redraw));
+    memset(line_cache.marked, 0, sizeof(line_cache.marked));
+
+    int scroll[4] = {tilemap_scroll_x, tilemap_scroll_y, sprite_scroll_x, sprite_scroll_y};
+
+    if ((memcmp(scroll, line_cache.scroll, sizeof(scroll)) != 0) ||
+        (num_tilemap_layers != line_cache.num_layers) ||
+        (memcmp(tilemap_layers, line_cache.layers, sizeof(tilemap_layers)) != 0) ||
+        (memcmp(&framebuffer, &line_cache.framebuffer, sizeof(framebuffer_t)) != 0)) {
+
+        set_line_bits(line_cache.redraw, 0, SCREEN_HEIGHT);
+    } else {
+        // Sprite scroll is unchanged so a changed sprite only affects the lines it was on and the
+        // lines it's now on
+        for(int i = 0;i < NUM_SPRITES; ++i) {
+            const sprite_info_t* cached = &line_cache.sprites[i];
+
+            if (memcmp(&screen_sprites[i], cached, sizeof(sprite_info_t)) == 0) {
+                continue;
+            }
+
+            int first_line, end_line;
+            if (cached->enabled) {
+                get_sprite_screen_lines(cached, &first_line, &end_line);
+                set_line_bits(line_cache.redraw, first_line, end_line);
+            }
+
+            if (screen_sprites[i].enabled) {
+                get_sprite_screen_lines(&screen_sprites[i], &first_line, &end_line);
+                set_line_bits(line_cache.redraw, first_line, end_line);
+            }
+        }
+
+        for(int line = 0;line < SCREEN_HEIGHT; ++line) {
+            bool rotated = (sprite_overflow_policy == kSpriteOverflowRotate) &&
+                (sprite_line_dropped[line] != 0);
+
+            if (rotated || (memcmp(&raster_fx->lines[line], &line_cache.line_fx[line],
+                sizeof(raster_line_fx_t)) != 0)) {
+
+                set_line_bits(line_cache.redraw, line, line + 1);
+            }
+        }
+    }
+
+    memcpy(line_cache.scroll, scroll, sizeof(scroll));
+    memcpy(line_cache.layers, tilemap_layers, sizeof(tilemap_layers));
+    line_cache.num_layers = num_tilemap_layers;
+    memcpy(&line_cache.framebuffer, &framebuffer, sizeof(framebuffer_t));
+    memcpy(line_cache.sprites, screen_sprites, NUM_SPRITES * sizeof(sprite_info_t));
+    memcpy(line_cache.line_fx, raster_fx->lines, sizeof(line_cache.line_fx));
+
+    int num_redrawn = 0;
+    for(int word = 0;word < LINE_CACHE_WORDS; ++word) {
+        num_redrawn += __builtin_popcount(line_cache.redraw[word]);
+    }
+
+    line_cache.frame_reused_lines = SCREEN_HEIGHT - num_redrawn;
+    line_cache.reused_lines += line_cache.frame_reused_lines;
+    line_cache.drawn_lines += num_redrawn;
+}
+
+bool get_cached_line(uint16_t line_y, uint16_t* line_buffer) {
+    if (!line_cache.lines || is_line_bit_set(line_cache.redraw, line_y)) {
+        return false;
+    }
+
+    memcpy(line_buffer, line_cache.lines + line_y * SCREEN_WIDTH,
+        SCREEN_WIDTH * sizeof(uint16_t));
+
+    return true;
+}
+
+void store_cached_line(uint16_t line_y, const uint16_t* line_buffer) {
+    if (line_cache.lines) {
+        memcpy(line_cache.lines + line_y * SCREEN_WIDTH, line_buffer,
+            SCREEN_WIDTH * sizeof(uint16_t));
+    }
+}
+
+/**************************************************************************************************
+ *                                 RGB332 Output                                                  *
+ * RGB332 tile rows and sprite lines are copied straight into the line buffer. Rows in any other  *
+ * format are first converted into a temporary row a pixel at a time, indexed pixels with a       *
+ * single byte lookup.                                                                            *
+ **************************************************************************************************/
+
+bool build_palette_rgb332(palette_t* palette) {
+    free_palette_rgb332(palette);
+
+    uint8_t* rgb332 = malloc(palette->num_colours);
+    if (!rgb332) {
+        return false;
+    }
+
+    for(int i = 0;i < palette->num_colours; ++i) {
+        rgb332[i] = rgb555_to_rgb332(palette->colours[i]);
+    }
+
+    palette->rgb332 = rgb332;
+
+    return true;
+}
+
+void free_palette_rgb332(palette_t* palette) {
+    free(palette->rgb332);
+    palette->rgb332 = NULL;
+}
+
+// Convert a row of `width` pixels in `format` to RGB332 in `out`, mirrored horizontally when
+// `flip_x` is set. Indexed pixels are looked up in bank `bank` of `palette->rgb332`.
+static inline void convert_row_rgb332(const uint8_t* row, int width, pixel_format_t format,
+    const palette_t* palette, int bank, bool flip_x, uint8_t* out) {
+
+    int step = flip_x ? -1 : 1;
+    out += flip_x ? width - 1 : 0;
+
+    if (format == kPixelFormatRGB332) {
+        for(int x = 0;x < width; ++x) {
+            out[x * step] = row[x];
+        }
+    } else if (format == kPixelFormat8bpp) {
+        const uint8_t* rgb332 = palette->rgb332;
+
+        for(int x = 0;x < width; ++x) {
+            out[x * step] = rgb332[row[x]];
+        }
+    } else if (format == kPixelFormat4bpp) {
+        const uint8_t* rgb332 = palette->rgb332 + bank * PALETTE_BANK_COLOURS;
+
+        for(int x = 0;x < width; ++x) {
+            out[x * step] = rgb332[(row[x / 2] >> ((x & 1) * 4)) & 0xf];
+        }
+    } else {
+        const uint16_t* pixels = (const uint16_t*)row;
+
+        for(int x = 0;x < width; ++x) {
+            out[x * step] = rgb555_to_rgb332(pixels[x]);
+        }
+    }
+}
+
+// Return a row of RGB332 pixels of a tile to draw on screen line `line_y`, rows in other formats
+// are converted into `converted`
+static inline const uint8_t* get_tile_row_rgb332(const tilemap_info_t* tilemap, uint16_t line_y,
+    uint16_t tile_num, int tile_y, uint8_t* converted) {
+
+    const uint8_t* row = get_cached_tile_row(tilemap, line_y, tile_num, tile_y);
+
+    if (tilemap->tileset_format == kPixelFormatRGB332) {
+        return row;
+    }
+
+    convert_row_rgb332(row, TILE_WIDTH, tilemap->tileset_format, tilemap->palette,
+        get_tile_bank(tile_num, tilemap), false, converted);
+
+    return converted;
+}
+
+// Draw a line of a tilemap starting from pixel `layer_x`, `layer_y` of it, wrapping around its
+// edges. With `tile_row_opaque` (see `tilemap_layer_t`) only the opaque pixels of each tile row
+// are drawn.
+static void draw_tilemap_row_rgb332(const tilemap_info_t* tilemap,
+    const uint16_t* tile_row_opaque, uint16_t line_y, int layer_x, int layer_y,
+    uint8_t* line_buffer) {
+
+    int tile_y = layer_y % TILE_HEIGHT;
+    int tilemap_x = layer_x / TILE_WIDTH;
+    int first_tile_x = layer_x % TILE_WIDTH;
+    const uint16_t* tilemap_line = get_tilemap_line(layer_y / TILE_HEIGHT, *tilemap);
+    int num_tiles = line_tile_count(first_tile_x);
+
+    for(int tile = 0;tile < num_tiles; ++tile) {
+        int screen_x = tile * TILE_WIDTH - first_tile_x;
+        uint16_t tile_num = get_drawn_tile(tilemap, tilemap_line[tilemap_x]);
+
+        if (++tilemap_x == tilemap->width) {
+            tilemap_x = 0;
+        }
+
+        uint32_t opaque = tile_row_opaque ?
+            tile_row_opaque[tile_num * TILE_HEIGHT + tile_y] : TILE_ROW_ALL_OPAQUE;
+
+        if (opaque == 0) {
+            continue;
+        }
+
+        // Clip the first and last tiles to the screen
+        int first_x = MAX(0, -screen_x);
+        int end_x = MIN(TILE_WIDTH, SCREEN_WIDTH - screen_x);
+
+        // Whole opaque rows of indexed tiles are looked up straight into the line
+        if ((opaque == TILE_ROW_ALL_OPAQUE) && (first_x == 0) && (end_x == TILE_WIDTH) &&
+            (tilemap->tileset_format != kPixelFormatRGB332) &&
+            (tilemap->tileset_format != kPixelFormatRGB555)) {
+
+            convert_row_rgb332(get_cached_tile_row(tilemap, line_y, tile_num, tile_y), TILE_WIDTH,
+                tilemap->tileset_format, tilemap->palette, get_tile_bank(tile_num, tilemap),
+                false, line_buffer + screen_x);
+            continue;
+        }
+
+        uint8_t __attribute__ ((aligned (4))) converted[TILE_WIDTH];
+        const uint8_t* tile_line = get_tile_row_rgb332(tilemap, line_y, tile_num, tile_y,
+            converted);
+
+        if (opaque == TILE_ROW_ALL_OPAQUE) {
+            memcpy(line_buffer + screen_x + first_x, tile_line + first_x, end_x - first_x);
+        } else {
+            for(int x = first_x;x < end_x; ++x) {
+                if (opaque & (1 << x)) {
+                    line_buffer[screen_x + x] = tile_line[x];
+                }
+            }
+        }
+    }
+}
+
+void draw_tilemap_line_rgb332(uint16_t line_y, tilemap_info_t tilemap, uint8_t* line_buffer) {
+    draw_tilemap_row_rgb332(&tilemap, NULL, line_y,
+        wrap_layer_pos(tilemap.x_scroll, tilemap.width * TILE_WIDTH),
+        wrap_layer_pos(line_y + tilemap.y_scroll, tilemap.height * TILE_HEIGHT), line_buffer);
+}
+
+void draw_tilemap_layers_line_rgb332(uint16_t line_y, uint8_t* line_buffer) {
+    // Everything behind the frontmost opaque layer is hidden
+    int first_layer = 0;
+
+    for(int i = num_tilemap_layers - 1;i >= 0; --i) {
+        if (tilemap_layers[i].enabled && !layer_has_transparency(&tilemap_layers[i])) {
+            first_layer = i;
+            break;
+        }
+    }
+
+    for(int i = first_layer;i < num_tilemap_layers; ++i) {
+        const tilemap_layer_t* layer = &tilemap_layers[i];
+
+        if (!layer->enabled) {
+            continue;
+        }
+
+        int layer_x;
+        int layer_y;
+        get_layer_line_pos(i, line_y, &layer_x, &layer_y);
+
+        draw_tilemap_row_rgb332(&layer->tilemap,
+            layer_has_transparency(layer) ? layer->tile_row_opaque : NULL, line_y, layer_x,
+            layer_y, line_buffer);
+    }
+}
+
+void draw_framebuffer_line_rgb332(uint16_t line_y, const framebuffer_t* fb, uint8_t* line_buffer) {
+    int fb_y = line_y - fb->y;
+
+    if (!fb->enabled || (fb_y < 0) || (fb_y >= fb->height)) {
+        return;
+    }
+
+    // Clip the framebuffer row to the screen, `out` and `row` are both indexed by framebuffer X
+    int first_x = MAX(0, -fb->x);
+    int end_x = MIN(fb->width, SCREEN_WIDTH - fb->x);
+    const uint8_t* row = fb->pixels + fb_y * fb->width;
+    const uint8_t* rgb332 = fb->palette->rgb332;
+    uint8_t* out = line_buffer + fb->x;
+
+    if (!fb->colour_zero_transparent) {
+        for(int x = first_x;x < end_x; ++x) {
+            out[x] = rgb332[row[x]];
+        }
+
+        return;
+    }
+
+    // As for RGB555 lines runs of 4 transparent pixels are skipped with a single word test
+    for(int x = first_x;x < end_x; x += 4) {
+        int num_pixels = MIN(4, end_x - x);
+
+        if (num_pixels == 4) {
+            uint32_t quad;
+            memcpy(&quad, row + x, sizeof(quad));
+
+            if (quad == 0) {
+                continue;
+            }
+        }
+
+        for(int i = 0;i < num_pixels; ++i) {
+            uint8_t index = row[x + i];
+
+            if (index != 0) {
+                out[x + i] = rgb332[index];
+            }
+        }
+    }
+}
+
+static void draw_sprite_to_line_rgb332(uint8_t* line_buffer, active_sprite_t sprite) {
+    // Lines are converted (and flipped) to RGB332 first unless they're RGB332 already and
+    // unflipped. Indexed colour 0 converts to RGB332_TRANSPARENT.
+    uint8_t __attribute__ ((aligned (4))) converted[SPRITE_WIDTH];
+    const uint8_t* pixels = sprite.line_data;
+
+    if ((sprite.format != kPixelFormatRGB332) || sprite.flip_x) {
+        convert_row_rgb332(sprite.line_data, SPRITE_WIDTH, sprite.format, sprite_palette,
+            sprite.palette_bank, sprite.flip_x, converted);
+        pixels = converted;
+    }
+
+    if (sprite.spans) {
+        draw_sprite_spans_to_line(line_buffer, sprite, pixels, 1, false);
+        return;
+    }
+
+    int screen_x = sprite.x - sprite_scroll_x;
+    int first_x = MAX(0, -screen_x);
+    int end_x = MIN(SPRITE_WIDTH, SCREEN_WIDTH - screen_x);
+
+    for(int x = first_x;x < end_x; ++x) {
+        if (pixels[x] != RGB332_TRANSPARENT) {
+            line_buffer[screen_x + x] = pixels[x];
+        }
+    }
+}
+
+void draw_sprites_line_rgb332(uint16_t line_y, uint8_t* line_buffer) {
+    int num_active_sprites = sprite_line_count[line_y];
+    uint16_t* line_sprites = sprite_line_index[line_y];
+
+    uint16_t sprite_line_y = line_y + sprite_scroll_y;
+    int line_x_scroll = raster_fx->lines[line_y].sprite_x_scroll;
+
+    for(int i = num_active_sprites - 1;i >= 0; --i) {
+        active_sprite_t sprite =
+            calc_active_sprite_info(screen_sprites[line_sprites[i]], sprite_line_y);
+        sprite.x -= line_x_scroll;
+        draw_sprite_to_line_rgb332(line_buffer, sprite);
+    }
+}
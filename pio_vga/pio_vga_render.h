@@ -0,0 +1,645 @@
+#ifndef __PIO_VGA_RENDER_H__
+#define __PIO_VGA_RENDER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**************************************************************************************************
+ *                             Scanline Renderer                                                  *
+ * Portable tilemap and sprite scanline drawing code. Nothing in here depends upon the Pico SDK   *
+ * so it can be built for the Pico (alongside the video code in `pio_vga_fifth.c`) or on a host   *
+ * machine for benchmarking (see `host/`).                                                        *
+ **************************************************************************************************/
+
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+
+/**************************************************************************************************
+ *                                 Pixel Formats                                                  *
+ **************************************************************************************************/
+
+// Formats tile and sprite data can be stored in. Line buffers are RGB555, or RGB332 when drawn
+// by the RGB332 Output functions.
+//  - kPixelFormatRGB555: Two bytes per pixel
+//  - kPixelFormat8bpp: One byte per pixel, an index into a palette of up to 256 colours
+//  - kPixelFormat4bpp: Two pixels per byte (the leftmost in the low nibble), each an index into a
+//    bank of PALETTE_BANK_COLOURS colours. Every tile or sprite frame picks its own bank.
+//  - kPixelFormatRGB332: One byte per pixel, red in bits 0 - 2, green in bits 3 - 5 and blue in
+//    bits 6 - 7 (laid out as RGB555 is). Only drawn into RGB332 line buffers.
+typedef enum {
+    kPixelFormatRGB555,
+    kPixelFormat8bpp,
+    kPixelFormat4bpp,
+    kPixelFormatRGB332
+} pixel_format_t;
+
+#define PALETTE_BANK_COLOURS 16
+
+// RGB332 sprite pixels of this colour are transparent, magenta as `transparent_colour` is
+#define RGB332_TRANSPARENT 0xc7
+
+typedef struct {
+    // RGB555 colours, for 4bpp bank `b` is entries `b * PALETTE_BANK_COLOURS` onwards
+    const uint16_t* colours;
+    int num_colours;
+    // Optional lookup of every 4bpp byte to the pixel pair it expands to, 256 words per bank,
+    // built by `build_palette_pairs`. When NULL 4bpp data is expanded a nibble at a time.
+    uint32_t* pairs;
+    // Lookup of every colour to RGB332, built by `build_palette_rgb332`. Needed to draw indexed
+    // data into RGB332 line buffers.
+    uint8_t* rgb332;
+} palette_t;
+
+// Bytes in a row of `width` pixels
+static inline int pixel_row_bytes(pixel_format_t format, int width) {
+    switch (format) {
+        case kPixelFormat8bpp:
+        case kPixelFormatRGB332: return width;
+        case kPixelFormat4bpp: return width / 2;
+        default: return width * 2;
+    }
+}
+
+// Build `palette->pairs` for a 4bpp palette, costs 1KB per bank. Any previously built lookup is
+// freed. Returns false (leaving no lookup) if memory couldn't be allocated for it.
+bool build_palette_pairs(palette_t* palette);
+void free_palette_pairs(palette_t* palette);
+
+/**************************************************************************************************
+ *                                      Sprite Code                                               *
+ **************************************************************************************************/
+
+typedef struct {
+    // Sprite data in `format`, SPRITE_WIDTH pixels per row. Indexed sprites use `sprite_palette`
+    // where colour 0 (of every bank for 4bpp) is `transparent_colour`.
+    const void* data_ptr;
+    unsigned int height;
+    int x;
+    int y;
+    bool enabled;
+    uint8_t format;
+    // Bank of `sprite_palette` used by 4bpp sprites
+    uint8_t palette_bank;
+    // Draw the sprite mirrored horizontally and/or vertically. Neither adds any per pixel work
+    // for indexed sprites, RGB555 sprites take one extra pass over each line flipped horizontally.
+    bool flip_x;
+    bool flip_y;
+    // Sprites with a higher priority are drawn over those with a lower one and are kept first
+    // when a line has more than MAX_SPRITES_PER_LINE sprites. Sprites of equal priority are drawn
+    // in `screen_sprites` order, the first on top.
+    uint8_t priority;
+} sprite_info_t;
+
+#ifndef NUM_SPRITES
+#define NUM_SPRITES 128
+#endif
+#define MAX_SPRITES_PER_LINE 20
+#define SPRITE_WIDTH 16
+
+// Entries of the sprite frame tables written by the asset generators (e.g. `sprite_8bpp_frames` in
+// `sprite_data_8bpp.h`). Each frame of a sprite sheet gives the index of the image it's drawn
+// from and whether that image is flipped, so mirrored frames needn't be stored.
+#define SPRITE_FRAME_IMAGE_MASK 0x3fff
+#define SPRITE_FRAME_FLIP_X 0x4000
+#define SPRITE_FRAME_FLIP_Y 0x8000
+
+// A run of opaque pixels within a row of sprite data
+typedef struct {
+    // First pixel of the run within the row
+    uint8_t start;
+    // Number of pixels in the run
+    uint8_t length;
+} sprite_span_t;
+
+// Opaque spans for every row of a block of sprite data (e.g. `sprite_data` from `sprite_data.h`)
+// allowing sprites to be drawn by copying the opaque runs without checking each pixel against
+// `transparent_colour`. Built by `build_sprite_spans` or `build_sprite_spans_format`.
+typedef struct {
+    // Sprite data the spans were built from, SPRITE_WIDTH pixels per row of `row_bytes` bytes
+    const uint8_t* data;
+    pixel_format_t format;
+    int row_bytes;
+    int num_rows;
+    // Index into `spans` of the first span for each row. There are `num_rows + 1` entries so the
+    // number of spans in row `r` is `row_spans[r + 1] - row_spans[r]`.
+    uint16_t* row_spans;
+    sprite_span_t* spans;
+} sprite_span_sheet_t;
+
+typedef struct {
+    // Single line of sprite data for scanline sprite is active for, in `format`. Indexed lines are
+    // expanded to RGB555 as they're drawn.
+    const void* line_data;
+    uint8_t format;
+    uint8_t palette_bank;
+    // Opaque spans of `line_data`, NULL when the sprite data has no spans built in which case
+    // every pixel is checked against `transparent_colour` as it's drawn.
+    const sprite_span_t* spans;
+    uint8_t num_spans;
+    // Line is drawn mirrored horizontally
+    bool flip_x;
+    // X coordinate sprite starts at before `sprite_scroll_x` is applied (with any raster effect
+    // sprite scroll for the line already taken off)
+    int x;
+} active_sprite_t;
+
+extern sprite_info_t screen_sprites[NUM_SPRITES];
+extern int sprite_scroll_x;
+extern int sprite_scroll_y;
+
+extern const uint16_t transparent_colour;
+
+// Palette of the indexed sprites
+extern palette_t* sprite_palette;
+
+extern sprite_span_sheet_t sprite_spans;
+
+extern active_sprite_t cur_active_sprites[MAX_SPRITES_PER_LINE];
+
+// Per scanline buckets holding the index (into `screen_sprites`) of every sprite on each screen
+// line, up to MAX_SPRITES_PER_LINE, highest priority first then in `screen_sprites` order. Built
+// by `build_sprite_line_index`.
+extern uint16_t sprite_line_index[SCREEN_HEIGHT][MAX_SPRITES_PER_LINE];
+extern uint8_t sprite_line_count[SCREEN_HEIGHT];
+
+// Which sprites `build_sprite_line_index` leaves out of a line with more than
+// MAX_SPRITES_PER_LINE sprites on it. Higher priority sprites are always kept over lower ones,
+// the policy picks between sprites of the same priority.
+//  - kSpriteOverflowDropLast: Drop the last in `screen_sprites` order, the same ones every frame
+//  - kSpriteOverflowRotate: Rotate which are dropped each time the index is built so every sprite
+//    is drawn some of the time (flicker multiplexing)
+typedef enum {
+    kSpriteOverflowDropLast,
+    kSpriteOverflowRotate
+} sprite_overflow_policy_t;
+
+extern sprite_overflow_policy_t sprite_overflow_policy;
+
+typedef struct {
+    // Sprite lines (one line of one sprite) left out of the index
+    uint32_t dropped_sprite_lines;
+    // Screen lines with sprites left out
+    uint16_t overflow_lines;
+} sprite_overflow_stats_t;
+
+// Counts of what the last `build_sprite_line_index` left out, along with the number of sprite
+// lines left out of each screen line
+extern sprite_overflow_stats_t sprite_overflow_stats;
+extern uint16_t sprite_line_dropped[SCREEN_HEIGHT];
+
+void init_sprites();
+// Point `sprite` at the image for a frame table entry `frame` (see SPRITE_FRAME_IMAGE_MASK) from
+// `images`, images `sprite->height` rows tall in `sprite->format`, and set its flip flags
+void set_sprite_frame(sprite_info_t* sprite, const void* images, uint16_t frame);
+bool build_sprite_spans(const uint16_t* data, int num_rows);
+// As `build_sprite_spans` for sprite data in any format, colour 0 of indexed data is transparent
+bool build_sprite_spans_format(const void* data, int num_rows, pixel_format_t format);
+void free_sprite_spans();
+int determine_active_sprites(uint16_t line_y);
+void draw_sprite_to_line(uint16_t* line_buffer, active_sprite_t sprite);
+void build_sprite_line_index();
+void draw_sprites_line(uint16_t line_y, uint16_t* line_buffer);
+// Scans `screen_sprites` for every line ignoring `priority` and `sprite_overflow_policy`, so only
+// matches `draw_sprites_line` when all sprites have the same priority and no line overflows or the
+// policy is kSpriteOverflowDropLast
+void draw_sprites_line_unindexed(uint16_t line_y, uint16_t* line_buffer);
+
+/**************************************************************************************************
+ *                                 Tilemap Code                                                   *
+ **************************************************************************************************/
+
+// A small SRAM cache of tileset rows so a tileset can be left in flash. See the Tile Row Cache
+// section below.
+typedef struct {
+    // Number of entries (a power of 2) and the size of each, a tile row in the tileset's format
+    int num_entries;
+    int row_bytes;
+    // Tileset row held by each entry plus one (so 0 is empty), rows are numbered
+    // `tile_num * TILE_HEIGHT + tile_y`
+    uint32_t* tags;
+    uint32_t* rows;
+
+    // Tile row lookups made while drawing that were and weren't in the cache. Each miss reads the
+    // row from the tileset.
+    uint32_t hits;
+    uint32_t misses;
+    // Rows brought into the cache by the prefetch functions
+    uint32_t prefetch_fills;
+} tile_row_cache_t;
+
+// A tileset compressed a tile at a time, kept in flash. See the Compressed Tilesets section below.
+typedef struct {
+    // Tile `n`'s compressed data is `data[offsets[n]]` up to `data[offsets[n + 1]]`
+    const uint8_t* data;
+    const uint32_t* offsets;
+    int num_tiles;
+} compressed_tileset_t;
+
+// A small SRAM cache of whole tiles decoded from a compressed tileset. Any tile can go in any
+// entry, decoding a tile costs far more than reading a tile row so conflicts between the tiles a
+// line needs aren't worth risking as they are in the tile row cache.
+typedef struct {
+    // Number of entries and the size of each, a tile in the tileset's format
+    int num_entries;
+    int tile_bytes;
+    // Tile held by each entry and the entry holding each tile of the tileset, -1 for none
+    int32_t* entry_tile;
+    int16_t* tile_entry;
+    // Set when an entry's tile is used. Entries are replaced in turn from `next_entry`, skipping
+    // (and clearing) those used since they were last passed over.
+    uint8_t* referenced;
+    int next_entry;
+    uint32_t* tiles;
+
+    // Tile row lookups made while drawing that were and weren't in the cache. Each miss decodes
+    // the tile while the line waits.
+    uint32_t hits;
+    uint32_t misses;
+    // Tiles decoded by the prefetch functions
+    uint32_t prefetch_decodes;
+} tile_decode_cache_t;
+
+typedef struct {
+    // Width and height in tiles
+    int width;
+    int height;
+
+    // Pointer to tile data. Each uint16_t specifies which tile from the tileset should be
+    // displayed. Storage is row major order, so consecutive elements of a row of tiles are next to
+    // one another.
+    const uint16_t* tiles;
+    // Tileset data in RGB555 format, must be 4 byte aligned so tile rows can be copied as words
+    const uint16_t* tileset;
+    // Optional copy of the tileset with every tile row shifted along by one pixel, built by
+    // `build_shifted_tileset`. Odd X scroll positions are drawn from it with aligned word copies.
+    // When NULL odd X scroll positions fall back to `draw_tilemap_line_memcpy`, or with a
+    // compressed tileset shift the decoded rows by a pixel as they're copied.
+    uint32_t* tileset_shifted;
+
+    // Format of the tileset. Indexed tilesets are held in `tileset_indexed` (and `tileset` is
+    // unused), indexing `palette`. Tile `n` of a 4bpp tileset uses bank `tile_banks[n]`.
+    pixel_format_t tileset_format;
+    const uint8_t* tileset_indexed;
+    const uint8_t* tile_banks;
+    const palette_t* palette;
+
+    // Optional tile row caches built by `build_tile_row_caches`, line `line_y` is drawn through
+    // `row_caches[line_y % num_row_caches]`. NULL to read tile rows straight from the tileset.
+    tile_row_cache_t* row_caches;
+    int num_row_caches;
+
+    // Optional compressed tileset, drawn in place of `tileset` or `tileset_indexed` (which can be
+    // NULL, as can `tileset_shifted`) through the tile decode caches built by
+    // `build_tile_decode_caches` (line `line_y` through `decode_caches[line_y %
+    // num_decode_caches]`), which must be built before drawing. Row caches aren't used with it.
+    const compressed_tileset_t* tileset_compressed;
+    tile_decode_cache_t* decode_caches;
+    int num_decode_caches;
+
+    // Optional tile indirection table, tile `n` of the tilemap is drawn as tileset tile
+    // `tile_remap[n]`. Animating a tile everywhere it appears is a single write to the table (see
+    // `pio_vga_tile_anim.h`). NULL to draw the tilemap's tiles as they are.
+    const uint16_t* tile_remap;
+
+    // X and Y scroll in pixels for the tilemap
+    int y_scroll;
+    int x_scroll;
+} tilemap_info_t;
+
+#define TILE_WIDTH 16
+#define TILE_HEIGHT 16
+#define TILES_PER_LINE (SCREEN_WIDTH / TILE_WIDTH)
+// 32-bit words in a tile row, each holding a pair of pixels
+#define TILE_ROW_WORDS (TILE_WIDTH / 2)
+
+// Return a pointer to a row of tiles from a tilemap. Line is specified in terms of tiles.
+static inline const uint16_t* get_tilemap_line(int line, tilemap_info_t tilemap) {
+    return tilemap.tiles + line * tilemap.width;
+}
+
+// Return a pointer to a row of pixels from a tile in a tileset
+static inline const uint16_t* get_tile_line(uint16_t tile_num, int tile_y,
+    const uint16_t* tileset) {
+
+    return tileset + tile_num * TILE_WIDTH * TILE_HEIGHT + tile_y * TILE_WIDTH;
+}
+
+// Return a pointer to a row of a tile in an indexed tileset
+static inline const uint8_t* get_indexed_tile_line(uint16_t tile_num, int tile_y,
+    const tilemap_info_t* tilemap) {
+
+    return tilemap->tileset_indexed +
+        (tile_num * TILE_HEIGHT + tile_y) * pixel_row_bytes(tilemap->tileset_format, TILE_WIDTH);
+}
+
+// Return a pointer to a row of a tile in a shifted tileset (see `build_shifted_tileset`)
+static inline uint32_t* get_shifted_tile_line(uint16_t tile_num, int tile_y,
+    uint32_t* tileset_shifted) {
+
+    return tileset_shifted + (tile_num * TILE_HEIGHT + tile_y) * TILE_ROW_WORDS;
+}
+
+// Build `tilemap->tileset_shifted` for the `num_tiles` tiles of `tilemap->tileset`. Every tile row
+// is stored as the pixel pairs (1, 2), (3, 4) ... (13, 14) followed by (15, 0) so with an odd X
+// scroll, where every pixel pair in the line buffer straddles pairs in the tileset, each pair is
+// still a single aligned word. Any previously built shifted tileset is freed. Returns false
+// (leaving no shifted tileset) if memory couldn't be allocated, it's the same size as the tileset.
+// Indexed tilesets don't need one (odd X scroll positions are shifted as they're expanded) so this
+// also returns false for them.
+bool build_shifted_tileset(tilemap_info_t* tilemap, int num_tiles);
+void free_shifted_tileset(tilemap_info_t* tilemap);
+
+// Draw a line of the tilemap with aligned word writes, copying RGB555 tile rows or expanding
+// indexed ones through the palette. `line_buffer` must be 4 byte aligned.
+void draw_tilemap_line(uint16_t line_y, tilemap_info_t tilemap, uint16_t* line_buffer);
+// Draw a line of an RGB555 tilemap copying tile rows with `memcpy`, at odd X scroll positions the
+// copies are unaligned. Used where there is no shifted tileset and kept for benchmarking. Needs
+// `tilemap.tileset`, it doesn't draw from a compressed tileset.
+void draw_tilemap_line_memcpy(uint16_t line_y, tilemap_info_t tilemap, uint16_t* line_buffer);
+
+/**************************************************************************************************
+ *                                 Tile Row Cache                                                 *
+ **************************************************************************************************/
+
+// Build `num_caches` caches of `num_entries` (a power of 2) tile rows each for a tilemap. Use one
+// per render core, a core only draws lines of one cache (e.g. even lines on core0 and odd on
+// core1) so caches are never shared between cores. Any previously built caches are freed. Returns
+// false (leaving no caches) if memory couldn't be allocated for them.
+bool build_tile_row_caches(tilemap_info_t* tilemap, int num_caches, int num_entries);
+void free_tile_row_caches(tilemap_info_t* tilemap);
+void reset_tile_row_cache_stats(const tilemap_info_t* tilemap);
+
+// Bring the tile rows needed to draw a line of a tilemap (with `draw_tilemap_line`) or of the
+// tilemap layers (with `draw_tilemap_layers_line`) into the tile row caches, ahead of drawing it.
+// Tilemaps with a compressed tileset decode the line's tiles, and a share of those in the tilemap
+// row below, into the tile decode caches instead. Call these on the core that will draw the line,
+// when it has nothing else to do, once the scroll and raster effects for the line are fixed.
+void prefetch_tilemap_line(uint16_t line_y, tilemap_info_t tilemap);
+void prefetch_tilemap_layers_line(uint16_t line_y);
+
+/**************************************************************************************************
+ *                                 Compressed Tilesets                                            *
+ **************************************************************************************************/
+
+// Build `num_caches` tile decode caches of `num_entries` tiles each (at most INT16_MAX) for a
+// tilemap, one per render core as with tile row caches. `tilemap->tileset_compressed` must be set
+// first. Any previously built caches are freed. Returns false (leaving no caches) if memory
+// couldn't be allocated for them.
+bool build_tile_decode_caches(tilemap_info_t* tilemap, int num_caches, int num_entries);
+void free_tile_decode_caches(tilemap_info_t* tilemap);
+void reset_tile_decode_cache_stats(const tilemap_info_t* tilemap);
+
+// Decode tile `tile_num` of `tilemap->tileset_compressed` into `tile`, TILE_HEIGHT rows in the
+// tileset's format
+void decode_compressed_tile(const tilemap_info_t* tilemap, uint16_t tile_num, void* tile);
+
+/**************************************************************************************************
+ *                                 Tilemap Layers                                                 *
+ **************************************************************************************************/
+
+#define MAX_TILEMAP_LAYERS 4
+// Parallax factors are fixed point with this many fractional bits
+#define PARALLAX_SHIFT 8
+#define PARALLAX_ONE (1 << PARALLAX_SHIFT)
+
+typedef struct {
+    // The layer's tilemap, its X and Y scroll are an offset added to the parallax scroll
+    tilemap_info_t tilemap;
+    // How far the layer moves relative to `tilemap_scroll_x` and `tilemap_scroll_y`.
+    // PARALLAX_ONE moves with them, smaller factors move slower (further away), larger faster.
+    int parallax_x;
+    int parallax_y;
+    // When `has_colour_key` is set pixels of `colour_key` are transparent, showing the layers
+    // beneath. Otherwise the layer is opaque.
+    bool has_colour_key;
+    uint16_t colour_key;
+    // Bit x of entry `tile_num * TILE_HEIGHT + tile_y` is set when pixel x of that tile row isn't
+    // `colour_key`, built by `build_tilemap_layer_opacity`. Unused without a colour key.
+    uint16_t* tile_row_opaque;
+    bool enabled;
+} tilemap_layer_t;
+
+// Layers from back (0) to front. Layers wrap around at the edges of their tilemaps.
+extern tilemap_layer_t tilemap_layers[MAX_TILEMAP_LAYERS];
+extern int num_tilemap_layers;
+// Scroll applied to every layer, scaled by the layer's parallax factor
+extern int tilemap_scroll_x;
+extern int tilemap_scroll_y;
+
+// Build the `tile_row_opaque` masks for the `num_tiles` tiles of a layer's tileset using its
+// colour key. Any previously built masks are freed. Returns false (leaving no masks) if memory
+// couldn't be allocated for them, a layer with a colour key is drawn as opaque without them.
+bool build_tilemap_layer_opacity(tilemap_layer_t* layer, int num_tiles);
+void free_tilemap_layer_opacity(tilemap_layer_t* layer);
+
+// Draw a line of all enabled layers, front to back. Pixels covered by an opaque pixel of a layer
+// in front are never written by the layers behind and once the whole line is covered the
+// remaining layers are skipped. Where nothing in front covers any of an opaque layer's line it's
+// drawn with `draw_tilemap_line`.
+void draw_tilemap_layers_line(uint16_t line_y, uint16_t* line_buffer);
+
+/**************************************************************************************************
+ *                                 Raster Effects                                                 *
+ **************************************************************************************************/
+
+#define MAX_RASTER_COLOUR_TRANSFORMS 8
+// Colour transform scale factors are fixed point, this is a factor of 1
+#define RASTER_COLOUR_ONE 256
+
+// Effects for a single scanline. Scrolls are added to the scroll the line would otherwise have.
+typedef struct {
+    int16_t layer_x_scroll[MAX_TILEMAP_LAYERS];
+    int16_t layer_y_scroll[MAX_TILEMAP_LAYERS];
+    int16_t sprite_x_scroll;
+    // Index into `raster_colour_transforms`, 0 for no transform
+    uint8_t colour_transform;
+} raster_line_fx_t;
+
+typedef struct {
+    raster_line_fx_t lines[SCREEN_HEIGHT];
+} raster_fx_table_t;
+
+// A colour transform given as a lookup table for each RGB555 channel. Entries are already shifted
+// into place so a transformed pixel is `red[r] | green[g] | blue[b]`.
+typedef struct {
+    uint16_t red[32];
+    uint16_t green[32];
+    uint16_t blue[32];
+} raster_colour_transform_t;
+
+// Table used to draw the current frame and the table being filled in for the next frame. Swap
+// them with `swap_raster_fx` in `end_of_frame`, while no lines are being drawn. Both start with
+// no effects.
+extern raster_fx_table_t* raster_fx;
+extern raster_fx_table_t* raster_fx_next;
+
+// Transform 0 is the identity and is never applied
+extern raster_colour_transform_t raster_colour_transforms[MAX_RASTER_COLOUR_TRANSFORMS];
+
+void swap_raster_fx();
+// Reset every line of `table` to no effects
+void clear_raster_fx(raster_fx_table_t* table);
+
+// Fill in colour transform `transform` (1 to MAX_RASTER_COLOUR_TRANSFORMS - 1) to scale each
+// channel by a fixed point factor (RASTER_COLOUR_ONE leaves it unchanged) and then add an offset,
+// saturating at the channel limits.
+void set_raster_colour_transform(int transform, const int scale[3], const int offset[3]);
+
+// Apply the colour transform of `line_y` in the current table to the finished line
+void apply_raster_colour_transform(uint16_t line_y, uint16_t* line_buffer);
+
+/**************************************************************************************************
+ *                                 Framebuffer                                                    *
+ **************************************************************************************************/
+
+// An 8bpp framebuffer, expanded through its palette into the line buffer as each line is drawn.
+// For effects needing random access drawing (particles, line art) that can't be drawn a scanline
+// at a time. It can cover the whole screen (320x240, 76.8KB) in place of the tilemap layers or be
+// a smaller window composited over them, drawn after the layers and before the sprites.
+typedef struct {
+    // `width * height` bytes in row major order, indexing `palette`
+    uint8_t* pixels;
+    int width;
+    int height;
+    // Screen position of the top left pixel
+    int x;
+    int y;
+    const palette_t* palette;
+    // When set pixels of colour 0 are transparent, showing the layers beneath. Otherwise the
+    // framebuffer is opaque.
+    bool colour_zero_transparent;
+    bool enabled;
+} framebuffer_t;
+
+extern framebuffer_t framebuffer;
+
+// Allocate `width * height` pixels for `fb`, cleared to colour 0, at screen position 0, 0. Any
+// previous pixels are freed. Returns false (leaving no pixels) if memory couldn't be allocated.
+bool build_framebuffer(framebuffer_t* fb, int width, int height);
+void free_framebuffer(framebuffer_t* fb);
+
+// Drawing into a framebuffer, everything is clipped to it. The line cache (see
+// `update_line_cache`) doesn't look at framebuffer pixels so changed lines must be marked.
+void framebuffer_clear(framebuffer_t* fb, uint8_t colour);
+void framebuffer_draw_line(framebuffer_t* fb, int x0, int y0, int x1, int y1, uint8_t colour);
+// Copy a `width` x `height` 8bpp image (e.g. a tile or sprite frame) with its top left at `x`, `y`.
+// Non zero pixels have `colour_offset` added so images with their own palettes can share the
+// framebuffer's palette. With `colour_zero_transparent` pixels of colour 0 aren't copied.
+void framebuffer_blit(framebuffer_t* fb, const uint8_t* image, int width, int height, int x, int y,
+    bool colour_zero_transparent, int colour_offset);
+
+static inline void framebuffer_plot(framebuffer_t* fb, int x, int y, uint8_t colour) {
+    if ((x >= 0) && (x < fb->width) && (y >= 0) && (y < fb->height)) {
+        fb->pixels[y * fb->width + x] = colour;
+    }
+}
+
+// Returns true if line `line_y` of the screen is entirely covered by an enabled opaque
+// framebuffer, so the tilemap layers needn't be drawn for it
+bool framebuffer_covers_line(const framebuffer_t* fb, uint16_t line_y);
+// Draw the part of an enabled framebuffer on screen line `line_y` into `line_buffer` (which must
+// be 4 byte aligned)
+void draw_framebuffer_line(uint16_t line_y, const framebuffer_t* fb, uint16_t* line_buffer);
+
+/**************************************************************************************************
+ *                                 Line Cache                                                     *
+ **************************************************************************************************/
+
+#define LINE_CACHE_WORDS ((SCREEN_HEIGHT + 31) / 32)
+
+// Finished lines kept from one frame to the next so lines nothing has changed on are copied rather
+// than drawn again. Once everything for the next frame is set up (e.g. at the end of
+// `end_of_frame`, after `build_sprite_line_index`) `update_line_cache` compares the scene with the
+// one the cached lines were drawn from. A line is redrawn when:
+//  - `tilemap_scroll_x`, `tilemap_scroll_y`, `sprite_scroll_x`, `sprite_scroll_y`, any tilemap
+//    layer or `framebuffer` (other than its pixels) changed (every line)
+//  - A sprite on it changed, moved on or off it, or `kSpriteOverflowRotate` dropped sprites from it
+//  - Its raster effects changed
+//  - It was marked with `mark_lines_dirty` or `mark_layer_tile_dirty`. The contents of tilemaps,
+//    tilesets, sprite data, framebuffer pixels, palettes and colour transforms aren't compared so
+//    must be marked when they change.
+typedef struct {
+    // SCREEN_HEIGHT lines of SCREEN_WIDTH pixels, NULL when no cache is built
+    uint16_t* lines;
+    // Bit `n` set when line `n` must be drawn this frame
+    uint32_t redraw[LINE_CACHE_WORDS];
+    // Lines marked dirty since the last update
+    uint32_t marked[LINE_CACHE_WORDS];
+    // `screen_sprites` as the cached lines were drawn, NUM_SPRITES entries
+    sprite_info_t* sprites;
+    // Remaining scene state the cached lines were drawn from
+    tilemap_layer_t layers[MAX_TILEMAP_LAYERS];
+    int num_layers;
+    framebuffer_t framebuffer;
+    int scroll[4];
+    raster_line_fx_t line_fx[SCREEN_HEIGHT];
+    // Lines copied from the cache this frame, and in total along with the lines drawn
+    uint16_t frame_reused_lines;
+    uint32_t reused_lines;
+    uint32_t drawn_lines;
+} line_cache_t;
+
+extern line_cache_t line_cache;
+
+// Allocate the line cache (SCREEN_WIDTH * SCREEN_HEIGHT * 2 bytes plus a copy of
+// `screen_sprites`), every line is drawn on the first frame. Returns false (leaving no cache) if
+// memory couldn't be allocated for it.
+bool build_line_cache();
+void free_line_cache();
+
+// Work out which lines must be drawn this frame, once per frame while no lines are being drawn
+void update_line_cache();
+
+// Mark lines `first_line` to `end_line - 1` to be drawn on the next frame
+void mark_lines_dirty(int first_line, int end_line);
+// Mark the lines showing row `tile_y` of tilemap layer `layer_idx` to be drawn on the next frame,
+// e.g. after changing a tile in it
+void mark_layer_tile_dirty(int layer_idx, int tile_y);
+
+// With no cache built or if `line_y` must be drawn this frame returns false, draw it then pass it
+// to `store_cached_line`. Otherwise copies the cached line into `line_buffer` and returns true.
+bool get_cached_line(uint16_t line_y, uint16_t* line_buffer);
+void store_cached_line(uint16_t line_y, const uint16_t* line_buffer);
+
+/**************************************************************************************************
+ *                                 RGB332 Output                                                  *
+ * Lines drawn a byte per pixel for output by `line_out_rgb332` in `video_fifth.pio`, half the    *
+ * line buffer memory, line DMA and line buffer writes of RGB555 lines. RGB332 tiles and sprites  *
+ * are copied straight into the line, other formats are converted as they're drawn (indexed ones  *
+ * through their palette's `rgb332` lookup). Layers, sprites and the framebuffer are drawn as     *
+ * they are into RGB555 lines, including any raster effect scrolls. Raster colour transforms and  *
+ * the line cache are RGB555 only.                                                                *
+ **************************************************************************************************/
+
+// Convert an RGB555 colour to the nearest RGB332 colour. `transparent_colour` becomes
+// RGB332_TRANSPARENT, any other colour converting to it is moved to the neighbouring green so it
+// stays opaque.
+static inline uint8_t rgb555_to_rgb332(uint16_t colour) {
+    uint8_t red = ((colour & 0x1f) * 7 + 15) / 31;
+    uint8_t green = (((colour >> 5) & 0x1f) * 7 + 15) / 31;
+    uint8_t blue = (((colour >> 10) & 0x1f) * 3 + 15) / 31;
+    uint8_t rgb332 = red | (green << 3) | (blue << 6);
+
+    if ((rgb332 == RGB332_TRANSPARENT) && (colour != transparent_colour)) {
+        rgb332 ^= 1 << 3;
+    }
+
+    return rgb332;
+}
+
+// Build `palette->rgb332`, one byte per colour. Any previously built lookup is freed. Returns
+// false (leaving no lookup) if memory couldn't be allocated for it.
+bool build_palette_rgb332(palette_t* palette);
+void free_palette_rgb332(palette_t* palette);
+
+// As `draw_tilemap_line` into an RGB332 line buffer
+void draw_tilemap_line_rgb332(uint16_t line_y, tilemap_info_t tilemap, uint8_t* line_buffer);
+// As `draw_tilemap_layers_line` into an RGB332 line buffer. Rather than tracking which pixels are
+// covered the layers are drawn back to front, starting from the frontmost opaque layer.
+void draw_tilemap_layers_line_rgb332(uint16_t line_y, uint8_t* line_buffer);
+// As `draw_framebuffer_line` into an RGB332 line buffer
+void draw_framebuffer_line_rgb332(uint16_t line_y, const framebuffer_t* fb, uint8_t* line_buffer);
+// As `draw_sprites_line` into an RGB332 line buffer
+void draw_sprites_line_rgb332(uint16_t line_y, uint8_t* line_buffer);
+
+#endif
@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include <string.h>
+#include "pio_vga_tile_anim.h"
+
+bool tile_anims_init(tile_anims_t* anims, int layer_idx, int num_tiles) {
+    anims->layer_idx = layer_idx;
+    anims->num_tiles = num_tiles;
+    anims->num_anims = 0;
+    anims->animated_rows = NULL;
+    anims->num_rows = 0;
+    anims->frame_changes = 0;
+
+    anims->remap = malloc(num_tiles * sizeof(uint16_t));
+    if (!anims->remap) {
+        return false;
+    }
+
+    for(int i = 0;i < num_tiles; ++i) {
+        anims->remap[i] = i;
+    }
+
+    tilemap_layers[layer_idx].tilemap.tile_remap = anims->remap;
+    tile_anims_find_rows(anims);
+
+    return true;
+}
+
+void tile_anims_free(tile_anims_t* anims) {
+    if (tilemap_layers[anims->layer_idx].tilemap.tile_remap == anims->remap) {
+        tilemap_layers[anims->layer_idx].tilemap.tile_remap = NULL;
+    }
+
+    free(anims->remap);
+    free(anims->animated_rows);
+    anims->remap = NULL;
+    anims->animated_rows = NULL;
+    anims->num_anims = 0;
+    anims->num_rows = 0;
+}
+
+bool tile_anims_add(tile_anims_t* anims, uint16_t tile, const uint16_t* frames, int num_frames,
+    int frame_time) {
+
+    if (anims->num_anims == MAX_TILE_ANIMS || tile >= anims->num_tiles || num_frames < 1 ||
+        num_frames > MAX_TILE_ANIM_FRAMES || frame_time < 1) {
+        return false;
+    }
+
+    tile_anim_t* anim = &anims->anims[anims->num_anims++];
+    anim->tile = tile;
+    memcpy(anim->frames, frames, num_frames * sizeof(uint16_t));
+    anim->num_frames = num_frames;
+    anim->frame_time = frame_time;
+    anim->frame = 0;
+    anim->timer = 0;
+
+    anims->remap[tile] = frames[0];
+    mark_lines_dirty(0, SCREEN_HEIGHT);
+    tile_anims_find_rows(anims);
+
+    return true;
+}
+
+static bool is_animated_tile(const tile_anims_t* anims, uint16_t tile) {
+    for(int i = 0;i < anims->num_anims; ++i) {
+        if (anims->anims[i].tile == tile) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void tile_anims_find_rows(tile_anims_t* anims) {
+    const tilemap_info_t* tilemap = &tilemap_layers[anims->layer_idx].tilemap;
+
+    if (anims->num_rows != tilemap->height) {
+        free(anims->animated_rows);
+        anims->animated_rows = malloc(tilemap->height);
+        anims->num_rows = anims->animated_rows ? tilemap->height : 0;
+    }
+
+    for(int row = 0;row < anims->num_rows; ++row) {
+        const uint16_t* tilemap_line = get_tilemap_line(row, *tilemap);
+        anims->animated_rows[row] = 0;
+
+        for(int x = 0;x < tilemap->width; ++x) {
+            if (is_animated_tile(anims, tilemap_line[x])) {
+                anims->animated_rows[row] = 1;
+                break;
+            }
+        }
+    }
+}
+
+void tile_anims_update(tile_anims_t* anims) {
+    bool changed = false;
+
+    for(int i = 0;i < anims->num_anims; ++i) {
+        tile_anim_t* anim = &anims->anims[i];
+
+        if (++anim->timer < anim->frame_time) {
+            continue;
+        }
+
+        anim->timer = 0;
+        if (++anim->frame == anim->num_frames) {
+            anim->frame = 0;
+        }
+
+        uint16_t frame_tile = anim->frames[anim->frame];
+        if (anims->remap[anim->tile] != frame_tile) {
+            anims->remap[anim->tile] = frame_tile;
+            ++anims->frame_changes;
+            changed = true;
+        }
+    }
+
+    // Without the rows (out of memory) every line is redrawn
+    if (changed && anims->num_rows == 0) {
+        mark_lines_dirty(0, SCREEN_HEIGHT);
+    } else if (changed) {
+        for(int row = 0;row < anims->num_rows; ++row) {
+            if (anims->animated_rows[row]) {
+                mark_layer_tile_dirty(anims->layer_idx, row);
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef __PIO_VGA_TILE_ANIM_H__
+#define __PIO_VGA_TILE_ANIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pio_vga_render.h"
+
+/**************************************************************************************************
+ *                             Animated Tiles                                                     *
+ * Tiles of a tilemap layer are animated through its tile indirection table (`tile_remap` in      *
+ * `tilemap_info_t`), which maps each tile number in the tilemap to the tileset tile drawn for it. *
+ * An animation is a tile number and a sequence of tileset tiles shown in turn, each for a number *
+ * of frames. Moving an animation on a frame is one write to the table however many times its     *
+ * tile appears in the map, the tilemap itself is never touched.                                  *
+ *                                                                                                *
+ * The renderer looks the table up once per line for the tiles the line draws, before the loops   *
+ * drawing them, so the per tile drawing loops are no different with animation, and a tilemap     *
+ * with no table pays only a single test per line.                                                *
+ *                                                                                                *
+ * `tile_anims_update` is called once per frame from `end_of_frame`, while no lines are being     *
+ * drawn. When a table entry changes the tilemap rows holding any animated tile (found by         *
+ * scanning the tilemap when an animation is added) are marked for the line cache to redraw.      *
+ **************************************************************************************************/
+
+#define MAX_TILE_ANIMS 16
+#define MAX_TILE_ANIM_FRAMES 8
+
+typedef struct {
+    // Tile number in the tilemap that's animated
+    uint16_t tile;
+    // Tileset tiles shown in turn, each for `frame_time` frames
+    uint16_t frames[MAX_TILE_ANIM_FRAMES];
+    int num_frames;
+    int frame_time;
+    // Frame being shown and the frames it's been shown for
+    int frame;
+    int timer;
+} tile_anim_t;
+
+typedef struct {
+    int layer_idx;
+
+    // Tileset tile drawn for each of the `num_tiles` tile numbers, the layer's `tile_remap`
+    uint16_t* remap;
+    int num_tiles;
+
+    tile_anim_t anims[MAX_TILE_ANIMS];
+    int num_anims;
+
+    // Set for each of the `num_rows` rows of the layer's tilemap holding an animated tile
+    uint8_t* animated_rows;
+    int num_rows;
+
+    // Table entries changed by updates
+    uint32_t frame_changes;
+} tile_anims_t;
+
+// Setup animation of tilemap layer `layer_idx`, whose tilemap must be setup first and use tile
+// numbers below `num_tiles`. Points the layer's `tile_remap` at a table mapping every tile to
+// itself. Returns false if out of memory.
+bool tile_anims_init(tile_anims_t* anims, int layer_idx, int num_tiles);
+// Free the table, leaving the layer drawing its tiles unanimated
+void tile_anims_free(tile_anims_t* anims);
+
+// Animate tile number `tile` through the `num_frames` tileset tiles `frames`, each shown for
+// `frame_time` frames. Returns false if there are already MAX_TILE_ANIMS animations or the
+// animation is invalid.
+bool tile_anims_add(tile_anims_t* anims, uint16_t tile, const uint16_t* frames, int num_frames,
+    int frame_time);
+
+// Rescan the layer's tilemap for the rows holding animated tiles, needed after changing its tiles
+// (e.g. a tilemap stream loading chunks) for the right lines to be redrawn with the line cache
+void tile_anims_find_rows(tile_anims_t* anims);
+
+// Move every animation on a frame, once per frame while no lines are being drawn
+void tile_anims_update(tile_anims_t* anims);
+
+#endif
@@ -0,0 +1,173 @@
+#include <stdlib.h>
+#include <string.h>
+#include "pio_vga_tilemap_stream.h"
+
+// Division and modulo rounding towards minus infinity, map positions left of or above the map
+// wrap around to the other side
+static inline int floor_div(int value, int divisor) {
+    return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+static inline int wrap(int value, int size) {
+    value %= size;
+
+    return value < 0 ? value + size : value;
+}
+
+bool tilemap_stream_init(tilemap_stream_t* stream, const chunked_map_t* map,
+    tilemap_info_t* tilemap, int max_loads) {
+
+    int chunk_width = map->chunk_tiles * TILE_WIDTH;
+    int chunk_height = map->chunk_tiles * TILE_HEIGHT;
+
+    // Up to a chunk more than the screen covers is visible when it isn't chunk aligned, plus a
+    // chunk of margin either side
+    stream->map = map;
+    stream->window_chunks_x = (SCREEN_WIDTH + chunk_width - 1) / chunk_width + 3;
+    stream->window_chunks_y = (SCREEN_HEIGHT + chunk_height - 1) / chunk_height + 3;
+    stream->window_width = stream->window_chunks_x * map->chunk_tiles;
+    stream->window_height = stream->window_chunks_y * map->chunk_tiles;
+    stream->max_loads = max_loads;
+
+    stream->frame_loads = 0;
+    stream->max_frame_loads = 0;
+    stream->chunk_loads = 0;
+    stream->late_chunks = 0;
+
+    int num_slots = stream->window_chunks_x * stream->window_chunks_y;
+
+    stream->window_tiles = NULL;
+    stream->slot_chunk = NULL;
+
+    if (map->width_chunks < stream->window_chunks_x ||
+        map->height_chunks < stream->window_chunks_y) {
+        return false;
+    }
+
+    stream->window_tiles =
+        calloc(stream->window_width * stream->window_height, sizeof(uint16_t));
+    stream->slot_chunk = malloc(num_slots * sizeof(int32_t));
+
+    if (!stream->window_tiles || !stream->slot_chunk) {
+        tilemap_stream_free(stream);
+        return false;
+    }
+
+    for(int i = 0;i < num_slots; ++i) {
+        stream->slot_chunk[i] = -1;
+    }
+
+    tilemap->tiles = stream->window_tiles;
+    tilemap->width = stream->window_width;
+    tilemap->height = stream->window_height;
+
+    return true;
+}
+
+void tilemap_stream_free(tilemap_stream_t* stream) {
+    free(stream->window_tiles);
+    free(stream->slot_chunk);
+    stream->window_tiles = NULL;
+    stream->slot_chunk = NULL;
+}
+
+// Make map chunk `chunk_x`, `chunk_y` (before wrapping at the edges of the map) resident in its
+// slot, returns true if it had to be loaded
+static bool load_chunk(tilemap_stream_t* stream, int chunk_x, int chunk_y) {
+    const chunked_map_t* map = stream->map;
+    int slot_x = wrap(chunk_x, stream->window_chunks_x);
+    int slot_y = wrap(chunk_y, stream->window_chunks_y);
+    int slot = slot_y * stream->window_chunks_x + slot_x;
+    int32_t map_chunk = wrap(chunk_y, map->height_chunks) * map->width_chunks +
+        wrap(chunk_x, map->width_chunks);
+
+    if (stream->slot_chunk[slot] == map_chunk) {
+        return false;
+    }
+
+    int chunk_tiles = map->chunk_tiles;
+    const uint16_t* src = map->chunks + map->chunk_index[map_chunk] * chunk_tiles * chunk_tiles;
+    uint16_t* dst = stream->window_tiles + slot_y * chunk_tiles * stream->window_width +
+        slot_x * chunk_tiles;
+
+    for(int y = 0;y < chunk_tiles; ++y) {
+        memcpy(dst, src, chunk_tiles * sizeof(uint16_t));
+        src += chunk_tiles;
+        dst += stream->window_width;
+    }
+
+    stream->slot_chunk[slot] = map_chunk;
+    ++stream->frame_loads;
+    ++stream->chunk_loads;
+
+    return true;
+}
+
+void tilemap_stream_update(tilemap_stream_t* stream, int view_x, int view_y) {
+    int chunk_width = stream->map->chunk_tiles * TILE_WIDTH;
+    int chunk_height = stream->map->chunk_tiles * TILE_HEIGHT;
+    int first_x = floor_div(view_x, chunk_width);
+    int last_x = floor_div(view_x + SCREEN_WIDTH - 1, chunk_width);
+    int first_y = floor_div(view_y, chunk_height);
+    int last_y = floor_div(view_y + SCREEN_HEIGHT - 1, chunk_height);
+    // Until the first update the window is empty, fill it without counting late chunks or keeping
+    // to the margin load limit
+    bool filling = stream->chunk_loads == 0;
+    bool visible_loaded = false;
+
+    stream->frame_loads = 0;
+
+    // Chunks that will be visible must be resident before the frame is drawn
+    for(int chunk_y = first_y;chunk_y <= last_y; ++chunk_y) {
+        for(int chunk_x = first_x;chunk_x <= last_x; ++chunk_x) {
+            if (load_chunk(stream, chunk_x, chunk_y)) {
+                visible_loaded = true;
+
+                if (!filling) {
+                    ++stream->late_chunks;
+                }
+            }
+        }
+    }
+
+    // Then the margin, ready for when it scrolls into view
+    int margin_loads = 0;
+    for(int chunk_y = first_y - 1;chunk_y <= last_y + 1; ++chunk_y) {
+        for(int chunk_x = first_x - 1;chunk_x <= last_x + 1; ++chunk_x) {
+            bool visible = chunk_y >= first_y && chunk_y <= last_y && chunk_x >= first_x &&
+                chunk_x <= last_x;
+
+            if (visible || (!filling && margin_loads == stream->max_loads)) {
+                continue;
+            }
+
+            if (load_chunk(stream, chunk_x, chunk_y)) {
+                ++margin_loads;
+            }
+        }
+    }
+
+    if (!filling && stream->frame_loads > stream->max_frame_loads) {
+        stream->max_frame_loads = stream->frame_loads;
+    }
+
+    // Lines cached from before a late chunk was loaded show the wrong tiles
+    if (visible_loaded) {
+        mark_lines_dirty(0, SCREEN_HEIGHT);
+    }
+}
+
+uint16_t chunked_map_tile(const chunked_map_t* map, int x, int y) {
+    int chunk_tiles = map->chunk_tiles;
+    int map_x = wrap(x, map->width_chunks * chunk_tiles);
+    int map_y = wrap(y, map->height_chunks * chunk_tiles);
+    int chunk = map->chunk_index[(map_y / chunk_tiles) * map->width_chunks + map_x / chunk_tiles];
+
+    return map->chunks[(chunk * chunk_tiles + map_y % chunk_tiles) * chunk_tiles +
+        map_x % chunk_tiles];
+}
+
+int tilemap_stream_window_bytes(const tilemap_stream_t* stream) {
+    return stream->window_width * stream->window_height * sizeof(uint16_t) +
+        stream->window_chunks_x * stream->window_chunks_y * sizeof(int32_t);
+}
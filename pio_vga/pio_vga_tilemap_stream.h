@@ -0,0 +1,84 @@
+#ifndef __PIO_VGA_TILEMAP_STREAM_H__
+#define __PIO_VGA_TILEMAP_STREAM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pio_vga_render.h"
+
+/**************************************************************************************************
+ *                             Tilemap Streaming                                                  *
+ * Maps far larger than SRAM are held in flash as chunks of `chunk_tiles` x `chunk_tiles` tiles,  *
+ * with a chunk index giving the stored chunk at each chunk position of the map so repeated       *
+ * chunks are only stored once (see `make_chunked_map.py`).                                       *
+ *                                                                                                *
+ * A window of resident chunks, large enough for the screen plus a chunk all around it, is held   *
+ * in SRAM as an ordinary tilemap. Map chunk (cx, cy) lives in window slot (cx mod window width,  *
+ * cy mod window height) so the window is a ring in both directions: layer drawing already wraps  *
+ * at the edges of the tilemap, so scrolling the layer by the map position draws straight from    *
+ * the window and the renderer needs no changes.                                                  *
+ *                                                                                                *
+ * `tilemap_stream_update` is called from `end_of_frame`, while no lines are being drawn, with    *
+ * the map position the next frame shows. Chunks that will be visible are always loaded, then up  *
+ * to `max_loads` chunks of the margin around the screen, so by the time a chunk scrolls into     *
+ * view it's normally been loaded a frame or more earlier and no line ever waits on a chunk. A    *
+ * visible chunk that had to be loaded is counted as late, a sign the margin loads can't keep up  *
+ * with the scroll speed. Map positions wrap at the edges of the map.                             *
+ **************************************************************************************************/
+
+typedef struct {
+    // Map size in chunks and the width and height of a chunk in tiles (a power of two)
+    int width_chunks;
+    int height_chunks;
+    int chunk_tiles;
+    // Stored chunk at each chunk position, row major
+    const uint16_t* chunk_index;
+    // Stored chunks, each `chunk_tiles * chunk_tiles` tile numbers in row major order
+    const uint16_t* chunks;
+    int num_chunks;
+} chunked_map_t;
+
+typedef struct {
+    const chunked_map_t* map;
+
+    // The window, `window_chunks_x` x `window_chunks_y` chunk slots held as the tiles of a
+    // tilemap `window_width` x `window_height` tiles
+    int window_chunks_x;
+    int window_chunks_y;
+    int window_width;
+    int window_height;
+    uint16_t* window_tiles;
+    // Map chunk position (`cy * width_chunks + cx`) held by each slot, -1 when empty
+    int32_t* slot_chunk;
+
+    // Most margin chunks loaded per update
+    int max_loads;
+
+    // Chunks loaded by the last update and the most by any update after the first (which fills the
+    // window), chunks loaded in total and visible chunks that weren't resident when an update
+    // needed them
+    int frame_loads;
+    int max_frame_loads;
+    uint32_t chunk_loads;
+    uint32_t late_chunks;
+} tilemap_stream_t;
+
+// Setup a window onto `map` for `tilemap` to draw, pointing its tiles, width and height at the
+// window (the tileset and everything else are left to the caller). At most `max_loads` margin
+// chunks are loaded per update. Returns false if out of memory or the map is smaller than the
+// window.
+bool tilemap_stream_init(tilemap_stream_t* stream, const chunked_map_t* map,
+    tilemap_info_t* tilemap, int max_loads);
+void tilemap_stream_free(tilemap_stream_t* stream);
+
+// Load the chunks needed to show the screen at map pixel position `view_x`, `view_y`, the layer
+// position the next frame is drawn at (e.g. `tilemap_scroll_x` and `tilemap_scroll_y` for a layer
+// with no parallax or scroll of its own). Raster effect layer offsets aren't allowed for.
+void tilemap_stream_update(tilemap_stream_t* stream, int view_x, int view_y);
+
+// Tile number at map tile `x`, `y`, read from flash
+uint16_t chunked_map_tile(const chunked_map_t* map, int x, int y);
+
+// SRAM used by the window
+int tilemap_stream_window_bytes(const tilemap_stream_t* stream);
+
+#endif
@@ -0,0 +1,129 @@
+#include <math.h>
+#include "pio_vga_video_mode.h"
+
+const video_mode_t video_modes[kNumVideoModes] = {
+    [kVideoMode640x480] = {
+        .name = "640x480@60 320x240",
+        .pixel_clock_hz = 25175000,
+        .h_visible = 640, .h_front_porch = 16, .h_sync = 96, .h_back_porch = 48,
+        .v_visible = 480, .v_front_porch = 10, .v_sync = 2, .v_back_porch = 33,
+        .h_sync_positive = false, .v_sync_positive = false,
+        .width = 320, .height = 240,
+        .pixel_repeat = 2.0f, .line_repeat = 2
+    },
+    [kVideoMode640x480Narrow] = {
+        .name = "640x480@60 256x240",
+        .pixel_clock_hz = 25175000,
+        .h_visible = 640, .h_front_porch = 16, .h_sync = 96, .h_back_porch = 48,
+        .v_visible = 480, .v_front_porch = 10, .v_sync = 2, .v_back_porch = 33,
+        .h_sync_positive = false, .v_sync_positive = false,
+        .width = 256, .height = 240,
+        .pixel_repeat = 2.5f, .line_repeat = 2
+    },
+    [kVideoMode800x600] = {
+        .name = "800x600@60 320x240",
+        .pixel_clock_hz = 40000000,
+        .h_visible = 800, .h_front_porch = 40, .h_sync = 128, .h_back_porch = 88,
+        .v_visible = 600, .v_front_porch = 1, .v_sync = 4, .v_back_porch = 23,
+        .h_sync_positive = true, .v_sync_positive = true,
+        .width = 320, .height = 240,
+        .pixel_repeat = 2.25f, .line_repeat = 2
+    },
+    [kVideoMode800x600Narrow] = {
+        .name = "800x600@60 256x240",
+        .pixel_clock_hz = 40000000,
+        .h_visible = 800, .h_front_porch = 40, .h_sync = 128, .h_back_porch = 88,
+        .v_visible = 600, .v_front_porch = 1, .v_sync = 4, .v_back_porch = 23,
+        .h_sync_positive = true, .v_sync_positive = true,
+        .width = 256, .height = 240,
+        .pixel_repeat = 3.0f, .line_repeat = 2
+    }
+};
+
+static bool add_timing_segment(video_timing_t* timing, sync_line_type_t type, int num_lines) {
+    if (num_lines == 0) {
+        return true;
+    }
+
+    if ((num_lines < 0) || (timing->num_segments == MAX_TIMING_SEGMENTS)) {
+        return false;
+    }
+
+    timing->segments[timing->num_segments++] = (timing_segment_t){type, num_lines};
+
+    return true;
+}
+
+bool build_video_timing(const video_mode_t* mode, uint32_t sys_clock_hz, video_timing_t* timing) {
+    // Horizontal timings are worked out in system clock cycles from the start of the hsync pulse
+    double cycles_per_clock = (double)sys_clock_hz / mode->pixel_clock_hz;
+    int h_total = mode->h_sync + mode->h_back_porch + mode->h_visible + mode->h_front_porch;
+
+    timing->mode = mode;
+    timing->sys_clock_hz = sys_clock_hz;
+    timing->line_cycles = lround(h_total * cycles_per_clock);
+    timing->pixel_cycles = lround(mode->pixel_repeat * cycles_per_clock);
+    timing->display_lines = mode->height * mode->line_repeat;
+    timing->num_segments = 0;
+
+    if ((timing->pixel_cycles < LINE_PROGRAM_MIN_PIXEL_CYCLES) ||
+        (timing->pixel_cycles > LINE_PROGRAM_MAX_PIXEL_CYCLES) || (mode->width & 1)) {
+        return false;
+    }
+
+    // Centre the drawn pixels in the visible area, the active segment begins early enough for the
+    // line program's first pixel to land there and lasts until it's ready for the next line
+    int drawn_cycles = mode->width * timing->pixel_cycles;
+    double visible_start = (mode->h_sync + mode->h_back_porch) * cycles_per_clock;
+    double visible_cycles = mode->h_visible * cycles_per_clock;
+    int pixel_start = lround(visible_start + (visible_cycles - drawn_cycles) / 2);
+
+    int segment_cycles[SYNC_WORDS_PER_LINE];
+    segment_cycles[0] = lround(mode->h_sync * cycles_per_clock);
+    segment_cycles[1] = pixel_start - LINE_PROGRAM_LEAD_CYCLES - segment_cycles[0];
+    segment_cycles[2] = LINE_PROGRAM_LEAD_CYCLES + drawn_cycles + LINE_PROGRAM_TAIL_CYCLES;
+    segment_cycles[3] = timing->line_cycles - segment_cycles[0] - segment_cycles[1] -
+        segment_cycles[2];
+
+    // Drawn pixels wider than the visible area spill into the porches, keep at least half of each
+    int back_porch_left = segment_cycles[1] + LINE_PROGRAM_LEAD_CYCLES;
+    int front_porch_left = segment_cycles[3] + LINE_PROGRAM_TAIL_CYCLES;
+
+    if ((back_porch_left < mode->h_back_porch * cycles_per_clock / 2) ||
+        (front_porch_left < mode->h_front_porch * cycles_per_clock / 2)) {
+        return false;
+    }
+
+    for(int type = 0;type < kNumSyncLineTypes; ++type) {
+        bool vsync = (type == kSyncLineVsync) == mode->v_sync_positive;
+
+        for(int i = 0;i < SYNC_WORDS_PER_LINE; ++i) {
+            int delay = segment_cycles[i] - SYNC_COMMAND_CYCLES;
+
+            if ((delay < 0) || (delay > SYNC_COMMAND_MAX_DELAY)) {
+                return false;
+            }
+
+            bool hsync = (i == 0) == mode->h_sync_positive;
+            uint16_t exec = ((type == kSyncLineActive) && (i == 2)) ? SYNC_EXEC_LINE_IRQ :
+                SYNC_EXEC_NOP;
+
+            timing->words[type][i] = sync_command_word(exec, delay, hsync, vsync);
+        }
+    }
+
+    // Vertically the frame starts with the vsync pulse. The dummy lines come immediately before
+    // the first drawn line so must fit in the back porch and top border.
+    if (timing->display_lines > mode->v_visible) {
+        return false;
+    }
+
+    int top_border = (mode->v_visible - timing->display_lines) / 2;
+    int bottom_border = mode->v_visible - timing->display_lines - top_border;
+
+    return add_timing_segment(timing, kSyncLineVsync, mode->v_sync) &&
+        add_timing_segment(timing, kSyncLineBlank,
+            mode->v_back_porch + top_border - VIDEO_DUMMY_LINES) &&
+        add_timing_segment(timing, kSyncLineActive, VIDEO_DUMMY_LINES + timing->display_lines) &&
+        add_timing_segment(timing, kSyncLineBlank, bottom_border + mode->v_front_porch);
+}
@@ -0,0 +1,173 @@
+#ifndef __PIO_VGA_VIDEO_MODE_H__
+#define __PIO_VGA_VIDEO_MODE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**************************************************************************************************
+ *                             Video Modes                                                        *
+ * Generates the sync state machine command words and the per line state machine run by the       *
+ * sync DMA interrupt from a description of a VGA mode's timings. Like the renderer nothing in    *
+ * here depends upon the Pico SDK so every mode can be checked on a host (see                     *
+ * `host/check_video_modes.c`).                                                                   *
+ *                                                                                                *
+ * Each sync command word is streamed to the `sync_out` program in `video_fifth.pio`:             *
+ *  - Bits 0 - 1: hsync and vsync pin levels                                                      *
+ *  - Bits 2 - 15: delay, the pins are held for `delay + SYNC_COMMAND_CYCLES` cycles              *
+ *  - Bits 16 - 31: instruction to execute, a nop or an `irq set` starting the `line_out` program *
+ * Four words make a line: sync pulse, back porch, active area and front porch.                   *
+ **************************************************************************************************/
+
+// The `sync_out` program spends 6 cycles on each command word beyond its delay (pull, 3 outs, the
+// executed instruction and the final pass of the delay loop)
+#define SYNC_COMMAND_CYCLES 6
+#define SYNC_COMMAND_MAX_DELAY ((1 << 14) - 1)
+#define SYNC_PIN_HSYNC 1
+#define SYNC_PIN_VSYNC 2
+
+// Instructions executed by the sync command words, as `pio_encode_nop()` (`mov y, y`) and
+// `pio_encode_irq_set(false, 4)` give them. `pio_vga_fifth.c` checks them against the SDK.
+#define SYNC_EXEC_NOP 0xa042
+#define SYNC_EXEC_LINE_IRQ 0xc004
+
+// The `line_out` program (and `line_out_rgb332`, which has the same timing) outputs its first
+// pixel this many cycles after the sync state machine raises the line IRQ, and needs this many
+// cycles after the last pixel ends before it's waiting for the next one
+#define LINE_PROGRAM_LEAD_CYCLES 3
+#define LINE_PROGRAM_TAIL_CYCLES 2
+// Every pixel takes at least the `pull ifempty`, `out` and `jmp` of the pixel loop, the delay on
+// the `out` gives the rest (up to 31 cycles)
+#define LINE_PROGRAM_MIN_PIXEL_CYCLES 3
+#define LINE_PROGRAM_MAX_PIXEL_CYCLES (LINE_PROGRAM_MIN_PIXEL_CYCLES + 31)
+
+// Lines before the first drawn line where the line program outputs `line_data_zero_buffer` to
+// get the line DMA going, they're placed in the vertical blanking (or border) before it
+#define VIDEO_DUMMY_LINES 3
+
+typedef struct {
+    const char* name;
+    // Timings from the mode's specification, horizontal in pixel clocks, vertical in lines
+    uint32_t pixel_clock_hz;
+    uint16_t h_visible;
+    uint16_t h_front_porch;
+    uint16_t h_sync;
+    uint16_t h_back_porch;
+    uint16_t v_visible;
+    uint16_t v_front_porch;
+    uint16_t v_sync;
+    uint16_t v_back_porch;
+    // Sync polarities, true when the pulse is high
+    bool h_sync_positive;
+    bool v_sync_positive;
+    // Pixels and lines drawn, centred in the visible area with a black border around them when
+    // they don't fill it
+    uint16_t width;
+    uint16_t height;
+    // Pixel clocks each drawn pixel lasts (rounded to whole system clock cycles) and the number of
+    // VGA lines each drawn line is output for
+    float pixel_repeat;
+    uint8_t line_repeat;
+} video_mode_t;
+
+typedef enum {
+    // 640x480@60 drawing 320x240, every pixel and line doubled
+    kVideoMode640x480,
+    // 640x480@60 drawing the middle 256x240
+    kVideoMode640x480Narrow,
+    // 800x600@60 drawing 320x240 with a border, pixels 2.25 and lines 2 times their size
+    kVideoMode800x600,
+    // 800x600@60 drawing the middle 256x240
+    kVideoMode800x600Narrow,
+    kNumVideoModes
+} video_mode_id_t;
+
+extern const video_mode_t video_modes[kNumVideoModes];
+
+typedef enum {
+    kSyncLineVsync,
+    kSyncLineBlank,
+    kSyncLineActive,
+    kNumSyncLineTypes
+} sync_line_type_t;
+
+#define SYNC_WORDS_PER_LINE 4
+#define MAX_TIMING_SEGMENTS 4
+// A DMA channel can send a whole segment's command words without the CPU by reading a line's words
+// round and round, its read address wrapping every (1 << SYNC_WORDS_RING_BITS) bytes
+#define SYNC_WORDS_RING_BITS 4
+
+// A run of lines that all use the same sync command words
+typedef struct {
+    sync_line_type_t type;
+    int num_lines;
+} timing_segment_t;
+
+typedef struct {
+    const video_mode_t* mode;
+    uint32_t sys_clock_hz;
+    // Command words for each type of line. Active lines raise the line IRQ, the others only
+    // execute nops so the line program outputs nothing. Aligned for the DMA read ring.
+    uint32_t __attribute__ ((aligned (1 << SYNC_WORDS_RING_BITS)))
+        words[kNumSyncLineTypes][SYNC_WORDS_PER_LINE];
+    // The lines of a frame starting with the vsync pulse. Active lines begin with
+    // VIDEO_DUMMY_LINES dummy lines.
+    timing_segment_t segments[MAX_TIMING_SEGMENTS];
+    int num_segments;
+    // System clock cycles per line and per drawn pixel
+    int line_cycles;
+    int pixel_cycles;
+    // Display lines in a frame excluding the dummy lines (`height * line_repeat`)
+    int display_lines;
+} video_timing_t;
+
+// Generate the timing for `mode` at a system clock of `sys_clock_hz`. Returns false if the mode
+// can't be output at that clock (pixels too long or short for the line program, the drawn pixels
+// would cover more than half of either porch or a delay is too long for a command word).
+bool build_video_timing(const video_mode_t* mode, uint32_t sys_clock_hz, video_timing_t* timing);
+
+// Assemble a sync command word
+static inline uint32_t sync_command_word(uint16_t exec, int delay, bool hsync, bool vsync) {
+    return ((uint32_t)exec << 16) | (delay << 2) | (vsync ? SYNC_PIN_VSYNC : 0) |
+        (hsync ? SYNC_PIN_HSYNC : 0);
+}
+
+// Command words sent for a segment, its line's words repeated for every line
+static inline uint32_t timing_segment_transfers(const timing_segment_t* segment) {
+    return segment->num_lines * SYNC_WORDS_PER_LINE;
+}
+
+// Timing line state machine, stepped by the sync DMA interrupt each time a line's command words
+// have been sent (when the words aren't chained by DMA, see `timing_segment_transfers`)
+typedef struct {
+    const video_timing_t* timing;
+    int segment;
+    int lines_left;
+} timing_line_state_t;
+
+// Start at the first line of the vsync pulse, returns its command words
+static inline const uint32_t* timing_line_start(timing_line_state_t* state,
+    const video_timing_t* timing) {
+
+    state->timing = timing;
+    state->segment = 0;
+    state->lines_left = timing->segments[0].num_lines;
+
+    return timing->words[timing->segments[0].type];
+}
+
+// Advance to the next line returning its command words
+static inline const uint32_t* timing_line_next(timing_line_state_t* state) {
+    const video_timing_t* timing = state->timing;
+
+    if (--state->lines_left == 0) {
+        if (++state->segment == timing->num_segments) {
+            state->segment = 0;
+        }
+
+        state->lines_left = timing->segments[state->segment].num_lines;
+    }
+
+    return timing->words[timing->segments[state->segment].type];
+}
+
+#endif
@@ -5,7 +5,7 @@
 int num_sprite = 72;
 int sprite_height = 18;
 
-uint16_t sprite_data[] = {
+const uint16_t sprite_data[] = {
   0x7c1f,
   0x7c1f,
   0x7c1f,
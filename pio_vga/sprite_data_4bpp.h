@@ -0,0 +1,516 @@
+// Art by Charles Gabriel, commissioned by OpenGameArt
+// (https://opengameart.org/content/twelve-16x18-rpg-sprites-plus-base).
+// Licensed under CC BY 3.0 (https://creativecommons.org/licenses/by/3.0/)
+//
+
+int sprite_4bpp_count = 52;
+int sprite_4bpp_height = 18;
+int sprite_4bpp_num_banks = 7;
+
+const uint16_t sprite_4bpp_palette[] = {
+  0x7c1f, 0x0ca9, 0x1573, 0x2108, 0x2297, 0x30e6, 0x325b, 0x3b5d,
+  0x4210, 0x4511, 0x4d47, 0x535e, 0x631f, 0x6a17, 0x722c, 0x7fff,
+  0x7c1f, 0x0ca9, 0x1573, 0x2108, 0x2297, 0x30e6, 0x325b, 0x3b5d,
+  0x4210, 0x4511, 0x4d47, 0x535e, 0x722c, 0x7a5a, 0x7fff, 0x0000,
+  0x7c1f, 0x0574, 0x0ca9, 0x12dc, 0x1ce7, 0x325b, 0x35f0, 0x3fdf,
+  0x46b6, 0x535e, 0x56b5, 0x5b5c, 0x7bde, 0x7fff, 0x0000, 0x0000,
+  0x7c1f, 0x044c, 0x0ca9, 0x0cb1, 0x2297, 0x2d4a, 0x325b, 0x3b5d,
+  0x3e19, 0x49ef, 0x535e, 0x56d6, 0x735a, 0x7fff, 0x0000, 0x0000,
+  0x7c1f, 0x0ca9, 0x0d40, 0x0dd4, 0x19e0, 0x2297, 0x233d, 0x325b,
+  0x3b2b, 0x3b5d, 0x535e, 0x7f4f, 0x7fff, 0x0000, 0x0000, 0x0000,
+  0x7c1f, 0x0931, 0x0ca9, 0x30e6, 0x325b, 0x3639, 0x4210, 0x49cc,
+  0x535e, 0x6739, 0x7759, 0x7fff, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x7c1f, 0x0822, 0x0ca9, 0x1ce7, 0x318c, 0x325b, 0x4210, 0x535e,
+  0x631f, 0x7f4f, 0x7fff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+const uint8_t sprite_4bpp_banks[] = {
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03,
+};
+
+int sprite_4bpp_num_frames = 72;
+const uint16_t sprite_4bpp_frames[] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x4005, 0x4004, 0x4003, 0x0009, 0x000a, 0x000b, 0x000c,
+  0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x400e, 0x400d, 0x0012,
+  0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a,
+  0x001b, 0x4018, 0x4017, 0x4016, 0x001c, 0x001d, 0x401c, 0x001e,
+  0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x4020, 0x401f, 0x401e,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+  0x002c, 0x4029, 0x4028, 0x4027, 0x002d, 0x002e, 0x402d, 0x002f,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x4032, 0x4031, 0x4030, 0x402f,
+};
+
+const uint8_t __attribute__ ((aligned (4))) sprite_4bpp_data[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00,
+  0x10, 0x13, 0x71, 0x73, 0x33, 0x13, 0x00, 0x00, 0x00, 0x31, 0x73, 0x77, 0x37, 0x37, 0x01, 0x00,
+  0x00, 0x10, 0x77, 0x77, 0x77, 0x77, 0x01, 0x00, 0x00, 0x11, 0x73, 0x73, 0x73, 0x73, 0x01, 0x00,
+  0x10, 0x10, 0x31, 0x73, 0x33, 0x73, 0x01, 0x00, 0x00, 0x00, 0x31, 0x33, 0x33, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x40, 0xa4, 0x1a, 0x1a, 0x4a, 0x04, 0x00,
+  0x00, 0xc4, 0x4a, 0xca, 0xac, 0xa4, 0x4a, 0x00, 0x00, 0xa4, 0x4a, 0xa4, 0x4a, 0x44, 0x44, 0x00,
+  0x00, 0x52, 0x42, 0x4a, 0xa4, 0x24, 0x25, 0x00, 0x20, 0x59, 0xa2, 0xa4, 0x4a, 0x2a, 0x25, 0x00,
+  0x20, 0x55, 0x4a, 0x48, 0x84, 0xa4, 0x02, 0x00, 0x00, 0x22, 0x64, 0x88, 0xb8, 0x46, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x4a, 0xaa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xcc, 0x4a, 0x00, 0x00,
+  0x10, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00, 0x10, 0x13, 0x71, 0x73, 0x33, 0x13, 0x00, 0x00,
+  0x00, 0x31, 0x73, 0x77, 0x37, 0x37, 0x01, 0x00, 0x00, 0x10, 0x77, 0x77, 0x77, 0x77, 0x01, 0x00,
+  0x00, 0x11, 0x73, 0x73, 0x73, 0x73, 0x01, 0x00, 0x10, 0x10, 0x31, 0x73, 0x33, 0x73, 0x01, 0x00,
+  0x00, 0x00, 0x31, 0x33, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00, 0x11, 0x33, 0x33, 0x11, 0x00, 0x00,
+  0x00, 0x40, 0xa4, 0x1a, 0x1a, 0x4a, 0x04, 0x00, 0x00, 0xc4, 0x4a, 0xca, 0xac, 0xa4, 0x4c, 0x00,
+  0x00, 0xa4, 0x4a, 0xa4, 0x4a, 0xa4, 0x4a, 0x00, 0x00, 0x52, 0x42, 0x4a, 0xa4, 0x24, 0x25, 0x00,
+  0x20, 0x59, 0xa2, 0xa4, 0x4a, 0x2a, 0x95, 0x02, 0x20, 0x55, 0x44, 0x48, 0x84, 0x44, 0x55, 0x02,
+  0x00, 0x22, 0x64, 0xb8, 0x8b, 0x46, 0x22, 0x00, 0x00, 0x00, 0x40, 0x4a, 0xa4, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0xa4, 0x4a, 0xa4, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00,
+  0x10, 0x13, 0x71, 0x73, 0x33, 0x13, 0x00, 0x00, 0x00, 0x31, 0x73, 0x77, 0x37, 0x37, 0x01, 0x00,
+  0x00, 0x10, 0x77, 0x77, 0x77, 0x77, 0x01, 0x00, 0x00, 0x11, 0x73, 0x73, 0x73, 0x73, 0x01, 0x00,
+  0x10, 0x10, 0x31, 0x73, 0x33, 0x73, 0x01, 0x00, 0x00, 0x00, 0x31, 0x33, 0x33, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x40, 0xa4, 0x1a, 0x1a, 0x4a, 0x04, 0x00,
+  0x00, 0xa4, 0x4a, 0xca, 0xac, 0xa4, 0x4c, 0x00, 0x00, 0x44, 0x44, 0xa4, 0x4a, 0xa4, 0x4a, 0x00,
+  0x00, 0x52, 0x42, 0x4a, 0xa4, 0x24, 0x25, 0x00, 0x00, 0x52, 0xa2, 0xa4, 0x4a, 0x2a, 0x95, 0x02,
+  0x00, 0x20, 0x4a, 0x48, 0x84, 0xa4, 0x55, 0x02, 0x00, 0x00, 0x64, 0x8b, 0x88, 0x46, 0x22, 0x00,
+  0x00, 0x00, 0x40, 0xaa, 0xa4, 0x44, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xcc, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x31, 0x33, 0x37, 0x13, 0x31, 0x01, 0x00, 0x10, 0x73, 0x73, 0x77, 0x33, 0x13, 0x00,
+  0x00, 0x10, 0x77, 0x77, 0x71, 0x37, 0x01, 0x00, 0x00, 0x10, 0x77, 0x17, 0x71, 0x71, 0x11, 0x00,
+  0x00, 0x10, 0x73, 0x25, 0x92, 0x72, 0x01, 0x01, 0x00, 0x10, 0x73, 0xd9, 0x94, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x95, 0x99, 0x12, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x52, 0x25, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0xaa, 0x4c, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x40, 0xca, 0x4c, 0xca, 0x04, 0x00, 0x00,
+  0x00, 0x20, 0x52, 0x42, 0xa4, 0x24, 0x00, 0x00, 0x00, 0x52, 0x29, 0xaa, 0x4a, 0x25, 0x00, 0x00,
+  0x00, 0x92, 0xa9, 0x4a, 0xb4, 0x04, 0x00, 0x00, 0x00, 0x20, 0xa2, 0x64, 0xbb, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x44, 0xa4, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0xa4, 0xcc, 0x04, 0x00,
+  0x00, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x01, 0x00, 0x00, 0x31, 0x33, 0x37, 0x13, 0x31, 0x01,
+  0x00, 0x10, 0x73, 0x73, 0x77, 0x33, 0x13, 0x00, 0x00, 0x10, 0x77, 0x77, 0x71, 0x37, 0x01, 0x00,
+  0x00, 0x10, 0x77, 0x17, 0x71, 0x71, 0x11, 0x00, 0x00, 0x10, 0x73, 0x25, 0x92, 0x72, 0x01, 0x01,
+  0x00, 0x10, 0x73, 0xd9, 0x94, 0x32, 0x00, 0x00, 0x00, 0x00, 0x21, 0x95, 0x99, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0xa4, 0x52, 0x25, 0x00, 0x00, 0x00, 0x00, 0x40, 0xaa, 0x4c, 0xcc, 0x04, 0x00, 0x00,
+  0x00, 0x40, 0xca, 0x4c, 0xca, 0x04, 0x00, 0x00, 0x00, 0x00, 0x52, 0x42, 0xa4, 0x04, 0x00, 0x00,
+  0x00, 0x20, 0x59, 0xa2, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x20, 0x99, 0x4a, 0xb4, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x64, 0xbb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x4a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa4, 0xca, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x31, 0x33, 0x37, 0x13, 0x31, 0x01, 0x00, 0x10, 0x73, 0x73, 0x77, 0x33, 0x13, 0x00,
+  0x00, 0x10, 0x77, 0x77, 0x71, 0x37, 0x01, 0x00, 0x00, 0x10, 0x77, 0x17, 0x71, 0x71, 0x11, 0x00,
+  0x00, 0x10, 0x73, 0x25, 0x92, 0x72, 0x01, 0x01, 0x00, 0x10, 0x73, 0xd9, 0x94, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x95, 0x99, 0x12, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x52, 0x25, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0xaa, 0x4c, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x40, 0xca, 0x4c, 0xca, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x52, 0x42, 0xa4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x52, 0x95, 0x4a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x99, 0xb4, 0x04, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0xbb, 0x04, 0x00, 0x00,
+  0x00, 0x40, 0xaa, 0x44, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x40, 0xaa, 0x4a, 0xca, 0x4c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00,
+  0x10, 0x13, 0x31, 0x73, 0x33, 0x13, 0x00, 0x00, 0x00, 0x31, 0x33, 0x77, 0x37, 0x37, 0x01, 0x00,
+  0x00, 0x10, 0x73, 0x17, 0x77, 0x77, 0x01, 0x00, 0x00, 0x11, 0x17, 0x17, 0x71, 0x71, 0x01, 0x00,
+  0x10, 0x10, 0x27, 0x92, 0x29, 0x72, 0x01, 0x00, 0x00, 0x00, 0xd3, 0x94, 0x49, 0x3d, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x95, 0x59, 0x12, 0x00, 0x00, 0x00, 0x40, 0xa4, 0x52, 0x25, 0x4a, 0x04, 0x00,
+  0x00, 0xc4, 0x4a, 0xca, 0xac, 0xa4, 0x4c, 0x00, 0x00, 0xa4, 0x4a, 0xa4, 0x4a, 0x44, 0x44, 0x00,
+  0x00, 0x52, 0x42, 0x4c, 0xc4, 0x24, 0x25, 0x00, 0x20, 0x59, 0xa2, 0xa4, 0x4a, 0x2a, 0x29, 0x00,
+  0x20, 0x99, 0x4a, 0x48, 0x84, 0xa4, 0x02, 0x00, 0x00, 0x22, 0x64, 0x88, 0xb8, 0x46, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x4a, 0xaa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xca, 0x4c, 0x00, 0x00,
+  0x10, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00, 0x10, 0x13, 0x31, 0x73, 0x33, 0x13, 0x00, 0x00,
+  0x00, 0x31, 0x33, 0x77, 0x37, 0x37, 0x01, 0x00, 0x00, 0x10, 0x73, 0x17, 0x77, 0x77, 0x01, 0x00,
+  0x00, 0x11, 0x17, 0x17, 0x71, 0x71, 0x01, 0x00, 0x10, 0x10, 0x27, 0x92, 0x29, 0x72, 0x01, 0x00,
+  0x00, 0x00, 0xd3, 0x94, 0x49, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x21, 0x95, 0x59, 0x12, 0x00, 0x00,
+  0x00, 0x40, 0xa4, 0x52, 0x25, 0x4a, 0x04, 0x00, 0x00, 0xc4, 0x4a, 0xca, 0xac, 0xa4, 0x4c, 0x00,
+  0x00, 0xa4, 0x4a, 0xa4, 0x4a, 0xa4, 0x4a, 0x00, 0x00, 0x52, 0x42, 0x4c, 0xc4, 0x24, 0x25, 0x00,
+  0x20, 0x59, 0xa2, 0xa4, 0x4a, 0x2a, 0x95, 0x02, 0x20, 0x99, 0x4a, 0x48, 0x84, 0xa4, 0x99, 0x02,
+  0x00, 0x22, 0x64, 0x8b, 0xb8, 0x46, 0x22, 0x00, 0x00, 0x00, 0x40, 0xaa, 0xaa, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0xc4, 0x4a, 0xa4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00,
+  0x10, 0x13, 0x31, 0x73, 0x33, 0x13, 0x00, 0x00, 0x00, 0x31, 0x33, 0x77, 0x37, 0x37, 0x01, 0x00,
+  0x00, 0x10, 0x73, 0x17, 0x77, 0x77, 0x01, 0x00, 0x00, 0x11, 0x17, 0x17, 0x71, 0x71, 0x01, 0x00,
+  0x10, 0x10, 0x27, 0x92, 0x29, 0x72, 0x01, 0x00, 0x00, 0x00, 0xd3, 0x94, 0x49, 0x3d, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x95, 0x59, 0x12, 0x00, 0x00, 0x00, 0x40, 0xa4, 0x52, 0x25, 0x4a, 0x04, 0x00,
+  0x00, 0xc4, 0x4a, 0xca, 0xac, 0xa4, 0x4c, 0x00, 0x00, 0x44, 0x44, 0xa4, 0x4a, 0xa4, 0x4a, 0x00,
+  0x00, 0x52, 0x42, 0x4c, 0xc4, 0x24, 0x25, 0x00, 0x00, 0x92, 0xa2, 0xa4, 0x4a, 0x2a, 0x95, 0x02,
+  0x00, 0x20, 0x4a, 0x48, 0x84, 0xa4, 0x99, 0x02, 0x00, 0x00, 0x64, 0x8b, 0x88, 0x46, 0x22, 0x00,
+  0x00, 0x00, 0x40, 0xaa, 0xa4, 0x44, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xac, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0x77, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x44, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x41, 0x42, 0x74, 0x17, 0x00, 0x01,
+  0x00, 0x10, 0x74, 0x47, 0x74, 0x47, 0x11, 0x00, 0x00, 0x20, 0x42, 0x74, 0x47, 0x24, 0x02, 0x00,
+  0x00, 0x11, 0x21, 0x44, 0x44, 0x12, 0x09, 0x00, 0x10, 0x90, 0x11, 0x22, 0x22, 0x11, 0x0d, 0x00,
+  0x00, 0x00, 0x1d, 0xcd, 0xcd, 0xd1, 0x9c, 0x00, 0x00, 0xd9, 0xdc, 0xcc, 0xcd, 0xcd, 0x9c, 0x00,
+  0x00, 0x59, 0x9d, 0xdc, 0xc9, 0xdd, 0x99, 0x00, 0x00, 0x50, 0x99, 0x9d, 0xd9, 0x99, 0x05, 0x00,
+  0x00, 0xe1, 0x55, 0xe9, 0xae, 0x59, 0x5e, 0x00, 0x10, 0x6b, 0xa5, 0xee, 0xee, 0x55, 0x16, 0x00,
+  0x10, 0x66, 0xa5, 0xaa, 0xae, 0x55, 0x01, 0x00, 0x00, 0x11, 0xa5, 0xa5, 0xaa, 0x55, 0x00, 0x00,
+  0x00, 0x50, 0x55, 0x55, 0x5a, 0xa5, 0x05, 0x00, 0x00, 0x00, 0x11, 0x11, 0x74, 0x17, 0x55, 0x00,
+  0x00, 0x00, 0x10, 0x74, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x21, 0x44, 0x77, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x42, 0x74, 0x17, 0x00, 0x01, 0x00, 0x10, 0x74, 0x47, 0x74, 0x47, 0x11, 0x00,
+  0x00, 0x20, 0x42, 0x74, 0x47, 0x24, 0x02, 0x00, 0x00, 0x11, 0x21, 0x44, 0x44, 0x12, 0x09, 0x00,
+  0x10, 0x90, 0x11, 0x22, 0x22, 0x11, 0x0d, 0x00, 0x00, 0x00, 0x1d, 0xcd, 0xcd, 0xd1, 0x9c, 0x00,
+  0x00, 0xd9, 0xdc, 0xcc, 0xcd, 0xcd, 0x9c, 0x00, 0x00, 0x59, 0x9d, 0xdc, 0xc9, 0xdd, 0x99, 0x00,
+  0x00, 0x50, 0x99, 0x9d, 0xd9, 0x99, 0x05, 0x00, 0x00, 0xe5, 0x55, 0xe9, 0xae, 0x59, 0x5e, 0x00,
+  0x10, 0x6b, 0xa5, 0xee, 0xee, 0x5a, 0xb6, 0x01, 0x10, 0x66, 0xa5, 0xaa, 0xae, 0x5a, 0x66, 0x01,
+  0x00, 0x11, 0xa5, 0xa5, 0xaa, 0x5a, 0x11, 0x00, 0x00, 0x50, 0x55, 0x55, 0x5a, 0x55, 0x05, 0x00,
+  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0x77, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x44, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x41, 0x42, 0x74, 0x17, 0x00, 0x01,
+  0x00, 0x10, 0x74, 0x47, 0x74, 0x47, 0x11, 0x00, 0x00, 0x20, 0x42, 0x74, 0x47, 0x24, 0x02, 0x00,
+  0x00, 0x11, 0x21, 0x44, 0x44, 0x12, 0x09, 0x00, 0x10, 0x90, 0x11, 0x22, 0x22, 0x11, 0x0d, 0x00,
+  0x00, 0x00, 0x1d, 0xcd, 0xcd, 0xd1, 0x9c, 0x00, 0x00, 0xd9, 0xdc, 0xcc, 0xcd, 0xcd, 0x9c, 0x00,
+  0x00, 0x59, 0x9d, 0xdc, 0xc9, 0xdd, 0x99, 0x00, 0x00, 0x50, 0x99, 0x9d, 0xd9, 0x99, 0x05, 0x00,
+  0x00, 0xe5, 0x95, 0xea, 0x9e, 0x55, 0x5e, 0x00, 0x00, 0x61, 0x55, 0xee, 0xee, 0x5a, 0xb6, 0x01,
+  0x00, 0x10, 0x55, 0xea, 0xaa, 0x5a, 0x66, 0x01, 0x00, 0x00, 0x55, 0xaa, 0x5a, 0x5a, 0x11, 0x00,
+  0x00, 0x50, 0x5a, 0xa5, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x71, 0x47, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0x77, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x74, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x74, 0x17, 0x00, 0x01,
+  0x00, 0x10, 0x44, 0x74, 0xbb, 0xbb, 0x11, 0x00, 0x00, 0x20, 0x22, 0x42, 0x44, 0x22, 0x02, 0x00,
+  0x00, 0x11, 0xd1, 0xdc, 0xb1, 0x1b, 0x09, 0x00, 0x10, 0x90, 0xc1, 0xdc, 0x9f, 0x1b, 0x0d, 0x00,
+  0x00, 0xd0, 0xcd, 0x91, 0xbb, 0x1b, 0x00, 0x00, 0x00, 0xd0, 0xd9, 0x15, 0x66, 0x01, 0x00, 0x00,
+  0x00, 0x90, 0x59, 0xae, 0x82, 0x38, 0x00, 0x00, 0x00, 0x00, 0x59, 0xaa, 0x25, 0x77, 0x00, 0x00,
+  0x00, 0x00, 0x51, 0x5e, 0xa5, 0x38, 0x01, 0x00, 0x00, 0x10, 0xb6, 0x51, 0xaa, 0x68, 0x01, 0x00,
+  0x00, 0x10, 0xbb, 0x56, 0xea, 0x33, 0x00, 0x00, 0x00, 0x00, 0x11, 0x55, 0xea, 0x3e, 0x00, 0x00,
+  0x00, 0x50, 0x55, 0x55, 0x33, 0x44, 0x03, 0x00, 0x00, 0x55, 0x15, 0x44, 0x1f, 0x74, 0x17, 0x00,
+  0x00, 0x00, 0x10, 0x44, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x21, 0x74, 0x77, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x22, 0x74, 0x17, 0x00, 0x01, 0x00, 0x10, 0x44, 0x74, 0xbb, 0xbb, 0x11, 0x00,
+  0x00, 0x20, 0x22, 0x42, 0x44, 0x22, 0x02, 0x00, 0x00, 0x11, 0xd1, 0xdc, 0xb1, 0x1b, 0x09, 0x00,
+  0x10, 0x90, 0xc1, 0xdc, 0x9f, 0x1b, 0x0d, 0x00, 0x00, 0xd0, 0xcd, 0x91, 0xbb, 0x1b, 0x00, 0x00,
+  0x00, 0xd0, 0xd9, 0x15, 0x66, 0x01, 0x00, 0x00, 0x00, 0x90, 0x59, 0xae, 0x82, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x59, 0xaa, 0x25, 0x77, 0x00, 0x00, 0x00, 0x00, 0x50, 0x5e, 0xa5, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0xb1, 0x56, 0xaa, 0x38, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x6b, 0xea, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x51, 0xea, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x55, 0x15, 0x44, 0x55, 0x00, 0x00,
+  0x00, 0x50, 0x55, 0x15, 0x74, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0x77, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x74, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x74, 0x17, 0x00, 0x01,
+  0x00, 0x10, 0x44, 0x74, 0xbb, 0xbb, 0x11, 0x00, 0x00, 0x20, 0x22, 0x42, 0x44, 0x22, 0x02, 0x00,
+  0x00, 0x11, 0xd1, 0xdc, 0xb1, 0x1b, 0x09, 0x00, 0x10, 0x90, 0xc1, 0xdc, 0x9f, 0x1b, 0x0d, 0x00,
+  0x00, 0xd0, 0xcd, 0x91, 0xbb, 0x1b, 0x00, 0x00, 0x00, 0xd0, 0xd9, 0x15, 0x66, 0x01, 0x00, 0x00,
+  0x00, 0x90, 0x59, 0xae, 0x82, 0x38, 0x00, 0x00, 0x00, 0x00, 0x59, 0xaa, 0x25, 0x77, 0x00, 0x00,
+  0x00, 0x00, 0x50, 0x1e, 0x55, 0x88, 0x00, 0x00, 0x00, 0x00, 0x55, 0x66, 0xab, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x55, 0xb1, 0x5b, 0x3e, 0x00, 0x00, 0x00, 0x50, 0x55, 0x15, 0xa1, 0x3e, 0x00, 0x00,
+  0x00, 0x55, 0x5a, 0x55, 0x4a, 0x04, 0x00, 0x00, 0x50, 0x55, 0x41, 0x44, 0x41, 0x77, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x71, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0x77, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x44, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x74, 0x17, 0x00, 0x01,
+  0x00, 0x10, 0x74, 0xbb, 0xbb, 0x47, 0x11, 0x00, 0x00, 0x20, 0x22, 0x42, 0x24, 0x22, 0x02, 0x00,
+  0x00, 0x11, 0x11, 0xb6, 0x6b, 0x11, 0x09, 0x00, 0x10, 0x90, 0xe1, 0xb9, 0x9b, 0x1e, 0x0d, 0x00,
+  0x00, 0xd0, 0x1d, 0xb6, 0x6b, 0xd1, 0x9d, 0x00, 0x00, 0xd9, 0xa5, 0x61, 0x16, 0x5a, 0x9d, 0x00,
+  0x00, 0x59, 0x2c, 0x35, 0x53, 0xc2, 0x95, 0x00, 0x00, 0x50, 0xac, 0x72, 0x27, 0xca, 0x05, 0x00,
+  0x00, 0xc5, 0xaa, 0x85, 0x58, 0xaa, 0x5c, 0x00, 0x10, 0x6b, 0xa5, 0x85, 0x58, 0x5a, 0x16, 0x00,
+  0x10, 0xbb, 0x56, 0x35, 0x53, 0x55, 0x01, 0x00, 0x00, 0x11, 0x55, 0x35, 0x53, 0xa5, 0x05, 0x00,
+  0x00, 0x55, 0x11, 0x14, 0x51, 0xa5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0x17, 0x55, 0x00,
+  0x00, 0x00, 0x10, 0x74, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x21, 0x44, 0x77, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x22, 0x74, 0x17, 0x00, 0x01, 0x00, 0x10, 0x74, 0xbb, 0xbb, 0x47, 0x11, 0x00,
+  0x00, 0x20, 0x22, 0x42, 0x24, 0x22, 0x02, 0x00, 0x00, 0x11, 0x11, 0xb6, 0x6b, 0x11, 0x09, 0x00,
+  0x10, 0x90, 0xf1, 0xb9, 0x9b, 0x1f, 0x0d, 0x00, 0x00, 0x00, 0x1d, 0xb6, 0x6b, 0xd1, 0x9c, 0x00,
+  0x00, 0xd9, 0xa5, 0x61, 0x16, 0x5a, 0x9c, 0x00, 0x00, 0x59, 0x2e, 0x35, 0x53, 0xe2, 0x95, 0x00,
+  0x00, 0x50, 0xae, 0x72, 0x27, 0xea, 0x05, 0x00, 0x00, 0xe5, 0xaa, 0x85, 0x58, 0xaa, 0x5e, 0x00,
+  0x10, 0x6b, 0xa5, 0x85, 0x58, 0x5a, 0xb6, 0x01, 0x10, 0xbb, 0x56, 0x35, 0x53, 0x65, 0xbb, 0x01,
+  0x00, 0x11, 0x5a, 0x35, 0x53, 0xa5, 0x11, 0x00, 0x00, 0x50, 0x5a, 0x15, 0x51, 0xa5, 0x05, 0x00,
+  0x00, 0x55, 0x71, 0x14, 0x41, 0x17, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x71, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0x77, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x44, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x74, 0x17, 0x00, 0x01,
+  0x00, 0x10, 0x74, 0xbb, 0xbb, 0x47, 0x11, 0x00, 0x00, 0x20, 0x22, 0x42, 0x24, 0x22, 0x02, 0x00,
+  0x00, 0x11, 0x11, 0xb6, 0x6b, 0x11, 0x09, 0x00, 0x10, 0x90, 0xe1, 0xb9, 0x9b, 0x1e, 0x0d, 0x00,
+  0x00, 0xd0, 0x1d, 0xb6, 0x6b, 0xd1, 0x9d, 0x00, 0x00, 0xd9, 0xa5, 0x61, 0x16, 0x5a, 0x9d, 0x00,
+  0x00, 0x59, 0x2c, 0x35, 0x53, 0xc2, 0x95, 0x00, 0x00, 0x50, 0xac, 0x72, 0x27, 0xca, 0x05, 0x00,
+  0x00, 0xc5, 0xaa, 0x85, 0x58, 0xaa, 0x5c, 0x00, 0x00, 0x61, 0xa5, 0x85, 0x58, 0x5a, 0xb6, 0x01,
+  0x00, 0x10, 0x55, 0x35, 0x53, 0x65, 0xbb, 0x01, 0x00, 0x50, 0x5a, 0x35, 0x53, 0x55, 0x11, 0x00,
+  0x00, 0x50, 0x5a, 0x15, 0x41, 0x11, 0x55, 0x00, 0x00, 0x55, 0x71, 0x47, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x77, 0x44, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x77, 0x47, 0x12, 0x00, 0x00, 0x10, 0x00, 0x71, 0x47, 0x22, 0x12, 0x00, 0x00,
+  0x00, 0x11, 0xbb, 0xbb, 0x47, 0x44, 0x01, 0x00, 0x00, 0x20, 0x22, 0x44, 0x24, 0x22, 0x02, 0x00,
+  0x00, 0x90, 0xb1, 0x1b, 0xcd, 0x1d, 0x11, 0x00, 0x00, 0xd0, 0xb1, 0xf9, 0xcd, 0x1c, 0x09, 0x01,
+  0x00, 0x00, 0xb1, 0xbb, 0x19, 0xdc, 0x0d, 0x00, 0x00, 0x00, 0x10, 0x66, 0x51, 0x9d, 0x0d, 0x00,
+  0x00, 0x00, 0x83, 0x28, 0xea, 0x95, 0x09, 0x00, 0x00, 0x00, 0x77, 0x52, 0xaa, 0x95, 0x00, 0x00,
+  0x00, 0x10, 0x83, 0x5a, 0xe5, 0x15, 0x00, 0x00, 0x00, 0x10, 0x86, 0xaa, 0x15, 0x6b, 0x01, 0x00,
+  0x00, 0x00, 0x33, 0xae, 0x65, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xe3, 0xae, 0x55, 0x11, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x33, 0x55, 0x55, 0x05, 0x00, 0x00, 0x71, 0x47, 0x01, 0x44, 0x51, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xba, 0xab, 0x37, 0x00, 0x00,
+  0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00, 0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0x77, 0xaa, 0xaa, 0x77, 0x03, 0x00, 0x00, 0x30, 0x77, 0x77, 0x77, 0x77, 0x03, 0x00,
+  0x00, 0x90, 0x7b, 0x77, 0x77, 0xb7, 0x06, 0x00, 0x00, 0x96, 0xb9, 0x9b, 0xb9, 0x99, 0x06, 0x00,
+  0x60, 0x96, 0x96, 0x9b, 0xbb, 0x96, 0x09, 0x00, 0x00, 0x90, 0x63, 0x69, 0x9b, 0x36, 0x09, 0x00,
+  0x00, 0x30, 0xa7, 0x66, 0x6a, 0x7a, 0x03, 0x00, 0x00, 0x30, 0x77, 0xaa, 0xaa, 0x77, 0x03, 0x00,
+  0x00, 0x73, 0x37, 0x77, 0x77, 0x73, 0x37, 0x00, 0x20, 0x48, 0x32, 0xa7, 0x7a, 0x27, 0x24, 0x00,
+  0x20, 0x88, 0x33, 0x77, 0x77, 0x37, 0x02, 0x00, 0x00, 0x22, 0x33, 0x77, 0x77, 0x37, 0x00, 0x00,
+  0x00, 0x30, 0x33, 0x73, 0x77, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x55, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x73, 0xba, 0xab, 0x37, 0x00, 0x00, 0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00, 0x00, 0x30, 0x77, 0xaa, 0xaa, 0x77, 0x03, 0x00,
+  0x00, 0x30, 0x77, 0x77, 0x77, 0x77, 0x03, 0x00, 0x00, 0x90, 0x7b, 0x77, 0x77, 0xb7, 0x06, 0x00,
+  0x00, 0x96, 0xb9, 0x9b, 0xb9, 0x99, 0x06, 0x00, 0x60, 0x96, 0x96, 0x9b, 0xbb, 0x96, 0x09, 0x00,
+  0x00, 0x90, 0x63, 0x69, 0x9b, 0x36, 0x09, 0x00, 0x00, 0x30, 0xa7, 0x66, 0x6a, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0x37, 0xaa, 0xaa, 0x73, 0x03, 0x00, 0x00, 0x73, 0x33, 0x77, 0x77, 0x33, 0x37, 0x00,
+  0x20, 0x48, 0x32, 0xa7, 0x7a, 0x23, 0x84, 0x02, 0x20, 0x44, 0x34, 0x77, 0x77, 0x43, 0x44, 0x02,
+  0x00, 0x22, 0x33, 0x77, 0x77, 0x33, 0x22, 0x00, 0x00, 0x30, 0x73, 0x77, 0x77, 0x37, 0x03, 0x00,
+  0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xba, 0xab, 0x37, 0x00, 0x00,
+  0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00, 0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0x77, 0xaa, 0xaa, 0x77, 0x03, 0x00, 0x00, 0x30, 0x77, 0x77, 0x77, 0x77, 0x03, 0x00,
+  0x00, 0x90, 0x7b, 0x77, 0x77, 0xb7, 0x06, 0x00, 0x00, 0x96, 0xb9, 0x9b, 0xb9, 0x99, 0x06, 0x00,
+  0x60, 0x96, 0x96, 0x9b, 0xbb, 0x96, 0x09, 0x00, 0x00, 0x90, 0x63, 0x69, 0x9b, 0x36, 0x09, 0x00,
+  0x00, 0x30, 0xa7, 0x66, 0x6a, 0x7a, 0x03, 0x00, 0x00, 0x30, 0x77, 0xaa, 0xaa, 0x77, 0x03, 0x00,
+  0x00, 0x73, 0x37, 0x77, 0x77, 0x73, 0x37, 0x00, 0x00, 0x42, 0x72, 0xa7, 0x7a, 0x23, 0x84, 0x02,
+  0x00, 0x20, 0x73, 0x77, 0x77, 0x33, 0x88, 0x02, 0x00, 0x00, 0x73, 0x77, 0x77, 0x33, 0x22, 0x00,
+  0x00, 0x30, 0x33, 0x77, 0x37, 0x33, 0x03, 0x00, 0x00, 0x00, 0x12, 0x55, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xa7, 0xbb, 0x7b, 0x00, 0x00,
+  0x00, 0x30, 0x77, 0x77, 0xa7, 0xbb, 0x07, 0x00, 0x00, 0x30, 0x77, 0xa7, 0xaa, 0xbb, 0x07, 0x00,
+  0x00, 0x30, 0xb7, 0xb9, 0xbb, 0xa9, 0x07, 0x00, 0x00, 0x30, 0x9b, 0xbb, 0x49, 0xb9, 0x09, 0x00,
+  0x00, 0x90, 0x4b, 0x2b, 0x82, 0xb2, 0x00, 0x00, 0x00, 0xb6, 0x89, 0xb9, 0x83, 0x92, 0x00, 0x00,
+  0x60, 0xb6, 0x26, 0x89, 0x88, 0x02, 0x00, 0x00, 0x00, 0x96, 0x36, 0x42, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0x73, 0xa7, 0xbb, 0x07, 0x00, 0x00, 0x00, 0x60, 0x73, 0x37, 0xbb, 0x07, 0x00, 0x00,
+  0x00, 0x20, 0x73, 0x33, 0xba, 0x22, 0x00, 0x00, 0x00, 0x42, 0x38, 0x73, 0xa7, 0x24, 0x00, 0x00,
+  0x00, 0x82, 0x48, 0x73, 0xa7, 0x07, 0x00, 0x00, 0x00, 0x20, 0x22, 0x73, 0xaa, 0x07, 0x00, 0x00,
+  0x00, 0x30, 0x33, 0x77, 0x37, 0x73, 0x00, 0x00, 0x00, 0x33, 0x12, 0x01, 0x12, 0x55, 0x02, 0x00,
+  0x00, 0x00, 0x73, 0xa7, 0xbb, 0x7b, 0x00, 0x00, 0x00, 0x30, 0x77, 0x77, 0xa7, 0xbb, 0x07, 0x00,
+  0x00, 0x30, 0x77, 0xa7, 0xaa, 0xbb, 0x07, 0x00, 0x00, 0x30, 0xb7, 0xb9, 0xbb, 0xa9, 0x07, 0x00,
+  0x00, 0x30, 0x9b, 0xbb, 0x49, 0xb9, 0x09, 0x00, 0x00, 0x90, 0x4b, 0x2b, 0x82, 0xb2, 0x00, 0x00,
+  0x00, 0xb6, 0x89, 0xb9, 0x83, 0x92, 0x00, 0x00, 0x60, 0xb6, 0x26, 0x89, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x96, 0x36, 0x42, 0x24, 0x00, 0x00, 0x00, 0x00, 0x60, 0x73, 0xa7, 0xbb, 0x07, 0x00, 0x00,
+  0x00, 0x60, 0x73, 0x37, 0xbb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x73, 0x33, 0xba, 0x07, 0x00, 0x00,
+  0x00, 0x20, 0x48, 0x32, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x20, 0x88, 0x74, 0xa7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x72, 0xaa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x33, 0x77, 0x33, 0x07, 0x00, 0x00,
+  0x00, 0x30, 0x33, 0x12, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xa7, 0xbb, 0x7b, 0x00, 0x00,
+  0x00, 0x30, 0x77, 0x77, 0xa7, 0xbb, 0x07, 0x00, 0x00, 0x30, 0x77, 0xa7, 0xaa, 0xbb, 0x07, 0x00,
+  0x00, 0x30, 0xb7, 0xb9, 0xbb, 0xa9, 0x07, 0x00, 0x00, 0x30, 0x9b, 0xbb, 0x49, 0xb9, 0x09, 0x00,
+  0x00, 0x90, 0x4b, 0x2b, 0x82, 0xb2, 0x00, 0x00, 0x00, 0xb6, 0x89, 0xb9, 0x83, 0x92, 0x00, 0x00,
+  0x60, 0xb6, 0x26, 0x89, 0x88, 0x02, 0x00, 0x00, 0x00, 0x96, 0x36, 0x42, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0x73, 0xa7, 0xbb, 0x07, 0x00, 0x00, 0x00, 0x60, 0x73, 0x37, 0xbb, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x73, 0x23, 0xb3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x73, 0x84, 0xa7, 0x00, 0x00, 0x00,
+  0x00, 0x30, 0x37, 0x88, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0xaa, 0x07, 0x00, 0x00,
+  0x00, 0x30, 0x33, 0x22, 0x33, 0x07, 0x00, 0x00, 0x00, 0x23, 0x11, 0x21, 0x51, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xbb, 0xbb, 0x3a, 0x00, 0x00,
+  0x00, 0x30, 0x77, 0xb7, 0x7b, 0x77, 0x03, 0x00, 0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0xba, 0xb9, 0xbb, 0xa9, 0x03, 0x00, 0x00, 0x30, 0x6b, 0x84, 0x49, 0xb9, 0x03, 0x00,
+  0x00, 0x90, 0x2b, 0x82, 0x28, 0xb2, 0x06, 0x00, 0x00, 0x96, 0xb9, 0x83, 0x38, 0x9b, 0x06, 0x00,
+  0x60, 0x96, 0x26, 0x84, 0x48, 0x92, 0x09, 0x00, 0x00, 0x90, 0xa3, 0x42, 0x24, 0x3a, 0x09, 0x00,
+  0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00, 0x00, 0x30, 0x37, 0xba, 0xab, 0x73, 0x03, 0x00,
+  0x00, 0x73, 0x37, 0xa7, 0x7a, 0x33, 0x37, 0x00, 0x20, 0x48, 0x32, 0x77, 0xa7, 0x27, 0x28, 0x00,
+  0x20, 0x88, 0x34, 0xa7, 0xab, 0x37, 0x02, 0x00, 0x00, 0x22, 0x33, 0xa7, 0xab, 0x37, 0x00, 0x00,
+  0x00, 0x30, 0x22, 0x22, 0x11, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x51, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0xa3, 0xbb, 0xbb, 0x3a, 0x00, 0x00, 0x00, 0x30, 0x77, 0xb7, 0x7b, 0x77, 0x03, 0x00,
+  0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00, 0x00, 0x30, 0xba, 0xb9, 0xbb, 0xa9, 0x03, 0x00,
+  0x00, 0x30, 0x6b, 0x84, 0x49, 0xb9, 0x03, 0x00, 0x00, 0x90, 0x2b, 0x82, 0x28, 0xb2, 0x06, 0x00,
+  0x00, 0x96, 0xb9, 0x83, 0x38, 0x9b, 0x06, 0x00, 0x60, 0x96, 0x26, 0x84, 0x48, 0x92, 0x09, 0x00,
+  0x00, 0x90, 0xa3, 0x42, 0x24, 0x3a, 0x09, 0x00, 0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0x37, 0xba, 0xab, 0x73, 0x03, 0x00, 0x00, 0x73, 0x37, 0xa7, 0x7a, 0x73, 0x37, 0x00,
+  0x20, 0x48, 0x73, 0x7a, 0xa7, 0x37, 0x84, 0x02, 0x20, 0x88, 0x74, 0xba, 0xab, 0x47, 0x88, 0x02,
+  0x00, 0x22, 0x77, 0xba, 0xab, 0x77, 0x22, 0x00, 0x00, 0x30, 0x37, 0x7a, 0xa7, 0x73, 0x03, 0x00,
+  0x00, 0x33, 0x52, 0x21, 0x12, 0x25, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xbb, 0xbb, 0x3a, 0x00, 0x00,
+  0x00, 0x30, 0x77, 0xb7, 0x7b, 0x77, 0x03, 0x00, 0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00,
+  0x00, 0x30, 0xba, 0xb9, 0xbb, 0xa9, 0x03, 0x00, 0x00, 0x30, 0x6b, 0x84, 0x49, 0xb9, 0x03, 0x00,
+  0x00, 0x90, 0x2b, 0x82, 0x28, 0xb2, 0x06, 0x00, 0x00, 0x96, 0xb9, 0x83, 0x38, 0x9b, 0x06, 0x00,
+  0x60, 0x96, 0x26, 0x84, 0x48, 0x92, 0x09, 0x00, 0x00, 0x90, 0xa3, 0x42, 0x24, 0x3a, 0x09, 0x00,
+  0x00, 0x30, 0xa7, 0xba, 0xab, 0x7a, 0x03, 0x00, 0x00, 0x30, 0x37, 0xba, 0xab, 0x73, 0x03, 0x00,
+  0x00, 0x73, 0x33, 0xa7, 0x7a, 0x73, 0x37, 0x00, 0x00, 0x82, 0x72, 0x7a, 0x77, 0x23, 0x84, 0x02,
+  0x00, 0x20, 0x73, 0xba, 0x7a, 0x43, 0x88, 0x02, 0x00, 0x00, 0x73, 0xba, 0x7a, 0x33, 0x22, 0x00,
+  0x00, 0x30, 0x33, 0x11, 0x22, 0x22, 0x03, 0x00, 0x00, 0x00, 0x52, 0x15, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x64, 0x46, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x63, 0x66, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x64, 0x66, 0x66, 0x46, 0x00, 0x00,
+  0x00, 0x30, 0x64, 0x66, 0x66, 0x46, 0x03, 0x00, 0x00, 0x30, 0x44, 0x66, 0x66, 0x44, 0x03, 0x00,
+  0x00, 0x30, 0x44, 0x44, 0x44, 0x44, 0x03, 0x00, 0x00, 0x00, 0x43, 0x44, 0x44, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x66, 0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x6a, 0xa6, 0x3a, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x6a, 0xa6, 0x44, 0x03, 0x00, 0x00, 0x30, 0x34, 0x66, 0x66, 0x43, 0x03, 0x00,
+  0x00, 0x52, 0x33, 0x64, 0x46, 0x33, 0x25, 0x00, 0x20, 0x57, 0x92, 0x33, 0x33, 0x29, 0x25, 0x00,
+  0x20, 0x55, 0x35, 0x34, 0x43, 0x03, 0x02, 0x00, 0x00, 0x22, 0x32, 0x44, 0x44, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x31, 0x34, 0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x64, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x64, 0x46, 0x03, 0x00, 0x00, 0x00, 0x00, 0x63, 0x66, 0x66, 0x36, 0x00, 0x00,
+  0x00, 0x00, 0x64, 0x66, 0x66, 0x46, 0x00, 0x00, 0x00, 0x30, 0x64, 0x66, 0x66, 0x46, 0x03, 0x00,
+  0x00, 0x30, 0x44, 0x66, 0x66, 0x44, 0x03, 0x00, 0x00, 0x30, 0x44, 0x44, 0x44, 0x44, 0x03, 0x00,
+  0x00, 0x00, 0x43, 0x44, 0x44, 0x34, 0x00, 0x00, 0x00, 0x00, 0x30, 0x66, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0xa3, 0x6a, 0xa6, 0x3a, 0x00, 0x00, 0x00, 0x30, 0x44, 0x6a, 0xa6, 0x44, 0x03, 0x00,
+  0x00, 0x30, 0x34, 0x66, 0x66, 0x43, 0x03, 0x00, 0x00, 0x52, 0x33, 0x64, 0x46, 0x33, 0x25, 0x00,
+  0x20, 0x57, 0x92, 0x33, 0x33, 0x29, 0x75, 0x02, 0x20, 0x55, 0x35, 0x46, 0x64, 0x53, 0x55, 0x02,
+  0x00, 0x22, 0x30, 0x66, 0x66, 0x03, 0x22, 0x00, 0x00, 0x00, 0x30, 0x46, 0x64, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x31, 0x16, 0x61, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x44, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x44, 0x64, 0x36, 0x00, 0x00, 0x00, 0x00, 0x44, 0x66, 0x66, 0x36, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x64, 0x6a, 0x46, 0x00, 0x00, 0x00, 0x30, 0x44, 0x44, 0xaa, 0x4a, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x24, 0x72, 0x44, 0x00, 0x00, 0x00, 0x00, 0x43, 0xa4, 0x73, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x44, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x43, 0x34, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x6a, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x63, 0x34, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x20, 0xa3, 0x33, 0x64, 0x23, 0x00, 0x00, 0x00, 0x52, 0x37, 0x43, 0x34, 0x25, 0x00, 0x00,
+  0x00, 0x72, 0x57, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x64, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x31, 0x34, 0x43, 0x34, 0x00, 0x00, 0x00, 0x00, 0x41, 0x04, 0x41, 0x66, 0x01, 0x00,
+  0x00, 0x00, 0x30, 0x44, 0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0x43, 0x44, 0x64, 0x36, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x66, 0x66, 0x36, 0x00, 0x00, 0x00, 0x30, 0x44, 0x64, 0x6a, 0x46, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x44, 0xaa, 0x4a, 0x00, 0x00, 0x00, 0x30, 0x44, 0x24, 0x72, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0xa4, 0x73, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x44, 0x44, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x43, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6a, 0xaa, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x63, 0x34, 0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x33, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x20, 0x57, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x20, 0x77, 0x35, 0x33, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x43, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x31, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x44, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x44, 0x64, 0x36, 0x00, 0x00, 0x00, 0x00, 0x44, 0x66, 0x66, 0x36, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x64, 0x6a, 0x46, 0x00, 0x00, 0x00, 0x30, 0x44, 0x44, 0xaa, 0x4a, 0x00, 0x00,
+  0x00, 0x30, 0x44, 0x24, 0x72, 0x44, 0x00, 0x00, 0x00, 0x00, 0x43, 0xa4, 0x73, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x44, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x34, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x3a, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x43, 0x34, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x63, 0x32, 0x63, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x75, 0x33, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x23, 0x77, 0x62, 0x03, 0x00, 0x00, 0x00, 0x00, 0x43, 0x22, 0x64, 0x03, 0x00, 0x00,
+  0x00, 0x10, 0x44, 0x11, 0x44, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0x14, 0x64, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x64, 0x46, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x63, 0x66, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x64, 0x66, 0x66, 0x46, 0x00, 0x00,
+  0x00, 0x30, 0x46, 0x4a, 0xa4, 0x64, 0x03, 0x00, 0x00, 0x30, 0x44, 0xaa, 0xaa, 0x44, 0x03, 0x00,
+  0x00, 0x30, 0x24, 0x52, 0x25, 0x42, 0x03, 0x00, 0x00, 0x00, 0xa3, 0x73, 0x37, 0x3a, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x66, 0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x63, 0x36, 0x3a, 0x00, 0x00,
+  0x00, 0x30, 0x64, 0xa6, 0x6a, 0x46, 0x03, 0x00, 0x00, 0x30, 0x34, 0x66, 0x66, 0x43, 0x03, 0x00,
+  0x00, 0xa3, 0x33, 0x64, 0x46, 0x33, 0x2a, 0x00, 0x20, 0x57, 0x92, 0x33, 0x33, 0x29, 0x27, 0x00,
+  0x20, 0x77, 0x35, 0x44, 0x64, 0x03, 0x02, 0x00, 0x00, 0x22, 0x39, 0x44, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x13, 0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x64, 0x46, 0x03, 0x00, 0x00, 0x00, 0x00, 0x63, 0x66, 0x66, 0x36, 0x00, 0x00,
+  0x00, 0x00, 0x64, 0x66, 0x66, 0x46, 0x00, 0x00, 0x00, 0x30, 0x46, 0x4a, 0xa4, 0x64, 0x03, 0x00,
+  0x00, 0x30, 0x44, 0xaa, 0xaa, 0x44, 0x03, 0x00, 0x00, 0x30, 0x24, 0x52, 0x25, 0x42, 0x03, 0x00,
+  0x00, 0x00, 0xa3, 0x73, 0x37, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x30, 0x66, 0x66, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0xa3, 0x63, 0x36, 0x3a, 0x00, 0x00, 0x00, 0x30, 0x64, 0xa6, 0x6a, 0x46, 0x03, 0x00,
+  0x00, 0x30, 0x34, 0x66, 0x66, 0x43, 0x03, 0x00, 0x00, 0xa2, 0x33, 0x64, 0x46, 0x33, 0x3a, 0x00,
+  0x20, 0x57, 0x92, 0x33, 0x33, 0x29, 0x75, 0x02, 0x20, 0x77, 0x35, 0x44, 0x44, 0x53, 0x77, 0x02,
+  0x00, 0x22, 0x30, 0x46, 0x64, 0x03, 0x22, 0x00, 0x00, 0x00, 0x10, 0x36, 0x63, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x61, 0x13, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x64, 0x46, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x63, 0x66, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x64, 0x66, 0x66, 0x46, 0x00, 0x00,
+  0x00, 0x30, 0x46, 0x4a, 0xa4, 0x64, 0x03, 0x00, 0x00, 0x30, 0x44, 0xaa, 0xaa, 0x44, 0x03, 0x00,
+  0x00, 0x30, 0x24, 0x52, 0x25, 0x42, 0x03, 0x00, 0x00, 0x00, 0xa3, 0x73, 0x37, 0x3a, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x66, 0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x63, 0x36, 0x3a, 0x00, 0x00,
+  0x00, 0x30, 0x64, 0xa6, 0x6a, 0x46, 0x03, 0x00, 0x00, 0x30, 0x34, 0x66, 0x66, 0x43, 0x03, 0x00,
+  0x00, 0xa2, 0x33, 0x64, 0x46, 0x33, 0x3a, 0x00, 0x00, 0x72, 0x92, 0x33, 0x33, 0x29, 0x75, 0x02,
+  0x00, 0x20, 0x30, 0x46, 0x44, 0x53, 0x77, 0x02, 0x00, 0x00, 0x30, 0x66, 0x44, 0x83, 0x22, 0x00,
+  0x00, 0x00, 0x10, 0x33, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x61, 0x36, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x88, 0x88, 0x24, 0x61, 0x01, 0x00, 0x00, 0x22, 0x22, 0x82, 0x28, 0x16, 0x00,
+  0x00, 0x20, 0x44, 0x44, 0x88, 0x48, 0x02, 0x00, 0x00, 0x20, 0x44, 0x88, 0x88, 0x48, 0x02, 0x00,
+  0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0x00, 0x00, 0x42, 0x44, 0x44, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x44, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x32, 0x66, 0x66, 0x23, 0x00, 0x00,
+  0x00, 0x20, 0x34, 0x66, 0x66, 0x43, 0x02, 0x00, 0x00, 0x20, 0x14, 0x63, 0x36, 0x41, 0x02, 0x00,
+  0x00, 0x71, 0x12, 0x33, 0x33, 0x21, 0x17, 0x00, 0x10, 0x7a, 0x01, 0x42, 0x24, 0x10, 0x17, 0x00,
+  0x10, 0x77, 0x17, 0x33, 0x33, 0x01, 0x01, 0x00, 0x00, 0x11, 0x11, 0x33, 0x63, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x15, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x99, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x84, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x42, 0x88, 0x88, 0x24, 0x61, 0x01,
+  0x00, 0x00, 0x22, 0x22, 0x82, 0x28, 0x16, 0x00, 0x00, 0x20, 0x44, 0x44, 0x88, 0x48, 0x02, 0x00,
+  0x00, 0x20, 0x44, 0x88, 0x88, 0x48, 0x02, 0x00, 0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00,
+  0x00, 0x00, 0x42, 0x44, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x44, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x32, 0x66, 0x66, 0x23, 0x00, 0x00, 0x00, 0x20, 0x34, 0x66, 0x66, 0x43, 0x02, 0x00,
+  0x00, 0x20, 0x14, 0x63, 0x36, 0x41, 0x02, 0x00, 0x00, 0x71, 0x12, 0x33, 0x33, 0x21, 0x17, 0x00,
+  0x10, 0x7a, 0x01, 0x42, 0x24, 0x10, 0xa7, 0x01, 0x10, 0x77, 0x17, 0x33, 0x33, 0x71, 0x77, 0x01,
+  0x00, 0x11, 0x10, 0x33, 0x33, 0x01, 0x11, 0x00, 0x00, 0x00, 0x10, 0x36, 0x63, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x51, 0x19, 0x91, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x88, 0x88, 0x24, 0x61, 0x01, 0x00, 0x00, 0x22, 0x22, 0x82, 0x28, 0x16, 0x00,
+  0x00, 0x20, 0x44, 0x44, 0x88, 0x48, 0x02, 0x00, 0x00, 0x20, 0x44, 0x88, 0x88, 0x48, 0x02, 0x00,
+  0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0x00, 0x00, 0x42, 0x44, 0x44, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x44, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x32, 0x66, 0x66, 0x23, 0x00, 0x00,
+  0x00, 0x20, 0x34, 0x66, 0x66, 0x43, 0x02, 0x00, 0x00, 0x20, 0x14, 0x63, 0x36, 0x41, 0x02, 0x00,
+  0x00, 0x71, 0x12, 0x33, 0x33, 0x21, 0x17, 0x00, 0x00, 0x71, 0x01, 0x42, 0x24, 0x10, 0xa7, 0x01,
+  0x00, 0x10, 0x10, 0x33, 0x33, 0x71, 0x77, 0x01, 0x00, 0x00, 0x10, 0x36, 0x33, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x10, 0x96, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 0x51, 0x99, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x88, 0x02, 0x00, 0x00,
+  0x10, 0x16, 0x42, 0x84, 0x88, 0x24, 0x00, 0x00, 0x00, 0x61, 0x22, 0x22, 0x82, 0x28, 0x00, 0x00,
+  0x00, 0x10, 0x44, 0x44, 0x88, 0x48, 0x00, 0x00, 0x00, 0x20, 0x34, 0x33, 0x63, 0x46, 0x00, 0x00,
+  0x00, 0x20, 0x33, 0x16, 0xa1, 0x81, 0x00, 0x00, 0x00, 0x20, 0x63, 0xc6, 0xa2, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0xa6, 0xaa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x71, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x63, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x42, 0x63, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x10, 0x81, 0x62, 0x84, 0x12, 0x00, 0x00, 0x00, 0x71, 0x1a, 0x22, 0x42, 0x17, 0x00, 0x00,
+  0x00, 0xa1, 0x7a, 0x31, 0x33, 0x01, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x63, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x15, 0x51, 0x15, 0x00, 0x00, 0x00, 0x00, 0x51, 0x05, 0x51, 0x99, 0x01, 0x00,
+  0x00, 0x00, 0x20, 0x44, 0x88, 0x02, 0x00, 0x00, 0x10, 0x16, 0x42, 0x84, 0x88, 0x24, 0x00, 0x00,
+  0x00, 0x61, 0x22, 0x22, 0x82, 0x28, 0x00, 0x00, 0x00, 0x10, 0x44, 0x44, 0x88, 0x48, 0x00, 0x00,
+  0x00, 0x20, 0x34, 0x33, 0x63, 0x46, 0x00, 0x00, 0x00, 0x20, 0x33, 0x16, 0xa1, 0x81, 0x00, 0x00,
+  0x00, 0x20, 0x63, 0xc6, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa6, 0xaa, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x71, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x63, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x63, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x82, 0x62, 0x84, 0x02, 0x00, 0x00,
+  0x00, 0x10, 0x7a, 0x21, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0xaa, 0x37, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x51, 0x99, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x88, 0x02, 0x00, 0x00,
+  0x10, 0x16, 0x42, 0x84, 0x88, 0x24, 0x00, 0x00, 0x00, 0x61, 0x22, 0x22, 0x82, 0x28, 0x00, 0x00,
+  0x00, 0x10, 0x44, 0x44, 0x88, 0x48, 0x00, 0x00, 0x00, 0x20, 0x34, 0x33, 0x63, 0x46, 0x00, 0x00,
+  0x00, 0x20, 0x33, 0x16, 0xa1, 0x81, 0x00, 0x00, 0x00, 0x20, 0x63, 0xc6, 0xa2, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0xa6, 0xaa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x71, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x63, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x42, 0x63, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x82, 0x11, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x72, 0xa7, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0xaa, 0x63, 0x01, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x63, 0x01, 0x00, 0x00,
+  0x00, 0x10, 0x55, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10, 0x55, 0x15, 0x95, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x84, 0x88, 0x24, 0x61, 0x01, 0x00, 0x00, 0x22, 0x22, 0x82, 0x28, 0x16, 0x00,
+  0x00, 0x20, 0x44, 0x44, 0x88, 0x48, 0x01, 0x00, 0x00, 0x20, 0x34, 0x36, 0x63, 0x86, 0x02, 0x00,
+  0x00, 0x20, 0x14, 0x71, 0x13, 0x81, 0x02, 0x00, 0x00, 0x00, 0xc1, 0xa2, 0x2a, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0xa7, 0x7a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0x71, 0x17, 0x23, 0x00, 0x00,
+  0x00, 0x20, 0x38, 0x46, 0x64, 0x83, 0x02, 0x00, 0x00, 0x20, 0x24, 0x86, 0x68, 0x42, 0x02, 0x00,
+  0x00, 0x71, 0x22, 0x83, 0x38, 0x22, 0x17, 0x00, 0x10, 0x7a, 0xb1, 0x42, 0x24, 0x1b, 0x1a, 0x00,
+  0x10, 0xaa, 0x17, 0x33, 0x63, 0x01, 0x01, 0x00, 0x00, 0x11, 0x1b, 0x33, 0x66, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x15, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x44, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x42, 0x84, 0x88, 0x24, 0x61, 0x01,
+  0x00, 0x00, 0x22, 0x22, 0x82, 0x28, 0x16, 0x00, 0x00, 0x20, 0x44, 0x44, 0x88, 0x48, 0x01, 0x00,
+  0x00, 0x20, 0x34, 0x36, 0x63, 0x86, 0x02, 0x00, 0x00, 0x20, 0x14, 0x71, 0x13, 0x81, 0x02, 0x00,
+  0x00, 0x00, 0xc1, 0xa2, 0x2a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa7, 0x7a, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x32, 0x71, 0x17, 0x23, 0x00, 0x00, 0x00, 0x20, 0x38, 0x46, 0x64, 0x83, 0x02, 0x00,
+  0x00, 0x20, 0x24, 0x86, 0x68, 0x42, 0x02, 0x00, 0x00, 0x71, 0x22, 0x83, 0x38, 0x22, 0x17, 0x00,
+  0x10, 0x7a, 0xb1, 0x42, 0x24, 0x1b, 0xa7, 0x01, 0x10, 0xaa, 0x17, 0x63, 0x36, 0x71, 0xaa, 0x01,
+  0x00, 0x11, 0x10, 0x66, 0x66, 0x01, 0x11, 0x00, 0x00, 0x00, 0x10, 0x36, 0x63, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x91, 0x15, 0x51, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x88, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x84, 0x88, 0x24, 0x61, 0x01, 0x00, 0x00, 0x22, 0x22, 0x82, 0x28, 0x16, 0x00,
+  0x00, 0x20, 0x44, 0x44, 0x88, 0x48, 0x01, 0x00, 0x00, 0x20, 0x34, 0x36, 0x63, 0x86, 0x02, 0x00,
+  0x00, 0x20, 0x14, 0x71, 0x13, 0x81, 0x02, 0x00, 0x00, 0x00, 0xc1, 0xa2, 0x2a, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0xa7, 0x7a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0x71, 0x17, 0x23, 0x00, 0x00,
+  0x00, 0x20, 0x38, 0x46, 0x64, 0x83, 0x02, 0x00, 0x00, 0x20, 0x24, 0x86, 0x68, 0x42, 0x02, 0x00,
+  0x00, 0x71, 0x22, 0x83, 0x38, 0x22, 0x17, 0x00, 0x00, 0xa1, 0xb1, 0x42, 0x24, 0x1b, 0xa7, 0x01,
+  0x00, 0x10, 0x10, 0x36, 0x33, 0x71, 0xaa, 0x01, 0x00, 0x00, 0x10, 0x66, 0x33, 0xb1, 0x11, 0x00,
+  0x00, 0x00, 0x10, 0x55, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 0x91, 0x59, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa6, 0x6a, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xaa, 0xaa, 0x26, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xaa, 0xaa, 0xb6, 0x00, 0x00,
+  0x00, 0x50, 0xbb, 0xa6, 0x6a, 0xbb, 0x05, 0x00, 0x00, 0xb0, 0x52, 0x6b, 0xb6, 0x25, 0x0b, 0x00,
+  0x00, 0x00, 0x2b, 0xb5, 0x5b, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x5d, 0xd5, 0x2c, 0x00, 0x00,
+  0x00, 0x20, 0xc6, 0xdd, 0xdd, 0x6c, 0x02, 0x00, 0x00, 0x20, 0x56, 0xdc, 0xcd, 0x65, 0x02, 0x00,
+  0x00, 0x62, 0x52, 0xc9, 0x9c, 0x25, 0x26, 0x00, 0x20, 0x6a, 0x02, 0x95, 0x59, 0x20, 0x26, 0x00,
+  0x20, 0x66, 0x16, 0x33, 0x33, 0x01, 0x02, 0x00, 0x00, 0x22, 0x12, 0x33, 0x83, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x24, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x77, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0xa6, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x62, 0xaa, 0xaa, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x6b, 0xaa, 0xaa, 0xb6, 0x00, 0x00, 0x00, 0x50, 0xbb, 0xa6, 0x6a, 0xbb, 0x05, 0x00,
+  0x00, 0xb0, 0x52, 0x6b, 0xb6, 0x25, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0xb5, 0x5b, 0xb2, 0x00, 0x00,
+  0x00, 0x00, 0xc2, 0x5d, 0xd5, 0x2c, 0x00, 0x00, 0x00, 0x20, 0xc6, 0xdd, 0xdd, 0x6c, 0x02, 0x00,
+  0x00, 0x20, 0x56, 0xdc, 0xcd, 0x65, 0x02, 0x00, 0x00, 0x62, 0x52, 0xc9, 0x9c, 0x25, 0x26, 0x00,
+  0x20, 0x6a, 0x02, 0x95, 0x59, 0x20, 0xa6, 0x02, 0x20, 0x66, 0x16, 0x33, 0x33, 0x61, 0x66, 0x02,
+  0x00, 0x22, 0x10, 0x33, 0x33, 0x01, 0x22, 0x00, 0x00, 0x00, 0x10, 0x18, 0x81, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x27, 0x72, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xaa, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0xb6, 0xa6, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x55, 0xab, 0xaa, 0x02, 0x00, 0x00,
+  0x00, 0x25, 0xa5, 0x2b, 0xa2, 0x02, 0x00, 0x00, 0x00, 0x5b, 0xab, 0xda, 0xa5, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x25, 0xa6, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x62, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xca, 0xdd, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x9a, 0xdd, 0x09, 0x00, 0x00,
+  0x00, 0x20, 0x62, 0x95, 0xdc, 0x29, 0x00, 0x00, 0x00, 0x62, 0x2a, 0x55, 0x99, 0x26, 0x00, 0x00,
+  0x00, 0xa2, 0x6a, 0x31, 0x55, 0x01, 0x00, 0x00, 0x00, 0x20, 0x22, 0x11, 0x83, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x14, 0x42, 0x24, 0x00, 0x00, 0x00, 0x00, 0x42, 0x04, 0x42, 0x77, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb6, 0xa6, 0xaa, 0x02, 0x00, 0x00,
+  0x00, 0xb0, 0x55, 0xab, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x25, 0xa5, 0x2b, 0xa2, 0x02, 0x00, 0x00,
+  0x00, 0x5b, 0xab, 0xda, 0xa5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x25, 0xa6, 0xaa, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x62, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xca, 0xdd, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0xa2, 0x5a, 0xdd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x62, 0x52, 0xdc, 0x09, 0x00, 0x00,
+  0x00, 0x20, 0x6a, 0x32, 0x29, 0x00, 0x00, 0x00, 0x00, 0x20, 0xaa, 0x36, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x32, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x42, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xaa, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0xb6, 0xa6, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x55, 0xab, 0xaa, 0x02, 0x00, 0x00,
+  0x00, 0x25, 0xa5, 0x2b, 0xa2, 0x02, 0x00, 0x00, 0x00, 0x5b, 0xab, 0xda, 0xa5, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x25, 0xa6, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xca, 0xdd, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x5a, 0xdd, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0x22, 0xd5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x62, 0xa6, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0xaa, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x83, 0x01, 0x00, 0x00,
+  0x00, 0x20, 0x44, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x24, 0x74, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa6, 0x6a, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xaa, 0xaa, 0x26, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xaa, 0xaa, 0xb6, 0x00, 0x00,
+  0x00, 0x50, 0x2b, 0xa2, 0x2a, 0xb2, 0x05, 0x00, 0x00, 0xb0, 0xd2, 0xa5, 0x5a, 0x2d, 0x0b, 0x00,
+  0x00, 0x00, 0x25, 0xa6, 0x6a, 0x52, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x62, 0x26, 0x2c, 0x00, 0x00,
+  0x00, 0x20, 0xc6, 0xdd, 0xdd, 0x6c, 0x02, 0x00, 0x00, 0x20, 0x56, 0xdd, 0xdd, 0x65, 0x02, 0x00,
+  0x00, 0x62, 0x52, 0xc9, 0x9c, 0x25, 0x26, 0x00, 0x20, 0x6a, 0x02, 0x95, 0x59, 0x20, 0x2a, 0x00,
+  0x20, 0xaa, 0x16, 0x33, 0x83, 0x01, 0x02, 0x00, 0x00, 0x22, 0x10, 0x33, 0x88, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x24, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x74, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0xa6, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x62, 0xaa, 0xaa, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x6b, 0xaa, 0xaa, 0xb6, 0x00, 0x00, 0x00, 0x50, 0x2b, 0xa2, 0x2a, 0xb2, 0x05, 0x00,
+  0x00, 0xb0, 0xd2, 0xa5, 0x5a, 0x2d, 0x0b, 0x00, 0x00, 0x00, 0x25, 0xa6, 0x6a, 0x52, 0x00, 0x00,
+  0x00, 0x00, 0xc2, 0x62, 0x26, 0x2c, 0x00, 0x00, 0x00, 0x20, 0xc6, 0xdd, 0xdd, 0x6c, 0x02, 0x00,
+  0x00, 0x20, 0x56, 0xdd, 0xdd, 0x65, 0x02, 0x00, 0x00, 0x62, 0x52, 0xc9, 0x9c, 0x25, 0x26, 0x00,
+  0x20, 0x6a, 0x02, 0x95, 0x59, 0x20, 0xa6, 0x02, 0x20, 0xaa, 0x16, 0x83, 0x38, 0x61, 0xaa, 0x02,
+  0x00, 0x22, 0x10, 0x88, 0x88, 0x01, 0x22, 0x00, 0x00, 0x00, 0x10, 0x38, 0x83, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x72, 0x24, 0x42, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,969 @@
+// Art by Charles Gabriel, commissioned by OpenGameArt
+// (https://opengameart.org/content/twelve-16x18-rpg-sprites-plus-base).
+// Licensed under CC BY 3.0 (https://creativecommons.org/licenses/by/3.0/)
+//
+
+int sprite_8bpp_count = 52;
+int sprite_8bpp_height = 18;
+int sprite_8bpp_num_colours = 47;
+
+const uint16_t sprite_8bpp_palette[] = {
+  0x7c1f, 0x0574, 0x12dc, 0x3fdf, 0x1ce7, 0x56b5, 0x7bde, 0x0ca9,
+  0x325b, 0x535e, 0x46b6, 0x35f0, 0x5b5c, 0x7fff, 0x2297, 0x3b5d,
+  0x1573, 0x4511, 0x6a17, 0x631f, 0x30e6, 0x722c, 0x4d47, 0x4210,
+  0x2108, 0x6fdb, 0x7a5a, 0x49cc, 0x7759, 0x6739, 0x3639, 0x0931,
+  0x318c, 0x7f4f, 0x0822, 0x0d40, 0x19e0, 0x3b2b, 0x233d, 0x0dd4,
+  0x56d6, 0x2d4a, 0x735a, 0x49ef, 0x044c, 0x0cb1, 0x3e19,
+};
+
+int sprite_8bpp_num_frames = 72;
+const uint16_t sprite_8bpp_frames[] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x4005, 0x4004, 0x4003, 0x0009, 0x000a, 0x000b, 0x000c,
+  0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x400e, 0x400d, 0x0012,
+  0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a,
+  0x001b, 0x4018, 0x4017, 0x4016, 0x001c, 0x001d, 0x401c, 0x001e,
+  0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x4020, 0x401f, 0x401e,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+  0x002c, 0x4029, 0x4028, 0x4027, 0x002d, 0x002e, 0x402d, 0x002f,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x4032, 0x4031, 0x4030, 0x402f,
+};
+
+const uint8_t __attribute__ ((aligned (4))) sprite_8bpp_data[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x05, 0x01, 0x05, 0x01, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x05, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x04, 0x0b, 0x0a, 0x0a, 0x0a, 0x0c, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x05, 0x01, 0x05, 0x01, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x04, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x04, 0x04, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x04, 0x0b, 0x0a, 0x0c, 0x0c, 0x0a, 0x0b, 0x04, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x05, 0x01, 0x05, 0x01, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x05, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x04, 0x05, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x0c, 0x0a, 0x0a, 0x0a, 0x0b, 0x04, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x08, 0x07, 0x07, 0x09, 0x07, 0x03, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x09, 0x0d, 0x04, 0x09, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x07, 0x04, 0x04, 0x05, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x07, 0x05, 0x05, 0x05, 0x04, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x09, 0x05, 0x05, 0x04, 0x04, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x05, 0x04, 0x0b, 0x0c, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x08, 0x07, 0x07, 0x09, 0x07, 0x03, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x09, 0x0d, 0x04, 0x09, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x08, 0x07, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x05, 0x04, 0x04, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x04, 0x0b, 0x0c, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x08, 0x07, 0x07, 0x09, 0x07, 0x03, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x09, 0x0d, 0x04, 0x09, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x09, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x09, 0x09, 0x04, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07, 0x07, 0x0c, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x04, 0x09, 0x09, 0x04, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x07, 0x08, 0x08, 0x07, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x07, 0x09, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x05, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x04, 0x0b, 0x0a, 0x0a, 0x0a, 0x0c, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x04, 0x09, 0x09, 0x04, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x07, 0x08, 0x08, 0x07, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x05, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x04, 0x05, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x04, 0x0b, 0x0c, 0x0a, 0x0a, 0x0c, 0x0b, 0x04, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x04, 0x09, 0x09, 0x04, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x07, 0x08, 0x08, 0x07, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x07, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x05, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x04, 0x05, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x0c, 0x0a, 0x0a, 0x0a, 0x0b, 0x04, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x10, 0x0e, 0x0e, 0x0e, 0x0e, 0x10, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x07, 0x10, 0x10, 0x10, 0x10, 0x07, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x07, 0x12, 0x13, 0x12, 0x13, 0x07, 0x12, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x12, 0x13, 0x12, 0x13, 0x13, 0x12, 0x13, 0x12, 0x13, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x14, 0x12, 0x11, 0x13, 0x12, 0x11, 0x13, 0x12, 0x12, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x15, 0x14, 0x14, 0x11, 0x15, 0x15, 0x16, 0x11, 0x14, 0x15, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x14, 0x16, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x14, 0x16, 0x16, 0x16, 0x15, 0x16, 0x14, 0x14, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x14, 0x16, 0x14, 0x16, 0x16, 0x16, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x10, 0x0e, 0x0e, 0x0e, 0x0e, 0x10, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x07, 0x10, 0x10, 0x10, 0x10, 0x07, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x07, 0x12, 0x13, 0x12, 0x13, 0x07, 0x12, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x12, 0x13, 0x12, 0x13, 0x13, 0x12, 0x13, 0x12, 0x13, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x14, 0x12, 0x11, 0x13, 0x12, 0x11, 0x13, 0x12, 0x12, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x15, 0x14, 0x14, 0x11, 0x15, 0x15, 0x16, 0x11, 0x14, 0x15, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x14, 0x16, 0x15, 0x15, 0x15, 0x15, 0x16, 0x14, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x14, 0x16, 0x16, 0x16, 0x15, 0x16, 0x16, 0x14, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x14, 0x16, 0x14, 0x16, 0x16, 0x16, 0x16, 0x14, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x10, 0x0e, 0x0e, 0x0e, 0x0e, 0x10, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x07, 0x10, 0x10, 0x10, 0x10, 0x07, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x07, 0x12, 0x13, 0x12, 0x13, 0x07, 0x12, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x12, 0x13, 0x12, 0x13, 0x13, 0x12, 0x13, 0x12, 0x13, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x14, 0x12, 0x11, 0x13, 0x12, 0x11, 0x13, 0x12, 0x12, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x15, 0x14, 0x11, 0x16, 0x15, 0x15, 0x11, 0x14, 0x14, 0x15, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x16, 0x14, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x14, 0x14, 0x16, 0x15, 0x16, 0x16, 0x16, 0x14, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x16, 0x16, 0x16, 0x14, 0x16, 0x14, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x10, 0x10, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0e, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x12, 0x13, 0x12, 0x07, 0x09, 0x09, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x13, 0x13, 0x12, 0x0d, 0x11, 0x09, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x12, 0x13, 0x07, 0x11, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x11, 0x12, 0x14, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x15, 0x16, 0x10, 0x17, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0x16, 0x16, 0x14, 0x10, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x14, 0x15, 0x14, 0x14, 0x16, 0x17, 0x18, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x07, 0x14, 0x16, 0x16, 0x17, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x14, 0x16, 0x15, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x14, 0x14, 0x16, 0x15, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x18, 0x18, 0x0e, 0x0e, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x14, 0x07, 0x0e, 0x0e, 0x19, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x10, 0x10, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0e, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x12, 0x13, 0x12, 0x07, 0x09, 0x09, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x13, 0x13, 0x12, 0x0d, 0x11, 0x09, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x12, 0x13, 0x07, 0x11, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x11, 0x12, 0x14, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x15, 0x16, 0x10, 0x17, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0x16, 0x16, 0x14, 0x10, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x14, 0x14, 0x16, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x08, 0x14, 0x16, 0x16, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x16, 0x15, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x14, 0x16, 0x15, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x07, 0x0e, 0x0e, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x10, 0x10, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0e, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x12, 0x13, 0x12, 0x07, 0x09, 0x09, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x13, 0x13, 0x12, 0x0d, 0x11, 0x09, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x12, 0x13, 0x07, 0x11, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x11, 0x12, 0x14, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x15, 0x16, 0x10, 0x17, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0x16, 0x16, 0x14, 0x10, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x07, 0x14, 0x14, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x08, 0x08, 0x09, 0x16, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x07, 0x09, 0x09, 0x14, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x07, 0x07, 0x16, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x16, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x14, 0x14, 0x07, 0x0e, 0x0e, 0x0e, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x10, 0x10, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x0e, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x0d, 0x11, 0x09, 0x09, 0x11, 0x0d, 0x07, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x1a, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x1a, 0x1a, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x1a, 0x14, 0x16, 0x07, 0x08, 0x08, 0x07, 0x16, 0x14, 0x1a, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x14, 0x15, 0x10, 0x14, 0x18, 0x18, 0x14, 0x10, 0x15, 0x14, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x15, 0x16, 0x10, 0x0f, 0x0f, 0x10, 0x16, 0x15, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x15, 0x16, 0x16, 0x14, 0x17, 0x17, 0x14, 0x16, 0x16, 0x15, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x14, 0x16, 0x14, 0x17, 0x17, 0x14, 0x16, 0x14, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x14, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x14, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x16, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x07, 0x07, 0x0e, 0x07, 0x07, 0x14, 0x14, 0x16, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x10, 0x10, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x0e, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x0d, 0x11, 0x09, 0x09, 0x11, 0x0d, 0x07, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x12, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x12, 0x14, 0x16, 0x07, 0x08, 0x08, 0x07, 0x16, 0x14, 0x13, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x14, 0x15, 0x10, 0x14, 0x18, 0x18, 0x14, 0x10, 0x15, 0x14, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x15, 0x16, 0x10, 0x0f, 0x0f, 0x10, 0x16, 0x15, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x15, 0x16, 0x16, 0x14, 0x17, 0x17, 0x14, 0x16, 0x16, 0x15, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x14, 0x16, 0x14, 0x17, 0x17, 0x14, 0x16, 0x14, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x16, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x16, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x16, 0x14, 0x14, 0x07, 0x07, 0x14, 0x14, 0x16, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x07, 0x0f, 0x0e, 0x07, 0x07, 0x0e, 0x0f, 0x07, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x10, 0x10, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x0e, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x07, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x11, 0x07, 0x0d, 0x11, 0x09, 0x09, 0x11, 0x0d, 0x07, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x1a, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x1a, 0x1a, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x1a, 0x14, 0x16, 0x07, 0x08, 0x08, 0x07, 0x16, 0x14, 0x1a, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x14, 0x15, 0x10, 0x14, 0x18, 0x18, 0x14, 0x10, 0x15, 0x14, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x15, 0x16, 0x10, 0x0f, 0x0f, 0x10, 0x16, 0x15, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x15, 0x16, 0x16, 0x14, 0x17, 0x17, 0x14, 0x16, 0x16, 0x15, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x14, 0x16, 0x14, 0x17, 0x17, 0x14, 0x16, 0x14, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x14, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x16, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x14, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x16, 0x14, 0x14, 0x07, 0x07, 0x0e, 0x07, 0x07, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x10, 0x10, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x0e, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x07, 0x09, 0x09, 0x07, 0x12, 0x13, 0x12, 0x07, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x07, 0x09, 0x11, 0x0d, 0x12, 0x13, 0x13, 0x07, 0x11, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x11, 0x07, 0x13, 0x12, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x07, 0x14, 0x12, 0x11, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x17, 0x17, 0x10, 0x16, 0x15, 0x14, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x10, 0x14, 0x16, 0x16, 0x14, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x18, 0x17, 0x16, 0x14, 0x14, 0x15, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x17, 0x16, 0x16, 0x14, 0x07, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x15, 0x16, 0x14, 0x08, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x15, 0x16, 0x14, 0x14, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x0e, 0x0e, 0x18, 0x18, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x0e, 0x0e, 0x07, 0x14, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x0d, 0x0d, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x1d, 0x0d, 0x0d, 0x1d, 0x1d, 0x0d, 0x1d, 0x1d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x1d, 0x17, 0x1d, 0x0d, 0x1d, 0x0d, 0x0d, 0x17, 0x1d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x14, 0x17, 0x1d, 0x17, 0x0d, 0x1d, 0x17, 0x14, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x17, 0x17, 0x1c, 0x17, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x1b, 0x1b, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x1b, 0x1b, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x14, 0x1b, 0x1c, 0x1c, 0x1b, 0x1b, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1e, 0x1e, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x0d, 0x0d, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x1d, 0x0d, 0x0d, 0x1d, 0x1d, 0x0d, 0x1d, 0x1d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x1d, 0x17, 0x1d, 0x0d, 0x1d, 0x0d, 0x0d, 0x17, 0x1d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x14, 0x17, 0x1d, 0x17, 0x0d, 0x1d, 0x17, 0x14, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x17, 0x17, 0x1c, 0x17, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x1c, 0x1c, 0x1c, 0x1c, 0x14, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x1b, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x1b, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x14, 0x1b, 0x1c, 0x1c, 0x1b, 0x14, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x08, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x0d, 0x0d, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x1d, 0x0d, 0x0d, 0x1d, 0x1d, 0x0d, 0x1d, 0x1d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x1d, 0x17, 0x1d, 0x0d, 0x1d, 0x0d, 0x0d, 0x17, 0x1d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x14, 0x17, 0x1d, 0x17, 0x0d, 0x1d, 0x17, 0x14, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x17, 0x17, 0x1c, 0x17, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x1b, 0x1b, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x1b, 0x1b, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x1b, 0x1b, 0x1c, 0x1c, 0x1b, 0x14, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x1e, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x0d, 0x1d, 0x0d, 0x0d, 0x0d, 0x1d, 0x1c, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x0d, 0x1d, 0x0d, 0x0d, 0x1d, 0x08, 0x1d, 0x0d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x08, 0x0d, 0x07, 0x07, 0x09, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x0d, 0x1d, 0x09, 0x1d, 0x0d, 0x14, 0x09, 0x07, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x0d, 0x17, 0x07, 0x1d, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x17, 0x14, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x14, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x14, 0x1b, 0x1b, 0x14, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x14, 0x1b, 0x14, 0x14, 0x1c, 0x0d, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x14, 0x14, 0x1b, 0x1b, 0x1c, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x14, 0x1b, 0x1b, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x14, 0x1b, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x07, 0x1f, 0x1f, 0x00, 0x07, 0x1f, 0x1e, 0x1e, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x0d, 0x1d, 0x0d, 0x0d, 0x0d, 0x1d, 0x1c, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x0d, 0x1d, 0x0d, 0x0d, 0x1d, 0x08, 0x1d, 0x0d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x08, 0x0d, 0x07, 0x07, 0x09, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x0d, 0x1d, 0x09, 0x1d, 0x0d, 0x14, 0x09, 0x07, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x0d, 0x17, 0x07, 0x1d, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x17, 0x14, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x14, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x14, 0x1b, 0x1b, 0x14, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x14, 0x1c, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x08, 0x07, 0x14, 0x1b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x1b, 0x1b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x1b, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x1b, 0x1b, 0x14, 0x14, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x07, 0x1f, 0x1e, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x0d, 0x1d, 0x0d, 0x0d, 0x0d, 0x1d, 0x1c, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x0d, 0x1d, 0x0d, 0x0d, 0x1d, 0x08, 0x1d, 0x0d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x08, 0x0d, 0x07, 0x07, 0x09, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x0d, 0x1d, 0x09, 0x1d, 0x0d, 0x14, 0x09, 0x07, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x0d, 0x17, 0x07, 0x1d, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x17, 0x14, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x14, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x14, 0x1b, 0x1b, 0x14, 0x0d, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x07, 0x14, 0x0d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x08, 0x09, 0x1b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x09, 0x09, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x07, 0x07, 0x14, 0x14, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x07, 0x1f, 0x1f, 0x1f, 0x07, 0x1f, 0x1e, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x0d, 0x0d, 0x0d, 0x0d, 0x1c, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x0d, 0x0d, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1c, 0x0d, 0x1d, 0x0d, 0x0d, 0x0d, 0x1d, 0x1c, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x0d, 0x17, 0x08, 0x09, 0x1d, 0x08, 0x1d, 0x0d, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x0d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x1d, 0x0d, 0x14, 0x09, 0x09, 0x14, 0x0d, 0x1d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x1d, 0x17, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x1d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x14, 0x1c, 0x07, 0x08, 0x08, 0x07, 0x1c, 0x14, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x1c, 0x0d, 0x0d, 0x1c, 0x14, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x1b, 0x1b, 0x14, 0x1b, 0x1c, 0x1c, 0x1b, 0x14, 0x14, 0x1b, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x14, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x07, 0x09, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x14, 0x1b, 0x1c, 0x0d, 0x1c, 0x1b, 0x14, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x14, 0x14, 0x1b, 0x1c, 0x0d, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x07, 0x07, 0x07, 0x07, 0x1f, 0x1f, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x1e, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x0d, 0x0d, 0x0d, 0x0d, 0x1c, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x0d, 0x0d, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1c, 0x0d, 0x1d, 0x0d, 0x0d, 0x0d, 0x1d, 0x1c, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x0d, 0x17, 0x08, 0x09, 0x1d, 0x08, 0x1d, 0x0d, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x0d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x1d, 0x0d, 0x14, 0x09, 0x09, 0x14, 0x0d, 0x1d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x1d, 0x17, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x1d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x14, 0x1c, 0x07, 0x08, 0x08, 0x07, 0x1c, 0x14, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x1c, 0x0d, 0x0d, 0x1c, 0x14, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x1b, 0x1b, 0x14, 0x1b, 0x1c, 0x1c, 0x1b, 0x14, 0x1b, 0x1b, 0x14, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x14, 0x1b, 0x1c, 0x1b, 0x1b, 0x1c, 0x1b, 0x14, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x1b, 0x1c, 0x0d, 0x0d, 0x1c, 0x1b, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x1b, 0x1b, 0x1c, 0x0d, 0x0d, 0x1c, 0x1b, 0x1b, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x1c, 0x1b, 0x1b, 0x1c, 0x14, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x14, 0x07, 0x1e, 0x1f, 0x07, 0x07, 0x1f, 0x1e, 0x07, 0x14, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x0d, 0x0d, 0x0d, 0x0d, 0x1c, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1b, 0x1b, 0x0d, 0x0d, 0x1b, 0x1b, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1c, 0x0d, 0x1d, 0x0d, 0x0d, 0x0d, 0x1d, 0x1c, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x0d, 0x17, 0x08, 0x09, 0x1d, 0x08, 0x1d, 0x0d, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x0d, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x0d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x1d, 0x1d, 0x0d, 0x14, 0x09, 0x09, 0x14, 0x0d, 0x1d, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x17, 0x1d, 0x17, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x1d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x14, 0x1c, 0x07, 0x08, 0x08, 0x07, 0x1c, 0x14, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x1c, 0x0d, 0x0d, 0x1c, 0x1c, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x1b, 0x14, 0x1c, 0x0d, 0x0d, 0x1c, 0x14, 0x1b, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x1b, 0x14, 0x14, 0x1b, 0x1c, 0x1c, 0x1b, 0x14, 0x1b, 0x1b, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x07, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x14, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x14, 0x1b, 0x1c, 0x0d, 0x1c, 0x1b, 0x14, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x1c, 0x0d, 0x1c, 0x1b, 0x14, 0x14, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x1f, 0x1f, 0x07, 0x07, 0x07, 0x07, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1e, 0x1e, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x17, 0x17, 0x17, 0x17, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x0d, 0x17, 0x17, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x17, 0x17, 0x0d, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x04, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x04, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x21, 0x04, 0x04, 0x04, 0x04, 0x21, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x04, 0x20, 0x04, 0x04, 0x20, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x04, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x20, 0x04, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x17, 0x17, 0x17, 0x17, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x0d, 0x17, 0x17, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x17, 0x17, 0x0d, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x04, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x04, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x21, 0x04, 0x04, 0x04, 0x04, 0x21, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x04, 0x17, 0x20, 0x20, 0x17, 0x04, 0x08, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x20, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x17, 0x22, 0x22, 0x17, 0x04, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x17, 0x0d, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x0d, 0x0d, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x07, 0x07, 0x09, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x04, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x0d, 0x17, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x20, 0x04, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x04, 0x0d, 0x04, 0x04, 0x20, 0x17, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x04, 0x04, 0x20, 0x20, 0x04, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x04, 0x04, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x20, 0x04, 0x04, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x20, 0x00, 0x22, 0x20, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x17, 0x0d, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x0d, 0x0d, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x07, 0x07, 0x09, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x04, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x0d, 0x17, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x20, 0x04, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x04, 0x04, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x08, 0x04, 0x04, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x04, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x17, 0x0d, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x0d, 0x0d, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x07, 0x07, 0x09, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x04, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x0d, 0x04, 0x0d, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x04, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x07, 0x04, 0x04, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x08, 0x09, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x09, 0x09, 0x07, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x07, 0x07, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x22, 0x20, 0x20, 0x22, 0x22, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x22, 0x20, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x17, 0x20, 0x0d, 0x20, 0x20, 0x0d, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x0d, 0x0d, 0x0d, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x09, 0x09, 0x04, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x17, 0x17, 0x04, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x0d, 0x0d, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x0d, 0x04, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x04, 0x0d, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x21, 0x04, 0x04, 0x04, 0x04, 0x21, 0x07, 0x09, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x04, 0x20, 0x20, 0x20, 0x17, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x21, 0x04, 0x20, 0x20, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x04, 0x22, 0x04, 0x04, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x17, 0x20, 0x0d, 0x20, 0x20, 0x0d, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x0d, 0x0d, 0x0d, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x09, 0x09, 0x04, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x17, 0x17, 0x04, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x0d, 0x0d, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x0d, 0x04, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x04, 0x0d, 0x04, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x21, 0x04, 0x04, 0x04, 0x04, 0x21, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x04, 0x20, 0x20, 0x20, 0x20, 0x04, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x04, 0x17, 0x20, 0x20, 0x17, 0x04, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x17, 0x04, 0x04, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x17, 0x04, 0x22, 0x22, 0x04, 0x17, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x17, 0x20, 0x0d, 0x20, 0x20, 0x0d, 0x20, 0x17, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x0d, 0x0d, 0x0d, 0x0d, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x09, 0x09, 0x04, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x04, 0x17, 0x17, 0x04, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x17, 0x17, 0x0d, 0x0d, 0x17, 0x17, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0x17, 0x17, 0x17, 0x17, 0x04, 0x20, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x0d, 0x04, 0x04, 0x20, 0x17, 0x17, 0x20, 0x04, 0x04, 0x0d, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x07, 0x21, 0x04, 0x04, 0x04, 0x04, 0x21, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x17, 0x20, 0x20, 0x20, 0x04, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x20, 0x20, 0x04, 0x13, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x04, 0x22, 0x04, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x17, 0x17, 0x04, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x25, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x07, 0x26, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x27, 0x26, 0x26, 0x26, 0x26, 0x27, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x26, 0x26, 0x26, 0x27, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x07, 0x27, 0x26, 0x26, 0x27, 0x07, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x23, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x23, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x00, 0x23, 0x24, 0x24, 0x23, 0x00, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x27, 0x27, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0e, 0x07, 0x0f, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x25, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x07, 0x26, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x27, 0x26, 0x26, 0x26, 0x26, 0x27, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x26, 0x26, 0x26, 0x27, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x07, 0x27, 0x26, 0x26, 0x27, 0x07, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x23, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x23, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x00, 0x23, 0x24, 0x24, 0x23, 0x00, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x08, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x27, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x07, 0x07, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x25, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x07, 0x26, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x27, 0x26, 0x26, 0x26, 0x26, 0x27, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x26, 0x26, 0x26, 0x27, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x07, 0x27, 0x26, 0x26, 0x27, 0x07, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x23, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x23, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x00, 0x23, 0x24, 0x24, 0x23, 0x00, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x08, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x27, 0x27, 0x27, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x0f, 0x07, 0x0e, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x26, 0x07, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x27, 0x27, 0x26, 0x07, 0x07, 0x09, 0x07, 0x25, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x27, 0x26, 0x26, 0x0d, 0x23, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x07, 0x26, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x25, 0x23, 0x26, 0x24, 0x25, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x07, 0x23, 0x23, 0x23, 0x24, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x07, 0x27, 0x27, 0x27, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0e, 0x07, 0x07, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x26, 0x07, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x27, 0x27, 0x26, 0x07, 0x07, 0x09, 0x07, 0x25, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x27, 0x26, 0x26, 0x0d, 0x23, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x07, 0x26, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x25, 0x23, 0x26, 0x24, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x08, 0x07, 0x23, 0x23, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x27, 0x27, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x27, 0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x26, 0x07, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x27, 0x27, 0x26, 0x07, 0x07, 0x09, 0x07, 0x25, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x27, 0x26, 0x26, 0x0d, 0x23, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x07, 0x26, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x25, 0x07, 0x07, 0x24, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x08, 0x08, 0x09, 0x27, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x09, 0x09, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x27, 0x07, 0x07, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x07, 0x07, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0e, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x07, 0x26, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x27, 0x27, 0x26, 0x26, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x07, 0x07, 0x08, 0x27, 0x07, 0x07, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x23, 0x09, 0x09, 0x23, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x27, 0x07, 0x08, 0x08, 0x07, 0x27, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x25, 0x27, 0x26, 0x24, 0x24, 0x26, 0x27, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x23, 0x26, 0x25, 0x25, 0x26, 0x23, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x23, 0x23, 0x27, 0x25, 0x25, 0x27, 0x23, 0x23, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x21, 0x23, 0x24, 0x24, 0x23, 0x21, 0x07, 0x09, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x07, 0x27, 0x27, 0x27, 0x26, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x21, 0x07, 0x27, 0x27, 0x26, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0e, 0x07, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x07, 0x26, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x27, 0x27, 0x26, 0x26, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x07, 0x07, 0x08, 0x27, 0x07, 0x07, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x23, 0x09, 0x09, 0x23, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x27, 0x07, 0x08, 0x08, 0x07, 0x27, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x25, 0x27, 0x26, 0x24, 0x24, 0x26, 0x27, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x23, 0x26, 0x25, 0x25, 0x26, 0x23, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x23, 0x23, 0x27, 0x25, 0x25, 0x27, 0x23, 0x23, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x21, 0x23, 0x24, 0x24, 0x23, 0x21, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x07, 0x27, 0x26, 0x26, 0x27, 0x07, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x07, 0x26, 0x26, 0x26, 0x26, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x27, 0x27, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0e, 0x07, 0x07, 0x0e, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x23, 0x07, 0x26, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x27, 0x26, 0x27, 0x27, 0x26, 0x26, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x07, 0x07, 0x08, 0x27, 0x07, 0x07, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x23, 0x09, 0x09, 0x23, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x27, 0x07, 0x08, 0x08, 0x07, 0x27, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x25, 0x27, 0x26, 0x24, 0x24, 0x26, 0x27, 0x25, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x24, 0x23, 0x26, 0x25, 0x25, 0x26, 0x23, 0x24, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x23, 0x23, 0x27, 0x25, 0x25, 0x27, 0x23, 0x23, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x07, 0x21, 0x23, 0x24, 0x24, 0x23, 0x21, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x26, 0x27, 0x27, 0x27, 0x07, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x26, 0x27, 0x27, 0x07, 0x21, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x07, 0x0e, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x28, 0x28, 0x08, 0x09, 0x09, 0x08, 0x28, 0x28, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x07, 0x29, 0x28, 0x08, 0x08, 0x28, 0x29, 0x07, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x07, 0x29, 0x28, 0x28, 0x29, 0x07, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x0d, 0x29, 0x29, 0x0d, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x2a, 0x0d, 0x0d, 0x0d, 0x0d, 0x2a, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x29, 0x2a, 0x0d, 0x0d, 0x2a, 0x29, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x29, 0x2b, 0x2a, 0x2a, 0x2b, 0x29, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x00, 0x29, 0x2b, 0x2b, 0x29, 0x00, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x07, 0x2c, 0x2d, 0x2d, 0x2d, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0e, 0x07, 0x0f, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x28, 0x28, 0x08, 0x09, 0x09, 0x08, 0x28, 0x28, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x07, 0x29, 0x28, 0x08, 0x08, 0x28, 0x29, 0x07, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x07, 0x29, 0x28, 0x28, 0x29, 0x07, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x0d, 0x29, 0x29, 0x0d, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x2a, 0x0d, 0x0d, 0x0d, 0x0d, 0x2a, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x29, 0x2a, 0x0d, 0x0d, 0x2a, 0x29, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x29, 0x2b, 0x2a, 0x2a, 0x2b, 0x29, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x00, 0x29, 0x2b, 0x2b, 0x29, 0x00, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x08, 0x08, 0x08, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x08, 0x08, 0x08, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x2e, 0x2c, 0x2c, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x07, 0x07, 0x0f, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x28, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x29, 0x29, 0x28, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x07, 0x29, 0x09, 0x28, 0x07, 0x07, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0x29, 0x28, 0x09, 0x09, 0x0d, 0x29, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x2a, 0x0d, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x2b, 0x0d, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x29, 0x2b, 0x2a, 0x0d, 0x2b, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x09, 0x07, 0x29, 0x29, 0x2b, 0x2b, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x2c, 0x2d, 0x29, 0x29, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x2c, 0x2c, 0x2d, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0e, 0x2c, 0x07, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x28, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x29, 0x29, 0x28, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x07, 0x29, 0x09, 0x28, 0x07, 0x07, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0x29, 0x28, 0x09, 0x09, 0x0d, 0x29, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x2a, 0x0d, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x29, 0x0d, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x07, 0x29, 0x2a, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x08, 0x07, 0x2d, 0x2b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x08, 0x2d, 0x2d, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x2d, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x2d, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x28, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x29, 0x29, 0x28, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x07, 0x29, 0x09, 0x28, 0x07, 0x07, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0x29, 0x28, 0x09, 0x09, 0x0d, 0x29, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x07, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x2a, 0x0d, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x29, 0x0d, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x07, 0x07, 0x29, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x09, 0x2d, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x09, 0x09, 0x2d, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x2d, 0x07, 0x07, 0x2d, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x07, 0x07, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0e, 0x0e, 0x0e, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x28, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x28, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x07, 0x0d, 0x29, 0x09, 0x09, 0x29, 0x0d, 0x07, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x29, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x07, 0x08, 0x08, 0x07, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x2a, 0x0d, 0x0d, 0x0d, 0x0d, 0x2a, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x29, 0x0d, 0x0d, 0x0d, 0x0d, 0x29, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x29, 0x2b, 0x2a, 0x2a, 0x2b, 0x29, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x00, 0x29, 0x2b, 0x2b, 0x29, 0x00, 0x07, 0x09, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x2c, 0x2d, 0x2d, 0x2d, 0x2e, 0x2c, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x2c, 0x2d, 0x2d, 0x2e, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0e, 0x07, 0x0e, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x28, 0x07, 0x07, 0x09, 0x09, 0x07, 0x07, 0x28, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x07, 0x0d, 0x29, 0x09, 0x09, 0x29, 0x0d, 0x07, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x29, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x07, 0x08, 0x08, 0x07, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x2a, 0x0d, 0x0d, 0x0d, 0x0d, 0x2a, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x29, 0x0d, 0x0d, 0x0d, 0x0d, 0x29, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x08, 0x07, 0x29, 0x2b, 0x2a, 0x2a, 0x2b, 0x29, 0x07, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x07, 0x09, 0x08, 0x07, 0x00, 0x29, 0x2b, 0x2b, 0x29, 0x00, 0x07, 0x08, 0x09, 0x07, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x08, 0x2c, 0x2d, 0x2e, 0x2e, 0x2d, 0x2c, 0x08, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x07, 0x07, 0x00, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2c, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x2e, 0x2d, 0x2d, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0e, 0x07, 0x07, 0x0e, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,959 @@
+// Art by Charles Gabriel, commissioned by OpenGameArt
+// (https://opengameart.org/content/twelve-16x18-rpg-sprites-plus-base).
+// Licensed under CC BY 3.0 (https://creativecommons.org/licenses/by/3.0/)
+//
+
+int sprite_rgb332_count = 52;
+int sprite_rgb332_height = 18;
+
+int sprite_rgb332_num_frames = 72;
+const uint16_t sprite_rgb332_frames[] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x4005, 0x4004, 0x4003, 0x0009, 0x000a, 0x000b, 0x000c,
+  0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x400e, 0x400d, 0x0012,
+  0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a,
+  0x001b, 0x4018, 0x4017, 0x4016, 0x001c, 0x001d, 0x401c, 0x001e,
+  0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x4020, 0x401f, 0x401e,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+  0x002c, 0x4029, 0x4028, 0x4027, 0x002d, 0x002e, 0x402d, 0x002f,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x4032, 0x4031, 0x4030, 0x402f,
+};
+
+const uint8_t __attribute__ ((aligned (4))) sprite_rgb332_data[] = {
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0x2e, 0x15, 0x15, 0x7f, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x7f, 0x7f, 0x7f, 0x7f, 0x2e, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x15, 0x2e, 0x7f, 0x2e, 0x7f, 0x2e, 0x7f, 0x2e, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0x15, 0x15, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x2e, 0x2e, 0x2e, 0x2e, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0xad, 0x15, 0xad, 0x15, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xff, 0xad, 0x52, 0xad, 0xff, 0xff, 0xad, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0x52, 0x52, 0x52, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xad, 0x52, 0xad, 0xad, 0x52, 0xad, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0xad, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0xad, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x52, 0x5c, 0xad, 0xad, 0xad, 0xb6, 0x5c, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0xff, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0x2e, 0x15, 0x15, 0x7f, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x7f, 0x7f, 0x7f, 0x7f, 0x2e, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x15, 0x2e, 0x7f, 0x2e, 0x7f, 0x2e, 0x7f, 0x2e, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0x15, 0x15, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x2e, 0x2e, 0x2e, 0x2e, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0xad, 0x15, 0xad, 0x15, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xff, 0xad, 0x52, 0xad, 0xff, 0xff, 0xad, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xad, 0x52, 0xad, 0xad, 0x52, 0xad, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x52, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0x52, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x52, 0x5c, 0xad, 0xb6, 0xb6, 0xad, 0x5c, 0x52, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0x2e, 0x15, 0x15, 0x7f, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x7f, 0x7f, 0x7f, 0x7f, 0x2e, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x15, 0x2e, 0x7f, 0x2e, 0x7f, 0x2e, 0x7f, 0x2e, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0x15, 0x15, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x2e, 0x2e, 0x2e, 0x2e, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0xad, 0x15, 0xad, 0x15, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0xad, 0xff, 0xff, 0xad, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0x52, 0x52, 0x52, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0xad, 0x52, 0xad, 0xad, 0x52, 0xad, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xad, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0xad, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5c, 0xb6, 0xad, 0xad, 0xad, 0x5c, 0x52, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x15, 0x15, 0x2e, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x2e, 0x7f, 0x7f, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0x7f, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0x15, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x66, 0x0a, 0x0a, 0xb7, 0x0a, 0x7f, 0x15, 0xc7, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0xb7, 0xff, 0x52, 0xb7, 0x0a, 0x2e, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0xff, 0x52, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xff, 0xff, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x66, 0x0a, 0x52, 0x52, 0xad, 0x52, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0xad, 0xad, 0xad, 0x52, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0xad, 0xad, 0x52, 0x52, 0xb6, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0xad, 0x52, 0x5c, 0xb6, 0xb6, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0x52, 0x52, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0x52, 0xc7, 0x52, 0xad, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x15, 0x15, 0x2e, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x2e, 0x7f, 0x7f, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0x7f, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0x15, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x66, 0x0a, 0x0a, 0xb7, 0x0a, 0x7f, 0x15, 0xc7, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0xb7, 0xff, 0x52, 0xb7, 0x0a, 0x2e, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0xff, 0x52, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xff, 0xff, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0x52, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0xad, 0x52, 0x52, 0xb6, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x52, 0x5c, 0xb6, 0xb6, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x15, 0x15, 0x2e, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x2e, 0x7f, 0x7f, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0x7f, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x7f, 0x7f, 0x7f, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0x15, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x66, 0x0a, 0x0a, 0xb7, 0x0a, 0x7f, 0x15, 0xc7, 0x15, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0xb7, 0xff, 0x52, 0xb7, 0x0a, 0x2e, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0xff, 0x52, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xff, 0xff, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0x52, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x66, 0xb7, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0xb7, 0xb7, 0x52, 0xb6, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x0a, 0x0a, 0xb6, 0xb6, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0xad, 0x52, 0xad, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0x2e, 0x15, 0x15, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x7f, 0x7f, 0x7f, 0x2e, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x7f, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0x15, 0x7f, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x2e, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x2e, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0x0a, 0x66, 0x66, 0x0a, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xff, 0xad, 0x52, 0xad, 0xff, 0xff, 0xad, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0x52, 0x52, 0x52, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xff, 0x52, 0x52, 0xff, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xad, 0x52, 0xad, 0xad, 0x52, 0xad, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0xad, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0xad, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x52, 0x5c, 0xad, 0xad, 0xad, 0xb6, 0x5c, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0x2e, 0x15, 0x15, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x7f, 0x7f, 0x7f, 0x2e, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x7f, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0x15, 0x7f, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x2e, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x2e, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0x0a, 0x66, 0x66, 0x0a, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xff, 0xad, 0x52, 0xad, 0xff, 0xff, 0xad, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xff, 0x52, 0x52, 0xff, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xad, 0x52, 0xad, 0xad, 0x52, 0xad, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0xad, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0xad, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x52, 0x5c, 0xb6, 0xad, 0xad, 0xb6, 0x5c, 0x52, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0xad, 0x52, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0xc7, 0xc7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0x2e, 0x15, 0x15, 0x2e, 0x2e, 0x7f, 0x2e, 0x2e, 0x2e, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x2e, 0x2e, 0x2e, 0x7f, 0x7f, 0x7f, 0x2e, 0x7f, 0x2e, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x15, 0x2e, 0x7f, 0x7f, 0x15, 0x7f, 0x7f, 0x7f, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0x15, 0x7f, 0x15, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x15, 0xc7, 0x15, 0x7f, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0x7f, 0x15, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x2e, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x2e, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x15, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x15, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xad, 0x0a, 0x66, 0x66, 0x0a, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xff, 0xad, 0x52, 0xad, 0xff, 0xff, 0xad, 0x52, 0xad, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0x52, 0x52, 0x52, 0x52, 0xad, 0xad, 0x52, 0x52, 0xad, 0xad, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xff, 0x52, 0x52, 0xff, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0x0a, 0xad, 0x52, 0xad, 0xad, 0x52, 0xad, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xad, 0x52, 0xad, 0x52, 0x52, 0xad, 0x52, 0xad, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5c, 0xb6, 0xad, 0xad, 0xad, 0x5c, 0x52, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x52, 0xad, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0xff, 0xad, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x6d, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x14, 0x6d, 0x6d, 0x6d, 0x6d, 0x14, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0x0a, 0x14, 0x14, 0x14, 0x14, 0x0a, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xe5, 0x0a, 0xe5, 0xaf, 0xe5, 0xaf, 0x0a, 0xe5, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0xe5, 0xaf, 0xe5, 0xaf, 0xaf, 0xe5, 0xaf, 0xe5, 0xaf, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0x51, 0xe5, 0x94, 0xaf, 0xe5, 0x94, 0xaf, 0xe5, 0xe5, 0x94, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x94, 0x94, 0xe5, 0x94, 0x94, 0xe5, 0x94, 0x94, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xe3, 0x51, 0x51, 0x94, 0xe3, 0xe3, 0x92, 0x94, 0x51, 0xe3, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x51, 0x92, 0xe3, 0xe3, 0xe3, 0xe3, 0x51, 0x51, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x51, 0x92, 0x92, 0x92, 0xe3, 0x92, 0x51, 0x51, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x92, 0x51, 0x92, 0x92, 0x92, 0x51, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x51, 0x92, 0x51, 0x51, 0x92, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x6d, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x14, 0x6d, 0x6d, 0x6d, 0x6d, 0x14, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0x0a, 0x14, 0x14, 0x14, 0x14, 0x0a, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xe5, 0x0a, 0xe5, 0xaf, 0xe5, 0xaf, 0x0a, 0xe5, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0xe5, 0xaf, 0xe5, 0xaf, 0xaf, 0xe5, 0xaf, 0xe5, 0xaf, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0x51, 0xe5, 0x94, 0xaf, 0xe5, 0x94, 0xaf, 0xe5, 0xe5, 0x94, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x94, 0x94, 0xe5, 0x94, 0x94, 0xe5, 0x94, 0x94, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0xe3, 0x51, 0x51, 0x94, 0xe3, 0xe3, 0x92, 0x94, 0x51, 0xe3, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x51, 0x92, 0xe3, 0xe3, 0xe3, 0xe3, 0x92, 0x51, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x51, 0x92, 0x92, 0x92, 0xe3, 0x92, 0x92, 0x51, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x92, 0x51, 0x92, 0x92, 0x92, 0x92, 0x51, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x51, 0x92, 0x51, 0x51, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x6d, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x14, 0x6d, 0x6d, 0x6d, 0x6d, 0x14, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0x0a, 0x14, 0x14, 0x14, 0x14, 0x0a, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xe5, 0x0a, 0xe5, 0xaf, 0xe5, 0xaf, 0x0a, 0xe5, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0xe5, 0xaf, 0xe5, 0xaf, 0xaf, 0xe5, 0xaf, 0xe5, 0xaf, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0x51, 0xe5, 0x94, 0xaf, 0xe5, 0x94, 0xaf, 0xe5, 0xe5, 0x94, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x94, 0x94, 0xe5, 0x94, 0x94, 0xe5, 0x94, 0x94, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0xe3, 0x51, 0x94, 0x92, 0xe3, 0xe3, 0x94, 0x51, 0x51, 0xe3, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x51, 0x51, 0xe3, 0xe3, 0xe3, 0xe3, 0x92, 0x51, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x51, 0x51, 0x92, 0xe3, 0x92, 0x92, 0x92, 0x51, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x92, 0x92, 0x92, 0x51, 0x92, 0x51, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x92, 0x51, 0x51, 0x92, 0x51, 0x51, 0x51, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x0a, 0x77, 0x77, 0x6d, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x77, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x14, 0x14, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x6d, 0x77, 0xb7, 0xb7, 0xb7, 0xb7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0xe5, 0xaf, 0xe5, 0x0a, 0xb7, 0xb7, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0xaf, 0xaf, 0xe5, 0xff, 0x94, 0xb7, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0xe5, 0xaf, 0x0a, 0x94, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0x94, 0xe5, 0x51, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x94, 0x94, 0x51, 0xe3, 0x92, 0x14, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x94, 0x51, 0x92, 0x92, 0x51, 0x14, 0x77, 0x77, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x51, 0xe3, 0x51, 0x51, 0x92, 0xa4, 0x52, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0x51, 0x92, 0x92, 0xa4, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x51, 0x92, 0xe3, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x51, 0x92, 0xe3, 0xe3, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x6d, 0x6d, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x51, 0x0a, 0x6d, 0x6d, 0xfe, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x77, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x14, 0x14, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x6d, 0x77, 0xb7, 0xb7, 0xb7, 0xb7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0xe5, 0xaf, 0xe5, 0x0a, 0xb7, 0xb7, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0xaf, 0xaf, 0xe5, 0xff, 0x94, 0xb7, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0xe5, 0xaf, 0x0a, 0x94, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0x94, 0xe5, 0x51, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x94, 0x94, 0x51, 0xe3, 0x92, 0x14, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x94, 0x51, 0x92, 0x92, 0x51, 0x14, 0x77, 0x77, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0xe3, 0x51, 0x51, 0x92, 0xa4, 0xa4, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0x66, 0x51, 0x92, 0x92, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x92, 0xe3, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x92, 0xe3, 0xe3, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x0a, 0x6d, 0x6d, 0x51, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x77, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x14, 0x14, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x6d, 0x77, 0xb7, 0xb7, 0xb7, 0xb7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0xe5, 0xaf, 0xe5, 0x0a, 0xb7, 0xb7, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0xaf, 0xaf, 0xe5, 0xff, 0x94, 0xb7, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0xe5, 0xaf, 0x0a, 0x94, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0x94, 0xe5, 0x51, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x94, 0x94, 0x51, 0xe3, 0x92, 0x14, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x94, 0x51, 0x92, 0x92, 0x51, 0x14, 0x77, 0x77, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0xe3, 0x0a, 0x51, 0x51, 0xa4, 0xa4, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x66, 0x66, 0xb7, 0x92, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x0a, 0xb7, 0xb7, 0x51, 0xe3, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x0a, 0x0a, 0x92, 0xe3, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x92, 0x51, 0x51, 0x51, 0x92, 0x6d, 0x6d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x51, 0x51, 0x51, 0x0a, 0x6d, 0x6d, 0x6d, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x6d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x14, 0x14, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0xb7, 0xb7, 0xb7, 0xb7, 0x77, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0xff, 0x94, 0xb7, 0xb7, 0x94, 0xff, 0x0a, 0xe6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe6, 0xe6, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xe6, 0xe6, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0xe6, 0x51, 0x92, 0x0a, 0x66, 0x66, 0x0a, 0x92, 0x51, 0xe6, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0x51, 0xe3, 0x14, 0x51, 0x52, 0x52, 0x51, 0x14, 0xe3, 0x51, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xe3, 0x92, 0x14, 0x77, 0x77, 0x14, 0x92, 0xe3, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0xe3, 0x92, 0x92, 0x51, 0xa4, 0xa4, 0x51, 0x92, 0x92, 0xe3, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x51, 0x92, 0x51, 0xa4, 0xa4, 0x51, 0x92, 0x51, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x51, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x92, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x0a, 0x0a, 0x6d, 0x0a, 0x0a, 0x51, 0x51, 0x92, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x14, 0x14, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0xb7, 0xb7, 0xb7, 0xb7, 0x77, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0xff, 0x94, 0xb7, 0xb7, 0x94, 0xff, 0x0a, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xe5, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xe5, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0xe5, 0x51, 0x92, 0x0a, 0x66, 0x66, 0x0a, 0x92, 0x51, 0xaf, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0x51, 0xe3, 0x14, 0x51, 0x52, 0x52, 0x51, 0x14, 0xe3, 0x51, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xe3, 0x92, 0x14, 0x77, 0x77, 0x14, 0x92, 0xe3, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0xe3, 0x92, 0x92, 0x51, 0xa4, 0xa4, 0x51, 0x92, 0x92, 0xe3, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x51, 0x92, 0x51, 0xa4, 0xa4, 0x51, 0x92, 0x51, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x92, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x92, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x92, 0x51, 0x51, 0x0a, 0x0a, 0x51, 0x51, 0x92, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x0a, 0x77, 0x6d, 0x0a, 0x0a, 0x6d, 0x77, 0x0a, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x6d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x6d, 0x6d, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x14, 0x14, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0xb7, 0xb7, 0xb7, 0xb7, 0x77, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x0a, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0x94, 0x0a, 0xff, 0x94, 0xb7, 0xb7, 0x94, 0xff, 0x0a, 0xe6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe6, 0xe6, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xe6, 0xe6, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0xe6, 0x51, 0x92, 0x0a, 0x66, 0x66, 0x0a, 0x92, 0x51, 0xe6, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x94, 0x51, 0xe3, 0x14, 0x51, 0x52, 0x52, 0x51, 0x14, 0xe3, 0x51, 0x94, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xe3, 0x92, 0x14, 0x77, 0x77, 0x14, 0x92, 0xe3, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0xe3, 0x92, 0x92, 0x51, 0xa4, 0xa4, 0x51, 0x92, 0x92, 0xe3, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x51, 0x92, 0x51, 0xa4, 0xa4, 0x51, 0x92, 0x51, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x51, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x92, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x51, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x92, 0x51, 0x51, 0x0a, 0x0a, 0x6d, 0x0a, 0x0a, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x0a, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x77, 0x6d, 0x14, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0x14, 0x14, 0x14, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xb7, 0xb7, 0xb7, 0xb7, 0x77, 0x6d, 0x6d, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x14, 0x14, 0x14, 0x6d, 0x6d, 0x6d, 0x14, 0x14, 0x14, 0x14, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x94, 0x0a, 0xb7, 0xb7, 0x0a, 0xe5, 0xaf, 0xe5, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xe5, 0x0a, 0xb7, 0x94, 0xff, 0xe5, 0xaf, 0xaf, 0x0a, 0x94, 0xc7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0xb7, 0x94, 0x0a, 0xaf, 0xe5, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x66, 0x0a, 0x51, 0xe5, 0x94, 0xe5, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0x14, 0x92, 0xe3, 0x51, 0x94, 0x94, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x77, 0x77, 0x14, 0x51, 0x92, 0x92, 0x51, 0x94, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x52, 0xa4, 0x92, 0x51, 0x51, 0xe3, 0x51, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xa4, 0x92, 0x92, 0x51, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0xe3, 0x92, 0x51, 0x66, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xe3, 0xe3, 0x92, 0x51, 0x51, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x6d, 0x6d, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0x6d, 0x6d, 0x0a, 0x51, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xff, 0xff, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xf6, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xff, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xb6, 0xff, 0xff, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xb6, 0xa4, 0xb6, 0xff, 0xb6, 0xff, 0xff, 0xa4, 0xb6, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0x51, 0xa4, 0xb6, 0xa4, 0xff, 0xb6, 0xa4, 0x51, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xa4, 0xa4, 0xf6, 0xa4, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xf6, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x9b, 0x9b, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0x51, 0x9b, 0xf6, 0xf6, 0x9b, 0x9b, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x66, 0x14, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xff, 0xff, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xf6, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xff, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xb6, 0xff, 0xff, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xb6, 0xa4, 0xb6, 0xff, 0xb6, 0xff, 0xff, 0xa4, 0xb6, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0x51, 0xa4, 0xb6, 0xa4, 0xff, 0xb6, 0xa4, 0x51, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xa4, 0xa4, 0xf6, 0xa4, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0xf6, 0xf6, 0xf6, 0xf6, 0x51, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x9b, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0x9b, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0x51, 0x9b, 0xf6, 0xf6, 0x9b, 0x51, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x66, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xff, 0xff, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xf6, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xff, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xb6, 0xff, 0xff, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xb6, 0xa4, 0xb6, 0xff, 0xb6, 0xff, 0xff, 0xa4, 0xb6, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0x51, 0xa4, 0xb6, 0xa4, 0xff, 0xb6, 0xa4, 0x51, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xa4, 0xa4, 0xf6, 0xa4, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xf6, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x9b, 0x9b, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x9b, 0x9b, 0xf6, 0xf6, 0x9b, 0x51, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0x66, 0xb6, 0xff, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x66, 0xff, 0x0a, 0x0a, 0xb7, 0x0a, 0xff, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xff, 0xb6, 0xb7, 0xb6, 0xff, 0x51, 0xb7, 0x0a, 0xb6, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xff, 0xa4, 0x0a, 0xb6, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xa4, 0x51, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xa4, 0x51, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xa4, 0x51, 0x9b, 0x9b, 0x51, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x51, 0x9b, 0x51, 0x51, 0xf6, 0xff, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0x51, 0x51, 0x9b, 0x9b, 0xf6, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x51, 0x9b, 0x9b, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x51, 0x9b, 0xf6, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x9b, 0x9b, 0x9b, 0x51, 0x51, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x0a, 0x14, 0x14, 0xc7, 0x0a, 0x14, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0x66, 0xb6, 0xff, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x66, 0xff, 0x0a, 0x0a, 0xb7, 0x0a, 0xff, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xff, 0xb6, 0xb7, 0xb6, 0xff, 0x51, 0xb7, 0x0a, 0xb6, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xff, 0xa4, 0x0a, 0xb6, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xa4, 0x51, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xa4, 0x51, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xa4, 0x51, 0x9b, 0x9b, 0x51, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0x51, 0xf6, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0x51, 0x9b, 0xf6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x9b, 0x9b, 0xf6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x9b, 0xf6, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x9b, 0x9b, 0x51, 0x51, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x0a, 0x14, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0x66, 0xb6, 0xff, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x66, 0xff, 0x0a, 0x0a, 0xb7, 0x0a, 0xff, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xff, 0xb6, 0xb7, 0xb6, 0xff, 0x51, 0xb7, 0x0a, 0xb6, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xff, 0xa4, 0x0a, 0xb6, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xa4, 0x51, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xa4, 0x51, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xa4, 0x51, 0x9b, 0x9b, 0x51, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0x0a, 0x51, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x66, 0xb7, 0x9b, 0xf6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0xb7, 0xb7, 0x51, 0xf6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x51, 0x51, 0xf6, 0xf6, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x0a, 0x0a, 0x51, 0x51, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x0a, 0x14, 0x14, 0x14, 0x0a, 0x14, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xf6, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xff, 0xa4, 0x66, 0xb7, 0xb6, 0x66, 0xb6, 0xff, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0xff, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xb6, 0xff, 0x51, 0xb7, 0xb7, 0x51, 0xff, 0xb6, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xb6, 0xa4, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xb6, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0x51, 0xf6, 0x0a, 0x66, 0x66, 0x0a, 0xf6, 0x51, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0xf6, 0xff, 0xff, 0xf6, 0x51, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x51, 0x9b, 0xf6, 0xf6, 0x9b, 0x51, 0x51, 0x9b, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0x51, 0x9b, 0x9b, 0x9b, 0xf6, 0x9b, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x51, 0x9b, 0xf6, 0xff, 0xf6, 0x9b, 0x51, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x51, 0x51, 0x9b, 0xf6, 0xff, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x0a, 0x0a, 0x0a, 0x0a, 0x14, 0x14, 0x51, 0x51, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x14, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xf6, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xff, 0xa4, 0x66, 0xb7, 0xb6, 0x66, 0xb6, 0xff, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0xff, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xb6, 0xff, 0x51, 0xb7, 0xb7, 0x51, 0xff, 0xb6, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xb6, 0xa4, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xb6, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0x51, 0xf6, 0x0a, 0x66, 0x66, 0x0a, 0xf6, 0x51, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0xf6, 0xff, 0xff, 0xf6, 0x51, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x51, 0x9b, 0xf6, 0xf6, 0x9b, 0x51, 0x9b, 0x9b, 0x51, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x51, 0x9b, 0xf6, 0x9b, 0x9b, 0xf6, 0x9b, 0x51, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x9b, 0xf6, 0xff, 0xff, 0xf6, 0x9b, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x9b, 0x9b, 0xf6, 0xff, 0xff, 0xf6, 0x9b, 0x9b, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0xf6, 0x9b, 0x9b, 0xf6, 0x51, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x51, 0x0a, 0x66, 0x14, 0x0a, 0x0a, 0x14, 0x66, 0x0a, 0x51, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x51, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0x9b, 0x9b, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xf6, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0xff, 0xa4, 0x66, 0xb7, 0xb6, 0x66, 0xb6, 0xff, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0xff, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0xff, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xa4, 0xb6, 0xb6, 0xff, 0x51, 0xb7, 0xb7, 0x51, 0xff, 0xb6, 0xa4, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xa4, 0xa4, 0xb6, 0xa4, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xb6, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xb6, 0x51, 0xf6, 0x0a, 0x66, 0x66, 0x0a, 0xf6, 0x51, 0xb6, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0x51, 0xf6, 0xff, 0xff, 0xf6, 0x51, 0x9b, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x51, 0x9b, 0x51, 0x51, 0x9b, 0xf6, 0xf6, 0x9b, 0x51, 0x9b, 0x9b, 0x51, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0x0a, 0x9b, 0xf6, 0x9b, 0x9b, 0x9b, 0x51, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x51, 0x9b, 0xf6, 0xff, 0xf6, 0x9b, 0x51, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x51, 0x9b, 0xf6, 0xff, 0xf6, 0x9b, 0x51, 0x51, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x51, 0x51, 0x51, 0x14, 0x14, 0x0a, 0x0a, 0x0a, 0x0a, 0x51, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x66, 0x14, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0xff, 0xa4, 0xa4, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0xa4, 0xa4, 0xff, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x52, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0x52, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xf3, 0x52, 0x52, 0x52, 0x52, 0xf3, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x52, 0x5b, 0x52, 0x52, 0x5b, 0x52, 0xc7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x52, 0x5b, 0x52, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x5b, 0xa4, 0xa4, 0x00, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0xff, 0xa4, 0xa4, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0xa4, 0xa4, 0xff, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x52, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0x52, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xf3, 0x52, 0x52, 0x52, 0x52, 0xf3, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x52, 0xa4, 0x5b, 0x5b, 0xa4, 0x52, 0x66, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x5b, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x52, 0xa4, 0x00, 0x00, 0xa4, 0x52, 0x00, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0xa4, 0xff, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x0a, 0x0a, 0xb7, 0x5b, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0x52, 0xb7, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xff, 0xa4, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x5b, 0x52, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x52, 0xff, 0x52, 0x52, 0x5b, 0xa4, 0x52, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0x52, 0x52, 0x5b, 0x5b, 0x52, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x52, 0x52, 0x52, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x52, 0x52, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x52, 0x5b, 0x52, 0x52, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x5b, 0x5b, 0xc7, 0x00, 0x5b, 0xa4, 0xa4, 0x00, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0xa4, 0xff, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x0a, 0x0a, 0xb7, 0x5b, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0x52, 0xb7, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x52, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xff, 0xa4, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x5b, 0x52, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xff, 0x52, 0x52, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0x66, 0x52, 0x52, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x52, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x52, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x52, 0xa4, 0xa4, 0x00, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0xa4, 0xff, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x0a, 0x0a, 0xb7, 0x5b, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0x52, 0xb7, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x52, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xff, 0x52, 0xff, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0x52, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x0a, 0x52, 0x52, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x66, 0xb7, 0x52, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0xb7, 0xb7, 0x0a, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x0a, 0x0a, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x00, 0x5b, 0x5b, 0x00, 0x00, 0x5b, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x00, 0x5b, 0x5b, 0x5b, 0x00, 0x5b, 0xa4, 0xa4, 0x00, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x5b, 0xff, 0x5b, 0x5b, 0xff, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x0a, 0x0a, 0x66, 0x66, 0x0a, 0x0a, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x52, 0xa4, 0xa4, 0x52, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0xff, 0xff, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0xff, 0x52, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0x52, 0xff, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xf3, 0x52, 0x52, 0x52, 0x52, 0xf3, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x52, 0x5b, 0x5b, 0x5b, 0xa4, 0x52, 0xc7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xf3, 0x52, 0x5b, 0x5b, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x00, 0x52, 0x00, 0x52, 0x52, 0x00, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x52, 0xa4, 0xa4, 0x00, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x5b, 0xff, 0x5b, 0x5b, 0xff, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x0a, 0x0a, 0x66, 0x66, 0x0a, 0x0a, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x52, 0xa4, 0xa4, 0x52, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0xff, 0xff, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xff, 0x52, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0x52, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xf3, 0x52, 0x52, 0x52, 0x52, 0xf3, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x52, 0xa4, 0x5b, 0x5b, 0xa4, 0x52, 0xc7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0xa4, 0x52, 0x52, 0xa4, 0x00, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0xa4, 0x52, 0x00, 0x00, 0x52, 0xa4, 0x00, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0x5b, 0xff, 0x5b, 0x5b, 0xff, 0x5b, 0xa4, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x0a, 0x0a, 0x66, 0x66, 0x0a, 0x0a, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xff, 0x52, 0xa4, 0xa4, 0x52, 0xff, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0xa4, 0xa4, 0xff, 0xff, 0xa4, 0xa4, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0x5b, 0x52, 0xa4, 0xa4, 0xa4, 0xa4, 0x52, 0x5b, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xff, 0x52, 0x52, 0x5b, 0xa4, 0xa4, 0x5b, 0x52, 0x52, 0xff, 0x52, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0x0a, 0xf3, 0x52, 0x52, 0x52, 0x52, 0xf3, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xc7, 0x52, 0xa4, 0x5b, 0x5b, 0x5b, 0x52, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0xa4, 0xa4, 0x5b, 0x5b, 0x52, 0xaf, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0x52, 0x52, 0x00, 0x52, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x00, 0xa4, 0xa4, 0x52, 0x00, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x72, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x72, 0x72, 0x72, 0x72, 0x58, 0x10, 0x0a, 0x77, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x77, 0x77, 0x77, 0x77, 0x1d, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x77, 0x77, 0x77, 0x1d, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x0a, 0x1d, 0x77, 0x77, 0x1d, 0x0a, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x10, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0x10, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0x10, 0x58, 0x58, 0x10, 0xc7, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0xc7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0x1d, 0x1d, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x6d, 0x0a, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x72, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x72, 0x72, 0x72, 0x72, 0x58, 0x10, 0x0a, 0x77, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x77, 0x77, 0x77, 0x77, 0x1d, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x77, 0x77, 0x77, 0x1d, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x0a, 0x1d, 0x77, 0x77, 0x1d, 0x0a, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x10, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0x10, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0x10, 0x58, 0x58, 0x10, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0x66, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0xc7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x1d, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x0a, 0x0a, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x72, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x72, 0x72, 0x72, 0x72, 0x58, 0x10, 0x0a, 0x77, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x77, 0x77, 0x77, 0x77, 0x1d, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x77, 0x77, 0x77, 0x1d, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x0a, 0x1d, 0x77, 0x77, 0x1d, 0x0a, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x10, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0x10, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0xc7, 0x10, 0x58, 0x58, 0x10, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xc7, 0x0a, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0x66, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x1d, 0x1d, 0x1d, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x0a, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x77, 0x0a, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x77, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x1d, 0x1d, 0x1d, 0x77, 0x77, 0x58, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x1d, 0x77, 0x0a, 0x0a, 0xb7, 0x0a, 0x72, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x77, 0x77, 0xff, 0x10, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x77, 0x0a, 0x77, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x72, 0x10, 0x77, 0x58, 0x72, 0x10, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0x10, 0x10, 0x10, 0x58, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x0a, 0x1d, 0x1d, 0x1d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x6d, 0x0a, 0x0a, 0x6d, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x77, 0x0a, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x77, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x1d, 0x1d, 0x1d, 0x77, 0x77, 0x58, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x1d, 0x77, 0x0a, 0x0a, 0xb7, 0x0a, 0x72, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x77, 0x77, 0xff, 0x10, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x77, 0x0a, 0x77, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x72, 0x10, 0x77, 0x58, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0x10, 0x10, 0x58, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x1d, 0x1d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x1d, 0x77, 0x1d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x77, 0x0a, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x77, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x1d, 0x1d, 0x1d, 0x77, 0x77, 0x58, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x1d, 0x77, 0x0a, 0x0a, 0xb7, 0x0a, 0x72, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x77, 0x77, 0xff, 0x10, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x77, 0x0a, 0x77, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x72, 0x0a, 0x0a, 0x58, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x66, 0x66, 0xb7, 0x1d, 0x58, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0xb7, 0xb7, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x1d, 0x0a, 0x0a, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x0a, 0x0a, 0x1d, 0x1d, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x6d, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0x0a, 0x77, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x1d, 0x1d, 0x77, 0x77, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x0a, 0x0a, 0x66, 0x1d, 0x0a, 0x0a, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xff, 0x10, 0xb7, 0xb7, 0x10, 0xff, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x0a, 0x66, 0x66, 0x0a, 0x1d, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x72, 0x1d, 0x77, 0x58, 0x58, 0x77, 0x1d, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x10, 0x77, 0x72, 0x72, 0x77, 0x10, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x10, 0x10, 0x1d, 0x72, 0x72, 0x1d, 0x10, 0x10, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xf3, 0x10, 0x58, 0x58, 0x10, 0xf3, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x0a, 0x1d, 0x1d, 0x1d, 0x77, 0x0a, 0xc7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xf3, 0x0a, 0x1d, 0x1d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x6d, 0x0a, 0x6d, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0x0a, 0x77, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x1d, 0x1d, 0x77, 0x77, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x0a, 0x0a, 0x66, 0x1d, 0x0a, 0x0a, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xff, 0x10, 0xb7, 0xb7, 0x10, 0xff, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x0a, 0x66, 0x66, 0x0a, 0x1d, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x72, 0x1d, 0x77, 0x58, 0x58, 0x77, 0x1d, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x10, 0x77, 0x72, 0x72, 0x77, 0x10, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x10, 0x10, 0x1d, 0x72, 0x72, 0x1d, 0x10, 0x10, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xf3, 0x10, 0x58, 0x58, 0x10, 0xf3, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x0a, 0x1d, 0x77, 0x77, 0x1d, 0x0a, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x0a, 0x77, 0x77, 0x77, 0x77, 0x0a, 0xc7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x1d, 0x1d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x6d, 0x0a, 0x0a, 0x6d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x10, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x10, 0x0a, 0x77, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x10, 0x10, 0x10, 0x10, 0x72, 0x72, 0x10, 0x77, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x58, 0x58, 0x58, 0x72, 0x72, 0x72, 0x58, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x1d, 0x77, 0x1d, 0x1d, 0x77, 0x77, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x0a, 0x0a, 0x66, 0x1d, 0x0a, 0x0a, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xff, 0x10, 0xb7, 0xb7, 0x10, 0xff, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x10, 0x1d, 0x0a, 0x66, 0x66, 0x0a, 0x1d, 0x10, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x72, 0x1d, 0x77, 0x58, 0x58, 0x77, 0x1d, 0x72, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x10, 0x58, 0x10, 0x77, 0x72, 0x72, 0x77, 0x10, 0x58, 0x10, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x10, 0x10, 0x1d, 0x72, 0x72, 0x1d, 0x10, 0x10, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0x0a, 0xf3, 0x10, 0x58, 0x58, 0x10, 0xf3, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xc7, 0x0a, 0x77, 0x1d, 0x1d, 0x1d, 0x0a, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x1d, 0x1d, 0x0a, 0xf3, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x0a, 0x6d, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0xad, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x66, 0xb7, 0xb7, 0x66, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x0a, 0x52, 0xad, 0x66, 0x66, 0xad, 0x52, 0x0a, 0xad, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xad, 0x0a, 0x52, 0xad, 0xad, 0x52, 0x0a, 0xad, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xf6, 0xff, 0x52, 0x52, 0xff, 0xf6, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x52, 0xf6, 0xff, 0xff, 0xf6, 0x52, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0x9b, 0xf6, 0xf6, 0x9b, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0x52, 0x9b, 0x9b, 0x52, 0xc7, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0xc7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x03, 0x0c, 0x0c, 0x0c, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x6d, 0x0a, 0x77, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0xad, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0xad, 0x66, 0xb7, 0xb7, 0x66, 0xad, 0xad, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x0a, 0x52, 0xad, 0x66, 0x66, 0xad, 0x52, 0x0a, 0xad, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xad, 0x0a, 0x52, 0xad, 0xad, 0x52, 0x0a, 0xad, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xf6, 0xff, 0x52, 0x52, 0xff, 0xf6, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x52, 0xf6, 0xff, 0xff, 0xf6, 0x52, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0x9b, 0xf6, 0xf6, 0x9b, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0x52, 0x9b, 0x9b, 0x52, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0x66, 0x66, 0x66, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x66, 0x66, 0x66, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0xc7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x03, 0x66, 0x03, 0x03, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x0a, 0x0a, 0x77, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x52, 0x52, 0xad, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0x0a, 0x52, 0xb7, 0xad, 0x0a, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xad, 0x52, 0xad, 0xb7, 0xb7, 0xff, 0x52, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x9b, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x66, 0x52, 0x9b, 0xf6, 0xff, 0x9b, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0x52, 0x52, 0x9b, 0x9b, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x03, 0x0c, 0x52, 0x52, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x03, 0x03, 0x0c, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x6d, 0x03, 0x0a, 0x6d, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x52, 0x52, 0xad, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0x0a, 0x52, 0xb7, 0xad, 0x0a, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xad, 0x52, 0xad, 0xb7, 0xb7, 0xff, 0x52, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x52, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0xf6, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0x0c, 0x9b, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x0c, 0x0c, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0c, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x03, 0x0c, 0x66, 0x66, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x52, 0x52, 0xad, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x52, 0x0a, 0x52, 0xb7, 0xad, 0x0a, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xad, 0x52, 0xad, 0xb7, 0xb7, 0xff, 0x52, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x66, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xf6, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xb7, 0xb7, 0x52, 0xff, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x0a, 0x52, 0xff, 0x9b, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x66, 0xb7, 0x0c, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0xb7, 0xb7, 0x0c, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0c, 0x0a, 0x0a, 0x0c, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x0a, 0x0a, 0x0c, 0x0c, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x6d, 0x6d, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0xad, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0xad, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x0a, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x0a, 0xad, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xf6, 0x0a, 0x66, 0x66, 0x0a, 0xf6, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x52, 0xff, 0xff, 0xff, 0xff, 0x52, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0x9b, 0xf6, 0xf6, 0x9b, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0x52, 0x9b, 0x9b, 0x52, 0xc7, 0x0a, 0xb7, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x03, 0x0c, 0x0c, 0x0c, 0x66, 0x03, 0xc7, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x03, 0x0c, 0x0c, 0x66, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x6d, 0x0a, 0x6d, 0x6d, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x6d, 0x77, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x0a, 0x0a, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xad, 0x66, 0xb7, 0xb7, 0xb7, 0xb7, 0x66, 0xad, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x52, 0xad, 0x0a, 0x0a, 0xb7, 0xb7, 0x0a, 0x0a, 0xad, 0x52, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xad, 0x0a, 0xff, 0x52, 0xb7, 0xb7, 0x52, 0xff, 0x0a, 0xad, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x52, 0x0a, 0x66, 0xb7, 0xb7, 0x66, 0x0a, 0x52, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0xf6, 0x0a, 0x66, 0x66, 0x0a, 0xf6, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0x0a, 0x66, 0x52, 0xff, 0xff, 0xff, 0xff, 0x52, 0x66, 0x0a, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x66, 0x0a, 0x52, 0x9b, 0xf6, 0xf6, 0x9b, 0x52, 0x0a, 0x66, 0x0a, 0xc7, 0xc7,
+  0xc7, 0x0a, 0xb7, 0x66, 0x0a, 0xc7, 0x52, 0x9b, 0x9b, 0x52, 0xc7, 0x0a, 0x66, 0xb7, 0x0a, 0xc7,
+  0xc7, 0x0a, 0xb7, 0xb7, 0x66, 0x03, 0x0c, 0x66, 0x66, 0x0c, 0x03, 0x66, 0xb7, 0xb7, 0x0a, 0xc7,
+  0xc7, 0xc7, 0x0a, 0x0a, 0xc7, 0x03, 0x66, 0x66, 0x66, 0x66, 0x03, 0xc7, 0x0a, 0x0a, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x03, 0x66, 0x0c, 0x0c, 0x66, 0x03, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0x0a, 0x77, 0x6d, 0x0a, 0x0a, 0x6d, 0x77, 0x0a, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+};
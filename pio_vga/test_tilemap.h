@@ -1,6 +1,6 @@
 int tilemap_width = 28;
 int tilemap_height = 27;
-uint8_t tilemap_tiles = {
+const uint16_t tilemap_tiles[] = {
   0,
   0,
   0,
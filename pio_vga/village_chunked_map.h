@@ -0,0 +1,330 @@
+int village_map_width_chunks = 64;
+int village_map_height_chunks = 64;
+int village_map_chunk_tiles = 16;
+int village_map_num_chunks = 16;
+
+const uint16_t village_map_chunk_index[] = {
+  0, 1, 2, 3, 2, 3, 4, 5, 6, 7, 2, 3, 0, 1, 6, 7, 0, 1, 6, 7, 4, 5, 2, 3, 4, 5, 6, 7, 2, 3, 4, 5, 2, 3, 0, 1, 0, 1, 4, 5, 4, 5, 0, 1, 4, 5, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 6, 7, 4, 5, 2, 3, 2, 3,
+  8, 9, 10, 11, 10, 11, 12, 13, 14, 15, 10, 11, 8, 9, 14, 15, 8, 9, 14, 15, 12, 13, 10, 11, 12, 13, 14, 15, 10, 11, 12, 13, 10, 11, 8, 9, 8, 9, 12, 13, 12, 13, 8, 9, 12, 13, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 14, 15, 12, 13, 10, 11, 10, 11,
+  0, 1, 0, 1, 4, 5, 0, 1, 6, 7, 6, 7, 6, 7, 2, 3, 4, 5, 0, 1, 2, 3, 0, 1, 4, 5, 6, 7, 0, 1, 0, 1, 4, 5, 6, 7, 4, 5, 2, 3, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 2, 3, 2, 3, 0, 1, 2, 3, 6, 7, 6, 7, 4, 5,
+  8, 9, 8, 9, 12, 13, 8, 9, 14, 15, 14, 15, 14, 15, 10, 11, 12, 13, 8, 9, 10, 11, 8, 9, 12, 13, 14, 15, 8, 9, 8, 9, 12, 13, 14, 15, 12, 13, 10, 11, 10, 11, 12, 13, 8, 9, 10, 11, 12, 13, 10, 11, 10, 11, 8, 9, 10, 11, 14, 15, 14, 15, 12, 13,
+  0, 1, 4, 5, 6, 7, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 0, 1, 4, 5, 2, 3, 2, 3, 2, 3, 0, 1, 4, 5, 0, 1, 2, 3, 6, 7, 6, 7, 0, 1, 6, 7, 4, 5, 4, 5, 4, 5,
+  8, 9, 12, 13, 14, 15, 8, 9, 10, 11, 10, 11, 8, 9, 8, 9, 8, 9, 10, 11, 12, 13, 8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 8, 9, 12, 13, 10, 11, 10, 11, 10, 11, 8, 9, 12, 13, 8, 9, 10, 11, 14, 15, 14, 15, 8, 9, 14, 15, 12, 13, 12, 13, 12, 13,
+  4, 5, 4, 5, 4, 5, 6, 7, 4, 5, 2, 3, 6, 7, 4, 5, 4, 5, 6, 7, 2, 3, 6, 7, 0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 6, 7, 2, 3, 4, 5, 0, 1, 4, 5, 4, 5, 4, 5, 0, 1, 4, 5, 2, 3, 0, 1, 2, 3, 6, 7, 4, 5,
+  12, 13, 12, 13, 12, 13, 14, 15, 12, 13, 10, 11, 14, 15, 12, 13, 12, 13, 14, 15, 10, 11, 14, 15, 8, 9, 8, 9, 10, 11, 10, 11, 8, 9, 8, 9, 14, 15, 10, 11, 12, 13, 8, 9, 12, 13, 12, 13, 12, 13, 8, 9, 12, 13, 10, 11, 8, 9, 10, 11, 14, 15, 12, 13,
+  4, 5, 2, 3, 6, 7, 2, 3, 6, 7, 0, 1, 2, 3, 0, 1, 4, 5, 2, 3, 0, 1, 6, 7, 6, 7, 4, 5, 4, 5, 0, 1, 0, 1, 2, 3, 0, 1, 6, 7, 0, 1, 4, 5, 0, 1, 4, 5, 6, 7, 4, 5, 2, 3, 2, 3, 6, 7, 2, 3, 6, 7, 6, 7,
+  12, 13, 10, 11, 14, 15, 10, 11, 14, 15, 8, 9, 10, 11, 8, 9, 12, 13, 10, 11, 8, 9, 14, 15, 14, 15, 12, 13, 12, 13, 8, 9, 8, 9, 10, 11, 8, 9, 14, 15, 8, 9, 12, 13, 8, 9, 12, 13, 14, 15, 12, 13, 10, 11, 10, 11, 14, 15, 10, 11, 14, 15, 14, 15,
+  2, 3, 6, 7, 4, 5, 2, 3, 0, 1, 6, 7, 6, 7, 6, 7, 2, 3, 0, 1, 0, 1, 0, 1, 0, 1, 6, 7, 2, 3, 6, 7, 6, 7, 6, 7, 0, 1, 6, 7, 4, 5, 0, 1, 4, 5, 0, 1, 2, 3, 6, 7, 6, 7, 0, 1, 6, 7, 2, 3, 6, 7, 2, 3,
+  10, 11, 14, 15, 12, 13, 10, 11, 8, 9, 14, 15, 14, 15, 14, 15, 10, 11, 8, 9, 8, 9, 8, 9, 8, 9, 14, 15, 10, 11, 14, 15, 14, 15, 14, 15, 8, 9, 14, 15, 12, 13, 8, 9, 12, 13, 8, 9, 10, 11, 14, 15, 14, 15, 8, 9, 14, 15, 10, 11, 14, 15, 10, 11,
+  6, 7, 2, 3, 2, 3, 4, 5, 0, 1, 6, 7, 6, 7, 4, 5, 2, 3, 0, 1, 2, 3, 0, 1, 4, 5, 6, 7, 6, 7, 6, 7, 6, 7, 2, 3, 0, 1, 6, 7, 2, 3, 0, 1, 2, 3, 2, 3, 0, 1, 4, 5, 6, 7, 0, 1, 4, 5, 4, 5, 6, 7, 4, 5,
+  14, 15, 10, 11, 10, 11, 12, 13, 8, 9, 14, 15, 14, 15, 12, 13, 10, 11, 8, 9, 10, 11, 8, 9, 12, 13, 14, 15, 14, 15, 14, 15, 14, 15, 10, 11, 8, 9, 14, 15, 10, 11, 8, 9, 10, 11, 10, 11, 8, 9, 12, 13, 14, 15, 8, 9, 12, 13, 12, 13, 14, 15, 12, 13,
+  0, 1, 6, 7, 6, 7, 0, 1, 6, 7, 4, 5, 4, 5, 4, 5, 0, 1, 6, 7, 2, 3, 2, 3, 0, 1, 6, 7, 4, 5, 0, 1, 0, 1, 6, 7, 0, 1, 6, 7, 2, 3, 2, 3, 0, 1, 6, 7, 0, 1, 0, 1, 0, 1, 2, 3, 6, 7, 0, 1, 0, 1, 2, 3,
+  8, 9, 14, 15, 14, 15, 8, 9, 14, 15, 12, 13, 12, 13, 12, 13, 8, 9, 14, 15, 10, 11, 10, 11, 8, 9, 14, 15, 12, 13, 8, 9, 8, 9, 14, 15, 8, 9, 14, 15, 10, 11, 10, 11, 8, 9, 14, 15, 8, 9, 8, 9, 8, 9, 10, 11, 14, 15, 8, 9, 8, 9, 10, 11,
+  4, 5, 2, 3, 6, 7, 6, 7, 2, 3, 4, 5, 2, 3, 4, 5, 0, 1, 6, 7, 6, 7, 2, 3, 0, 1, 6, 7, 0, 1, 2, 3, 0, 1, 6, 7, 6, 7, 6, 7, 4, 5, 4, 5, 2, 3, 6, 7, 2, 3, 6, 7, 0, 1, 2, 3, 6, 7, 2, 3, 2, 3, 6, 7,
+  12, 13, 10, 11, 14, 15, 14, 15, 10, 11, 12, 13, 10, 11, 12, 13, 8, 9, 14, 15, 14, 15, 10, 11, 8, 9, 14, 15, 8, 9, 10, 11, 8, 9, 14, 15, 14, 15, 14, 15, 12, 13, 12, 13, 10, 11, 14, 15, 10, 11, 14, 15, 8, 9, 10, 11, 14, 15, 10, 11, 10, 11, 14, 15,
+  6, 7, 0, 1, 6, 7, 2, 3, 0, 1, 2, 3, 2, 3, 6, 7, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 2, 3, 6, 7, 4, 5, 4, 5, 4, 5, 2, 3, 6, 7, 0, 1, 2, 3, 2, 3, 2, 3, 6, 7, 6, 7, 0, 1, 6, 7, 0, 1, 0, 1, 4, 5, 4, 5,
+  14, 15, 8, 9, 14, 15, 10, 11, 8, 9, 10, 11, 10, 11, 14, 15, 10, 11, 8, 9, 10, 11, 8, 9, 10, 11, 10, 11, 14, 15, 12, 13, 12, 13, 12, 13, 10, 11, 14, 15, 8, 9, 10, 11, 10, 11, 10, 11, 14, 15, 14, 15, 8, 9, 14, 15, 8, 9, 8, 9, 12, 13, 12, 13,
+  4, 5, 4, 5, 6, 7, 4, 5, 0, 1, 0, 1, 4, 5, 0, 1, 6, 7, 0, 1, 2, 3, 6, 7, 0, 1, 0, 1, 6, 7, 0, 1, 2, 3, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 4, 5, 0, 1, 4, 5, 6, 7, 6, 7, 6, 7, 2, 3, 4, 5, 0, 1, 4, 5,
+  12, 13, 12, 13, 14, 15, 12, 13, 8, 9, 8, 9, 12, 13, 8, 9, 14, 15, 8, 9, 10, 11, 14, 15, 8, 9, 8, 9, 14, 15, 8, 9, 10, 11, 10, 11, 12, 13, 14, 15, 12, 13, 14, 15, 12, 13, 8, 9, 12, 13, 14, 15, 14, 15, 14, 15, 10, 11, 12, 13, 8, 9, 12, 13,
+  6, 7, 0, 1, 6, 7, 0, 1, 4, 5, 0, 1, 2, 3, 4, 5, 2, 3, 2, 3, 4, 5, 4, 5, 0, 1, 2, 3, 0, 1, 4, 5, 6, 7, 4, 5, 6, 7, 2, 3, 2, 3, 6, 7, 6, 7, 4, 5, 2, 3, 0, 1, 6, 7, 0, 1, 4, 5, 2, 3, 0, 1, 4, 5,
+  14, 15, 8, 9, 14, 15, 8, 9, 12, 13, 8, 9, 10, 11, 12, 13, 10, 11, 10, 11, 12, 13, 12, 13, 8, 9, 10, 11, 8, 9, 12, 13, 14, 15, 12, 13, 14, 15, 10, 11, 10, 11, 14, 15, 14, 15, 12, 13, 10, 11, 8, 9, 14, 15, 8, 9, 12, 13, 10, 11, 8, 9, 12, 13,
+  4, 5, 4, 5, 2, 3, 2, 3, 0, 1, 4, 5, 2, 3, 0, 1, 2, 3, 6, 7, 0, 1, 0, 1, 4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 6, 7, 2, 3, 2, 3, 2, 3, 0, 1, 6, 7, 0, 1, 4, 5, 0, 1, 4, 5, 0, 1, 2, 3, 2, 3, 4, 5, 2, 3,
+  12, 13, 12, 13, 10, 11, 10, 11, 8, 9, 12, 13, 10, 11, 8, 9, 10, 11, 14, 15, 8, 9, 8, 9, 12, 13, 14, 15, 12, 13, 14, 15, 8, 9, 14, 15, 10, 11, 10, 11, 10, 11, 8, 9, 14, 15, 8, 9, 12, 13, 8, 9, 12, 13, 8, 9, 10, 11, 10, 11, 12, 13, 10, 11,
+  6, 7, 4, 5, 4, 5, 4, 5, 2, 3, 6, 7, 0, 1, 2, 3, 4, 5, 2, 3, 2, 3, 2, 3, 6, 7, 0, 1, 6, 7, 2, 3, 4, 5, 6, 7, 6, 7, 2, 3, 4, 5, 2, 3, 2, 3, 6, 7, 2, 3, 2, 3, 0, 1, 4, 5, 6, 7, 4, 5, 2, 3, 0, 1,
+  14, 15, 12, 13, 12, 13, 12, 13, 10, 11, 14, 15, 8, 9, 10, 11, 12, 13, 10, 11, 10, 11, 10, 11, 14, 15, 8, 9, 14, 15, 10, 11, 12, 13, 14, 15, 14, 15, 10, 11, 12, 13, 10, 11, 10, 11, 14, 15, 10, 11, 10, 11, 8, 9, 12, 13, 14, 15, 12, 13, 10, 11, 8, 9,
+  4, 5, 6, 7, 0, 1, 0, 1, 0, 1, 6, 7, 2, 3, 6, 7, 6, 7, 0, 1, 4, 5, 4, 5, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 4, 5, 4, 5, 4, 5, 6, 7, 2, 3, 6, 7, 4, 5, 2, 3, 0, 1, 4, 5, 4, 5, 2, 3, 0, 1, 0, 1, 6, 7,
+  12, 13, 14, 15, 8, 9, 8, 9, 8, 9, 14, 15, 10, 11, 14, 15, 14, 15, 8, 9, 12, 13, 12, 13, 10, 11, 8, 9, 10, 11, 12, 13, 14, 15, 12, 13, 12, 13, 12, 13, 14, 15, 10, 11, 14, 15, 12, 13, 10, 11, 8, 9, 12, 13, 12, 13, 10, 11, 8, 9, 8, 9, 14, 15,
+  0, 1, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 2, 3, 6, 7, 2, 3, 6, 7, 2, 3, 2, 3, 2, 3, 6, 7, 4, 5, 2, 3, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 0, 1, 4, 5, 6, 7, 2, 3, 0, 1, 2, 3, 2, 3, 2, 3, 6, 7, 6, 7,
+  8, 9, 8, 9, 10, 11, 10, 11, 12, 13, 12, 13, 10, 11, 14, 15, 10, 11, 14, 15, 10, 11, 10, 11, 10, 11, 14, 15, 12, 13, 10, 11, 8, 9, 10, 11, 10, 11, 12, 13, 12, 13, 14, 15, 8, 9, 12, 13, 14, 15, 10, 11, 8, 9, 10, 11, 10, 11, 10, 11, 14, 15, 14, 15,
+  6, 7, 6, 7, 0, 1, 4, 5, 4, 5, 0, 1, 0, 1, 2, 3, 0, 1, 6, 7, 4, 5, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 2, 3, 2, 3, 6, 7, 4, 5, 4, 5, 2, 3, 6, 7, 4, 5, 6, 7, 4, 5, 4, 5, 4, 5, 6, 7, 0, 1, 6, 7, 0, 1,
+  14, 15, 14, 15, 8, 9, 12, 13, 12, 13, 8, 9, 8, 9, 10, 11, 8, 9, 14, 15, 12, 13, 10, 11, 8, 9, 10, 11, 12, 13, 14, 15, 10, 11, 10, 11, 14, 15, 12, 13, 12, 13, 10, 11, 14, 15, 12, 13, 14, 15, 12, 13, 12, 13, 12, 13, 14, 15, 8, 9, 14, 15, 8, 9,
+  2, 3, 4, 5, 2, 3, 6, 7, 0, 1, 0, 1, 2, 3, 0, 1, 0, 1, 6, 7, 4, 5, 6, 7, 6, 7, 4, 5, 2, 3, 4, 5, 0, 1, 6, 7, 6, 7, 0, 1, 4, 5, 2, 3, 0, 1, 6, 7, 4, 5, 0, 1, 6, 7, 2, 3, 2, 3, 4, 5, 6, 7, 2, 3,
+  10, 11, 12, 13, 10, 11, 14, 15, 8, 9, 8, 9, 10, 11, 8, 9, 8, 9, 14, 15, 12, 13, 14, 15, 14, 15, 12, 13, 10, 11, 12, 13, 8, 9, 14, 15, 14, 15, 8, 9, 12, 13, 10, 11, 8, 9, 14, 15, 12, 13, 8, 9, 14, 15, 10, 11, 10, 11, 12, 13, 14, 15, 10, 11,
+  4, 5, 4, 5, 6, 7, 2, 3, 6, 7, 2, 3, 2, 3, 4, 5, 2, 3, 6, 7, 0, 1, 2, 3, 6, 7, 6, 7, 6, 7, 4, 5, 6, 7, 0, 1, 0, 1, 6, 7, 0, 1, 6, 7, 4, 5, 0, 1, 4, 5, 6, 7, 6, 7, 4, 5, 4, 5, 4, 5, 6, 7, 4, 5,
+  12, 13, 12, 13, 14, 15, 10, 11, 14, 15, 10, 11, 10, 11, 12, 13, 10, 11, 14, 15, 8, 9, 10, 11, 14, 15, 14, 15, 14, 15, 12, 13, 14, 15, 8, 9, 8, 9, 14, 15, 8, 9, 14, 15, 12, 13, 8, 9, 12, 13, 14, 15, 14, 15, 12, 13, 12, 13, 12, 13, 14, 15, 12, 13,
+  4, 5, 6, 7, 0, 1, 0, 1, 0, 1, 4, 5, 4, 5, 0, 1, 2, 3, 0, 1, 6, 7, 6, 7, 0, 1, 0, 1, 2, 3, 4, 5, 4, 5, 2, 3, 0, 1, 6, 7, 2, 3, 2, 3, 0, 1, 0, 1, 6, 7, 6, 7, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 0, 1,
+  12, 13, 14, 15, 8, 9, 8, 9, 8, 9, 12, 13, 12, 13, 8, 9, 10, 11, 8, 9, 14, 15, 14, 15, 8, 9, 8, 9, 10, 11, 12, 13, 12, 13, 10, 11, 8, 9, 14, 15, 10, 11, 10, 11, 8, 9, 8, 9, 14, 15, 14, 15, 8, 9, 10, 11, 10, 11, 12, 13, 12, 13, 8, 9,
+  0, 1, 0, 1, 4, 5, 2, 3, 4, 5, 4, 5, 2, 3, 6, 7, 0, 1, 4, 5, 4, 5, 2, 3, 2, 3, 4, 5, 0, 1, 2, 3, 0, 1, 6, 7, 6, 7, 2, 3, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 0, 1, 0, 1, 4, 5, 0, 1, 4, 5, 6, 7, 4, 5,
+  8, 9, 8, 9, 12, 13, 10, 11, 12, 13, 12, 13, 10, 11, 14, 15, 8, 9, 12, 13, 12, 13, 10, 11, 10, 11, 12, 13, 8, 9, 10, 11, 8, 9, 14, 15, 14, 15, 10, 11, 8, 9, 10, 11, 10, 11, 8, 9, 8, 9, 8, 9, 8, 9, 12, 13, 8, 9, 12, 13, 14, 15, 12, 13,
+  0, 1, 6, 7, 4, 5, 0, 1, 4, 5, 6, 7, 2, 3, 4, 5, 4, 5, 6, 7, 0, 1, 6, 7, 2, 3, 4, 5, 0, 1, 0, 1, 6, 7, 6, 7, 2, 3, 4, 5, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 4, 5, 4, 5, 2, 3, 6, 7, 0, 1, 2, 3, 6, 7,
+  8, 9, 14, 15, 12, 13, 8, 9, 12, 13, 14, 15, 10, 11, 12, 13, 12, 13, 14, 15, 8, 9, 14, 15, 10, 11, 12, 13, 8, 9, 8, 9, 14, 15, 14, 15, 10, 11, 12, 13, 8, 9, 8, 9, 10, 11, 10, 11, 10, 11, 12, 13, 12, 13, 10, 11, 14, 15, 8, 9, 10, 11, 14, 15,
+  0, 1, 4, 5, 2, 3, 6, 7, 0, 1, 6, 7, 4, 5, 4, 5, 0, 1, 4, 5, 4, 5, 2, 3, 2, 3, 4, 5, 0, 1, 6, 7, 2, 3, 4, 5, 4, 5, 0, 1, 0, 1, 6, 7, 4, 5, 6, 7, 6, 7, 2, 3, 6, 7, 4, 5, 6, 7, 2, 3, 2, 3, 4, 5,
+  8, 9, 12, 13, 10, 11, 14, 15, 8, 9, 14, 15, 12, 13, 12, 13, 8, 9, 12, 13, 12, 13, 10, 11, 10, 11, 12, 13, 8, 9, 14, 15, 10, 11, 12, 13, 12, 13, 8, 9, 8, 9, 14, 15, 12, 13, 14, 15, 14, 15, 10, 11, 14, 15, 12, 13, 14, 15, 10, 11, 10, 11, 12, 13,
+  0, 1, 4, 5, 4, 5, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 4, 5, 0, 1, 6, 7, 6, 7, 0, 1, 0, 1, 4, 5, 6, 7, 4, 5, 4, 5, 0, 1, 6, 7, 6, 7, 0, 1, 6, 7, 6, 7, 2, 3, 0, 1, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5,
+  8, 9, 12, 13, 12, 13, 12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 12, 13, 8, 9, 14, 15, 14, 15, 8, 9, 8, 9, 12, 13, 14, 15, 12, 13, 12, 13, 8, 9, 14, 15, 14, 15, 8, 9, 14, 15, 14, 15, 10, 11, 8, 9, 8, 9, 10, 11, 12, 13, 8, 9, 10, 11, 12, 13,
+  0, 1, 0, 1, 4, 5, 6, 7, 0, 1, 2, 3, 6, 7, 6, 7, 0, 1, 6, 7, 6, 7, 2, 3, 6, 7, 2, 3, 6, 7, 0, 1, 4, 5, 0, 1, 6, 7, 2, 3, 4, 5, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 4, 5,
+  8, 9, 8, 9, 12, 13, 14, 15, 8, 9, 10, 11, 14, 15, 14, 15, 8, 9, 14, 15, 14, 15, 10, 11, 14, 15, 10, 11, 14, 15, 8, 9, 12, 13, 8, 9, 14, 15, 10, 11, 12, 13, 10, 11, 8, 9, 10, 11, 8, 9, 10, 11, 10, 11, 12, 13, 14, 15, 12, 13, 14, 15, 12, 13,
+  4, 5, 4, 5, 0, 1, 4, 5, 4, 5, 2, 3, 4, 5, 4, 5, 4, 5, 2, 3, 4, 5, 2, 3, 0, 1, 0, 1, 4, 5, 2, 3, 0, 1, 2, 3, 4, 5, 4, 5, 2, 3, 2, 3, 6, 7, 6, 7, 6, 7, 4, 5, 4, 5, 4, 5, 6, 7, 2, 3, 0, 1, 2, 3,
+  12, 13, 12, 13, 8, 9, 12, 13, 12, 13, 10, 11, 12, 13, 12, 13, 12, 13, 10, 11, 12, 13, 10, 11, 8, 9, 8, 9, 12, 13, 10, 11, 8, 9, 10, 11, 12, 13, 12, 13, 10, 11, 10, 11, 14, 15, 14, 15, 14, 15, 12, 13, 12, 13, 12, 13, 14, 15, 10, 11, 8, 9, 10, 11,
+  2, 3, 4, 5, 6, 7, 6, 7, 4, 5, 6, 7, 6, 7, 4, 5, 0, 1, 2, 3, 4, 5, 4, 5, 4, 5, 4, 5, 0, 1, 4, 5, 0, 1, 4, 5, 2, 3, 0, 1, 6, 7, 6, 7, 4, 5, 0, 1, 4, 5, 0, 1, 6, 7, 0, 1, 0, 1, 2, 3, 6, 7, 4, 5,
+  10, 11, 12, 13, 14, 15, 14, 15, 12, 13, 14, 15, 14, 15, 12, 13, 8, 9, 10, 11, 12, 13, 12, 13, 12, 13, 12, 13, 8, 9, 12, 13, 8, 9, 12, 13, 10, 11, 8, 9, 14, 15, 14, 15, 12, 13, 8, 9, 12, 13, 8, 9, 14, 15, 8, 9, 8, 9, 10, 11, 14, 15, 12, 13,
+  2, 3, 6, 7, 2, 3, 0, 1, 0, 1, 2, 3, 6, 7, 0, 1, 2, 3, 2, 3, 2, 3, 4, 5, 0, 1, 2, 3, 0, 1, 4, 5, 0, 1, 6, 7, 0, 1, 6, 7, 6, 7, 4, 5, 4, 5, 0, 1, 0, 1, 6, 7, 2, 3, 0, 1, 6, 7, 4, 5, 2, 3, 0, 1,
+  10, 11, 14, 15, 10, 11, 8, 9, 8, 9, 10, 11, 14, 15, 8, 9, 10, 11, 10, 11, 10, 11, 12, 13, 8, 9, 10, 11, 8, 9, 12, 13, 8, 9, 14, 15, 8, 9, 14, 15, 14, 15, 12, 13, 12, 13, 8, 9, 8, 9, 14, 15, 10, 11, 8, 9, 14, 15, 12, 13, 10, 11, 8, 9,
+  0, 1, 6, 7, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 6, 7, 4, 5, 0, 1, 0, 1, 2, 3, 0, 1, 4, 5, 0, 1, 0, 1, 4, 5, 2, 3, 4, 5, 4, 5, 4, 5, 6, 7, 2, 3, 6, 7, 6, 7, 6, 7, 2, 3, 0, 1, 4, 5, 0, 1,
+  8, 9, 14, 15, 8, 9, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 14, 15, 12, 13, 8, 9, 8, 9, 10, 11, 8, 9, 12, 13, 8, 9, 8, 9, 12, 13, 10, 11, 12, 13, 12, 13, 12, 13, 14, 15, 10, 11, 14, 15, 14, 15, 14, 15, 10, 11, 8, 9, 12, 13, 8, 9,
+  4, 5, 2, 3, 2, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 0, 1, 4, 5, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 2, 3, 0, 1, 0, 1, 2, 3, 6, 7, 0, 1, 2, 3, 0, 1, 4, 5, 6, 7, 6, 7, 6, 7, 2, 3, 4, 5,
+  12, 13, 10, 11, 10, 11, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 10, 11, 8, 9, 12, 13, 10, 11, 12, 13, 14, 15, 12, 13, 14, 15, 10, 11, 8, 9, 8, 9, 10, 11, 14, 15, 8, 9, 10, 11, 8, 9, 12, 13, 14, 15, 14, 15, 14, 15, 10, 11, 12, 13,
+  2, 3, 6, 7, 6, 7, 2, 3, 0, 1, 6, 7, 0, 1, 0, 1, 0, 1, 2, 3, 0, 1, 6, 7, 6, 7, 4, 5, 6, 7, 2, 3, 4, 5, 4, 5, 2, 3, 6, 7, 4, 5, 4, 5, 6, 7, 4, 5, 4, 5, 4, 5, 4, 5, 2, 3, 0, 1, 4, 5, 6, 7, 6, 7,
+  10, 11, 14, 15, 14, 15, 10, 11, 8, 9, 14, 15, 8, 9, 8, 9, 8, 9, 10, 11, 8, 9, 14, 15, 14, 15, 12, 13, 14, 15, 10, 11, 12, 13, 12, 13, 10, 11, 14, 15, 12, 13, 12, 13, 14, 15, 12, 13, 12, 13, 12, 13, 12, 13, 10, 11, 8, 9, 12, 13, 14, 15, 14, 15,
+  0, 1, 6, 7, 4, 5, 6, 7, 0, 1, 6, 7, 6, 7, 6, 7, 6, 7, 0, 1, 0, 1, 6, 7, 2, 3, 0, 1, 4, 5, 4, 5, 2, 3, 0, 1, 2, 3, 4, 5, 4, 5, 4, 5, 2, 3, 0, 1, 4, 5, 2, 3, 6, 7, 2, 3, 6, 7, 2, 3, 4, 5, 2, 3,
+  8, 9, 14, 15, 12, 13, 14, 15, 8, 9, 14, 15, 14, 15, 14, 15, 14, 15, 8, 9, 8, 9, 14, 15, 10, 11, 8, 9, 12, 13, 12, 13, 10, 11, 8, 9, 10, 11, 12, 13, 12, 13, 12, 13, 10, 11, 8, 9, 12, 13, 10, 11, 14, 15, 10, 11, 14, 15, 10, 11, 12, 13, 10, 11,
+};
+
+const uint16_t village_map_chunks[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 18, 37, 17, 20, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 62, 63, 48, 49, 62, 63, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 78, 79, 64, 65, 78, 79, 0,
+  0, 0, 0, 0, 21, 34, 16, 33, 0, 94, 95, 0, 0, 94, 95, 15,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 32, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 34, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  0, 0, 0, 0, 0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 20, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 24,
+  0, 7, 8, 8, 9, 0, 0, 0, 32, 31, 0, 31, 0, 23, 24, 24,
+  0, 23, 24, 24, 25, 0, 18, 37, 17, 47, 110, 47, 0, 23, 24, 24,
+  0, 23, 24, 24, 25, 0, 34, 3, 1, 31, 110, 31, 0, 23, 24, 24,
+  0, 23, 24, 24, 25, 0, 34, 33, 0, 47, 0, 47, 0, 23, 24, 24,
+  0, 39, 40, 40, 41, 0, 34, 33, 0, 0, 21, 0, 0, 23, 24, 24,
+  0, 0, 0, 0, 0, 0, 34, 33, 0, 0, 0, 0, 32, 23, 24, 24,
+  36, 36, 36, 36, 36, 36, 38, 35, 36, 36, 36, 36, 17, 23, 24, 24,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 33, 23, 24, 24,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 23, 24, 24,
+  0, 0, 0, 0, 10, 11, 12, 11, 12, 11, 12, 13, 14, 23, 24, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 18, 37, 17, 20, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 62, 63, 48, 49, 62, 63, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 78, 79, 64, 65, 78, 79, 0,
+  0, 0, 0, 0, 21, 34, 16, 33, 0, 94, 95, 0, 0, 94, 95, 15,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 32, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 34, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  0, 0, 0, 0, 0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 20, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 50, 51, 52, 53, 0, 54, 55,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 66, 67, 68, 69, 15, 70, 71,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 82, 83, 84, 85, 0, 86, 87,
+  0, 0, 0, 0, 0, 34, 16, 33, 32, 98, 99, 100, 101, 111, 102, 103,
+  0, 0, 0, 0, 0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 24,
+  0, 7, 8, 8, 9, 0, 0, 0, 32, 31, 0, 31, 0, 23, 24, 24,
+  0, 23, 24, 24, 25, 0, 18, 37, 17, 47, 110, 47, 0, 23, 24, 24,
+  0, 23, 24, 24, 25, 0, 34, 3, 1, 31, 110, 31, 0, 23, 24, 24,
+  0, 23, 24, 24, 25, 0, 34, 33, 0, 47, 0, 47, 0, 23, 24, 24,
+  0, 39, 40, 40, 41, 0, 34, 33, 0, 0, 21, 0, 0, 23, 24, 24,
+  0, 0, 0, 0, 0, 0, 34, 33, 0, 0, 0, 0, 32, 23, 24, 24,
+  36, 36, 36, 36, 36, 36, 38, 35, 36, 36, 36, 36, 17, 23, 24, 24,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 33, 23, 24, 24,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 23, 24, 24,
+  0, 0, 0, 0, 10, 11, 12, 11, 12, 11, 12, 13, 14, 23, 24, 24,
+  56, 57, 58, 0, 26, 27, 28, 27, 28, 27, 28, 29, 30, 23, 24, 24,
+  72, 73, 74, 0, 42, 43, 44, 43, 44, 43, 44, 45, 46, 23, 24, 24,
+  88, 89, 90, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 23, 24, 24,
+  104, 105, 106, 0, 0, 15, 0, 20, 0, 0, 0, 0, 0, 39, 40, 40,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 18, 37, 17, 20, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 8,
+  0, 34, 16, 33, 0, 62, 63, 48, 49, 62, 63, 0, 0, 23, 24, 24,
+  0, 34, 16, 33, 0, 78, 79, 64, 65, 78, 79, 0, 0, 23, 24, 24,
+  21, 34, 16, 33, 0, 94, 95, 0, 0, 94, 95, 15, 0, 23, 24, 24,
+  0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 40,
+  0, 34, 16, 33, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 34, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  20, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 24, 0, 0, 0, 0,
+  9, 0, 0, 0, 32, 31, 0, 31, 0, 23, 24, 24, 0, 0, 0, 0,
+  25, 0, 18, 37, 17, 47, 110, 47, 0, 23, 24, 24, 0, 0, 0, 0,
+  25, 0, 34, 3, 1, 31, 110, 31, 0, 23, 24, 24, 0, 0, 0, 0,
+  25, 0, 34, 33, 0, 47, 0, 47, 0, 23, 24, 24, 0, 0, 0, 0,
+  41, 0, 34, 33, 0, 0, 21, 0, 0, 23, 24, 24, 0, 0, 0, 0,
+  0, 0, 34, 33, 0, 0, 0, 0, 32, 23, 24, 24, 0, 0, 0, 0,
+  36, 36, 38, 35, 36, 36, 36, 36, 17, 23, 24, 24, 0, 0, 0, 0,
+  16, 16, 16, 16, 16, 16, 16, 16, 33, 23, 24, 24, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 1, 23, 24, 24, 0, 0, 0, 0,
+  10, 11, 12, 11, 12, 11, 12, 13, 14, 23, 24, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 18, 37, 17, 20, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 8,
+  0, 34, 16, 33, 0, 62, 63, 48, 49, 62, 63, 0, 0, 23, 24, 24,
+  0, 34, 16, 33, 0, 78, 79, 64, 65, 78, 79, 0, 0, 23, 24, 24,
+  21, 34, 16, 33, 0, 94, 95, 0, 0, 94, 95, 15, 0, 23, 24, 24,
+  0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 40,
+  0, 34, 16, 33, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 34, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  20, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 33, 0, 50, 51, 52, 53, 0, 54, 55, 56, 57, 58, 0,
+  0, 34, 16, 33, 0, 66, 67, 68, 69, 15, 70, 71, 72, 73, 74, 0,
+  0, 34, 16, 33, 0, 82, 83, 84, 85, 0, 86, 87, 88, 89, 90, 0,
+  0, 34, 16, 33, 32, 98, 99, 100, 101, 111, 102, 103, 104, 105, 106, 0,
+  0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 24, 0, 0, 0, 0,
+  9, 0, 0, 0, 32, 31, 0, 31, 0, 23, 24, 24, 0, 0, 0, 0,
+  25, 0, 18, 37, 17, 47, 110, 47, 0, 23, 24, 24, 0, 0, 0, 0,
+  25, 0, 34, 3, 1, 31, 110, 31, 0, 23, 24, 24, 0, 0, 0, 0,
+  25, 0, 34, 33, 0, 47, 0, 47, 0, 23, 24, 24, 0, 0, 0, 0,
+  41, 0, 34, 33, 0, 0, 21, 0, 0, 23, 24, 24, 0, 0, 0, 0,
+  0, 0, 34, 33, 0, 0, 0, 0, 32, 23, 24, 24, 0, 0, 0, 0,
+  36, 36, 38, 35, 36, 36, 36, 36, 17, 23, 24, 24, 0, 0, 0, 0,
+  16, 16, 16, 16, 16, 16, 16, 16, 33, 23, 24, 24, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 1, 23, 24, 24, 0, 0, 0, 0,
+  10, 11, 12, 11, 12, 11, 12, 13, 14, 23, 24, 24, 0, 0, 0, 0,
+  26, 27, 28, 27, 28, 27, 28, 29, 30, 23, 24, 24, 0, 0, 0, 0,
+  42, 43, 44, 43, 44, 43, 44, 45, 46, 23, 24, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 0, 0, 0, 23, 24, 24, 0, 0, 0, 0,
+  0, 15, 0, 20, 0, 0, 0, 0, 0, 39, 40, 40, 0, 0, 0, 0,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 50, 51, 52, 53, 0, 54, 55,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 66, 67, 68, 69, 15, 70, 71,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 82, 83, 84, 85, 0, 86, 87,
+  0, 0, 0, 0, 0, 34, 16, 33, 32, 98, 99, 100, 101, 111, 102, 103,
+  0, 0, 0, 0, 0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 80, 81, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 96, 97, 0, 48,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 64,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 59, 60, 61, 0, 59, 60, 61,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 75, 76, 77, 0, 75, 76, 77,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 91, 92, 93, 0, 91, 92, 93,
+  0, 0, 0, 0, 0, 34, 16, 33, 32, 107, 108, 109, 111, 107, 108, 109,
+  0, 0, 0, 0, 0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+  56, 57, 58, 0, 26, 27, 28, 27, 28, 27, 28, 29, 30, 23, 24, 24,
+  72, 73, 74, 0, 42, 43, 44, 43, 44, 43, 44, 45, 46, 23, 24, 24,
+  88, 89, 90, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 23, 24, 24,
+  104, 105, 106, 0, 0, 15, 0, 20, 0, 0, 0, 0, 0, 39, 40, 40,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 62, 63, 0,
+  49, 15, 0, 0, 0, 0, 80, 81, 0, 0, 0, 0, 0, 78, 79, 0,
+  65, 0, 0, 0, 0, 0, 96, 97, 0, 0, 0, 0, 0, 94, 95, 0,
+  0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61,
+  0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77,
+  0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93,
+  0, 107, 108, 109, 111, 107, 108, 109, 0, 107, 108, 109, 111, 107, 108, 109,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 80, 81, 0, 0,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 96, 97, 0, 48,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 64,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 59, 60, 61, 0, 59, 60, 61,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 75, 76, 77, 0, 75, 76, 77,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 91, 92, 93, 0, 91, 92, 93,
+  0, 0, 0, 0, 0, 34, 16, 33, 32, 107, 108, 109, 111, 107, 108, 109,
+  0, 0, 0, 0, 0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 0, 0, 0, 0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 62, 63, 0,
+  49, 15, 0, 0, 0, 0, 80, 81, 0, 0, 0, 0, 0, 78, 79, 0,
+  65, 0, 0, 0, 0, 0, 96, 97, 0, 0, 0, 0, 0, 94, 95, 0,
+  0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61,
+  0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77,
+  0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93,
+  0, 107, 108, 109, 111, 107, 108, 109, 0, 107, 108, 109, 111, 107, 108, 109,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 33, 0, 50, 51, 52, 53, 0, 54, 55, 56, 57, 58, 0,
+  0, 34, 16, 33, 0, 66, 67, 68, 69, 15, 70, 71, 72, 73, 74, 0,
+  0, 34, 16, 33, 0, 82, 83, 84, 85, 0, 86, 87, 88, 89, 90, 0,
+  0, 34, 16, 33, 32, 98, 99, 100, 101, 111, 102, 103, 104, 105, 106, 0,
+  0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 34, 16, 33, 0, 0, 0, 0, 80, 81, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 33, 0, 0, 0, 0, 96, 97, 0, 48, 49, 15, 0, 0,
+  0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 64, 65, 0, 0, 0,
+  0, 34, 16, 33, 0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61,
+  0, 34, 16, 33, 0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77,
+  0, 34, 16, 33, 0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93,
+  0, 34, 16, 33, 32, 107, 108, 109, 111, 107, 108, 109, 0, 107, 108, 109,
+  0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+  26, 27, 28, 27, 28, 27, 28, 29, 30, 23, 24, 24, 0, 0, 0, 0,
+  42, 43, 44, 43, 44, 43, 44, 45, 46, 23, 24, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 0, 0, 0, 23, 24, 24, 0, 0, 0, 0,
+  0, 15, 0, 20, 0, 0, 0, 0, 0, 39, 40, 40, 0, 0, 0, 0,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 0, 0, 62, 63, 0, 0, 0, 0, 0,
+  0, 0, 80, 81, 0, 0, 0, 0, 0, 78, 79, 0, 0, 0, 0, 0,
+  0, 0, 96, 97, 0, 0, 0, 0, 0, 94, 95, 0, 0, 0, 0, 0,
+  0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61, 0, 0, 0, 0,
+  0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77, 0, 0, 0, 0,
+  0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93, 0, 0, 0, 0,
+  111, 107, 108, 109, 0, 107, 108, 109, 111, 107, 108, 109, 0, 0, 0, 0,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+  0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 34, 16, 33, 0, 0, 0, 0, 80, 81, 0, 0, 0, 0, 0, 0,
+  0, 34, 16, 33, 0, 0, 0, 0, 96, 97, 0, 48, 49, 15, 0, 0,
+  0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 64, 65, 0, 0, 0,
+  0, 34, 16, 33, 0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61,
+  0, 34, 16, 33, 0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77,
+  0, 34, 16, 33, 0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93,
+  0, 34, 16, 33, 32, 107, 108, 109, 111, 107, 108, 109, 0, 107, 108, 109,
+  0, 34, 16, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 34, 16, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  0, 34, 16, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 0, 0, 62, 63, 0, 0, 0, 0, 0,
+  0, 0, 80, 81, 0, 0, 0, 0, 0, 78, 79, 0, 0, 0, 0, 0,
+  0, 0, 96, 97, 0, 0, 0, 0, 0, 94, 95, 0, 0, 0, 0, 0,
+  0, 59, 60, 61, 0, 59, 60, 61, 0, 59, 60, 61, 0, 0, 0, 0,
+  0, 75, 76, 77, 0, 75, 76, 77, 0, 75, 76, 77, 0, 0, 0, 0,
+  0, 91, 92, 93, 0, 91, 92, 93, 0, 91, 92, 93, 0, 0, 0, 0,
+  111, 107, 108, 109, 0, 107, 108, 109, 111, 107, 108, 109, 0, 0, 0, 0,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+  0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
@@ -3,7 +3,7 @@
 
 int num_tiles = 112;
 
-uint16_t tileset[] = {
+const uint16_t __attribute__ ((aligned (4))) tileset[] = {
   0x330e,
   0x372f,
   0x330e,
@@ -0,0 +1,971 @@
+// Art by LimeZu from itch.io (https://limezu.itch.io/serenevillagerevamped)
+// Licensed under CC BY 4.0 (https://creativecommons.org/licenses/by/4.0/)
+
+int tileset_4bpp_count = 112;
+int tileset_4bpp_num_banks = 27;
+
+const uint16_t tileset_4bpp_palette[] = {
+  0x14b3, 0x18db, 0x1cfc, 0x25d6, 0x28e7, 0x2d08, 0x2e18, 0x2e38,
+  0x330e, 0x372f, 0x396a, 0x3abc, 0x3afc, 0x4277, 0x473e, 0x4efa,
+  0x14b3, 0x14b5, 0x18db, 0x1cfc, 0x217f, 0x28e7, 0x2d08, 0x2e38,
+  0x330e, 0x35f3, 0x372f, 0x396a, 0x3abc, 0x3afc, 0x3f1d, 0x4277,
+  0x2175, 0x28e7, 0x2d08, 0x2d68, 0x2e18, 0x2e38, 0x3192, 0x31a9,
+  0x330e, 0x35f3, 0x372f, 0x396a, 0x3abc, 0x3afc, 0x3f1d, 0x4277,
+  0x0e5d, 0x1935, 0x1d76, 0x1f5f, 0x25b8, 0x25d6, 0x28e7, 0x2d08,
+  0x2e18, 0x2e38, 0x396a, 0x3abc, 0x3afc, 0x3f1d, 0x41ad, 0x473e,
+  0x14b3, 0x14b5, 0x18db, 0x1cfc, 0x217f, 0x25b6, 0x25d6, 0x28e7,
+  0x2d08, 0x2e18, 0x2e38, 0x396a, 0x3abc, 0x3afc, 0x3f1d, 0x41ad,
+  0x28e7, 0x2d08, 0x2d68, 0x2e18, 0x2e38, 0x2eae, 0x31a9, 0x322a,
+  0x330e, 0x35f3, 0x372f, 0x396a, 0x3abc, 0x3afc, 0x4277, 0x473e,
+  0x25b6, 0x25d6, 0x26ca, 0x28e7, 0x2d08, 0x2e18, 0x2e38, 0x3192,
+  0x330e, 0x35f3, 0x372f, 0x3abc, 0x3afc, 0x3f1d, 0x4277, 0x4efa,
+  0x2175, 0x25d6, 0x28e7, 0x2d08, 0x2d68, 0x2e18, 0x2e38, 0x2eae,
+  0x31a9, 0x322a, 0x396a, 0x3abc, 0x3afc, 0x3f1d, 0x41ad, 0x473e,
+  0x0e5d, 0x16de, 0x1935, 0x1d76, 0x1f5f, 0x2175, 0x25b8, 0x25d6,
+  0x28e7, 0x2d08, 0x2e18, 0x2e38, 0x396a, 0x3abc, 0x3afc, 0x3f1d,
+  0x2175, 0x25d6, 0x28e7, 0x2d08, 0x2e38, 0x330e, 0x372f, 0x396a,
+  0x3afc, 0x3f1d, 0x4277, 0x473e, 0x4efa, 0x61a8, 0x7249, 0x768a,
+  0x14b3, 0x14b5, 0x18db, 0x1cfc, 0x2175, 0x217f, 0x25b6, 0x25d6,
+  0x28e7, 0x2d08, 0x2e18, 0x2e38, 0x396a, 0x3abc, 0x3f1d, 0x0000,
+  0x0e5d, 0x16de, 0x1935, 0x1d76, 0x1f5f, 0x25b8, 0x25d6, 0x28e7,
+  0x2d08, 0x2e38, 0x396a, 0x3afc, 0x3f1d, 0x41ad, 0x473e, 0x0000,
+  0x25d6, 0x26ca, 0x28e7, 0x2d08, 0x2e18, 0x2e38, 0x3192, 0x330e,
+  0x35f3, 0x372f, 0x396a, 0x3abc, 0x3afc, 0x4277, 0x473e, 0x4efa,
+  0x2175, 0x25d6, 0x26ca, 0x28e7, 0x2d08, 0x2e18, 0x2e38, 0x3192,
+  0x330e, 0x35f3, 0x372f, 0x3abc, 0x3f1d, 0x4277, 0x4efa, 0x0000,
+  0x2313, 0x2357, 0x28e7, 0x2d08, 0x2d68, 0x31a9, 0x322a, 0x330e,
+  0x3556, 0x35ba, 0x372f, 0x396a, 0x3977, 0x4a54, 0x529f, 0x73fe,
+  0x2313, 0x2357, 0x2d08, 0x31a9, 0x322a, 0x330e, 0x372f, 0x396a,
+  0x4a54, 0x735b, 0x768a, 0x77f6, 0x7bfb, 0x7fff, 0x0000, 0x0000,
+  0x2175, 0x25fa, 0x28e7, 0x2d08, 0x2e1b, 0x2ead, 0x330e, 0x369e,
+  0x372f, 0x396a, 0x3f1e, 0x42be, 0x4a54, 0x7fff, 0x0000, 0x0000,
+  0x2175, 0x25d6, 0x28e7, 0x2d08, 0x2e38, 0x330e, 0x372f, 0x396a,
+  0x3afc, 0x3f1d, 0x41ad, 0x61a8, 0x6e08, 0x7249, 0x768a, 0x7f2b,
+  0x2175, 0x25d6, 0x28e7, 0x2d08, 0x2e38, 0x330e, 0x35f3, 0x372f,
+  0x396a, 0x3afc, 0x3f1d, 0x4277, 0x473e, 0x4a54, 0x61a8, 0x7249,
+  0x26ca, 0x28e7, 0x2d08, 0x2e18, 0x3192, 0x330e, 0x35f3, 0x372f,
+  0x396a, 0x3abc, 0x3afc, 0x3f1d, 0x4277, 0x4efa, 0x0000, 0x0000,
+  0x1935, 0x1d76, 0x2175, 0x25b8, 0x25d6, 0x26ca, 0x28e7, 0x2d08,
+  0x2e38, 0x3192, 0x330e, 0x35f3, 0x372f, 0x396a, 0x4277, 0x4efa,
+  0x152d, 0x2313, 0x2357, 0x25d5, 0x26ca, 0x28e7, 0x2d68, 0x2e7a,
+  0x31a9, 0x322a, 0x330e, 0x372f, 0x3f1e, 0x0000, 0x0000, 0x0000,
+  0x28e7, 0x292b, 0x2d08, 0x2ead, 0x31af, 0x330e, 0x372f, 0x396a,
+  0x3a13, 0x3e54, 0x3e96, 0x4af9, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x28e7, 0x2d08, 0x330e, 0x372f, 0x396a, 0x41ad, 0x5631, 0x5a93,
+  0x61a8, 0x7249, 0x768a, 0x7f2b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x14b3, 0x14b5, 0x18db, 0x1cfc, 0x217f, 0x25b6, 0x25d6, 0x28e7,
+  0x2e18, 0x330e, 0x372f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1551, 0x19b7, 0x2239, 0x2679, 0x2a7a, 0x2ead, 0x330e, 0x372f,
+  0x4af9, 0x4e09, 0x6208, 0x6e08, 0x768a, 0x77b7, 0x7b6a, 0x0000,
+  0x0e7c, 0x1eff, 0x26ca, 0x330e, 0x372f, 0x431d, 0x7fd7, 0x7fff,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+const uint8_t tileset_4bpp_banks[] = {
+  0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x1a,
+  0x19, 0x19, 0x19, 0x19, 0x0e, 0x0f, 0x19, 0x19, 0x09, 0x19, 0x0e, 0x0e, 0x0e, 0x0e, 0x15, 0x10,
+  0x12, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x15, 0x15, 0x15, 0x15, 0x15, 0x10,
+  0x16, 0x16, 0x01, 0x01, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x11, 0x17, 0x17, 0x0e, 0x0e,
+  0x16, 0x16, 0x01, 0x0a, 0x18, 0x01, 0x05, 0x07, 0x07, 0x05, 0x05, 0x11, 0x11, 0x17, 0x0e, 0x0e,
+  0x16, 0x16, 0x00, 0x03, 0x04, 0x01, 0x05, 0x07, 0x08, 0x07, 0x02, 0x09, 0x0b, 0x12, 0x15, 0x15,
+  0x16, 0x16, 0x0c, 0x14, 0x06, 0x13, 0x0c, 0x0c, 0x14, 0x0d, 0x0c, 0x0c, 0x14, 0x06, 0x12, 0x12,
+};
+
+const uint8_t __attribute__ ((aligned (4))) tileset_4bpp_data[] = {
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x52, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x65, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x65, 0x67,
+  0x43, 0x48, 0x43, 0x88, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x88, 0x34, 0x34, 0x50, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x12, 0x75, 0x22, 0x32, 0x34, 0x24, 0x55, 0x55, 0x25, 0x65,
+  0x55, 0x25, 0x22, 0x52, 0x76, 0x76, 0x56, 0x76, 0x67, 0x57, 0x55, 0x65, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x25, 0x43, 0x43, 0x43, 0x43, 0x48, 0x43, 0x67, 0x25, 0x34, 0x22, 0x34, 0x34, 0x34, 0x34,
+  0x56, 0x20, 0x43, 0x22, 0x43, 0x43, 0x43, 0x43, 0x57, 0x21, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x56, 0x21, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x24, 0x55, 0x55, 0x25, 0x34,
+  0x76, 0x15, 0x22, 0x52, 0x76, 0x76, 0x56, 0x22, 0x67, 0x57, 0x55, 0x65, 0x67, 0x67, 0x67, 0x55,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x77, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x84, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x23, 0x42, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x24, 0x32, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x22,
+  0x43, 0x43, 0x88, 0x43, 0x43, 0x43, 0x23, 0x55, 0x34, 0x34, 0x88, 0x34, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x65, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x65, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x51, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x02, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x24, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x32, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x32, 0x34, 0x24, 0x55, 0x55, 0x25, 0x34,
+  0x55, 0x25, 0x22, 0x52, 0x76, 0x76, 0x56, 0x22, 0x67, 0x57, 0x55, 0x65, 0x67, 0x67, 0x67, 0x55,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x43, 0x24, 0x32, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x23, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x24, 0x32, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x32, 0x34, 0x24, 0x55, 0x55, 0x25, 0x34,
+  0x55, 0x25, 0x22, 0x52, 0x76, 0x76, 0x56, 0x22, 0x67, 0x57, 0x55, 0x65, 0x67, 0x67, 0x67, 0x55,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x84, 0x88, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x83, 0x88, 0x43, 0x43, 0x42, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x84, 0x38,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x83, 0x48, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x55, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x56, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x67, 0x57, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x56, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x57, 0x34, 0x34, 0x34, 0x34, 0x24, 0x32,
+  0x76, 0x15, 0x43, 0x43, 0x43, 0x43, 0x23, 0x42, 0x57, 0x20, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x47, 0x44, 0x44, 0x44,
+  0x76, 0x76, 0x76, 0x44, 0x14, 0x11, 0x11, 0x11, 0x67, 0x67, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x76, 0x46, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x67, 0x14, 0x11, 0x11, 0x11, 0x11, 0xd4, 0xdd,
+  0x76, 0x11, 0x11, 0x11, 0xd4, 0xed, 0xee, 0xee, 0x47, 0x11, 0x11, 0xd4, 0xed, 0x99, 0x99, 0x99,
+  0x46, 0x11, 0xd1, 0x9e, 0x99, 0x99, 0x99, 0x99, 0x47, 0x11, 0xed, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0x46, 0xd1, 0x9e, 0xa9, 0xba, 0xbb, 0xbb, 0xbb, 0x47, 0xe1, 0x99, 0xba, 0xbb, 0xbb, 0xbb, 0xbb,
+  0x46, 0xed, 0xa9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x47, 0xed, 0xba, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xed, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xed, 0xcb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x44, 0x44, 0x44, 0x64, 0x67, 0x67, 0x67, 0x67,
+  0x11, 0x11, 0x11, 0x41, 0x44, 0x76, 0x76, 0x76, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x67, 0x67,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x74, 0x76, 0xdd, 0x4d, 0x11, 0x11, 0x11, 0x11, 0x41, 0x67,
+  0xee, 0xee, 0xde, 0x4d, 0x11, 0x11, 0x11, 0x76, 0x99, 0x99, 0x99, 0xde, 0x4d, 0x11, 0x11, 0x64,
+  0x99, 0x99, 0x99, 0x99, 0xe9, 0x1d, 0x11, 0x74, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0xde, 0x11, 0x64,
+  0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0xe9, 0x1d, 0x74, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x1e, 0x64,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9a, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xab, 0xde, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbc, 0xde, 0x64,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb7, 0xbb, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xba, 0x66, 0x7b,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xbb, 0xbb, 0x06, 0xb6, 0x7a, 0xba, 0xbb, 0xba, 0x66, 0x06, 0x11, 0xb0,
+  0xa7, 0xb7, 0x66, 0xbb, 0x00, 0x00, 0x11, 0x61, 0x7a, 0xba, 0x16, 0x00, 0x16, 0x11, 0x10, 0x01,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xba, 0xbb, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb7, 0x66, 0xab, 0x7a, 0x7a, 0x7a, 0x7a, 0xbb, 0xbb, 0x06, 0xb6,
+  0xa7, 0xb7, 0xbb, 0xb7, 0x66, 0x06, 0x11, 0xb0, 0x7a, 0xba, 0x66, 0xbb, 0x00, 0x00, 0x11, 0x61,
+  0xa7, 0xb7, 0xb6, 0x0b, 0x16, 0x11, 0x10, 0x01, 0x7a, 0xba, 0x6b, 0x0b, 0x30, 0x13, 0x10, 0x10,
+  0xa7, 0x6b, 0x06, 0xb6, 0x63, 0x36, 0x01, 0x10, 0xbb, 0x06, 0x10, 0x65, 0x06, 0x36, 0x10, 0x01,
+  0x00, 0x00, 0x11, 0x10, 0x01, 0x33, 0x13, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01, 0x60, 0x03, 0x60,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0xba, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xb7, 0x6b, 0xab, 0x37, 0xa3, 0xa7, 0xa7, 0x7a, 0x6b, 0x06, 0xb6, 0x63, 0x36, 0x7a, 0x7a,
+  0xbb, 0x06, 0x10, 0x65, 0x06, 0x36, 0xa7, 0xa7, 0x00, 0x00, 0x11, 0x10, 0x01, 0x33, 0x73, 0x7a,
+  0x11, 0x01, 0x11, 0x11, 0x01, 0xb0, 0xbb, 0xa7, 0x11, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x66, 0x7b,
+  0x01, 0x00, 0x11, 0x10, 0xbb, 0xbb, 0x06, 0xb6, 0x11, 0xb0, 0xbb, 0xb0, 0x66, 0x06, 0x11, 0xb0,
+  0x00, 0xb0, 0x66, 0xbb, 0x00, 0x00, 0x11, 0x61, 0x06, 0xb0, 0x16, 0x00, 0x16, 0x11, 0x10, 0x01,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xba, 0xbb, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb7, 0x66, 0xab, 0x7a, 0x7a, 0x7a, 0x7a, 0xbb, 0xbb, 0x06, 0xb6,
+  0xa7, 0xb7, 0xbb, 0xb7, 0x66, 0x06, 0x11, 0xb0, 0x7a, 0xba, 0x66, 0xbb, 0x00, 0x00, 0x11, 0x61,
+  0xa7, 0xb7, 0xb6, 0x0b, 0x16, 0x11, 0x10, 0x01, 0x7a, 0xba, 0x6b, 0x0b, 0x30, 0x13, 0x10, 0x10,
+  0xa7, 0x6b, 0x06, 0xb6, 0x63, 0x36, 0x01, 0x10, 0xbb, 0x06, 0x10, 0x65, 0x06, 0x36, 0x10, 0x01,
+  0x00, 0x00, 0x11, 0x10, 0x01, 0x33, 0x13, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01, 0x60, 0x03, 0x60,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0xba, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xb7, 0x6b, 0xab, 0x37, 0xa3, 0xa7, 0xa7, 0x7a, 0x6b, 0x06, 0xb6, 0x63, 0x36, 0x7a, 0x7a,
+  0xbb, 0x06, 0x10, 0x65, 0x06, 0x36, 0xa7, 0xa7, 0x00, 0x00, 0x11, 0x10, 0x01, 0x33, 0x73, 0x7a,
+  0x11, 0x01, 0x11, 0x11, 0x01, 0x60, 0xa3, 0xa7, 0x11, 0x00, 0x00, 0x00, 0x01, 0x66, 0x73, 0x7a,
+  0x01, 0x00, 0x11, 0x10, 0x00, 0x33, 0xa7, 0xa7, 0x11, 0x10, 0x11, 0x10, 0x01, 0x46, 0x73, 0x7a,
+  0x00, 0x10, 0x61, 0x00, 0x11, 0x60, 0x24, 0xa7, 0x06, 0x10, 0x66, 0x06, 0x60, 0x66, 0x26, 0x7a,
+  0x43, 0x76, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x66, 0x34, 0x34, 0x34, 0x34, 0x76, 0x34,
+  0x76, 0x51, 0x76, 0x43, 0x43, 0x43, 0x66, 0x43, 0x66, 0x10, 0x66, 0x34, 0x34, 0x76, 0x51, 0x76,
+  0x22, 0x76, 0x22, 0x43, 0x43, 0x66, 0x10, 0x66, 0x34, 0x66, 0x34, 0x34, 0x34, 0x22, 0x76, 0x22,
+  0x43, 0x22, 0x43, 0x43, 0x43, 0x43, 0x66, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x22, 0x34,
+  0x43, 0x63, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x64, 0x36, 0x34, 0x34, 0x64, 0x37, 0x34,
+  0x63, 0x17, 0x65, 0x47, 0x43, 0x63, 0x46, 0x43, 0x64, 0x06, 0x61, 0x36, 0x64, 0x17, 0x65, 0x37,
+  0x23, 0x62, 0x27, 0x42, 0x63, 0x06, 0x61, 0x46, 0x34, 0x64, 0x36, 0x34, 0x24, 0x62, 0x27, 0x32,
+  0x43, 0x23, 0x42, 0x43, 0x43, 0x63, 0x46, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x24, 0x32, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x57, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x05, 0x50, 0x76, 0x76, 0x55, 0x75, 0x76, 0x55, 0x11, 0x11, 0x55, 0x55, 0x10, 0x51, 0x67,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x75, 0x76, 0x11, 0x22, 0x22, 0x11, 0x11, 0x22, 0x65, 0x67,
+  0x22, 0x43, 0x43, 0x22, 0x22, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x22, 0x43, 0x83, 0x48, 0x02, 0x75, 0x34, 0x34, 0x22, 0x34, 0x34, 0x34, 0x14, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x13, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x14, 0x65,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x57, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x05, 0x50, 0x76, 0x76, 0x55, 0x75, 0x76, 0x77, 0x25, 0x11, 0x55, 0x55, 0x00, 0x50, 0x67,
+  0x76, 0x56, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x67, 0x57, 0x22, 0x11, 0x11, 0x22, 0x12, 0x11,
+  0x76, 0x56, 0x43, 0x22, 0x22, 0x43, 0x23, 0x22, 0x67, 0x57, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x15, 0x43, 0x43, 0x43, 0x43, 0x42, 0x43, 0x57, 0x20, 0x34, 0x84, 0x38, 0x34, 0x34, 0x34,
+  0x56, 0x41, 0x43, 0x83, 0x48, 0x43, 0x43, 0x43, 0x57, 0x31, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x53, 0x76, 0x34, 0x34, 0x34, 0x34, 0x84, 0x34, 0x52, 0x67,
+  0x43, 0x22, 0x43, 0x43, 0x83, 0x43, 0x52, 0x76, 0x34, 0x22, 0x34, 0x34, 0x84, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x02, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x12, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x13, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x65, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x38, 0x34, 0x65, 0x67,
+  0x83, 0x48, 0x43, 0x43, 0x43, 0x43, 0x51, 0x76, 0x84, 0x38, 0x34, 0x34, 0x34, 0x34, 0x02, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x13, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x14, 0x65,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xbb, 0xa3, 0x37, 0x33, 0xa7, 0xa7, 0x7a, 0xba, 0x83, 0xb8, 0x83, 0x38, 0x73, 0x7a,
+  0xa7, 0xf3, 0xbe, 0xb8, 0x83, 0xeb, 0x3f, 0xa7, 0x3a, 0xec, 0xc9, 0x3b, 0x33, 0x9c, 0xce, 0x73,
+  0x37, 0x8b, 0xb8, 0xc3, 0xcc, 0xcb, 0xbc, 0xa3, 0x3a, 0xb8, 0xc3, 0x9c, 0x9e, 0x3c, 0xcb, 0x73,
+  0xa7, 0x83, 0xb3, 0xeb, 0xef, 0x3c, 0x3c, 0xa7, 0xda, 0xbb, 0x83, 0x9c, 0x9e, 0x3b, 0xdb, 0x7a,
+  0x37, 0x01, 0x36, 0xc8, 0xcb, 0xb8, 0x35, 0xa7, 0x3a, 0x60, 0x33, 0x33, 0x33, 0xbb, 0x35, 0x7a,
+  0xd7, 0x33, 0x01, 0x36, 0x13, 0x60, 0xd3, 0xa7, 0x7a, 0x3d, 0x60, 0x56, 0x03, 0x56, 0x73, 0x7a,
+  0xa7, 0xd7, 0x33, 0x33, 0x3d, 0x33, 0xad, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x77, 0x62, 0x25, 0x22, 0x65, 0x65, 0x56, 0x76, 0xd2, 0x7d, 0xd2, 0x2d, 0x52, 0x56,
+  0x65, 0xc2, 0x7b, 0x79, 0xd2, 0xb7, 0x2c, 0x65, 0x26, 0xbd, 0x9a, 0x27, 0x22, 0xa9, 0xdb, 0x52,
+  0x25, 0x97, 0x79, 0xd2, 0xdd, 0x97, 0x79, 0x62, 0x26, 0x79, 0xd2, 0xad, 0xab, 0x2d, 0xd7, 0x52,
+  0x65, 0x92, 0x72, 0xb7, 0xbc, 0x2d, 0x2d, 0x65, 0x86, 0x77, 0xd2, 0xad, 0xab, 0x27, 0x87, 0x56,
+  0x25, 0x01, 0x24, 0x99, 0x97, 0x79, 0x23, 0x65, 0x26, 0x40, 0x22, 0x22, 0x22, 0x77, 0x23, 0x56,
+  0x85, 0x22, 0x01, 0x24, 0x12, 0x40, 0x82, 0x65, 0x56, 0x28, 0x40, 0x34, 0x02, 0x34, 0x52, 0x56,
+  0x65, 0x85, 0x22, 0x22, 0x28, 0x22, 0x68, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x76, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x84, 0x38, 0x34, 0x34,
+  0x76, 0x25, 0x43, 0x43, 0x83, 0x48, 0x23, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x56, 0x20, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x57, 0x21, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x56, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x56, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x57, 0x84, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x56, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x57, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x15, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x57, 0x20, 0x34, 0x84, 0x38, 0x34, 0x34, 0x34,
+  0x56, 0x41, 0x43, 0x83, 0x48, 0x43, 0x43, 0x43, 0x57, 0x31, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x46, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xd4, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0x44, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x16, 0x44, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x17, 0xd4, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x16, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x17, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x16, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xd4, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0x44, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0x44, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xd4, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xec, 0x4d, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x44, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x44, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xec, 0x4d, 0x61,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x71, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xec, 0x4d, 0x61,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x44, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x44, 0x61,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xec, 0x4d, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x64,
+  0xa7, 0xa7, 0x5b, 0x00, 0x10, 0x11, 0x10, 0x10, 0x7a, 0x33, 0x55, 0x00, 0x11, 0x11, 0x01, 0x10,
+  0x37, 0x66, 0x66, 0x10, 0x11, 0x00, 0x10, 0x01, 0x63, 0x66, 0x06, 0x06, 0x00, 0x60, 0x11, 0x01,
+  0x35, 0x63, 0x56, 0x66, 0x66, 0x06, 0x01, 0x60, 0x7a, 0x03, 0x66, 0x15, 0x56, 0x05, 0x00, 0x56,
+  0xa7, 0x63, 0x66, 0x01, 0x65, 0x56, 0x55, 0x65, 0x3a, 0x44, 0x55, 0x00, 0x16, 0x61, 0x66, 0x66,
+  0x63, 0x66, 0x54, 0x65, 0x11, 0x50, 0x56, 0x55, 0x53, 0x00, 0x56, 0x56, 0x06, 0x65, 0x65, 0x66,
+  0x25, 0x65, 0x00, 0x56, 0x56, 0x66, 0x06, 0x00, 0x7a, 0x52, 0x06, 0x60, 0x64, 0x66, 0x00, 0x11,
+  0xa7, 0x62, 0x00, 0x60, 0x54, 0x65, 0x06, 0x11, 0x2a, 0x05, 0x65, 0x55, 0x45, 0x65, 0x50, 0x06,
+  0x27, 0x65, 0x44, 0x55, 0x55, 0x54, 0x55, 0x66, 0x5a, 0x42, 0x55, 0x66, 0x56, 0x55, 0x55, 0x65,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x66, 0x03, 0x56, 0x01, 0x00, 0x11, 0x10, 0x00, 0x33, 0x55, 0x65,
+  0x11, 0x10, 0x11, 0x10, 0x01, 0x46, 0x63, 0x66, 0x00, 0x10, 0x61, 0x00, 0x11, 0x60, 0x24, 0x55,
+  0x06, 0x10, 0x66, 0x06, 0x60, 0x66, 0x26, 0x66, 0x06, 0x00, 0x56, 0x66, 0x66, 0x56, 0x26, 0x00,
+  0x05, 0x50, 0x66, 0x55, 0x45, 0x55, 0x25, 0x11, 0x55, 0x65, 0x66, 0x66, 0x55, 0x40, 0x55, 0x12,
+  0x55, 0x55, 0x65, 0x66, 0x06, 0x60, 0x00, 0x20, 0x65, 0x56, 0x64, 0x00, 0x66, 0x60, 0x00, 0x26,
+  0x06, 0x56, 0x64, 0x66, 0x00, 0x06, 0x66, 0x52, 0x00, 0x60, 0x45, 0x44, 0x66, 0x06, 0x20, 0x44,
+  0x01, 0x06, 0x66, 0x65, 0x66, 0x00, 0x60, 0x52, 0x60, 0x65, 0x55, 0x45, 0x54, 0x66, 0x06, 0x25,
+  0x66, 0x55, 0x44, 0x44, 0x45, 0x44, 0x64, 0x26, 0x64, 0x45, 0x54, 0x44, 0x06, 0x60, 0x25, 0x22,
+  0x06, 0x00, 0x5b, 0x00, 0x10, 0x11, 0x10, 0x10, 0x05, 0x33, 0x55, 0x00, 0x11, 0x11, 0x01, 0x10,
+  0x35, 0x66, 0x66, 0x10, 0x11, 0x00, 0x10, 0x01, 0x63, 0x66, 0x06, 0x06, 0x00, 0x60, 0x11, 0x01,
+  0x35, 0x63, 0x56, 0x66, 0x66, 0x06, 0x01, 0x60, 0x06, 0x03, 0x66, 0x15, 0x56, 0x05, 0x00, 0x56,
+  0x00, 0x63, 0x66, 0x01, 0x65, 0x56, 0x55, 0x65, 0x31, 0x44, 0x55, 0x00, 0x16, 0x61, 0x66, 0x66,
+  0x63, 0x66, 0x54, 0x65, 0x11, 0x50, 0x56, 0x55, 0x53, 0x00, 0x56, 0x56, 0x06, 0x65, 0x65, 0x66,
+  0x25, 0x65, 0x00, 0x56, 0x56, 0x66, 0x06, 0x00, 0x54, 0x52, 0x06, 0x60, 0x64, 0x66, 0x00, 0x11,
+  0x44, 0x62, 0x00, 0x60, 0x54, 0x65, 0x06, 0x11, 0x24, 0x05, 0x65, 0x55, 0x45, 0x65, 0x50, 0x06,
+  0x25, 0x65, 0x44, 0x55, 0x55, 0x54, 0x55, 0x66, 0x54, 0x42, 0x55, 0x66, 0x56, 0x55, 0x55, 0x65,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x66, 0x03, 0x56, 0x01, 0x00, 0x11, 0x10, 0x00, 0x33, 0x55, 0x65,
+  0x11, 0x10, 0x11, 0x10, 0x01, 0x46, 0x63, 0x66, 0x00, 0x10, 0x61, 0x00, 0x11, 0x60, 0x24, 0x55,
+  0x06, 0x10, 0x66, 0x06, 0x60, 0x66, 0x26, 0x66, 0x06, 0x00, 0x56, 0x66, 0x66, 0x56, 0x26, 0x00,
+  0x05, 0x50, 0x66, 0x55, 0x45, 0x55, 0x25, 0x11, 0x55, 0x65, 0x66, 0x66, 0x55, 0x40, 0x55, 0x12,
+  0x55, 0x55, 0x65, 0x66, 0x06, 0x60, 0x00, 0x20, 0x65, 0x56, 0x64, 0x00, 0x66, 0x60, 0x00, 0x26,
+  0x06, 0x56, 0x64, 0x66, 0x00, 0x06, 0x66, 0x52, 0x00, 0x60, 0x45, 0x44, 0x66, 0x06, 0x20, 0x44,
+  0x01, 0x06, 0x66, 0x65, 0x66, 0x00, 0x60, 0x52, 0x60, 0x65, 0x55, 0x45, 0x54, 0x66, 0x06, 0x25,
+  0x66, 0x55, 0x44, 0x44, 0x45, 0x44, 0x64, 0x26, 0x64, 0x45, 0x54, 0x44, 0x06, 0x60, 0x25, 0x22,
+  0x19, 0x11, 0x89, 0x99, 0x99, 0x89, 0x59, 0xba, 0x18, 0x81, 0x99, 0x88, 0x68, 0x88, 0x58, 0xab,
+  0x88, 0x98, 0x99, 0x99, 0x88, 0x61, 0x88, 0xb5, 0x88, 0x88, 0x98, 0x99, 0x19, 0x91, 0x11, 0x51,
+  0x98, 0x89, 0x96, 0x11, 0x99, 0x91, 0x11, 0x59, 0x19, 0x89, 0x96, 0x99, 0x11, 0x19, 0x99, 0x85,
+  0x11, 0x91, 0x68, 0x66, 0x99, 0x19, 0x51, 0xba, 0x12, 0x19, 0x99, 0x98, 0x99, 0x11, 0x91, 0xa5,
+  0x91, 0x98, 0x88, 0x68, 0x86, 0x99, 0x19, 0x58, 0x99, 0x88, 0x66, 0x66, 0x68, 0x66, 0x96, 0x59,
+  0x96, 0x68, 0x86, 0x66, 0x19, 0x91, 0x58, 0x55, 0x86, 0x66, 0x98, 0x11, 0x11, 0x99, 0x58, 0xab,
+  0x66, 0x68, 0x98, 0x19, 0x91, 0x96, 0x88, 0xb5, 0x66, 0x68, 0x89, 0x19, 0x91, 0x58, 0x85, 0xa5,
+  0x88, 0x96, 0x59, 0x98, 0x89, 0x58, 0x5a, 0xb8, 0x06, 0x96, 0x58, 0x88, 0x85, 0x58, 0xab, 0xab,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x32, 0x09, 0x69, 0x68, 0x68,
+  0x86, 0x86, 0x26, 0xa1, 0x7a, 0x90, 0x86, 0x86, 0x68, 0x68, 0x28, 0xa7, 0x7a, 0x31, 0x68, 0x68,
+  0x86, 0x86, 0x26, 0xa7, 0x7b, 0x31, 0x86, 0x86, 0x68, 0x68, 0x28, 0xa4, 0x7a, 0x94, 0x68, 0x68,
+  0x86, 0x86, 0x26, 0xa7, 0x7a, 0x01, 0x86, 0x86, 0x68, 0x68, 0x28, 0xa7, 0x7a, 0x01, 0x68, 0x68,
+  0x86, 0x86, 0x26, 0xb7, 0x7a, 0x91, 0x86, 0x86, 0x68, 0x68, 0x28, 0xa7, 0x7a, 0x31, 0x68, 0x68,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x57,
+  0x35, 0xcc, 0xcc, 0xc9, 0x99, 0x99, 0x49, 0x73, 0x37, 0x99, 0x99, 0x99, 0x99, 0x99, 0x49, 0x53,
+  0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x72, 0x27, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x52,
+  0x25, 0x44, 0x44, 0x11, 0x40, 0x04, 0x14, 0x72, 0x27, 0x04, 0x10, 0x00, 0x01, 0x01, 0x10, 0x52,
+  0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x72, 0x27, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x52,
+  0x75, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x75, 0x57, 0x57, 0x57, 0x12, 0x21, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0xd5, 0x42, 0x21, 0x7d, 0x75, 0x75, 0x57, 0x57, 0xdd, 0x42, 0x21, 0xdd, 0x57, 0x57,
+  0x75, 0x75, 0xdd, 0x2d, 0xd2, 0xdd, 0x75, 0x75, 0x57, 0x57, 0xd7, 0xdd, 0xdd, 0x5d, 0x57, 0x57,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x53, 0x76, 0x34, 0x34, 0x34, 0x34, 0x84, 0x34, 0x52, 0x67,
+  0x43, 0x22, 0x43, 0x43, 0x83, 0x43, 0x52, 0x76, 0x34, 0x22, 0x34, 0x34, 0x84, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x02, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x12, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x13, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x65, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x75, 0x76, 0x34, 0x34, 0x34, 0x34, 0x38, 0x34, 0x65, 0x67,
+  0x83, 0x48, 0x43, 0x43, 0x43, 0x43, 0x51, 0x76, 0x84, 0x38, 0x34, 0x34, 0x34, 0x34, 0x02, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x13, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x14, 0x65,
+  0x76, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x84, 0x38, 0x34, 0x34,
+  0x76, 0x25, 0x43, 0x43, 0x83, 0x48, 0x23, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x56, 0x20, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x57, 0x21, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x56, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x56, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x57, 0x84, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x56, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x57, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x15, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x57, 0x20, 0x34, 0x84, 0x38, 0x34, 0x34, 0x34,
+  0x56, 0x41, 0x43, 0x83, 0x48, 0x43, 0x43, 0x43, 0x57, 0x31, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x52, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x52, 0x76, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x04, 0x65,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x13, 0x75, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x52, 0x76, 0x34, 0x34, 0x84, 0x38, 0x34, 0x34, 0x52, 0x67,
+  0x43, 0x43, 0x83, 0x48, 0x43, 0x43, 0x13, 0x55, 0x24, 0x32, 0x34, 0x34, 0x34, 0x34, 0x34, 0x12,
+  0x23, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x23, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x43, 0x34, 0x84, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x57, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x05, 0x50, 0x76, 0x76, 0x55, 0x75, 0x76, 0x57, 0x11, 0x11, 0x55, 0x55, 0x00, 0x50, 0x67,
+  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x11, 0x22, 0x22, 0x11, 0x11, 0x22, 0x12, 0x11,
+  0x22, 0x43, 0x43, 0x22, 0x22, 0x43, 0x23, 0x22, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x48, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x22, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x22, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x57, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x76, 0x05, 0x50, 0x76, 0x76, 0x55, 0x75, 0x76, 0x57, 0x11, 0x11, 0x55, 0x55, 0x00, 0x50, 0x67,
+  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x11, 0x22, 0x22, 0x11, 0x11, 0x22, 0x12, 0x11,
+  0x22, 0x43, 0x43, 0x22, 0x22, 0x43, 0x23, 0x22, 0x34, 0x34, 0x34, 0x34, 0x34, 0x88, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x88, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x84, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x25, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x76, 0x25, 0x43, 0x48, 0x43, 0x43, 0x43, 0x43, 0x57, 0x30, 0x34, 0x34, 0x34, 0x34, 0x24, 0x32,
+  0x56, 0x41, 0x43, 0x43, 0x43, 0x43, 0x23, 0x42, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x24, 0x32,
+  0x76, 0x25, 0x43, 0x43, 0x43, 0x43, 0x23, 0x42, 0x67, 0x25, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x55, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x21, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x84, 0x34, 0x34,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x83, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x84, 0x34, 0x32,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x46, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x47, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x17, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x16, 0xe4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x17, 0xe4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x46, 0xe1, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x67, 0x41, 0xed, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0x76, 0x14, 0xd4, 0xee, 0xcc, 0xcc, 0xcc, 0xcc, 0x67, 0x47, 0x11, 0xdd, 0xed, 0xee, 0xcc, 0xcc,
+  0x76, 0x76, 0x44, 0x11, 0x41, 0xdd, 0xee, 0xee, 0x67, 0x67, 0x67, 0x44, 0x14, 0x41, 0xd4, 0xdd,
+  0x76, 0x76, 0x76, 0x76, 0x46, 0x44, 0x11, 0x11, 0x67, 0x67, 0x67, 0x67, 0x67, 0x47, 0x44, 0x44,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x11, 0x44, 0x14, 0x11, 0x11, 0x41, 0x44, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x64,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x61,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x4e, 0x71, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x4e, 0x61,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xec, 0x1d, 0x74, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0x14, 0x67,
+  0xcc, 0xcc, 0xcc, 0xec, 0xee, 0x4d, 0x41, 0x76, 0xcc, 0xcc, 0xee, 0xde, 0xdd, 0x11, 0x64, 0x67,
+  0xee, 0xee, 0xdd, 0x14, 0x11, 0x44, 0x76, 0x76, 0xdd, 0x4d, 0x14, 0x41, 0x44, 0x67, 0x67, 0x67,
+  0x11, 0x11, 0x44, 0x74, 0x76, 0x76, 0x76, 0x76, 0x44, 0x44, 0x64, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0xba, 0x5a, 0x26, 0x12, 0x89, 0x88, 0x86, 0x66, 0xab, 0xab, 0x15, 0x91, 0x98, 0x89, 0x66, 0x88,
+  0xba, 0xba, 0x15, 0x89, 0x68, 0x66, 0x66, 0x68, 0xab, 0xab, 0x85, 0x88, 0x86, 0x68, 0x66, 0x66,
+  0xba, 0xba, 0x5a, 0x65, 0x99, 0x88, 0x66, 0x88, 0xab, 0xab, 0xab, 0x5b, 0x88, 0x58, 0x00, 0x86,
+  0xba, 0xba, 0xba, 0xba, 0x55, 0x55, 0x00, 0x60, 0xab, 0xab, 0xab, 0xab, 0xab, 0x5b, 0x77, 0x33,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0x5a, 0x77, 0x3c, 0xab, 0xab, 0xab, 0xab, 0xab, 0x5b, 0xc3, 0x3c,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0x75, 0xcc, 0x73, 0xab, 0xab, 0xab, 0xab, 0x5b, 0xc7, 0x77, 0xc7,
+  0xba, 0xba, 0xba, 0x4a, 0x75, 0xcc, 0x33, 0x70, 0xab, 0xab, 0xab, 0x4b, 0xa4, 0x40, 0x50, 0x75,
+  0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0x4a, 0x5a, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x86, 0x66, 0x98, 0x11, 0x11, 0x99, 0x58, 0x86, 0x66, 0x68, 0x98, 0x19, 0x91, 0x96, 0x88, 0x65,
+  0x66, 0x68, 0x89, 0x19, 0x91, 0x58, 0x85, 0x35, 0x88, 0x96, 0x59, 0x98, 0x89, 0x58, 0x57, 0x38,
+  0x06, 0x96, 0x58, 0x88, 0x85, 0x58, 0xc3, 0x3c, 0x06, 0x86, 0x58, 0x55, 0x5b, 0x75, 0xcc, 0x73,
+  0x06, 0x00, 0xb5, 0xba, 0x5a, 0xc7, 0x77, 0xc7, 0x77, 0x03, 0xa5, 0x4b, 0x75, 0xcc, 0x33, 0x70,
+  0x37, 0x37, 0xb5, 0x4a, 0xa4, 0x40, 0x50, 0x75, 0x77, 0x37, 0xa5, 0xab, 0xaa, 0xaa, 0x4a, 0x5a,
+  0x33, 0x70, 0x50, 0xba, 0xba, 0xba, 0xba, 0xaa, 0x3c, 0x03, 0x03, 0xa5, 0xab, 0xab, 0xab, 0xab,
+  0xcc, 0x37, 0x40, 0x50, 0xaa, 0xba, 0xba, 0xba, 0x74, 0x34, 0x45, 0xa0, 0xaa, 0xab, 0xab, 0xab,
+  0xa4, 0x04, 0xaa, 0xaa, 0xaa, 0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xab,
+  0x06, 0x56, 0x26, 0x12, 0x89, 0x88, 0x86, 0x66, 0x06, 0x00, 0x15, 0x91, 0x98, 0x89, 0x66, 0x88,
+  0x77, 0x03, 0x15, 0x89, 0x68, 0x66, 0x66, 0x68, 0x37, 0x37, 0x85, 0x88, 0x86, 0x68, 0x66, 0x66,
+  0x77, 0x37, 0x55, 0x65, 0x99, 0x88, 0x66, 0x88, 0x33, 0x70, 0x50, 0x5b, 0x88, 0x58, 0x00, 0x86,
+  0x3c, 0x03, 0x03, 0xb5, 0x55, 0x55, 0x00, 0x60, 0xcc, 0x37, 0x40, 0x50, 0xaa, 0x5b, 0x77, 0x33,
+  0x74, 0x34, 0x45, 0xa0, 0xaa, 0x5a, 0x77, 0x3c, 0xa4, 0x04, 0xaa, 0xaa, 0xaa, 0x5b, 0xc3, 0x3c,
+  0xaa, 0xaa, 0xaa, 0xba, 0xba, 0x75, 0xcc, 0x73, 0xab, 0xab, 0xab, 0xab, 0x5b, 0xc7, 0x77, 0xc7,
+  0xba, 0xba, 0xba, 0x4a, 0x75, 0xcc, 0x33, 0x70, 0xab, 0xab, 0xab, 0x4b, 0xa4, 0x40, 0x50, 0x75,
+  0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0x4a, 0x5a, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x86, 0x66, 0x98, 0x11, 0x11, 0x99, 0x58, 0x86, 0x66, 0x68, 0x98, 0x19, 0x91, 0x96, 0x88, 0x65,
+  0x66, 0x68, 0x89, 0x19, 0x91, 0x58, 0x85, 0x35, 0x88, 0x96, 0x59, 0x98, 0x89, 0x58, 0x57, 0x38,
+  0x06, 0x96, 0x58, 0x88, 0x85, 0x58, 0xc3, 0x3c, 0x06, 0x86, 0x58, 0x55, 0x5b, 0x75, 0xcc, 0x73,
+  0x06, 0x00, 0xb5, 0xba, 0x5a, 0xc7, 0x77, 0xc7, 0x77, 0x03, 0xa5, 0x4b, 0x75, 0xcc, 0x33, 0x70,
+  0x37, 0x37, 0xb5, 0x4a, 0xa4, 0x40, 0x50, 0x75, 0x77, 0x37, 0xa5, 0xab, 0xaa, 0xaa, 0x4a, 0x5a,
+  0x33, 0x70, 0x50, 0xba, 0xba, 0xba, 0xba, 0xaa, 0x3c, 0x03, 0x03, 0xa5, 0xab, 0xab, 0xab, 0xab,
+  0xcc, 0x37, 0x40, 0x50, 0xaa, 0xba, 0xba, 0xba, 0x74, 0x34, 0x45, 0xa0, 0xaa, 0xab, 0xab, 0xab,
+  0xa4, 0x04, 0xaa, 0xaa, 0xaa, 0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xab,
+  0x06, 0x86, 0x58, 0x55, 0x5a, 0xb5, 0xba, 0xba, 0x06, 0x00, 0xa5, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x77, 0x03, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xba, 0x37, 0x37, 0xa5, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x77, 0x37, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xba, 0x33, 0x70, 0x50, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x3c, 0x03, 0x03, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xcc, 0x37, 0x40, 0x50, 0xaa, 0xab, 0xab, 0xab,
+  0x74, 0x34, 0x45, 0xa0, 0xaa, 0xba, 0xba, 0xba, 0xa4, 0x04, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab,
+  0xaa, 0xaa, 0xaa, 0xba, 0xba, 0xba, 0xba, 0xba, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x86, 0x86, 0x26, 0xa4, 0x7a, 0x54, 0x86, 0x86, 0x68, 0x68, 0x28, 0xa7, 0x7b, 0x91, 0x68, 0x68,
+  0x86, 0x86, 0x26, 0xa7, 0x7a, 0x31, 0x86, 0x86, 0x68, 0x68, 0x28, 0x17, 0x01, 0x31, 0x68, 0x68,
+  0x86, 0x86, 0x26, 0x71, 0xd7, 0x20, 0x86, 0x86, 0x68, 0x68, 0x28, 0x70, 0x5a, 0x20, 0x68, 0x68,
+  0x86, 0x86, 0xc6, 0x22, 0x25, 0xc2, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x00, 0x00, 0x20,
+  0x65, 0x65, 0x65, 0x65, 0x00, 0x98, 0xaa, 0xba, 0x56, 0x56, 0x56, 0x06, 0x98, 0xa9, 0xaa, 0xaa,
+  0x65, 0x65, 0x65, 0x90, 0x99, 0x99, 0xaa, 0xaa, 0x56, 0x56, 0x06, 0x84, 0x99, 0x99, 0x99, 0x99,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x52, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x2b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0xbb, 0x52, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xaa, 0x2b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x99, 0x08, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x68, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x46,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x68, 0x43, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x36, 0x34,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x68, 0x43, 0x33, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x36, 0x44, 0x33,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8a,
+  0xa8, 0x68, 0x23, 0x23, 0x22, 0x22, 0x22, 0xa5, 0x8a, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x52,
+  0x68, 0x43, 0x43, 0x43, 0x44, 0x44, 0x44, 0x23, 0x36, 0x24, 0x43, 0x43, 0x44, 0x44, 0x44, 0x32,
+  0x43, 0x22, 0x43, 0x43, 0x44, 0x44, 0x44, 0x22, 0x44, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22,
+  0x43, 0x42, 0x43, 0x43, 0x44, 0x44, 0x44, 0x23, 0x43, 0x34, 0x43, 0x43, 0x44, 0x44, 0x44, 0x32,
+  0x43, 0x33, 0x43, 0x43, 0x44, 0x44, 0x44, 0x22, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x94, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x41, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x12, 0x94, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x22, 0x41, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x12, 0x12, 0x94, 0x98, 0x98, 0x98, 0x98, 0x98, 0x12, 0x21, 0x41, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x12, 0x11, 0x12, 0x94, 0x98, 0x98, 0x98, 0x98, 0x21, 0x11, 0x21, 0x42, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x0a, 0x26, 0x62, 0x22, 0x26,
+  0xa8, 0xa8, 0xa8, 0x08, 0x67, 0x76, 0x22, 0x67, 0x8a, 0x8a, 0x8a, 0x5b, 0x55, 0x55, 0x55, 0x55,
+  0xa8, 0xa8, 0xa8, 0x51, 0x55, 0x55, 0x55, 0x55, 0x8a, 0x8a, 0x8a, 0x70, 0x77, 0x77, 0x77, 0x77,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x22, 0x26, 0x62, 0x22, 0x26, 0x62, 0x22,
+  0x76, 0x22, 0x67, 0x76, 0x22, 0x67, 0x76, 0x22, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x62, 0x22, 0x26, 0x62, 0x22, 0x26, 0x62,
+  0x67, 0x76, 0x22, 0x67, 0x76, 0x22, 0x67, 0x76, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x62, 0x22, 0x26, 0x62, 0x22, 0x26,
+  0x22, 0x27, 0x72, 0x66, 0x27, 0x72, 0x66, 0x27, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x00, 0x00, 0x00, 0xa0, 0xa8, 0xa8, 0xa8, 0xa8, 0x62, 0x22, 0x26, 0x80, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x72, 0x66, 0x67, 0xa0, 0xa8, 0xa8, 0xa8, 0xa8, 0x55, 0x55, 0x55, 0xb5, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x55, 0x55, 0x55, 0x15, 0xa8, 0xa8, 0xa8, 0xa8, 0x77, 0x77, 0x77, 0x07, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x35, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xe3,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x35, 0xfe, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xe3, 0xdf,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x35, 0xff, 0xdf, 0x56, 0x56, 0x56, 0x56, 0x56, 0xe3, 0xef, 0xdf,
+  0x65, 0x65, 0x65, 0x65, 0x35, 0xfe, 0xee, 0xff, 0x56, 0x56, 0x56, 0x56, 0xe3, 0xef, 0xee, 0xef,
+  0x65, 0x65, 0x65, 0x35, 0xfe, 0xef, 0xfe, 0xee, 0x56, 0x56, 0x56, 0xf3, 0xdf, 0xef, 0xef, 0xee,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x32, 0xa1, 0xa9, 0x99, 0x99, 0x99, 0x09, 0x23, 0x23,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x30, 0x01, 0xab, 0xab, 0xbb, 0xbb, 0xbb, 0xab, 0x19, 0x77,
+  0xa9, 0xab, 0xbb, 0xbb, 0xbb, 0x9b, 0x0a, 0x47, 0xa9, 0xab, 0xbb, 0xbb, 0xbb, 0x9b, 0x09, 0x16,
+  0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x09, 0x66, 0xab, 0xab, 0xbb, 0xbb, 0xbb, 0xab, 0x19, 0x55,
+  0xaa, 0xab, 0xbb, 0xbb, 0xbb, 0x9b, 0x1a, 0x55, 0xaa, 0xab, 0xbb, 0xbb, 0xbb, 0x9b, 0xa9, 0x00,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x99, 0x50, 0xab, 0xab, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x50,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x00, 0x10, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x67, 0x56, 0x21, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x44, 0x54, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x11, 0x51, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x66, 0x56, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x56, 0x45, 0x21, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x56, 0x45, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x46, 0x04, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x46, 0x04, 0x09, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb7, 0xbb, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xba, 0x66, 0x7b,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xbb, 0xbb, 0x06, 0xb6, 0x7a, 0xba, 0xbb, 0xba, 0x66, 0x06, 0x11, 0xb0,
+  0xa7, 0xb7, 0x66, 0xbb, 0x00, 0x00, 0x11, 0x61, 0x7a, 0xba, 0x16, 0x00, 0x16, 0x11, 0x10, 0x01,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+  0xa7, 0xa7, 0xb7, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0x7a, 0xba, 0x6b, 0x7b, 0x3a, 0x73, 0x7a, 0x7a,
+  0xa7, 0x6b, 0x06, 0xb6, 0x63, 0x36, 0xa7, 0xa7, 0xbb, 0x06, 0x10, 0x65, 0x06, 0x36, 0x7a, 0x7a,
+  0x00, 0x00, 0x11, 0x10, 0x01, 0x33, 0xa3, 0xa7, 0x11, 0x01, 0x11, 0x11, 0x01, 0x60, 0x73, 0x7a,
+  0x65, 0x65, 0x05, 0x41, 0x98, 0x99, 0x99, 0x48, 0x56, 0x56, 0x06, 0x11, 0x41, 0x88, 0x48, 0x44,
+  0x65, 0x65, 0x05, 0x14, 0x11, 0x84, 0x44, 0x04, 0x56, 0x56, 0x06, 0x11, 0x11, 0x41, 0x11, 0x80,
+  0x65, 0x65, 0x05, 0x14, 0x11, 0x41, 0x01, 0x41, 0x56, 0x56, 0x06, 0x14, 0x11, 0x11, 0x01, 0x11,
+  0x65, 0x65, 0x03, 0x10, 0x11, 0x11, 0x01, 0x11, 0x56, 0x36, 0x33, 0x30, 0x10, 0x31, 0x00, 0x11,
+  0x65, 0x65, 0x35, 0x33, 0x30, 0x30, 0x00, 0x14, 0x56, 0x56, 0x56, 0x36, 0x33, 0x33, 0x03, 0x14,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x03, 0x11, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x36, 0x30,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x33, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x36,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x44, 0x04, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x20, 0x22, 0x22, 0x56, 0x56, 0x56, 0x56,
+  0x80, 0x99, 0x99, 0x89, 0x62, 0x65, 0x65, 0x65, 0x99, 0xa9, 0xaa, 0xbb, 0x28, 0x56, 0x56, 0x56,
+  0x99, 0x99, 0xaa, 0xba, 0x2b, 0x65, 0x65, 0x65, 0x98, 0x99, 0xa9, 0xaa, 0x0a, 0x56, 0x56, 0x56,
+  0x84, 0x99, 0x99, 0x89, 0x08, 0x65, 0x65, 0x65, 0x81, 0x88, 0x88, 0x48, 0x04, 0x56, 0x56, 0x56,
+  0x11, 0x48, 0x44, 0x44, 0x04, 0x65, 0x65, 0x65, 0x11, 0x14, 0x44, 0x44, 0x04, 0x56, 0x56, 0x56,
+  0x11, 0x01, 0x44, 0x44, 0x03, 0x63, 0x65, 0x65, 0x11, 0x01, 0x41, 0x00, 0x33, 0x56, 0x56, 0x56,
+  0x00, 0x00, 0x03, 0x33, 0x63, 0x65, 0x65, 0x65, 0x33, 0x33, 0x33, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xa8, 0xa8, 0xa8, 0xa8, 0x68, 0x44, 0x42, 0x43, 0x8a, 0x8a, 0x8a, 0x8a, 0x36, 0x24, 0x42, 0x44,
+  0xa8, 0xa8, 0xa8, 0x68, 0x43, 0x22, 0x42, 0x43, 0x8a, 0x8a, 0x8a, 0x36, 0x24, 0x22, 0x34, 0x43,
+  0xa8, 0xa8, 0xa8, 0x46, 0x22, 0x42, 0x33, 0x43, 0x8a, 0x8a, 0x8a, 0x26, 0x22, 0x34, 0x33, 0x24,
+  0xa8, 0xa8, 0xa8, 0x26, 0x42, 0x34, 0x43, 0x22, 0x8a, 0x8a, 0x8a, 0x26, 0x34, 0x34, 0x44, 0x22,
+  0xa8, 0xa8, 0xa8, 0x46, 0x33, 0x44, 0x43, 0x42, 0x8a, 0x8a, 0x8a, 0x36, 0x33, 0x34, 0x43, 0x44,
+  0xa8, 0xa8, 0xa8, 0x36, 0x43, 0x33, 0x43, 0x43, 0x8a, 0x8a, 0x8a, 0x36, 0x34, 0x33, 0x34, 0x03,
+  0xa8, 0xa8, 0xa8, 0x46, 0x33, 0x43, 0x33, 0x30, 0x8a, 0x8a, 0x8a, 0x36, 0x33, 0x34, 0x03, 0x23,
+  0xa8, 0xa8, 0xa8, 0x36, 0x43, 0x34, 0x30, 0x22, 0x8a, 0x8a, 0x8a, 0x36, 0x24, 0x04, 0x23, 0x52,
+  0x33, 0x53, 0x53, 0x53, 0x55, 0x55, 0x55, 0x23, 0x33, 0x35, 0x53, 0x53, 0x55, 0x55, 0x55, 0x32,
+  0x53, 0x33, 0x53, 0x53, 0x55, 0x55, 0x55, 0x22, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22,
+  0x52, 0x53, 0x53, 0x53, 0x55, 0x55, 0x55, 0x23, 0x52, 0x35, 0x53, 0x53, 0x55, 0x55, 0x55, 0x32,
+  0x52, 0x33, 0x21, 0x21, 0x12, 0x11, 0x11, 0x22, 0x35, 0x03, 0x53, 0x53, 0x55, 0x55, 0x55, 0x21,
+  0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x12, 0x03, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
+  0x30, 0x22, 0x88, 0x88, 0x88, 0x88, 0x88, 0x10, 0x23, 0x82, 0x74, 0x77, 0x77, 0x77, 0x47, 0x08,
+  0x22, 0x78, 0x77, 0x8b, 0x7b, 0xb8, 0x77, 0x87, 0x82, 0xb7, 0xb7, 0x99, 0x7b, 0x99, 0x7b, 0x7b,
+  0x78, 0xeb, 0xcb, 0xcc, 0x7b, 0xcc, 0x7c, 0xbe, 0xa6, 0xdd, 0xbb, 0xbb, 0x7b, 0xbb, 0x7b, 0xdd,
+  0x22, 0x23, 0x22, 0x23, 0xa7, 0xa9, 0xa9, 0xa9, 0x22, 0x33, 0x22, 0x32, 0x72, 0x9a, 0x9a, 0x9a,
+  0x23, 0x23, 0x23, 0x22, 0x23, 0xa7, 0xa9, 0xa9, 0x33, 0x23, 0x32, 0x22, 0x33, 0x72, 0x9a, 0x9a,
+  0x23, 0x23, 0x22, 0x23, 0x23, 0x13, 0x77, 0x77, 0x23, 0x32, 0x22, 0x33, 0x23, 0x22, 0x22, 0x22,
+  0x23, 0x22, 0x23, 0x23, 0x23, 0x32, 0x33, 0x33, 0x32, 0x22, 0x32, 0x23, 0x32, 0x22, 0x22, 0x22,
+  0x22, 0x23, 0x22, 0x23, 0x22, 0x23, 0x22, 0x22, 0x21, 0x33, 0x22, 0x32, 0x22, 0x32, 0x44, 0x44,
+  0x12, 0x23, 0x23, 0x22, 0x23, 0x22, 0x33, 0x33, 0x21, 0x21, 0x32, 0x22, 0x33, 0x22, 0x33, 0x33,
+  0x10, 0x12, 0x22, 0x23, 0x23, 0x32, 0x44, 0x44, 0x07, 0x21, 0x21, 0x32, 0x23, 0x22, 0x33, 0x33,
+  0x76, 0x10, 0x12, 0x22, 0x23, 0x22, 0x33, 0x33, 0x58, 0x07, 0x21, 0x21, 0x32, 0x22, 0x33, 0x33,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x55, 0x55, 0x55, 0x55, 0xa5, 0xa8, 0xa8, 0xa8, 0x22, 0x22, 0x22, 0x22, 0x86, 0x8a, 0x8a, 0x8a,
+  0x33, 0x33, 0x33, 0x33, 0xa6, 0xa8, 0xa8, 0xa8, 0x22, 0x22, 0x22, 0x22, 0x86, 0x8a, 0x8a, 0x8a,
+  0x22, 0x22, 0x22, 0x22, 0xa6, 0xa8, 0xa8, 0xa8, 0x44, 0x44, 0x44, 0x44, 0x86, 0x8a, 0x8a, 0x8a,
+  0x33, 0x33, 0x33, 0x33, 0xa6, 0xa8, 0xa8, 0xa8, 0x33, 0x33, 0x33, 0x33, 0x86, 0x8a, 0x8a, 0x8a,
+  0x44, 0x44, 0x44, 0x44, 0xa6, 0xa8, 0xa8, 0xa8, 0x33, 0x33, 0x33, 0x33, 0x86, 0x8a, 0x8a, 0x8a,
+  0x33, 0x33, 0x33, 0x33, 0xa6, 0xa8, 0xa8, 0xa8, 0x33, 0x33, 0x33, 0x33, 0x86, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0x70, 0x77, 0x77, 0x77, 0x77, 0x8a, 0x8a, 0x8a, 0x0a, 0x65, 0x56, 0x22, 0x65,
+  0xa8, 0xa8, 0xa8, 0x18, 0x75, 0x57, 0x66, 0x75, 0x8a, 0x8a, 0x8a, 0x1a, 0x75, 0x57, 0x66, 0x75,
+  0xa8, 0xa8, 0xa8, 0xb8, 0x75, 0x57, 0x66, 0x75, 0x8a, 0x8a, 0x8a, 0xba, 0x75, 0x57, 0x66, 0x75,
+  0xa8, 0xa8, 0xa8, 0xb8, 0x75, 0x57, 0x22, 0x75, 0x8a, 0x8a, 0x8a, 0xba, 0x75, 0x57, 0x22, 0x75,
+  0xa8, 0xa8, 0xa8, 0xb8, 0x75, 0x57, 0x22, 0x75, 0x8a, 0x8a, 0x8a, 0xba, 0x75, 0x57, 0x22, 0x75,
+  0xa8, 0xa8, 0xa8, 0xb8, 0x75, 0x57, 0x66, 0x65, 0x8a, 0x8a, 0x8a, 0xba, 0x75, 0x57, 0x66, 0x65,
+  0xa8, 0xa8, 0xa8, 0xb8, 0x75, 0x57, 0x66, 0x65, 0x8a, 0x8a, 0x8a, 0xba, 0x75, 0x57, 0x66, 0x65,
+  0xa8, 0xa8, 0xa8, 0xb8, 0x75, 0x57, 0x66, 0x75, 0x8a, 0x8a, 0x8a, 0x1a, 0x75, 0x57, 0x66, 0x75,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x78, 0x44, 0x87, 0x78, 0x44, 0x87, 0x78, 0x44,
+  0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x79, 0x88, 0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x79, 0x99,
+  0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x79, 0x99, 0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x79, 0x99,
+  0x79, 0x88, 0x87, 0x78, 0x88, 0x97, 0x79, 0x99, 0x79, 0x88, 0x87, 0x78, 0x88, 0x97, 0x79, 0x88,
+  0x79, 0x88, 0x87, 0x78, 0x88, 0x97, 0x79, 0x88, 0x79, 0x88, 0x87, 0x78, 0x88, 0x97, 0x79, 0x48,
+  0x78, 0x88, 0x97, 0x79, 0x44, 0x97, 0x79, 0x98, 0x78, 0x88, 0x97, 0x79, 0x44, 0x97, 0x79, 0x94,
+  0x78, 0x88, 0x97, 0x79, 0x44, 0x97, 0x89, 0x99, 0x78, 0x88, 0x97, 0x79, 0x44, 0x97, 0x49, 0x49,
+  0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x98, 0x24, 0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x48, 0x02,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x87, 0x78, 0x44, 0x87, 0x78, 0x44, 0x87, 0x78,
+  0x97, 0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x79, 0x97, 0x79, 0x88, 0x97, 0x79, 0x88, 0x97, 0x79,
+  0x87, 0x98, 0x88, 0x89, 0x98, 0x88, 0x99, 0x79, 0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x94, 0x79,
+  0x98, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x79, 0x94, 0x77, 0x77, 0x77, 0x77, 0x77, 0x48, 0x79,
+  0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x78, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x74,
+  0x99, 0x48, 0x44, 0x44, 0x44, 0x84, 0x88, 0x88, 0x49, 0x22, 0x22, 0x22, 0x22, 0x22, 0x84, 0x48,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x84,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x25, 0x52, 0x66, 0x25, 0x52, 0x66, 0x25,
+  0x77, 0x65, 0x56, 0x77, 0x65, 0x56, 0x77, 0x65, 0x77, 0x65, 0x56, 0x77, 0x65, 0x56, 0x77, 0x65,
+  0x66, 0x65, 0x56, 0x77, 0x65, 0x56, 0x77, 0x65, 0x66, 0x65, 0x56, 0x77, 0x65, 0x56, 0x77, 0x65,
+  0x66, 0x25, 0x52, 0x77, 0x65, 0x56, 0x66, 0x65, 0x66, 0x25, 0x52, 0x77, 0x65, 0x56, 0x66, 0x65,
+  0x77, 0x25, 0x52, 0x77, 0x65, 0x56, 0x66, 0x65, 0x77, 0x25, 0x52, 0x77, 0x65, 0x56, 0x66, 0x65,
+  0x77, 0x65, 0x56, 0x66, 0x65, 0x56, 0x77, 0x25, 0x77, 0x65, 0x56, 0x66, 0x65, 0x56, 0x77, 0x25,
+  0x76, 0x65, 0x56, 0x66, 0x65, 0x56, 0x77, 0x25, 0x72, 0x65, 0x56, 0x66, 0x65, 0x56, 0x77, 0x25,
+  0x66, 0x65, 0x56, 0x77, 0x65, 0x56, 0x77, 0x65, 0x62, 0x65, 0x56, 0x77, 0x65, 0x56, 0x77, 0x65,
+  0x77, 0x77, 0x77, 0x07, 0xa8, 0xa8, 0xa8, 0xa8, 0x52, 0x66, 0x65, 0x80, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x56, 0x77, 0x65, 0xa1, 0xa8, 0xa8, 0xa8, 0xa8, 0x56, 0x77, 0x65, 0x81, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x56, 0x77, 0x65, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0x56, 0x77, 0x65, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x56, 0x77, 0x65, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0x56, 0x77, 0x65, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x56, 0x77, 0x65, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0x56, 0x77, 0x65, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x52, 0x77, 0x65, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0x52, 0x77, 0x65, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x52, 0x77, 0x65, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0x52, 0x77, 0x65, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x56, 0x77, 0x65, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0x56, 0x77, 0x65, 0x81, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x65, 0x65, 0x35, 0xfe, 0xdd, 0xff, 0xef, 0xfe, 0x56, 0x56, 0xe3, 0xdf, 0xdd, 0xef, 0xef, 0xef,
+  0x65, 0x35, 0xfe, 0xdd, 0xfd, 0xee, 0xff, 0xef, 0x56, 0x36, 0xdf, 0xdd, 0xef, 0xee, 0xdf, 0xef,
+  0x65, 0x35, 0xdd, 0xfd, 0xee, 0xfe, 0xdd, 0xff, 0x56, 0x36, 0xdd, 0xff, 0xee, 0xdf, 0xdd, 0xef,
+  0x65, 0x35, 0xfd, 0xfe, 0xfe, 0xdf, 0xfd, 0xee, 0x56, 0x36, 0xef, 0xfe, 0xef, 0xdf, 0xef, 0xbe,
+  0x65, 0x35, 0xee, 0xfe, 0xee, 0xff, 0xef, 0xeb, 0x56, 0x36, 0xee, 0xef, 0xee, 0xef, 0xbf, 0xde,
+  0x65, 0x35, 0xfe, 0xee, 0xfe, 0xee, 0xeb, 0xdd, 0x56, 0x36, 0xef, 0xee, 0xef, 0xbe, 0xde, 0x2d,
+  0x65, 0x35, 0xee, 0xfe, 0xee, 0xeb, 0xdd, 0x12, 0x56, 0x36, 0xee, 0xff, 0xbe, 0xde, 0x2d, 0x41,
+  0x65, 0x35, 0xfe, 0xfd, 0xeb, 0xdd, 0x12, 0x84, 0x56, 0x36, 0xdf, 0xbd, 0xde, 0x2d, 0x41, 0x88,
+  0xee, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xde, 0xa2, 0xee, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xed, 0xab,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xde, 0xed, 0xbe, 0xef, 0xef, 0xff, 0xff, 0xff, 0xef, 0xed, 0xed,
+  0xee, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xee, 0xdd, 0xbe, 0xbc, 0xcc, 0xbb, 0xbb, 0xdb, 0xed, 0xdd,
+  0xeb, 0xef, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xee, 0xde, 0xdb, 0xed,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xbd, 0xed, 0x2d, 0x22, 0x22, 0x22, 0x22, 0xb2, 0xdb, 0xeb,
+  0x02, 0x11, 0x11, 0x11, 0x11, 0x20, 0xbb, 0xbd, 0x11, 0x41, 0x42, 0x21, 0x14, 0x11, 0xb2, 0xdb,
+  0x14, 0x34, 0x43, 0x31, 0x43, 0x41, 0x21, 0xbb, 0x49, 0x77, 0x47, 0x71, 0x77, 0x91, 0x14, 0xb2,
+  0x48, 0x44, 0x44, 0x41, 0x44, 0x81, 0x48, 0x21, 0x48, 0x37, 0x43, 0x31, 0x73, 0x81, 0x88, 0x14,
+  0x46, 0x04, 0x9a, 0x30, 0x32, 0x32, 0x32, 0x32, 0x46, 0x04, 0xa9, 0x09, 0x23, 0x23, 0x23, 0x23,
+  0x44, 0x04, 0xa9, 0x9a, 0x30, 0x32, 0x32, 0x32, 0x18, 0x01, 0xa9, 0xa9, 0x20, 0x23, 0x23, 0x23,
+  0x8a, 0x88, 0xaa, 0x99, 0x30, 0x32, 0x32, 0x32, 0xa9, 0xa9, 0xa9, 0x99, 0x20, 0x23, 0x23, 0x23,
+  0x99, 0xaa, 0x99, 0x9a, 0x30, 0x32, 0x32, 0x32, 0x99, 0xa9, 0x99, 0xa9, 0x20, 0x23, 0x23, 0x23,
+  0x9a, 0x99, 0x9a, 0x99, 0x30, 0x32, 0x32, 0x32, 0xa9, 0x99, 0xa9, 0x99, 0x20, 0x23, 0x23, 0x23,
+  0x99, 0x9a, 0xa9, 0x9a, 0x30, 0x32, 0x32, 0x32, 0x98, 0xa9, 0xa9, 0xa9, 0x20, 0x23, 0x23, 0x23,
+  0x89, 0x99, 0xaa, 0x99, 0x30, 0x32, 0x32, 0x32, 0x98, 0x98, 0xa9, 0x99, 0x20, 0x23, 0x23, 0x23,
+  0x88, 0x89, 0x99, 0x9a, 0x30, 0x32, 0x32, 0x32, 0x80, 0x98, 0x98, 0xa9, 0x20, 0x23, 0x23, 0x23,
+  0xa7, 0xa7, 0x5b, 0x00, 0x10, 0x11, 0x10, 0x10, 0x7a, 0x33, 0x55, 0x00, 0x11, 0x11, 0x01, 0x10,
+  0x37, 0x66, 0x66, 0x10, 0x11, 0x00, 0x10, 0x01, 0x63, 0x66, 0x06, 0x06, 0x00, 0x60, 0x11, 0x01,
+  0x35, 0x63, 0x56, 0x66, 0x66, 0x06, 0x01, 0x60, 0x7a, 0x03, 0x66, 0x15, 0x56, 0x05, 0x00, 0x56,
+  0xa7, 0x63, 0x66, 0x01, 0x65, 0x56, 0x55, 0x65, 0x3a, 0x44, 0x55, 0x00, 0x16, 0x61, 0x66, 0x66,
+  0x63, 0x66, 0x54, 0x65, 0x11, 0x50, 0x56, 0x55, 0x53, 0x00, 0x56, 0x56, 0x06, 0x65, 0x65, 0x66,
+  0x25, 0x65, 0x00, 0x56, 0x56, 0x66, 0x06, 0x00, 0x7a, 0x52, 0x06, 0x60, 0x64, 0x66, 0x00, 0x11,
+  0xa7, 0x62, 0x00, 0x60, 0x54, 0x65, 0x06, 0x11, 0x2a, 0x05, 0x65, 0x55, 0x45, 0x65, 0x50, 0x06,
+  0x27, 0x65, 0x44, 0x55, 0x55, 0x54, 0x55, 0x66, 0x5a, 0x42, 0x55, 0x66, 0x56, 0x55, 0x55, 0x65,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x66, 0xa3, 0xa7, 0x01, 0x00, 0x11, 0x10, 0x00, 0x33, 0x7a, 0x7a,
+  0x11, 0x10, 0x11, 0x10, 0x01, 0x46, 0xa3, 0xa7, 0x00, 0x10, 0x61, 0x00, 0x11, 0x60, 0x24, 0x7a,
+  0x06, 0x10, 0x66, 0x06, 0x60, 0x66, 0x26, 0xa7, 0x06, 0x00, 0x56, 0x66, 0x66, 0x56, 0x26, 0x7a,
+  0x05, 0x50, 0x66, 0x55, 0x45, 0x55, 0x25, 0xa7, 0x55, 0x65, 0x66, 0x66, 0x55, 0x40, 0x55, 0x72,
+  0x55, 0x55, 0x65, 0x66, 0x06, 0x60, 0x00, 0x20, 0x65, 0x56, 0x64, 0x00, 0x66, 0x60, 0x00, 0x26,
+  0x06, 0x56, 0x64, 0x66, 0x00, 0x06, 0x66, 0x52, 0x00, 0x60, 0x45, 0x44, 0x66, 0x06, 0x20, 0x7a,
+  0x01, 0x06, 0x66, 0x65, 0x66, 0x00, 0x60, 0xa2, 0x60, 0x65, 0x55, 0x45, 0x54, 0x66, 0x06, 0x25,
+  0x66, 0x55, 0x44, 0x44, 0x45, 0x44, 0x64, 0x26, 0x64, 0x45, 0x54, 0x44, 0x06, 0x60, 0x25, 0x22,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x05, 0x00, 0x00, 0x56, 0x56, 0x56, 0x56, 0x06, 0x10, 0x44, 0x98,
+  0x65, 0x65, 0x65, 0x05, 0x10, 0x44, 0x98, 0xa9, 0x56, 0x56, 0x56, 0x10, 0x44, 0x98, 0x99, 0xba,
+  0x65, 0x65, 0x65, 0x00, 0x41, 0x44, 0x84, 0xa9, 0x56, 0x56, 0x06, 0x11, 0x11, 0x81, 0x99, 0x99,
+  0x65, 0x65, 0x05, 0x11, 0x11, 0x11, 0x99, 0xaa, 0x56, 0x56, 0x06, 0x11, 0x11, 0x11, 0x81, 0x99,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x00, 0x72, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0xba, 0xbb, 0x77, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xaa, 0xbb, 0xbb, 0x67, 0x65, 0x65, 0x65, 0x65, 0xaa, 0xaa, 0xbb, 0x7b, 0x56, 0x56, 0x56, 0x56,
+  0xaa, 0xab, 0xaa, 0xbb, 0x67, 0x65, 0x65, 0x65, 0x9a, 0xa9, 0xab, 0xba, 0x52, 0x56, 0x56, 0x56,
+  0x99, 0x99, 0x88, 0x44, 0x04, 0x65, 0x65, 0x65, 0x89, 0x48, 0x44, 0x88, 0x04, 0x56, 0x56, 0x56,
+  0x98, 0x98, 0x98, 0x25, 0x11, 0x20, 0x11, 0x34, 0x89, 0x89, 0x89, 0x15, 0x01, 0x12, 0x41, 0x73,
+  0x98, 0x98, 0x5a, 0x15, 0x20, 0x11, 0x34, 0xc7, 0x89, 0x89, 0xfa, 0x05, 0x12, 0x41, 0x73, 0xcc,
+  0x98, 0x98, 0xfa, 0x25, 0x11, 0x34, 0xe7, 0xee, 0x89, 0x89, 0xfa, 0x44, 0x44, 0x63, 0xbb, 0xbb,
+  0x98, 0x98, 0xfa, 0xdf, 0x33, 0xb6, 0xbb, 0xbb, 0x89, 0x89, 0xfa, 0xdf, 0xc5, 0xee, 0xee, 0xee,
+  0x98, 0x98, 0xfa, 0xdf, 0x75, 0xcc, 0xcc, 0xcc, 0x89, 0x89, 0xfa, 0xdf, 0x75, 0xcc, 0xcc, 0xcc,
+  0x98, 0x98, 0xfa, 0xdf, 0xc5, 0xee, 0xee, 0xee, 0x89, 0x89, 0xfa, 0xdf, 0x65, 0xbb, 0xbb, 0xbb,
+  0x98, 0x98, 0xfa, 0xdf, 0x65, 0xbb, 0xbb, 0xbb, 0x89, 0x89, 0xfa, 0xdf, 0xc5, 0xee, 0xee, 0xee,
+  0x98, 0x98, 0x8a, 0xdf, 0x75, 0xcc, 0xcc, 0xcc, 0x89, 0x89, 0x88, 0xdf, 0x75, 0xcc, 0xcc, 0xcc,
+  0xb8, 0xbb, 0xa9, 0x77, 0x59, 0x77, 0x5a, 0xbb, 0xff, 0xff, 0xe9, 0xaa, 0x59, 0xaa, 0x5e, 0xdd,
+  0xcc, 0xcc, 0x5c, 0x55, 0x55, 0x55, 0xc5, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xff, 0x7a, 0x66, 0x66, 0x66, 0x66, 0x66, 0xa7, 0xab, 0xdd, 0xdd, 0xcc, 0xcd, 0xcc, 0xcc, 0x59,
+  0xda, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x75, 0x67, 0x66, 0x66, 0x66, 0x76, 0x5a,
+  0x97, 0x17, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa1, 0x97, 0x17, 0x11, 0x66, 0x66, 0x66, 0x11, 0x71,
+  0x97, 0x16, 0x24, 0x77, 0x77, 0x77, 0x42, 0x72, 0x97, 0x16, 0x24, 0xaa, 0xaa, 0xaa, 0x42, 0x72,
+  0x97, 0x16, 0x44, 0x44, 0x44, 0x44, 0x44, 0x72, 0x97, 0x16, 0x24, 0x22, 0x22, 0x22, 0x42, 0x72,
+  0x97, 0x16, 0x24, 0x22, 0x22, 0x22, 0x03, 0x72, 0x97, 0x16, 0x24, 0x22, 0x22, 0x22, 0x00, 0x72,
+  0x9c, 0x75, 0x10, 0x12, 0x22, 0x32, 0x44, 0x44, 0xee, 0x6a, 0x07, 0x21, 0x21, 0x22, 0x33, 0x33,
+  0xdd, 0xad, 0x76, 0x10, 0x12, 0x12, 0x22, 0x22, 0xdd, 0xdd, 0x6a, 0x07, 0x11, 0x11, 0x11, 0x11,
+  0xee, 0xee, 0xae, 0x76, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xcc, 0xcc, 0x59, 0x77, 0x77, 0x77, 0x77,
+  0xb6, 0xcc, 0xcc, 0x9c, 0x55, 0xa6, 0xaa, 0xaa, 0x8a, 0xea, 0xee, 0xde, 0x8d, 0xa6, 0xdd, 0xdd,
+  0x76, 0xaa, 0xdd, 0xad, 0x8a, 0xda, 0xee, 0xee, 0x76, 0xaa, 0xdd, 0xad, 0x8a, 0x95, 0x8c, 0xa8,
+  0x76, 0xda, 0xee, 0xde, 0x8a, 0x95, 0xbc, 0xab, 0x76, 0x99, 0xcc, 0x9c, 0x89, 0xda, 0x6e, 0x66,
+  0x76, 0x99, 0xcc, 0x9c, 0x89, 0xa6, 0xbd, 0xaf, 0x76, 0xda, 0xee, 0xde, 0x8a, 0xa6, 0xbd, 0xaf,
+  0x76, 0xaa, 0xdd, 0xad, 0x8a, 0xda, 0xee, 0xee, 0x76, 0xaa, 0xee, 0xde, 0x8a, 0x95, 0xcc, 0xcc,
+  0x44, 0x44, 0x44, 0x44, 0xa6, 0xa8, 0xa8, 0xa8, 0x33, 0x33, 0x33, 0x33, 0x86, 0x8a, 0x8a, 0x8a,
+  0x22, 0x22, 0x22, 0x22, 0x66, 0xab, 0xa8, 0xa8, 0x11, 0x11, 0x11, 0x11, 0x95, 0x8b, 0x8a, 0x8a,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0xab, 0xa8, 0xa8, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8b, 0x8a, 0x8a,
+  0x77, 0x77, 0x77, 0xf5, 0x9f, 0xab, 0xa8, 0xa8, 0xdd, 0xdd, 0x7d, 0xf6, 0x9f, 0x8b, 0x8a, 0x8a,
+  0xee, 0xee, 0xde, 0xf6, 0x9f, 0xab, 0xa8, 0xa8, 0x67, 0xc6, 0x7c, 0xf6, 0x9f, 0x8b, 0x8a, 0x8a,
+  0x67, 0xcb, 0x7c, 0xf6, 0x9f, 0xab, 0xa8, 0xa8, 0x77, 0xe7, 0xde, 0xf6, 0x9f, 0x8b, 0x8a, 0x8a,
+  0x67, 0xdb, 0x7d, 0xf6, 0x9f, 0xab, 0xa8, 0xa8, 0x67, 0xdb, 0x7d, 0xf6, 0x9f, 0x88, 0x8a, 0x8a,
+  0xee, 0xee, 0xde, 0xf6, 0x9f, 0x8b, 0xa8, 0xa8, 0xcc, 0xcc, 0x7c, 0xf6, 0x9f, 0x8b, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0x18, 0x75, 0x57, 0x66, 0x75, 0x8a, 0x8a, 0x8a, 0x0a, 0x22, 0x22, 0x22, 0x22,
+  0xa8, 0xa8, 0xa8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0x30, 0x33, 0x33,
+  0xa8, 0xa8, 0xa8, 0x9b, 0xee, 0x31, 0xcc, 0xcc, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0x31, 0xcc, 0xcc,
+  0xa8, 0xa8, 0xa8, 0x9b, 0xee, 0xdb, 0xff, 0xff, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0x4b, 0xdd, 0xdd,
+  0xa8, 0xa8, 0xa8, 0x9b, 0xee, 0x4b, 0xdd, 0xdd, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0xdb, 0xff, 0xff,
+  0xa8, 0xa8, 0xa8, 0x9b, 0xee, 0x3b, 0xcc, 0xcc, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0x3b, 0xcc, 0xcc,
+  0xa8, 0xa8, 0xa8, 0x9b, 0xee, 0xdb, 0xff, 0xff, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0x4b, 0xdd, 0xdd,
+  0xa8, 0xa8, 0xa8, 0x9b, 0xee, 0x4b, 0xdd, 0xdd, 0x8a, 0x8a, 0x8a, 0x9b, 0xee, 0xd1, 0xff, 0xff,
+  0x79, 0x88, 0x97, 0x79, 0x88, 0x87, 0x24, 0x50, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x55,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x50, 0xbb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb5, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x5b, 0xdd, 0xdd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x5b, 0xbb, 0xab,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xbb, 0xda, 0x33, 0x61, 0x33, 0xcc, 0xcc, 0x6c, 0xcc, 0x63,
+  0x3a, 0x61, 0xaa, 0xcc, 0xcc, 0x6c, 0xcc, 0x63, 0x11, 0x11, 0x11, 0xff, 0xff, 0xcf, 0xcc, 0x63,
+  0x3a, 0x61, 0xae, 0xbb, 0xbb, 0x5b, 0xdd, 0x63, 0x3a, 0x61, 0xae, 0xbb, 0xbb, 0x5b, 0xbb, 0x63,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xbb, 0x63, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x6c, 0xdd, 0x63,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x6c, 0xcc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xcc, 0x63,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x9c, 0x88, 0x88, 0x88, 0x88, 0x88, 0xc9, 0xff, 0xff, 0xff, 0xee, 0xef, 0xee, 0xee, 0x7b, 0xdc,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc7, 0x97, 0x89, 0x88, 0x88, 0x88, 0x98, 0x7c, 0x9b,
+  0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc2, 0x87, 0x29, 0x22, 0x88, 0x88, 0x88, 0x22, 0x92, 0x87,
+  0x28, 0x36, 0x99, 0x99, 0x99, 0x63, 0x93, 0x87, 0x28, 0x36, 0xcc, 0xcc, 0xcc, 0x63, 0x93, 0x87,
+  0x28, 0x66, 0x66, 0x66, 0x66, 0x66, 0x93, 0x87, 0x28, 0x36, 0x33, 0x33, 0x33, 0x63, 0x93, 0x87,
+  0x28, 0x36, 0x33, 0x33, 0x33, 0x14, 0x93, 0x87, 0x28, 0x36, 0x33, 0x33, 0x33, 0x00, 0x93, 0x87,
+  0x42, 0x88, 0x78, 0x99, 0x87, 0x78, 0x99, 0x87, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x05, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdd, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xbb, 0x50, 0xb5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xc6, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0x60, 0xc6, 0xcc, 0x33, 0x16, 0x33, 0xcc,
+  0xc6, 0x60, 0xc6, 0xcc, 0xaa, 0x16, 0xa3, 0xcc, 0xc6, 0xc6, 0xdc, 0xdd, 0x11, 0x11, 0x11, 0xdd,
+  0xd6, 0x50, 0xb5, 0xbb, 0xea, 0x16, 0xa3, 0xbb, 0xb5, 0x50, 0xb5, 0xbb, 0xea, 0x16, 0xa3, 0xbb,
+  0xb5, 0xc6, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd6, 0x60, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xc6, 0x60, 0xc6, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x87, 0x77, 0x78, 0xa2, 0xa8, 0xa8, 0xa8, 0xa8, 0x33, 0x33, 0x33, 0x81, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x11, 0x11, 0x11, 0xb1, 0xa8, 0xa8, 0xa8, 0xa8, 0x00, 0x10, 0x99, 0xb6, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x44, 0x24, 0x99, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0x4c, 0x24, 0x99, 0xb6, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xde, 0xbd, 0x99, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0x5d, 0xb5, 0x99, 0xb6, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x5d, 0xb5, 0x99, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0xde, 0xbd, 0x99, 0xb6, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x4c, 0xb4, 0x99, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0x4c, 0xb4, 0x99, 0xb6, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xde, 0xbd, 0x99, 0xb6, 0xa8, 0xa8, 0xa8, 0xa8, 0x5d, 0xb5, 0xf9, 0xb9, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x5d, 0xb5, 0xf9, 0xb9, 0xa8, 0xa8, 0xa8, 0xa8, 0xde, 0x2d, 0xf9, 0xb9, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x65, 0x35, 0xee, 0xfd, 0xee, 0x12, 0xb4, 0xbb, 0x56, 0x36, 0xde, 0xef, 0x2e, 0x41, 0x88, 0x88,
+  0x65, 0x35, 0xfd, 0xee, 0x12, 0x84, 0x88, 0x88, 0x56, 0x36, 0xef, 0x2e, 0x41, 0xbb, 0xbb, 0x7b,
+  0x65, 0x25, 0x22, 0x12, 0x84, 0x88, 0x88, 0x97, 0x56, 0x56, 0x07, 0x41, 0x88, 0x88, 0x78, 0x49,
+  0x65, 0x65, 0x27, 0xb8, 0xbb, 0xbb, 0x3b, 0x14, 0x56, 0x56, 0x37, 0x84, 0x88, 0x88, 0x38, 0x34,
+  0x65, 0x65, 0x37, 0x84, 0x88, 0x88, 0x38, 0x34, 0x56, 0x56, 0xc7, 0x83, 0xbb, 0xbb, 0x3b, 0x24,
+  0x65, 0x65, 0xc7, 0x42, 0x88, 0x88, 0x38, 0x24, 0x56, 0x56, 0xc7, 0x42, 0x88, 0x88, 0x38, 0x24,
+  0x65, 0x65, 0xc7, 0x83, 0xbb, 0xbb, 0x3b, 0x24, 0x56, 0x56, 0xc7, 0x47, 0x88, 0x88, 0x38, 0x24,
+  0x65, 0x65, 0xc7, 0x7a, 0x84, 0x88, 0x38, 0x24, 0x56, 0x56, 0xc7, 0x3a, 0xb8, 0xbb, 0x3b, 0x24,
+  0x9e, 0xad, 0x9a, 0xa6, 0xda, 0xc6, 0xcc, 0x9c, 0xbb, 0x66, 0x66, 0x66, 0x66, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x78, 0x77, 0x77, 0x77, 0x77, 0x87, 0xca, 0xcc,
+  0xcc, 0xbc, 0xcb, 0xbb, 0xbb, 0x9b, 0xa6, 0xbb, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x69, 0xba,
+  0x88, 0x77, 0x77, 0x77, 0x77, 0xa8, 0x96, 0x98, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6a, 0x97,
+  0x22, 0x72, 0x77, 0x77, 0x27, 0x22, 0x68, 0x97, 0x52, 0x83, 0x88, 0x88, 0x38, 0x35, 0x68, 0x97,
+  0x52, 0xa3, 0xaa, 0xaa, 0x3a, 0x35, 0x68, 0x97, 0x52, 0x55, 0x55, 0x55, 0x55, 0x35, 0x68, 0x97,
+  0x52, 0x33, 0x33, 0x33, 0x33, 0x35, 0x68, 0x97, 0x52, 0x33, 0x33, 0x33, 0x43, 0x31, 0x68, 0x97,
+  0x52, 0x33, 0x33, 0x33, 0x03, 0x30, 0x68, 0x97, 0x52, 0x55, 0x55, 0x55, 0x55, 0x35, 0x68, 0x97,
+  0x21, 0xee, 0xef, 0xff, 0x72, 0x75, 0x75, 0x75, 0x14, 0xe2, 0xfe, 0xfe, 0x52, 0x57, 0x57, 0x57,
+  0x49, 0x21, 0xee, 0xef, 0x72, 0x75, 0x75, 0x75, 0xaa, 0x14, 0xe2, 0xfe, 0x52, 0x57, 0x57, 0x57,
+  0x99, 0x49, 0x21, 0x22, 0x72, 0x75, 0x75, 0x75, 0x99, 0x99, 0x14, 0x30, 0x57, 0x57, 0x57, 0x57,
+  0xaa, 0xaa, 0x99, 0x32, 0x75, 0x75, 0x75, 0x75, 0x94, 0x99, 0x44, 0x33, 0x57, 0x57, 0x57, 0x57,
+  0x94, 0x99, 0x44, 0x33, 0x75, 0x75, 0x75, 0x75, 0xa9, 0xaa, 0x39, 0x36, 0x57, 0x57, 0x57, 0x57,
+  0x94, 0x99, 0x24, 0x36, 0x75, 0x75, 0x75, 0x75, 0x94, 0x99, 0x24, 0x36, 0x57, 0x57, 0x57, 0x57,
+  0xa9, 0xaa, 0x39, 0x36, 0x75, 0x75, 0x75, 0x75, 0x94, 0x99, 0x84, 0x36, 0x57, 0x57, 0x57, 0x57,
+  0x94, 0x49, 0x68, 0x36, 0x75, 0x75, 0x75, 0x75, 0x99, 0x99, 0xb3, 0x36, 0x57, 0x57, 0x57, 0x57,
+  0xba, 0x5a, 0x26, 0x12, 0x89, 0x88, 0x86, 0x66, 0xab, 0xab, 0x15, 0x91, 0x98, 0x89, 0x66, 0x88,
+  0xba, 0xba, 0x15, 0x89, 0x68, 0x66, 0x66, 0x68, 0xab, 0xab, 0x85, 0x88, 0x86, 0x68, 0x66, 0x66,
+  0xba, 0xba, 0x5a, 0x65, 0x99, 0x88, 0x66, 0x88, 0xab, 0xab, 0xab, 0x5b, 0x88, 0x58, 0x00, 0x86,
+  0xba, 0xba, 0xba, 0xba, 0x55, 0x55, 0x00, 0x60, 0xab, 0xab, 0xab, 0xab, 0xab, 0x5b, 0x77, 0x33,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0x5a, 0x77, 0x3c, 0xab, 0xab, 0xab, 0xab, 0xab, 0x5b, 0xc3, 0x3c,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0x75, 0xcc, 0x73, 0xab, 0xab, 0xab, 0xab, 0x5b, 0xc7, 0x77, 0xc7,
+  0xba, 0xba, 0xba, 0x4a, 0x75, 0xcc, 0x33, 0x70, 0xab, 0xab, 0xab, 0x4b, 0xa4, 0x40, 0x50, 0x75,
+  0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0x4a, 0x5a, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x86, 0x66, 0x98, 0x11, 0x11, 0x99, 0x58, 0xba, 0x66, 0x68, 0x98, 0x19, 0x91, 0x96, 0x88, 0xa5,
+  0x66, 0x68, 0x89, 0x19, 0x91, 0x58, 0x85, 0xb5, 0x88, 0x96, 0x59, 0x98, 0x89, 0x58, 0x5b, 0xa8,
+  0x06, 0x96, 0x58, 0x88, 0x85, 0x58, 0xba, 0xba, 0x06, 0x86, 0x58, 0x55, 0x5b, 0xa5, 0xab, 0xab,
+  0x06, 0x00, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xba, 0x77, 0x03, 0xa5, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x37, 0x37, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xba, 0x77, 0x37, 0xa5, 0xab, 0xab, 0xab, 0xab, 0xab,
+  0x33, 0x70, 0x50, 0xba, 0xba, 0xba, 0xba, 0xba, 0x3c, 0x03, 0x03, 0xa5, 0xab, 0xab, 0xab, 0xab,
+  0xcc, 0x37, 0x40, 0x50, 0xaa, 0xba, 0xba, 0xba, 0x74, 0x34, 0x45, 0xa0, 0xaa, 0xab, 0xab, 0xab,
+  0xa4, 0x04, 0xaa, 0xaa, 0xaa, 0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xab,
+  0x65, 0x65, 0x05, 0x11, 0x11, 0x11, 0x11, 0x88, 0x56, 0x56, 0x06, 0x11, 0x11, 0x11, 0x01, 0x44,
+  0x65, 0x65, 0x15, 0x00, 0x72, 0x77, 0x04, 0x44, 0x56, 0x56, 0x00, 0x98, 0x99, 0x99, 0x47, 0x48,
+  0x65, 0x05, 0x98, 0x99, 0xaa, 0xba, 0x7b, 0x44, 0x56, 0x10, 0x94, 0x99, 0xa9, 0xaa, 0xbb, 0x42,
+  0x65, 0x10, 0x81, 0x99, 0x99, 0xaa, 0xaa, 0x40, 0x56, 0x10, 0x41, 0x98, 0x99, 0x99, 0x88, 0x00,
+  0x65, 0x10, 0x11, 0x88, 0x88, 0x88, 0x44, 0x00, 0x36, 0x40, 0x11, 0x81, 0x44, 0x44, 0x44, 0x30,
+  0x33, 0x40, 0x11, 0x41, 0x41, 0x44, 0x44, 0x30, 0x36, 0x30, 0x11, 0x11, 0x40, 0x44, 0x13, 0x30,
+  0x65, 0x33, 0x11, 0x11, 0x13, 0x04, 0x03, 0x33, 0x56, 0x36, 0x00, 0x03, 0x03, 0x30, 0x33, 0x33,
+  0x65, 0x65, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x44, 0x44, 0x44, 0x84, 0x04, 0x65, 0x65, 0x65, 0x44, 0x84, 0x44, 0x84, 0x04, 0x56, 0x56, 0x56,
+  0x44, 0x44, 0x48, 0x84, 0x04, 0x65, 0x65, 0x65, 0x44, 0x84, 0x49, 0x44, 0x04, 0x56, 0x56, 0x56,
+  0x44, 0x84, 0x49, 0x34, 0x04, 0x65, 0x65, 0x65, 0x44, 0x84, 0x44, 0x44, 0x03, 0x53, 0x56, 0x56,
+  0x04, 0x00, 0x77, 0x47, 0x03, 0x63, 0x65, 0x65, 0x82, 0xaa, 0xbb, 0x7a, 0x33, 0x33, 0x56, 0x56,
+  0x42, 0x88, 0x99, 0x09, 0x33, 0x63, 0x65, 0x65, 0x10, 0x84, 0x00, 0x30, 0x53, 0x56, 0x56, 0x56,
+  0x03, 0x03, 0x33, 0x33, 0x65, 0x65, 0x65, 0x65, 0x33, 0x33, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x63, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x97, 0x97, 0x11, 0xdf, 0xc3, 0xee, 0xee, 0xee, 0x79, 0x79, 0xf1, 0xdf, 0x53, 0xcc, 0xcc, 0xcc,
+  0x97, 0x97, 0xfa, 0xdf, 0x52, 0x55, 0x55, 0x55, 0x79, 0x79, 0xfa, 0xdf, 0x22, 0x22, 0x22, 0x22,
+  0x97, 0x97, 0xfa, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0x79, 0x79, 0xfa, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x97, 0x97, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0xda, 0xdd, 0x1d, 0xdd, 0xdd, 0xdd,
+  0x97, 0x97, 0xda, 0xdd, 0x1d, 0xdd, 0xdd, 0xdd, 0x79, 0x79, 0x8a, 0x88, 0x18, 0x81, 0x88, 0x88,
+  0x97, 0x97, 0x33, 0x33, 0x11, 0x11, 0x33, 0x33, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x87, 0x06, 0x33, 0x33, 0x33, 0x33, 0x33, 0x71, 0x87, 0x06, 0x13, 0x11, 0x11, 0x11, 0x31, 0x71,
+  0x47, 0x06, 0x13, 0x11, 0x11, 0x11, 0x31, 0x71, 0x46, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67,
+  0x66, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x6b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xeb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xb9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xbd, 0xbb, 0xbb, 0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0x7d, 0x75, 0x77, 0x57, 0x75, 0x77, 0x77, 0x75,
+  0x31, 0x66, 0xcc, 0x6c, 0x46, 0x50, 0xbb, 0xbb, 0x31, 0x61, 0x66, 0x66, 0x46, 0xc6, 0xdd, 0xdd,
+  0x31, 0x10, 0x11, 0x66, 0x46, 0x33, 0x33, 0x33, 0x31, 0x33, 0x33, 0x33, 0x33, 0x99, 0x99, 0x99,
+  0x33, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0x9e, 0xee, 0xee, 0xee, 0xee, 0x2e, 0xee, 0xee, 0x9e, 0x77, 0x99, 0x92, 0x99, 0x29, 0x99, 0x99,
+  0x79, 0x44, 0x44, 0x22, 0x44, 0x22, 0x42, 0x44, 0x4f, 0x8a, 0x2a, 0x22, 0x82, 0x22, 0x22, 0x8a,
+  0x4f, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x4e, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x49, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x44, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x99, 0x99, 0x39, 0xc2, 0x6c, 0x78, 0x75, 0x75, 0xbb, 0xbb, 0xab, 0xc1, 0x6c, 0x58, 0x57, 0x57,
+  0x11, 0x11, 0x11, 0xc1, 0x6c, 0x78, 0x75, 0x75, 0x66, 0x66, 0x66, 0xc6, 0x6c, 0x58, 0x57, 0x57,
+  0xcc, 0xcc, 0xcc, 0xcc, 0x6c, 0x78, 0x75, 0x75, 0xdd, 0xdd, 0xdd, 0xdd, 0x6d, 0x58, 0x57, 0x57,
+  0xdd, 0xdd, 0xdd, 0xdd, 0x6d, 0x78, 0x75, 0x75, 0xcc, 0xcc, 0xcc, 0xcc, 0x4c, 0x58, 0x57, 0x57,
+  0xcc, 0xcc, 0xcc, 0xcc, 0x4c, 0x78, 0x75, 0x75, 0x66, 0x06, 0x66, 0x66, 0x40, 0x58, 0x57, 0x57,
+  0x22, 0x02, 0x22, 0x22, 0x20, 0x72, 0x75, 0x75, 0x57, 0x00, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x97, 0x97, 0x97, 0x8a, 0xdd, 0x43, 0xbb, 0xbb, 0x79, 0x79, 0x79, 0x8a, 0xdd, 0x52, 0x55, 0x55,
+  0x97, 0x97, 0x97, 0x8a, 0xdd, 0x22, 0x22, 0x22, 0x79, 0x79, 0x79, 0x8a, 0xdd, 0x88, 0x88, 0x88,
+  0x97, 0x97, 0x97, 0x8a, 0xdd, 0xdd, 0xdd, 0xdd, 0x79, 0x79, 0x79, 0x8a, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0x97, 0x97, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x79, 0x6a, 0xdd, 0x1d, 0xdd, 0xdd,
+  0x97, 0x97, 0x97, 0x6a, 0xdd, 0x1d, 0xdd, 0xdd, 0x79, 0x79, 0x79, 0x6a, 0x88, 0x18, 0x88, 0x88,
+  0x97, 0x97, 0x97, 0x33, 0x33, 0x13, 0x31, 0x33, 0x79, 0x79, 0x79, 0x79, 0x79, 0x19, 0x71, 0x79,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x4b, 0xee, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xbb, 0x53,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x03, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x22, 0x02,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x88, 0x22, 0xff, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xf8,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0x81, 0x88, 0x88, 0x18, 0x88, 0x88, 0x88, 0xd8,
+  0x11, 0x33, 0x13, 0x11, 0x11, 0x31, 0x33, 0x86, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0xfa,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xfa, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0xda,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x8a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x3a,
+  0x06, 0x33, 0x33, 0x33, 0x33, 0x33, 0x71, 0x64, 0x06, 0x13, 0x11, 0x11, 0x11, 0x31, 0x71, 0x64,
+  0x06, 0x13, 0x11, 0x11, 0x11, 0x31, 0x71, 0x64, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x64,
+  0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x6b, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbe,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xe5, 0x7e,
+  0xbb, 0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb5, 0x7b, 0x55, 0x55, 0x55, 0x77, 0x77, 0x77, 0x55, 0x77,
+  0xc6, 0x50, 0xb5, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x61, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x10, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xed, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x77, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x99,
+  0x24, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x22, 0x82, 0x8a, 0x22, 0x22, 0x22, 0x82, 0x2a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x4b, 0x34, 0xd8, 0x18, 0x97, 0x97, 0x97, 0x97, 0x55, 0x25, 0xd8, 0x18, 0x71, 0x79, 0x79, 0x79,
+  0x22, 0x22, 0xd8, 0xa8, 0x91, 0x97, 0x97, 0x97, 0x88, 0x88, 0xd8, 0xa8, 0x79, 0x79, 0x79, 0x79,
+  0xdd, 0xdd, 0xdd, 0xa8, 0x97, 0x97, 0x97, 0x97, 0xff, 0xff, 0xff, 0xa8, 0x79, 0x79, 0x79, 0x79,
+  0xff, 0xff, 0xff, 0xa8, 0x97, 0x97, 0x97, 0x97, 0xdd, 0xdd, 0xdd, 0xa6, 0x79, 0x79, 0x79, 0x79,
+  0xd1, 0xdd, 0xdd, 0xa6, 0x97, 0x97, 0x97, 0x97, 0x81, 0x88, 0x88, 0xa6, 0x79, 0x79, 0x79, 0x79,
+  0x31, 0x33, 0x33, 0x33, 0x97, 0x97, 0x97, 0x97, 0x71, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x97, 0x97, 0xfa, 0x2d, 0xc5, 0xcc, 0x3c, 0x25, 0x79, 0x79, 0xfa, 0x2d, 0x55, 0x55, 0x35, 0x20,
+  0x97, 0x97, 0xfa, 0x3d, 0x22, 0x22, 0x22, 0x20, 0x79, 0x79, 0xfa, 0xdd, 0xdd, 0xdd, 0x2d, 0x22,
+  0x97, 0x97, 0xfa, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x79, 0x79, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0x97, 0xda, 0xdd, 0xdd, 0xdd, 0x8d, 0xff, 0x79, 0x79, 0xda, 0x1d, 0xdd, 0xdd, 0x8d, 0xdd,
+  0x97, 0x97, 0x8a, 0x18, 0x81, 0x88, 0x88, 0xdd, 0x79, 0x79, 0x33, 0x13, 0x31, 0x31, 0x63, 0x88,
+  0x97, 0x97, 0x97, 0x11, 0x11, 0x11, 0xa7, 0xff, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0xa9, 0xff,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xa7, 0xdd, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0xa9, 0x18,
+  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xa7, 0x13, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x30, 0x11, 0x11, 0x11, 0x11, 0x13, 0x47, 0x46, 0x30, 0x11, 0x11, 0x11, 0x11, 0x13, 0x47, 0x26,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x46, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0xe6,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x79,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xc7, 0xbb, 0xbb, 0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xa7,
+  0x77, 0x77, 0x57, 0x75, 0x77, 0x77, 0x57, 0xc7, 0xac, 0xac, 0x55, 0x55, 0xac, 0xac, 0x5c, 0xac,
+  0x66, 0x66, 0xe3, 0x49, 0xa8, 0xa8, 0xa8, 0xa8, 0x11, 0x11, 0xe3, 0x49, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x33, 0x33, 0xe4, 0x49, 0xa8, 0xa8, 0xa8, 0xa8, 0xee, 0xee, 0xee, 0x49, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xee, 0xee, 0xee, 0x49, 0xa8, 0xa8, 0xa8, 0xa8, 0xff, 0xff, 0xff, 0x49, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xee, 0xee, 0xe2, 0x47, 0xa8, 0xa8, 0xa8, 0xa8, 0xee, 0xee, 0xe2, 0x47, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x99, 0x29, 0x92, 0x47, 0xa8, 0xa8, 0xa8, 0xa8, 0x44, 0x24, 0x42, 0x44, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0x28, 0x22, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x33, 0x57, 0x57, 0x57, 0x57, 0x33, 0x57,
+  0x75, 0x43, 0x33, 0x25, 0x75, 0x33, 0x34, 0x75, 0x37, 0x22, 0x01, 0x13, 0x32, 0x10, 0x33, 0x52,
+  0x25, 0x44, 0x23, 0x02, 0x21, 0x32, 0x11, 0x72, 0x57, 0x13, 0x44, 0x34, 0x12, 0x11, 0x21, 0x57,
+  0x75, 0x3d, 0x23, 0x14, 0x10, 0x22, 0xd2, 0x75, 0x57, 0xd7, 0x12, 0x22, 0x22, 0x30, 0x5d, 0x57,
+  0x75, 0x25, 0x21, 0xd3, 0x3d, 0x12, 0x73, 0x75, 0x57, 0x37, 0xd2, 0x57, 0x57, 0x3d, 0x53, 0x57,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0x75, 0x33, 0x33, 0x75, 0x75, 0x75, 0x57, 0x57, 0x37, 0x9c, 0x9c, 0x53, 0x57, 0x57,
+  0x75, 0x75, 0x93, 0x9c, 0x9c, 0x39, 0x75, 0x75, 0x57, 0x57, 0x93, 0x9c, 0x9c, 0x39, 0x57, 0x57,
+  0x75, 0x75, 0x43, 0x11, 0x11, 0x34, 0x75, 0x75, 0x57, 0x57, 0x12, 0x11, 0x11, 0x21, 0x57, 0x57,
+  0x75, 0x75, 0x12, 0x99, 0x99, 0x21, 0x75, 0x75, 0x57, 0x57, 0x12, 0x22, 0x22, 0x21, 0x57, 0x57,
+  0x75, 0x75, 0x12, 0x11, 0x11, 0x21, 0x75, 0x75, 0x57, 0x57, 0x22, 0x22, 0x22, 0x22, 0x57, 0x57,
+  0x75, 0x75, 0x75, 0x12, 0x21, 0x75, 0x75, 0x75, 0x57, 0x57, 0x57, 0x42, 0x21, 0x57, 0x57, 0x57,
+  0x75, 0x75, 0xd5, 0x42, 0x21, 0x7d, 0x75, 0x75, 0x57, 0x57, 0xdd, 0x42, 0x21, 0xdd, 0x57, 0x57,
+  0x75, 0x75, 0xdd, 0x2d, 0xd2, 0xdd, 0x75, 0x75, 0x57, 0x57, 0xd7, 0xdd, 0xdd, 0x5d, 0x57, 0x57,
+};
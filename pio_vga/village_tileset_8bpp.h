@@ -0,0 +1,1814 @@
+// Art by LimeZu from itch.io (https://limezu.itch.io/serenevillagerevamped)
+// Licensed under CC BY 4.0 (https://creativecommons.org/licenses/by/4.0/)
+
+int tileset_8bpp_count = 112;
+int tileset_8bpp_num_colours = 83;
+
+const uint16_t tileset_8bpp_palette[] = {
+  0x330e, 0x372f, 0x2679, 0x2a7a, 0x2239, 0x2ead, 0x4af9, 0x1551,
+  0x19b7, 0x77b7, 0x7b6a, 0x4e09, 0x6208, 0x6e08, 0x768a, 0x396a,
+  0x322a, 0x2313, 0x2357, 0x2d08, 0x31a9, 0x2d68, 0x28e7, 0x7fd7,
+  0x7fff, 0x1eff, 0x431d, 0x0e7c, 0x26ca, 0x3556, 0x73fe, 0x529f,
+  0x3977, 0x35ba, 0x4a54, 0x7bfb, 0x77f6, 0x735b, 0x152d, 0x2175,
+  0x25fa, 0x3f1e, 0x369e, 0x42be, 0x2e1b, 0x473e, 0x3afc, 0x2e38,
+  0x25d6, 0x2e7a, 0x25d5, 0x3a13, 0x3e54, 0x3e96, 0x31af, 0x217f,
+  0x1cfc, 0x18db, 0x2eae, 0x7f2b, 0x7249, 0x5a93, 0x5631, 0x41ad,
+  0x292b, 0x14b3, 0x14b5, 0x3f1d, 0x25b6, 0x2e18, 0x3abc, 0x61a8,
+  0x4efa, 0x4277, 0x2155, 0x1935, 0x25b8, 0x1d76, 0x1f5f, 0x16de,
+  0x0e5d, 0x35f3, 0x3192,
+};
+
+const uint8_t __attribute__ ((aligned (4))) tileset_8bpp_data[] = {
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x07, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x08, 0x05, 0x01,
+  0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x05, 0x00,
+  0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x07, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x08, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x08, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x04, 0x04,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x04,
+  0x02, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x05,
+  0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x07, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x03, 0x02,
+  0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x04, 0x04,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03,
+  0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x03, 0x02,
+  0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x04, 0x04,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x06, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x06, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x05, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02,
+  0x00, 0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03,
+  0x01, 0x05, 0x07, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x03, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x01, 0x00, 0x01, 0x00, 0x03, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x00, 0x01, 0x00, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x01, 0x00, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x09, 0x09, 0x09,
+  0x00, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x01, 0x03, 0x08, 0x08, 0x08, 0x08, 0x03, 0x09, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x00, 0x03, 0x08, 0x08, 0x08, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x01, 0x03, 0x08, 0x08, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x00, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x01, 0x03, 0x08, 0x0a, 0x0b, 0x0b, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x00, 0x03, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x01, 0x03, 0x09, 0x0a, 0x0c, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x09, 0x0a, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x09, 0x0a, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x03, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x03, 0x01, 0x00, 0x01, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x01, 0x00, 0x01,
+  0x09, 0x09, 0x09, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x01, 0x00,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x01,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x03, 0x08, 0x08, 0x08, 0x08, 0x03, 0x00,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x03, 0x01,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 0x08, 0x03, 0x00,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0c, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 0x03, 0x01,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0b, 0x0b, 0x0a, 0x08, 0x03, 0x00,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0c, 0x0a, 0x09, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0a, 0x09, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x10, 0x10, 0x0f, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x0f, 0x10, 0x11, 0x10, 0x0f,
+  0x01, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x01, 0x0f, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x0f,
+  0x00, 0x01, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10,
+  0x01, 0x00, 0x01, 0x0f, 0x10, 0x12, 0x11, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x10, 0x11, 0x10, 0x0f,
+  0x00, 0x01, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x0f,
+  0x01, 0x00, 0x01, 0x0f, 0x10, 0x10, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10,
+  0x00, 0x01, 0x00, 0x0f, 0x10, 0x0f, 0x0f, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11,
+  0x01, 0x00, 0x01, 0x0f, 0x0f, 0x10, 0x0f, 0x11, 0x11, 0x13, 0x13, 0x12, 0x11, 0x12, 0x11, 0x12,
+  0x00, 0x01, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0x13, 0x12, 0x11, 0x11, 0x12,
+  0x0f, 0x0f, 0x10, 0x11, 0x11, 0x12, 0x14, 0x10, 0x10, 0x11, 0x10, 0x13, 0x11, 0x12, 0x12, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12, 0x11,
+  0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x10, 0x13, 0x11, 0x11, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x0f, 0x0f, 0x10, 0x0f, 0x01, 0x00, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x0f, 0x0f, 0x10, 0x11, 0x11, 0x12, 0x14, 0x10, 0x10, 0x11, 0x10, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x00, 0x01, 0x00,
+  0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x0f, 0x0f, 0x0f, 0x00, 0x01,
+  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x0f, 0x10, 0x10, 0x0f, 0x00,
+  0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x10, 0x11, 0x10, 0x0f,
+  0x12, 0x12, 0x11, 0x0f, 0x0f, 0x0f, 0x11, 0x0f, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x0f,
+  0x11, 0x11, 0x11, 0x0f, 0x10, 0x10, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10,
+  0x10, 0x11, 0x11, 0x0f, 0x10, 0x12, 0x11, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x10, 0x11, 0x10, 0x0f,
+  0x00, 0x01, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x0f,
+  0x01, 0x00, 0x01, 0x0f, 0x10, 0x10, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10,
+  0x00, 0x01, 0x00, 0x0f, 0x10, 0x0f, 0x0f, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11,
+  0x01, 0x00, 0x01, 0x0f, 0x0f, 0x10, 0x0f, 0x11, 0x11, 0x13, 0x13, 0x12, 0x11, 0x12, 0x11, 0x12,
+  0x00, 0x01, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0x13, 0x12, 0x11, 0x11, 0x12,
+  0x0f, 0x0f, 0x10, 0x11, 0x11, 0x12, 0x14, 0x10, 0x10, 0x11, 0x10, 0x13, 0x11, 0x12, 0x12, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12, 0x11,
+  0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x10, 0x13, 0x11, 0x11, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x0f, 0x0f, 0x10, 0x0f, 0x01, 0x00, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x0f, 0x0f, 0x10, 0x11, 0x11, 0x12, 0x14, 0x10, 0x10, 0x11, 0x10, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x00, 0x01, 0x00,
+  0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x10, 0x13, 0x01, 0x00, 0x01,
+  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x10, 0x13, 0x00, 0x01, 0x00,
+  0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x13, 0x00, 0x01, 0x00,
+  0x11, 0x11, 0x11, 0x12, 0x12, 0x10, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x16, 0x00, 0x01,
+  0x10, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x16, 0x01, 0x00,
+  0x00, 0x01, 0x17, 0x18, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x17, 0x17, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x17, 0x18, 0x01, 0x00,
+  0x17, 0x18, 0x19, 0x1a, 0x17, 0x18, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x17, 0x17, 0x00, 0x01,
+  0x17, 0x17, 0x1b, 0x19, 0x17, 0x17, 0x01, 0x00, 0x01, 0x00, 0x17, 0x18, 0x19, 0x1a, 0x17, 0x18,
+  0x1c, 0x1c, 0x17, 0x18, 0x1c, 0x1c, 0x00, 0x01, 0x00, 0x01, 0x17, 0x17, 0x1b, 0x19, 0x17, 0x17,
+  0x01, 0x00, 0x17, 0x17, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x1c, 0x1c, 0x17, 0x18, 0x1c, 0x1c,
+  0x00, 0x01, 0x1c, 0x1c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x17, 0x17, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x1c, 0x1c, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x17, 0x18, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x17, 0x17, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x17, 0x18, 0x00, 0x01, 0x00,
+  0x00, 0x17, 0x18, 0x19, 0x1a, 0x17, 0x18, 0x01, 0x00, 0x01, 0x00, 0x17, 0x17, 0x01, 0x00, 0x01,
+  0x01, 0x17, 0x17, 0x1b, 0x19, 0x17, 0x17, 0x00, 0x01, 0x17, 0x18, 0x19, 0x1a, 0x17, 0x18, 0x00,
+  0x00, 0x1c, 0x1c, 0x17, 0x18, 0x1c, 0x1c, 0x01, 0x00, 0x17, 0x17, 0x1b, 0x19, 0x17, 0x17, 0x01,
+  0x01, 0x00, 0x01, 0x17, 0x17, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x17, 0x18, 0x1c, 0x1c, 0x00,
+  0x00, 0x01, 0x00, 0x1c, 0x1c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x17, 0x17, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x07, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01,
+  0x05, 0x05, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x08, 0x05, 0x01, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x01, 0x00, 0x01,
+  0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x05, 0x00, 0x01, 0x00,
+  0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x04, 0x07, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x07, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01,
+  0x01, 0x01, 0x05, 0x04, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x05, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05,
+  0x01, 0x00, 0x01, 0x05, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x04, 0x04, 0x04,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x07, 0x04, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x07, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x08, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00, 0x01,
+  0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x07, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x13, 0x01, 0x00, 0x13, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x0f, 0x13, 0x1d, 0x1d, 0x0f, 0x13, 0x1d, 0x1d, 0x13, 0x13, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x13, 0x1e, 0x1f, 0x0f, 0x1d, 0x0f, 0x13, 0x1d, 0x0f, 0x1f, 0x1e, 0x13, 0x00, 0x01,
+  0x01, 0x13, 0x20, 0x1f, 0x21, 0x20, 0x0f, 0x13, 0x13, 0x13, 0x20, 0x21, 0x1f, 0x20, 0x13, 0x00,
+  0x00, 0x13, 0x0f, 0x1d, 0x1d, 0x0f, 0x13, 0x20, 0x20, 0x20, 0x0f, 0x20, 0x20, 0x0f, 0x13, 0x01,
+  0x01, 0x13, 0x1d, 0x0f, 0x13, 0x20, 0x20, 0x21, 0x1f, 0x21, 0x20, 0x13, 0x0f, 0x20, 0x13, 0x00,
+  0x00, 0x01, 0x13, 0x1d, 0x13, 0x0f, 0x0f, 0x1f, 0x1e, 0x1f, 0x20, 0x13, 0x20, 0x13, 0x00, 0x01,
+  0x01, 0x22, 0x0f, 0x0f, 0x13, 0x1d, 0x20, 0x21, 0x1f, 0x21, 0x0f, 0x13, 0x0f, 0x22, 0x01, 0x00,
+  0x00, 0x13, 0x12, 0x11, 0x10, 0x13, 0x1d, 0x20, 0x0f, 0x20, 0x1d, 0x0f, 0x14, 0x13, 0x00, 0x01,
+  0x01, 0x13, 0x11, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x14, 0x13, 0x01, 0x00,
+  0x00, 0x22, 0x13, 0x13, 0x12, 0x11, 0x10, 0x13, 0x13, 0x12, 0x11, 0x10, 0x13, 0x22, 0x00, 0x01,
+  0x01, 0x00, 0x22, 0x13, 0x11, 0x10, 0x10, 0x14, 0x13, 0x11, 0x10, 0x14, 0x13, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x22, 0x13, 0x13, 0x13, 0x13, 0x22, 0x13, 0x13, 0x13, 0x22, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x13, 0x01, 0x00, 0x13, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x0f, 0x13, 0x18, 0x18, 0x0f, 0x13, 0x18, 0x18, 0x13, 0x13, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x13, 0x23, 0x24, 0x0f, 0x25, 0x0f, 0x13, 0x18, 0x0f, 0x24, 0x23, 0x13, 0x00, 0x01,
+  0x01, 0x13, 0x18, 0x24, 0x0e, 0x25, 0x0f, 0x13, 0x13, 0x13, 0x25, 0x0e, 0x24, 0x18, 0x13, 0x00,
+  0x00, 0x13, 0x0f, 0x25, 0x25, 0x0f, 0x13, 0x18, 0x18, 0x18, 0x0f, 0x25, 0x25, 0x0f, 0x13, 0x01,
+  0x01, 0x13, 0x25, 0x0f, 0x13, 0x18, 0x18, 0x0e, 0x24, 0x0e, 0x18, 0x13, 0x0f, 0x18, 0x13, 0x00,
+  0x00, 0x01, 0x13, 0x25, 0x13, 0x0f, 0x0f, 0x24, 0x23, 0x24, 0x18, 0x13, 0x18, 0x13, 0x00, 0x01,
+  0x01, 0x22, 0x0f, 0x0f, 0x13, 0x18, 0x18, 0x0e, 0x24, 0x0e, 0x0f, 0x13, 0x0f, 0x22, 0x01, 0x00,
+  0x00, 0x13, 0x12, 0x11, 0x10, 0x13, 0x25, 0x25, 0x0f, 0x25, 0x25, 0x0f, 0x14, 0x13, 0x00, 0x01,
+  0x01, 0x13, 0x11, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x14, 0x13, 0x01, 0x00,
+  0x00, 0x22, 0x13, 0x13, 0x12, 0x11, 0x10, 0x13, 0x13, 0x12, 0x11, 0x10, 0x13, 0x22, 0x00, 0x01,
+  0x01, 0x00, 0x22, 0x13, 0x11, 0x10, 0x10, 0x14, 0x13, 0x11, 0x10, 0x14, 0x13, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x22, 0x13, 0x13, 0x13, 0x13, 0x22, 0x13, 0x13, 0x13, 0x22, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x04, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x07, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x08, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x07, 0x04, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x08, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x08, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x08, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x08, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x08, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x03, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x03, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x08, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x08, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x08, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x03, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x03, 0x08, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x14, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12,
+  0x01, 0x00, 0x13, 0x13, 0x14, 0x14, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12,
+  0x00, 0x13, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11,
+  0x13, 0x10, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11,
+  0x14, 0x13, 0x13, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x11, 0x11, 0x10,
+  0x01, 0x00, 0x13, 0x11, 0x10, 0x10, 0x14, 0x12, 0x10, 0x14, 0x14, 0x11, 0x11, 0x11, 0x10, 0x14,
+  0x00, 0x01, 0x13, 0x10, 0x10, 0x10, 0x12, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x10,
+  0x01, 0x13, 0x15, 0x15, 0x14, 0x14, 0x11, 0x11, 0x10, 0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x13, 0x10, 0x10, 0x10, 0x15, 0x14, 0x14, 0x10, 0x12, 0x12, 0x11, 0x14, 0x10, 0x14, 0x14, 0x14,
+  0x13, 0x14, 0x11, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x11, 0x14, 0x10, 0x14, 0x10, 0x10, 0x10,
+  0x14, 0x16, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11,
+  0x01, 0x00, 0x16, 0x14, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12,
+  0x00, 0x01, 0x16, 0x10, 0x11, 0x11, 0x11, 0x10, 0x15, 0x14, 0x14, 0x10, 0x10, 0x11, 0x12, 0x12,
+  0x01, 0x16, 0x14, 0x11, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x10, 0x11, 0x14, 0x10, 0x11,
+  0x00, 0x16, 0x14, 0x10, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x10, 0x10,
+  0x01, 0x14, 0x16, 0x15, 0x14, 0x14, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10,
+  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x10, 0x13, 0x11, 0x10, 0x14,
+  0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x13, 0x13, 0x14, 0x14, 0x14, 0x10,
+  0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x13, 0x10, 0x10, 0x10,
+  0x11, 0x11, 0x11, 0x12, 0x12, 0x10, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x16, 0x14, 0x14,
+  0x10, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x16, 0x10, 0x10,
+  0x10, 0x11, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x16, 0x11, 0x11,
+  0x14, 0x11, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x16, 0x12, 0x12,
+  0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x11, 0x15, 0x14, 0x14, 0x16, 0x12,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x16,
+  0x14, 0x10, 0x10, 0x14, 0x15, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x10, 0x16,
+  0x10, 0x11, 0x10, 0x14, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x16, 0x14,
+  0x11, 0x11, 0x11, 0x10, 0x14, 0x15, 0x15, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x16, 0x15, 0x15,
+  0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x10, 0x16, 0x14,
+  0x11, 0x10, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x15, 0x14, 0x10, 0x10, 0x10, 0x11, 0x14, 0x16,
+  0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15, 0x15, 0x15, 0x15, 0x10, 0x10, 0x16,
+  0x15, 0x10, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x16,
+  0x10, 0x11, 0x11, 0x11, 0x0f, 0x14, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12,
+  0x14, 0x11, 0x13, 0x13, 0x14, 0x14, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12,
+  0x14, 0x13, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11,
+  0x13, 0x10, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11,
+  0x14, 0x13, 0x13, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x11, 0x11, 0x10,
+  0x10, 0x11, 0x13, 0x11, 0x10, 0x10, 0x14, 0x12, 0x10, 0x14, 0x14, 0x11, 0x11, 0x11, 0x10, 0x14,
+  0x11, 0x11, 0x13, 0x10, 0x10, 0x10, 0x12, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x10,
+  0x12, 0x13, 0x15, 0x15, 0x14, 0x14, 0x11, 0x11, 0x10, 0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x13, 0x10, 0x10, 0x10, 0x15, 0x14, 0x14, 0x10, 0x12, 0x12, 0x11, 0x14, 0x10, 0x14, 0x14, 0x14,
+  0x13, 0x14, 0x11, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x11, 0x14, 0x10, 0x14, 0x10, 0x10, 0x10,
+  0x14, 0x16, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11,
+  0x15, 0x14, 0x16, 0x14, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12,
+  0x15, 0x15, 0x16, 0x10, 0x11, 0x11, 0x11, 0x10, 0x15, 0x14, 0x14, 0x10, 0x10, 0x11, 0x12, 0x12,
+  0x15, 0x16, 0x14, 0x11, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x10, 0x11, 0x14, 0x10, 0x11,
+  0x14, 0x16, 0x14, 0x10, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x10, 0x10,
+  0x15, 0x14, 0x16, 0x15, 0x14, 0x14, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10,
+  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x10, 0x13, 0x11, 0x10, 0x14,
+  0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x13, 0x13, 0x14, 0x14, 0x14, 0x10,
+  0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x13, 0x10, 0x10, 0x10,
+  0x11, 0x11, 0x11, 0x12, 0x12, 0x10, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x16, 0x14, 0x14,
+  0x10, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x16, 0x10, 0x10,
+  0x10, 0x11, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x16, 0x11, 0x11,
+  0x14, 0x11, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x16, 0x12, 0x12,
+  0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x11, 0x15, 0x14, 0x14, 0x16, 0x12,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x16,
+  0x14, 0x10, 0x10, 0x14, 0x15, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x10, 0x16,
+  0x10, 0x11, 0x10, 0x14, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x16, 0x14,
+  0x11, 0x11, 0x11, 0x10, 0x14, 0x15, 0x15, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x16, 0x15, 0x15,
+  0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x10, 0x16, 0x14,
+  0x11, 0x10, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x15, 0x14, 0x10, 0x10, 0x10, 0x11, 0x14, 0x16,
+  0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15, 0x15, 0x15, 0x15, 0x10, 0x10, 0x16,
+  0x15, 0x10, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x16,
+  0x10, 0x11, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x16, 0x00, 0x01,
+  0x14, 0x11, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x16, 0x01, 0x00,
+  0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x11, 0x15, 0x14, 0x14, 0x16, 0x01,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x16,
+  0x14, 0x10, 0x10, 0x14, 0x15, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x10, 0x16,
+  0x10, 0x11, 0x10, 0x14, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x16, 0x14,
+  0x11, 0x11, 0x11, 0x10, 0x14, 0x15, 0x15, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x16, 0x00, 0x01,
+  0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x10, 0x16, 0x00,
+  0x11, 0x10, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x15, 0x14, 0x10, 0x10, 0x10, 0x11, 0x14, 0x16,
+  0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15, 0x15, 0x15, 0x15, 0x10, 0x10, 0x16,
+  0x15, 0x10, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x16,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x14, 0x16, 0x01, 0x00,
+  0x15, 0x15, 0x14, 0x15, 0x14, 0x10, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x14, 0x14, 0x16, 0x01,
+  0x15, 0x15, 0x14, 0x15, 0x10, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x14, 0x16, 0x00,
+  0x14, 0x14, 0x15, 0x10, 0x10, 0x16, 0x14, 0x10, 0x10, 0x14, 0x14, 0x16, 0x00, 0x16, 0x14, 0x01,
+  0x15, 0x26, 0x15, 0x10, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x14, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x13, 0x0f, 0x27, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x28, 0x29, 0x29, 0x2a, 0x27, 0x0f, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x2a, 0x29, 0x29, 0x2a, 0x28, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x2a, 0x29, 0x2b, 0x2a, 0x28, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x2c, 0x29, 0x29, 0x2a, 0x2c, 0x0f, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x2a, 0x29, 0x29, 0x2a, 0x28, 0x27, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x2a, 0x29, 0x29, 0x2a, 0x28, 0x27, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x2a, 0x2b, 0x29, 0x2a, 0x28, 0x0f, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x2a, 0x29, 0x29, 0x2a, 0x28, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x01, 0x00,
+  0x00, 0x13, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x13, 0x01,
+  0x01, 0x13, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x13, 0x00,
+  0x00, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x16, 0x01,
+  0x01, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x16, 0x00,
+  0x00, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x30, 0x27, 0x2f, 0x2f, 0x27, 0x2f, 0x30, 0x16, 0x01,
+  0x01, 0x16, 0x2f, 0x27, 0x27, 0x30, 0x27, 0x27, 0x30, 0x27, 0x30, 0x27, 0x27, 0x30, 0x16, 0x00,
+  0x00, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x16, 0x01,
+  0x01, 0x16, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x16, 0x00,
+  0x00, 0x01, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x30, 0x30, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x22, 0x16, 0x2f, 0x30, 0x16, 0x22, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x22, 0x22, 0x16, 0x2f, 0x30, 0x16, 0x22, 0x22, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x22, 0x22, 0x22, 0x16, 0x16, 0x22, 0x22, 0x22, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x07, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x08, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x01, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00, 0x01,
+  0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x07, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x00,
+  0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x04, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x07, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x08, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x01, 0x05, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x07, 0x04, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x08, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x05, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x08, 0x05, 0x05,
+  0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x08,
+  0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x07, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01,
+  0x01, 0x05, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x05, 0x01, 0x00,
+  0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05,
+  0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08,
+  0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x04, 0x04, 0x04,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x07, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01,
+  0x01, 0x05, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x05, 0x01, 0x00,
+  0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05,
+  0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08,
+  0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x04, 0x04, 0x04,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x06, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x05, 0x07, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02,
+  0x00, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02,
+  0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03,
+  0x01, 0x00, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x05, 0x05, 0x08, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x08, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+  0x00, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x08, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x08, 0x03, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x08, 0x03, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x03, 0x08, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x00, 0x08, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x01, 0x03, 0x08, 0x03, 0x09, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x01, 0x00, 0x01, 0x03, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x03, 0x08, 0x08, 0x08, 0x03, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x03, 0x03, 0x08, 0x08, 0x03, 0x03, 0x09, 0x09, 0x09,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x03, 0x03, 0x08, 0x08, 0x08, 0x08,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x08, 0x08, 0x03, 0x03, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x03, 0x03, 0x08, 0x08,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x08, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x03, 0x08, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x03, 0x08, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x08, 0x03, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x09, 0x03, 0x08, 0x01, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x09, 0x03, 0x08, 0x03, 0x00, 0x01,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x08, 0x08, 0x03, 0x00, 0x01, 0x00,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x03, 0x08, 0x08, 0x08, 0x03, 0x03, 0x00, 0x01, 0x00, 0x01,
+  0x09, 0x09, 0x09, 0x03, 0x03, 0x08, 0x08, 0x03, 0x03, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x03, 0x03, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x16, 0x15, 0x12, 0x12, 0x11, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x15, 0x15,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x14, 0x15, 0x15, 0x14, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x16, 0x11, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x15, 0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x14, 0x14,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x14, 0x14, 0x14, 0x16, 0x26, 0x26, 0x15, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x16, 0x16, 0x16, 0x26, 0x26, 0x26, 0x15,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x31, 0x32, 0x32,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x31, 0x31, 0x29, 0x32,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x32, 0x29, 0x29, 0x32,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x29, 0x29, 0x32, 0x31,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x29, 0x31, 0x31, 0x31, 0x29,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x1c, 0x16, 0x31, 0x29, 0x29, 0x32, 0x32, 0x26, 0x31,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0x16, 0x16, 0x31,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x14, 0x16, 0x15, 0x14,
+  0x15, 0x15, 0x14, 0x15, 0x14, 0x10, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x14, 0x14, 0x16, 0x15,
+  0x15, 0x15, 0x14, 0x15, 0x10, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x14, 0x16, 0x32,
+  0x14, 0x14, 0x15, 0x10, 0x10, 0x16, 0x14, 0x10, 0x10, 0x14, 0x14, 0x16, 0x31, 0x16, 0x14, 0x32,
+  0x15, 0x26, 0x15, 0x10, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x14, 0x16, 0x32, 0x29, 0x29, 0x32,
+  0x15, 0x26, 0x15, 0x14, 0x14, 0x16, 0x16, 0x16, 0x01, 0x16, 0x16, 0x31, 0x29, 0x29, 0x32, 0x31,
+  0x15, 0x26, 0x26, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0x16, 0x31, 0x29, 0x31, 0x31, 0x31, 0x29,
+  0x31, 0x31, 0x32, 0x26, 0x16, 0x00, 0x01, 0x1c, 0x16, 0x31, 0x29, 0x29, 0x32, 0x32, 0x26, 0x31,
+  0x31, 0x32, 0x31, 0x32, 0x16, 0x01, 0x00, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0x16, 0x16, 0x31,
+  0x31, 0x31, 0x31, 0x32, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x16,
+  0x32, 0x32, 0x26, 0x31, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x29, 0x32, 0x32, 0x26, 0x32, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x29, 0x29, 0x31, 0x32, 0x26, 0x1c, 0x26, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x31, 0x1c, 0x32, 0x16, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x1c, 0x00, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x26, 0x15, 0x16, 0x15, 0x12, 0x12, 0x11, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x15, 0x15,
+  0x15, 0x26, 0x26, 0x26, 0x16, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x14, 0x15, 0x15, 0x14, 0x14,
+  0x31, 0x31, 0x32, 0x26, 0x16, 0x11, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15,
+  0x31, 0x32, 0x31, 0x32, 0x16, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x31, 0x31, 0x31, 0x32, 0x16, 0x16, 0x16, 0x15, 0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x14, 0x14,
+  0x32, 0x32, 0x26, 0x31, 0x26, 0x16, 0x01, 0x16, 0x14, 0x14, 0x14, 0x16, 0x26, 0x26, 0x15, 0x14,
+  0x29, 0x32, 0x32, 0x26, 0x32, 0x26, 0x16, 0x01, 0x16, 0x16, 0x16, 0x16, 0x26, 0x26, 0x26, 0x15,
+  0x29, 0x29, 0x31, 0x32, 0x26, 0x1c, 0x26, 0x16, 0x00, 0x00, 0x01, 0x16, 0x31, 0x31, 0x32, 0x32,
+  0x1c, 0x31, 0x1c, 0x32, 0x16, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x16, 0x31, 0x31, 0x29, 0x32,
+  0x1c, 0x00, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x32, 0x29, 0x29, 0x32,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x29, 0x29, 0x32, 0x31,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x29, 0x31, 0x31, 0x31, 0x29,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x1c, 0x16, 0x31, 0x29, 0x29, 0x32, 0x32, 0x26, 0x31,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0x16, 0x16, 0x31,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x14, 0x16, 0x15, 0x14,
+  0x15, 0x15, 0x14, 0x15, 0x14, 0x10, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x14, 0x14, 0x16, 0x15,
+  0x15, 0x15, 0x14, 0x15, 0x10, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x14, 0x16, 0x32,
+  0x14, 0x14, 0x15, 0x10, 0x10, 0x16, 0x14, 0x10, 0x10, 0x14, 0x14, 0x16, 0x31, 0x16, 0x14, 0x32,
+  0x15, 0x26, 0x15, 0x10, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x14, 0x16, 0x32, 0x29, 0x29, 0x32,
+  0x15, 0x26, 0x15, 0x14, 0x14, 0x16, 0x16, 0x16, 0x01, 0x16, 0x16, 0x31, 0x29, 0x29, 0x32, 0x31,
+  0x15, 0x26, 0x26, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0x16, 0x31, 0x29, 0x31, 0x31, 0x31, 0x29,
+  0x31, 0x31, 0x32, 0x26, 0x16, 0x00, 0x01, 0x1c, 0x16, 0x31, 0x29, 0x29, 0x32, 0x32, 0x26, 0x31,
+  0x31, 0x32, 0x31, 0x32, 0x16, 0x01, 0x00, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0x16, 0x16, 0x31,
+  0x31, 0x31, 0x31, 0x32, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x16,
+  0x32, 0x32, 0x26, 0x31, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x29, 0x32, 0x32, 0x26, 0x32, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x29, 0x29, 0x31, 0x32, 0x26, 0x1c, 0x26, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x31, 0x1c, 0x32, 0x16, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x1c, 0x00, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x26, 0x15, 0x14, 0x14, 0x16, 0x16, 0x16, 0x00, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x26, 0x26, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x31, 0x31, 0x32, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x31, 0x32, 0x31, 0x32, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x31, 0x31, 0x31, 0x32, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x32, 0x32, 0x26, 0x31, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x29, 0x32, 0x32, 0x26, 0x32, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x29, 0x29, 0x31, 0x32, 0x26, 0x1c, 0x26, 0x16, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x1c, 0x31, 0x1c, 0x32, 0x16, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x00, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x2c, 0x29, 0x29, 0x2a, 0x2c, 0x05, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x2a, 0x29, 0x2b, 0x2a, 0x28, 0x0f, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x2a, 0x29, 0x29, 0x2a, 0x28, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x2a, 0x28, 0x28, 0x27, 0x28, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x28, 0x2a, 0x2a, 0x18, 0x27, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x27, 0x2a, 0x29, 0x05, 0x27, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x22, 0x16, 0x16, 0x05, 0x16, 0x16, 0x22, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x16, 0x33, 0x34, 0x35, 0x35, 0x35, 0x06,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x33, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x34, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x36, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x06, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x06, 0x06, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x35, 0x35, 0x06, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x34, 0x34, 0x33, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x37,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x38,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x38, 0x38,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x37, 0x38, 0x38,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x13, 0x38, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x16, 0x01,
+  0x01, 0x00, 0x13, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x16,
+  0x00, 0x13, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x39,
+  0x13, 0x38, 0x37, 0x39, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x38,
+  0x38, 0x37, 0x39, 0x39, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
+  0x37, 0x37, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x39,
+  0x38, 0x37, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x39,
+  0x38, 0x37, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x38,
+  0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
+  0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x39,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x39, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x39, 0x39, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x38, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x10, 0x14, 0x14, 0x10, 0x15, 0x15, 0x10, 0x14,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15,
+  0x14, 0x10, 0x15, 0x15, 0x10, 0x14, 0x14, 0x10, 0x15, 0x15, 0x10, 0x14, 0x14, 0x10, 0x15, 0x15,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14,
+  0x10, 0x14, 0x14, 0x10, 0x15, 0x15, 0x10, 0x14, 0x14, 0x10, 0x15, 0x15, 0x10, 0x14, 0x14, 0x10,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x14, 0x15,
+  0x15, 0x15, 0x10, 0x15, 0x15, 0x10, 0x14, 0x14, 0x10, 0x15, 0x15, 0x10, 0x14, 0x14, 0x10, 0x15,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x15, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x10, 0x14, 0x14, 0x10, 0x14, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x3c,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x3b, 0x3b, 0x3b, 0x3c,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x0e, 0x3b, 0x3c,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x0e, 0x0e, 0x3b, 0x3b,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x0e, 0x0e, 0x0e, 0x3b, 0x0e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x3b, 0x0e, 0x0e, 0x3b, 0x0e, 0x0e,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x3b, 0x3b, 0x3c, 0x3b, 0x0e, 0x3b, 0x0e, 0x0e, 0x0e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x13, 0x0e, 0x3c, 0x0e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x3c, 0x16, 0x01, 0x13, 0x16,
+  0x3b, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0e, 0x3c, 0x13, 0x3d, 0x3d,
+  0x3c, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x0e, 0x16, 0x3d, 0x0f,
+  0x3c, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x16, 0x3e, 0x13,
+  0x3c, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x3c, 0x3c, 0x16, 0x3e, 0x3e,
+  0x3b, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0e, 0x3c, 0x13, 0x3f, 0x3f,
+  0x0e, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x0e, 0x13, 0x3f, 0x3f,
+  0x0e, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x0e, 0x16, 0x16,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x3c, 0x3c, 0x3c, 0x16, 0x3f,
+  0x3b, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0e, 0x3c, 0x3c, 0x16, 0x3f,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3d, 0x3e, 0x3e, 0x3f, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x0f, 0x0f, 0x0f, 0x3f, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x13, 0x13, 0x13, 0x3f, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3e, 0x3e, 0x3e, 0x3f, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3e, 0x3f, 0x3f, 0x0f, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3e, 0x3f, 0x3f, 0x0f, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x16, 0x16, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3e, 0x0f, 0x0f, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3e, 0x0f, 0x0f, 0x16, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x10, 0x10, 0x0f, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x0f, 0x10, 0x11, 0x10, 0x0f,
+  0x01, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x01, 0x0f, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x0f,
+  0x00, 0x01, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10,
+  0x01, 0x00, 0x01, 0x0f, 0x10, 0x12, 0x11, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x0f, 0x0f, 0x10, 0x0f, 0x00, 0x01, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x0f, 0x0f, 0x10, 0x11, 0x11, 0x12, 0x14, 0x10, 0x10, 0x11, 0x10, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x01, 0x00, 0x01,
+  0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x10, 0x13, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x40, 0x36, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x36,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x40, 0x40, 0x40, 0x36, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x36, 0x40, 0x40, 0x40, 0x36, 0x33, 0x36, 0x36, 0x36, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x36, 0x40, 0x40, 0x16, 0x33,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x36, 0x40, 0x40, 0x40, 0x40, 0x36, 0x40, 0x16, 0x40, 0x36,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x36, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x16, 0x40, 0x40,
+  0x00, 0x01, 0x00, 0x01, 0x05, 0x16, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x16, 0x40, 0x40,
+  0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x16, 0x05, 0x16, 0x40, 0x40, 0x05, 0x16, 0x16, 0x40, 0x40,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x05, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x16, 0x36, 0x40,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x16, 0x36, 0x40,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x16, 0x40, 0x40,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x16, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x36, 0x36, 0x36, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x40, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x06, 0x06, 0x33, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x06, 0x06, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x33, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x36, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x40, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x40, 0x40, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x40, 0x40, 0x36, 0x40, 0x36, 0x36, 0x36, 0x36, 0x36, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x40, 0x40, 0x40, 0x16, 0x36, 0x36, 0x36, 0x36, 0x05, 0x16, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x40, 0x40, 0x40, 0x16, 0x40, 0x36, 0x16, 0x16, 0x05, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x05, 0x16, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x37, 0x37, 0x39, 0x37, 0x38, 0x37,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x39, 0x39, 0x39, 0x37, 0x38, 0x37,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x39, 0x39, 0x39, 0x37, 0x38, 0x38, 0x37,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x37, 0x39, 0x39, 0x39, 0x37, 0x38, 0x38, 0x38, 0x37,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x39, 0x39, 0x39, 0x37, 0x38, 0x38, 0x38, 0x37, 0x39,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x39, 0x39, 0x37, 0x37, 0x38, 0x38, 0x37, 0x39, 0x39,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x39, 0x39,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x37, 0x38, 0x38, 0x37, 0x37, 0x38, 0x37, 0x39, 0x37,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x37, 0x37,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x41,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x41, 0x38,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x41, 0x38, 0x39,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x38, 0x38, 0x37, 0x37, 0x38, 0x41, 0x38, 0x39, 0x39,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x38, 0x37, 0x39, 0x37, 0x41, 0x38, 0x39, 0x39, 0x16,
+  0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x39,
+  0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x38,
+  0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
+  0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x39,
+  0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x39,
+  0x39, 0x37, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x38,
+  0x39, 0x37, 0x38, 0x38, 0x42, 0x39, 0x42, 0x39, 0x39, 0x42, 0x42, 0x42, 0x42, 0x42, 0x39, 0x39,
+  0x37, 0x38, 0x38, 0x41, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x39,
+  0x38, 0x38, 0x41, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x42,
+  0x38, 0x41, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x42, 0x39,
+  0x41, 0x38, 0x39, 0x39, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x41, 0x42,
+  0x38, 0x39, 0x39, 0x16, 0x27, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x27, 0x16, 0x41,
+  0x39, 0x39, 0x16, 0x30, 0x30, 0x30, 0x2f, 0x16, 0x2f, 0x30, 0x16, 0x2f, 0x30, 0x30, 0x30, 0x16,
+  0x39, 0x16, 0x30, 0x2f, 0x30, 0x2f, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x2f, 0x30, 0x2f, 0x30,
+  0x16, 0x30, 0x2f, 0x43, 0x2f, 0x0f, 0x0f, 0x0f, 0x2f, 0x30, 0x0f, 0x0f, 0x0f, 0x30, 0x43, 0x2f,
+  0x44, 0x45, 0x46, 0x46, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x2f, 0x2f, 0x2f, 0x30, 0x46, 0x46,
+  0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x39, 0x39, 0x38, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x39, 0x38, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x38, 0x38, 0x39, 0x39, 0x38, 0x39, 0x39, 0x38, 0x38, 0x39, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x38, 0x39, 0x38, 0x42, 0x16, 0x16, 0x16, 0x16,
+  0x38, 0x39, 0x39, 0x38, 0x39, 0x39, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x38, 0x39, 0x38, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x38, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x42, 0x39, 0x38, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x37, 0x37, 0x37, 0x37,
+  0x39, 0x42, 0x38, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+  0x42, 0x39, 0x42, 0x39, 0x39, 0x38, 0x39, 0x39, 0x38, 0x38, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+  0x41, 0x42, 0x39, 0x42, 0x39, 0x39, 0x38, 0x39, 0x38, 0x39, 0x39, 0x38, 0x37, 0x37, 0x37, 0x37,
+  0x16, 0x41, 0x42, 0x39, 0x42, 0x39, 0x39, 0x38, 0x38, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+  0x30, 0x16, 0x41, 0x42, 0x39, 0x42, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+  0x45, 0x44, 0x16, 0x41, 0x42, 0x39, 0x42, 0x39, 0x39, 0x38, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x10, 0x10,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x10, 0x10,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x10, 0x10,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x10, 0x10,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x15,
+  0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x10,
+  0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x10,
+  0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x14, 0x10, 0x10,
+  0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x15, 0x10, 0x15,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x14, 0x10, 0x15, 0x16,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x14, 0x15, 0x16, 0x27,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14, 0x14, 0x3a,
+  0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a,
+  0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a,
+  0x3a, 0x14, 0x14, 0x10, 0x14, 0x14, 0x10, 0x14, 0x14, 0x10, 0x14, 0x14, 0x10, 0x10, 0x10, 0x3a,
+  0x3a, 0x15, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x15, 0x10, 0x10, 0x3a,
+  0x14, 0x10, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x14, 0x14, 0x10, 0x3a,
+  0x15, 0x10, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x14, 0x15, 0x10, 0x3a,
+  0x10, 0x10, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x14, 0x14, 0x14, 0x3a,
+  0x10, 0x10, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x14, 0x14, 0x15, 0x3a,
+  0x10, 0x10, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x10, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x14, 0x14, 0x15,
+  0x15, 0x16, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x16, 0x15, 0x14, 0x14,
+  0x16, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x16, 0x15, 0x14,
+  0x27, 0x45, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x45, 0x27, 0x16, 0x15,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x27, 0x16,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x14, 0x14, 0x3a, 0x15,
+  0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x10, 0x10, 0x3a, 0x15, 0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14,
+  0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15,
+  0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15,
+  0x14, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15,
+  0x15, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x15,
+  0x14, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x15, 0x14, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 0x0e, 0x0e, 0x3b,
+  0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x3c, 0x3c, 0x3c, 0x3b, 0x0e, 0x3b, 0x0e, 0x3b, 0x0e,
+  0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x3c, 0x3c, 0x3c, 0x3b, 0x0e, 0x0e, 0x3b, 0x3b, 0x3b, 0x0e,
+  0x01, 0x00, 0x01, 0x13, 0x3b, 0x3c, 0x3c, 0x3c, 0x3b, 0x0e, 0x0e, 0x0e, 0x3b, 0x3c, 0x3b, 0x0e,
+  0x00, 0x01, 0x00, 0x13, 0x3c, 0x3c, 0x3c, 0x3b, 0x0e, 0x0e, 0x0e, 0x3b, 0x3c, 0x3c, 0x3b, 0x3b,
+  0x01, 0x00, 0x01, 0x13, 0x3c, 0x3c, 0x3b, 0x3b, 0x0e, 0x0e, 0x3b, 0x3c, 0x3c, 0x3c, 0x3b, 0x0e,
+  0x00, 0x01, 0x00, 0x13, 0x3c, 0x3b, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3c, 0x3c, 0x3b, 0x0e, 0x0e,
+  0x01, 0x00, 0x01, 0x13, 0x3b, 0x0e, 0x0e, 0x3b, 0x3b, 0x0e, 0x3b, 0x3c, 0x3b, 0x0e, 0x0e, 0x47,
+  0x00, 0x01, 0x00, 0x13, 0x0e, 0x0e, 0x0e, 0x3b, 0x0e, 0x0e, 0x3b, 0x3b, 0x3b, 0x0e, 0x47, 0x0e,
+  0x01, 0x00, 0x01, 0x13, 0x0e, 0x0e, 0x3b, 0x0e, 0x0e, 0x0e, 0x3b, 0x0e, 0x3b, 0x47, 0x0e, 0x3c,
+  0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x0e, 0x0e, 0x0e, 0x3b, 0x0e, 0x0e, 0x47, 0x0e, 0x3c, 0x3c,
+  0x01, 0x00, 0x01, 0x13, 0x3b, 0x0e, 0x0e, 0x0e, 0x3b, 0x0e, 0x0e, 0x47, 0x0e, 0x3c, 0x3c, 0x16,
+  0x00, 0x01, 0x00, 0x13, 0x0e, 0x0e, 0x0e, 0x3b, 0x0e, 0x0e, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30,
+  0x01, 0x00, 0x01, 0x13, 0x0e, 0x0e, 0x3b, 0x3b, 0x0e, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f,
+  0x00, 0x01, 0x00, 0x13, 0x0e, 0x3b, 0x3c, 0x3b, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x2e,
+  0x01, 0x00, 0x01, 0x13, 0x3b, 0x3c, 0x3c, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x2e, 0x2e,
+  0x0e, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x0e, 0x3c, 0x16, 0x3f,
+  0x0e, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x0e, 0x47, 0x3f,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x3c, 0x3c, 0x0e, 0x0e, 0x47,
+  0x3b, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0e, 0x3c, 0x0e, 0x3c, 0x0e,
+  0x0e, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x0e, 0x0e, 0x3c, 0x3c,
+  0x0e, 0x47, 0x0d, 0x47, 0x0d, 0x0d, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3c, 0x3c, 0x0e, 0x3c, 0x3c,
+  0x47, 0x0e, 0x3b, 0x0e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x47, 0x3c, 0x3c, 0x0e, 0x3c,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x3c, 0x47, 0x3c, 0x3c, 0x0e,
+  0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x3c, 0x47, 0x3c, 0x0e,
+  0x3c, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x47, 0x47, 0x3c, 0x47, 0x0e,
+  0x16, 0x27, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x27, 0x16, 0x47, 0x47, 0x3c, 0x47,
+  0x30, 0x30, 0x30, 0x2f, 0x16, 0x2f, 0x30, 0x16, 0x2f, 0x30, 0x30, 0x30, 0x16, 0x47, 0x47, 0x3c,
+  0x2f, 0x30, 0x2f, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x2f, 0x30, 0x2f, 0x30, 0x16, 0x47, 0x47,
+  0x43, 0x2f, 0x0f, 0x0f, 0x0f, 0x2f, 0x30, 0x0f, 0x0f, 0x0f, 0x30, 0x43, 0x2f, 0x30, 0x16, 0x47,
+  0x2e, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x2f, 0x2f, 0x2f, 0x30, 0x2e, 0x2e, 0x2f, 0x30, 0x16,
+  0x2e, 0x2f, 0x0f, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x0f, 0x30, 0x2e, 0x2e, 0x2e, 0x2f, 0x30,
+  0x3e, 0x0f, 0x0f, 0x16, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3e, 0x0f, 0x0f, 0x16, 0x3c, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x0f, 0x0f, 0x0f, 0x16, 0x3c, 0x0e, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x47, 0x13, 0x13, 0x16, 0x3c, 0x0e, 0x3c, 0x0e, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x0e, 0x47, 0x47, 0x47, 0x0e, 0x0e, 0x3c, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3c, 0x0e, 0x3c, 0x0e, 0x3c, 0x0e, 0x3c, 0x3c, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3c, 0x3c, 0x0e, 0x0e, 0x3c, 0x3c, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3c, 0x3c, 0x3c, 0x0e, 0x3c, 0x3c, 0x3c, 0x0e, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x0e, 0x3c, 0x3c, 0x3c, 0x0e, 0x3c, 0x3c, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x3c, 0x0e, 0x3c, 0x3c, 0x3c, 0x0e, 0x3c, 0x3c, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3c, 0x3c, 0x0e, 0x3c, 0x3c, 0x0e, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x47, 0x3c, 0x3c, 0x0e, 0x3c, 0x0e, 0x3c, 0x0e, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x3c, 0x47, 0x3c, 0x3c, 0x0e, 0x0e, 0x3c, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x47, 0x3c, 0x47, 0x3c, 0x3c, 0x0e, 0x3c, 0x3c, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x47, 0x47, 0x3c, 0x47, 0x3c, 0x3c, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x16, 0x47, 0x47, 0x3c, 0x47, 0x3c, 0x3c, 0x0e, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x14, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12,
+  0x01, 0x00, 0x13, 0x13, 0x14, 0x14, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12,
+  0x00, 0x13, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11,
+  0x13, 0x10, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x12, 0x12, 0x12, 0x11,
+  0x14, 0x13, 0x13, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x11, 0x11, 0x10,
+  0x01, 0x00, 0x13, 0x11, 0x10, 0x10, 0x14, 0x12, 0x10, 0x14, 0x14, 0x11, 0x11, 0x11, 0x10, 0x14,
+  0x00, 0x01, 0x13, 0x10, 0x10, 0x10, 0x12, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x10,
+  0x01, 0x13, 0x15, 0x15, 0x14, 0x14, 0x11, 0x11, 0x10, 0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x13, 0x10, 0x10, 0x10, 0x15, 0x14, 0x14, 0x10, 0x12, 0x12, 0x11, 0x14, 0x10, 0x14, 0x14, 0x14,
+  0x13, 0x14, 0x11, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x11, 0x14, 0x10, 0x14, 0x10, 0x10, 0x10,
+  0x14, 0x16, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11,
+  0x01, 0x00, 0x16, 0x14, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12,
+  0x00, 0x01, 0x16, 0x10, 0x11, 0x11, 0x11, 0x10, 0x15, 0x14, 0x14, 0x10, 0x10, 0x11, 0x12, 0x12,
+  0x01, 0x16, 0x14, 0x11, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x10, 0x11, 0x14, 0x10, 0x11,
+  0x00, 0x16, 0x14, 0x10, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x10, 0x10,
+  0x01, 0x14, 0x16, 0x15, 0x14, 0x14, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10,
+  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x10, 0x13, 0x01, 0x00, 0x01,
+  0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x13, 0x01, 0x00, 0x01,
+  0x11, 0x11, 0x11, 0x12, 0x12, 0x10, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x15, 0x16, 0x01, 0x00,
+  0x10, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x16, 0x00, 0x01,
+  0x10, 0x11, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x16, 0x01, 0x00,
+  0x14, 0x11, 0x11, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x14, 0x16, 0x00, 0x01,
+  0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x11, 0x15, 0x14, 0x14, 0x16, 0x00,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x16,
+  0x14, 0x10, 0x10, 0x14, 0x15, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x10, 0x16,
+  0x10, 0x11, 0x10, 0x14, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x16, 0x14,
+  0x11, 0x11, 0x11, 0x10, 0x14, 0x15, 0x15, 0x15, 0x10, 0x10, 0x10, 0x11, 0x11, 0x16, 0x01, 0x00,
+  0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x10, 0x16, 0x01,
+  0x11, 0x10, 0x14, 0x10, 0x14, 0x14, 0x14, 0x15, 0x15, 0x14, 0x10, 0x10, 0x10, 0x11, 0x14, 0x16,
+  0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15, 0x15, 0x15, 0x15, 0x10, 0x10, 0x16,
+  0x15, 0x10, 0x14, 0x15, 0x15, 0x14, 0x15, 0x15, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x16, 0x40, 0x36, 0x36, 0x33, 0x34,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x40, 0x36, 0x36, 0x33, 0x34, 0x34, 0x35,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x40, 0x36, 0x36, 0x33, 0x34, 0x34, 0x34, 0x35, 0x06,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x16, 0x40, 0x36, 0x36, 0x36, 0x36, 0x33, 0x34, 0x35,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x33, 0x34, 0x34, 0x34, 0x34,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x34, 0x34, 0x35, 0x35,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x33, 0x34, 0x34,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x13, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x35, 0x06, 0x06, 0x06, 0x0f, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x35, 0x35, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x35, 0x35, 0x35, 0x35, 0x06, 0x06, 0x06, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x35, 0x35, 0x06, 0x35, 0x35, 0x35, 0x06, 0x06, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x35, 0x34, 0x34, 0x35, 0x06, 0x35, 0x35, 0x06, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x36, 0x36, 0x36, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x34, 0x33, 0x33, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x37, 0x39, 0x39, 0x41, 0x38, 0x39, 0x39, 0x16, 0x44,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x39, 0x39, 0x41, 0x38, 0x39, 0x39, 0x16, 0x30, 0x2f,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x13, 0x13, 0x39, 0x41, 0x38, 0x39, 0x39, 0x16, 0x30, 0x2f, 0x2e,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x13, 0x41, 0x38, 0x39, 0x39, 0x16, 0x30, 0x2f, 0x2e, 0x2e,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x13, 0x38, 0x39, 0x39, 0x16, 0x30, 0x2f, 0x2d, 0x2d, 0x2d,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x16, 0x16, 0x16, 0x16, 0x44, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x49, 0x4a, 0x44, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x49, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x1c, 0x48, 0x49, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x01, 0x00, 0x01, 0x00, 0x1c, 0x1c, 0x48, 0x49, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x45, 0x46, 0x46, 0x46, 0x2f, 0x0f, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x0f, 0x30, 0x46, 0x46,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x3f, 0x0f, 0x0f, 0x2f, 0x30, 0x0f, 0x0f, 0x3f, 0x30, 0x43, 0x43,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2d, 0x2d, 0x0f, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f,
+  0x46, 0x0f, 0x43, 0x43, 0x43, 0x43, 0x2e, 0x2e, 0x43, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30,
+  0x0f, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x13, 0x2f, 0x30, 0x13, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f, 0x30,
+  0x13, 0x2f, 0x13, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x0f,
+  0x13, 0x2f, 0x13, 0x4b, 0x4b, 0x4b, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x4b, 0x4b, 0x4b, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4d, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x4d, 0x4c, 0x4d, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x4d, 0x4c, 0x4d, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4f, 0x4d, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x50, 0x50, 0x4d, 0x13,
+  0x46, 0x45, 0x44, 0x16, 0x41, 0x42, 0x39, 0x42, 0x39, 0x39, 0x39, 0x38, 0x37, 0x37, 0x37, 0x37,
+  0x43, 0x43, 0x2f, 0x30, 0x16, 0x41, 0x42, 0x39, 0x42, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38,
+  0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x16, 0x41, 0x42, 0x39, 0x42, 0x39, 0x42, 0x39, 0x39, 0x39, 0x39,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x16, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x30, 0x16, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x0f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x44, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x30, 0x0f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x44, 0x4a, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x13, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x2e, 0x2e, 0x13, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x30, 0x16, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x13, 0x2f, 0x2e, 0x43, 0x43, 0x43, 0x43,
+  0x30, 0x16, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x13, 0x44, 0x45, 0x46, 0x13, 0x13, 0x2f,
+  0x30, 0x16, 0x2f, 0x2e, 0x43, 0x43, 0x43, 0x2e, 0x2f, 0x13, 0x44, 0x45, 0x46, 0x0f, 0x0f, 0x2f,
+  0x30, 0x16, 0x45, 0x45, 0x46, 0x46, 0x46, 0x45, 0x45, 0x13, 0x2f, 0x2e, 0x43, 0x30, 0x30, 0x30,
+  0x30, 0x16, 0x45, 0x45, 0x46, 0x46, 0x46, 0x45, 0x45, 0x13, 0x30, 0x2f, 0x2e, 0x0f, 0x3f, 0x2f,
+  0x30, 0x16, 0x2f, 0x2e, 0x43, 0x43, 0x43, 0x2e, 0x2f, 0x13, 0x30, 0x2f, 0x2e, 0x0f, 0x3f, 0x2f,
+  0x30, 0x16, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x13, 0x2f, 0x2e, 0x43, 0x43, 0x43, 0x43,
+  0x30, 0x16, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2e, 0x2f, 0x13, 0x44, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x13, 0x13, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x16, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x16, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x16, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x2e, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x30, 0x13, 0x13, 0x46, 0x46, 0x45, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x30, 0x13, 0x0f, 0x46, 0x46, 0x45, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x30, 0x30, 0x30, 0x43, 0x43, 0x2e, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x30, 0x13, 0x0f, 0x2e, 0x2e, 0x2f, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x30, 0x13, 0x0f, 0x2e, 0x2e, 0x2f, 0x13, 0x49, 0x49, 0x51, 0x1c, 0x1c, 0x01, 0x00, 0x01, 0x00,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x2e, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x1c, 0x00, 0x01, 0x00, 0x01,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x1c, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x16, 0x27, 0x45, 0x45, 0x45, 0x45,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x13, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x13, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x0f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0x15, 0x16, 0x27, 0x45,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x27, 0x45, 0x45,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x27, 0x45, 0x46, 0x46,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x43, 0x43, 0x43, 0x43,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x46, 0x46, 0x46, 0x0f,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x46, 0x46, 0x0f, 0x43,
+  0x13, 0x13, 0x30, 0x2f, 0x13, 0x13, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x13, 0x2f,
+  0x0f, 0x13, 0x30, 0x2f, 0x0f, 0x0f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x13, 0x2f,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x13, 0x2f,
+  0x0f, 0x13, 0x30, 0x2f, 0x3f, 0x0f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x43, 0x43, 0x13, 0x2f,
+  0x0f, 0x13, 0x30, 0x2f, 0x3f, 0x0f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x46, 0x46, 0x13, 0x2f,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x46, 0x46, 0x13, 0x2f,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x43, 0x43, 0x13, 0x2f,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x13, 0x2f,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x13, 0x2f,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x27,
+  0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x0f, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x2e, 0x2e, 0x43, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x0f, 0x46,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x0f,
+  0x30, 0x13, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f, 0x30, 0x2f, 0x13,
+  0x13, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x0f, 0x30, 0x16,
+  0x13, 0x4b, 0x4b, 0x4b, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x4b, 0x4b, 0x4b, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4f, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x50, 0x50, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x15, 0x14, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x27, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x45, 0x27, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x46, 0x45, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+  0x43, 0x43, 0x27, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+  0x46, 0x46, 0x27, 0x45, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x2f, 0x2e, 0x2e, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x2e, 0x43, 0x27, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x2e, 0x2e,
+  0x2f, 0x2e, 0x27, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x0f, 0x0f, 0x2f, 0x30, 0x13, 0x0f, 0x2e, 0x2e,
+  0x2f, 0x2e, 0x2f, 0x2e, 0x2e, 0x43, 0x43, 0x43, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x43, 0x43,
+  0x2f, 0x43, 0x27, 0x45, 0x45, 0x46, 0x46, 0x46, 0x0f, 0x3f, 0x2f, 0x30, 0x13, 0x0f, 0x46, 0x46,
+  0x45, 0x46, 0x27, 0x45, 0x45, 0x46, 0x46, 0x46, 0x0f, 0x3f, 0x2f, 0x30, 0x13, 0x0f, 0x46, 0x46,
+  0x45, 0x46, 0x2f, 0x2e, 0x2e, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x2f, 0x43, 0x27, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2f, 0x2e, 0x27, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2f, 0x2e, 0x2f, 0x2e, 0x2e, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x27, 0x27, 0x27, 0x16, 0x51, 0x51, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x45, 0x45, 0x45, 0x13, 0x51, 0x51, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x46, 0x45, 0x45, 0x13, 0x51, 0x51, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x43, 0x2e, 0x2e, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2e, 0x2f, 0x2f, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2e, 0x2f, 0x2f, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x43, 0x2e, 0x2e, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x46, 0x45, 0x45, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x46, 0x45, 0x45, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x43, 0x2e, 0x2e, 0x0f, 0x51, 0x51, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2e, 0x2f, 0x2f, 0x0f, 0x51, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2e, 0x2f, 0x2f, 0x0f, 0x51, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x43, 0x2e, 0x2e, 0x13, 0x51, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x13, 0x3c, 0x3c, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x2d, 0x2d, 0x2d,
+  0x01, 0x00, 0x01, 0x13, 0x3c, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x01, 0x00, 0x13, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x01, 0x00, 0x01, 0x13, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0f,
+  0x00, 0x01, 0x00, 0x16, 0x16, 0x16, 0x16, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x0f, 0x43,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x27, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x0f, 0x43, 0x2f,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x16, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x13, 0x2f, 0x30,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x13,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x13,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x13, 0x2f, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x16, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x16, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x13, 0x2f, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x0f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x49, 0x0f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x49, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x13, 0x2f, 0x16,
+  0x2d, 0x2f, 0x3f, 0x0f, 0x0f, 0x2f, 0x30, 0x0f, 0x0f, 0x3f, 0x30, 0x43, 0x43, 0x43, 0x43, 0x2f,
+  0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x2e, 0x2e, 0x43, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x0f, 0x2e, 0x2e,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x0f, 0x2e,
+  0x13, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f, 0x30, 0x2f, 0x13, 0x2f,
+  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x0f, 0x30, 0x16, 0x2f,
+  0x4b, 0x4b, 0x4b, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x4b, 0x4b, 0x4b, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4d, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4f, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x50, 0x50, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x2f,
+  0x30, 0x16, 0x47, 0x47, 0x3c, 0x47, 0x3c, 0x3c, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2f, 0x30, 0x16, 0x47, 0x47, 0x3c, 0x47, 0x3c, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2e, 0x2f, 0x30, 0x16, 0x47, 0x47, 0x3c, 0x47, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x43, 0x43, 0x2f, 0x30, 0x16, 0x47, 0x47, 0x3c, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x16, 0x16, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x27, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x43, 0x43, 0x43, 0x43, 0x2e, 0x2e, 0x16, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2e, 0x43, 0x43, 0x43, 0x2e, 0x13, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x16, 0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x16, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2e, 0x43, 0x43, 0x43, 0x2e, 0x13, 0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x0f, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2f, 0x2e, 0x2e, 0x2f, 0x0f, 0x51, 0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x49, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x16, 0x15, 0x12, 0x12, 0x11, 0x10, 0x14, 0x14, 0x14, 0x15, 0x14, 0x15, 0x15,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x11, 0x11, 0x10, 0x14, 0x10, 0x10, 0x14, 0x15, 0x15, 0x14, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x16, 0x11, 0x10, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x15, 0x10, 0x10, 0x14, 0x14, 0x15, 0x15, 0x14, 0x14,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x14, 0x14, 0x14, 0x16, 0x26, 0x26, 0x15, 0x14,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x16, 0x16, 0x16, 0x26, 0x26, 0x26, 0x15,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x31, 0x32, 0x32,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x31, 0x31, 0x29, 0x32,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x32, 0x29, 0x29, 0x32,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x29, 0x29, 0x32, 0x31,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x31, 0x29, 0x31, 0x31, 0x31, 0x29,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x1c, 0x16, 0x31, 0x29, 0x29, 0x32, 0x32, 0x26, 0x31,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0x16, 0x16, 0x31,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x14, 0x16, 0x00, 0x01,
+  0x15, 0x15, 0x14, 0x15, 0x14, 0x10, 0x10, 0x11, 0x11, 0x10, 0x15, 0x10, 0x14, 0x14, 0x16, 0x00,
+  0x15, 0x15, 0x14, 0x15, 0x10, 0x14, 0x10, 0x11, 0x11, 0x10, 0x14, 0x16, 0x16, 0x14, 0x16, 0x01,
+  0x14, 0x14, 0x15, 0x10, 0x10, 0x16, 0x14, 0x10, 0x10, 0x14, 0x14, 0x16, 0x01, 0x16, 0x14, 0x00,
+  0x15, 0x26, 0x15, 0x10, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x14, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x15, 0x26, 0x15, 0x14, 0x14, 0x16, 0x16, 0x16, 0x01, 0x16, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x15, 0x26, 0x26, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x31, 0x31, 0x32, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x31, 0x32, 0x31, 0x32, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x31, 0x31, 0x31, 0x32, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x32, 0x32, 0x26, 0x31, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x29, 0x32, 0x32, 0x26, 0x32, 0x26, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x29, 0x29, 0x31, 0x32, 0x26, 0x1c, 0x26, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x31, 0x1c, 0x32, 0x16, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x1c, 0x00, 0x1c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x33, 0x33,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x16, 0x36, 0x36,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x16, 0x16, 0x13, 0x0f, 0x0f, 0x0f, 0x36, 0x16, 0x36, 0x36,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x0f, 0x36, 0x33, 0x36,
+  0x00, 0x01, 0x00, 0x16, 0x33, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x06, 0x06, 0x0f, 0x36, 0x36,
+  0x01, 0x00, 0x16, 0x40, 0x36, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x06, 0x06, 0x13, 0x36,
+  0x00, 0x01, 0x16, 0x40, 0x40, 0x33, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x16, 0x36,
+  0x01, 0x00, 0x16, 0x40, 0x40, 0x36, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x16, 0x16,
+  0x00, 0x01, 0x16, 0x40, 0x40, 0x40, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x16, 0x16,
+  0x01, 0x05, 0x16, 0x36, 0x40, 0x40, 0x40, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x16, 0x05,
+  0x05, 0x05, 0x16, 0x36, 0x40, 0x40, 0x40, 0x36, 0x40, 0x36, 0x36, 0x36, 0x36, 0x36, 0x16, 0x05,
+  0x01, 0x05, 0x16, 0x05, 0x40, 0x40, 0x40, 0x40, 0x16, 0x36, 0x36, 0x36, 0x05, 0x40, 0x16, 0x05,
+  0x00, 0x01, 0x05, 0x05, 0x40, 0x40, 0x40, 0x40, 0x05, 0x40, 0x36, 0x16, 0x05, 0x16, 0x05, 0x05,
+  0x01, 0x00, 0x01, 0x05, 0x16, 0x16, 0x05, 0x16, 0x05, 0x16, 0x16, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x33, 0x36, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x33, 0x36, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x36, 0x36, 0x36, 0x33, 0x34, 0x36, 0x36, 0x36, 0x36, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x36, 0x36, 0x36, 0x33, 0x34, 0x36, 0x36, 0x05, 0x36, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x05, 0x16, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x36, 0x16, 0x16, 0x16, 0x0f, 0x0f, 0x0f, 0x36, 0x05, 0x16, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x13, 0x33, 0x35, 0x35, 0x06, 0x06, 0x35, 0x0f, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01, 0x00,
+  0x13, 0x36, 0x33, 0x33, 0x34, 0x34, 0x34, 0x16, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x16, 0x40, 0x36, 0x33, 0x16, 0x16, 0x16, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x05, 0x16, 0x05, 0x16, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x48, 0x49, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x01, 0x00, 0x01, 0x00, 0x1c, 0x48, 0x48, 0x49, 0x13, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x49, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x49, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x49, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x49, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x00, 0x01, 0x00, 0x01, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x1c, 0x1c, 0x13, 0x13, 0x13, 0x13,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x13,
+  0x13, 0x2f, 0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13,
+  0x13, 0x30, 0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13,
+  0x16, 0x30, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x16,
+  0x16, 0x16, 0x16, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x16,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x51, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x51, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x51, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x0f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x0f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x0f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x0f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x0f, 0x13, 0x1c, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x13,
+  0x30, 0x16, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x13, 0x44, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x30, 0x16, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x13, 0x2f, 0x2e, 0x43, 0x43, 0x43, 0x43,
+  0x30, 0x16, 0x27, 0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x30, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x16, 0x16, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x51, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x49, 0x51, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49,
+  0x49, 0x51, 0x52, 0x52, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51,
+  0x51, 0x52, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x13, 0x1c, 0x1c, 0x1c, 0x13, 0x13, 0x13,
+  0x48, 0x13, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x01, 0x00,
+  0x48, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x49, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x2e, 0x16, 0x49, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x49, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x13, 0x13, 0x13, 0x1c, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x1c, 0x1c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x13, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x49, 0x49, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x51, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x52, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x52, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x52, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x13, 0x13,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x2d, 0x2d, 0x13, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x46, 0x46, 0x13, 0x2f,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x2f, 0x2f, 0x13, 0x30,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x16, 0x16, 0x16, 0x30,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x51, 0x16, 0x16,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x48,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x49,
+  0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x49,
+  0x1c, 0x1c, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x13, 0x13, 0x13, 0x52, 0x51,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x48,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x48,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x49,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x13,
+  0x16, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16,
+  0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x16, 0x30, 0x16,
+  0x16, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x16, 0x16, 0x16,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x13,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x13,
+  0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x13,
+  0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x13,
+  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x13,
+  0x2f, 0x43, 0x27, 0x45, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x30, 0x2f, 0x27, 0x27, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x27, 0x30, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x16, 0x16, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x51, 0x51, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x13, 0x1c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x13, 0x13, 0x13, 0x1c, 0x13, 0x13, 0x13, 0x13,
+  0x1c, 0x1c, 0x1c, 0x00, 0x01, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x01, 0x1c,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x46, 0x45, 0x45, 0x13, 0x51, 0x49, 0x51, 0x1c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x2f, 0x2f, 0x2f, 0x16, 0x51, 0x49, 0x51, 0x1c, 0x1c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x51, 0x49, 0x51, 0x0f, 0x1c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x49, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x1c, 0x49, 0x49, 0x49, 0x49, 0x49, 0x52, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x1c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x49, 0x16, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x13, 0x2f, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x49, 0x16, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x13, 0x30, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x49, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x30, 0x16,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x16, 0x16, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x48, 0x48,
+  0x01, 0x00, 0x01, 0x00, 0x0f, 0x49, 0x49, 0x1c, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x49, 0x49,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x51, 0x1c, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x1c, 0x13, 0x13, 0x52, 0x51, 0x51,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x0f, 0x48, 0x48,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x48,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x49, 0x49,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x51, 0x1c,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x13, 0x1c,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x30,
+  0x4b, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x27,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x16, 0x30, 0x16, 0x16,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x16, 0x16, 0x16, 0x49,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51, 0x49,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x49,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x51,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x13,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x13, 0x01,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x13, 0x00,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x13, 0x01,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x1c, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x13, 0x00,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1c, 0x13, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1c, 0x01, 0x00,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x16, 0x49, 0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x30, 0x30, 0x30, 0x30, 0x16, 0x49, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x16, 0x16, 0x16, 0x16, 0x13, 0x49, 0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x51, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x51, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x49, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x52, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x49, 0x49, 0x49, 0x49, 0x1c, 0x49, 0x52, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x51, 0x51, 0x51, 0x1c, 0x1c, 0x51, 0x52, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x13, 0x13, 0x13, 0x1c, 0x1c, 0x13, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x1c, 0x1c, 0x1c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x13, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x13, 0x13, 0x01, 0x00,
+  0x00, 0x01, 0x13, 0x2f, 0x13, 0x13, 0x00, 0x16, 0x00, 0x01, 0x13, 0x13, 0x2f, 0x13, 0x00, 0x01,
+  0x01, 0x13, 0x16, 0x16, 0x30, 0x27, 0x13, 0x30, 0x16, 0x13, 0x27, 0x30, 0x13, 0x13, 0x16, 0x00,
+  0x00, 0x16, 0x2f, 0x2f, 0x13, 0x16, 0x16, 0x27, 0x30, 0x16, 0x16, 0x13, 0x30, 0x30, 0x16, 0x01,
+  0x01, 0x00, 0x13, 0x30, 0x2f, 0x2f, 0x2f, 0x13, 0x16, 0x30, 0x30, 0x30, 0x30, 0x16, 0x01, 0x00,
+  0x00, 0x01, 0x22, 0x13, 0x13, 0x16, 0x2f, 0x30, 0x27, 0x30, 0x16, 0x16, 0x16, 0x22, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x22, 0x16, 0x30, 0x16, 0x16, 0x16, 0x16, 0x27, 0x13, 0x22, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x16, 0x30, 0x16, 0x13, 0x22, 0x22, 0x13, 0x16, 0x30, 0x13, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x13, 0x16, 0x22, 0x01, 0x00, 0x01, 0x00, 0x22, 0x13, 0x13, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x13, 0x13, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x13, 0x2d, 0x2e, 0x2d, 0x2e, 0x13, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x13, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x13, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x13, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x13, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x13, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x16, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x30, 0x16, 0x16, 0x16, 0x16, 0x30, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x16, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x30, 0x30, 0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x16, 0x2f, 0x30, 0x16, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x22, 0x16, 0x2f, 0x30, 0x16, 0x22, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x22, 0x22, 0x16, 0x2f, 0x30, 0x16, 0x22, 0x22, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x22, 0x22, 0x22, 0x16, 0x16, 0x22, 0x22, 0x22, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x01, 0x00, 0x01, 0x00,
+};
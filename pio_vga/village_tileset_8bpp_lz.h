@@ -0,0 +1,686 @@
+// Art by LimeZu from itch.io (https://limezu.itch.io/serenevillagerevamped)
+// Licensed under CC BY 4.0 (https://creativecommons.org/licenses/by/4.0/)
+
+int tileset_8bpp_lz_count = 112;
+int tileset_8bpp_lz_bytes = 10558;
+
+const uint32_t tileset_8bpp_lz_offsets[] = {
+  0x00000000, 0x00000011, 0x0000006a, 0x000000c4, 0x0000010b, 0x00000146, 0x00000187, 0x000001da,
+  0x00000238, 0x0000024d, 0x000002af, 0x000002f3, 0x00000367, 0x000003e6, 0x0000045a, 0x000004d3,
+  0x00000539, 0x0000054a, 0x000005af, 0x0000061a, 0x00000673, 0x00000721, 0x000007ca, 0x00000822,
+  0x00000854, 0x00000859, 0x00000885, 0x0000093b, 0x000009e8, 0x00000a99, 0x00000b46, 0x00000bf4,
+  0x00000c3a, 0x00000cb0, 0x00000d09, 0x00000d61, 0x00000da6, 0x00000df8, 0x00000e52, 0x00000ea4,
+  0x00000efe, 0x00000f11, 0x00000f6b, 0x00000fff, 0x000010b1, 0x00001166, 0x00001218, 0x00001279,
+  0x000012c9, 0x000012fe, 0x00001325, 0x0000134a, 0x0000139a, 0x000013ca, 0x000013db, 0x0000140f,
+  0x00001430, 0x00001451, 0x00001474, 0x000014a7, 0x000014e4, 0x00001539, 0x0000157a, 0x000015be,
+  0x0000160a, 0x00001683, 0x000016fe, 0x0000176a, 0x000017f7, 0x00001861, 0x0000188c, 0x000018cb,
+  0x0000190a, 0x00001965, 0x00001997, 0x000019cd, 0x00001a4a, 0x00001adc, 0x00001b3f, 0x00001bf5,
+  0x00001ca7, 0x00001ce6, 0x00001d33, 0x00001da2, 0x00001e12, 0x00001e92, 0x00001efc, 0x00001f4e,
+  0x00001fb2, 0x0000200c, 0x00002079, 0x000020d1, 0x00002150, 0x000021b3, 0x00002223, 0x000022b7,
+  0x00002350, 0x000023ec, 0x0000245b, 0x000024b0, 0x000024f4, 0x00002565, 0x000025bb, 0x00002610,
+  0x00002662, 0x000026a5, 0x000026e8, 0x00002738, 0x000027ae, 0x00002803, 0x00002850, 0x000028d4,
+  0x0000293e,
+};
+
+const uint8_t tileset_8bpp_lz_data[] = {
+  0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x9f, 0xdf,
+  0xdf, 0x01, 0x02, 0x03, 0xc9, 0x01, 0x03, 0x04, 0x05, 0x00, 0x01, 0xc9, 0x0e, 0x01, 0x04, 0x02,
+  0xc2, 0x0e, 0x00, 0x00, 0xcb, 0x1f, 0x01, 0x05, 0x01, 0xcb, 0x1f, 0x00, 0x03, 0xc6, 0x1f, 0x00,
+  0x06, 0xc2, 0x41, 0x01, 0x06, 0x06, 0xcd, 0x1f, 0x81, 0xc3, 0x56, 0x00, 0x07, 0xc2, 0x30, 0xcc,
+  0x5f, 0x02, 0x08, 0x05, 0x01, 0x42, 0x04, 0xc5, 0x6a, 0xc3, 0x00, 0xc2, 0x70, 0xc3, 0x05, 0xc2,
+  0x13, 0xc3, 0x6a, 0x01, 0x01, 0x00, 0xc2, 0x7f, 0xc2, 0x62, 0xc3, 0x1a, 0xc4, 0x0e, 0xc3, 0x12,
+  0xc8, 0x08, 0xc6, 0x10, 0xce, 0x0e, 0xff, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x01, 0x05, 0x03, 0x02,
+  0xca, 0x01, 0x03, 0x01, 0x00, 0x05, 0x04, 0xcb, 0x10, 0xc2, 0x1f, 0x00, 0x04, 0xc7, 0x1f, 0x00,
+  0x06, 0xc8, 0x1f, 0x00, 0x04, 0xc8, 0x23, 0x02, 0x00, 0x05, 0x07, 0xc2, 0x1f, 0x81, 0xc8, 0x3f,
+  0x01, 0x05, 0x08, 0xcd, 0x3f, 0x82, 0xd2, 0x5f, 0x00, 0x04, 0x44, 0x05, 0xc2, 0x69, 0xc2, 0x7f,
+  0x00, 0x08, 0x42, 0x04, 0x02, 0x05, 0x00, 0x01, 0xc2, 0x01, 0x02, 0x05, 0x04, 0x04, 0xc2, 0x06,
+  0xc3, 0x1a, 0xc4, 0x0e, 0xc2, 0x8b, 0xc7, 0x08, 0xc8, 0x05, 0xc3, 0x02, 0xcb, 0x12, 0xd2, 0x1f,
+  0xcc, 0x32, 0xdf, 0x1f, 0x01, 0x02, 0x03, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x02, 0xd2, 0x1f, 0x00,
+  0x06, 0xd4, 0x1f, 0x01, 0x04, 0x04, 0xcd, 0x3f, 0x81, 0xd7, 0x3f, 0xca, 0x72, 0xc5, 0x24, 0x01,
+  0x06, 0x06, 0xc7, 0x43, 0x01, 0x05, 0x05, 0xc3, 0x8e, 0x81, 0xc7, 0x0e, 0x01, 0x01, 0x00, 0xcb,
+  0x9f, 0xc2, 0x0e, 0x00, 0x01, 0xca, 0x3b, 0x02, 0x02, 0x05, 0x00, 0xdb, 0x1f, 0x00, 0x03, 0xd0,
+  0x1f, 0x00, 0x08, 0xc2, 0x30, 0xcc, 0x7d, 0x02, 0x07, 0x05, 0x00, 0x01, 0x02, 0x03, 0xcd, 0x01,
+  0xcc, 0x0e, 0x02, 0x04, 0x03, 0x02, 0xdc, 0x1f, 0xc2, 0x3c, 0xd3, 0x3f, 0x00, 0x04, 0xda, 0x1f,
+  0x42, 0x04, 0xc4, 0x59, 0x44, 0x05, 0xc2, 0x5f, 0xc3, 0x05, 0xc2, 0x13, 0x02, 0x05, 0x00, 0x01,
+  0xc2, 0x01, 0xc2, 0x0a, 0xc2, 0x06, 0xc3, 0x1a, 0xc4, 0x0e, 0xc2, 0x10, 0xc7, 0x08, 0xc8, 0x05,
+  0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0x01, 0x02, 0x03, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x02, 0xcb,
+  0x1f, 0x00, 0x06, 0xc3, 0x1f, 0x01, 0x04, 0x04, 0xcd, 0x1f, 0x81, 0xcd, 0x3f, 0xcf, 0x1f, 0xce,
+  0x5f, 0x42, 0x04, 0xc4, 0x06, 0x44, 0x05, 0xc2, 0x3a, 0xc3, 0x05, 0xc2, 0x13, 0x02, 0x05, 0x00,
+  0x01, 0xc2, 0x01, 0xc2, 0x0a, 0xc2, 0x06, 0xc3, 0x1a, 0xc4, 0x0e, 0xc2, 0x10, 0xc7, 0x08, 0xc8,
+  0x05, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0x01, 0x02, 0x03, 0xcd, 0x01, 0x00, 0x03, 0x42, 0x06,
+  0xcb, 0x12, 0x00, 0x02, 0x82, 0xc3, 0x23, 0x00, 0x04, 0xc7, 0x1f, 0xcb, 0x30, 0xc2, 0x1a, 0xcc,
+  0x3f, 0xc2, 0x3a, 0xce, 0x4e, 0xcd, 0x1f, 0xc3, 0x47, 0xc7, 0x48, 0xc6, 0x78, 0x01, 0x05, 0x05,
+  0xcd, 0x10, 0x01, 0x01, 0x00, 0xcd, 0x10, 0x00, 0x00, 0xc2, 0x10, 0xca, 0x70, 0xc2, 0x1f, 0x01,
+  0x01, 0x05, 0xd9, 0x1f, 0xc3, 0x3f, 0xca, 0x1f, 0x01, 0x04, 0x04, 0xc2, 0x3f, 0x01, 0x05, 0x08,
+  0xc8, 0xe3, 0xc2, 0x7c, 0x02, 0x01, 0x05, 0x07, 0xcc, 0x81, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xc8,
+  0x0e, 0x46, 0x03, 0xc8, 0x0c, 0x46, 0x08, 0xc3, 0x2e, 0xc8, 0x0c, 0x82, 0xc3, 0x0e, 0x4b, 0x08,
+  0xcb, 0x0e, 0x00, 0x03, 0x42, 0x09, 0x01, 0x00, 0x01, 0xc8, 0x0b, 0x44, 0x0a, 0x00, 0x01, 0xc4,
+  0x48, 0xc3, 0x0d, 0x45, 0x0b, 0xc4, 0x3d, 0xc7, 0x0c, 0x82, 0xc3, 0x1f, 0xc5, 0x1b, 0x45, 0x0c,
+  0xc2, 0x5d, 0xc3, 0x2a, 0x01, 0x0c, 0x0c, 0x46, 0x0d, 0xc2, 0x3f, 0xc3, 0x0e, 0x48, 0x0d, 0x01,
+  0x00, 0x03, 0xc2, 0x49, 0xc9, 0x0e, 0xc2, 0x1f, 0x81, 0xc3, 0x2b, 0x47, 0x0e, 0xc3, 0x1f, 0xc9,
+  0x0d, 0x81, 0xc3, 0x1f, 0xca, 0x0e, 0x00, 0x0e, 0x01, 0x00, 0x01, 0xcd, 0x01, 0x4f, 0x03, 0x6f,
+  0x08, 0x4f, 0x09, 0x4f, 0x0a, 0x5f, 0x0b, 0x4f, 0x0c, 0x6f, 0x0d, 0x6f, 0x0e, 0x01, 0x00, 0x01,
+  0xcd, 0x01, 0x46, 0x03, 0xc8, 0x16, 0x46, 0x08, 0xc8, 0x12, 0x49, 0x08, 0x01, 0x03, 0x03, 0xca,
+  0x1f, 0xc5, 0x24, 0xc2, 0x4b, 0x42, 0x09, 0x00, 0x03, 0xcb, 0x10, 0x44, 0x0a, 0xc8, 0x13, 0x01,
+  0x00, 0x01, 0x45, 0x0b, 0xc7, 0x11, 0x01, 0x03, 0x00, 0x48, 0x0b, 0x01, 0x0a, 0x09, 0xc4, 0x41,
+  0x45, 0x0c, 0xc7, 0x10, 0x01, 0x03, 0x00, 0x46, 0x0d, 0xc3, 0x12, 0xc2, 0x21, 0x01, 0x03, 0x01,
+  0x48, 0x0d, 0xc3, 0x10, 0xc9, 0x1f, 0xc4, 0x10, 0x03, 0x0a, 0x09, 0x03, 0x01, 0x47, 0x0e, 0xc3,
+  0x33, 0x82, 0x00, 0x00, 0x49, 0x0e, 0x01, 0x0d, 0x0d, 0xcb, 0x1f, 0xc3, 0x22, 0xc3, 0x1f, 0x01,
+  0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xca, 0x9f, 0x42, 0x0f,
+  0xcc, 0x9f, 0x03, 0x0f, 0x10, 0x10, 0x0f, 0xc8, 0x9f, 0x43, 0x0f, 0x03, 0x10, 0x11, 0x10, 0x0f,
+  0xc5, 0x0a, 0xc3, 0x1b, 0x04, 0x10, 0x11, 0x12, 0x12, 0x11, 0xc2, 0x31, 0x00, 0x00, 0xc3, 0x27,
+  0x00, 0x0f, 0x43, 0x11, 0x81, 0x01, 0x12, 0x10, 0xc4, 0x37, 0x03, 0x12, 0x11, 0x11, 0x10, 0xc2,
+  0x0c, 0xc3, 0x20, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xfa, 0x1f, 0x42, 0x0f,
+  0xcc, 0x3f, 0x03, 0x0f, 0x10, 0x10, 0x0f, 0xc8, 0x5f, 0x43, 0x0f, 0x03, 0x10, 0x11, 0x10, 0x0f,
+  0xc5, 0x0a, 0xc3, 0x1b, 0x04, 0x10, 0x11, 0x12, 0x12, 0x11, 0xc2, 0x31, 0x00, 0x01, 0xc3, 0x27,
+  0x00, 0x0f, 0x43, 0x11, 0x81, 0x01, 0x12, 0x10, 0xc4, 0x37, 0xc2, 0x0e, 0x00, 0x10, 0xc2, 0x0c,
+  0xc3, 0x20, 0xc4, 0x57, 0x00, 0x10, 0xc2, 0x1e, 0x01, 0x13, 0x13, 0x82, 0x01, 0x11, 0x12, 0xc4,
+  0x2e, 0xc2, 0x47, 0x02, 0x13, 0x10, 0x10, 0xc2, 0x10, 0x81, 0xc3, 0x55, 0x02, 0x11, 0x12, 0x14,
+  0xc3, 0x13, 0x00, 0x13, 0xc3, 0x50, 0xc5, 0x47, 0xc3, 0x5a, 0x42, 0x13, 0xc4, 0x42, 0xc4, 0x03,
+  0xc3, 0x19, 0xc2, 0x20, 0x01, 0x11, 0x10, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00,
+  0xf4, 0x1f, 0x01, 0x0f, 0x0f, 0xcb, 0x3f, 0x07, 0x0f, 0x0f, 0x10, 0x0f, 0x01, 0x00, 0x13, 0x13,
+  0xc6, 0x5f, 0x08, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0xc4, 0x10, 0xc2, 0x1c,
+  0x03, 0x11, 0x11, 0x12, 0x14, 0xc3, 0x13, 0x00, 0x13, 0xc3, 0x8b, 0x43, 0x11, 0x01, 0x12, 0x12,
+  0xc3, 0x02, 0x42, 0x13, 0xc2, 0x9c, 0x42, 0x12, 0x82, 0xc3, 0x05, 0x00, 0x11, 0x42, 0x0f, 0x01,
+  0x00, 0x01, 0xc3, 0x08, 0xc4, 0x23, 0xc2, 0x43, 0x03, 0x10, 0x10, 0x0f, 0x00, 0xc3, 0x0e, 0xc3,
+  0x2f, 0x43, 0x0f, 0xc3, 0x57, 0xc2, 0x3b, 0xc2, 0x27, 0x00, 0x11, 0xc2, 0x64, 0x00, 0x10, 0xc3,
+  0x47, 0x00, 0x0f, 0xc2, 0x4f, 0xc3, 0x27, 0xc3, 0x07, 0xc3, 0x47, 0xc2, 0x7b, 0x82, 0xc2, 0x4c,
+  0x00, 0x10, 0xc5, 0x58, 0x00, 0x11, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xfa,
+  0x1f, 0x42, 0x0f, 0xcc, 0x3f, 0x03, 0x0f, 0x10, 0x10, 0x0f, 0xc8, 0x5f, 0x43, 0x0f, 0x03, 0x10,
+  0x11, 0x10, 0x0f, 0xc5, 0x0a, 0xc3, 0x1b, 0x04, 0x10, 0x11, 0x12, 0x12, 0x11, 0xc2, 0x31, 0x00,
+  0x01, 0xc3, 0x27, 0x00, 0x0f, 0x43, 0x11, 0x81, 0x01, 0x12, 0x10, 0xc4, 0x37, 0xc2, 0x0e, 0x00,
+  0x10, 0xc2, 0x0c, 0xc3, 0x20, 0xc4, 0x57, 0x00, 0x10, 0xc2, 0x1e, 0x01, 0x13, 0x13, 0x82, 0x01,
+  0x11, 0x12, 0xc4, 0x2e, 0xc2, 0x47, 0x02, 0x13, 0x10, 0x10, 0xc2, 0x10, 0x81, 0xc3, 0x55, 0x02,
+  0x11, 0x12, 0x14, 0xc3, 0x13, 0x00, 0x13, 0xc3, 0x50, 0xc5, 0x47, 0xc3, 0x5a, 0x42, 0x13, 0xc4,
+  0x42, 0xc4, 0x03, 0xc3, 0x19, 0xc2, 0x20, 0x01, 0x11, 0x10, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce,
+  0x0e, 0x00, 0x00, 0xf4, 0x1f, 0x01, 0x0f, 0x0f, 0xcb, 0x3f, 0x07, 0x0f, 0x0f, 0x10, 0x0f, 0x01,
+  0x00, 0x13, 0x13, 0xc6, 0x5f, 0x08, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0xc4,
+  0x10, 0xc2, 0x1c, 0x03, 0x11, 0x11, 0x12, 0x14, 0xc3, 0x13, 0x00, 0x13, 0xc3, 0x8b, 0x43, 0x11,
+  0x01, 0x12, 0x12, 0xc3, 0x02, 0x42, 0x13, 0xc2, 0x9c, 0x42, 0x12, 0x82, 0xc3, 0x05, 0xc2, 0x20,
+  0xc2, 0xab, 0xc3, 0x08, 0xc4, 0x23, 0x00, 0x11, 0xc2, 0x40, 0xc3, 0x1f, 0xc6, 0x2f, 0x00, 0x11,
+  0xc2, 0x2f, 0xc3, 0xcb, 0xc5, 0x2e, 0xc3, 0x42, 0x01, 0x10, 0x15, 0xc3, 0x50, 0xc4, 0x4e, 0xc3,
+  0x62, 0xc3, 0x10, 0x02, 0x16, 0x00, 0x01, 0xc3, 0x6d, 0x42, 0x10, 0xc2, 0x4d, 0xc2, 0x05, 0x02,
+  0x16, 0x01, 0x00, 0x05, 0x00, 0x01, 0x17, 0x18, 0x00, 0x01, 0xc9, 0x01, 0x03, 0x01, 0x00, 0x17,
+  0x17, 0xc7, 0x0e, 0x01, 0x17, 0x18, 0xc3, 0x03, 0x01, 0x19, 0x1a, 0xc7, 0x21, 0x01, 0x17, 0x17,
+  0xc3, 0x03, 0x01, 0x1b, 0x19, 0xc5, 0x21, 0xc5, 0x19, 0x01, 0x1c, 0x1c, 0xc3, 0x03, 0xc5, 0x1d,
+  0xc5, 0x19, 0xc7, 0x3f, 0xc7, 0x19, 0xc5, 0x1d, 0xc7, 0x3f, 0xca, 0x6a, 0xc2, 0x21, 0x01, 0x01,
+  0x00, 0xc6, 0x66, 0xca, 0x7f, 0xc4, 0x66, 0xc4, 0x6e, 0xc3, 0x98, 0xc6, 0x80, 0xc4, 0x8e, 0xc3,
+  0x98, 0xc6, 0x80, 0xc3, 0xb6, 0xc4, 0x98, 0xc6, 0x66, 0xc3, 0xb6, 0xc4, 0x98, 0xc8, 0x3f, 0xc6,
+  0x98, 0xc6, 0x66, 0xc9, 0x3f, 0xc9, 0xec, 0xc4, 0xb6, 0x01, 0x02, 0x03, 0xcd, 0x01, 0xce, 0x0e,
+  0x00, 0x02, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x9f, 0xdf, 0xdf, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce,
+  0x0e, 0x00, 0x00, 0xf2, 0x1f, 0x01, 0x05, 0x05, 0xcc, 0x3f, 0x02, 0x05, 0x07, 0x07, 0xc4, 0x10,
+  0x42, 0x05, 0xc4, 0x1c, 0x43, 0x08, 0x43, 0x05, 0x00, 0x07, 0xc2, 0x06, 0x01, 0x01, 0x00, 0x4b,
+  0x08, 0xc3, 0x1f, 0x81, 0x43, 0x04, 0x83, 0x01, 0x04, 0x04, 0xc3, 0x47, 0x05, 0x04, 0x04, 0x02,
+  0x03, 0x02, 0x03, 0xc3, 0x13, 0x01, 0x02, 0x03, 0xc3, 0x3f, 0xc2, 0x0c, 0xc8, 0x01, 0x00, 0x04,
+  0xc2, 0x50, 0xc5, 0x1d, 0xc2, 0x23, 0x05, 0x06, 0x06, 0x03, 0x04, 0x07, 0x05, 0xc4, 0x1f, 0x81,
+  0xc6, 0x25, 0x01, 0x08, 0x05, 0xc4, 0x1f, 0xc8, 0x32, 0xc2, 0x70, 0xcb, 0x3f, 0xc3, 0x1f, 0x01,
+  0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xf2, 0x1f, 0x01, 0x05, 0x05, 0xcc, 0x3f, 0x02,
+  0x05, 0x07, 0x07, 0xc4, 0x10, 0x42, 0x05, 0xc3, 0x5f, 0x81, 0x02, 0x04, 0x08, 0x08, 0x43, 0x05,
+  0x42, 0x07, 0xc2, 0x10, 0xc2, 0x7f, 0x00, 0x05, 0x49, 0x08, 0xc4, 0x22, 0x01, 0x05, 0x04, 0xc2,
+  0x21, 0x81, 0x42, 0x04, 0xc2, 0x18, 0xc3, 0x1f, 0x01, 0x02, 0x03, 0x43, 0x04, 0x02, 0x02, 0x03,
+  0x02, 0xc2, 0x12, 0xc3, 0x5f, 0x00, 0x03, 0xc2, 0x0a, 0xc7, 0x03, 0xc2, 0x6e, 0x00, 0x08, 0xc7,
+  0x0e, 0x00, 0x04, 0xc2, 0x18, 0xc2, 0x6e, 0xc3, 0x06, 0x01, 0x06, 0x06, 0xc7, 0x1f, 0x01, 0x05,
+  0x08, 0xc3, 0x2e, 0x81, 0xc6, 0x34, 0xca, 0x2e, 0xc4, 0x45, 0x01, 0x02, 0x03, 0xca, 0x01, 0x02,
+  0x05, 0x00, 0x01, 0xc8, 0x0e, 0x0a, 0x06, 0x03, 0x02, 0x04, 0x05, 0x01, 0x00, 0x02, 0x03, 0x04,
+  0x04, 0xc4, 0x23, 0x00, 0x06, 0xc2, 0x09, 0xc4, 0x1f, 0x81, 0xcd, 0x1f, 0xc9, 0x41, 0x02, 0x04,
+  0x07, 0x05, 0xc9, 0x3f, 0xc2, 0x58, 0x02, 0x04, 0x08, 0x05, 0xcc, 0x1f, 0x00, 0x02, 0x81, 0xcd,
+  0x1f, 0xce, 0x3f, 0xc2, 0x6e, 0xcc, 0x3f, 0xc2, 0x8e, 0xd8, 0x1f, 0xc2, 0x8e, 0xc5, 0x1f, 0x00,
+  0x06, 0xc2, 0xa8, 0xc6, 0xc3, 0xc2, 0x6e, 0x01, 0x01, 0x03, 0x81, 0xc9, 0x7f, 0x00, 0x07, 0xdd,
+  0x7f, 0xc3, 0x30, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xc3, 0x1f, 0x04, 0x0f,
+  0x0f, 0x13, 0x01, 0x00, 0x42, 0x13, 0xc6, 0x1f, 0x03, 0x0f, 0x13, 0x1d, 0x1d, 0xc3, 0x03, 0xc4,
+  0x10, 0x05, 0x00, 0x01, 0x13, 0x1e, 0x1f, 0x0f, 0x83, 0x02, 0x0f, 0x1f, 0x1e, 0xc2, 0x21, 0x06,
+  0x01, 0x13, 0x20, 0x1f, 0x21, 0x20, 0x0f, 0xc2, 0x2d, 0x08, 0x20, 0x21, 0x1f, 0x20, 0x13, 0x00,
+  0x00, 0x13, 0x0f, 0xc3, 0x2d, 0x42, 0x20, 0x00, 0x0f, 0xc2, 0x02, 0x00, 0x13, 0xc2, 0x1f, 0xc4,
+  0x0d, 0x00, 0x21, 0xc2, 0x24, 0x01, 0x13, 0x0f, 0xc3, 0x1f, 0xc2, 0x10, 0x01, 0x13, 0x0f, 0xc2,
+  0x3b, 0xc2, 0x2c, 0xc2, 0x2e, 0x02, 0x01, 0x01, 0x22, 0xc2, 0x6d, 0x00, 0x1d, 0xc3, 0x1f, 0x03,
+  0x0f, 0x13, 0x0f, 0x22, 0xc2, 0x7f, 0x03, 0x13, 0x12, 0x11, 0x10, 0xc2, 0x10, 0x04, 0x0f, 0x20,
+  0x1d, 0x0f, 0x14, 0xc4, 0x5f, 0xc2, 0x0e, 0xc4, 0x00, 0x00, 0x0f, 0x82, 0xc2, 0x9f, 0x01, 0x22,
+  0x13, 0xc4, 0x21, 0xc4, 0x26, 0x00, 0x22, 0xc3, 0xbf, 0x00, 0x22, 0xc2, 0x21, 0x01, 0x10, 0x14,
+  0xc2, 0x26, 0xc3, 0x2e, 0xc3, 0xbf, 0xc2, 0x21, 0x01, 0x13, 0x13, 0xc3, 0x04, 0xc2, 0x4e, 0xd0,
+  0xdf, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xc3, 0x1f, 0x04, 0x0f, 0x0f, 0x13,
+  0x01, 0x00, 0x42, 0x13, 0xc6, 0x1f, 0x03, 0x0f, 0x13, 0x18, 0x18, 0xc3, 0x03, 0xc4, 0x10, 0x06,
+  0x00, 0x01, 0x13, 0x23, 0x24, 0x0f, 0x25, 0x82, 0x02, 0x0f, 0x24, 0x23, 0xc2, 0x21, 0x04, 0x01,
+  0x13, 0x18, 0x24, 0x0e, 0xc2, 0x0e, 0x0b, 0x13, 0x13, 0x25, 0x0e, 0x24, 0x18, 0x13, 0x00, 0x00,
+  0x13, 0x0f, 0x25, 0xc3, 0x1d, 0xc2, 0x32, 0xc3, 0x07, 0xc2, 0x1f, 0xc4, 0x0d, 0x05, 0x0e, 0x24,
+  0x0e, 0x18, 0x13, 0x0f, 0xc3, 0x1f, 0xc2, 0x10, 0x01, 0x13, 0x0f, 0xc2, 0x3b, 0xc2, 0x2c, 0xc2,
+  0x2e, 0x02, 0x01, 0x01, 0x22, 0xc2, 0x6d, 0xc4, 0x1f, 0x03, 0x0f, 0x13, 0x0f, 0x22, 0xc2, 0x7f,
+  0x04, 0x13, 0x12, 0x11, 0x10, 0x13, 0xc2, 0x42, 0xc2, 0x45, 0x00, 0x14, 0xc4, 0x5f, 0xc2, 0x0e,
+  0xc4, 0x00, 0x00, 0x0f, 0x82, 0xc2, 0x9f, 0x01, 0x22, 0x13, 0xc4, 0x21, 0xc4, 0x26, 0x00, 0x22,
+  0xc3, 0xbf, 0x00, 0x22, 0xc2, 0x21, 0x01, 0x10, 0x14, 0xc2, 0x26, 0xc3, 0x2e, 0xc3, 0xbf, 0xc2,
+  0x21, 0x01, 0x13, 0x13, 0xc3, 0x04, 0xc2, 0x4e, 0xd0, 0xdf, 0x04, 0x00, 0x01, 0x05, 0x03, 0x02,
+  0xca, 0x01, 0x03, 0x01, 0x00, 0x05, 0x04, 0xc4, 0x10, 0x01, 0x06, 0x06, 0xc4, 0x16, 0xc2, 0x1f,
+  0x00, 0x04, 0xc4, 0x1f, 0x81, 0x01, 0x03, 0x02, 0xc2, 0x09, 0xc8, 0x1f, 0xc6, 0x34, 0x02, 0x00,
+  0x05, 0x07, 0xc5, 0x1f, 0xc7, 0x3f, 0x01, 0x05, 0x08, 0xce, 0x1f, 0x00, 0x08, 0xd5, 0x5f, 0xc7,
+  0x3f, 0xc2, 0x70, 0xcd, 0x7f, 0xc2, 0x90, 0xc2, 0x6a, 0xdc, 0x1f, 0xcc, 0x3f, 0x01, 0x05, 0x08,
+  0xcd, 0x7f, 0x00, 0x07, 0xc3, 0xbf, 0xc6, 0xbd, 0xc8, 0x7f, 0xc3, 0xbd, 0xc7, 0x9f, 0xcb, 0xee,
+  0x00, 0x02, 0x03, 0x00, 0x03, 0x09, 0x0a, 0x4b, 0x0e, 0x00, 0x01, 0x8e, 0x01, 0x00, 0x03, 0xcd,
+  0x20, 0x00, 0x01, 0x81, 0xcc, 0x31, 0x01, 0x00, 0x08, 0x8d, 0x00, 0x01, 0x81, 0xcc, 0x50, 0x01,
+  0x00, 0x08, 0xdf, 0x5f, 0xce, 0x7f, 0xce, 0x2f, 0xd1, 0x3f, 0xce, 0x5f, 0xce, 0x8f, 0xd0, 0x9f,
+  0xd0, 0xbf, 0xcd, 0xef, 0x7f, 0x0e, 0xbf, 0xbf, 0xbf, 0x4b, 0x0e, 0x03, 0x0a, 0x09, 0x03, 0x01,
+  0x8e, 0x00, 0x00, 0xcd, 0x1e, 0xcb, 0x1f, 0xc3, 0x0e, 0xcb, 0x1f, 0x84, 0xcb, 0x3f, 0xc2, 0x4e,
+  0x00, 0x08, 0xcb, 0x3f, 0xdf, 0x5f, 0xe2, 0x1f, 0x00, 0x08, 0xda, 0x5f, 0xcf, 0x7f, 0x83, 0xcc,
+  0x7f, 0xce, 0xbf, 0xc5, 0xdf, 0x05, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x14, 0x42, 0x11, 0x42, 0x12,
+  0x00, 0x11, 0xc2, 0x01, 0x04, 0x01, 0x00, 0x13, 0x13, 0x14, 0x82, 0x44, 0x12, 0xc2, 0x15, 0x01,
+  0x00, 0x13, 0x43, 0x10, 0xc4, 0x1d, 0xc3, 0x23, 0x00, 0x11, 0xc5, 0x0e, 0x00, 0x10, 0x43, 0x11,
+  0x00, 0x10, 0xc3, 0x32, 0x01, 0x14, 0x13, 0xc2, 0x20, 0x00, 0x14, 0x44, 0x10, 0xc2, 0x3e, 0x01,
+  0x11, 0x10, 0xc2, 0x3f, 0x00, 0x11, 0xc2, 0x10, 0x01, 0x12, 0x10, 0xc3, 0x44, 0x04, 0x11, 0x10,
+  0x14, 0x00, 0x01, 0xc3, 0x40, 0xc2, 0x27, 0xc2, 0x25, 0xc2, 0x00, 0x04, 0x10, 0x01, 0x13, 0x15,
+  0x15, 0xc3, 0x5f, 0xc2, 0x3c, 0xc4, 0x34, 0xc3, 0x5e, 0xc2, 0x10, 0xc2, 0x4b, 0xc2, 0x22, 0xc2,
+  0x21, 0x00, 0x13, 0xc3, 0x1b, 0xc2, 0x09, 0x00, 0x10, 0xc3, 0x0e, 0xc2, 0x7a, 0x01, 0x14, 0x16,
+  0xc2, 0x0a, 0xc5, 0x11, 0xc2, 0x86, 0x03, 0x11, 0x11, 0x01, 0x00, 0xc5, 0x10, 0x00, 0x15, 0xc4,
+  0x0e, 0x04, 0x12, 0x12, 0x00, 0x01, 0x16, 0xc3, 0x8c, 0xc4, 0x43, 0xc3, 0xa6, 0x02, 0x01, 0x16,
+  0x14, 0xc5, 0x48, 0x00, 0x15, 0xc4, 0x42, 0x00, 0x11, 0xc3, 0x2e, 0xc3, 0x71, 0xc3, 0x10, 0xc3,
+  0x22, 0x02, 0x01, 0x14, 0x16, 0xc4, 0x2a, 0xc4, 0x8d, 0xc2, 0x8f, 0x01, 0x12, 0x12, 0x45, 0x11,
+  0x07, 0x12, 0x11, 0x10, 0x10, 0x13, 0x11, 0x10, 0x14, 0xc3, 0x0e, 0xc2, 0x13, 0xc2, 0x15, 0x01,
+  0x13, 0x13, 0x42, 0x14, 0x00, 0x10, 0xc3, 0x0b, 0xc4, 0x03, 0x03, 0x11, 0x10, 0x15, 0x13, 0x42,
+  0x10, 0xc4, 0x1e, 0xc2, 0x05, 0xc4, 0x10, 0x00, 0x16, 0xc2, 0x20, 0x82, 0xc4, 0x16, 0x43, 0x10,
+  0x00, 0x16, 0xc5, 0x20, 0x01, 0x10, 0x14, 0x44, 0x10, 0x00, 0x14, 0x81, 0x02, 0x11, 0x11, 0x14,
+  0xc2, 0x02, 0xc2, 0x0a, 0x02, 0x14, 0x14, 0x15, 0xc2, 0x4d, 0x02, 0x16, 0x12, 0x12, 0xc3, 0x53,
+  0xc4, 0x1c, 0x01, 0x14, 0x11, 0xc2, 0x11, 0x00, 0x16, 0x83, 0xc5, 0x11, 0xc2, 0x41, 0xc2, 0x89,
+  0x00, 0x16, 0xc3, 0x2c, 0x00, 0x15, 0xc4, 0x4e, 0x83, 0xc2, 0x51, 0xc2, 0x93, 0x81, 0xc5, 0x1e,
+  0xc2, 0x60, 0xc2, 0x4e, 0xc3, 0x10, 0x00, 0x15, 0xc5, 0x12, 0x02, 0x16, 0x15, 0x15, 0xc2, 0xb7,
+  0xc2, 0xb9, 0xc3, 0x70, 0xc3, 0x78, 0xc2, 0x1f, 0xc2, 0x7c, 0xc3, 0x6d, 0x00, 0x15, 0xc4, 0x12,
+  0x00, 0x14, 0xc2, 0x91, 0xc3, 0x0c, 0xc2, 0x0e, 0xc3, 0x04, 0xc2, 0xa1, 0x00, 0x15, 0xc3, 0x3d,
+  0xc2, 0x40, 0xc3, 0xb1, 0x00, 0x14, 0x42, 0x16, 0x00, 0x10, 0x42, 0x11, 0x01, 0x0f, 0x14, 0xc2,
+  0x04, 0x42, 0x12, 0x00, 0x11, 0xc2, 0x01, 0x04, 0x14, 0x11, 0x13, 0x13, 0x14, 0x82, 0x44, 0x12,
+  0xc2, 0x15, 0x01, 0x14, 0x13, 0x43, 0x10, 0xc4, 0x1d, 0xc3, 0x23, 0x00, 0x11, 0xc5, 0x0e, 0xc3,
+  0x35, 0x01, 0x11, 0x10, 0xc3, 0x32, 0x01, 0x14, 0x13, 0xc2, 0x20, 0x00, 0x14, 0x44, 0x10, 0xc2,
+  0x3e, 0x00, 0x11, 0xc2, 0x2a, 0x00, 0x13, 0xc2, 0x04, 0x02, 0x14, 0x12, 0x10, 0xc3, 0x44, 0x01,
+  0x11, 0x10, 0xc2, 0x59, 0xc3, 0x40, 0xc2, 0x27, 0xc2, 0x25, 0xc2, 0x00, 0x04, 0x10, 0x12, 0x13,
+  0x15, 0x15, 0xc3, 0x5f, 0xc2, 0x3c, 0xc4, 0x34, 0xc3, 0x5e, 0xc2, 0x10, 0xc2, 0x4b, 0xc2, 0x22,
+  0xc2, 0x21, 0x00, 0x13, 0xc3, 0x1b, 0xc2, 0x09, 0x00, 0x10, 0xc3, 0x0e, 0xc2, 0x7a, 0x01, 0x14,
+  0x16, 0xc2, 0x0a, 0xc5, 0x11, 0xc2, 0x86, 0x02, 0x11, 0x11, 0x15, 0xc6, 0x10, 0x00, 0x15, 0xc4,
+  0x0e, 0x04, 0x12, 0x12, 0x15, 0x15, 0x16, 0xc3, 0xc2, 0xc4, 0x43, 0xc3, 0xa6, 0x02, 0x15, 0x16,
+  0x14, 0xc5, 0x48, 0x00, 0x15, 0xc4, 0x42, 0x00, 0x11, 0xc3, 0x3f, 0xc3, 0x71, 0xc3, 0x10, 0xc3,
+  0x22, 0xc2, 0x3f, 0xc4, 0x2a, 0xc4, 0x8d, 0xc2, 0x8f, 0x01, 0x12, 0x12, 0x45, 0x11, 0x07, 0x12,
+  0x11, 0x10, 0x10, 0x13, 0x11, 0x10, 0x14, 0xc3, 0x0e, 0xc2, 0x13, 0xc2, 0x15, 0x01, 0x13, 0x13,
+  0x42, 0x14, 0x00, 0x10, 0xc3, 0x0b, 0xc4, 0x03, 0x03, 0x11, 0x10, 0x15, 0x13, 0x42, 0x10, 0xc4,
+  0x1e, 0xc2, 0x05, 0xc4, 0x10, 0x00, 0x16, 0xc2, 0x20, 0x82, 0xc4, 0x16, 0x43, 0x10, 0x00, 0x16,
+  0xc5, 0x20, 0x01, 0x10, 0x14, 0x44, 0x10, 0x00, 0x14, 0x81, 0x02, 0x11, 0x11, 0x14, 0xc2, 0x02,
+  0xc2, 0x0a, 0x02, 0x14, 0x14, 0x15, 0xc2, 0x4d, 0x02, 0x16, 0x12, 0x12, 0xc3, 0x53, 0xc4, 0x1c,
+  0x01, 0x14, 0x11, 0xc2, 0x11, 0x00, 0x16, 0x83, 0xc5, 0x11, 0xc2, 0x41, 0xc2, 0x89, 0x00, 0x16,
+  0xc3, 0x2c, 0x00, 0x15, 0xc4, 0x4e, 0x83, 0xc2, 0x51, 0xc2, 0x93, 0x81, 0xc5, 0x1e, 0xc2, 0x60,
+  0xc2, 0x4e, 0xc3, 0x10, 0x00, 0x15, 0xc5, 0x12, 0x02, 0x16, 0x15, 0x15, 0xc2, 0xb7, 0xc2, 0xb9,
+  0xc3, 0x70, 0xc3, 0x78, 0xc2, 0x1f, 0xc2, 0x7c, 0xc3, 0x6d, 0x00, 0x15, 0xc4, 0x12, 0x00, 0x14,
+  0xc2, 0x91, 0xc3, 0x0c, 0xc2, 0x0e, 0xc3, 0x04, 0xc2, 0xa1, 0x00, 0x15, 0xc3, 0x3d, 0xc2, 0x40,
+  0xc3, 0xb1, 0x00, 0x14, 0x42, 0x16, 0x00, 0x10, 0x42, 0x11, 0x01, 0x10, 0x14, 0x44, 0x10, 0x05,
+  0x14, 0x10, 0x16, 0x00, 0x01, 0x14, 0x81, 0xc2, 0x0d, 0x42, 0x14, 0x00, 0x15, 0xc2, 0x03, 0x02,
+  0x16, 0x01, 0x00, 0xc2, 0x09, 0xc5, 0x1c, 0x01, 0x14, 0x11, 0xc2, 0x11, 0x01, 0x16, 0x01, 0x44,
+  0x14, 0xc3, 0x2e, 0xc2, 0x36, 0xc2, 0x3a, 0x00, 0x16, 0xc3, 0x2c, 0x00, 0x15, 0xc3, 0x0c, 0x00,
+  0x10, 0x83, 0x01, 0x10, 0x16, 0xc2, 0x06, 0x82, 0xc5, 0x1e, 0x02, 0x10, 0x10, 0x16, 0xc2, 0x4e,
+  0xc3, 0x10, 0x00, 0x15, 0xc5, 0x12, 0xc2, 0x5f, 0x00, 0x12, 0xc4, 0x17, 0xc3, 0x70, 0xc3, 0x78,
+  0x01, 0x16, 0x00, 0xc3, 0x7c, 0xc3, 0x6d, 0x00, 0x15, 0xc4, 0x12, 0x01, 0x14, 0x16, 0xc3, 0x7b,
+  0x43, 0x15, 0xc4, 0x04, 0xc2, 0x40, 0x00, 0x15, 0xc3, 0x3d, 0xc2, 0x40, 0xc3, 0x6f, 0x00, 0x14,
+  0x42, 0x16, 0xc3, 0x18, 0x00, 0x14, 0xc3, 0xb4, 0xc3, 0x45, 0xc2, 0x9f, 0xc3, 0x29, 0xc2, 0xbe,
+  0xc2, 0xc4, 0xc2, 0x29, 0xc2, 0xb0, 0x83, 0xc2, 0xcf, 0xc5, 0x2d, 0x81, 0xc2, 0xbf, 0xc3, 0x45,
+  0xc4, 0xd2, 0x06, 0x16, 0x00, 0x16, 0x14, 0x01, 0x15, 0x26, 0xc2, 0x51, 0x81, 0xc4, 0x02, 0x03,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xd5,
+  0x5f, 0x04, 0x16, 0x13, 0x0f, 0x27, 0x0f, 0xc9, 0x5f, 0x04, 0x16, 0x28, 0x29, 0x29, 0x2a, 0xc5,
+  0x10, 0xc4, 0x8e, 0x01, 0x16, 0x2a, 0x82, 0x01, 0x28, 0x13, 0xc9, 0x1f, 0x81, 0x00, 0x2b, 0x82,
+  0xc9, 0x1f, 0x00, 0x2c, 0xc2, 0x2f, 0x01, 0x2c, 0x0f, 0xcb, 0x1f, 0xc2, 0x2f, 0x00, 0x27, 0xce,
+  0x3f, 0x00, 0x27, 0xca, 0x3f, 0x00, 0x2b, 0x82, 0xd4, 0x5f, 0x01, 0x00, 0x01, 0xcd, 0x01, 0x01,
+  0x01, 0x00, 0x4b, 0x13, 0x03, 0x01, 0x00, 0x00, 0x13, 0x43, 0x2d, 0x01, 0x2e, 0x2d, 0x44, 0x2e,
+  0x04, 0x2f, 0x13, 0x01, 0x01, 0x13, 0x4a, 0x2e, 0x81, 0x02, 0x00, 0x00, 0x16, 0x4a, 0x2f, 0x03,
+  0x30, 0x16, 0x01, 0x01, 0x8d, 0xc6, 0x1f, 0x02, 0x30, 0x30, 0x27, 0x81, 0x00, 0x27, 0xc6, 0x1f,
+  0x02, 0x27, 0x27, 0x30, 0xc3, 0x02, 0xc3, 0x04, 0xc7, 0x1f, 0xcb, 0x3f, 0x4b, 0x30, 0xc2, 0x3f,
+  0x00, 0x01, 0x4b, 0x16, 0xc3, 0x9f, 0xc3, 0xb0, 0xc2, 0x24, 0x00, 0x16, 0xc5, 0xb8, 0xc4, 0xbf,
+  0x01, 0x22, 0x16, 0xc2, 0x7a, 0x00, 0x22, 0xc6, 0xbf, 0xc2, 0x0e, 0x85, 0xc4, 0x10, 0xc3, 0xdf,
+  0x81, 0x01, 0x22, 0x16, 0xc2, 0x0e, 0x00, 0x22, 0xc7, 0x1f, 0xc3, 0x10, 0xc6, 0x0e, 0x00, 0x00,
+  0x01, 0x02, 0x03, 0xca, 0x01, 0x02, 0x05, 0x00, 0x01, 0xc8, 0x0e, 0x0a, 0x06, 0x03, 0x02, 0x04,
+  0x05, 0x01, 0x00, 0x02, 0x03, 0x04, 0x04, 0xc4, 0x23, 0x00, 0x06, 0xc2, 0x09, 0xc4, 0x1f, 0x81,
+  0xcd, 0x1f, 0xc9, 0x41, 0x02, 0x04, 0x07, 0x05, 0xc9, 0x3f, 0xc2, 0x58, 0x02, 0x04, 0x08, 0x05,
+  0xcc, 0x1f, 0x00, 0x02, 0x81, 0xcd, 0x1f, 0xce, 0x3f, 0xc2, 0x6e, 0xcc, 0x3f, 0xc2, 0x8e, 0xd8,
+  0x1f, 0xc2, 0x8e, 0xc5, 0x1f, 0x00, 0x06, 0xc2, 0xa8, 0xc6, 0xc3, 0xc2, 0x6e, 0x01, 0x01, 0x03,
+  0x81, 0xc9, 0x7f, 0x00, 0x07, 0xdd, 0x7f, 0xc3, 0x30, 0x04, 0x00, 0x01, 0x05, 0x03, 0x02, 0xca,
+  0x01, 0x03, 0x01, 0x00, 0x05, 0x04, 0xc4, 0x10, 0x01, 0x06, 0x06, 0xc4, 0x16, 0xc2, 0x1f, 0x00,
+  0x04, 0xc4, 0x1f, 0x81, 0x01, 0x03, 0x02, 0xc2, 0x09, 0xc8, 0x1f, 0xc6, 0x34, 0x02, 0x00, 0x05,
+  0x07, 0xc5, 0x1f, 0xc7, 0x3f, 0x01, 0x05, 0x08, 0xce, 0x1f, 0x00, 0x08, 0xd5, 0x5f, 0xc7, 0x3f,
+  0xc2, 0x70, 0xcd, 0x7f, 0xc2, 0x90, 0xc2, 0x6a, 0xdc, 0x1f, 0xcc, 0x3f, 0x01, 0x05, 0x08, 0xcd,
+  0x7f, 0x00, 0x07, 0xc3, 0xbf, 0xc6, 0xbd, 0xc8, 0x7f, 0xc3, 0xbd, 0xc7, 0x9f, 0xcb, 0xee, 0x00,
+  0x02, 0x01, 0x02, 0x03, 0xc9, 0x01, 0x03, 0x04, 0x05, 0x00, 0x01, 0xca, 0x0e, 0x00, 0x02, 0x81,
+  0x01, 0x01, 0x00, 0xdb, 0x1f, 0x02, 0x03, 0x07, 0x05, 0xcc, 0x1f, 0x02, 0x02, 0x08, 0x05, 0xe5,
+  0x3f, 0x01, 0x06, 0x06, 0xcd, 0x5f, 0x81, 0xc7, 0x3f, 0x03, 0x05, 0x03, 0x04, 0x04, 0xcb, 0x81,
+  0x01, 0x08, 0x02, 0x81, 0xcc, 0x92, 0xcc, 0x7f, 0xc2, 0xbc, 0xcb, 0xbf, 0xc3, 0x45, 0xc6, 0x06,
+  0xd4, 0x1f, 0xc3, 0xeb, 0xcf, 0x3f, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xf2,
+  0x1f, 0x01, 0x05, 0x05, 0xcc, 0x3f, 0x02, 0x05, 0x07, 0x07, 0xc4, 0x10, 0x42, 0x05, 0xc3, 0x5f,
+  0x00, 0x05, 0x43, 0x08, 0x43, 0x05, 0x42, 0x07, 0xc2, 0x10, 0xc4, 0x0e, 0xc8, 0x03, 0x00, 0x05,
+  0xc2, 0x1d, 0x43, 0x04, 0x83, 0xc5, 0x06, 0x05, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03, 0xc3, 0x13,
+  0xc2, 0x07, 0xc2, 0x1a, 0xc2, 0x0c, 0xcc, 0x01, 0xc5, 0x0e, 0x00, 0x06, 0xc8, 0x16, 0xc9, 0x1f,
+  0xc5, 0x2b, 0xc9, 0x2e, 0xc5, 0x49, 0xcf, 0x3f, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00,
+  0x00, 0xf2, 0x1f, 0x01, 0x05, 0x05, 0xcc, 0x3f, 0x02, 0x05, 0x07, 0x07, 0xc4, 0x10, 0x42, 0x05,
+  0xc3, 0x5f, 0x00, 0x05, 0x43, 0x08, 0x43, 0x05, 0x42, 0x07, 0xc2, 0x10, 0xc4, 0x0e, 0xc8, 0x03,
+  0x00, 0x05, 0xc2, 0x1d, 0x43, 0x04, 0x83, 0xc5, 0x06, 0x05, 0x04, 0x04, 0x02, 0x03, 0x02, 0x03,
+  0xc3, 0x13, 0xc2, 0x07, 0xc2, 0x1a, 0xc2, 0x0c, 0xc6, 0x01, 0x01, 0x06, 0x06, 0xc3, 0x0b, 0xc8,
+  0x0e, 0x00, 0x03, 0x81, 0xc3, 0x29, 0xc9, 0x1f, 0xc3, 0x12, 0xcb, 0x1f, 0xc5, 0x38, 0xce, 0x0e,
+  0x00, 0x02, 0x05, 0x00, 0x01, 0x05, 0x04, 0x02, 0x03, 0xc9, 0x01, 0x01, 0x01, 0x00, 0x81, 0xca,
+  0x0e, 0x00, 0x02, 0xc5, 0x1f, 0x00, 0x06, 0xc9, 0x1f, 0x01, 0x05, 0x07, 0xc9, 0x2e, 0x05, 0x04,
+  0x04, 0x02, 0x00, 0x05, 0x08, 0xc9, 0x3d, 0x81, 0xcd, 0x3f, 0xc3, 0x1f, 0xcb, 0x5f, 0xcf, 0x1f,
+  0xc2, 0x78, 0x00, 0x05, 0xcb, 0x3f, 0xc2, 0x87, 0x00, 0x08, 0xcc, 0x7d, 0xc2, 0x52, 0xcd, 0x0e,
+  0x00, 0x03, 0xca, 0xaa, 0xc4, 0x94, 0xca, 0xbb, 0x00, 0x06, 0xd1, 0x1f, 0x00, 0x04, 0xcb, 0x1f,
+  0xcf, 0x3f, 0xc4, 0xf6, 0x03, 0x00, 0x03, 0x09, 0x0a, 0x4b, 0x0e, 0x00, 0x01, 0x8e, 0xf0, 0x1f,
+  0x00, 0x08, 0xce, 0x3f, 0x01, 0x08, 0x03, 0xce, 0x1f, 0x8d, 0x03, 0x00, 0x03, 0x08, 0x0a, 0xcb,
+  0x80, 0x00, 0x01, 0xc2, 0x30, 0xcb, 0x91, 0x02, 0x00, 0x01, 0x03, 0xc3, 0x10, 0xc8, 0xa3, 0x00,
+  0x01, 0xc3, 0x10, 0x00, 0x08, 0x42, 0x09, 0x42, 0x0a, 0xc5, 0x1f, 0xc2, 0x21, 0xc2, 0x11, 0xc2,
+  0x35, 0xc3, 0x12, 0x00, 0x0a, 0xc2, 0x1f, 0xc2, 0x12, 0x42, 0x03, 0xc2, 0x11, 0xc2, 0x12, 0x00,
+  0x09, 0xc4, 0x0e, 0xc8, 0x12, 0x01, 0x08, 0x08, 0xc7, 0x0e, 0xc4, 0x36, 0xc2, 0x26, 0x7f, 0x0e,
+  0xbf, 0xbf, 0x4f, 0x0a, 0x4f, 0x09, 0x01, 0x08, 0x08, 0x42, 0x03, 0x45, 0x08, 0xc4, 0x08, 0x4f,
+  0x03, 0x4b, 0x0e, 0x03, 0x0a, 0x09, 0x03, 0x01, 0x8e, 0x00, 0x00, 0xfd, 0x1f, 0x00, 0x08, 0xcd,
+  0x3f, 0x01, 0x03, 0x08, 0xcd, 0x5f, 0x81, 0xcb, 0x5f, 0xc2, 0x2e, 0xcb, 0x7f, 0xc2, 0x8d, 0x01,
+  0x08, 0x01, 0xc7, 0x7f, 0x42, 0x0a, 0xc2, 0x0e, 0x01, 0x03, 0x00, 0xc4, 0x9f, 0xc3, 0x0c, 0x02,
+  0x09, 0x09, 0x08, 0xc3, 0x0e, 0x00, 0x00, 0x43, 0x0a, 0x00, 0x09, 0xc2, 0x29, 0xc2, 0x0d, 0xc3,
+  0x0e, 0x00, 0x01, 0xc2, 0x18, 0x00, 0x03, 0xc2, 0x0d, 0x42, 0x03, 0xc2, 0x0c, 0xc2, 0x1f, 0x43,
+  0x08, 0xc8, 0x0c, 0xc2, 0x1f, 0x44, 0x03, 0xc7, 0x0c, 0xc2, 0x3f, 0x08, 0x00, 0x01, 0x00, 0x16,
+  0x15, 0x12, 0x12, 0x11, 0x10, 0x42, 0x14, 0x04, 0x15, 0x14, 0x15, 0x15, 0x01, 0xc3, 0x10, 0x00,
+  0x11, 0xc2, 0x0e, 0x01, 0x10, 0x10, 0xc2, 0x0d, 0x01, 0x14, 0x14, 0xc2, 0x1f, 0x00, 0x01, 0x81,
+  0xc2, 0x1d, 0x44, 0x15, 0x00, 0x14, 0xc5, 0x1f, 0xc4, 0x2b, 0xc5, 0x11, 0xc3, 0x1f, 0x03, 0x00,
+  0x16, 0x16, 0x15, 0xc2, 0x2e, 0xc4, 0x2f, 0xc3, 0x3f, 0xc3, 0x32, 0xc2, 0x4e, 0x03, 0x16, 0x26,
+  0x26, 0x15, 0xc4, 0x3f, 0xc4, 0x43, 0xc2, 0x00, 0x81, 0x00, 0x26, 0xc4, 0x5f, 0xc7, 0x23, 0x03,
+  0x31, 0x31, 0x32, 0x32, 0xc9, 0x0e, 0x00, 0x00, 0x82, 0x01, 0x29, 0x32, 0xcb, 0x1f, 0x01, 0x32,
+  0x29, 0x81, 0xcb, 0x2e, 0xc2, 0x0e, 0x00, 0x31, 0xcb, 0x0e, 0x42, 0x31, 0x00, 0x29, 0xc6, 0x5f,
+  0x00, 0x1c, 0xc4, 0x1d, 0x01, 0x32, 0x26, 0xc7, 0x1f, 0x08, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26,
+  0x16, 0x16, 0x31, 0xc6, 0x7f, 0xc5, 0x00, 0x02, 0x1c, 0x00, 0x16, 0xca, 0x7f, 0xc4, 0xba, 0x05,
+  0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x43, 0x11, 0x03, 0x10, 0x10, 0x14, 0x16, 0xc4, 0x0d, 0x82,
+  0xc2, 0x10, 0x01, 0x10, 0x15, 0x81, 0xc2, 0x10, 0x83, 0x00, 0x10, 0xc3, 0x20, 0xc2, 0x1d, 0x00,
+  0x16, 0x81, 0x01, 0x32, 0x14, 0xc2, 0x0e, 0x01, 0x10, 0x16, 0xc2, 0x21, 0xc2, 0x1c, 0x05, 0x31,
+  0x16, 0x14, 0x32, 0x15, 0x26, 0xc2, 0x27, 0x81, 0xc4, 0x02, 0x02, 0x32, 0x29, 0x29, 0x83, 0xc2,
+  0x36, 0x05, 0x16, 0x16, 0x01, 0x16, 0x16, 0x31, 0xc2, 0x0e, 0x00, 0x31, 0x81, 0x06, 0x26, 0x26,
+  0x16, 0x01, 0x00, 0x01, 0x00, 0xc2, 0x0e, 0x42, 0x31, 0xc2, 0x03, 0x00, 0x32, 0x81, 0x02, 0x00,
+  0x01, 0x1c, 0xc4, 0x1d, 0x01, 0x32, 0x26, 0xc2, 0x0e, 0x01, 0x31, 0x32, 0xc2, 0x1f, 0x05, 0x1c,
+  0x1c, 0x00, 0x26, 0x1c, 0x26, 0xc2, 0x33, 0xc2, 0x23, 0x81, 0xc2, 0x2e, 0xc4, 0x00, 0x02, 0x1c,
+  0x00, 0x16, 0xc3, 0x23, 0xc3, 0x30, 0xc6, 0x01, 0x00, 0x00, 0xc3, 0x34, 0xc4, 0x41, 0xc6, 0x12,
+  0x01, 0x29, 0x29, 0xc2, 0x50, 0xc2, 0x39, 0xc2, 0x30, 0xc4, 0x23, 0x04, 0x1c, 0x31, 0x1c, 0x32,
+  0x16, 0x81, 0xc7, 0x0e, 0xc2, 0x42, 0xc4, 0x0c, 0xc3, 0x4f, 0xc6, 0x41, 0xcb, 0x0c, 0x01, 0x01,
+  0x00, 0x08, 0x15, 0x26, 0x15, 0x16, 0x15, 0x12, 0x12, 0x11, 0x10, 0x42, 0x14, 0x01, 0x15, 0x14,
+  0x42, 0x15, 0x42, 0x26, 0x01, 0x16, 0x11, 0xc2, 0x0e, 0x01, 0x10, 0x10, 0xc2, 0x0d, 0x04, 0x14,
+  0x14, 0x31, 0x31, 0x32, 0x82, 0xc2, 0x1d, 0x44, 0x15, 0x06, 0x14, 0x15, 0x31, 0x32, 0x31, 0x32,
+  0x16, 0xc4, 0x2b, 0xc5, 0x11, 0x42, 0x31, 0x81, 0x02, 0x16, 0x16, 0x15, 0xc2, 0x2e, 0xc4, 0x2f,
+  0x06, 0x32, 0x32, 0x26, 0x31, 0x26, 0x16, 0x01, 0xc3, 0x22, 0x05, 0x16, 0x26, 0x26, 0x15, 0x14,
+  0x29, 0xc2, 0x10, 0xc2, 0x41, 0x00, 0x01, 0x43, 0x16, 0xc2, 0x5a, 0x02, 0x15, 0x29, 0x29, 0xc2,
+  0x50, 0x06, 0x1c, 0x26, 0x16, 0x00, 0x00, 0x01, 0x16, 0xc2, 0x5b, 0x05, 0x32, 0x1c, 0x31, 0x1c,
+  0x32, 0x16, 0x81, 0x43, 0x00, 0x82, 0x00, 0x29, 0x81, 0x00, 0x00, 0xc5, 0x0c, 0xc3, 0x1f, 0x01,
+  0x32, 0x29, 0x81, 0x46, 0x00, 0x00, 0x01, 0xc3, 0x2e, 0xc2, 0x0e, 0x00, 0x31, 0xc2, 0x08, 0xc5,
+  0x01, 0xc2, 0x0e, 0xc2, 0x7b, 0x00, 0x29, 0xc6, 0x0e, 0x00, 0x1c, 0xc4, 0x1d, 0xc2, 0x7b, 0xc6,
+  0x1f, 0x02, 0x1c, 0x1c, 0x00, 0xc3, 0x65, 0x01, 0x16, 0x31, 0xc6, 0x2e, 0xc5, 0x52, 0x02, 0x1c,
+  0x00, 0x16, 0xc8, 0x3f, 0xc6, 0x47, 0x05, 0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x43, 0x11, 0x03,
+  0x10, 0x10, 0x14, 0x16, 0xc4, 0x0d, 0x82, 0xc2, 0x10, 0x01, 0x10, 0x15, 0x81, 0xc2, 0x10, 0x83,
+  0x00, 0x10, 0xc3, 0x20, 0xc2, 0x1d, 0x00, 0x16, 0x81, 0x01, 0x32, 0x14, 0xc2, 0x0e, 0x01, 0x10,
+  0x16, 0xc2, 0x21, 0xc2, 0x1c, 0x05, 0x31, 0x16, 0x14, 0x32, 0x15, 0x26, 0xc2, 0x27, 0x81, 0xc4,
+  0x02, 0x02, 0x32, 0x29, 0x29, 0x83, 0xc2, 0x36, 0x05, 0x16, 0x16, 0x01, 0x16, 0x16, 0x31, 0xc2,
+  0x0e, 0x00, 0x31, 0x81, 0x06, 0x26, 0x26, 0x16, 0x01, 0x00, 0x01, 0x00, 0xc2, 0x0e, 0x42, 0x31,
+  0xc2, 0x03, 0x00, 0x32, 0x81, 0x02, 0x00, 0x01, 0x1c, 0xc4, 0x1d, 0x01, 0x32, 0x26, 0xc2, 0x0e,
+  0x01, 0x31, 0x32, 0xc2, 0x1f, 0x05, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0xc2, 0x33, 0xc2, 0x23,
+  0x81, 0xc2, 0x2e, 0xc4, 0x00, 0x02, 0x1c, 0x00, 0x16, 0xc3, 0x23, 0xc3, 0x30, 0xc6, 0x01, 0x00,
+  0x00, 0xc3, 0x34, 0xc4, 0x41, 0xc6, 0x12, 0x01, 0x29, 0x29, 0xc2, 0x50, 0xc2, 0x39, 0xc2, 0x30,
+  0xc4, 0x23, 0x04, 0x1c, 0x31, 0x1c, 0x32, 0x16, 0x81, 0xc7, 0x0e, 0xc2, 0x42, 0xc4, 0x0c, 0xc3,
+  0x4f, 0xc6, 0x41, 0xcb, 0x0c, 0x01, 0x01, 0x00, 0x04, 0x15, 0x26, 0x15, 0x14, 0x14, 0x42, 0x16,
+  0x04, 0x00, 0x16, 0x16, 0x01, 0x00, 0xc2, 0x01, 0x81, 0x02, 0x26, 0x26, 0x16, 0xc3, 0x08, 0xc6,
+  0x03, 0x02, 0x31, 0x31, 0x32, 0x81, 0xc9, 0x0e, 0x04, 0x01, 0x31, 0x32, 0x31, 0x32, 0xcd, 0x1f,
+  0x82, 0xca, 0x1f, 0x03, 0x32, 0x32, 0x26, 0x31, 0xcb, 0x30, 0x00, 0x29, 0xc2, 0x10, 0xcb, 0x41,
+  0x01, 0x29, 0x29, 0xc2, 0x50, 0x00, 0x1c, 0xc2, 0x62, 0xc6, 0x63, 0x04, 0x1c, 0x31, 0x1c, 0x32,
+  0x16, 0x81, 0x43, 0x00, 0xc4, 0x7f, 0x01, 0x1c, 0x00, 0xc5, 0x0c, 0xc7, 0x1f, 0xc6, 0x00, 0xc8,
+  0x90, 0xca, 0x8a, 0xc5, 0x1f, 0xce, 0x10, 0xef, 0x1f, 0x01, 0x00, 0x01, 0xc2, 0x01, 0x06, 0x16,
+  0x2c, 0x29, 0x29, 0x2a, 0x2c, 0x05, 0xc3, 0x0b, 0xc3, 0x0e, 0x07, 0x01, 0x16, 0x2a, 0x29, 0x2b,
+  0x2a, 0x28, 0x0f, 0xc3, 0x1a, 0xc5, 0x1f, 0x81, 0x00, 0x29, 0x81, 0x00, 0x13, 0xca, 0x1f, 0x02,
+  0x28, 0x28, 0x27, 0x81, 0xc9, 0x1f, 0x05, 0x28, 0x2a, 0x2a, 0x18, 0x27, 0x16, 0xc9, 0x3f, 0x03,
+  0x27, 0x2a, 0x29, 0x05, 0x81, 0xc8, 0x3f, 0x06, 0x22, 0x16, 0x16, 0x05, 0x16, 0x16, 0x22, 0xc8,
+  0x5f, 0xca, 0x03, 0xce, 0x0e, 0xff, 0x1f, 0xf0, 0x5f, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e,
+  0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xd9, 0x9f, 0x44, 0x16, 0x00, 0x13, 0xc7, 0xbf, 0x03, 0x16,
+  0x16, 0x33, 0x34, 0x42, 0x35, 0x00, 0x06, 0xc7, 0x0e, 0x01, 0x33, 0x34, 0xc3, 0x0e, 0x01, 0x35,
+  0x35, 0xc6, 0x1d, 0x44, 0x34, 0x83, 0xc5, 0x2c, 0x00, 0x36, 0xc2, 0x1e, 0xc5, 0x01, 0x01, 0x00,
+  0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xcf, 0x9f, 0x00, 0x13, 0xce,
+  0xb0, 0x00, 0x06, 0xce, 0x10, 0x00, 0x06, 0xce, 0x10, 0x01, 0x35, 0x35, 0xcd, 0x21, 0x03, 0x34,
+  0x34, 0x33, 0x16, 0xcb, 0xf2, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f,
+  0xff, 0x5f, 0xce, 0x9f, 0x00, 0x13, 0xce, 0x0e, 0x00, 0x37, 0xcd, 0x1d, 0x01, 0x38, 0x37, 0xce,
+  0x0e, 0x00, 0x38, 0xce, 0x0e, 0x00, 0x38, 0xcc, 0x2c, 0x82, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce,
+  0x0e, 0x00, 0x00, 0xf3, 0x1f, 0x49, 0x16, 0xc4, 0x3f, 0x03, 0x13, 0x38, 0x39, 0x38, 0x46, 0x39,
+  0x00, 0x16, 0xc2, 0x5f, 0x00, 0x13, 0x4a, 0x38, 0x01, 0x39, 0x16, 0xc2, 0x1d, 0x00, 0x37, 0xc3,
+  0x01, 0xc5, 0x00, 0x01, 0x38, 0x39, 0xc2, 0x0e, 0x00, 0x39, 0x89, 0x01, 0x39, 0x38, 0xc2, 0x0e,
+  0x8b, 0x00, 0x39, 0xc3, 0x03, 0xca, 0x3f, 0xc2, 0x2b, 0x00, 0x39, 0xcc, 0x3f, 0xc2, 0x49, 0xc2,
+  0x33, 0xcb, 0x3f, 0xc2, 0x6e, 0xcb, 0x3f, 0x4c, 0x38, 0x81, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce,
+  0x0e, 0x00, 0x00, 0xff, 0x1f, 0xdf, 0x5f, 0x00, 0x16, 0xce, 0x7f, 0x00, 0x39, 0xce, 0x10, 0x00,
+  0x38, 0xce, 0x10, 0x00, 0x38, 0xce, 0x10, 0x01, 0x38, 0x39, 0xcd, 0x21, 0x81, 0xcd, 0x10, 0x82,
+  0xcc, 0x21, 0xc2, 0x2e, 0xc2, 0x21, 0x00, 0x38, 0xc8, 0x76, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce,
+  0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x9f, 0xdf, 0xdf, 0x01, 0x00, 0x01, 0xcd, 0x01,
+  0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xc6, 0x9f, 0x48, 0x16, 0xc6, 0xae, 0x03, 0x16,
+  0x14, 0x15, 0x15, 0xc4, 0x02, 0xc7, 0x1f, 0x03, 0x10, 0x14, 0x14, 0x10, 0x81, 0x01, 0x10, 0x14,
+  0xc5, 0xce, 0x00, 0x0f, 0x48, 0x3a, 0xc5, 0xdf, 0x00, 0x13, 0x88, 0xc7, 0x2e, 0xc7, 0x00, 0x01,
+  0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0x4f, 0x16, 0x02, 0x15,
+  0x14, 0x15, 0xcd, 0x02, 0x00, 0x10, 0x81, 0x01, 0x10, 0x14, 0xc9, 0x05, 0x5f, 0x3a, 0x4f, 0x10,
+  0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0x4f, 0x16, 0x02,
+  0x14, 0x15, 0x15, 0xcc, 0x02, 0x03, 0x10, 0x14, 0x14, 0x10, 0x81, 0xc9, 0x05, 0x5f, 0x3a, 0x4f,
+  0x10, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0x4f, 0x16,
+  0x02, 0x15, 0x15, 0x14, 0xcd, 0x02, 0x01, 0x15, 0x10, 0xc2, 0x02, 0x01, 0x14, 0x14, 0xc7, 0x05,
+  0x5f, 0x3a, 0x4f, 0x10, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff,
+  0x5f, 0x46, 0x16, 0xc8, 0xa5, 0x02, 0x15, 0x14, 0x15, 0xc2, 0x02, 0x00, 0x16, 0xc8, 0xb6, 0x05,
+  0x15, 0x10, 0x14, 0x14, 0x10, 0x14, 0xc9, 0x1f, 0x46, 0x3a, 0x00, 0x0f, 0xc7, 0xd6, 0x86, 0x00,
+  0x13, 0xc7, 0xe7, 0x46, 0x10, 0xc8, 0x50, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00,
+  0xff, 0x1f, 0xce, 0x5f, 0x00, 0x13, 0xce, 0x0e, 0x00, 0x0e, 0xce, 0x0e, 0x00, 0x3b, 0xce, 0x0e,
+  0x00, 0x3c, 0xcb, 0x3b, 0x42, 0x3b, 0x00, 0x3c, 0xcc, 0x2c, 0xcb, 0x1f, 0xc3, 0x0e, 0x81, 0xc8,
+  0x3f, 0xc4, 0x0e, 0xc2, 0x21, 0xc9, 0x59, 0xc3, 0x1e, 0x01, 0x0e, 0x0e, 0xc8, 0x4a, 0x00, 0x3c,
+  0xc2, 0x3d, 0xc2, 0x21, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xe0, 0x1f, 0x49,
+  0x16, 0xc4, 0x49, 0x03, 0x13, 0x0e, 0x3c, 0x0e, 0x46, 0x3c, 0xc4, 0x10, 0x4a, 0x0e, 0xc2, 0x10,
+  0x03, 0x13, 0x16, 0x3b, 0x0e, 0xc2, 0x01, 0xc5, 0x00, 0x05, 0x0e, 0x3c, 0x13, 0x3d, 0x3d, 0x3c,
+  0x89, 0x04, 0x3c, 0x0e, 0x16, 0x3d, 0x0f, 0x8b, 0x03, 0x3c, 0x16, 0x3e, 0x13, 0x81, 0xc9, 0x3f,
+  0x82, 0x00, 0x3e, 0xcd, 0x3f, 0x02, 0x3f, 0x3f, 0x0e, 0xcb, 0x3f, 0x8e, 0xc2, 0x50, 0x00, 0x16,
+  0xcb, 0x7f, 0xc2, 0x92, 0x00, 0x3f, 0xcc, 0x7f, 0x82, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e,
+  0x00, 0x00, 0xff, 0x1f, 0x42, 0x16, 0x00, 0x13, 0xcb, 0x63, 0x03, 0x3d, 0x3e, 0x3e, 0x3f, 0xcb,
+  0x10, 0x42, 0x0f, 0x01, 0x3f, 0x16, 0xca, 0x83, 0x42, 0x13, 0x81, 0xca, 0x94, 0x42, 0x3e, 0xcc,
+  0x1f, 0x03, 0x3e, 0x3f, 0x3f, 0x0f, 0xcb, 0x50, 0x84, 0xca, 0xc3, 0x43, 0x16, 0xcb, 0xd2, 0x02,
+  0x3e, 0x0f, 0x0f, 0xcc, 0x10, 0x83, 0x00, 0x3c, 0xca, 0x70, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce,
+  0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xca, 0x9f, 0x42, 0x0f, 0xcc, 0x9f, 0x03, 0x0f, 0x10,
+  0x10, 0x0f, 0xc8, 0x9f, 0x43, 0x0f, 0x03, 0x10, 0x11, 0x10, 0x0f, 0xc5, 0x0a, 0xc3, 0x1b, 0x04,
+  0x10, 0x11, 0x12, 0x12, 0x11, 0xc2, 0x31, 0x00, 0x00, 0xc3, 0x27, 0x00, 0x0f, 0x43, 0x11, 0x81,
+  0x01, 0x12, 0x10, 0xc4, 0x37, 0x03, 0x12, 0x11, 0x11, 0x10, 0xc2, 0x0c, 0xc3, 0x20, 0x01, 0x00,
+  0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x5f, 0xc4, 0x9f, 0x01, 0x0f, 0x0f,
+  0xcb, 0x9f, 0x07, 0x0f, 0x0f, 0x10, 0x0f, 0x00, 0x01, 0x13, 0x13, 0xc6, 0x9f, 0x08, 0x0f, 0x10,
+  0x10, 0x11, 0x10, 0x0f, 0x13, 0x10, 0x10, 0xc4, 0x10, 0xc2, 0x1c, 0x03, 0x11, 0x11, 0x12, 0x14,
+  0xc3, 0x13, 0x00, 0x13, 0xc3, 0xda, 0x43, 0x11, 0x01, 0x12, 0x12, 0xc3, 0x02, 0x42, 0x13, 0xc2,
+  0xeb, 0x42, 0x12, 0x82, 0xc3, 0x05, 0xc2, 0x20, 0xc2, 0xfc, 0x01, 0x00, 0x01, 0xc2, 0x01, 0x03,
+  0x16, 0x40, 0x36, 0x33, 0x44, 0x34, 0x01, 0x33, 0x36, 0xc3, 0x0e, 0x00, 0x01, 0x81, 0x00, 0x40,
+  0xc2, 0x11, 0x01, 0x33, 0x33, 0x42, 0x36, 0xc5, 0x1f, 0x00, 0x36, 0xc4, 0x10, 0xc2, 0x0e, 0x00,
+  0x16, 0xc8, 0x1f, 0xc2, 0x21, 0x03, 0x40, 0x40, 0x16, 0x33, 0xc9, 0x1f, 0x82, 0xc2, 0x47, 0xc5,
+  0x3f, 0x84, 0xc2, 0x1e, 0x01, 0x40, 0x40, 0xc3, 0x5f, 0x01, 0x05, 0x16, 0xc5, 0x30, 0x83, 0xc3,
+  0x0e, 0x03, 0x05, 0x05, 0x16, 0x05, 0xc2, 0x62, 0xc4, 0x16, 0xc4, 0x7f, 0xc5, 0x11, 0x82, 0x00,
+  0x36, 0xc3, 0x1f, 0xc4, 0x32, 0xc4, 0x00, 0x82, 0xc5, 0x0e, 0xc6, 0x14, 0xc5, 0x3f, 0xcb, 0x10,
+  0x00, 0x05, 0xcb, 0x1f, 0xc3, 0x5a, 0xcc, 0x1f, 0xc2, 0x7a, 0xcd, 0x1f, 0x01, 0x00, 0x01, 0xce,
+  0x1f, 0x00, 0x00, 0x42, 0x36, 0x02, 0x16, 0x00, 0x01, 0xc9, 0x01, 0x02, 0x40, 0x16, 0x16, 0x44,
+  0x13, 0xc7, 0x12, 0x01, 0x16, 0x33, 0x44, 0x34, 0x00, 0x33, 0xc7, 0x10, 0xc2, 0x0d, 0x42, 0x35,
+  0x01, 0x06, 0x06, 0xc7, 0x10, 0xc3, 0x1d, 0xc4, 0x10, 0x00, 0x13, 0xc5, 0x45, 0xc4, 0x2e, 0x43,
+  0x35, 0x00, 0x16, 0xc5, 0x54, 0x00, 0x36, 0xc6, 0x3f, 0x00, 0x33, 0xc6, 0x65, 0x00, 0x40, 0x45,
+  0x33, 0xc2, 0x75, 0xc5, 0x74, 0x01, 0x40, 0x40, 0xc2, 0x0b, 0xc3, 0x01, 0xc7, 0x1f, 0x02, 0x40,
+  0x36, 0x40, 0x85, 0xc7, 0x1f, 0x01, 0x40, 0x16, 0x83, 0x02, 0x05, 0x16, 0x05, 0xc6, 0x1f, 0x81,
+  0x04, 0x40, 0x36, 0x16, 0x16, 0x05, 0xc5, 0x0e, 0x00, 0x00, 0x43, 0x16, 0xc2, 0x1b, 0xc7, 0x0e,
+  0x00, 0x01, 0x45, 0x05, 0xc9, 0xd0, 0xcb, 0xdb, 0xc3, 0xe7, 0xce, 0x0e, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0xc6, 0x01, 0x06, 0x13, 0x37, 0x37, 0x39, 0x37, 0x38, 0x37, 0xc8, 0x0e, 0x02, 0x38, 0x37,
+  0x39, 0x81, 0x01, 0x37, 0x37, 0xcb, 0x0e, 0xc9, 0x1f, 0xc7, 0x0e, 0x81, 0xc5, 0x3f, 0x00, 0x13,
+  0xc6, 0x0e, 0xc8, 0x1f, 0xc7, 0x0e, 0x00, 0x39, 0xc6, 0x1f, 0xc3, 0x4b, 0xc3, 0x0e, 0x00, 0x39,
+  0xc7, 0x1f, 0xc2, 0x6a, 0x00, 0x38, 0xc2, 0x71, 0xc7, 0x1f, 0xc3, 0x4a, 0xc2, 0x7d, 0x00, 0x39,
+  0xc8, 0x5f, 0x82, 0xc3, 0x12, 0xc7, 0x5f, 0xc4, 0x0e, 0xc3, 0x32, 0xc8, 0x9d, 0xc5, 0x21, 0x00,
+  0x41, 0xc9, 0x3f, 0xc4, 0x0e, 0x00, 0x38, 0xcc, 0x3f, 0x01, 0x41, 0x38, 0xc7, 0x7f, 0xc4, 0x5e,
+  0xc2, 0x0e, 0xc7, 0x7f, 0xc3, 0x6a, 0xc3, 0x0e, 0x00, 0x16, 0x42, 0x38, 0x00, 0x37, 0xc3, 0x01,
+  0xc5, 0x00, 0x01, 0x38, 0x39, 0xc3, 0x0e, 0x89, 0xc5, 0x0e, 0x8a, 0x00, 0x39, 0xc2, 0x23, 0xca,
+  0x00, 0x81, 0x00, 0x39, 0xc4, 0x3d, 0xc9, 0x3f, 0xc4, 0x20, 0xca, 0x3f, 0xc2, 0x1f, 0x05, 0x38,
+  0x42, 0x39, 0x42, 0x39, 0x39, 0x44, 0x42, 0xc3, 0x2e, 0x01, 0x38, 0x41, 0xc9, 0x6f, 0x00, 0x42,
+  0xc2, 0x6f, 0x00, 0x41, 0xcb, 0x4f, 0x00, 0x42, 0xc2, 0x1d, 0x4a, 0x39, 0x01, 0x42, 0x39, 0xc3,
+  0x0e, 0x49, 0x16, 0x01, 0x41, 0x42, 0xc3, 0x0e, 0x00, 0x27, 0x47, 0x30, 0x02, 0x27, 0x16, 0x41,
+  0xc2, 0x1d, 0xc2, 0x0d, 0x03, 0x2f, 0x16, 0x2f, 0x30, 0xc2, 0x02, 0x02, 0x30, 0x30, 0x16, 0xc2,
+  0x0e, 0x04, 0x2f, 0x30, 0x2f, 0x13, 0x13, 0x81, 0xc3, 0x03, 0xc2, 0x15, 0x03, 0x30, 0x2f, 0x43,
+  0x2f, 0x42, 0x0f, 0x81, 0xc2, 0x04, 0x06, 0x30, 0x43, 0x2f, 0x44, 0x45, 0x46, 0x46, 0x44, 0x2f,
+  0x00, 0x30, 0xc3, 0x03, 0x01, 0x46, 0x46, 0x02, 0x39, 0x39, 0x38, 0x42, 0x39, 0x04, 0x38, 0x39,
+  0x16, 0x01, 0x00, 0xc4, 0x01, 0x82, 0xcc, 0x10, 0x00, 0x38, 0xc2, 0x1f, 0xcb, 0x21, 0x42, 0x38,
+  0xc4, 0x32, 0xc2, 0x25, 0xc4, 0x32, 0xc7, 0x1d, 0xc2, 0x27, 0x00, 0x42, 0x43, 0x16, 0xc7, 0x1d,
+  0xc3, 0x55, 0xc3, 0x02, 0xc8, 0x1d, 0xc4, 0x14, 0xc2, 0x5b, 0xc4, 0x6e, 0xc5, 0x43, 0xcb, 0x21,
+  0xc7, 0x10, 0x00, 0x42, 0xc7, 0x7f, 0xc2, 0x98, 0x43, 0x37, 0x01, 0x39, 0x42, 0xc7, 0x7f, 0xc5,
+  0x40, 0x00, 0x42, 0xc2, 0x21, 0xc6, 0x7f, 0x84, 0x00, 0x41, 0xc6, 0x10, 0xc3, 0x95, 0xc3, 0x2f,
+  0x00, 0x16, 0xc6, 0x10, 0xc7, 0x2f, 0x00, 0x30, 0xc7, 0x10, 0x86, 0x01, 0x45, 0x44, 0xc9, 0x10,
+  0x83, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xdf, 0x1f, 0x48, 0x16, 0xc6, 0x47,
+  0x47, 0x39, 0x00, 0x13, 0xc6, 0x58, 0x47, 0x38, 0x00, 0x13, 0xd6, 0x1f, 0x88, 0xc6, 0x87, 0x47,
+  0x37, 0xd7, 0x3f, 0x88, 0xc6, 0xb8, 0xc8, 0x2f, 0xd6, 0x1f, 0xdf, 0x3f, 0x01, 0x00, 0x01, 0xc3,
+  0x01, 0x00, 0x16, 0x48, 0x10, 0xc4, 0x0e, 0xc2, 0x10, 0x07, 0x3a, 0x14, 0x14, 0x3a, 0x15, 0x15,
+  0x3a, 0x14, 0xc5, 0x1f, 0x04, 0x00, 0x13, 0x3a, 0x10, 0x10, 0xc3, 0x12, 0xc7, 0x1f, 0x88, 0xc6,
+  0x1f, 0x00, 0x0f, 0xce, 0x1f, 0x88, 0xcb, 0x1f, 0xc2, 0x4f, 0xcc, 0x1f, 0x83, 0xeb, 0x1f, 0xc2,
+  0x92, 0x00, 0x14, 0xce, 0x5f, 0xc7, 0x9f, 0xe7, 0x1f, 0xd0, 0xbf, 0x4f, 0x10, 0x05, 0x14, 0x3a,
+  0x15, 0x15, 0x3a, 0x14, 0xc9, 0x05, 0x00, 0x10, 0xc3, 0x0c, 0x00, 0x10, 0xc9, 0x05, 0x8d, 0xc2,
+  0x3d, 0xa3, 0xc5, 0x02, 0x92, 0xc6, 0x4f, 0x99, 0x00, 0x15, 0xc7, 0x39, 0xc2, 0x95, 0x83, 0xc2,
+  0x9f, 0x8b, 0x00, 0x15, 0x8d, 0x00, 0x14, 0xc3, 0xbf, 0x8a, 0x00, 0x15, 0xc2, 0x01, 0xca, 0xbf,
+  0x03, 0x14, 0x10, 0x15, 0x16, 0x8c, 0x02, 0x15, 0x16, 0x27, 0x4f, 0x10, 0x05, 0x3a, 0x14, 0x14,
+  0x3a, 0x15, 0x15, 0xc9, 0x05, 0x00, 0x3a, 0xc5, 0x12, 0xc8, 0x05, 0x90, 0x02, 0x14, 0x14, 0x10,
+  0xc8, 0x02, 0x83, 0x00, 0x15, 0x49, 0x3a, 0x00, 0x15, 0xc3, 0x4e, 0xc2, 0x32, 0x87, 0xc2, 0x2a,
+  0xc2, 0x13, 0x8a, 0xc2, 0x0c, 0xc3, 0x52, 0xc9, 0x1f, 0xc5, 0x62, 0x89, 0x00, 0x15, 0x82, 0x00,
+  0x14, 0x47, 0x15, 0x44, 0x14, 0x01, 0x10, 0x15, 0x49, 0x16, 0xc2, 0x11, 0x02, 0x15, 0x15, 0x16,
+  0x49, 0x27, 0xc3, 0x10, 0xca, 0x0e, 0xc4, 0x10, 0x01, 0x27, 0x45, 0x89, 0x00, 0x45, 0xc2, 0x21,
+  0x4d, 0x45, 0x01, 0x27, 0x16, 0x4f, 0x10, 0x05, 0x14, 0x14, 0x3a, 0x15, 0x15, 0x3a, 0xc9, 0x05,
+  0x01, 0x10, 0x10, 0xc3, 0x0c, 0xc9, 0x05, 0x8f, 0xc2, 0x2f, 0x9f, 0xc2, 0x4f, 0x85, 0xc4, 0x2b,
+  0x8e, 0xc2, 0x5f, 0x9f, 0xc7, 0x39, 0xc3, 0x85, 0xc6, 0x8f, 0x89, 0x00, 0x14, 0x8e, 0x00, 0x15,
+  0xcf, 0x1f, 0xce, 0x9f, 0x00, 0x15, 0x8e, 0x46, 0x10, 0x02, 0x16, 0x00, 0x01, 0xc5, 0x01, 0x05,
+  0x15, 0x3a, 0x14, 0x14, 0x3a, 0x14, 0xc8, 0x0e, 0x04, 0x00, 0x14, 0x3a, 0x10, 0x10, 0x81, 0x00,
+  0x13, 0xc7, 0x0e, 0x00, 0x01, 0x86, 0xce, 0x1f, 0x00, 0x0f, 0xce, 0x1f, 0x00, 0x0f, 0xff, 0x1f,
+  0xc8, 0x7f, 0x00, 0x15, 0xce, 0x5f, 0x86, 0xe8, 0x1f, 0xd5, 0x9f, 0xc9, 0xbf, 0x01, 0x00, 0x01,
+  0xc2, 0x01, 0x04, 0x13, 0x0e, 0x3b, 0x3c, 0x3c, 0x42, 0x3b, 0x02, 0x0e, 0x0e, 0x3b, 0xc8, 0x0e,
+  0x81, 0x00, 0x0e, 0xc3, 0x01, 0xca, 0x0e, 0x81, 0xc2, 0x21, 0xc2, 0x2e, 0x00, 0x13, 0xc6, 0x0e,
+  0xc2, 0x34, 0xc5, 0x1f, 0xc8, 0x0e, 0xc2, 0x43, 0xc3, 0x1f, 0xc3, 0x4b, 0xc4, 0x0e, 0xc7, 0x1f,
+  0xc4, 0x4a, 0xc3, 0x62, 0x00, 0x0e, 0xc5, 0x3f, 0xc3, 0x4a, 0xc4, 0x3d, 0x01, 0x0e, 0x47, 0xc4,
+  0x7d, 0x82, 0xc5, 0x5d, 0x00, 0x47, 0xc4, 0x5f, 0xc4, 0x0e, 0xc3, 0x7d, 0x02, 0x47, 0x0e, 0x3c,
+  0xc5, 0x9d, 0xc5, 0x21, 0xc2, 0x0e, 0x00, 0x3c, 0xc6, 0x3f, 0xc7, 0x0e, 0x00, 0x16, 0xc9, 0x3f,
+  0xc4, 0x0e, 0x00, 0x30, 0xc6, 0x3f, 0xc3, 0x4a, 0xc3, 0x0e, 0x00, 0x2f, 0xc6, 0xdd, 0xc3, 0x4a,
+  0xc3, 0x0e, 0x00, 0x2e, 0xc6, 0xbf, 0xc7, 0x0e, 0x00, 0x2e, 0x03, 0x0e, 0x0e, 0x3b, 0x0e, 0x46,
+  0x3b, 0x04, 0x3c, 0x0e, 0x3c, 0x16, 0x3f, 0x8b, 0x02, 0x3c, 0x0e, 0x47, 0x82, 0xc8, 0x01, 0x82,
+  0x01, 0x0e, 0x47, 0xc2, 0x2d, 0xc7, 0x2f, 0x00, 0x0e, 0xc2, 0x30, 0xc2, 0x1e, 0xca, 0x3f, 0xc3,
+  0x22, 0x04, 0x47, 0x0d, 0x47, 0x0d, 0x0d, 0x44, 0x47, 0xc2, 0x3f, 0x81, 0x00, 0x47, 0xc9, 0x5f,
+  0xc4, 0x10, 0xcb, 0x4f, 0xc5, 0x21, 0xc8, 0x01, 0x00, 0x47, 0xc2, 0x10, 0xc2, 0x82, 0xc8, 0x00,
+  0xc2, 0x41, 0x03, 0x47, 0x0e, 0x16, 0x27, 0x47, 0x30, 0x00, 0x27, 0xc4, 0x10, 0xc2, 0x0d, 0x03,
+  0x2f, 0x16, 0x2f, 0x30, 0xc2, 0x02, 0x01, 0x30, 0x30, 0xc3, 0x21, 0x04, 0x2f, 0x30, 0x2f, 0x13,
+  0x13, 0x81, 0xc3, 0x03, 0xc2, 0x15, 0x03, 0x47, 0x47, 0x43, 0x2f, 0x42, 0x0f, 0x81, 0xc2, 0x04,
+  0x01, 0x30, 0x43, 0xc3, 0x10, 0x00, 0x2e, 0x44, 0x2f, 0x00, 0x30, 0xc3, 0x03, 0x01, 0x2e, 0x2e,
+  0xc2, 0x37, 0x81, 0x00, 0x0f, 0xc5, 0x2f, 0x00, 0x0f, 0x82, 0xc2, 0x10, 0x08, 0x3e, 0x0f, 0x0f,
+  0x16, 0x0e, 0x3c, 0x16, 0x01, 0x00, 0xc6, 0x01, 0x83, 0x00, 0x3c, 0xca, 0x10, 0x42, 0x0f, 0x82,
+  0xc9, 0x21, 0x02, 0x47, 0x13, 0x13, 0xc3, 0x1f, 0x01, 0x0e, 0x16, 0xc6, 0x30, 0x00, 0x0e, 0x42,
+  0x47, 0xc2, 0x1e, 0xc8, 0x41, 0xc3, 0x1b, 0xc2, 0x3f, 0x81, 0xc6, 0x50, 0x00, 0x3c, 0xc3, 0x3c,
+  0xca, 0x50, 0x81, 0xc3, 0x1d, 0xca, 0x3f, 0xc6, 0x10, 0xca, 0x3f, 0xc4, 0x21, 0xca, 0x3f, 0xc4,
+  0x42, 0xc8, 0x7f, 0xc3, 0x4c, 0xca, 0x7f, 0x00, 0x3c, 0xc3, 0x10, 0xca, 0x7f, 0x00, 0x47, 0xc4,
+  0x10, 0xc9, 0x7f, 0x00, 0x47, 0xc6, 0x10, 0xc7, 0xe1, 0x00, 0x16, 0xc6, 0x10, 0xc7, 0xbf, 0x05,
+  0x00, 0x01, 0x00, 0x01, 0x0f, 0x14, 0x42, 0x11, 0x42, 0x12, 0x00, 0x11, 0xc2, 0x01, 0x04, 0x01,
+  0x00, 0x13, 0x13, 0x14, 0x82, 0x44, 0x12, 0xc2, 0x15, 0x01, 0x00, 0x13, 0x43, 0x10, 0xc4, 0x1d,
+  0xc3, 0x23, 0x00, 0x11, 0xc5, 0x0e, 0x00, 0x10, 0x43, 0x11, 0x00, 0x10, 0xc3, 0x32, 0x01, 0x14,
+  0x13, 0xc2, 0x20, 0x00, 0x14, 0x44, 0x10, 0xc2, 0x3e, 0x01, 0x11, 0x10, 0xc2, 0x3f, 0x00, 0x11,
+  0xc2, 0x10, 0x01, 0x12, 0x10, 0xc3, 0x44, 0x04, 0x11, 0x10, 0x14, 0x00, 0x01, 0xc3, 0x40, 0xc2,
+  0x27, 0xc2, 0x25, 0xc2, 0x00, 0x04, 0x10, 0x01, 0x13, 0x15, 0x15, 0xc3, 0x5f, 0xc2, 0x3c, 0xc4,
+  0x34, 0xc3, 0x5e, 0xc2, 0x10, 0xc2, 0x4b, 0xc2, 0x22, 0xc2, 0x21, 0x00, 0x13, 0xc3, 0x1b, 0xc2,
+  0x09, 0x00, 0x10, 0xc3, 0x0e, 0xc2, 0x7a, 0x01, 0x14, 0x16, 0xc2, 0x0a, 0xc5, 0x11, 0xc2, 0x86,
+  0x03, 0x11, 0x11, 0x01, 0x00, 0xc5, 0x10, 0x00, 0x15, 0xc4, 0x0e, 0x04, 0x12, 0x12, 0x00, 0x01,
+  0x16, 0xc3, 0x8c, 0xc4, 0x43, 0xc3, 0xa6, 0x02, 0x01, 0x16, 0x14, 0xc5, 0x48, 0x00, 0x15, 0xc4,
+  0x42, 0x00, 0x11, 0xc3, 0x2e, 0xc3, 0x71, 0xc3, 0x10, 0xc3, 0x22, 0x02, 0x01, 0x14, 0x16, 0xc4,
+  0x2a, 0xc4, 0x8d, 0xc2, 0x8f, 0x01, 0x12, 0x12, 0x45, 0x11, 0x07, 0x12, 0x11, 0x10, 0x10, 0x13,
+  0x01, 0x00, 0x01, 0xc3, 0x0e, 0xc2, 0x13, 0xc2, 0x15, 0x00, 0x13, 0xc3, 0x0e, 0x00, 0x00, 0xc3,
+  0x0b, 0xc4, 0x03, 0x02, 0x11, 0x10, 0x15, 0xc3, 0x1f, 0xc4, 0x1e, 0x00, 0x10, 0xc4, 0x23, 0x04,
+  0x10, 0x15, 0x16, 0x01, 0x00, 0xc3, 0x0a, 0x42, 0x10, 0x00, 0x11, 0xc2, 0x3e, 0x04, 0x10, 0x10,
+  0x16, 0x00, 0x01, 0x82, 0x02, 0x11, 0x10, 0x14, 0x44, 0x10, 0x00, 0x14, 0x81, 0x02, 0x01, 0x00,
+  0x14, 0x81, 0xc2, 0x0d, 0x42, 0x14, 0x00, 0x15, 0xc2, 0x03, 0xc2, 0x1f, 0xc2, 0x09, 0xc5, 0x1c,
+  0x01, 0x14, 0x11, 0xc2, 0x11, 0x01, 0x16, 0x00, 0x44, 0x14, 0xc3, 0x3b, 0xc2, 0x41, 0xc2, 0x89,
+  0x00, 0x16, 0xc3, 0x2c, 0x00, 0x15, 0xc4, 0x4e, 0x83, 0x01, 0x10, 0x16, 0xc2, 0x06, 0x82, 0xc5,
+  0x1e, 0xc2, 0x60, 0xc2, 0x4e, 0xc3, 0x10, 0x00, 0x15, 0xc5, 0x12, 0xc2, 0x7f, 0xc2, 0xb7, 0xc2,
+  0xb9, 0xc3, 0x70, 0xc3, 0x78, 0x01, 0x16, 0x01, 0xc3, 0x7c, 0xc3, 0x6d, 0x00, 0x15, 0xc4, 0x12,
+  0x01, 0x14, 0x16, 0xc3, 0x7b, 0x43, 0x15, 0xc4, 0x04, 0xc2, 0xa1, 0x00, 0x15, 0xc3, 0x3d, 0xc2,
+  0x40, 0xc3, 0xb1, 0x00, 0x14, 0x42, 0x16, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00,
+  0xff, 0x1f, 0xea, 0x5f, 0x44, 0x16, 0xc8, 0x8e, 0x06, 0x16, 0x16, 0x40, 0x36, 0x36, 0x33, 0x34,
+  0xc8, 0x1b, 0xc4, 0x0d, 0x01, 0x34, 0x35, 0xc6, 0x2a, 0xc5, 0x0d, 0x02, 0x34, 0x35, 0x06, 0xca,
+  0x2c, 0xc3, 0x2e, 0xc5, 0x1f, 0x00, 0x16, 0x44, 0x40, 0xc3, 0x20, 0xc5, 0x3f, 0x85, 0x00, 0x40,
+  0xc2, 0x3e, 0xcb, 0x1f, 0xc4, 0x21, 0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xff,
+  0x1f, 0xdf, 0x5f, 0x03, 0x16, 0x16, 0x13, 0x0f, 0xcb, 0x83, 0x00, 0x35, 0x42, 0x06, 0x01, 0x0f,
+  0x0f, 0xc9, 0x94, 0x00, 0x35, 0xc3, 0x10, 0x00, 0x06, 0xc9, 0x10, 0x43, 0x35, 0xcb, 0x10, 0xc2,
+  0x1f, 0xc4, 0x11, 0xc7, 0x32, 0x02, 0x35, 0x34, 0x34, 0xc3, 0x11, 0x01, 0x06, 0x13, 0xc6, 0xd8,
+  0x43, 0x34, 0x01, 0x33, 0x33, 0x42, 0x36, 0x00, 0x16, 0xc5, 0xe9, 0xc5, 0x0c, 0xc2, 0x11, 0x00,
+  0x16, 0xc5, 0xf8, 0x01, 0x00, 0x01, 0xc3, 0x01, 0x09, 0x13, 0x37, 0x39, 0x39, 0x41, 0x38, 0x39,
+  0x39, 0x16, 0x44, 0xc4, 0x0e, 0x01, 0x00, 0x13, 0xc6, 0x0e, 0x01, 0x30, 0x2f, 0xc3, 0x1f, 0x01,
+  0x0f, 0x13, 0x81, 0xc6, 0x0e, 0x00, 0x2e, 0xc3, 0x2e, 0x02, 0x0f, 0x48, 0x13, 0xc7, 0x0e, 0x00,
+  0x2e, 0xc4, 0x1f, 0x81, 0xc5, 0x2c, 0x42, 0x2d, 0xc5, 0x1f, 0x43, 0x16, 0x01, 0x44, 0x45, 0x43,
+  0x46, 0xc5, 0x1f, 0x02, 0x48, 0x49, 0x4a, 0xc5, 0x0e, 0x00, 0x46, 0xc5, 0x3f, 0x81, 0x01, 0x13,
+  0x2e, 0x45, 0x2d, 0xc7, 0x1f, 0x00, 0x13, 0xc2, 0x4b, 0xc3, 0x01, 0xc8, 0x1f, 0x86, 0xc8, 0x1f,
+  0xc6, 0x2f, 0xc8, 0x3f, 0xc5, 0x4e, 0xc8, 0x5f, 0x87, 0xd4, 0x5f, 0x00, 0x1c, 0xcd, 0x5f, 0x00,
+  0x1c, 0x8a, 0x00, 0x45, 0x42, 0x46, 0x0b, 0x2f, 0x0f, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x0f,
+  0x30, 0x46, 0x46, 0x43, 0x2d, 0x03, 0x2f, 0x3f, 0x0f, 0x0f, 0x81, 0x05, 0x0f, 0x0f, 0x3f, 0x30,
+  0x43, 0x43, 0x44, 0x2e, 0x47, 0x30, 0x52, 0x2e, 0x03, 0x2d, 0x2d, 0x0f, 0x13, 0x49, 0x16, 0x03,
+  0x13, 0x0f, 0x46, 0x0f, 0x43, 0x43, 0x01, 0x2e, 0x2e, 0xc5, 0x38, 0xc2, 0x45, 0x00, 0x43, 0x4d,
+  0x2f, 0xc4, 0x68, 0xc9, 0x2e, 0x00, 0x30, 0x81, 0x00, 0x13, 0x4b, 0x4b, 0x00, 0x0f, 0x85, 0xc5,
+  0x51, 0x82, 0xc2, 0x98, 0x03, 0x16, 0x4b, 0x4c, 0x4d, 0x45, 0x13, 0x00, 0x4d, 0xc3, 0x08, 0x84,
+  0x45, 0x0f, 0x88, 0xc8, 0x00, 0xc7, 0x1f, 0xc6, 0x00, 0x8e, 0x01, 0x4e, 0x4f, 0x8d, 0x01, 0x50,
+  0x50, 0x81, 0x07, 0x46, 0x45, 0x44, 0x16, 0x41, 0x42, 0x39, 0x42, 0x42, 0x39, 0x00, 0x38, 0x43,
+  0x37, 0x03, 0x43, 0x43, 0x2f, 0x30, 0xc8, 0x10, 0xc2, 0x00, 0x42, 0x2e, 0xc7, 0x10, 0xc3, 0x23,
+  0x00, 0x39, 0x82, 0xc5, 0x10, 0xc6, 0x00, 0x44, 0x43, 0xc3, 0x32, 0xc6, 0x00, 0x00, 0x0f, 0x44,
+  0x46, 0xc2, 0x54, 0xc6, 0x00, 0x00, 0x30, 0xc7, 0x10, 0x01, 0x4a, 0x30, 0x45, 0x2f, 0x01, 0x13,
+  0x2f, 0xc3, 0x32, 0x02, 0x2e, 0x2e, 0x13, 0x81, 0xc3, 0x4b, 0x02, 0x30, 0x16, 0x2f, 0xc3, 0x07,
+  0xc3, 0x17, 0x00, 0x2e, 0xc3, 0x4b, 0x89, 0x04, 0x44, 0x45, 0x46, 0x13, 0x13, 0xc2, 0x8c, 0xc4,
+  0x17, 0x00, 0x2e, 0x84, 0x01, 0x0f, 0x0f, 0x82, 0x01, 0x45, 0x45, 0xc3, 0x60, 0x00, 0x45, 0xc3,
+  0x2f, 0x43, 0x30, 0x88, 0xc2, 0x4f, 0x01, 0x0f, 0x3f, 0xca, 0x2f, 0x88, 0xd0, 0x5f, 0xc8, 0x4f,
+  0xc2, 0xab, 0x47, 0x37, 0x02, 0x13, 0x01, 0x00, 0xc4, 0x01, 0x47, 0x38, 0x00, 0x13, 0xc5, 0x0e,
+  0x00, 0x00, 0x47, 0x39, 0x02, 0x13, 0x13, 0x0f, 0xc4, 0x21, 0x47, 0x42, 0x02, 0x16, 0x51, 0x0f,
+  0xc4, 0x30, 0x47, 0x41, 0x82, 0xc4, 0x41, 0x48, 0x16, 0xc6, 0x1f, 0x45, 0x2f, 0x02, 0x16, 0x49,
+  0x49, 0xc6, 0x1f, 0x44, 0x2e, 0x01, 0x2f, 0x13, 0x83, 0xc4, 0x70, 0x44, 0x43, 0x00, 0x2e, 0x84,
+  0xc4, 0x81, 0x05, 0x30, 0x13, 0x13, 0x46, 0x46, 0x45, 0xc9, 0x1f, 0x81, 0x00, 0x0f, 0x87, 0xc5,
+  0x1f, 0x01, 0x30, 0x30, 0xc7, 0x2f, 0xc7, 0x1f, 0xc7, 0x4f, 0xc6, 0x3f, 0x87, 0x01, 0x1c, 0x1c,
+  0xce, 0x5f, 0x00, 0x1c, 0xc3, 0xe1, 0x44, 0x46, 0xc5, 0x5f, 0xc4, 0x1f, 0x01, 0x00, 0x01, 0xc4,
+  0x01, 0x08, 0x13, 0x3a, 0x10, 0x10, 0x3a, 0x14, 0x14, 0x3a, 0x10, 0xc5, 0x0e, 0x01, 0x01, 0x16,
+  0x47, 0x15, 0xc5, 0x1f, 0x00, 0x0f, 0x48, 0x16, 0xc5, 0x2e, 0x05, 0x0f, 0x51, 0x49, 0x49, 0x16,
+  0x27, 0x43, 0x45, 0xc6, 0x1f, 0x82, 0x01, 0x13, 0x45, 0x43, 0x46, 0xc9, 0x1f, 0x85, 0xc9, 0x1f,
+  0x01, 0x0f, 0x2e, 0x43, 0x2d, 0xc9, 0x3f, 0x01, 0x0f, 0x2f, 0x43, 0x2e, 0xca, 0x1f, 0x84, 0xca,
+  0x1f, 0xc4, 0x2f, 0xca, 0x3f, 0xce, 0x5f, 0x85, 0xf9, 0x5f, 0x00, 0x13, 0xc4, 0x8f, 0x05, 0x10,
+  0x3a, 0x14, 0x14, 0x3a, 0x10, 0xc4, 0x05, 0x04, 0x14, 0x15, 0x16, 0x27, 0x45, 0x4b, 0x15, 0xc2,
+  0x0e, 0x00, 0x45, 0x4b, 0x16, 0x03, 0x27, 0x45, 0x46, 0x46, 0x4c, 0x45, 0x4d, 0x46, 0x00, 0x45,
+  0x43, 0x43, 0x8b, 0xc2, 0x1e, 0x00, 0x0f, 0x4a, 0x2d, 0x00, 0x2e, 0xc2, 0x0e, 0x06, 0x43, 0x13,
+  0x13, 0x30, 0x2f, 0x13, 0x13, 0x44, 0x2e, 0x05, 0x2f, 0x2e, 0x2e, 0x13, 0x2f, 0x0f, 0x82, 0x01,
+  0x0f, 0x0f, 0x89, 0x45, 0x30, 0xc5, 0x2f, 0xc7, 0x1f, 0x01, 0x3f, 0x0f, 0xc7, 0x5f, 0x8d, 0x01,
+  0x46, 0x46, 0x81, 0xcd, 0x5f, 0x81, 0x4a, 0x2e, 0x00, 0x2f, 0xc3, 0x2f, 0x8b, 0xc3, 0x6f, 0xcb,
+  0x8f, 0x83, 0x4e, 0x45, 0x00, 0x27, 0x8e, 0x00, 0x45, 0x5f, 0x46, 0x01, 0x0f, 0x13, 0x49, 0x16,
+  0x01, 0x13, 0x0f, 0x45, 0x43, 0x01, 0x2e, 0x2e, 0xc2, 0x02, 0xc2, 0x01, 0x03, 0x2f, 0x30, 0x0f,
+  0x46, 0x4d, 0x2f, 0x03, 0x30, 0x0f, 0x30, 0x13, 0xc8, 0x30, 0x05, 0x13, 0x0f, 0x30, 0x2f, 0x13,
+  0x13, 0x4b, 0x4b, 0x02, 0x0f, 0x30, 0x16, 0x83, 0xc5, 0x51, 0x82, 0x00, 0x13, 0x81, 0x03, 0x16,
+  0x4b, 0x4c, 0x4d, 0x45, 0x13, 0x00, 0x4d, 0xc2, 0x08, 0x85, 0x45, 0x0f, 0x88, 0xc8, 0x00, 0xc7,
+  0x1f, 0xc6, 0x00, 0x8e, 0x01, 0x4e, 0x4f, 0x8d, 0x01, 0x50, 0x50, 0x83, 0x01, 0x16, 0x15, 0x42,
+  0x14, 0x03, 0x3a, 0x10, 0x10, 0x3a, 0xc6, 0x05, 0x01, 0x27, 0x16, 0x4d, 0x15, 0x01, 0x45, 0x27,
+  0x4d, 0x16, 0x01, 0x46, 0x45, 0x4d, 0x27, 0x02, 0x43, 0x43, 0x27, 0x4c, 0x45, 0x01, 0x46, 0x46,
+  0x82, 0x4c, 0x46, 0x02, 0x2f, 0x2e, 0x2e, 0x4a, 0x43, 0x03, 0x2e, 0x43, 0x27, 0x2f, 0xc2, 0x11,
+  0x0a, 0x2e, 0x13, 0x13, 0x2f, 0x30, 0x13, 0x13, 0x2e, 0x2e, 0x2f, 0x2e, 0x85, 0x01, 0x0f, 0x0f,
+  0x82, 0x00, 0x0f, 0x83, 0xc5, 0x2f, 0x45, 0x30, 0x02, 0x43, 0x43, 0x2f, 0xc3, 0x5f, 0xc2, 0x4f,
+  0x01, 0x0f, 0x3f, 0xc3, 0x1f, 0x02, 0x46, 0x46, 0x45, 0xc6, 0x5f, 0x89, 0xcd, 0x5f, 0xc2, 0x2f,
+  0xc4, 0x5f, 0xc7, 0x02, 0xc7, 0x5f, 0x89, 0xcd, 0x8f, 0x08, 0x14, 0x3a, 0x10, 0x10, 0x3a, 0x14,
+  0x13, 0x01, 0x00, 0xc6, 0x01, 0x45, 0x15, 0x00, 0x16, 0xc7, 0x0e, 0x00, 0x00, 0x46, 0x16, 0x00,
+  0x0f, 0xc7, 0x1f, 0x42, 0x27, 0x04, 0x16, 0x51, 0x51, 0x52, 0x0f, 0xc7, 0x30, 0x42, 0x45, 0x00,
+  0x13, 0x83, 0xc7, 0x3f, 0x00, 0x46, 0x86, 0xc7, 0x50, 0x03, 0x43, 0x2e, 0x2e, 0x0f, 0xcb, 0x1f,
+  0x02, 0x2e, 0x2f, 0x2f, 0x84, 0xc7, 0x70, 0x87, 0xc7, 0x7f, 0xc7, 0x2f, 0xc7, 0x90, 0xc2, 0x4f,
+  0xcc, 0x3f, 0x87, 0xdc, 0x5f, 0x01, 0x49, 0x51, 0xcd, 0x5f, 0x82, 0xca, 0x5f, 0x00, 0x13, 0xcb,
+  0x1f, 0x0c, 0x00, 0x01, 0x00, 0x13, 0x3c, 0x3c, 0x47, 0x0e, 0x3c, 0x3c, 0x16, 0x30, 0x2f, 0x42,
+  0x2d, 0x02, 0x01, 0x00, 0x01, 0x81, 0xc6, 0x0e, 0x43, 0x2e, 0xc3, 0x1f, 0xca, 0x0e, 0x00, 0x2e,
+  0xc3, 0x1f, 0xc8, 0x2c, 0x02, 0x2d, 0x2d, 0x0f, 0xc2, 0x3f, 0x43, 0x16, 0xc6, 0x1d, 0x01, 0x0f,
+  0x43, 0xc2, 0x3f, 0x02, 0x00, 0x0f, 0x27, 0xc8, 0x0e, 0x00, 0x2f, 0xc2, 0x5f, 0x03, 0x01, 0x0f,
+  0x16, 0x2e, 0x45, 0x2d, 0x02, 0x13, 0x2f, 0x30, 0xc4, 0x1f, 0x00, 0x13, 0xc5, 0x4b, 0x00, 0x2e,
+  0x81, 0x00, 0x13, 0xc4, 0x1f, 0x8a, 0xc4, 0x3f, 0x01, 0x48, 0x13, 0xc5, 0x30, 0x81, 0x00, 0x16,
+  0xc4, 0x3f, 0x01, 0x48, 0x16, 0xc5, 0x7c, 0x82, 0xc5, 0x1f, 0x89, 0xc5, 0x1f, 0xc9, 0x2f, 0xc5,
+  0x3f, 0x00, 0x0f, 0xce, 0x1f, 0x00, 0x49, 0xc5, 0x10, 0xc8, 0x3f, 0x00, 0x49, 0xc5, 0x60, 0x82,
+  0x0a, 0x2d, 0x2f, 0x3f, 0x0f, 0x0f, 0x2f, 0x30, 0x0f, 0x0f, 0x3f, 0x30, 0x43, 0x43, 0x02, 0x2f,
+  0x2e, 0x2e, 0x47, 0x30, 0x55, 0x2e, 0x00, 0x13, 0x49, 0x16, 0x01, 0x13, 0x0f, 0x45, 0x43, 0x01,
+  0x2e, 0x2e, 0xc2, 0x02, 0xc2, 0x2d, 0xc2, 0x45, 0xc2, 0x04, 0xcb, 0x00, 0xc2, 0x10, 0x00, 0x13,
+  0xc8, 0x30, 0x05, 0x13, 0x0f, 0x30, 0x2f, 0x13, 0x2f, 0x4b, 0x4b, 0x02, 0x0f, 0x30, 0x16, 0x83,
+  0xc5, 0x51, 0x82, 0x00, 0x13, 0x83, 0x01, 0x4c, 0x4d, 0x45, 0x13, 0x00, 0x4d, 0xc2, 0x08, 0x85,
+  0x45, 0x0f, 0x88, 0xc8, 0x00, 0xc7, 0x1f, 0xc6, 0x00, 0x8e, 0x01, 0x4e, 0x4f, 0x8d, 0x01, 0x50,
+  0x50, 0xd4, 0x3f, 0x0a, 0x30, 0x16, 0x47, 0x47, 0x3c, 0x47, 0x3c, 0x3c, 0x16, 0x01, 0x00, 0xc4,
+  0x01, 0x00, 0x2f, 0xc6, 0x10, 0x00, 0x16, 0xc5, 0x0e, 0x01, 0x00, 0x2e, 0xc6, 0x10, 0xc7, 0x1f,
+  0x01, 0x43, 0x43, 0xc5, 0x21, 0xc8, 0x1f, 0x00, 0x2e, 0xc3, 0x21, 0xc2, 0x00, 0xc6, 0x3f, 0x82,
+  0xc2, 0x32, 0x01, 0x27, 0x13, 0xc6, 0x4e, 0x00, 0x00, 0x43, 0x43, 0x03, 0x2e, 0x2e, 0x16, 0x13,
+  0xc6, 0x4e, 0x01, 0x01, 0x2f, 0xc3, 0x30, 0x01, 0x2f, 0x13, 0xc8, 0x1f, 0x87, 0xc7, 0x1f, 0x00,
+  0x2e, 0xc3, 0x2f, 0x01, 0x13, 0x51, 0xcd, 0x1f, 0x00, 0x16, 0x81, 0xcc, 0x3f, 0x82, 0xc7, 0x5f,
+  0xc7, 0x2f, 0xcc, 0x5f, 0x00, 0x0f, 0xcc, 0x3f, 0xc2, 0x0e, 0xc9, 0x3f, 0xc3, 0x9f, 0x01, 0x13,
+  0x49, 0xc9, 0x5f, 0x08, 0x00, 0x01, 0x00, 0x16, 0x15, 0x12, 0x12, 0x11, 0x10, 0x42, 0x14, 0x04,
+  0x15, 0x14, 0x15, 0x15, 0x01, 0xc3, 0x10, 0x00, 0x11, 0xc2, 0x0e, 0x01, 0x10, 0x10, 0xc2, 0x0d,
+  0x01, 0x14, 0x14, 0xc2, 0x1f, 0x00, 0x01, 0x81, 0xc2, 0x1d, 0x44, 0x15, 0x00, 0x14, 0xc5, 0x1f,
+  0xc4, 0x2b, 0xc5, 0x11, 0xc3, 0x1f, 0x03, 0x00, 0x16, 0x16, 0x15, 0xc2, 0x2e, 0xc4, 0x2f, 0xc3,
+  0x3f, 0xc3, 0x32, 0xc2, 0x4e, 0x03, 0x16, 0x26, 0x26, 0x15, 0xc4, 0x3f, 0xc4, 0x43, 0xc2, 0x00,
+  0x81, 0x00, 0x26, 0xc4, 0x5f, 0xc7, 0x23, 0x03, 0x31, 0x31, 0x32, 0x32, 0xc9, 0x0e, 0x00, 0x00,
+  0x82, 0x01, 0x29, 0x32, 0xcb, 0x1f, 0x01, 0x32, 0x29, 0x81, 0xcb, 0x2e, 0xc2, 0x0e, 0x00, 0x31,
+  0xcb, 0x0e, 0x42, 0x31, 0x00, 0x29, 0xc6, 0x5f, 0x00, 0x1c, 0xc4, 0x1d, 0x01, 0x32, 0x26, 0xc7,
+  0x1f, 0x08, 0x1c, 0x1c, 0x00, 0x26, 0x1c, 0x26, 0x16, 0x16, 0x31, 0xc6, 0x7f, 0xc5, 0x00, 0x02,
+  0x1c, 0x00, 0x16, 0xca, 0x7f, 0xc4, 0xba, 0x05, 0x15, 0x14, 0x15, 0x15, 0x14, 0x10, 0x43, 0x11,
+  0x05, 0x10, 0x10, 0x14, 0x16, 0x00, 0x01, 0xc2, 0x0d, 0x82, 0xc2, 0x10, 0x01, 0x10, 0x15, 0x81,
+  0xc2, 0x10, 0x83, 0x00, 0x10, 0xc3, 0x20, 0xc2, 0x1d, 0x00, 0x16, 0x81, 0x01, 0x01, 0x14, 0xc2,
+  0x0e, 0x01, 0x10, 0x16, 0xc2, 0x21, 0xc2, 0x1c, 0x05, 0x01, 0x16, 0x14, 0x00, 0x15, 0x26, 0xc2,
+  0x27, 0x81, 0xc4, 0x02, 0x01, 0x00, 0x01, 0xc2, 0x3f, 0x81, 0xc2, 0x36, 0x00, 0x16, 0xc2, 0x1b,
+  0xc4, 0x0e, 0xc2, 0x1f, 0x02, 0x26, 0x26, 0x16, 0xc3, 0x08, 0xc6, 0x03, 0x02, 0x31, 0x31, 0x32,
+  0x81, 0xc9, 0x0e, 0x04, 0x00, 0x31, 0x32, 0x31, 0x32, 0xcd, 0x1f, 0x82, 0xca, 0x1f, 0x03, 0x32,
+  0x32, 0x26, 0x31, 0xcb, 0x30, 0x00, 0x29, 0xc2, 0x10, 0xcb, 0x41, 0x01, 0x29, 0x29, 0xc2, 0x50,
+  0x00, 0x1c, 0xc2, 0x52, 0x00, 0x00, 0xc5, 0x63, 0x04, 0x1c, 0x31, 0x1c, 0x32, 0x16, 0x81, 0xc7,
+  0x0e, 0x02, 0x00, 0x1c, 0x00, 0xc4, 0x0c, 0xc3, 0x02, 0xc5, 0x85, 0xcc, 0x0c, 0x01, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0xc2, 0x01, 0x00, 0x16, 0x47, 0x40, 0x01, 0x33, 0x33, 0xc3, 0x0e, 0x00, 0x01,
+  0x87, 0x02, 0x16, 0x36, 0x36, 0xc4, 0x1f, 0x03, 0x40, 0x16, 0x16, 0x13, 0x42, 0x0f, 0x00, 0x36,
+  0x82, 0xc4, 0x2e, 0x01, 0x16, 0x33, 0x44, 0x34, 0x02, 0x0f, 0x36, 0x33, 0xc3, 0x1f, 0xc4, 0x0d,
+  0x42, 0x35, 0x02, 0x06, 0x06, 0x0f, 0xc3, 0x1f, 0x02, 0x16, 0x40, 0x36, 0xc3, 0x1d, 0xc4, 0x10,
+  0x00, 0x13, 0xc2, 0x3f, 0xc2, 0x5c, 0xc4, 0x2e, 0x43, 0x35, 0x00, 0x16, 0xc4, 0x1f, 0x01, 0x40,
+  0x36, 0xc5, 0x3f, 0x03, 0x33, 0x33, 0x16, 0x16, 0xc5, 0x6c, 0x45, 0x33, 0x01, 0x36, 0x36, 0x81,
+  0x03, 0x01, 0x05, 0x16, 0x36, 0xc3, 0x88, 0x45, 0x36, 0x00, 0x16, 0x42, 0x05, 0x84, 0x01, 0x36,
+  0x40, 0x86, 0xc2, 0x1f, 0x00, 0x05, 0xc6, 0x9a, 0x02, 0x36, 0x05, 0x40, 0x81, 0x02, 0x00, 0x01,
+  0x05, 0x84, 0x01, 0x05, 0x40, 0xc2, 0x2c, 0xc2, 0x2e, 0xc2, 0xce, 0x01, 0x05, 0x16, 0xc3, 0x09,
+  0xc2, 0x04, 0xc3, 0x00, 0xc3, 0xdf, 0x4b, 0x05, 0xc4, 0xdf, 0xca, 0x03, 0x46, 0x36, 0x04, 0x33,
+  0x36, 0x16, 0x00, 0x01, 0xc3, 0x01, 0xc4, 0x0b, 0x84, 0xc4, 0x0e, 0x00, 0x00, 0xc5, 0x1c, 0xcd,
+  0x1f, 0x00, 0x34, 0xc3, 0x34, 0xc9, 0x1f, 0x83, 0x00, 0x05, 0xce, 0x3f, 0x03, 0x36, 0x05, 0x16,
+  0x05, 0xc5, 0x3f, 0x42, 0x16, 0x42, 0x0f, 0x83, 0xc4, 0x5f, 0x07, 0x13, 0x33, 0x35, 0x35, 0x06,
+  0x06, 0x35, 0x0f, 0x43, 0x05, 0xc3, 0x70, 0x03, 0x13, 0x36, 0x33, 0x33, 0x42, 0x34, 0x00, 0x16,
+  0xc6, 0x0e, 0x04, 0x01, 0x16, 0x40, 0x36, 0x33, 0xc2, 0x32, 0x00, 0x05, 0xc5, 0x3d, 0x01, 0x01,
+  0x00, 0xc2, 0x47, 0xc3, 0x1b, 0xc7, 0x0e, 0x00, 0x01, 0x44, 0x05, 0xc7, 0x0c, 0xc3, 0x1f, 0xc9,
+  0x0a, 0xc4, 0xbf, 0xce, 0x0e, 0x00, 0x00, 0xce, 0x0e, 0xd0, 0x1f, 0x09, 0x00, 0x01, 0x00, 0x01,
+  0x1c, 0x1c, 0x48, 0x49, 0x13, 0x2e, 0x45, 0x2d, 0xc2, 0x0e, 0x02, 0x00, 0x1c, 0x48, 0x82, 0x00,
+  0x2f, 0x45, 0x2e, 0xc3, 0x1f, 0x00, 0x0f, 0x82, 0x00, 0x16, 0x46, 0x2f, 0xc3, 0x1f, 0x84, 0xc6,
+  0x00, 0xc7, 0x1f, 0xc7, 0x00, 0xc7, 0x1f, 0x87, 0xc6, 0x3f, 0xc8, 0x01, 0xc4, 0x3f, 0xc3, 0x2d,
+  0x00, 0x1c, 0xca, 0x1f, 0x8a, 0xc4, 0x5f, 0x43, 0x51, 0x01, 0x1c, 0x1c, 0x44, 0x51, 0xc3, 0x9f,
+  0x43, 0x13, 0x43, 0x1c, 0xc3, 0x07, 0xc3, 0x9f, 0xcb, 0x03, 0xce, 0x0e, 0x00, 0x01, 0xef, 0x1f,
+  0x03, 0x13, 0x2f, 0x16, 0x4b, 0x49, 0x4c, 0x01, 0x4d, 0x13, 0x84, 0x47, 0x4d, 0x83, 0x00, 0x30,
+  0x8d, 0x00, 0x16, 0x81, 0x4b, 0x13, 0x43, 0x16, 0x4b, 0x51, 0x00, 0x16, 0x4f, 0x49, 0x4f, 0x48,
+  0x00, 0x51, 0x8f, 0xce, 0x30, 0x8f, 0x00, 0x52, 0x4e, 0x51, 0x00, 0x0f, 0xce, 0x50, 0x90, 0xce,
+  0x80, 0x00, 0x0f, 0xc5, 0x9d, 0x00, 0x1c, 0xc8, 0x3f, 0x01, 0x13, 0x1c, 0xc3, 0xbf, 0x00, 0x1c,
+  0xc4, 0x05, 0xc2, 0x0b, 0x03, 0x30, 0x16, 0x2f, 0x2f, 0x42, 0x2e, 0x04, 0x2f, 0x2f, 0x13, 0x44,
+  0x45, 0x43, 0x46, 0x81, 0x00, 0x30, 0x45, 0x2f, 0x02, 0x13, 0x2f, 0x2e, 0x43, 0x43, 0x81, 0x00,
+  0x27, 0x42, 0x30, 0x83, 0x45, 0x16, 0x81, 0xc7, 0x00, 0x45, 0x51, 0x01, 0x16, 0x16, 0x58, 0x49,
+  0x55, 0x48, 0x00, 0x51, 0xce, 0x2f, 0x89, 0x00, 0x1c, 0x85, 0x04, 0x52, 0x52, 0x51, 0x51, 0x1c,
+  0xc3, 0x5c, 0xc4, 0x04, 0x01, 0x51, 0x52, 0x43, 0x13, 0x01, 0x1c, 0x1c, 0xc3, 0x03, 0xc2, 0x04,
+  0x05, 0x13, 0x48, 0x13, 0x01, 0x00, 0x01, 0x43, 0x1c, 0x00, 0x00, 0xc3, 0x04, 0x01, 0x01, 0x00,
+  0x81, 0x00, 0x00, 0xc2, 0x10, 0xc9, 0x03, 0x00, 0x49, 0xc3, 0x1f, 0xca, 0x12, 0x00, 0x51, 0xce,
+  0x1f, 0x00, 0x13, 0xce, 0x1f, 0x44, 0x46, 0x07, 0x45, 0x13, 0x49, 0x49, 0x51, 0x0f, 0x01, 0x00,
+  0xc2, 0x01, 0x44, 0x43, 0x01, 0x2e, 0x16, 0x83, 0xc3, 0x0e, 0x00, 0x00, 0x46, 0x16, 0xc8, 0x1f,
+  0x46, 0x51, 0xc8, 0x1f, 0x48, 0x49, 0xc6, 0x3f, 0x48, 0x48, 0xc6, 0x3f, 0x8a, 0xc4, 0x5f, 0xc8,
+  0x2f, 0x00, 0x52, 0xce, 0x3f, 0x81, 0xc7, 0x5f, 0x00, 0x1c, 0xc3, 0x63, 0x00, 0x1c, 0xc6, 0x1f,
+  0x42, 0x13, 0x00, 0x1c, 0x43, 0x13, 0xc2, 0x04, 0xc4, 0x9f, 0x03, 0x01, 0x00, 0x1c, 0x1c, 0xc4,
+  0xa8, 0xc6, 0x03, 0xca, 0x0a, 0xc6, 0x1f, 0xcd, 0x10, 0xdf, 0x1f, 0x01, 0x00, 0x01, 0xc3, 0x01,
+  0x05, 0x0f, 0x51, 0x49, 0x49, 0x13, 0x45, 0x43, 0x46, 0xc4, 0x0e, 0x00, 0x00, 0x83, 0x00, 0x16,
+  0x44, 0x2f, 0xc9, 0x1f, 0x45, 0x16, 0xc9, 0x1f, 0x45, 0x51, 0xc9, 0x3f, 0xc5, 0x01, 0xc7, 0x3f,
+  0x47, 0x48, 0xc7, 0x5f, 0x87, 0xc6, 0x5f, 0x00, 0x52, 0xc2, 0x2f, 0x00, 0x1c, 0xc3, 0x33, 0xc6,
+  0x7f, 0x88, 0xc7, 0x1f, 0xc2, 0x5d, 0x00, 0x1c, 0xc9, 0x5f, 0x44, 0x13, 0x01, 0x1c, 0x1c, 0xc2,
+  0x06, 0xc5, 0x9f, 0xc4, 0xb4, 0x81, 0xc2, 0xbc, 0xc9, 0x0e, 0xc5, 0xc9, 0xce, 0x0e, 0xe0, 0x1f,
+  0x4a, 0x46, 0x03, 0x45, 0x2d, 0x2d, 0x13, 0x4c, 0x2f, 0x01, 0x46, 0x46, 0x81, 0x4b, 0x16, 0x03,
+  0x2f, 0x2f, 0x13, 0x30, 0x4b, 0x51, 0xc2, 0x1b, 0x00, 0x30, 0x4b, 0x49, 0xc3, 0x11, 0x44, 0x48,
+  0xca, 0x14, 0x4f, 0x48, 0x4d, 0x49, 0x00, 0x51, 0x8f, 0x01, 0x49, 0x1c, 0xc5, 0x60, 0xc6, 0x06,
+  0x82, 0x00, 0x1c, 0x42, 0x13, 0x45, 0x1c, 0xc2, 0x08, 0x03, 0x52, 0x51, 0x01, 0x00, 0xcb, 0x01,
+  0x01, 0x0f, 0x48, 0xcc, 0x0e, 0x00, 0x01, 0x81, 0xce, 0x1f, 0x00, 0x49, 0xce, 0x1f, 0xcf, 0x3f,
+  0x00, 0x13, 0x01, 0x16, 0x4b, 0x49, 0x4c, 0x03, 0x4d, 0x13, 0x30, 0x16, 0x82, 0x47, 0x4d, 0x95,
+  0x4b, 0x13, 0x00, 0x16, 0x82, 0x4b, 0x51, 0x42, 0x16, 0x4f, 0x49, 0x5e, 0x48, 0x00, 0x51, 0xce,
+  0x2f, 0x90, 0xce, 0x00, 0x00, 0x52, 0xce, 0x4f, 0x00, 0x13, 0x8f, 0xc2, 0x7f, 0x00, 0x1c, 0xc7,
+  0x83, 0xc2, 0x08, 0x00, 0x13, 0xc2, 0x9e, 0x00, 0x1c, 0xc7, 0xa2, 0xc2, 0x08, 0x00, 0x13, 0x45,
+  0x1c, 0xc5, 0xc4, 0xc3, 0x07, 0x04, 0x2f, 0x43, 0x27, 0x45, 0x45, 0x4a, 0x46, 0x03, 0x30, 0x2f,
+  0x27, 0x27, 0x4b, 0x2f, 0x01, 0x27, 0x30, 0x4f, 0x16, 0x4f, 0x51, 0x56, 0x49, 0x56, 0x48, 0x5f,
+  0x49, 0x01, 0x52, 0x52, 0xc4, 0x5f, 0x00, 0x1c, 0xc7, 0x65, 0x01, 0x13, 0x1c, 0x44, 0x13, 0xc3,
+  0x05, 0xc4, 0x09, 0x42, 0x1c, 0x02, 0x00, 0x01, 0x00, 0x46, 0x1c, 0x01, 0x00, 0x01, 0xc3, 0x0c,
+  0xcc, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xdf, 0x1f, 0x09, 0x46, 0x45, 0x45, 0x13, 0x51, 0x49, 0x51,
+  0x1c, 0x00, 0x01, 0xc5, 0x01, 0x42, 0x2f, 0x00, 0x16, 0x83, 0xc7, 0x10, 0x43, 0x16, 0x82, 0x01,
+  0x0f, 0x1c, 0xc6, 0x1f, 0x44, 0x51, 0x82, 0xc6, 0x2e, 0x00, 0x00, 0x45, 0x49, 0x81, 0xc7, 0x3f,
+  0x45, 0x48, 0xc9, 0x1f, 0x87, 0xc7, 0x5f, 0xc5, 0x2f, 0x00, 0x52, 0xc8, 0x3f, 0x00, 0x1c, 0x86,
+  0xc7, 0x7f, 0x00, 0x1c, 0xc4, 0x60, 0xca, 0x1f, 0x46, 0x13, 0xc8, 0x1f, 0xc7, 0xa8, 0xc6, 0xb0,
+  0xce, 0x0e, 0x00, 0x01, 0xce, 0x0e, 0xe0, 0x1f, 0x08, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x49,
+  0x16, 0x2f, 0x43, 0x2e, 0x02, 0x13, 0x2f, 0x16, 0xc2, 0x0e, 0x00, 0x00, 0x84, 0xc3, 0x00, 0x02,
+  0x13, 0x30, 0x16, 0xc6, 0x1f, 0x00, 0x13, 0x45, 0x16, 0x81, 0xc6, 0x1f, 0xc5, 0x00, 0xc2, 0x14,
+  0xc6, 0x3f, 0xc8, 0x00, 0xc5, 0x3f, 0xc9, 0x00, 0xc4, 0x5f, 0xc7, 0x1e, 0x00, 0x51, 0x81, 0xc4,
+  0x5f, 0x81, 0x00, 0x1c, 0x85, 0x01, 0x49, 0x49, 0xc4, 0x7f, 0x03, 0x51, 0x51, 0x1c, 0x1c, 0x44,
+  0x51, 0xc5, 0x3f, 0x42, 0x13, 0x81, 0x06, 0x13, 0x1c, 0x13, 0x13, 0x52, 0x51, 0x51, 0xc3, 0x9f,
+  0x01, 0x00, 0x01, 0x45, 0x1c, 0xc3, 0x58, 0xc4, 0x0e, 0xc7, 0x03, 0x82, 0xcb, 0x0e, 0xc3, 0x58,
+  0xcd, 0x1f, 0x01, 0x51, 0x1c, 0xcd, 0x1f, 0x01, 0x13, 0x1c, 0xcc, 0x3f, 0xc2, 0xfc, 0x01, 0x4b,
+  0x4c, 0x47, 0x4d, 0x05, 0x4c, 0x4d, 0x13, 0x30, 0x16, 0x30, 0x8e, 0x00, 0x27, 0x4b, 0x13, 0x00,
+  0x16, 0x81, 0x00, 0x16, 0x4b, 0x49, 0x42, 0x16, 0x50, 0x49, 0x5d, 0x48, 0x00, 0x51, 0xce, 0x2f,
+  0x90, 0xce, 0x00, 0x01, 0x52, 0x13, 0xcd, 0x4f, 0x01, 0x13, 0x01, 0x8e, 0x00, 0x00, 0xcd, 0x80,
+  0x01, 0x13, 0x01, 0xc4, 0x41, 0x00, 0x1c, 0xc7, 0x47, 0x01, 0x13, 0x00, 0xc4, 0xbf, 0x01, 0x1c,
+  0x1c, 0xc5, 0xc6, 0x06, 0x1c, 0x13, 0x01, 0x01, 0x00, 0x01, 0x00, 0x43, 0x1c, 0xc3, 0x07, 0x00,
+  0x01, 0xc2, 0x05, 0x43, 0x2f, 0x05, 0x16, 0x49, 0x51, 0x13, 0x00, 0x01, 0xc5, 0x01, 0x43, 0x30,
+  0x83, 0xc6, 0x0e, 0x00, 0x00, 0x43, 0x16, 0x00, 0x13, 0xca, 0x1f, 0x45, 0x49, 0xc9, 0x1f, 0x87,
+  0xc7, 0x3f, 0x45, 0x48, 0xcd, 0x1f, 0x02, 0x1c, 0x49, 0x52, 0xcc, 0x3f, 0x83, 0xc7, 0x5f, 0x42,
+  0x51, 0x02, 0x1c, 0x1c, 0x51, 0xc9, 0x1f, 0x42, 0x13, 0x81, 0xc2, 0x04, 0xc7, 0x7f, 0xc2, 0x97,
+  0x81, 0x00, 0x1c, 0xc7, 0x9d, 0x01, 0x00, 0x01, 0xc8, 0x08, 0xc9, 0x1f, 0xcc, 0x12, 0xef, 0x1f,
+  0x01, 0x00, 0x01, 0xcd, 0x01, 0xce, 0x0e, 0x00, 0x00, 0xd1, 0x1f, 0x01, 0x13, 0x13, 0xc7, 0x32,
+  0xc3, 0x09, 0x07, 0x00, 0x01, 0x13, 0x2f, 0x13, 0x13, 0x00, 0x16, 0xc2, 0x07, 0xc2, 0x08, 0xc2,
+  0x3f, 0x12, 0x13, 0x16, 0x16, 0x30, 0x27, 0x13, 0x30, 0x16, 0x13, 0x27, 0x30, 0x13, 0x13, 0x16,
+  0x00, 0x00, 0x16, 0x2f, 0x2f, 0xc2, 0x12, 0x07, 0x27, 0x30, 0x16, 0x16, 0x13, 0x30, 0x30, 0x16,
+  0xc3, 0x3f, 0x00, 0x30, 0x42, 0x2f, 0x01, 0x13, 0x16, 0x43, 0x30, 0x00, 0x16, 0xc3, 0x5f, 0x00,
+  0x22, 0xc2, 0x26, 0x01, 0x2f, 0x30, 0xc3, 0x20, 0x01, 0x16, 0x22, 0xc4, 0x7f, 0x01, 0x22, 0x16,
+  0xc3, 0x0b, 0x02, 0x16, 0x27, 0x13, 0xc2, 0x0e, 0xc3, 0x7f, 0xc2, 0x0e, 0x02, 0x13, 0x22, 0x22,
+  0xc2, 0x31, 0xc3, 0x78, 0xc2, 0xae, 0x02, 0x13, 0x16, 0x22, 0xc3, 0xb4, 0xc2, 0x37, 0xd4, 0x9f,
+  0xdf, 0xbf, 0xcd, 0xf0, 0x01, 0x00, 0x01, 0xc3, 0x01, 0x43, 0x13, 0xc5, 0x09, 0xc5, 0x0e, 0x03,
+  0x2d, 0x2e, 0x2d, 0x2e, 0xc5, 0x10, 0xc4, 0x1d, 0xc2, 0x0d, 0x81, 0xc5, 0x10, 0xc3, 0x2e, 0x87,
+  0xc8, 0x1f, 0x00, 0x2f, 0x43, 0x30, 0x00, 0x2f, 0xc8, 0x1f, 0x00, 0x16, 0x45, 0x30, 0x00, 0x16,
+  0xc7, 0x3f, 0x81, 0x43, 0x2e, 0x81, 0xc9, 0x1f, 0x43, 0x16, 0xcb, 0x1f, 0xc5, 0x2f, 0xc8, 0x3f,
+  0xc6, 0x00, 0xc7, 0x7f, 0xc4, 0x21, 0xc4, 0x3d, 0xc6, 0x9f, 0x02, 0x00, 0x16, 0x2f, 0xc5, 0x5d,
+  0xc6, 0x1f, 0x00, 0x22, 0x83, 0x00, 0x22, 0xc8, 0xbf, 0x00, 0x22, 0x85, 0xc4, 0x10, 0xc3, 0xdf,
+  0x81, 0x01, 0x22, 0x16, 0xc2, 0x0e, 0x00, 0x22, 0xc8, 0xdf, 0x45, 0x22, 0xc4, 0xfa,
+};
@@ -0,0 +1,804 @@
+// Art by LimeZu from itch.io (https://limezu.itch.io/serenevillagerevamped)
+// Licensed under CC BY 4.0 (https://creativecommons.org/licenses/by/4.0/)
+
+int tileset_lz_count = 112;
+int tileset_lz_bytes = 12433;
+
+const uint32_t tileset_lz_offsets[] = {
+  0x00000000, 0x00000014, 0x0000007a, 0x000000e4, 0x00000136, 0x0000017b, 0x000001c6, 0x00000225,
+  0x0000028a, 0x000002a9, 0x00000313, 0x00000360, 0x000003df, 0x0000046a, 0x000004e9, 0x00000571,
+  0x000005dd, 0x000005f1, 0x0000065f, 0x000006d9, 0x0000073b, 0x0000080b, 0x000008d5, 0x00000933,
+  0x0000096b, 0x00000971, 0x000009a5, 0x00000a6b, 0x00000b25, 0x00000be1, 0x00000c9b, 0x00000d55,
+  0x00000db0, 0x00000e37, 0x00000e99, 0x00000ef7, 0x00000f50, 0x00000fb0, 0x00001019, 0x0000107b,
+  0x000010e3, 0x000010fc, 0x00001164, 0x0000121c, 0x000012ee, 0x000013cf, 0x000014a1, 0x00001518,
+  0x0000158b, 0x000015c9, 0x000015f7, 0x00001622, 0x00001678, 0x000016ad, 0x000016c1, 0x00001701,
+  0x00001730, 0x0000175d, 0x00001789, 0x000017c9, 0x0000180d, 0x0000187a, 0x000018cd, 0x0000191a,
+  0x00001974, 0x000019fb, 0x00001a8c, 0x00001b02, 0x00001ba7, 0x00001c20, 0x00001c52, 0x00001c9e,
+  0x00001ce6, 0x00001d4f, 0x00001d86, 0x00001dc6, 0x00001e50, 0x00001efa, 0x00001f6f, 0x00002035,
+  0x000020f3, 0x0000213f, 0x00002196, 0x00002221, 0x000022af, 0x00002351, 0x000023d1, 0x0000243e,
+  0x000024c3, 0x00002538, 0x000025be, 0x00002632, 0x000026d4, 0x00002757, 0x000027e1, 0x00002899,
+  0x0000294e, 0x000029fd, 0x00002a84, 0x00002aed, 0x00002b45, 0x00002bd1, 0x00002c3c, 0x00002ca3,
+  0x00002d0f, 0x00002d63, 0x00002dc0, 0x00002e23, 0x00002ead, 0x00002f1a, 0x00002f7b, 0x00003018,
+  0x00003091,
+};
+
+const uint8_t tileset_lz_data[] = {
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f,
+  0xff, 0x9f, 0xde, 0xdf, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xc9, 0x01, 0x03, 0x39, 0x22, 0xad, 0x2e,
+  0x0e, 0x33, 0x2f, 0x37, 0xc9, 0x0e, 0x01, 0x39, 0x22, 0x79, 0x26, 0xc2, 0x0e, 0x00, 0x0e, 0x33,
+  0xcb, 0x1f, 0x80, 0xc1, 0x0e, 0xca, 0x1f, 0xc1, 0x38, 0xc5, 0x1f, 0x00, 0xf9, 0x4a, 0xc2, 0x41,
+  0x41, 0xf9, 0x4a, 0xcd, 0x1f, 0x81, 0xc3, 0x56, 0x00, 0x51, 0x15, 0xc2, 0x30, 0xcc, 0x5f, 0x00,
+  0xb7, 0x19, 0xc1, 0x41, 0x42, 0x39, 0x22, 0xc5, 0x6a, 0xc3, 0x00, 0xc2, 0x70, 0xc3, 0x05, 0xc2,
+  0x13, 0xc3, 0x6a, 0xc1, 0x6c, 0xc2, 0x7f, 0xc2, 0x62, 0xc3, 0x1a, 0xc4, 0x0e, 0xc3, 0x12, 0xc8,
+  0x08, 0xc6, 0x10, 0xce, 0x0e, 0xff, 0x1f, 0x00, 0x0e, 0x33, 0x04, 0x0e, 0x33, 0x2f, 0x37, 0xad,
+  0x2e, 0x7a, 0x2a, 0x79, 0x26, 0xca, 0x01, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0x80, 0x00, 0x39, 0x22,
+  0xcb, 0x10, 0xc2, 0x1f, 0x80, 0xc7, 0x1f, 0x00, 0xf9, 0x4a, 0xc8, 0x1f, 0x41, 0x39, 0x22, 0xc8,
+  0x1f, 0x01, 0xad, 0x2e, 0x51, 0x15, 0xc2, 0x1f, 0x81, 0xc8, 0x3f, 0x80, 0x00, 0xb7, 0x19, 0xcd,
+  0x3f, 0x82, 0xd2, 0x5f, 0x00, 0x39, 0x22, 0x44, 0xad, 0x2e, 0xc2, 0x69, 0xc2, 0x7f, 0xc1, 0x30,
+  0xc1, 0x4e, 0x00, 0xad, 0x2e, 0xc1, 0x87, 0xc2, 0x01, 0xc1, 0x7a, 0x00, 0x39, 0x22, 0xc2, 0x06,
+  0xc3, 0x1a, 0xc4, 0x0e, 0xc2, 0x8b, 0xc7, 0x08, 0xc8, 0x05, 0xc3, 0x02, 0xcb, 0x12, 0xd2, 0x1f,
+  0xcc, 0x32, 0xdf, 0x1f, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x79, 0x26,
+  0xd1, 0x1f, 0x00, 0xf9, 0x4a, 0xd4, 0x1f, 0x41, 0x39, 0x22, 0xcd, 0x3f, 0x81, 0xd7, 0x3f, 0xca,
+  0x72, 0xc5, 0x24, 0x41, 0xf9, 0x4a, 0xc7, 0x43, 0x41, 0xad, 0x2e, 0xc3, 0x8e, 0x81, 0xc7, 0x0e,
+  0x01, 0x2f, 0x37, 0x0e, 0x33, 0xcb, 0x9f, 0xc2, 0x0e, 0x00, 0x2f, 0x37, 0xca, 0x3b, 0x00, 0x79,
+  0x26, 0x80, 0xc1, 0x0e, 0xda, 0x1f, 0xc1, 0xd8, 0xcf, 0x1f, 0x00, 0xb7, 0x19, 0xc2, 0x30, 0xcc,
+  0x7d, 0x00, 0x51, 0x15, 0xc1, 0x41, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xcd, 0x01, 0xcc, 0x0e, 0x00,
+  0x39, 0x22, 0xc1, 0x1c, 0xdc, 0x1f, 0xc2, 0x3c, 0xd3, 0x3f, 0x00, 0x39, 0x22, 0xda, 0x1f, 0x42,
+  0x39, 0x22, 0xc4, 0x59, 0x44, 0xad, 0x2e, 0xc2, 0x5f, 0xc3, 0x05, 0xc2, 0x13, 0x02, 0xad, 0x2e,
+  0x0e, 0x33, 0x2f, 0x37, 0xc2, 0x01, 0xc2, 0x0a, 0xc2, 0x06, 0xc3, 0x1a, 0xc4, 0x0e, 0xc2, 0x10,
+  0xc7, 0x08, 0xc8, 0x05, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xfe, 0x1f, 0x01, 0x79, 0x26, 0x7a, 0x2a,
+  0xcd, 0x01, 0xce, 0x0e, 0x41, 0x79, 0x26, 0xca, 0x1f, 0x00, 0xf9, 0x4a, 0xc3, 0x1f, 0x41, 0x39,
+  0x22, 0xcd, 0x1f, 0x81, 0xcd, 0x3f, 0xcf, 0x1f, 0xce, 0x5f, 0x42, 0x39, 0x22, 0xc4, 0x06, 0x44,
+  0xad, 0x2e, 0xc2, 0x3a, 0xc3, 0x05, 0xc2, 0x13, 0x02, 0xad, 0x2e, 0x0e, 0x33, 0x2f, 0x37, 0xc2,
+  0x01, 0xc2, 0x0a, 0xc2, 0x06, 0xc3, 0x1a, 0xc4, 0x0e, 0xc2, 0x10, 0xc7, 0x08, 0xc8, 0x05, 0xce,
+  0x0e, 0x41, 0x0e, 0x33, 0xfe, 0x1f, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xcd, 0x01, 0x00, 0x7a, 0x2a,
+  0x42, 0xf9, 0x4a, 0xcb, 0x12, 0x00, 0x79, 0x26, 0x82, 0xc3, 0x23, 0x00, 0x39, 0x22, 0xc7, 0x1f,
+  0xcb, 0x30, 0xc2, 0x1a, 0xcc, 0x3f, 0xc2, 0x3a, 0xce, 0x4e, 0xcd, 0x1f, 0xc3, 0x47, 0xc7, 0x48,
+  0xc6, 0x78, 0x41, 0xad, 0x2e, 0xcd, 0x10, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0xcd, 0x10, 0x00, 0x0e,
+  0x33, 0xc2, 0x10, 0xca, 0x70, 0xc2, 0x1f, 0x00, 0x2f, 0x37, 0x80, 0xd9, 0x1f, 0xc3, 0x3f, 0xca,
+  0x1f, 0xc1, 0x6c, 0xc2, 0x3f, 0x01, 0xad, 0x2e, 0xb7, 0x19, 0xc8, 0xe3, 0xc2, 0x7c, 0xc1, 0x3d,
+  0x00, 0x51, 0x15, 0xcc, 0x81, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xc8, 0x0e, 0x46, 0x7a,
+  0x2a, 0xc8, 0x0c, 0x46, 0xb7, 0x19, 0xc3, 0x2e, 0xc8, 0x0c, 0x82, 0xc3, 0x0e, 0x4b, 0xb7, 0x19,
+  0xcb, 0x0e, 0x00, 0x7a, 0x2a, 0x42, 0xb7, 0x77, 0xc1, 0x5f, 0xc8, 0x0b, 0x44, 0x6a, 0x7b, 0xc1,
+  0x57, 0xc7, 0x0d, 0x45, 0x09, 0x4e, 0xc4, 0x3d, 0xc7, 0x0c, 0x82, 0xc3, 0x1f, 0xc5, 0x1b, 0x45,
+  0x08, 0x62, 0xc2, 0x5d, 0xc3, 0x2a, 0xc1, 0x0c, 0x46, 0x08, 0x6e, 0xc2, 0x3f, 0xc3, 0x0e, 0x48,
+  0x08, 0x6e, 0xc1, 0x8c, 0xc2, 0x49, 0xc9, 0x0e, 0xc2, 0x1f, 0x81, 0xc3, 0x2b, 0x47, 0x8a, 0x76,
+  0xc3, 0x1f, 0xc9, 0x0d, 0x81, 0xc3, 0x1f, 0xca, 0x0e, 0x80, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd,
+  0x01, 0x4f, 0x7a, 0x2a, 0x6f, 0xb7, 0x19, 0x4f, 0xb7, 0x77, 0x4f, 0x6a, 0x7b, 0x5f, 0x09, 0x4e,
+  0x4f, 0x08, 0x62, 0x6f, 0x08, 0x6e, 0x6f, 0x8a, 0x76, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01,
+  0x46, 0x7a, 0x2a, 0xc8, 0x16, 0x46, 0xb7, 0x19, 0xc8, 0x12, 0x49, 0xb7, 0x19, 0xc1, 0x29, 0xca,
+  0x1f, 0xc5, 0x24, 0xc2, 0x4b, 0x42, 0xb7, 0x77, 0x00, 0x7a, 0x2a, 0xcb, 0x10, 0x44, 0x6a, 0x7b,
+  0xc8, 0x13, 0xc1, 0x6d, 0x45, 0x09, 0x4e, 0xc7, 0x11, 0xc1, 0x67, 0x48, 0x09, 0x4e, 0xc1, 0x24,
+  0xc4, 0x41, 0x45, 0x08, 0x62, 0xc7, 0x10, 0xc1, 0x87, 0x46, 0x08, 0x6e, 0xc3, 0x12, 0xc2, 0x21,
+  0xc1, 0x72, 0x48, 0x08, 0x6e, 0xc3, 0x10, 0xc9, 0x1f, 0xc4, 0x10, 0xc1, 0x67, 0xc1, 0x92, 0x47,
+  0x8a, 0x76, 0xc3, 0x33, 0x82, 0x00, 0x0e, 0x33, 0x49, 0x8a, 0x76, 0xc1, 0x49, 0xcb, 0x1f, 0xc3,
+  0x22, 0xc3, 0x1f, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff,
+  0x1f, 0xff, 0x5f, 0xc9, 0x9f, 0x42, 0x6a, 0x39, 0xcc, 0x9f, 0x80, 0x41, 0x2a, 0x32, 0xc1, 0x10,
+  0xc8, 0x0c, 0xc2, 0x1d, 0x80, 0x00, 0x13, 0x23, 0xc1, 0x10, 0xc5, 0x0a, 0xc3, 0x1b, 0xc1, 0x0d,
+  0x41, 0x57, 0x23, 0x00, 0x13, 0x23, 0xc2, 0x31, 0xc1, 0x37, 0xc2, 0x27, 0x80, 0x43, 0x13, 0x23,
+  0x81, 0x01, 0x57, 0x23, 0x2a, 0x32, 0xc4, 0x37, 0xc1, 0x17, 0xc1, 0x29, 0xc2, 0x0c, 0xc3, 0x20,
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf9, 0x1f, 0x42, 0x6a,
+  0x39, 0xcc, 0x3f, 0x80, 0x41, 0x2a, 0x32, 0xc1, 0x10, 0xc8, 0x0c, 0xc2, 0x1d, 0x80, 0x00, 0x13,
+  0x23, 0xc1, 0x10, 0xc5, 0x0a, 0xc3, 0x1b, 0xc1, 0x0d, 0x41, 0x57, 0x23, 0x00, 0x13, 0x23, 0xc2,
+  0x31, 0xc1, 0x37, 0xc2, 0x27, 0x80, 0x43, 0x13, 0x23, 0x81, 0x01, 0x57, 0x23, 0x2a, 0x32, 0xc4,
+  0x37, 0xc2, 0x0e, 0x00, 0x2a, 0x32, 0xc2, 0x0c, 0xc3, 0x20, 0xc4, 0x57, 0xc1, 0x47, 0xc1, 0x1e,
+  0x41, 0x08, 0x2d, 0x82, 0xc1, 0x32, 0xc4, 0x2e, 0xc2, 0x47, 0x00, 0x08, 0x2d, 0xc1, 0x5c, 0xc2,
+  0x10, 0x81, 0xc3, 0x55, 0xc1, 0x48, 0x00, 0xa9, 0x31, 0xc3, 0x13, 0x80, 0xc3, 0x50, 0xc5, 0x47,
+  0xc3, 0x5a, 0x42, 0x08, 0x2d, 0xc4, 0x42, 0xc4, 0x03, 0xc3, 0x19, 0xc2, 0x20, 0xc1, 0x80, 0x01,
+  0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf3, 0x1f, 0x41, 0x6a, 0x39,
+  0xcb, 0x3f, 0xc1, 0x0d, 0x00, 0x2a, 0x32, 0x80, 0xc1, 0x65, 0x41, 0x08, 0x2d, 0xc6, 0x5f, 0xc1,
+  0x0d, 0x01, 0x2a, 0x32, 0x13, 0x23, 0xc1, 0x10, 0x00, 0x08, 0x2d, 0xc1, 0x05, 0xc4, 0x10, 0xc2,
+  0x1c, 0x41, 0x13, 0x23, 0x01, 0x57, 0x23, 0xa9, 0x31, 0xc3, 0x13, 0x80, 0xc3, 0x8b, 0x43, 0x13,
+  0x23, 0x41, 0x57, 0x23, 0xc3, 0x02, 0x42, 0x08, 0x2d, 0xc2, 0x9c, 0x42, 0x57, 0x23, 0x82, 0xc3,
+  0x05, 0x00, 0x13, 0x23, 0x42, 0x6a, 0x39, 0xc1, 0xad, 0xc3, 0x08, 0xc4, 0x23, 0xc2, 0x43, 0xc1,
+  0x48, 0xc1, 0x67, 0xc3, 0x0e, 0xc3, 0x2f, 0x43, 0x6a, 0x39, 0xc3, 0x57, 0xc2, 0x3b, 0xc2, 0x27,
+  0xc1, 0x2b, 0x42, 0x2a, 0x32, 0xc3, 0x47, 0xc1, 0x09, 0xc2, 0x37, 0xc2, 0x27, 0xc3, 0x07, 0xc3,
+  0x47, 0xc2, 0x7b, 0x82, 0xc2, 0x4c, 0xc1, 0x03, 0xc5, 0x65, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd,
+  0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf9, 0x1f, 0x42, 0x6a, 0x39, 0xcc, 0x3f, 0x80, 0x41, 0x2a,
+  0x32, 0xc1, 0x10, 0xc8, 0x0c, 0xc2, 0x1d, 0x80, 0x00, 0x13, 0x23, 0xc1, 0x10, 0xc5, 0x0a, 0xc3,
+  0x1b, 0xc1, 0x0d, 0x41, 0x57, 0x23, 0x00, 0x13, 0x23, 0xc2, 0x31, 0xc1, 0x37, 0xc2, 0x27, 0x80,
+  0x43, 0x13, 0x23, 0x81, 0x01, 0x57, 0x23, 0x2a, 0x32, 0xc4, 0x37, 0xc2, 0x0e, 0x00, 0x2a, 0x32,
+  0xc2, 0x0c, 0xc3, 0x20, 0xc4, 0x57, 0xc1, 0x47, 0xc1, 0x1e, 0x41, 0x08, 0x2d, 0x82, 0xc1, 0x32,
+  0xc4, 0x2e, 0xc2, 0x47, 0x00, 0x08, 0x2d, 0xc1, 0x5c, 0xc2, 0x10, 0x81, 0xc3, 0x55, 0xc1, 0x48,
+  0x00, 0xa9, 0x31, 0xc3, 0x13, 0x80, 0xc3, 0x50, 0xc5, 0x47, 0xc3, 0x5a, 0x42, 0x08, 0x2d, 0xc4,
+  0x42, 0xc4, 0x03, 0xc3, 0x19, 0xc2, 0x20, 0xc1, 0x80, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01,
+  0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf3, 0x1f, 0x41, 0x6a, 0x39, 0xcb, 0x3f, 0xc1, 0x0d, 0x00, 0x2a,
+  0x32, 0x80, 0xc1, 0x65, 0x41, 0x08, 0x2d, 0xc6, 0x5f, 0xc1, 0x0d, 0x01, 0x2a, 0x32, 0x13, 0x23,
+  0xc1, 0x10, 0x00, 0x08, 0x2d, 0xc1, 0x05, 0xc4, 0x10, 0xc2, 0x1c, 0x41, 0x13, 0x23, 0x01, 0x57,
+  0x23, 0xa9, 0x31, 0xc3, 0x13, 0x80, 0xc3, 0x8b, 0x43, 0x13, 0x23, 0x41, 0x57, 0x23, 0xc3, 0x02,
+  0x42, 0x08, 0x2d, 0xc2, 0x9c, 0x42, 0x57, 0x23, 0x82, 0xc3, 0x05, 0xc2, 0x20, 0xc2, 0xab, 0xc3,
+  0x08, 0xc4, 0x23, 0xc1, 0x43, 0xc4, 0x30, 0xc3, 0x0e, 0xc3, 0x2f, 0xc1, 0x44, 0xc4, 0x2e, 0xc3,
+  0x1f, 0xc5, 0x32, 0xc1, 0x63, 0x00, 0x68, 0x2d, 0xc3, 0x50, 0xc4, 0x4e, 0xc3, 0x62, 0xc3, 0x10,
+  0x00, 0xe7, 0x28, 0xc1, 0xed, 0xc3, 0x6d, 0x42, 0x2a, 0x32, 0xc2, 0x4d, 0xc2, 0x05, 0x80, 0xc1,
+  0xfc, 0x03, 0x0e, 0x33, 0x2f, 0x37, 0xd7, 0x7f, 0xff, 0x7f, 0xc1, 0x03, 0xc9, 0x01, 0xc1, 0x0a,
+  0x80, 0x00, 0xd7, 0x7f, 0xc7, 0x0e, 0xc1, 0x19, 0xc3, 0x03, 0x01, 0xff, 0x1e, 0x1d, 0x43, 0xc7,
+  0x21, 0xc1, 0x19, 0xc3, 0x03, 0x01, 0x7c, 0x0e, 0xff, 0x1e, 0xc5, 0x21, 0xc5, 0x19, 0x41, 0xca,
+  0x26, 0xc3, 0x03, 0xc5, 0x1d, 0xc5, 0x19, 0xc7, 0x3f, 0xc7, 0x19, 0xc5, 0x1d, 0xc7, 0x3f, 0xca,
+  0x6a, 0xc2, 0x21, 0xc1, 0x78, 0xc6, 0x66, 0xca, 0x7f, 0xc4, 0x66, 0xc4, 0x6e, 0xc3, 0x98, 0xc6,
+  0x80, 0xc4, 0x8e, 0xc3, 0x98, 0xc6, 0x80, 0xc3, 0xb6, 0xc4, 0x98, 0xc6, 0x66, 0xc3, 0xb6, 0xc4,
+  0x98, 0xc8, 0x3f, 0xc6, 0x98, 0xc6, 0x66, 0xc9, 0x3f, 0xc9, 0xec, 0xc4, 0xb6, 0x01, 0x79, 0x26,
+  0x7a, 0x2a, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x79, 0x26, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x9f, 0xde,
+  0xdf, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf1, 0x1f, 0x41,
+  0xad, 0x2e, 0xcc, 0x3f, 0x00, 0xad, 0x2e, 0x41, 0x51, 0x15, 0xc4, 0x10, 0x42, 0xad, 0x2e, 0xc4,
+  0x1c, 0x43, 0xb7, 0x19, 0x43, 0xad, 0x2e, 0x00, 0x51, 0x15, 0xc2, 0x06, 0xc1, 0x7c, 0x4b, 0xb7,
+  0x19, 0xc3, 0x1f, 0x81, 0x43, 0x39, 0x22, 0x83, 0xc1, 0x07, 0xc3, 0x47, 0xc1, 0x0d, 0x01, 0x79,
+  0x26, 0x7a, 0x2a, 0xc1, 0x01, 0xc3, 0x13, 0xc1, 0x07, 0xc3, 0x3f, 0xc2, 0x0c, 0xc8, 0x01, 0xc1,
+  0x20, 0xc1, 0xbc, 0xc5, 0x1d, 0xc2, 0x23, 0x41, 0xf9, 0x4a, 0xc1, 0x25, 0xc1, 0x68, 0xc4, 0x1f,
+  0x81, 0xc6, 0x25, 0xc1, 0x67, 0xc4, 0x1f, 0xc8, 0x32, 0xc2, 0x70, 0xcb, 0x3f, 0xc3, 0x1f, 0x01,
+  0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf1, 0x1f, 0x41, 0xad, 0x2e,
+  0xcc, 0x3f, 0x00, 0xad, 0x2e, 0x41, 0x51, 0x15, 0xc4, 0x10, 0x42, 0xad, 0x2e, 0xc3, 0x5f, 0x81,
+  0x00, 0x39, 0x22, 0x41, 0xb7, 0x19, 0x43, 0xad, 0x2e, 0x42, 0x51, 0x15, 0xc2, 0x10, 0xc2, 0x7f,
+  0x00, 0xad, 0x2e, 0x49, 0xb7, 0x19, 0xc4, 0x22, 0xc1, 0x20, 0xc2, 0x21, 0x81, 0x42, 0x39, 0x22,
+  0xc2, 0x18, 0xc3, 0x1f, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0x43, 0x39, 0x22, 0xc1, 0x05, 0x00, 0x79,
+  0x26, 0xc2, 0x12, 0xc3, 0x5f, 0xc1, 0x08, 0xc9, 0x01, 0xc2, 0x6e, 0x00, 0xb7, 0x19, 0xc7, 0x0e,
+  0x00, 0x39, 0x22, 0xc2, 0x18, 0xc2, 0x6e, 0xc3, 0x06, 0x41, 0xf9, 0x4a, 0xc7, 0x1f, 0xc1, 0x5d,
+  0xc3, 0x2e, 0x81, 0xc6, 0x34, 0xca, 0x2e, 0xc4, 0x45, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xca, 0x01,
+  0x02, 0xad, 0x2e, 0x0e, 0x33, 0x2f, 0x37, 0xc8, 0x0e, 0x00, 0xf9, 0x4a, 0xc1, 0x18, 0x00, 0x39,
+  0x22, 0x80, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0xc1, 0x1f, 0x41, 0x39, 0x22, 0xc4, 0x23, 0x80, 0xc2,
+  0x09, 0xc4, 0x1f, 0x81, 0xcd, 0x1f, 0xc9, 0x41, 0x80, 0x00, 0x51, 0x15, 0xc1, 0x30, 0xcb, 0x4e,
+  0x80, 0x00, 0xb7, 0x19, 0xc1, 0x50, 0xcc, 0x5f, 0x81, 0xcd, 0x1f, 0xce, 0x3f, 0xc2, 0x6e, 0xcc,
+  0x3f, 0xc2, 0x8e, 0xd8, 0x1f, 0xc2, 0x8e, 0xc5, 0x1f, 0x41, 0xf9, 0x4a, 0xc8, 0xc1, 0xc2, 0x6e,
+  0xc1, 0xbf, 0x81, 0xc9, 0x7f, 0xc1, 0x8f, 0xdc, 0x7f, 0xc3, 0x30, 0x01, 0x0e, 0x33, 0x2f, 0x37,
+  0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xc2, 0x1f, 0x41, 0x6a, 0x39, 0x00, 0x08, 0x2d, 0xc1,
+  0x25, 0x42, 0x08, 0x2d, 0xc6, 0x1f, 0xc1, 0x0d, 0x41, 0x56, 0x35, 0xc3, 0x03, 0xc4, 0x10, 0xc1,
+  0x3f, 0x03, 0x08, 0x2d, 0xfe, 0x73, 0x9f, 0x52, 0x6a, 0x39, 0x83, 0x02, 0x6a, 0x39, 0x9f, 0x52,
+  0xfe, 0x73, 0xc2, 0x21, 0xc1, 0x0e, 0x03, 0x77, 0x39, 0x9f, 0x52, 0xba, 0x35, 0x77, 0x39, 0xc1,
+  0x30, 0xc1, 0x2e, 0x03, 0x77, 0x39, 0xba, 0x35, 0x9f, 0x52, 0x77, 0x39, 0xc1, 0x32, 0xc1, 0x37,
+  0xc1, 0x1c, 0xc2, 0x2d, 0x42, 0x77, 0x39, 0x00, 0x6a, 0x39, 0xc2, 0x02, 0xc1, 0x47, 0xc1, 0x2e,
+  0xc4, 0x0d, 0xc1, 0x1b, 0xc1, 0x24, 0xc1, 0x19, 0xc3, 0x1f, 0xc2, 0x10, 0xc1, 0x22, 0xc2, 0x3b,
+  0xc2, 0x2c, 0xc2, 0x2e, 0xc1, 0x7f, 0x00, 0x54, 0x4a, 0xc2, 0x6d, 0x00, 0x56, 0x35, 0xc3, 0x1f,
+  0xc1, 0x74, 0x01, 0x6a, 0x39, 0x54, 0x4a, 0xc2, 0x7f, 0x03, 0x08, 0x2d, 0x57, 0x23, 0x13, 0x23,
+  0x2a, 0x32, 0xc2, 0x10, 0xc1, 0x3d, 0xc1, 0x73, 0x00, 0xa9, 0x31, 0xc4, 0x5f, 0xc2, 0x0e, 0xc4,
+  0x00, 0xc1, 0x95, 0x81, 0xc2, 0x9f, 0x00, 0x54, 0x4a, 0xc1, 0x98, 0xc3, 0x21, 0xc4, 0x26, 0x00,
+  0x54, 0x4a, 0xc3, 0xbf, 0xc1, 0x10, 0xc1, 0x30, 0x80, 0xc1, 0x2a, 0xc1, 0x35, 0xc3, 0x2e, 0xc3,
+  0xbf, 0xc2, 0x21, 0xc1, 0xbc, 0xc3, 0x04, 0xc2, 0x4e, 0xd0, 0xdf, 0x01, 0x0e, 0x33, 0x2f, 0x37,
+  0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xc2, 0x1f, 0x41, 0x6a, 0x39, 0x00, 0x08, 0x2d, 0xc1,
+  0x25, 0x42, 0x08, 0x2d, 0xc6, 0x1f, 0xc1, 0x0d, 0x41, 0xff, 0x7f, 0xc3, 0x03, 0xc4, 0x10, 0xc1,
+  0x3f, 0x04, 0x08, 0x2d, 0xfb, 0x7b, 0xf6, 0x77, 0x6a, 0x39, 0x5b, 0x73, 0x82, 0x02, 0x6a, 0x39,
+  0xf6, 0x77, 0xfb, 0x7b, 0xc2, 0x21, 0xc1, 0x0e, 0x02, 0xff, 0x7f, 0xf6, 0x77, 0x8a, 0x76, 0xc2,
+  0x0e, 0xc1, 0x2e, 0x02, 0x5b, 0x73, 0x8a, 0x76, 0xf6, 0x77, 0xc1, 0x22, 0xc1, 0x3f, 0x80, 0xc1,
+  0x1c, 0xc3, 0x1d, 0xc2, 0x32, 0xc3, 0x07, 0xc2, 0x1f, 0xc4, 0x0d, 0xc1, 0x1b, 0x00, 0x8a, 0x76,
+  0xc1, 0x3f, 0x00, 0x6a, 0x39, 0xc3, 0x1f, 0xc2, 0x10, 0xc1, 0x22, 0xc2, 0x3b, 0xc2, 0x2c, 0xc2,
+  0x2e, 0xc1, 0x7f, 0x00, 0x54, 0x4a, 0xc2, 0x6d, 0xc4, 0x1f, 0xc1, 0x74, 0x01, 0x6a, 0x39, 0x54,
+  0x4a, 0xc2, 0x7f, 0x03, 0x08, 0x2d, 0x57, 0x23, 0x13, 0x23, 0x2a, 0x32, 0xc1, 0x4b, 0xc1, 0x60,
+  0xc2, 0x45, 0x00, 0xa9, 0x31, 0xc4, 0x5f, 0xc2, 0x0e, 0xc4, 0x00, 0xc1, 0x95, 0x81, 0xc2, 0x9f,
+  0x00, 0x54, 0x4a, 0xc1, 0x98, 0xc3, 0x21, 0xc4, 0x26, 0x00, 0x54, 0x4a, 0xc3, 0xbf, 0xc1, 0x10,
+  0xc1, 0x30, 0x80, 0xc1, 0x2a, 0xc1, 0x35, 0xc3, 0x2e, 0xc3, 0xbf, 0xc2, 0x21, 0xc1, 0xbc, 0xc3,
+  0x04, 0xc2, 0x4e, 0xd0, 0xdf, 0x04, 0x0e, 0x33, 0x2f, 0x37, 0xad, 0x2e, 0x7a, 0x2a, 0x79, 0x26,
+  0xca, 0x01, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0x80, 0x00, 0x39, 0x22, 0xc4, 0x10, 0x41, 0xf9, 0x4a,
+  0xc4, 0x16, 0xc2, 0x1f, 0x80, 0xc4, 0x1f, 0x81, 0xc1, 0x27, 0xc2, 0x09, 0xc8, 0x1f, 0xc6, 0x34,
+  0xc1, 0x2e, 0x00, 0x51, 0x15, 0xc5, 0x1f, 0xc7, 0x3f, 0x80, 0x00, 0xb7, 0x19, 0xce, 0x1f, 0x80,
+  0xd5, 0x5f, 0xc7, 0x3f, 0xc2, 0x70, 0xcd, 0x7f, 0xc2, 0x90, 0xc2, 0x6a, 0xdc, 0x1f, 0xcc, 0x3f,
+  0xc1, 0x70, 0xcd, 0x7f, 0xc1, 0x8f, 0xc9, 0xbd, 0xc8, 0x7f, 0xc3, 0xbd, 0xc7, 0x9f, 0xcb, 0xee,
+  0x00, 0x79, 0x26, 0x03, 0x0e, 0x33, 0x7a, 0x2a, 0xb7, 0x77, 0x6a, 0x7b, 0x4b, 0x8a, 0x76, 0x00,
+  0x2f, 0x37, 0x8e, 0xc1, 0x1f, 0xcd, 0x20, 0xc1, 0x1f, 0xcd, 0x10, 0x01, 0x0e, 0x33, 0xb7, 0x19,
+  0x8d, 0x00, 0x2f, 0x37, 0x81, 0xcc, 0x50, 0xc1, 0x1f, 0xdf, 0x5f, 0xce, 0x7f, 0xce, 0x2f, 0xd1,
+  0x3f, 0xce, 0x5f, 0xce, 0x8f, 0xd0, 0x9f, 0xd0, 0xbf, 0xcd, 0xef, 0x7f, 0x8a, 0x76, 0xbf, 0xbf,
+  0xbf, 0x4b, 0x8a, 0x76, 0x03, 0x6a, 0x7b, 0xb7, 0x77, 0x7a, 0x2a, 0x2f, 0x37, 0x8e, 0x00, 0x0e,
+  0x33, 0xcd, 0x1e, 0xcb, 0x1f, 0xc3, 0x0e, 0xcb, 0x1f, 0x84, 0xcb, 0x3f, 0xc2, 0x4e, 0x00, 0xb7,
+  0x19, 0xcb, 0x3f, 0xdf, 0x5f, 0xe2, 0x1f, 0x00, 0xb7, 0x19, 0xda, 0x5f, 0xcf, 0x7f, 0x83, 0xcc,
+  0x7f, 0xce, 0xbf, 0xc5, 0xdf, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc1, 0x01, 0x01, 0x6a, 0x39, 0xa9,
+  0x31, 0x42, 0x13, 0x23, 0x42, 0x57, 0x23, 0xc1, 0x03, 0xc1, 0x05, 0xc1, 0x0e, 0x41, 0x08, 0x2d,
+  0x41, 0xa9, 0x31, 0xc4, 0x0e, 0xc2, 0x10, 0x81, 0xc1, 0x0e, 0x43, 0x2a, 0x32, 0xc4, 0x1d, 0xc3,
+  0x23, 0x00, 0x13, 0x23, 0xc5, 0x0e, 0xc1, 0x10, 0xc2, 0x31, 0x00, 0x2a, 0x32, 0xc3, 0x32, 0x00,
+  0xa9, 0x31, 0xc1, 0x2e, 0x81, 0x00, 0xa9, 0x31, 0x44, 0x2a, 0x32, 0xc2, 0x3e, 0xc1, 0x18, 0xc2,
+  0x3f, 0xc1, 0x1d, 0xc1, 0x10, 0x00, 0x57, 0x23, 0xc1, 0x13, 0xc3, 0x54, 0xc1, 0x19, 0xc1, 0x5f,
+  0xc3, 0x40, 0xc2, 0x27, 0xc2, 0x25, 0xc2, 0x00, 0xc1, 0x1f, 0x00, 0x08, 0x2d, 0x41, 0x68, 0x2d,
+  0xc3, 0x5f, 0xc2, 0x3c, 0xc4, 0x34, 0xc3, 0x5e, 0xc2, 0x10, 0xc2, 0x4b, 0xc2, 0x22, 0xc2, 0x21,
+  0xc1, 0x7c, 0xc3, 0x35, 0xc2, 0x51, 0xc3, 0x0e, 0xc2, 0x7a, 0x01, 0xa9, 0x31, 0xe7, 0x28, 0xc2,
+  0x0a, 0xc5, 0x11, 0xc2, 0x86, 0xc1, 0xa7, 0xc1, 0xae, 0xc5, 0x10, 0x00, 0x68, 0x2d, 0xc4, 0x0e,
+  0xc1, 0xb4, 0xc1, 0xbf, 0x80, 0xc3, 0x8c, 0xc4, 0x43, 0xc3, 0xa6, 0xc1, 0x0e, 0xc1, 0xcc, 0xc4,
+  0x48, 0xc1, 0x65, 0xc3, 0x42, 0x00, 0x13, 0x23, 0xc3, 0x2e, 0xc3, 0x71, 0xc3, 0x10, 0xc3, 0x22,
+  0x00, 0x2f, 0x37, 0xc1, 0x50, 0xc4, 0x2a, 0xc4, 0x8d, 0xc2, 0x8f, 0x41, 0x57, 0x23, 0x45, 0x13,
+  0x23, 0xc1, 0x06, 0x41, 0x2a, 0x32, 0x00, 0x08, 0x2d, 0xc1, 0x03, 0x00, 0xa9, 0x31, 0xc3, 0x0e,
+  0xc2, 0x13, 0xc2, 0x15, 0x41, 0x08, 0x2d, 0x42, 0xa9, 0x31, 0x00, 0x2a, 0x32, 0xc3, 0x0b, 0xc4,
+  0x03, 0xc1, 0x1f, 0x01, 0x68, 0x2d, 0x08, 0x2d, 0x42, 0x2a, 0x32, 0xc4, 0x1e, 0xc2, 0x05, 0xc4,
+  0x10, 0x00, 0xe7, 0x28, 0xc2, 0x20, 0x82, 0xc4, 0x16, 0x43, 0x2a, 0x32, 0x80, 0xc5, 0x20, 0xc1,
+  0x45, 0x44, 0x2a, 0x32, 0xc1, 0x3c, 0x80, 0xc1, 0x5b, 0x00, 0xa9, 0x31, 0xc2, 0x02, 0xc2, 0x0a,
+  0xc1, 0x4a, 0x00, 0x68, 0x2d, 0xc2, 0x4d, 0x80, 0xc1, 0x6d, 0xc3, 0x53, 0xc4, 0x1c, 0xc1, 0x18,
+  0xc2, 0x11, 0xc1, 0x10, 0x44, 0xa9, 0x31, 0xc3, 0x3b, 0xc2, 0x41, 0xc2, 0x89, 0xc1, 0x51, 0xc2,
+  0x37, 0x00, 0x68, 0x2d, 0xc4, 0x4e, 0x83, 0xc2, 0x51, 0xc2, 0x93, 0x81, 0xc5, 0x1e, 0xc2, 0x60,
+  0xc2, 0x4e, 0xc3, 0x10, 0xc1, 0x00, 0xc4, 0x8a, 0x00, 0xe7, 0x28, 0xc1, 0x08, 0xc2, 0xb7, 0xc2,
+  0xb9, 0xc3, 0x70, 0xc3, 0x78, 0xc2, 0x1f, 0xc2, 0x7c, 0xc3, 0x6d, 0xc1, 0x6e, 0xc3, 0xac, 0xc1,
+  0x71, 0xc3, 0x7b, 0x43, 0x68, 0x2d, 0xc4, 0x04, 0xc2, 0xa1, 0xc1, 0x5b, 0xc3, 0x1b, 0xc2, 0x3f,
+  0xc3, 0xa6, 0x42, 0xe7, 0x28, 0x00, 0x2a, 0x32, 0x42, 0x13, 0x23, 0x01, 0x6a, 0x39, 0xa9, 0x31,
+  0xc2, 0x04, 0x42, 0x57, 0x23, 0xc1, 0x03, 0xc1, 0x05, 0xc1, 0x0a, 0x41, 0x08, 0x2d, 0x41, 0xa9,
+  0x31, 0xc4, 0x0e, 0xc2, 0x10, 0x82, 0x00, 0x08, 0x2d, 0x43, 0x2a, 0x32, 0xc4, 0x1d, 0xc3, 0x23,
+  0xc1, 0x1d, 0xc4, 0x0e, 0xc3, 0x35, 0xc1, 0x04, 0xc3, 0x32, 0xc1, 0x1f, 0xc2, 0x20, 0x00, 0xa9,
+  0x31, 0x44, 0x2a, 0x32, 0xc2, 0x3e, 0xc1, 0x18, 0xc1, 0x4f, 0x80, 0xc2, 0x04, 0x01, 0xa9, 0x31,
+  0x57, 0x23, 0xc1, 0x13, 0xc3, 0x54, 0xc1, 0x19, 0xc1, 0x5e, 0xc3, 0x40, 0xc2, 0x27, 0xc2, 0x25,
+  0xc2, 0x00, 0xc1, 0x33, 0x00, 0x08, 0x2d, 0x41, 0x68, 0x2d, 0xc3, 0x5f, 0xc2, 0x3c, 0xc4, 0x34,
+  0xc3, 0x5e, 0xc2, 0x10, 0xc2, 0x4b, 0xc2, 0x22, 0xc2, 0x21, 0xc1, 0x7c, 0xc3, 0x35, 0xc2, 0x51,
+  0xc3, 0x0e, 0xc2, 0x7a, 0x01, 0xa9, 0x31, 0xe7, 0x28, 0xc2, 0x0a, 0xc5, 0x11, 0xc2, 0x86, 0xc1,
+  0xac, 0xc1, 0x3c, 0xc5, 0x10, 0x00, 0x68, 0x2d, 0xc4, 0x0e, 0xc1, 0xb4, 0xc1, 0x4d, 0x80, 0xc3,
+  0xc2, 0xc4, 0x43, 0xc3, 0xa6, 0xc1, 0x0e, 0xc1, 0xcc, 0xc4, 0x48, 0xc1, 0x65, 0xc3, 0x42, 0xc1,
+  0x9f, 0xc2, 0x3f, 0xc3, 0x71, 0xc3, 0x10, 0xc3, 0x22, 0xc2, 0x3f, 0xc4, 0x2a, 0xc4, 0x8d, 0xc2,
+  0x8f, 0x41, 0x57, 0x23, 0x45, 0x13, 0x23, 0xc1, 0x06, 0x41, 0x2a, 0x32, 0x00, 0x08, 0x2d, 0xc1,
+  0x03, 0x00, 0xa9, 0x31, 0xc3, 0x0e, 0xc2, 0x13, 0xc2, 0x15, 0x41, 0x08, 0x2d, 0x42, 0xa9, 0x31,
+  0x00, 0x2a, 0x32, 0xc3, 0x0b, 0xc4, 0x03, 0xc1, 0x1f, 0x01, 0x68, 0x2d, 0x08, 0x2d, 0x42, 0x2a,
+  0x32, 0xc4, 0x1e, 0xc2, 0x05, 0xc4, 0x10, 0x00, 0xe7, 0x28, 0xc2, 0x20, 0x82, 0xc4, 0x16, 0x43,
+  0x2a, 0x32, 0x80, 0xc5, 0x20, 0xc1, 0x45, 0x44, 0x2a, 0x32, 0xc1, 0x3c, 0x80, 0xc1, 0x5b, 0x00,
+  0xa9, 0x31, 0xc2, 0x02, 0xc2, 0x0a, 0xc1, 0x4a, 0x00, 0x68, 0x2d, 0xc2, 0x4d, 0x80, 0xc1, 0x6d,
+  0xc3, 0x53, 0xc4, 0x1c, 0xc1, 0x18, 0xc2, 0x11, 0xc1, 0x10, 0x44, 0xa9, 0x31, 0xc3, 0x3b, 0xc2,
+  0x41, 0xc2, 0x89, 0xc1, 0x51, 0xc2, 0x37, 0x00, 0x68, 0x2d, 0xc4, 0x4e, 0x83, 0xc2, 0x51, 0xc2,
+  0x93, 0x81, 0xc5, 0x1e, 0xc2, 0x60, 0xc2, 0x4e, 0xc3, 0x10, 0xc1, 0x00, 0xc4, 0x8a, 0x00, 0xe7,
+  0x28, 0xc1, 0x08, 0xc2, 0xb7, 0xc2, 0xb9, 0xc3, 0x70, 0xc3, 0x78, 0xc2, 0x1f, 0xc2, 0x7c, 0xc3,
+  0x6d, 0xc1, 0x6e, 0xc3, 0xac, 0xc1, 0x71, 0xc3, 0x7b, 0x43, 0x68, 0x2d, 0xc4, 0x04, 0xc2, 0xa1,
+  0xc1, 0x5b, 0xc3, 0x1b, 0xc2, 0x3f, 0xc3, 0xa6, 0x42, 0xe7, 0x28, 0x00, 0x2a, 0x32, 0x42, 0x13,
+  0x23, 0x01, 0x2a, 0x32, 0xa9, 0x31, 0x44, 0x2a, 0x32, 0xc1, 0x05, 0x03, 0xe7, 0x28, 0x0e, 0x33,
+  0x2f, 0x37, 0xa9, 0x31, 0x81, 0xc2, 0x0d, 0x42, 0xa9, 0x31, 0x00, 0x68, 0x2d, 0xc2, 0x03, 0x80,
+  0x01, 0x2f, 0x37, 0x0e, 0x33, 0xc2, 0x09, 0xc5, 0x1c, 0xc1, 0x18, 0xc2, 0x11, 0xc1, 0x10, 0x44,
+  0xa9, 0x31, 0xc3, 0x2e, 0xc2, 0x36, 0xc2, 0x3a, 0x00, 0xe7, 0x28, 0xc3, 0x2c, 0x00, 0x68, 0x2d,
+  0xc3, 0x0c, 0xc1, 0x48, 0xc3, 0x12, 0x80, 0xc2, 0x06, 0x82, 0xc5, 0x1e, 0xc1, 0x55, 0xc1, 0x1e,
+  0xc4, 0x5e, 0x42, 0x68, 0x2d, 0xc4, 0x31, 0xc2, 0x5f, 0x00, 0x57, 0x23, 0xc4, 0x17, 0xc3, 0x70,
+  0xc3, 0x78, 0xc1, 0x70, 0xc3, 0x7c, 0xc3, 0x6d, 0xc1, 0x6e, 0xc3, 0x53, 0xc1, 0x71, 0xc3, 0x7b,
+  0x43, 0x68, 0x2d, 0xc4, 0x04, 0xc2, 0x40, 0xc1, 0x5b, 0xc3, 0x1b, 0xc2, 0x3f, 0xc3, 0xa6, 0x42,
+  0xe7, 0x28, 0xc3, 0x18, 0xc1, 0xae, 0x43, 0x13, 0x23, 0xc2, 0xb0, 0xc2, 0x9f, 0xc3, 0x29, 0xc2,
+  0xbe, 0xc2, 0xc4, 0xc2, 0x29, 0xc2, 0xb0, 0x83, 0xc2, 0xcf, 0xc5, 0x2d, 0x81, 0xc2, 0xbf, 0xc3,
+  0x45, 0xc4, 0xd2, 0xc1, 0xdd, 0xc1, 0xad, 0xc1, 0x1f, 0x00, 0x2d, 0x15, 0xc2, 0x51, 0x81, 0xc4,
+  0x02, 0xc1, 0xdd, 0xc1, 0xdf, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e,
+  0x33, 0xff, 0x1f, 0xd4, 0x5f, 0x04, 0xe7, 0x28, 0x08, 0x2d, 0x6a, 0x39, 0x75, 0x21, 0x6a, 0x39,
+  0xc9, 0x5f, 0x01, 0xe7, 0x28, 0xfa, 0x25, 0x41, 0x1e, 0x3f, 0x00, 0x9e, 0x36, 0xc5, 0x10, 0xc4,
+  0x8e, 0x80, 0x00, 0x9e, 0x36, 0x82, 0x01, 0xfa, 0x25, 0x08, 0x2d, 0xc9, 0x1f, 0x81, 0x00, 0xbe,
+  0x42, 0x82, 0xc9, 0x1f, 0x00, 0x1b, 0x2e, 0xc2, 0x2f, 0x01, 0x1b, 0x2e, 0x6a, 0x39, 0xcb, 0x1f,
+  0xc2, 0x2f, 0x00, 0x75, 0x21, 0xce, 0x3f, 0x80, 0xca, 0x3f, 0x00, 0xbe, 0x42, 0x82, 0xd4, 0x5f,
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xc1, 0x0e, 0x4b, 0x08, 0x2d, 0xc1, 0x1c, 0xc1, 0x0e,
+  0x43, 0x3e, 0x47, 0x00, 0xfc, 0x3a, 0xc1, 0x01, 0xc3, 0x00, 0x00, 0x38, 0x2e, 0xc1, 0x10, 0x00,
+  0x2f, 0x37, 0x80, 0x4a, 0xfc, 0x3a, 0x81, 0xc1, 0x1f, 0x00, 0xe7, 0x28, 0x4a, 0x38, 0x2e, 0x01,
+  0xd6, 0x25, 0xe7, 0x28, 0xc1, 0x3f, 0x8d, 0xc6, 0x1f, 0x41, 0xd6, 0x25, 0x00, 0x75, 0x21, 0x81,
+  0xc1, 0x02, 0xc5, 0x1f, 0x41, 0x75, 0x21, 0xc1, 0x0d, 0xc2, 0x02, 0xc3, 0x04, 0xc7, 0x1f, 0xcb,
+  0x3f, 0x4b, 0xd6, 0x25, 0xc2, 0x3f, 0xc1, 0x50, 0xca, 0x00, 0xc3, 0x9f, 0xc3, 0xb0, 0xc2, 0x24,
+  0xc1, 0x6a, 0xc4, 0xba, 0xc4, 0xbf, 0x00, 0x54, 0x4a, 0xc1, 0x84, 0x81, 0x00, 0x54, 0x4a, 0xc6,
+  0xbf, 0xc2, 0x0e, 0x85, 0xc4, 0x10, 0xc3, 0xdf, 0x81, 0xc1, 0x20, 0xc2, 0x0e, 0x80, 0xc7, 0x1f,
+  0xc3, 0x10, 0xc6, 0x0e, 0x00, 0x0e, 0x33, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xca, 0x01, 0x02, 0xad,
+  0x2e, 0x0e, 0x33, 0x2f, 0x37, 0xc8, 0x0e, 0x00, 0xf9, 0x4a, 0xc1, 0x18, 0x00, 0x39, 0x22, 0x80,
+  0x01, 0x2f, 0x37, 0x0e, 0x33, 0xc1, 0x1f, 0x41, 0x39, 0x22, 0xc4, 0x23, 0x80, 0xc2, 0x09, 0xc4,
+  0x1f, 0x81, 0xcd, 0x1f, 0xc9, 0x41, 0x80, 0x00, 0x51, 0x15, 0xc1, 0x30, 0xcb, 0x4e, 0x80, 0x00,
+  0xb7, 0x19, 0xc1, 0x50, 0xcc, 0x5f, 0x81, 0xcd, 0x1f, 0xce, 0x3f, 0xc2, 0x6e, 0xcc, 0x3f, 0xc2,
+  0x8e, 0xd8, 0x1f, 0xc2, 0x8e, 0xc5, 0x1f, 0x41, 0xf9, 0x4a, 0xc8, 0xc1, 0xc2, 0x6e, 0xc1, 0xbf,
+  0x81, 0xc9, 0x7f, 0xc1, 0x8f, 0xdc, 0x7f, 0xc3, 0x30, 0x04, 0x0e, 0x33, 0x2f, 0x37, 0xad, 0x2e,
+  0x7a, 0x2a, 0x79, 0x26, 0xca, 0x01, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0x80, 0x00, 0x39, 0x22, 0xc4,
+  0x10, 0x41, 0xf9, 0x4a, 0xc4, 0x16, 0xc2, 0x1f, 0x80, 0xc4, 0x1f, 0x81, 0xc1, 0x27, 0xc2, 0x09,
+  0xc8, 0x1f, 0xc6, 0x34, 0xc1, 0x2e, 0x00, 0x51, 0x15, 0xc5, 0x1f, 0xc7, 0x3f, 0x80, 0x00, 0xb7,
+  0x19, 0xce, 0x1f, 0x80, 0xd5, 0x5f, 0xc7, 0x3f, 0xc2, 0x70, 0xcd, 0x7f, 0xc2, 0x90, 0xc2, 0x6a,
+  0xdc, 0x1f, 0xcc, 0x3f, 0xc1, 0x70, 0xcd, 0x7f, 0xc1, 0x8f, 0xc9, 0xbd, 0xc8, 0x7f, 0xc3, 0xbd,
+  0xc7, 0x9f, 0xcb, 0xee, 0x00, 0x79, 0x26, 0x01, 0x79, 0x26, 0x7a, 0x2a, 0xc9, 0x01, 0x03, 0x39,
+  0x22, 0xad, 0x2e, 0x0e, 0x33, 0x2f, 0x37, 0xca, 0x0e, 0x00, 0x79, 0x26, 0x81, 0x01, 0x2f, 0x37,
+  0x0e, 0x33, 0xdb, 0x1f, 0x01, 0x7a, 0x2a, 0x51, 0x15, 0xc1, 0x30, 0xcb, 0x3f, 0x01, 0x79, 0x26,
+  0xb7, 0x19, 0xc1, 0x30, 0xe4, 0x3f, 0x41, 0xf9, 0x4a, 0xcd, 0x5f, 0x81, 0xc7, 0x3f, 0x00, 0xad,
+  0x2e, 0xc1, 0x84, 0x00, 0x39, 0x22, 0xcb, 0x81, 0x00, 0xb7, 0x19, 0xc1, 0x84, 0x80, 0xcc, 0x92,
+  0xcc, 0x7f, 0xc2, 0xbc, 0xcb, 0xbf, 0xc3, 0x45, 0xc6, 0x06, 0xd4, 0x1f, 0xc3, 0xeb, 0xcf, 0x3f,
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf1, 0x1f, 0x41, 0xad,
+  0x2e, 0xcc, 0x3f, 0x00, 0xad, 0x2e, 0x41, 0x51, 0x15, 0xc4, 0x10, 0x42, 0xad, 0x2e, 0xc3, 0x5f,
+  0x00, 0xad, 0x2e, 0x43, 0xb7, 0x19, 0x43, 0xad, 0x2e, 0x42, 0x51, 0x15, 0xc2, 0x10, 0xc4, 0x0e,
+  0xc8, 0x03, 0xc1, 0x3a, 0xc1, 0x1d, 0x43, 0x39, 0x22, 0x83, 0xc5, 0x06, 0xc1, 0x0d, 0x01, 0x79,
+  0x26, 0x7a, 0x2a, 0xc1, 0x01, 0xc3, 0x13, 0xc2, 0x07, 0xc2, 0x1a, 0xc2, 0x0c, 0xcc, 0x01, 0xc5,
+  0x0e, 0x00, 0xf9, 0x4a, 0xc8, 0x16, 0xc9, 0x1f, 0xc5, 0x2b, 0xc9, 0x2e, 0xc5, 0x49, 0xcf, 0x3f,
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf1, 0x1f, 0x41, 0xad,
+  0x2e, 0xcc, 0x3f, 0x00, 0xad, 0x2e, 0x41, 0x51, 0x15, 0xc4, 0x10, 0x42, 0xad, 0x2e, 0xc3, 0x5f,
+  0x00, 0xad, 0x2e, 0x43, 0xb7, 0x19, 0x43, 0xad, 0x2e, 0x42, 0x51, 0x15, 0xc2, 0x10, 0xc4, 0x0e,
+  0xc8, 0x03, 0xc1, 0x3a, 0xc1, 0x1d, 0x43, 0x39, 0x22, 0x83, 0xc5, 0x06, 0xc1, 0x0d, 0x01, 0x79,
+  0x26, 0x7a, 0x2a, 0xc1, 0x01, 0xc3, 0x13, 0xc2, 0x07, 0xc2, 0x1a, 0xc2, 0x0c, 0xc6, 0x01, 0x41,
+  0xf9, 0x4a, 0xc3, 0x0b, 0xc8, 0x0e, 0x00, 0x7a, 0x2a, 0x81, 0xc3, 0x29, 0xc9, 0x1f, 0xc3, 0x12,
+  0xcb, 0x1f, 0xc5, 0x38, 0xce, 0x0e, 0x00, 0x79, 0x26, 0x05, 0x0e, 0x33, 0x2f, 0x37, 0xad, 0x2e,
+  0x39, 0x22, 0x79, 0x26, 0x7a, 0x2a, 0xc9, 0x01, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0x81, 0xca, 0x0e,
+  0x00, 0x79, 0x26, 0xc5, 0x1f, 0x00, 0xf9, 0x4a, 0xc9, 0x1f, 0x01, 0xad, 0x2e, 0x51, 0x15, 0xc9,
+  0x2e, 0x41, 0x39, 0x22, 0xc1, 0x1f, 0x80, 0x00, 0xb7, 0x19, 0xc9, 0x3d, 0x81, 0xcd, 0x3f, 0xc3,
+  0x1f, 0xcb, 0x5f, 0xcf, 0x1f, 0xc2, 0x78, 0x41, 0xad, 0x2e, 0xca, 0x3f, 0xc2, 0x87, 0x00, 0xb7,
+  0x19, 0xcc, 0x7d, 0xc2, 0x52, 0xcd, 0x0e, 0x41, 0x7a, 0x2a, 0xc9, 0xac, 0xc4, 0x94, 0xca, 0xbb,
+  0x80, 0xd1, 0x1f, 0xc1, 0xda, 0xcd, 0x3d, 0xcc, 0x3f, 0xc4, 0xf6, 0x03, 0x0e, 0x33, 0x7a, 0x2a,
+  0xb7, 0x77, 0x6a, 0x7b, 0x4b, 0x8a, 0x76, 0x00, 0x2f, 0x37, 0x8e, 0xf0, 0x1f, 0x00, 0xb7, 0x19,
+  0xce, 0x3f, 0x80, 0x00, 0x7a, 0x2a, 0xce, 0x1f, 0x8d, 0xc1, 0x7f, 0x00, 0xb7, 0x19, 0x80, 0xcb,
+  0x80, 0x00, 0x2f, 0x37, 0xc2, 0x30, 0xcb, 0x91, 0x00, 0x0e, 0x33, 0xc1, 0x90, 0xc3, 0x10, 0xc8,
+  0xa3, 0xc1, 0x1f, 0xc2, 0x10, 0xc1, 0x63, 0xc1, 0x00, 0x42, 0x6a, 0x7b, 0xc5, 0x1f, 0xc2, 0x21,
+  0xc2, 0x11, 0xc2, 0x35, 0xc3, 0x12, 0x00, 0x6a, 0x7b, 0xc2, 0x1f, 0xc2, 0x12, 0x42, 0x7a, 0x2a,
+  0xc2, 0x11, 0xc2, 0x12, 0x00, 0xb7, 0x77, 0xc4, 0x0e, 0xc8, 0x12, 0xc1, 0x39, 0xc7, 0x0e, 0xc4,
+  0x36, 0xc2, 0x26, 0x7f, 0x8a, 0x76, 0xbf, 0xbf, 0x4f, 0x6a, 0x7b, 0x4f, 0xb7, 0x77, 0x41, 0xb7,
+  0x19, 0x42, 0x7a, 0x2a, 0x45, 0xb7, 0x19, 0xc4, 0x08, 0x4f, 0x7a, 0x2a, 0x4b, 0x8a, 0x76, 0x03,
+  0x6a, 0x7b, 0xb7, 0x77, 0x7a, 0x2a, 0x2f, 0x37, 0x8e, 0x00, 0x0e, 0x33, 0xfd, 0x1f, 0x00, 0xb7,
+  0x19, 0xcd, 0x3f, 0x00, 0x7a, 0x2a, 0x80, 0xcd, 0x5f, 0x81, 0xcb, 0x5f, 0xc2, 0x2e, 0xcb, 0x7f,
+  0xc2, 0x8d, 0xc1, 0x2e, 0xc7, 0x7f, 0x42, 0x6a, 0x7b, 0xc2, 0x0e, 0xc1, 0x8e, 0xc4, 0x9f, 0xc3,
+  0x0c, 0xc1, 0x00, 0x41, 0xb7, 0x19, 0xc2, 0x0e, 0x00, 0x0e, 0x33, 0x43, 0x6a, 0x7b, 0xc1, 0x0c,
+  0xc1, 0x58, 0xc2, 0x0d, 0xc3, 0x0e, 0x00, 0x2f, 0x37, 0xc2, 0x18, 0xc1, 0x08, 0xc3, 0x0c, 0xc1,
+  0xca, 0xc3, 0x0e, 0x00, 0x0e, 0x33, 0x43, 0xb7, 0x19, 0xc8, 0x0c, 0xc2, 0x1f, 0x44, 0x7a, 0x2a,
+  0xc7, 0x0c, 0xc2, 0x3f, 0x04, 0x0e, 0x33, 0x2f, 0x37, 0x0e, 0x33, 0xe7, 0x28, 0x68, 0x2d, 0x41,
+  0x57, 0x23, 0x01, 0x13, 0x23, 0x2a, 0x32, 0x42, 0xa9, 0x31, 0x00, 0x68, 0x2d, 0xc1, 0x01, 0x00,
+  0x68, 0x2d, 0xc1, 0x0e, 0xc2, 0x10, 0x41, 0x13, 0x23, 0xc1, 0x0e, 0x41, 0x2a, 0x32, 0xc2, 0x0d,
+  0xc1, 0x14, 0xc2, 0x1f, 0x00, 0x2f, 0x37, 0x81, 0xc2, 0x1d, 0x44, 0x68, 0x2d, 0xc1, 0x22, 0xc4,
+  0x1f, 0xc4, 0x2b, 0xc5, 0x11, 0xc3, 0x1f, 0xc1, 0x41, 0xc1, 0x42, 0xc2, 0x2e, 0xc4, 0x2f, 0xc3,
+  0x3f, 0xc3, 0x32, 0xc2, 0x4e, 0x00, 0xe7, 0x28, 0x41, 0x2d, 0x15, 0xc1, 0x51, 0xc5, 0x0e, 0xc2,
+  0x43, 0xc2, 0x00, 0x81, 0xc1, 0x10, 0xc6, 0x1f, 0xc4, 0x56, 0x41, 0x7a, 0x2e, 0x41, 0xd5, 0x25,
+  0xc9, 0x0e, 0xc1, 0x87, 0x81, 0x00, 0x1e, 0x3f, 0x80, 0xcb, 0x1f, 0x00, 0xd5, 0x25, 0x41, 0x1e,
+  0x3f, 0xca, 0x1f, 0xc1, 0x2e, 0xc2, 0x0e, 0x00, 0x7a, 0x2e, 0xcb, 0x0e, 0x42, 0x7a, 0x2e, 0x00,
+  0x1e, 0x3f, 0xc6, 0x5f, 0x00, 0xca, 0x26, 0xc4, 0x1d, 0x01, 0xd5, 0x25, 0x2d, 0x15, 0xc7, 0x1f,
+  0x80, 0x04, 0xca, 0x26, 0x0e, 0x33, 0x2d, 0x15, 0xca, 0x26, 0x2d, 0x15, 0xc1, 0x97, 0x80, 0xc6,
+  0x7f, 0xc5, 0x00, 0xc1, 0x14, 0x00, 0xe7, 0x28, 0xca, 0x7f, 0xc4, 0xba, 0x01, 0x68, 0x2d, 0xa9,
+  0x31, 0x41, 0x68, 0x2d, 0x01, 0xa9, 0x31, 0x2a, 0x32, 0x43, 0x13, 0x23, 0x41, 0x2a, 0x32, 0x01,
+  0xa9, 0x31, 0xe7, 0x28, 0xc4, 0x0d, 0x82, 0xc2, 0x10, 0x01, 0x2a, 0x32, 0x68, 0x2d, 0x81, 0xc2,
+  0x10, 0x83, 0xc1, 0x18, 0x83, 0xc1, 0x1d, 0x00, 0xe7, 0x28, 0x81, 0x00, 0xd5, 0x25, 0xc1, 0x13,
+  0xc1, 0x17, 0x80, 0xc1, 0x08, 0xc2, 0x2c, 0x81, 0x00, 0x7a, 0x2e, 0xc1, 0x10, 0x80, 0x01, 0x68,
+  0x2d, 0x2d, 0x15, 0xc2, 0x27, 0x81, 0xc4, 0x02, 0x00, 0xd5, 0x25, 0x41, 0x1e, 0x3f, 0x83, 0xc2,
+  0x36, 0xc1, 0x2a, 0x00, 0x2f, 0x37, 0xc1, 0x2d, 0x00, 0x7a, 0x2e, 0xc2, 0x0e, 0x00, 0x7a, 0x2e,
+  0x81, 0xc1, 0x00, 0xc1, 0x0c, 0x00, 0x0e, 0x33, 0xc1, 0x01, 0xc2, 0x0e, 0x42, 0x7a, 0x2e, 0xc2,
+  0x03, 0x00, 0xd5, 0x25, 0x81, 0xc1, 0x0e, 0x00, 0xca, 0x26, 0xc4, 0x1d, 0xc1, 0x0a, 0xc2, 0x0e,
+  0xc1, 0x10, 0xc2, 0x1f, 0x80, 0x03, 0xca, 0x26, 0x0e, 0x33, 0x2d, 0x15, 0xca, 0x26, 0xc1, 0x28,
+  0xc1, 0x52, 0xc2, 0x23, 0x81, 0xc2, 0x2e, 0xc4, 0x00, 0xc1, 0x14, 0xc1, 0x70, 0xc2, 0x23, 0xc3,
+  0x30, 0xc6, 0x01, 0x00, 0x0e, 0x33, 0xc3, 0x34, 0xc4, 0x41, 0xc6, 0x12, 0xc1, 0x72, 0xc2, 0x50,
+  0xc2, 0x39, 0xc2, 0x30, 0xc4, 0x23, 0x02, 0xca, 0x26, 0x7a, 0x2e, 0xca, 0x26, 0xc1, 0x4f, 0x81,
+  0xc7, 0x0e, 0xc2, 0x42, 0xc4, 0x0c, 0xc3, 0x4f, 0xc6, 0x41, 0xcb, 0x0c, 0xc1, 0x98, 0x04, 0x68,
+  0x2d, 0x2d, 0x15, 0x68, 0x2d, 0xe7, 0x28, 0x68, 0x2d, 0x41, 0x57, 0x23, 0x01, 0x13, 0x23, 0x2a,
+  0x32, 0x42, 0xa9, 0x31, 0x00, 0x68, 0x2d, 0xc1, 0x01, 0xc1, 0x00, 0x42, 0x2d, 0x15, 0x00, 0xe7,
+  0x28, 0x41, 0x13, 0x23, 0xc1, 0x0e, 0x41, 0x2a, 0x32, 0xc2, 0x0d, 0xc1, 0x14, 0x41, 0x7a, 0x2e,
+  0x00, 0xd5, 0x25, 0x82, 0xc2, 0x1d, 0x44, 0x68, 0x2d, 0xc1, 0x22, 0xc1, 0x0e, 0xc1, 0x10, 0x80,
+  0xc4, 0x2b, 0xc5, 0x11, 0x42, 0x7a, 0x2e, 0x81, 0xc1, 0x00, 0x00, 0x68, 0x2d, 0xc2, 0x2e, 0xc4,
+  0x2f, 0x41, 0xd5, 0x25, 0x01, 0x2d, 0x15, 0x7a, 0x2e, 0xc1, 0x40, 0x00, 0x2f, 0x37, 0xc3, 0x22,
+  0x00, 0xe7, 0x28, 0xc1, 0x4a, 0xc1, 0x51, 0x00, 0x1e, 0x3f, 0xc2, 0x10, 0xc2, 0x41, 0xc1, 0x10,
+  0xc2, 0x24, 0xc2, 0x5a, 0x00, 0x68, 0x2d, 0x80, 0x00, 0x1e, 0x3f, 0xc2, 0x50, 0x00, 0xca, 0x26,
+  0xc1, 0x62, 0x41, 0x0e, 0x33, 0xc1, 0x23, 0xc2, 0x5b, 0x03, 0xd5, 0x25, 0xca, 0x26, 0x7a, 0x2e,
+  0xca, 0x26, 0xc1, 0x4f, 0x81, 0x43, 0x0e, 0x33, 0x82, 0xc1, 0x2d, 0x80, 0x00, 0x0e, 0x33, 0xc5,
+  0x0c, 0xc3, 0x1f, 0x00, 0xd5, 0x25, 0xc1, 0x2c, 0x80, 0x46, 0x0e, 0x33, 0x00, 0x2f, 0x37, 0xc3,
+  0x2e, 0xc2, 0x0e, 0x00, 0x7a, 0x2e, 0xc2, 0x08, 0xc5, 0x01, 0xc2, 0x0e, 0xc2, 0x7b, 0x00, 0x1e,
+  0x3f, 0xc6, 0x0e, 0x00, 0xca, 0x26, 0xc4, 0x1d, 0xc2, 0x7b, 0xc6, 0x1f, 0x80, 0xc1, 0x47, 0xc3,
+  0x65, 0xc1, 0x62, 0xc6, 0x2e, 0xc5, 0x52, 0xc1, 0x5c, 0xc1, 0x99, 0xc7, 0x3f, 0xc6, 0x47, 0x01,
+  0x68, 0x2d, 0xa9, 0x31, 0x41, 0x68, 0x2d, 0x01, 0xa9, 0x31, 0x2a, 0x32, 0x43, 0x13, 0x23, 0x41,
+  0x2a, 0x32, 0x01, 0xa9, 0x31, 0xe7, 0x28, 0xc4, 0x0d, 0x82, 0xc2, 0x10, 0x01, 0x2a, 0x32, 0x68,
+  0x2d, 0x81, 0xc2, 0x10, 0x83, 0xc1, 0x18, 0x83, 0xc1, 0x1d, 0x00, 0xe7, 0x28, 0x81, 0x00, 0xd5,
+  0x25, 0xc1, 0x13, 0xc1, 0x17, 0x80, 0xc1, 0x08, 0xc2, 0x2c, 0x81, 0x00, 0x7a, 0x2e, 0xc1, 0x10,
+  0x80, 0x01, 0x68, 0x2d, 0x2d, 0x15, 0xc2, 0x27, 0x81, 0xc4, 0x02, 0x00, 0xd5, 0x25, 0x41, 0x1e,
+  0x3f, 0x83, 0xc2, 0x36, 0xc1, 0x2a, 0x00, 0x2f, 0x37, 0xc1, 0x2d, 0x00, 0x7a, 0x2e, 0xc2, 0x0e,
+  0x00, 0x7a, 0x2e, 0x81, 0xc1, 0x00, 0xc1, 0x0c, 0x00, 0x0e, 0x33, 0xc1, 0x01, 0xc2, 0x0e, 0x42,
+  0x7a, 0x2e, 0xc2, 0x03, 0x00, 0xd5, 0x25, 0x81, 0xc1, 0x0e, 0x00, 0xca, 0x26, 0xc4, 0x1d, 0xc1,
+  0x0a, 0xc2, 0x0e, 0xc1, 0x10, 0xc2, 0x1f, 0x80, 0x03, 0xca, 0x26, 0x0e, 0x33, 0x2d, 0x15, 0xca,
+  0x26, 0xc1, 0x28, 0xc1, 0x52, 0xc2, 0x23, 0x81, 0xc2, 0x2e, 0xc4, 0x00, 0xc1, 0x14, 0xc1, 0x70,
+  0xc2, 0x23, 0xc3, 0x30, 0xc6, 0x01, 0x00, 0x0e, 0x33, 0xc3, 0x34, 0xc4, 0x41, 0xc6, 0x12, 0xc1,
+  0x72, 0xc2, 0x50, 0xc2, 0x39, 0xc2, 0x30, 0xc4, 0x23, 0x02, 0xca, 0x26, 0x7a, 0x2e, 0xca, 0x26,
+  0xc1, 0x4f, 0x81, 0xc7, 0x0e, 0xc2, 0x42, 0xc4, 0x0c, 0xc3, 0x4f, 0xc6, 0x41, 0xcb, 0x0c, 0xc1,
+  0x98, 0x02, 0x68, 0x2d, 0x2d, 0x15, 0x68, 0x2d, 0x41, 0xa9, 0x31, 0x42, 0xe7, 0x28, 0x00, 0x0e,
+  0x33, 0xc1, 0x03, 0x01, 0x2f, 0x37, 0x0e, 0x33, 0xc2, 0x01, 0x81, 0xc1, 0x00, 0xc1, 0x0c, 0xc4,
+  0x0a, 0xc4, 0x05, 0x41, 0x7a, 0x2e, 0x00, 0xd5, 0x25, 0x81, 0xc9, 0x0e, 0x00, 0x2f, 0x37, 0xc1,
+  0x0e, 0xc1, 0x10, 0xcd, 0x1f, 0x82, 0xca, 0x1f, 0x41, 0xd5, 0x25, 0x01, 0x2d, 0x15, 0x7a, 0x2e,
+  0xcb, 0x30, 0x00, 0x1e, 0x3f, 0xc2, 0x10, 0xcb, 0x41, 0x80, 0x00, 0x1e, 0x3f, 0xc2, 0x50, 0x00,
+  0xca, 0x26, 0xc2, 0x62, 0xc6, 0x63, 0x02, 0xca, 0x26, 0x7a, 0x2e, 0xca, 0x26, 0xc1, 0x4f, 0x81,
+  0x43, 0x0e, 0x33, 0xc4, 0x7f, 0x80, 0xc1, 0x11, 0xc4, 0x0c, 0xc7, 0x1f, 0xc6, 0x00, 0xc8, 0x90,
+  0xca, 0x8a, 0xc5, 0x1f, 0xce, 0x10, 0xef, 0x1f, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc2, 0x01, 0x01,
+  0xe7, 0x28, 0x1b, 0x2e, 0x41, 0x1e, 0x3f, 0x02, 0x9e, 0x36, 0x1b, 0x2e, 0xad, 0x2e, 0xc3, 0x0b,
+  0xc3, 0x0e, 0x00, 0x2f, 0x37, 0x80, 0x00, 0x9e, 0x36, 0x80, 0x00, 0xbe, 0x42, 0x80, 0x01, 0xfa,
+  0x25, 0x6a, 0x39, 0xc3, 0x1a, 0xc5, 0x1f, 0x81, 0xc1, 0x1f, 0x80, 0x00, 0x08, 0x2d, 0xca, 0x1f,
+  0x41, 0xfa, 0x25, 0x00, 0x75, 0x21, 0x81, 0xc9, 0x1f, 0x00, 0xfa, 0x25, 0x41, 0x9e, 0x36, 0x02,
+  0xff, 0x7f, 0x75, 0x21, 0xe7, 0x28, 0xc9, 0x3f, 0x00, 0x75, 0x21, 0xc1, 0x40, 0x00, 0xad, 0x2e,
+  0x81, 0xc8, 0x3f, 0x00, 0x54, 0x4a, 0x41, 0xe7, 0x28, 0x00, 0xad, 0x2e, 0xc1, 0x02, 0x00, 0x54,
+  0x4a, 0xc8, 0x5f, 0xca, 0x03, 0xce, 0x0e, 0xff, 0x1f, 0xf0, 0x5f, 0x01, 0x0e, 0x33, 0x2f, 0x37,
+  0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f, 0xd8, 0x9f, 0x44, 0xe7, 0x28,
+  0x00, 0x08, 0x2d, 0xc7, 0xbf, 0xc1, 0x0d, 0x01, 0x13, 0x3a, 0x54, 0x3e, 0x42, 0x96, 0x3e, 0x00,
+  0xf9, 0x4a, 0xc7, 0x0e, 0xc1, 0x0d, 0xc3, 0x0e, 0xc1, 0x11, 0xc6, 0x1d, 0x44, 0x54, 0x3e, 0x83,
+  0xc5, 0x2c, 0x00, 0xaf, 0x31, 0xc2, 0x1e, 0xc5, 0x01, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01,
+  0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f, 0xce, 0x9f, 0x00, 0x08, 0x2d, 0xce, 0xb0,
+  0x00, 0xf9, 0x4a, 0xce, 0x10, 0x80, 0xce, 0x10, 0x41, 0x96, 0x3e, 0xcd, 0x21, 0x41, 0x54, 0x3e,
+  0x01, 0x13, 0x3a, 0xe7, 0x28, 0xcb, 0xf2, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e,
+  0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f, 0xcd, 0x9f, 0x00, 0x08, 0x2d, 0xce, 0x0e, 0x00, 0x7f,
+  0x21, 0xcd, 0x1d, 0x00, 0xfc, 0x1c, 0x80, 0xce, 0x0e, 0x00, 0xfc, 0x1c, 0xce, 0x0e, 0x80, 0xcc,
+  0x2c, 0x82, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xf2, 0x1f,
+  0x49, 0xe7, 0x28, 0xc4, 0x3f, 0x02, 0x08, 0x2d, 0xfc, 0x1c, 0xdb, 0x18, 0xc1, 0x01, 0xc5, 0x00,
+  0xc1, 0x10, 0xc3, 0x0e, 0xc9, 0x00, 0xc1, 0x10, 0xc2, 0x1d, 0x00, 0x7f, 0x21, 0xc3, 0x01, 0xc5,
+  0x00, 0xc1, 0x29, 0xc2, 0x0e, 0xc1, 0x2d, 0x88, 0xc1, 0x38, 0xc2, 0x0e, 0x8b, 0x00, 0xdb, 0x18,
+  0xc3, 0x03, 0xca, 0x3f, 0xc2, 0x2b, 0xc1, 0x12, 0xcb, 0x3f, 0xc2, 0x49, 0xc2, 0x33, 0xcb, 0x3f,
+  0xc2, 0x6e, 0xcb, 0x3f, 0x4c, 0xfc, 0x1c, 0x81, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce,
+  0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xde, 0x5f, 0x00, 0xe7, 0x28, 0xce, 0x7f, 0x00, 0xdb, 0x18,
+  0xce, 0x10, 0x00, 0xfc, 0x1c, 0xce, 0x10, 0x80, 0xce, 0x10, 0xc1, 0x1f, 0xcd, 0x21, 0x81, 0xcd,
+  0x10, 0x82, 0xcc, 0x21, 0xc2, 0x2e, 0xc2, 0x21, 0x00, 0xfc, 0x1c, 0xc8, 0x76, 0x01, 0x0e, 0x33,
+  0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x9f, 0xde,
+  0xdf, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff,
+  0x5f, 0xc5, 0x9f, 0x48, 0xe7, 0x28, 0xc6, 0xae, 0x80, 0x00, 0xa9, 0x31, 0x41, 0x68, 0x2d, 0xc4,
+  0x02, 0xc7, 0x1f, 0x00, 0x2a, 0x32, 0x41, 0xa9, 0x31, 0x00, 0x2a, 0x32, 0x81, 0xc1, 0x05, 0xc5,
+  0xce, 0x00, 0x6a, 0x39, 0x48, 0xae, 0x2e, 0xc5, 0xdf, 0x00, 0x08, 0x2d, 0x88, 0xc7, 0x2e, 0xc7,
+  0x00, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xfe,
+  0x5f, 0x4f, 0xe7, 0x28, 0x01, 0x68, 0x2d, 0xa9, 0x31, 0x41, 0x68, 0x2d, 0xcc, 0x02, 0x00, 0x2a,
+  0x32, 0x81, 0x00, 0x2a, 0x32, 0x41, 0xa9, 0x31, 0xc8, 0x05, 0x5f, 0xae, 0x2e, 0x4f, 0x2a, 0x32,
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xfe, 0x5f,
+  0x4f, 0xe7, 0x28, 0x00, 0xa9, 0x31, 0x41, 0x68, 0x2d, 0xcc, 0x02, 0x00, 0x2a, 0x32, 0x41, 0xa9,
+  0x31, 0x00, 0x2a, 0x32, 0x81, 0xc9, 0x05, 0x5f, 0xae, 0x2e, 0x4f, 0x2a, 0x32, 0x01, 0x0e, 0x33,
+  0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xfe, 0x5f, 0x4f, 0xe7, 0x28,
+  0x41, 0x68, 0x2d, 0x00, 0xa9, 0x31, 0xcd, 0x02, 0x80, 0x00, 0x2a, 0x32, 0xc2, 0x02, 0x41, 0xa9,
+  0x31, 0xc7, 0x05, 0x5f, 0xae, 0x2e, 0x4f, 0x2a, 0x32, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01,
+  0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xfe, 0x5f, 0x46, 0xe7, 0x28, 0xc8, 0xa5, 0x01, 0x68,
+  0x2d, 0xa9, 0x31, 0x41, 0x68, 0x2d, 0xc1, 0x02, 0x80, 0xc8, 0xb6, 0x80, 0x00, 0x2a, 0x32, 0x41,
+  0xa9, 0x31, 0xc1, 0x02, 0xc9, 0x1f, 0x46, 0xae, 0x2e, 0x00, 0x6a, 0x39, 0xc7, 0xd6, 0x86, 0x00,
+  0x08, 0x2d, 0xc7, 0xe7, 0x46, 0x2a, 0x32, 0xc8, 0x50, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01,
+  0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xcd, 0x5f, 0x00, 0x08, 0x2d, 0xce, 0x0e, 0x00, 0x8a,
+  0x76, 0xce, 0x0e, 0x00, 0x2b, 0x7f, 0xce, 0x0e, 0x00, 0x49, 0x72, 0xcb, 0x3b, 0x42, 0x2b, 0x7f,
+  0x80, 0xcc, 0x2c, 0xcb, 0x1f, 0xc3, 0x0e, 0x81, 0xc8, 0x3f, 0xc4, 0x0e, 0xc2, 0x21, 0xc9, 0x59,
+  0xc3, 0x1e, 0xc1, 0x21, 0xc8, 0x4a, 0x00, 0x49, 0x72, 0xc2, 0x3d, 0xc2, 0x21, 0x01, 0x0e, 0x33,
+  0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xdf, 0x1f, 0x49, 0xe7, 0x28, 0xc4, 0x49,
+  0x02, 0x08, 0x2d, 0x8a, 0x76, 0x49, 0x72, 0xc1, 0x01, 0xc5, 0x00, 0xc4, 0x10, 0x4a, 0x8a, 0x76,
+  0xc2, 0x10, 0x02, 0x08, 0x2d, 0xe7, 0x28, 0x2b, 0x7f, 0x80, 0xc2, 0x01, 0xc5, 0x00, 0xc1, 0x29,
+  0x00, 0x08, 0x2d, 0x41, 0x93, 0x5a, 0xc1, 0x2d, 0x88, 0xc1, 0x38, 0x00, 0xe7, 0x28, 0x80, 0x00,
+  0x6a, 0x39, 0x8b, 0xc1, 0x41, 0x01, 0x31, 0x56, 0x08, 0x2d, 0x81, 0xc9, 0x3f, 0x82, 0x00, 0x31,
+  0x56, 0xcd, 0x3f, 0x41, 0xad, 0x41, 0xc1, 0x5f, 0xca, 0x3f, 0x8e, 0xc2, 0x50, 0x00, 0xe7, 0x28,
+  0xcb, 0x7f, 0xc2, 0x92, 0x00, 0xad, 0x41, 0xcc, 0x7f, 0x82, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd,
+  0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xfe, 0x1f, 0x42, 0xe7, 0x28, 0x00, 0x08, 0x2d, 0xcb, 0x63,
+  0x00, 0x93, 0x5a, 0x41, 0x31, 0x56, 0x00, 0xad, 0x41, 0xcb, 0x10, 0x42, 0x6a, 0x39, 0x80, 0x00,
+  0xe7, 0x28, 0xca, 0x83, 0x42, 0x08, 0x2d, 0x81, 0xca, 0x94, 0x42, 0x31, 0x56, 0xcc, 0x1f, 0xc1,
+  0x3d, 0x01, 0xad, 0x41, 0x6a, 0x39, 0xcb, 0x50, 0x84, 0xca, 0xc3, 0x43, 0xe7, 0x28, 0xcb, 0xd2,
+  0x00, 0x31, 0x56, 0xc1, 0x60, 0xcc, 0x10, 0x83, 0x00, 0x49, 0x72, 0xca, 0x70, 0x01, 0x0e, 0x33,
+  0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f, 0xc9, 0x9f, 0x42,
+  0x6a, 0x39, 0xcc, 0x9f, 0x80, 0x41, 0x2a, 0x32, 0xc1, 0x10, 0xc8, 0x0c, 0xc2, 0x1d, 0x80, 0x00,
+  0x13, 0x23, 0xc1, 0x10, 0xc5, 0x0a, 0xc3, 0x1b, 0xc1, 0x0d, 0x41, 0x57, 0x23, 0x00, 0x13, 0x23,
+  0xc2, 0x31, 0xc1, 0x37, 0xc2, 0x27, 0x80, 0x43, 0x13, 0x23, 0x81, 0x01, 0x57, 0x23, 0x2a, 0x32,
+  0xc4, 0x37, 0xc1, 0x17, 0xc1, 0x29, 0xc2, 0x0c, 0xc3, 0x20, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd,
+  0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xff, 0x5f, 0xc3, 0x9f, 0x41, 0x6a, 0x39, 0xcb,
+  0x9f, 0xc1, 0x0d, 0x00, 0x2a, 0x32, 0x80, 0xc1, 0xb6, 0x41, 0x08, 0x2d, 0xc6, 0x9f, 0xc1, 0x0d,
+  0x01, 0x2a, 0x32, 0x13, 0x23, 0xc1, 0x10, 0x00, 0x08, 0x2d, 0xc1, 0x05, 0xc4, 0x10, 0xc2, 0x1c,
+  0x41, 0x13, 0x23, 0x01, 0x57, 0x23, 0xa9, 0x31, 0xc3, 0x13, 0x80, 0xc3, 0xda, 0x43, 0x13, 0x23,
+  0x41, 0x57, 0x23, 0xc3, 0x02, 0x42, 0x08, 0x2d, 0xc2, 0xeb, 0x42, 0x57, 0x23, 0x82, 0xc3, 0x05,
+  0xc2, 0x20, 0xc2, 0xfc, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc2, 0x01, 0x03, 0xe7, 0x28, 0x2b, 0x29,
+  0xaf, 0x31, 0x13, 0x3a, 0x44, 0x54, 0x3e, 0x01, 0x13, 0x3a, 0xaf, 0x31, 0xc3, 0x0e, 0x00, 0x2f,
+  0x37, 0x81, 0xc1, 0x00, 0xc1, 0x11, 0xc1, 0x00, 0x42, 0xaf, 0x31, 0xc5, 0x1f, 0x00, 0xaf, 0x31,
+  0xc4, 0x10, 0xc2, 0x0e, 0x00, 0xe7, 0x28, 0xc8, 0x1f, 0xc2, 0x21, 0xc1, 0x25, 0x01, 0xe7, 0x28,
+  0x13, 0x3a, 0xc9, 0x1f, 0x82, 0xc2, 0x47, 0xc5, 0x3f, 0x84, 0xc2, 0x1e, 0xc1, 0x47, 0xc3, 0x5f,
+  0x00, 0xad, 0x2e, 0x80, 0xc5, 0x30, 0x83, 0xc3, 0x0e, 0xc1, 0x00, 0x80, 0xc1, 0x12, 0x81, 0xc4,
+  0x16, 0xc4, 0x7f, 0xc5, 0x11, 0x82, 0xc1, 0x67, 0xc4, 0x7f, 0xc4, 0x23, 0xc3, 0x26, 0x81, 0xc5,
+  0x0e, 0xc6, 0x14, 0xc5, 0x3f, 0xcb, 0x10, 0x00, 0xad, 0x2e, 0xcb, 0x1f, 0xc3, 0x5a, 0xcc, 0x1f,
+  0xc2, 0x7a, 0xcd, 0x1f, 0xc1, 0xed, 0xce, 0x1f, 0x00, 0x0e, 0x33, 0x42, 0xaf, 0x31, 0x02, 0xe7,
+  0x28, 0x0e, 0x33, 0x2f, 0x37, 0xc9, 0x01, 0x00, 0x2b, 0x29, 0x41, 0xe7, 0x28, 0x44, 0x08, 0x2d,
+  0xc7, 0x12, 0x01, 0xe7, 0x28, 0x13, 0x3a, 0x44, 0x54, 0x3e, 0x00, 0x13, 0x3a, 0xc7, 0x10, 0xc2,
+  0x0d, 0x42, 0x96, 0x3e, 0x41, 0xf9, 0x4a, 0xc7, 0x10, 0xc3, 0x1d, 0xc4, 0x10, 0x80, 0xc5, 0x45,
+  0xc4, 0x2e, 0x43, 0x96, 0x3e, 0x00, 0xe7, 0x28, 0xc5, 0x54, 0x00, 0xaf, 0x31, 0xc6, 0x3f, 0x00,
+  0x13, 0x3a, 0xc6, 0x65, 0x00, 0x2b, 0x29, 0x45, 0x13, 0x3a, 0xc2, 0x75, 0xc5, 0x74, 0x80, 0xc1,
+  0x10, 0x45, 0xaf, 0x31, 0xc7, 0x1f, 0x80, 0x00, 0xaf, 0x31, 0xc1, 0x01, 0x84, 0xc7, 0x1f, 0xc1,
+  0x91, 0x83, 0x00, 0xad, 0x2e, 0x80, 0x00, 0xad, 0x2e, 0xc6, 0x1f, 0x81, 0xc1, 0x22, 0xc1, 0xa4,
+  0x80, 0xc5, 0x0e, 0xc1, 0x9f, 0xc2, 0x00, 0xc2, 0x1b, 0xc7, 0x0e, 0x00, 0x2f, 0x37, 0x45, 0xad,
+  0x2e, 0xc9, 0xd0, 0xcb, 0xdb, 0xc3, 0xe7, 0xce, 0x0e, 0x00, 0x0e, 0x33, 0x01, 0x0e, 0x33, 0x2f,
+  0x37, 0xc6, 0x01, 0x00, 0x08, 0x2d, 0x41, 0x7f, 0x21, 0x03, 0xdb, 0x18, 0x7f, 0x21, 0xfc, 0x1c,
+  0x7f, 0x21, 0xc8, 0x0e, 0xc1, 0x0a, 0x41, 0xdb, 0x18, 0x42, 0x7f, 0x21, 0xcb, 0x0e, 0xc9, 0x1f,
+  0xc7, 0x0e, 0x81, 0xc5, 0x3f, 0xc1, 0x3c, 0xc5, 0x0e, 0xc8, 0x1f, 0xc7, 0x0e, 0x00, 0xdb, 0x18,
+  0xc6, 0x1f, 0xc3, 0x4b, 0xc3, 0x0e, 0x80, 0xc7, 0x1f, 0xc2, 0x6a, 0xc1, 0x6c, 0x82, 0xc7, 0x3f,
+  0xc2, 0x4a, 0xc2, 0x7d, 0xc1, 0x81, 0xc7, 0x7d, 0x82, 0xc3, 0x12, 0xc7, 0x5f, 0xc4, 0x0e, 0xc3,
+  0x32, 0xc8, 0x9d, 0xc5, 0x21, 0x00, 0xb3, 0x14, 0xc9, 0x3f, 0xc4, 0x0e, 0x00, 0xfc, 0x1c, 0xcc,
+  0x3f, 0xc1, 0x0e, 0xc7, 0x7f, 0xc4, 0x5e, 0xc2, 0x0e, 0xc7, 0x7f, 0xc3, 0x6a, 0xc3, 0x0e, 0x00,
+  0xe7, 0x28, 0x42, 0xfc, 0x1c, 0x00, 0x7f, 0x21, 0xc3, 0x01, 0xc5, 0x00, 0x01, 0xfc, 0x1c, 0xdb,
+  0x18, 0xc3, 0x0e, 0x89, 0xc5, 0x0e, 0x8a, 0x00, 0xdb, 0x18, 0xc2, 0x23, 0xca, 0x00, 0x81, 0xc1,
+  0x10, 0xcd, 0x3f, 0xc4, 0x20, 0xca, 0x3f, 0xc2, 0x1f, 0x80, 0x01, 0xb5, 0x14, 0xdb, 0x18, 0xc1,
+  0x01, 0xc1, 0x02, 0xc3, 0x00, 0xc3, 0x2e, 0x80, 0x00, 0xb3, 0x14, 0xc9, 0x6f, 0xc1, 0x19, 0xc3,
+  0x0e, 0xca, 0x4f, 0x00, 0xb5, 0x14, 0xc2, 0x1d, 0x4a, 0xdb, 0x18, 0xc1, 0x39, 0xc3, 0x0e, 0x49,
+  0xe7, 0x28, 0x00, 0xb3, 0x14, 0xc1, 0x1f, 0xc2, 0x0e, 0x00, 0x75, 0x21, 0x47, 0xd6, 0x25, 0x00,
+  0x75, 0x21, 0xc1, 0x10, 0xc2, 0x1d, 0xc2, 0x0d, 0x02, 0x38, 0x2e, 0xe7, 0x28, 0x38, 0x2e, 0x80,
+  0xc2, 0x02, 0xc1, 0x17, 0x00, 0xe7, 0x28, 0xc2, 0x0e, 0xc1, 0x0a, 0x00, 0x38, 0x2e, 0x41, 0x08,
+  0x2d, 0x81, 0xc3, 0x03, 0xc2, 0x15, 0xc1, 0x1b, 0x01, 0x1d, 0x3f, 0x38, 0x2e, 0x42, 0x6a, 0x39,
+  0x81, 0xc2, 0x04, 0x80, 0xc1, 0x0a, 0x01, 0xb6, 0x25, 0x18, 0x2e, 0x41, 0xbc, 0x3a, 0x44, 0x38,
+  0x2e, 0xc1, 0x33, 0xc2, 0x03, 0xc1, 0x0b, 0x41, 0xdb, 0x18, 0x00, 0xfc, 0x1c, 0x42, 0xdb, 0x18,
+  0xc1, 0x03, 0x02, 0xe7, 0x28, 0x2f, 0x37, 0x0e, 0x33, 0xc4, 0x01, 0x82, 0xcc, 0x10, 0xc1, 0x1d,
+  0xc3, 0x01, 0xc9, 0x21, 0x42, 0xfc, 0x1c, 0xc4, 0x32, 0xc2, 0x25, 0xc4, 0x32, 0xc7, 0x1d, 0xc2,
+  0x27, 0x00, 0xb5, 0x14, 0x43, 0xe7, 0x28, 0xc7, 0x1d, 0xc3, 0x55, 0xc3, 0x02, 0xc8, 0x1d, 0xc4,
+  0x14, 0xc2, 0x5b, 0xc4, 0x6e, 0xc5, 0x43, 0xcb, 0x21, 0xc7, 0x10, 0x00, 0xb5, 0x14, 0xc7, 0x7f,
+  0xc2, 0x98, 0x43, 0x7f, 0x21, 0xc1, 0x10, 0xc7, 0x7f, 0xc5, 0x40, 0xc1, 0x1f, 0xc1, 0x21, 0xc6,
+  0x7f, 0x84, 0x00, 0xb3, 0x14, 0xc6, 0x10, 0xc3, 0x95, 0xc3, 0x2f, 0x00, 0xe7, 0x28, 0xc6, 0x10,
+  0xc7, 0x2f, 0x00, 0xd6, 0x25, 0xc7, 0x10, 0x86, 0x01, 0x18, 0x2e, 0xb6, 0x25, 0xc9, 0x10, 0x83,
+  0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xde, 0x1f, 0x48, 0xe7,
+  0x28, 0xc6, 0x47, 0x47, 0xdb, 0x18, 0x00, 0x08, 0x2d, 0xc6, 0x58, 0x47, 0xfc, 0x1c, 0x80, 0xd6,
+  0x1f, 0x88, 0xc6, 0x87, 0x47, 0x7f, 0x21, 0xd7, 0x3f, 0x88, 0xc6, 0xb8, 0xc8, 0x2f, 0xd6, 0x1f,
+  0xdf, 0x3f, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc3, 0x01, 0x00, 0xe7, 0x28, 0x48, 0x2a, 0x32, 0xc4,
+  0x0e, 0xc2, 0x10, 0x00, 0xae, 0x2e, 0x41, 0xa9, 0x31, 0x00, 0xae, 0x2e, 0x41, 0x68, 0x2d, 0xc1,
+  0x05, 0xc5, 0x1f, 0x01, 0x0e, 0x33, 0x08, 0x2d, 0x80, 0xc1, 0x21, 0xc3, 0x12, 0xc7, 0x1f, 0x88,
+  0xc6, 0x1f, 0x00, 0x6a, 0x39, 0xce, 0x1f, 0x88, 0xcb, 0x1f, 0xc2, 0x4f, 0xcc, 0x1f, 0x83, 0xeb,
+  0x1f, 0xc2, 0x92, 0x00, 0xa9, 0x31, 0xce, 0x5f, 0xc7, 0x9f, 0xe7, 0x1f, 0xd0, 0xbf, 0x4f, 0x2a,
+  0x32, 0x01, 0xa9, 0x31, 0xae, 0x2e, 0x41, 0x68, 0x2d, 0x00, 0xae, 0x2e, 0x41, 0xa9, 0x31, 0xc8,
+  0x05, 0x00, 0x2a, 0x32, 0xc3, 0x0c, 0xc1, 0x24, 0xc8, 0x05, 0x8d, 0xc2, 0x3d, 0xa3, 0xc5, 0x02,
+  0x92, 0xc6, 0x4f, 0x99, 0x00, 0x68, 0x2d, 0xc7, 0x39, 0xc2, 0x95, 0x83, 0xc2, 0x9f, 0x8b, 0xc1,
+  0x9e, 0x8c, 0xc1, 0x9d, 0x8d, 0xc1, 0xbd, 0xcc, 0xbf, 0xc1, 0xbc, 0x01, 0x68, 0x2d, 0xe7, 0x28,
+  0x8c, 0xc1, 0x0e, 0x00, 0x75, 0x21, 0x4f, 0x2a, 0x32, 0x00, 0xae, 0x2e, 0x41, 0xa9, 0x31, 0x00,
+  0xae, 0x2e, 0x41, 0x68, 0x2d, 0xc9, 0x05, 0x80, 0xc5, 0x12, 0xc8, 0x05, 0x90, 0xc1, 0x2f, 0x00,
+  0x2a, 0x32, 0xc8, 0x02, 0x83, 0xc1, 0x3b, 0xc8, 0x00, 0x00, 0x68, 0x2d, 0xc3, 0x4e, 0xc2, 0x32,
+  0x87, 0xc2, 0x2a, 0xc2, 0x13, 0x8a, 0xc2, 0x0c, 0xc3, 0x52, 0xc9, 0x1f, 0xc5, 0x62, 0x89, 0xc1,
+  0x88, 0x81, 0xc1, 0x25, 0xc6, 0x00, 0x44, 0xa9, 0x31, 0x80, 0x00, 0x68, 0x2d, 0x49, 0xe7, 0x28,
+  0xc2, 0x11, 0xc1, 0xaa, 0x00, 0xe7, 0x28, 0x49, 0x75, 0x21, 0xc3, 0x10, 0xca, 0x0e, 0xc4, 0x10,
+  0x01, 0x75, 0x21, 0x18, 0x2e, 0x89, 0xc1, 0x0a, 0xc1, 0x32, 0x4d, 0x18, 0x2e, 0xc1, 0x32, 0x4f,
+  0x2a, 0x32, 0x41, 0xa9, 0x31, 0x00, 0xae, 0x2e, 0x41, 0x68, 0x2d, 0x00, 0xae, 0x2e, 0xc9, 0x05,
+  0xc1, 0x1f, 0xc3, 0x0c, 0xc9, 0x05, 0x8f, 0xc2, 0x2f, 0x9f, 0xc2, 0x4f, 0x85, 0xc4, 0x2b, 0x8e,
+  0xc2, 0x5f, 0x9f, 0xc7, 0x39, 0xc3, 0x85, 0xc6, 0x8f, 0x89, 0xc1, 0x90, 0x8d, 0xc1, 0xb0, 0xce,
+  0x1f, 0xce, 0x9f, 0xc1, 0x30, 0x8d, 0x46, 0x2a, 0x32, 0x02, 0xe7, 0x28, 0x0e, 0x33, 0x2f, 0x37,
+  0xc5, 0x01, 0x01, 0x68, 0x2d, 0xae, 0x2e, 0x41, 0xa9, 0x31, 0xc1, 0x02, 0xc8, 0x0e, 0x00, 0x0e,
+  0x33, 0xc1, 0x0c, 0xc1, 0x21, 0x81, 0x00, 0x08, 0x2d, 0xc7, 0x0e, 0x00, 0x2f, 0x37, 0x86, 0xce,
+  0x1f, 0x00, 0x6a, 0x39, 0xce, 0x1f, 0x80, 0xff, 0x1f, 0xc8, 0x7f, 0xc1, 0x8f, 0xcd, 0x5f, 0x86,
+  0xe8, 0x1f, 0xd5, 0x9f, 0xc9, 0xbf, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc2, 0x01, 0x02, 0x08, 0x2d,
+  0x8a, 0x76, 0x2b, 0x7f, 0x41, 0x49, 0x72, 0x42, 0x2b, 0x7f, 0x41, 0x8a, 0x76, 0x00, 0x2b, 0x7f,
+  0xc8, 0x0e, 0x81, 0xc1, 0x14, 0xc2, 0x01, 0xca, 0x0e, 0x81, 0xc2, 0x21, 0xc2, 0x2e, 0x80, 0xc6,
+  0x0e, 0xc2, 0x34, 0xc5, 0x1f, 0xc8, 0x0e, 0xc2, 0x43, 0xc3, 0x1f, 0xc3, 0x4b, 0xc4, 0x0e, 0xc7,
+  0x1f, 0xc4, 0x4a, 0xc3, 0x62, 0xc1, 0x60, 0xc4, 0x3f, 0xc3, 0x4a, 0xc4, 0x3d, 0x80, 0x00, 0xa8,
+  0x61, 0xc4, 0x7d, 0x82, 0xc5, 0x5d, 0x00, 0xa8, 0x61, 0xc4, 0x5f, 0xc4, 0x0e, 0xc3, 0x7d, 0xc1,
+  0x0e, 0x00, 0x49, 0x72, 0xc5, 0x9d, 0xc5, 0x21, 0xc2, 0x0e, 0x80, 0xc6, 0x3f, 0xc7, 0x0e, 0x00,
+  0xe7, 0x28, 0xc9, 0x3f, 0xc4, 0x0e, 0x00, 0xd6, 0x25, 0xc6, 0x3f, 0xc3, 0x4a, 0xc3, 0x0e, 0x00,
+  0x38, 0x2e, 0xc6, 0xdd, 0xc3, 0x4a, 0xc3, 0x0e, 0x00, 0xfc, 0x3a, 0xc6, 0xbf, 0xc7, 0x0e, 0x80,
+  0x41, 0x8a, 0x76, 0x00, 0x2b, 0x7f, 0xc1, 0x01, 0xc5, 0x00, 0x04, 0x49, 0x72, 0x8a, 0x76, 0x49,
+  0x72, 0xe7, 0x28, 0xad, 0x41, 0x8b, 0xc1, 0x10, 0x00, 0xa8, 0x61, 0x82, 0xc8, 0x01, 0x82, 0xc1,
+  0x10, 0xc2, 0x2d, 0xc7, 0x2f, 0xc1, 0x2e, 0xc2, 0x01, 0xcc, 0x3f, 0xc3, 0x22, 0x01, 0xa8, 0x61,
+  0x08, 0x6e, 0xc1, 0x01, 0xc1, 0x02, 0xc3, 0x00, 0xc2, 0x3f, 0x81, 0x00, 0xa8, 0x61, 0xc9, 0x5f,
+  0xc4, 0x10, 0xcb, 0x4f, 0xc5, 0x21, 0xc8, 0x01, 0xc1, 0x30, 0xc1, 0x32, 0xc2, 0x82, 0xc8, 0x00,
+  0xc2, 0x41, 0xc1, 0x3d, 0x01, 0xe7, 0x28, 0x75, 0x21, 0x47, 0xd6, 0x25, 0x00, 0x75, 0x21, 0xc4,
+  0x10, 0xc2, 0x0d, 0x02, 0x38, 0x2e, 0xe7, 0x28, 0x38, 0x2e, 0x80, 0xc2, 0x02, 0xc1, 0x17, 0xc3,
+  0x21, 0xc1, 0x0a, 0x00, 0x38, 0x2e, 0x41, 0x08, 0x2d, 0x81, 0xc3, 0x03, 0xc2, 0x15, 0xc1, 0x77,
+  0x01, 0x1d, 0x3f, 0x38, 0x2e, 0x42, 0x6a, 0x39, 0x81, 0xc2, 0x04, 0x80, 0xc1, 0x0a, 0xc2, 0x21,
+  0x00, 0xfc, 0x3a, 0x44, 0x38, 0x2e, 0xc1, 0x33, 0xc2, 0x03, 0x41, 0xfc, 0x3a, 0xc2, 0x37, 0x81,
+  0x00, 0x6a, 0x39, 0xc5, 0x2f, 0xc1, 0x1f, 0x81, 0xc2, 0x10, 0x00, 0x31, 0x56, 0x41, 0x6a, 0x39,
+  0x05, 0xe7, 0x28, 0x8a, 0x76, 0x49, 0x72, 0xe7, 0x28, 0x2f, 0x37, 0x0e, 0x33, 0xc6, 0x01, 0x83,
+  0x00, 0x49, 0x72, 0xca, 0x10, 0x42, 0x6a, 0x39, 0x82, 0xc9, 0x21, 0x00, 0xa8, 0x61, 0x41, 0x08,
+  0x2d, 0xc3, 0x1f, 0x00, 0x8a, 0x76, 0x80, 0xc6, 0x30, 0x00, 0x8a, 0x76, 0x42, 0xa8, 0x61, 0xc2,
+  0x1e, 0xc8, 0x41, 0xc3, 0x1b, 0xc2, 0x3f, 0x81, 0xc6, 0x50, 0xc1, 0x19, 0xc3, 0x1d, 0xc9, 0x61,
+  0x81, 0xc3, 0x1d, 0xca, 0x3f, 0xc6, 0x10, 0xca, 0x3f, 0xc4, 0x21, 0xca, 0x3f, 0xc4, 0x42, 0xc8,
+  0x7f, 0xc3, 0x4c, 0xca, 0x7f, 0x00, 0x49, 0x72, 0xc3, 0x10, 0xca, 0x7f, 0xc1, 0x1f, 0xc4, 0x21,
+  0xc8, 0x7f, 0xc1, 0x9e, 0xc5, 0x10, 0xc7, 0xe1, 0x00, 0xe7, 0x28, 0xc6, 0x10, 0xc7, 0xbf, 0x01,
+  0x0e, 0x33, 0x2f, 0x37, 0xc1, 0x01, 0x01, 0x6a, 0x39, 0xa9, 0x31, 0x42, 0x13, 0x23, 0x42, 0x57,
+  0x23, 0xc1, 0x03, 0xc1, 0x05, 0xc1, 0x0e, 0x41, 0x08, 0x2d, 0x41, 0xa9, 0x31, 0xc4, 0x0e, 0xc2,
+  0x10, 0x81, 0xc1, 0x0e, 0x43, 0x2a, 0x32, 0xc4, 0x1d, 0xc3, 0x23, 0x00, 0x13, 0x23, 0xc5, 0x0e,
+  0xc1, 0x10, 0xc2, 0x31, 0x00, 0x2a, 0x32, 0xc3, 0x32, 0x00, 0xa9, 0x31, 0xc1, 0x2e, 0x81, 0x00,
+  0xa9, 0x31, 0x44, 0x2a, 0x32, 0xc2, 0x3e, 0xc1, 0x18, 0xc2, 0x3f, 0xc1, 0x1d, 0xc1, 0x10, 0x00,
+  0x57, 0x23, 0xc1, 0x13, 0xc3, 0x54, 0xc1, 0x19, 0xc1, 0x5f, 0xc3, 0x40, 0xc2, 0x27, 0xc2, 0x25,
+  0xc2, 0x00, 0xc1, 0x1f, 0x00, 0x08, 0x2d, 0x41, 0x68, 0x2d, 0xc3, 0x5f, 0xc2, 0x3c, 0xc4, 0x34,
+  0xc3, 0x5e, 0xc2, 0x10, 0xc2, 0x4b, 0xc2, 0x22, 0xc2, 0x21, 0xc1, 0x7c, 0xc3, 0x35, 0xc2, 0x51,
+  0xc3, 0x0e, 0xc2, 0x7a, 0x01, 0xa9, 0x31, 0xe7, 0x28, 0xc2, 0x0a, 0xc5, 0x11, 0xc2, 0x86, 0xc1,
+  0xa7, 0xc1, 0xae, 0xc5, 0x10, 0x00, 0x68, 0x2d, 0xc4, 0x0e, 0xc1, 0xb4, 0xc1, 0xbf, 0x80, 0xc3,
+  0x8c, 0xc4, 0x43, 0xc3, 0xa6, 0xc1, 0x0e, 0xc1, 0xcc, 0xc4, 0x48, 0xc1, 0x65, 0xc3, 0x42, 0x00,
+  0x13, 0x23, 0xc3, 0x2e, 0xc3, 0x71, 0xc3, 0x10, 0xc3, 0x22, 0x00, 0x2f, 0x37, 0xc1, 0x50, 0xc4,
+  0x2a, 0xc4, 0x8d, 0xc2, 0x8f, 0x41, 0x57, 0x23, 0x45, 0x13, 0x23, 0xc1, 0x06, 0x41, 0x2a, 0x32,
+  0x03, 0x08, 0x2d, 0x2f, 0x37, 0x0e, 0x33, 0x2f, 0x37, 0xc3, 0x0e, 0xc2, 0x13, 0xc2, 0x15, 0x41,
+  0x08, 0x2d, 0xc2, 0x0e, 0x00, 0x0e, 0x33, 0xc3, 0x0b, 0xc4, 0x03, 0xc1, 0x1f, 0x00, 0x68, 0x2d,
+  0xc3, 0x1f, 0xc4, 0x1e, 0x00, 0x2a, 0x32, 0xc4, 0x23, 0xc1, 0x10, 0x00, 0xe7, 0x28, 0xc1, 0x30,
+  0xc3, 0x0a, 0x42, 0x2a, 0x32, 0xc1, 0x44, 0x43, 0x2a, 0x32, 0x80, 0xc1, 0x3f, 0x82, 0xc1, 0x49,
+  0x00, 0xa9, 0x31, 0x44, 0x2a, 0x32, 0xc1, 0x05, 0xc2, 0x1f, 0x00, 0xa9, 0x31, 0x81, 0xc2, 0x0d,
+  0x42, 0xa9, 0x31, 0x00, 0x68, 0x2d, 0xc2, 0x03, 0xc2, 0x1f, 0xc2, 0x09, 0xc5, 0x1c, 0xc1, 0x18,
+  0xc2, 0x11, 0xc1, 0x30, 0x44, 0xa9, 0x31, 0xc3, 0x3b, 0xc2, 0x41, 0xc2, 0x89, 0x00, 0xe7, 0x28,
+  0xc3, 0x2c, 0x00, 0x68, 0x2d, 0xc4, 0x4e, 0x83, 0xc1, 0x51, 0xc2, 0x06, 0x82, 0xc5, 0x1e, 0xc2,
+  0x60, 0xc2, 0x4e, 0xc3, 0x10, 0xc1, 0x00, 0xc4, 0x73, 0xc2, 0x7f, 0xc2, 0xb7, 0xc2, 0xb9, 0xc3,
+  0x70, 0xc3, 0x78, 0xc1, 0x90, 0xc3, 0x7c, 0xc3, 0x6d, 0xc1, 0x6e, 0xc3, 0x95, 0xc1, 0x71, 0xc3,
+  0x7b, 0x43, 0x68, 0x2d, 0xc4, 0x04, 0xc2, 0xa1, 0xc1, 0x5b, 0xc3, 0x1b, 0xc2, 0x3f, 0xc3, 0xa6,
+  0x42, 0xe7, 0x28, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff,
+  0x1f, 0xe9, 0x5f, 0x44, 0xe7, 0x28, 0xc8, 0x8e, 0xc1, 0x0d, 0x00, 0x2b, 0x29, 0x41, 0xaf, 0x31,
+  0x01, 0x13, 0x3a, 0x54, 0x3e, 0xc8, 0x1b, 0xc4, 0x0d, 0x01, 0x54, 0x3e, 0x96, 0x3e, 0xc6, 0x2a,
+  0xc5, 0x0d, 0xc1, 0x0e, 0x00, 0xf9, 0x4a, 0xca, 0x2c, 0xc3, 0x2e, 0xc5, 0x1f, 0xc1, 0x3a, 0xc3,
+  0x00, 0xc3, 0x20, 0xc5, 0x3f, 0x85, 0x00, 0x2b, 0x29, 0xc2, 0x3e, 0xcb, 0x1f, 0xc4, 0x21, 0x01,
+  0x0e, 0x33, 0x2f, 0x37, 0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xff, 0x1f, 0xde, 0x5f, 0x41,
+  0xe7, 0x28, 0x01, 0x08, 0x2d, 0x6a, 0x39, 0xcb, 0x83, 0x00, 0x96, 0x3e, 0x42, 0xf9, 0x4a, 0x41,
+  0x6a, 0x39, 0xc9, 0x94, 0x80, 0xc3, 0x10, 0xc1, 0x11, 0xc9, 0x1f, 0xc2, 0x00, 0xcb, 0x10, 0xc2,
+  0x1f, 0xc4, 0x11, 0xc7, 0x32, 0x80, 0x41, 0x54, 0x3e, 0xc3, 0x11, 0x80, 0x00, 0x08, 0x2d, 0xc6,
+  0xd8, 0x43, 0x54, 0x3e, 0x41, 0x13, 0x3a, 0x42, 0xaf, 0x31, 0x00, 0xe7, 0x28, 0xc5, 0xe9, 0xc5,
+  0x0c, 0xc2, 0x11, 0x80, 0xc5, 0xf8, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc3, 0x01, 0x01, 0x08, 0x2d,
+  0x7f, 0x21, 0x41, 0xdb, 0x18, 0x01, 0xb3, 0x14, 0xfc, 0x1c, 0xc1, 0x03, 0x01, 0xe7, 0x28, 0xb6,
+  0x25, 0xc4, 0x0e, 0x00, 0x0e, 0x33, 0x80, 0xc6, 0x0e, 0x01, 0xd6, 0x25, 0x38, 0x2e, 0xc3, 0x1f,
+  0x00, 0x6a, 0x39, 0x41, 0x08, 0x2d, 0xc7, 0x0e, 0x00, 0xfc, 0x3a, 0xc3, 0x2e, 0x80, 0x00, 0xfa,
+  0x4e, 0x80, 0xc7, 0x0e, 0x80, 0xc4, 0x1f, 0x81, 0xc5, 0x2c, 0x42, 0x3e, 0x47, 0xc5, 0x1f, 0x43,
+  0xe7, 0x28, 0x01, 0xb6, 0x25, 0x18, 0x2e, 0x43, 0xbc, 0x3a, 0xc5, 0x1f, 0x02, 0xfa, 0x4e, 0x77,
+  0x42, 0x55, 0x21, 0xc5, 0x0e, 0x80, 0xc5, 0x3f, 0x81, 0x01, 0x08, 0x2d, 0xfc, 0x3a, 0x45, 0x3e,
+  0x47, 0xc7, 0x1f, 0x80, 0xc2, 0x4b, 0xc3, 0x01, 0xc8, 0x1f, 0x86, 0xc8, 0x1f, 0xc6, 0x2f, 0xc8,
+  0x3f, 0xc5, 0x4e, 0xc8, 0x5f, 0x87, 0xd4, 0x5f, 0x00, 0xca, 0x26, 0xcd, 0x5f, 0x41, 0xca, 0x26,
+  0x89, 0x00, 0x18, 0x2e, 0x42, 0xbc, 0x3a, 0x01, 0x38, 0x2e, 0x6a, 0x39, 0x41, 0x08, 0x2d, 0x01,
+  0x38, 0x2e, 0xd6, 0x25, 0xc1, 0x03, 0x01, 0x6a, 0x39, 0xd6, 0x25, 0xc1, 0x0c, 0x43, 0x3e, 0x47,
+  0x80, 0x00, 0xad, 0x41, 0x41, 0x6a, 0x39, 0x81, 0xc1, 0x03, 0x00, 0xad, 0x41, 0x80, 0x41, 0x1d,
+  0x3f, 0x44, 0xfc, 0x3a, 0x47, 0xd6, 0x25, 0x52, 0xfc, 0x3a, 0xc1, 0x2f, 0xc1, 0x3c, 0x49, 0xe7,
+  0x28, 0xc1, 0x42, 0x01, 0xbc, 0x3a, 0x6a, 0x39, 0x43, 0x1d, 0x3f, 0xc1, 0x35, 0xc5, 0x38, 0xc2,
+  0x45, 0x00, 0x1d, 0x3f, 0x4d, 0x38, 0x2e, 0xc4, 0x68, 0xc9, 0x2e, 0xc1, 0x75, 0xc1, 0x11, 0x4b,
+  0x35, 0x19, 0xc1, 0x89, 0x84, 0xc5, 0x51, 0x82, 0xc2, 0x98, 0xc1, 0x06, 0x01, 0xb8, 0x25, 0x76,
+  0x1d, 0x45, 0x08, 0x2d, 0x00, 0x76, 0x1d, 0xc3, 0x08, 0x84, 0x45, 0x6a, 0x39, 0x88, 0xc8, 0x00,
+  0xc7, 0x1f, 0xc6, 0x00, 0x8e, 0x01, 0x5f, 0x1f, 0xde, 0x16, 0x8d, 0x41, 0x5d, 0x0e, 0x81, 0x06,
+  0xbc, 0x3a, 0x18, 0x2e, 0xb6, 0x25, 0xe7, 0x28, 0xb3, 0x14, 0xb5, 0x14, 0xdb, 0x18, 0xc1, 0x01,
+  0xc1, 0x00, 0x00, 0xfc, 0x1c, 0x43, 0x7f, 0x21, 0x41, 0x1d, 0x3f, 0x01, 0x38, 0x2e, 0xd6, 0x25,
+  0xc8, 0x10, 0xc2, 0x00, 0x42, 0xfc, 0x3a, 0xc7, 0x10, 0xc3, 0x23, 0x00, 0xdb, 0x18, 0x82, 0xc5,
+  0x10, 0xc6, 0x00, 0x44, 0x1d, 0x3f, 0xc3, 0x32, 0xc6, 0x00, 0x00, 0x6a, 0x39, 0x44, 0xbc, 0x3a,
+  0xc2, 0x54, 0xc6, 0x00, 0x00, 0xd6, 0x25, 0xc7, 0x10, 0x01, 0x55, 0x21, 0xd6, 0x25, 0x45, 0x38,
+  0x2e, 0x01, 0x08, 0x2d, 0x38, 0x2e, 0xc3, 0x32, 0xc1, 0x56, 0x00, 0x08, 0x2d, 0x81, 0xc3, 0x4b,
+  0xc1, 0x6c, 0xc1, 0x16, 0xc3, 0x63, 0xc2, 0x17, 0x00, 0xfc, 0x3a, 0xc3, 0x4b, 0x89, 0x02, 0xb6,
+  0x25, 0x18, 0x2e, 0xbc, 0x3a, 0x41, 0x08, 0x2d, 0xc2, 0x8c, 0xc4, 0x17, 0xc1, 0x84, 0x83, 0x41,
+  0x6a, 0x39, 0x82, 0x41, 0x18, 0x2e, 0xc3, 0x60, 0x00, 0x18, 0x2e, 0xc3, 0x2f, 0x43, 0xd6, 0x25,
+  0x88, 0xc2, 0x4f, 0x01, 0x6a, 0x39, 0xad, 0x41, 0xca, 0x2f, 0x88, 0xd0, 0x5f, 0xc8, 0x4f, 0xc2,
+  0xab, 0x47, 0x7f, 0x21, 0x02, 0x08, 0x2d, 0x2f, 0x37, 0x0e, 0x33, 0xc4, 0x01, 0x47, 0xfc, 0x1c,
+  0x80, 0xc5, 0x0e, 0x00, 0x0e, 0x33, 0x47, 0xdb, 0x18, 0x80, 0x01, 0x08, 0x2d, 0x6a, 0x39, 0xc4,
+  0x21, 0x47, 0xb5, 0x14, 0x01, 0xe7, 0x28, 0xf3, 0x35, 0x80, 0xc4, 0x30, 0x47, 0xb3, 0x14, 0x82,
+  0xc4, 0x41, 0x48, 0xe7, 0x28, 0xc6, 0x1f, 0x45, 0x38, 0x2e, 0x80, 0x41, 0x77, 0x42, 0xc6, 0x1f,
+  0x44, 0xfc, 0x3a, 0x80, 0x00, 0x08, 0x2d, 0x83, 0xc4, 0x70, 0x44, 0x1d, 0x3f, 0x00, 0xfc, 0x3a,
+  0x84, 0xc4, 0x81, 0x00, 0xd6, 0x25, 0xc1, 0x68, 0x41, 0xbc, 0x3a, 0x00, 0x18, 0x2e, 0xc9, 0x1f,
+  0x81, 0x00, 0x6a, 0x39, 0x87, 0xc5, 0x1f, 0xc1, 0x00, 0xc7, 0x2f, 0xc7, 0x1f, 0xc7, 0x4f, 0xc6,
+  0x3f, 0x87, 0x41, 0xca, 0x26, 0xce, 0x5f, 0x80, 0xc3, 0xe1, 0x44, 0xbc, 0x3a, 0xc5, 0x5f, 0xc4,
+  0x1f, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc4, 0x01, 0x01, 0x08, 0x2d, 0xae, 0x2e, 0x41, 0x2a, 0x32,
+  0x00, 0xae, 0x2e, 0x41, 0xa9, 0x31, 0xc1, 0x05, 0xc5, 0x0e, 0x01, 0x2f, 0x37, 0xe7, 0x28, 0x47,
+  0x68, 0x2d, 0xc5, 0x1f, 0x00, 0x6a, 0x39, 0x48, 0xe7, 0x28, 0xc5, 0x2e, 0x80, 0x00, 0xf3, 0x35,
+  0x41, 0x77, 0x42, 0x80, 0x00, 0x75, 0x21, 0x43, 0x18, 0x2e, 0xc6, 0x1f, 0x82, 0x01, 0x08, 0x2d,
+  0x18, 0x2e, 0x43, 0xbc, 0x3a, 0xc9, 0x1f, 0x85, 0xc9, 0x1f, 0x01, 0x6a, 0x39, 0xfc, 0x3a, 0x43,
+  0x3e, 0x47, 0xc9, 0x3f, 0x80, 0x00, 0x38, 0x2e, 0x43, 0xfc, 0x3a, 0xca, 0x1f, 0x84, 0xca, 0x1f,
+  0xc4, 0x2f, 0xca, 0x3f, 0xce, 0x5f, 0x85, 0xf9, 0x5f, 0x00, 0x08, 0x2d, 0xc4, 0x8f, 0x01, 0x2a,
+  0x32, 0xae, 0x2e, 0x41, 0xa9, 0x31, 0x00, 0xae, 0x2e, 0x41, 0x2a, 0x32, 0xc3, 0x05, 0x04, 0xa9,
+  0x31, 0x68, 0x2d, 0xe7, 0x28, 0x75, 0x21, 0x18, 0x2e, 0x4b, 0x68, 0x2d, 0xc2, 0x0e, 0x80, 0x4b,
+  0xe7, 0x28, 0xc1, 0x1d, 0x41, 0xbc, 0x3a, 0x4c, 0x18, 0x2e, 0x4d, 0xbc, 0x3a, 0x80, 0x43, 0x1d,
+  0x3f, 0x8b, 0xc2, 0x1e, 0x00, 0x6a, 0x39, 0x4a, 0x3e, 0x47, 0x00, 0xfc, 0x3a, 0xc2, 0x0e, 0x00,
+  0x1d, 0x3f, 0x41, 0x08, 0x2d, 0x01, 0xd6, 0x25, 0x38, 0x2e, 0xc1, 0x03, 0x44, 0xfc, 0x3a, 0x00,
+  0x38, 0x2e, 0xc1, 0x05, 0x02, 0x08, 0x2d, 0x38, 0x2e, 0x6a, 0x39, 0x82, 0x41, 0x6a, 0x39, 0x89,
+  0x45, 0xd6, 0x25, 0xc5, 0x2f, 0xc7, 0x1f, 0x01, 0xad, 0x41, 0x6a, 0x39, 0xc7, 0x5f, 0x8d, 0xc1,
+  0x8d, 0x81, 0xcd, 0x5f, 0x81, 0x4a, 0xfc, 0x3a, 0x00, 0x38, 0x2e, 0xc3, 0x2f, 0x8b, 0xc3, 0x6f,
+  0xcb, 0x8f, 0x83, 0x4e, 0x18, 0x2e, 0x00, 0x75, 0x21, 0x8e, 0x00, 0x18, 0x2e, 0x5f, 0xbc, 0x3a,
+  0x01, 0x6a, 0x39, 0x08, 0x2d, 0x49, 0xe7, 0x28, 0x01, 0x08, 0x2d, 0x6a, 0x39, 0x45, 0x1d, 0x3f,
+  0x41, 0xfc, 0x3a, 0xc2, 0x02, 0xc2, 0x01, 0x03, 0x38, 0x2e, 0xd6, 0x25, 0x6a, 0x39, 0xbc, 0x3a,
+  0x4d, 0x38, 0x2e, 0xc1, 0x10, 0x00, 0xd6, 0x25, 0x41, 0x08, 0x2d, 0xc9, 0x2e, 0x01, 0xd6, 0x25,
+  0x38, 0x2e, 0xc1, 0x0d, 0x4b, 0x35, 0x19, 0xc1, 0x1d, 0xc1, 0x43, 0x82, 0xc5, 0x51, 0x82, 0x00,
+  0x08, 0x2d, 0x81, 0xc1, 0x06, 0x01, 0xb8, 0x25, 0x76, 0x1d, 0x45, 0x08, 0x2d, 0x00, 0x76, 0x1d,
+  0xc2, 0x08, 0x85, 0x45, 0x6a, 0x39, 0x88, 0xc8, 0x00, 0xc7, 0x1f, 0xc6, 0x00, 0x8e, 0x01, 0x5f,
+  0x1f, 0xde, 0x16, 0x8d, 0x41, 0x5d, 0x0e, 0x83, 0x01, 0xe7, 0x28, 0x68, 0x2d, 0x42, 0xa9, 0x31,
+  0x00, 0xae, 0x2e, 0x41, 0x2a, 0x32, 0x00, 0xae, 0x2e, 0xc6, 0x05, 0x00, 0x75, 0x21, 0xc1, 0x10,
+  0xcc, 0x00, 0x00, 0x18, 0x2e, 0xc1, 0x10, 0xcc, 0x00, 0x00, 0xbc, 0x3a, 0xc1, 0x10, 0xcc, 0x00,
+  0x41, 0x1d, 0x3f, 0x80, 0x4c, 0x18, 0x2e, 0x41, 0xbc, 0x3a, 0x82, 0x4c, 0xbc, 0x3a, 0x00, 0x38,
+  0x2e, 0x41, 0xfc, 0x3a, 0x4a, 0x1d, 0x3f, 0xc1, 0x0b, 0x00, 0x75, 0x21, 0x41, 0x38, 0x2e, 0x42,
+  0xfc, 0x3a, 0x41, 0x08, 0x2d, 0x01, 0x38, 0x2e, 0xd6, 0x25, 0xc1, 0x03, 0xc1, 0x1a, 0xc1, 0x1d,
+  0x85, 0x41, 0x6a, 0x39, 0x82, 0x00, 0x6a, 0x39, 0x83, 0xc5, 0x2f, 0x45, 0xd6, 0x25, 0xc1, 0x5d,
+  0x80, 0xc3, 0x5f, 0xc2, 0x4f, 0x01, 0x6a, 0x39, 0xad, 0x41, 0xc3, 0x1f, 0xc1, 0x5d, 0xc1, 0x60,
+  0x8f, 0xcd, 0x5f, 0xc2, 0x2f, 0xc4, 0x5f, 0xc7, 0x02, 0xc7, 0x5f, 0x89, 0xcd, 0x8f, 0x01, 0xa9,
+  0x31, 0xae, 0x2e, 0x41, 0x2a, 0x32, 0x04, 0xae, 0x2e, 0xa9, 0x31, 0x08, 0x2d, 0x2f, 0x37, 0x0e,
+  0x33, 0xc6, 0x01, 0x45, 0x68, 0x2d, 0x00, 0xe7, 0x28, 0xc7, 0x0e, 0x00, 0x0e, 0x33, 0x46, 0xe7,
+  0x28, 0x00, 0x6a, 0x39, 0xc7, 0x1f, 0x42, 0x75, 0x21, 0x80, 0x41, 0xf3, 0x35, 0x00, 0x92, 0x31,
+  0x80, 0xc7, 0x30, 0x42, 0x18, 0x2e, 0x00, 0x08, 0x2d, 0x83, 0xc7, 0x3f, 0x00, 0xbc, 0x3a, 0x86,
+  0xc7, 0x50, 0x00, 0x1d, 0x3f, 0x41, 0xfc, 0x3a, 0x00, 0x6a, 0x39, 0xcb, 0x1f, 0x00, 0xfc, 0x3a,
+  0x41, 0x38, 0x2e, 0x84, 0xc7, 0x70, 0x87, 0xc7, 0x7f, 0xc7, 0x2f, 0xc7, 0x90, 0xc2, 0x4f, 0xcc,
+  0x3f, 0x87, 0xdc, 0x5f, 0x01, 0x77, 0x42, 0xf3, 0x35, 0xcd, 0x5f, 0x82, 0xca, 0x5f, 0xc1, 0xaf,
+  0xca, 0x1f, 0x03, 0x0e, 0x33, 0x2f, 0x37, 0x0e, 0x33, 0x08, 0x2d, 0x41, 0x49, 0x72, 0x01, 0xa8,
+  0x61, 0x8a, 0x76, 0xc1, 0x03, 0x02, 0xe7, 0x28, 0xd6, 0x25, 0x38, 0x2e, 0x42, 0x3e, 0x47, 0xc1,
+  0x0e, 0x00, 0x2f, 0x37, 0x81, 0xc6, 0x0e, 0x43, 0xfc, 0x3a, 0xc3, 0x1f, 0xca, 0x0e, 0x80, 0xc3,
+  0x1f, 0xc8, 0x2c, 0xc1, 0x2f, 0x00, 0x6a, 0x39, 0xc2, 0x3f, 0x43, 0xe7, 0x28, 0xc6, 0x1d, 0x01,
+  0x6a, 0x39, 0x1d, 0x3f, 0xc2, 0x3f, 0x02, 0x0e, 0x33, 0x6a, 0x39, 0x75, 0x21, 0xc8, 0x0e, 0x00,
+  0x38, 0x2e, 0xc2, 0x5f, 0x00, 0x2f, 0x37, 0x80, 0x01, 0xe7, 0x28, 0xfc, 0x3a, 0x45, 0x3e, 0x47,
+  0x02, 0x08, 0x2d, 0x38, 0x2e, 0xd6, 0x25, 0xc4, 0x1f, 0xc1, 0x07, 0x45, 0xfc, 0x3a, 0x81, 0x00,
+  0x08, 0x2d, 0xc4, 0x1f, 0x8a, 0xc4, 0x3f, 0x01, 0xfa, 0x4e, 0x08, 0x2d, 0xc5, 0x30, 0x81, 0x00,
+  0xe7, 0x28, 0xc4, 0x3f, 0x80, 0x00, 0xe7, 0x28, 0xc5, 0x7c, 0x82, 0xc5, 0x1f, 0x89, 0xc5, 0x1f,
+  0xc9, 0x2f, 0xc5, 0x3f, 0x00, 0x6a, 0x39, 0xce, 0x1f, 0x00, 0x77, 0x42, 0xc5, 0x10, 0xc8, 0x3f,
+  0x80, 0xc5, 0x60, 0x82, 0x02, 0x3e, 0x47, 0x38, 0x2e, 0xad, 0x41, 0x41, 0x6a, 0x39, 0x01, 0x38,
+  0x2e, 0xd6, 0x25, 0xc1, 0x03, 0x01, 0xad, 0x41, 0xd6, 0x25, 0x43, 0x1d, 0x3f, 0x00, 0x38, 0x2e,
+  0x41, 0xfc, 0x3a, 0x47, 0xd6, 0x25, 0x55, 0xfc, 0x3a, 0x00, 0x08, 0x2d, 0x49, 0xe7, 0x28, 0x01,
+  0x08, 0x2d, 0x6a, 0x39, 0x45, 0x1d, 0x3f, 0xc1, 0x32, 0xc2, 0x02, 0xc2, 0x2d, 0xc2, 0x45, 0xc2,
+  0x04, 0xcb, 0x00, 0xc2, 0x10, 0x41, 0x08, 0x2d, 0xc9, 0x2e, 0x03, 0xd6, 0x25, 0x38, 0x2e, 0x08,
+  0x2d, 0x38, 0x2e, 0x4b, 0x35, 0x19, 0xc1, 0x10, 0x00, 0xe7, 0x28, 0x83, 0xc5, 0x51, 0x82, 0x00,
+  0x08, 0x2d, 0x83, 0x01, 0xb8, 0x25, 0x76, 0x1d, 0x45, 0x08, 0x2d, 0x00, 0x76, 0x1d, 0xc2, 0x08,
+  0x85, 0x45, 0x6a, 0x39, 0x88, 0xc8, 0x00, 0xc7, 0x1f, 0xc6, 0x00, 0x8e, 0x01, 0x5f, 0x1f, 0xde,
+  0x16, 0x8d, 0x41, 0x5d, 0x0e, 0xd4, 0x3f, 0x01, 0xd6, 0x25, 0xe7, 0x28, 0x41, 0xa8, 0x61, 0x00,
+  0x49, 0x72, 0xc1, 0x01, 0x03, 0x49, 0x72, 0xe7, 0x28, 0x2f, 0x37, 0x0e, 0x33, 0xc4, 0x01, 0x00,
+  0x38, 0x2e, 0xc6, 0x10, 0x80, 0xc5, 0x0e, 0x01, 0x0e, 0x33, 0xfc, 0x3a, 0xc6, 0x10, 0xc7, 0x1f,
+  0x41, 0x1d, 0x3f, 0xc5, 0x21, 0xc8, 0x1f, 0xc1, 0x00, 0xc2, 0x32, 0xc2, 0x00, 0xc6, 0x3f, 0x82,
+  0xc2, 0x32, 0x01, 0x75, 0x21, 0x08, 0x2d, 0xc6, 0x4e, 0x00, 0x0e, 0x33, 0x43, 0x1d, 0x3f, 0xc1,
+  0x23, 0x00, 0xe7, 0x28, 0x80, 0xc6, 0x4e, 0xc1, 0x5f, 0xc3, 0x30, 0x00, 0x38, 0x2e, 0x41, 0x08,
+  0x2d, 0xc7, 0x1f, 0x87, 0xc7, 0x1f, 0x00, 0xfc, 0x3a, 0xc3, 0x2f, 0x01, 0x08, 0x2d, 0xf3, 0x35,
+  0xcd, 0x1f, 0x00, 0xe7, 0x28, 0x81, 0xcc, 0x3f, 0x82, 0xc7, 0x5f, 0xc7, 0x2f, 0xcc, 0x5f, 0x00,
+  0x6a, 0x39, 0xcc, 0x3f, 0xc2, 0x0e, 0xc9, 0x3f, 0xc3, 0x9f, 0x01, 0x08, 0x2d, 0x77, 0x42, 0xc9,
+  0x5f, 0x04, 0x0e, 0x33, 0x2f, 0x37, 0x0e, 0x33, 0xe7, 0x28, 0x68, 0x2d, 0x41, 0x57, 0x23, 0x01,
+  0x13, 0x23, 0x2a, 0x32, 0x42, 0xa9, 0x31, 0x00, 0x68, 0x2d, 0xc1, 0x01, 0x00, 0x68, 0x2d, 0xc1,
+  0x0e, 0xc2, 0x10, 0x41, 0x13, 0x23, 0xc1, 0x0e, 0x41, 0x2a, 0x32, 0xc2, 0x0d, 0xc1, 0x14, 0xc2,
+  0x1f, 0x00, 0x2f, 0x37, 0x81, 0xc2, 0x1d, 0x44, 0x68, 0x2d, 0xc1, 0x22, 0xc4, 0x1f, 0xc4, 0x2b,
+  0xc5, 0x11, 0xc3, 0x1f, 0xc1, 0x41, 0xc1, 0x42, 0xc2, 0x2e, 0xc4, 0x2f, 0xc3, 0x3f, 0xc3, 0x32,
+  0xc2, 0x4e, 0x00, 0xe7, 0x28, 0x41, 0x2d, 0x15, 0xc1, 0x51, 0xc5, 0x0e, 0xc2, 0x43, 0xc2, 0x00,
+  0x81, 0xc1, 0x10, 0xc6, 0x1f, 0xc4, 0x56, 0x41, 0x7a, 0x2e, 0x41, 0xd5, 0x25, 0xc9, 0x0e, 0xc1,
+  0x87, 0x81, 0x00, 0x1e, 0x3f, 0x80, 0xcb, 0x1f, 0x00, 0xd5, 0x25, 0x41, 0x1e, 0x3f, 0xca, 0x1f,
+  0xc1, 0x2e, 0xc2, 0x0e, 0x00, 0x7a, 0x2e, 0xcb, 0x0e, 0x42, 0x7a, 0x2e, 0x00, 0x1e, 0x3f, 0xc6,
+  0x5f, 0x00, 0xca, 0x26, 0xc4, 0x1d, 0x01, 0xd5, 0x25, 0x2d, 0x15, 0xc7, 0x1f, 0x80, 0x04, 0xca,
+  0x26, 0x0e, 0x33, 0x2d, 0x15, 0xca, 0x26, 0x2d, 0x15, 0xc1, 0x97, 0x80, 0xc6, 0x7f, 0xc5, 0x00,
+  0xc1, 0x14, 0x00, 0xe7, 0x28, 0xca, 0x7f, 0xc4, 0xba, 0x01, 0x68, 0x2d, 0xa9, 0x31, 0x41, 0x68,
+  0x2d, 0x01, 0xa9, 0x31, 0x2a, 0x32, 0x43, 0x13, 0x23, 0x41, 0x2a, 0x32, 0x03, 0xa9, 0x31, 0xe7,
+  0x28, 0x0e, 0x33, 0x2f, 0x37, 0xc2, 0x0d, 0x82, 0xc2, 0x10, 0x01, 0x2a, 0x32, 0x68, 0x2d, 0x81,
+  0xc2, 0x10, 0x83, 0xc1, 0x18, 0x83, 0xc1, 0x1d, 0x00, 0xe7, 0x28, 0x81, 0x00, 0x2f, 0x37, 0xc1,
+  0x13, 0xc1, 0x17, 0x80, 0xc1, 0x08, 0xc2, 0x2c, 0xc2, 0x0c, 0xc1, 0x10, 0xc1, 0x1f, 0x00, 0x2d,
+  0x15, 0xc2, 0x27, 0x81, 0xc4, 0x02, 0xc1, 0x3d, 0xc2, 0x3f, 0x81, 0xc2, 0x36, 0xc1, 0x2a, 0xc1,
+  0x1b, 0xc4, 0x0e, 0xc2, 0x1f, 0xc1, 0x00, 0xc1, 0x35, 0xc4, 0x0a, 0xc4, 0x05, 0x41, 0x7a, 0x2e,
+  0x00, 0xd5, 0x25, 0x81, 0xc9, 0x0e, 0x00, 0x0e, 0x33, 0xc1, 0x0e, 0xc1, 0x10, 0xcd, 0x1f, 0x82,
+  0xca, 0x1f, 0x41, 0xd5, 0x25, 0x01, 0x2d, 0x15, 0x7a, 0x2e, 0xcb, 0x30, 0x00, 0x1e, 0x3f, 0xc2,
+  0x10, 0xcb, 0x41, 0x80, 0x00, 0x1e, 0x3f, 0xc2, 0x50, 0x00, 0xca, 0x26, 0xc2, 0x52, 0xc1, 0x00,
+  0xc4, 0x65, 0x02, 0xca, 0x26, 0x7a, 0x2e, 0xca, 0x26, 0xc1, 0x4f, 0x81, 0xc7, 0x0e, 0x00, 0x0e,
+  0x33, 0x80, 0xc1, 0x01, 0xc3, 0x0c, 0xc3, 0x02, 0xc5, 0x85, 0xcc, 0x0c, 0xc1, 0xb0, 0x01, 0x0e,
+  0x33, 0x2f, 0x37, 0xc2, 0x01, 0x00, 0xe7, 0x28, 0x47, 0x2b, 0x29, 0x41, 0x13, 0x3a, 0xc3, 0x0e,
+  0x00, 0x2f, 0x37, 0x87, 0x00, 0xe7, 0x28, 0x41, 0xaf, 0x31, 0xc4, 0x1f, 0xc1, 0x08, 0x01, 0xe7,
+  0x28, 0x08, 0x2d, 0x42, 0x6a, 0x39, 0x00, 0xaf, 0x31, 0x82, 0xc4, 0x2e, 0x01, 0xe7, 0x28, 0x13,
+  0x3a, 0x44, 0x54, 0x3e, 0xc1, 0x10, 0x00, 0x13, 0x3a, 0xc3, 0x1f, 0xc4, 0x0d, 0x42, 0x96, 0x3e,
+  0x41, 0xf9, 0x4a, 0xc1, 0x21, 0xc2, 0x1f, 0xc1, 0x4c, 0x00, 0xaf, 0x31, 0xc3, 0x1d, 0xc4, 0x10,
+  0x00, 0x08, 0x2d, 0xc2, 0x3f, 0xc2, 0x5c, 0xc4, 0x2e, 0x43, 0x96, 0x3e, 0xc1, 0x50, 0xc4, 0x6c,
+  0xc1, 0x37, 0xc4, 0x3f, 0xc1, 0x6d, 0xc1, 0x57, 0xc5, 0x6c, 0x45, 0x13, 0x3a, 0xc1, 0x6d, 0x81,
+  0x01, 0x2f, 0x37, 0xad, 0x2e, 0xc1, 0x74, 0xc3, 0x88, 0x45, 0xaf, 0x31, 0x80, 0x42, 0xad, 0x2e,
+  0x84, 0xc1, 0x13, 0x86, 0xc2, 0x1f, 0x00, 0xad, 0x2e, 0xc6, 0x9a, 0x80, 0xc1, 0x08, 0x81, 0xc1,
+  0xbf, 0xc1, 0x22, 0x83, 0xc1, 0x14, 0xc2, 0x2c, 0xc2, 0x2e, 0xc2, 0xce, 0xc1, 0x41, 0xc3, 0x09,
+  0xc2, 0x04, 0xc3, 0x00, 0xc3, 0xdf, 0x4b, 0xad, 0x2e, 0xc4, 0xdf, 0xca, 0x03, 0x46, 0xaf, 0x31,
+  0x04, 0x13, 0x3a, 0xaf, 0x31, 0xe7, 0x28, 0x0e, 0x33, 0x2f, 0x37, 0xc3, 0x01, 0xc4, 0x0b, 0x84,
+  0xc4, 0x0e, 0x00, 0x0e, 0x33, 0xc5, 0x1c, 0xcd, 0x1f, 0x00, 0x54, 0x3e, 0xc3, 0x34, 0xc9, 0x1f,
+  0x83, 0x00, 0xad, 0x2e, 0xce, 0x3f, 0xc1, 0x10, 0x80, 0x00, 0xad, 0x2e, 0xc5, 0x3f, 0x42, 0xe7,
+  0x28, 0x42, 0x6a, 0x39, 0x83, 0xc4, 0x5f, 0x01, 0x08, 0x2d, 0x13, 0x3a, 0x41, 0x96, 0x3e, 0x41,
+  0xf9, 0x4a, 0x01, 0x96, 0x3e, 0x6a, 0x39, 0x43, 0xad, 0x2e, 0xc3, 0x70, 0x80, 0xc1, 0x7a, 0xc1,
+  0x4f, 0xc1, 0x00, 0xc1, 0x2d, 0xc5, 0x0e, 0x02, 0x2f, 0x37, 0xe7, 0x28, 0x2b, 0x29, 0xc1, 0x8b,
+  0xc2, 0x32, 0xc1, 0x1e, 0xc5, 0x8e, 0x00, 0x0e, 0x33, 0xc2, 0x47, 0xc3, 0x1b, 0xc7, 0x0e, 0x00,
+  0x2f, 0x37, 0x44, 0xad, 0x2e, 0xc7, 0x0c, 0xc3, 0x1f, 0xc9, 0x0a, 0xc4, 0xbf, 0xce, 0x0e, 0x41,
+  0x0e, 0x33, 0xde, 0x1f, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc1, 0x01, 0x41, 0xca, 0x26, 0x03, 0xfa,
+  0x4e, 0x77, 0x42, 0x08, 0x2d, 0xfc, 0x3a, 0x45, 0x3e, 0x47, 0xc2, 0x0e, 0x00, 0x0e, 0x33, 0xc1,
+  0x0e, 0x82, 0x00, 0x38, 0x2e, 0x45, 0xfc, 0x3a, 0xc3, 0x1f, 0x00, 0x6a, 0x39, 0x82, 0x00, 0xe7,
+  0x28, 0x46, 0x38, 0x2e, 0xc3, 0x1f, 0x84, 0xc6, 0x00, 0xc7, 0x1f, 0xc7, 0x00, 0xc7, 0x1f, 0x87,
+  0xc6, 0x3f, 0xc8, 0x01, 0xc4, 0x3f, 0xc3, 0x2d, 0x00, 0xca, 0x26, 0xca, 0x1f, 0x8a, 0xc4, 0x5f,
+  0x43, 0xf3, 0x35, 0xc1, 0x94, 0x44, 0xf3, 0x35, 0xc3, 0x9f, 0x43, 0x08, 0x2d, 0x43, 0xca, 0x26,
+  0xc3, 0x07, 0xc3, 0x9f, 0xcb, 0x03, 0xce, 0x0e, 0x41, 0x2f, 0x37, 0xee, 0x1f, 0x03, 0x08, 0x2d,
+  0x38, 0x2e, 0xe7, 0x28, 0x35, 0x19, 0x49, 0xb8, 0x25, 0x00, 0x76, 0x1d, 0x41, 0x08, 0x2d, 0x83,
+  0x47, 0x76, 0x1d, 0x83, 0x00, 0xd6, 0x25, 0x8d, 0x00, 0xe7, 0x28, 0x81, 0x4b, 0x08, 0x2d, 0x43,
+  0xe7, 0x28, 0x4b, 0xf3, 0x35, 0x80, 0x4f, 0x77, 0x42, 0x4f, 0xfa, 0x4e, 0x00, 0xf3, 0x35, 0x8f,
+  0xce, 0x30, 0x8f, 0x00, 0x92, 0x31, 0x4e, 0xf3, 0x35, 0x00, 0x6a, 0x39, 0xce, 0x50, 0x90, 0xce,
+  0x80, 0x80, 0xc5, 0x9d, 0x00, 0xca, 0x26, 0xc8, 0x3f, 0x01, 0x08, 0x2d, 0xca, 0x26, 0xc3, 0xbf,
+  0x80, 0xc4, 0x05, 0xc2, 0x0b, 0x01, 0xd6, 0x25, 0xe7, 0x28, 0x41, 0x38, 0x2e, 0x42, 0xfc, 0x3a,
+  0xc1, 0x04, 0x02, 0x08, 0x2d, 0xb6, 0x25, 0x18, 0x2e, 0x43, 0xbc, 0x3a, 0x81, 0x00, 0xd6, 0x25,
+  0x45, 0x38, 0x2e, 0x80, 0xc1, 0x16, 0x43, 0x1d, 0x3f, 0x81, 0x00, 0x75, 0x21, 0x42, 0xd6, 0x25,
+  0x83, 0x45, 0xe7, 0x28, 0x81, 0xc7, 0x00, 0x45, 0xf3, 0x35, 0xc1, 0x15, 0x58, 0x77, 0x42, 0x55,
+  0xfa, 0x4e, 0x00, 0xf3, 0x35, 0xce, 0x2f, 0x89, 0x00, 0xca, 0x26, 0x85, 0x41, 0x92, 0x31, 0xc1,
+  0x59, 0x00, 0xca, 0x26, 0xc3, 0x5c, 0xc4, 0x04, 0xc1, 0x0e, 0x43, 0x08, 0x2d, 0x80, 0x00, 0xca,
+  0x26, 0xc3, 0x03, 0xc2, 0x04, 0x05, 0x08, 0x2d, 0xfa, 0x4e, 0x08, 0x2d, 0x2f, 0x37, 0x0e, 0x33,
+  0x2f, 0x37, 0x43, 0xca, 0x26, 0x00, 0x0e, 0x33, 0xc3, 0x04, 0xc1, 0x0b, 0x81, 0xc1, 0x0e, 0xcb,
+  0x01, 0x00, 0x77, 0x42, 0xc3, 0x1f, 0xca, 0x12, 0x00, 0xf3, 0x35, 0xce, 0x1f, 0xc1, 0x4d, 0xcd,
+  0x1f, 0x44, 0xbc, 0x3a, 0x01, 0x18, 0x2e, 0x08, 0x2d, 0x41, 0x77, 0x42, 0x03, 0xf3, 0x35, 0x6a,
+  0x39, 0x2f, 0x37, 0x0e, 0x33, 0xc2, 0x01, 0x44, 0x1d, 0x3f, 0x01, 0xfc, 0x3a, 0xe7, 0x28, 0x83,
+  0xc3, 0x0e, 0x00, 0x0e, 0x33, 0x46, 0xe7, 0x28, 0xc8, 0x1f, 0x46, 0xf3, 0x35, 0xc8, 0x1f, 0x48,
+  0x77, 0x42, 0xc6, 0x3f, 0x48, 0xfa, 0x4e, 0xc6, 0x3f, 0x8a, 0xc4, 0x5f, 0xc8, 0x2f, 0x00, 0x92,
+  0x31, 0xce, 0x3f, 0x81, 0xc7, 0x5f, 0x00, 0xca, 0x26, 0xc3, 0x63, 0x00, 0xca, 0x26, 0xc6, 0x1f,
+  0x42, 0x08, 0x2d, 0x80, 0x43, 0x08, 0x2d, 0xc2, 0x04, 0xc4, 0x9f, 0xc1, 0xa4, 0x41, 0xca, 0x26,
+  0xc4, 0xa8, 0xc6, 0x03, 0xca, 0x0a, 0xc6, 0x1f, 0xcd, 0x10, 0xdf, 0x1f, 0x01, 0x0e, 0x33, 0x2f,
+  0x37, 0xc3, 0x01, 0x01, 0x6a, 0x39, 0xf3, 0x35, 0x41, 0x77, 0x42, 0x01, 0x08, 0x2d, 0x18, 0x2e,
+  0x43, 0xbc, 0x3a, 0xc4, 0x0e, 0x00, 0x0e, 0x33, 0x83, 0x00, 0xe7, 0x28, 0x44, 0x38, 0x2e, 0xc9,
+  0x1f, 0x45, 0xe7, 0x28, 0xc9, 0x1f, 0x45, 0xf3, 0x35, 0xc9, 0x3f, 0xc5, 0x01, 0xc7, 0x3f, 0x47,
+  0xfa, 0x4e, 0xc7, 0x5f, 0x87, 0xc6, 0x5f, 0x00, 0x92, 0x31, 0xc2, 0x2f, 0x00, 0xca, 0x26, 0xc3,
+  0x33, 0xc6, 0x7f, 0x88, 0xc7, 0x1f, 0xc2, 0x5d, 0x80, 0xc9, 0x5f, 0x44, 0x08, 0x2d, 0x80, 0x00,
+  0xca, 0x26, 0xc2, 0x06, 0xc5, 0x9f, 0xc4, 0xb4, 0x81, 0xc2, 0xbc, 0xc9, 0x0e, 0xc5, 0xc9, 0xce,
+  0x0e, 0xe0, 0x1f, 0x4a, 0xbc, 0x3a, 0x00, 0x18, 0x2e, 0x41, 0x3e, 0x47, 0x00, 0x08, 0x2d, 0x4c,
+  0x38, 0x2e, 0xc1, 0x1b, 0x81, 0x4b, 0xe7, 0x28, 0xc1, 0x1c, 0x80, 0x00, 0xd6, 0x25, 0x4b, 0xf3,
+  0x35, 0xc2, 0x1b, 0x80, 0x4b, 0x77, 0x42, 0xc3, 0x11, 0x44, 0xfa, 0x4e, 0xca, 0x14, 0x4f, 0xfa,
+  0x4e, 0x4d, 0x77, 0x42, 0x00, 0xf3, 0x35, 0x8f, 0x01, 0x77, 0x42, 0xca, 0x26, 0xc5, 0x60, 0xc6,
+  0x06, 0x82, 0x00, 0xca, 0x26, 0x42, 0x08, 0x2d, 0x45, 0xca, 0x26, 0xc2, 0x08, 0x03, 0x92, 0x31,
+  0xf3, 0x35, 0x2f, 0x37, 0x0e, 0x33, 0xcb, 0x01, 0x01, 0x6a, 0x39, 0xfa, 0x4e, 0xcc, 0x0e, 0x00,
+  0x2f, 0x37, 0x81, 0xce, 0x1f, 0x00, 0x77, 0x42, 0xce, 0x1f, 0xcf, 0x3f, 0x00, 0x08, 0x2d, 0x01,
+  0xe7, 0x28, 0x35, 0x19, 0x49, 0xb8, 0x25, 0x02, 0x76, 0x1d, 0x08, 0x2d, 0xd6, 0x25, 0x41, 0xe7,
+  0x28, 0x81, 0x47, 0x76, 0x1d, 0x95, 0x4b, 0x08, 0x2d, 0x00, 0xe7, 0x28, 0x82, 0x4b, 0xf3, 0x35,
+  0x42, 0xe7, 0x28, 0x4f, 0x77, 0x42, 0x5e, 0xfa, 0x4e, 0x00, 0xf3, 0x35, 0xce, 0x2f, 0x90, 0xce,
+  0x00, 0x00, 0x92, 0x31, 0xce, 0x4f, 0x00, 0x08, 0x2d, 0x8f, 0xc2, 0x7f, 0x00, 0xca, 0x26, 0xc7,
+  0x83, 0xc2, 0x08, 0x80, 0xc2, 0x9e, 0x80, 0xc7, 0xa2, 0xc2, 0x08, 0x80, 0x45, 0xca, 0x26, 0xc5,
+  0xc4, 0xc3, 0x07, 0x02, 0x38, 0x2e, 0x1d, 0x3f, 0x75, 0x21, 0x41, 0x18, 0x2e, 0x4a, 0xbc, 0x3a,
+  0x01, 0xd6, 0x25, 0x38, 0x2e, 0x80, 0x00, 0x75, 0x21, 0x4b, 0x38, 0x2e, 0x01, 0x75, 0x21, 0xd6,
+  0x25, 0x4f, 0xe7, 0x28, 0x4f, 0xf3, 0x35, 0x56, 0x77, 0x42, 0x56, 0xfa, 0x4e, 0x5f, 0x77, 0x42,
+  0x41, 0x92, 0x31, 0xc4, 0x5f, 0x00, 0xca, 0x26, 0xc7, 0x65, 0x01, 0x08, 0x2d, 0xca, 0x26, 0x44,
+  0x08, 0x2d, 0xc3, 0x05, 0xc4, 0x09, 0x42, 0xca, 0x26, 0x02, 0x0e, 0x33, 0x2f, 0x37, 0x0e, 0x33,
+  0x46, 0xca, 0x26, 0xc1, 0x09, 0xc3, 0x0c, 0xcc, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xde, 0x1f,
+  0x00, 0xbc, 0x3a, 0x41, 0x18, 0x2e, 0x06, 0x08, 0x2d, 0xf3, 0x35, 0x77, 0x42, 0xf3, 0x35, 0xca,
+  0x26, 0x0e, 0x33, 0x2f, 0x37, 0xc5, 0x01, 0x42, 0x38, 0x2e, 0x00, 0xe7, 0x28, 0x83, 0xc7, 0x10,
+  0x43, 0xe7, 0x28, 0x82, 0x00, 0x6a, 0x39, 0x80, 0xc6, 0x1f, 0x44, 0xf3, 0x35, 0x82, 0xc6, 0x2e,
+  0x00, 0x0e, 0x33, 0x45, 0x77, 0x42, 0x81, 0xc7, 0x3f, 0x45, 0xfa, 0x4e, 0xc9, 0x1f, 0x87, 0xc7,
+  0x5f, 0xc5, 0x2f, 0x00, 0x92, 0x31, 0xc8, 0x3f, 0x00, 0xca, 0x26, 0x86, 0xc7, 0x7f, 0x80, 0xc4,
+  0x60, 0xca, 0x1f, 0x46, 0x08, 0x2d, 0xc8, 0x1f, 0xc7, 0xa8, 0xc6, 0xb0, 0xce, 0x0e, 0x41, 0x2f,
+  0x37, 0xee, 0x1f, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc1, 0x01, 0x04, 0x6a, 0x39, 0xfa, 0x4e, 0x77,
+  0x42, 0xe7, 0x28, 0x38, 0x2e, 0x43, 0xfc, 0x3a, 0x02, 0x08, 0x2d, 0x38, 0x2e, 0xe7, 0x28, 0xc2,
+  0x0e, 0x00, 0x0e, 0x33, 0x84, 0xc3, 0x00, 0x80, 0x00, 0xd6, 0x25, 0x80, 0xc6, 0x1f, 0x00, 0x08,
+  0x2d, 0x45, 0xe7, 0x28, 0x81, 0xc6, 0x1f, 0xc5, 0x00, 0xc2, 0x14, 0xc6, 0x3f, 0xc8, 0x00, 0xc5,
+  0x3f, 0xc9, 0x00, 0xc4, 0x5f, 0xc7, 0x1e, 0x00, 0xf3, 0x35, 0x81, 0xc4, 0x5f, 0x81, 0x00, 0xca,
+  0x26, 0x85, 0xc1, 0x47, 0xc4, 0x7f, 0x41, 0xf3, 0x35, 0x80, 0x00, 0xca, 0x26, 0x44, 0xf3, 0x35,
+  0xc5, 0x3f, 0x42, 0x08, 0x2d, 0x81, 0xc1, 0x02, 0xc1, 0x06, 0x00, 0x92, 0x31, 0xc1, 0x18, 0xc3,
+  0x9f, 0xc1, 0xa3, 0x45, 0xca, 0x26, 0xc3, 0x58, 0xc4, 0x0e, 0xc7, 0x03, 0x82, 0xcb, 0x0e, 0xc3,
+  0x58, 0xcd, 0x1f, 0xc1, 0x57, 0xcd, 0x1f, 0xc1, 0x57, 0xcc, 0x3f, 0xc2, 0xfc, 0x01, 0x35, 0x19,
+  0xb8, 0x25, 0x47, 0x76, 0x1d, 0xc1, 0x08, 0x03, 0x08, 0x2d, 0xd6, 0x25, 0xe7, 0x28, 0xd6, 0x25,
+  0x8e, 0x00, 0x75, 0x21, 0x4b, 0x08, 0x2d, 0xc1, 0x1d, 0x80, 0x00, 0xe7, 0x28, 0x4b, 0x77, 0x42,
+  0x42, 0xe7, 0x28, 0x50, 0x77, 0x42, 0x5d, 0xfa, 0x4e, 0x00, 0xf3, 0x35, 0xce, 0x2f, 0x90, 0xce,
+  0x00, 0x01, 0x92, 0x31, 0x08, 0x2d, 0xcd, 0x4f, 0x01, 0x08, 0x2d, 0x2f, 0x37, 0x8e, 0x00, 0x0e,
+  0x33, 0xcd, 0x80, 0xc1, 0x1f, 0xc4, 0x41, 0x00, 0xca, 0x26, 0xc7, 0x47, 0xc1, 0x1f, 0xc4, 0xbf,
+  0x80, 0x00, 0xca, 0x26, 0xc5, 0xc6, 0xc1, 0x06, 0x41, 0x2f, 0x37, 0x00, 0x0e, 0x33, 0xc1, 0x01,
+  0x43, 0xca, 0x26, 0xc3, 0x07, 0x00, 0x2f, 0x37, 0xc2, 0x05, 0x43, 0x38, 0x2e, 0x05, 0xe7, 0x28,
+  0x77, 0x42, 0xf3, 0x35, 0x08, 0x2d, 0x0e, 0x33, 0x2f, 0x37, 0xc5, 0x01, 0x43, 0xd6, 0x25, 0x83,
+  0xc6, 0x0e, 0x00, 0x0e, 0x33, 0x43, 0xe7, 0x28, 0x00, 0x08, 0x2d, 0xca, 0x1f, 0x45, 0x77, 0x42,
+  0xc9, 0x1f, 0x87, 0xc7, 0x3f, 0x45, 0xfa, 0x4e, 0xcd, 0x1f, 0x02, 0xca, 0x26, 0x77, 0x42, 0x92,
+  0x31, 0xcc, 0x3f, 0x83, 0xc7, 0x5f, 0x42, 0xf3, 0x35, 0x41, 0xca, 0x26, 0x00, 0xf3, 0x35, 0xc9,
+  0x1f, 0x42, 0x08, 0x2d, 0x81, 0xc2, 0x04, 0xc7, 0x7f, 0xc2, 0x97, 0x81, 0x00, 0xca, 0x26, 0xc7,
+  0x9d, 0xc1, 0xa5, 0xc8, 0x08, 0xc9, 0x1f, 0xcc, 0x12, 0xef, 0x1f, 0x01, 0x0e, 0x33, 0x2f, 0x37,
+  0xcd, 0x01, 0xce, 0x0e, 0x41, 0x0e, 0x33, 0xd0, 0x1f, 0x41, 0x08, 0x2d, 0xc7, 0x32, 0xc3, 0x09,
+  0xc1, 0x3f, 0x80, 0x00, 0x38, 0x2e, 0xc1, 0x11, 0x01, 0x0e, 0x33, 0xe7, 0x28, 0xc2, 0x07, 0xc2,
+  0x08, 0xc2, 0x3f, 0x00, 0x08, 0x2d, 0x41, 0xe7, 0x28, 0x07, 0xd6, 0x25, 0x75, 0x21, 0x08, 0x2d,
+  0xd6, 0x25, 0xe7, 0x28, 0x08, 0x2d, 0x75, 0x21, 0xd6, 0x25, 0xc1, 0x29, 0xc1, 0x16, 0xc1, 0x19,
+  0x41, 0x38, 0x2e, 0xc2, 0x12, 0xc1, 0x0c, 0xc1, 0x16, 0xc1, 0x14, 0xc1, 0x15, 0xc3, 0x3f, 0x00,
+  0xd6, 0x25, 0x42, 0x38, 0x2e, 0xc1, 0x25, 0x43, 0xd6, 0x25, 0xc1, 0x0e, 0xc2, 0x5f, 0x00, 0x54,
+  0x4a, 0xc2, 0x26, 0x80, 0xc1, 0x32, 0xc2, 0x20, 0x01, 0xe7, 0x28, 0x54, 0x4a, 0xc4, 0x7f, 0x00,
+  0x54, 0x4a, 0xc1, 0x40, 0x43, 0xe7, 0x28, 0xc1, 0x44, 0xc2, 0x0e, 0xc3, 0x7f, 0xc2, 0x0e, 0xc1,
+  0x0a, 0xc1, 0x25, 0xc1, 0x56, 0xc3, 0x78, 0xc2, 0xae, 0xc1, 0x61, 0x00, 0x54, 0x4a, 0xc3, 0xb4,
+  0xc2, 0x37, 0xd4, 0x9f, 0xdf, 0xbf, 0xcd, 0xf0, 0x01, 0x0e, 0x33, 0x2f, 0x37, 0xc3, 0x01, 0x43,
+  0x08, 0x2d, 0xc5, 0x09, 0xc5, 0x0e, 0x01, 0x3e, 0x47, 0xfc, 0x3a, 0xc1, 0x01, 0xc5, 0x10, 0xc4,
+  0x1d, 0xc2, 0x0d, 0x81, 0xc5, 0x10, 0xc3, 0x2e, 0x87, 0xc8, 0x1f, 0x00, 0x38, 0x2e, 0x43, 0xd6,
+  0x25, 0x00, 0x38, 0x2e, 0xc8, 0x1f, 0x00, 0xe7, 0x28, 0x45, 0xd6, 0x25, 0x00, 0xe7, 0x28, 0xc7,
+  0x3f, 0x81, 0x43, 0xfc, 0x3a, 0x81, 0xc9, 0x1f, 0x43, 0xe7, 0x28, 0xcb, 0x1f, 0xc5, 0x2f, 0xc8,
+  0x3f, 0xc6, 0x00, 0xc7, 0x7f, 0xc4, 0x21, 0xc4, 0x3d, 0xc6, 0x9f, 0xc1, 0x61, 0xc1, 0x71, 0xc4,
+  0x5d, 0xc6, 0x1f, 0x00, 0x54, 0x4a, 0x83, 0x00, 0x54, 0x4a, 0xc8, 0xbf, 0x41, 0x54, 0x4a, 0x84,
+  0xc4, 0x10, 0xc3, 0xdf, 0x81, 0xc1, 0x20, 0xc2, 0x0e, 0x80, 0xc8, 0xdf, 0x45, 0x54, 0x4a, 0xc4,
+  0xfa,
+};
@@ -0,0 +1,1799 @@
+// Art by LimeZu from itch.io (https://limezu.itch.io/serenevillagerevamped)
+// Licensed under CC BY 4.0 (https://creativecommons.org/licenses/by/4.0/)
+
+int tileset_rgb332_count = 112;
+
+const uint8_t __attribute__ ((aligned (4))) tileset_rgb332_data[] = {
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x66, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x73, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0xae, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0xae, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x6b, 0x73, 0x6b, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x73, 0x6b, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0xfd, 0xfd, 0xfd,
+  0x6b, 0x73, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0xfd, 0xfd, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2,
+  0x73, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0xfd, 0xfd, 0xf2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0x6b, 0x66, 0x5d, 0x5d, 0x5d, 0xfd, 0xf2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0x73, 0x66, 0x5d, 0x5d, 0xfd, 0xf2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0x6b, 0x66, 0x5d, 0xfd, 0xf2, 0xa2, 0xa2, 0xa2, 0xa2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0x73, 0x66, 0x5d, 0xf2, 0xa2, 0xa2, 0xa2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0x6b, 0x66, 0xfd, 0xf2, 0xa2, 0xa2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0x73, 0x66, 0xfd, 0xf2, 0xa2, 0xe2, 0xe2, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0xfd, 0xf2, 0xe2, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0xfd, 0xf2, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2,
+  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x73, 0x6b, 0x73, 0x6b,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x73, 0x6b, 0x73,
+  0xfd, 0xfd, 0xfd, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x73, 0x6b,
+  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfd, 0xfd, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x73,
+  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xf2, 0xfd, 0xfd, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x6b,
+  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xf2, 0xfd, 0x5d, 0x5d, 0x5d, 0x66, 0x73,
+  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xf2, 0xfd, 0x5d, 0x5d, 0x66, 0x6b,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xa2, 0xa2, 0xa2, 0xa2, 0xf2, 0xfd, 0x5d, 0x66, 0x73,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xa2, 0xa2, 0xa2, 0xf2, 0x5d, 0x66, 0x6b,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xa2, 0xa2, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe2, 0xa2, 0xf2, 0xfd, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xf2, 0xfd, 0x66, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x62, 0x62, 0x52, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x62, 0x6c, 0x62, 0x52,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x73, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x6c, 0x52,
+  0x6b, 0x73, 0x6b, 0x52, 0x62, 0x62, 0x52, 0x52, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x62,
+  0x73, 0x6b, 0x73, 0x52, 0x62, 0x75, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x62, 0x62, 0x52, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x62, 0x6c, 0x62, 0x52,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x6c, 0x52,
+  0x73, 0x6b, 0x73, 0x52, 0x62, 0x62, 0x52, 0x52, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x62,
+  0x6b, 0x73, 0x6b, 0x52, 0x62, 0x52, 0x52, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0x62, 0x52, 0x6c, 0x6c, 0x52, 0x52, 0x75, 0x6c, 0x75, 0x6c, 0x75,
+  0x6b, 0x73, 0x52, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x52, 0x75, 0x6c, 0x6c, 0x75,
+  0x52, 0x52, 0x62, 0x6c, 0x6c, 0x75, 0x5a, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x6c, 0x75, 0x75, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x52, 0x52, 0x52, 0x75, 0x75, 0x6c,
+  0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x62, 0x52, 0x6c, 0x6c, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x62, 0x52, 0x73, 0x6b, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x52, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x62, 0x6c, 0x6c, 0x75, 0x5a, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b,
+  0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x52, 0x52, 0x52, 0x6b, 0x73,
+  0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x62, 0x52, 0x62, 0x62, 0x52, 0x6b,
+  0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x52, 0x52, 0x52, 0x52, 0x62, 0x6c, 0x62, 0x52,
+  0x75, 0x75, 0x6c, 0x52, 0x52, 0x52, 0x6c, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x6c, 0x52,
+  0x6c, 0x6c, 0x6c, 0x52, 0x62, 0x62, 0x52, 0x52, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x62,
+  0x62, 0x6c, 0x6c, 0x52, 0x62, 0x75, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x62, 0x62, 0x52, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x62, 0x6c, 0x62, 0x52,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x6c, 0x52,
+  0x73, 0x6b, 0x73, 0x52, 0x62, 0x62, 0x52, 0x52, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x62,
+  0x6b, 0x73, 0x6b, 0x52, 0x62, 0x52, 0x52, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0x62, 0x52, 0x6c, 0x6c, 0x52, 0x52, 0x75, 0x6c, 0x75, 0x6c, 0x75,
+  0x6b, 0x73, 0x52, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x52, 0x75, 0x6c, 0x6c, 0x75,
+  0x52, 0x52, 0x62, 0x6c, 0x6c, 0x75, 0x5a, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x6c, 0x75, 0x75, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x52, 0x52, 0x52, 0x75, 0x75, 0x6c,
+  0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x62, 0x52, 0x6c, 0x6c, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x62, 0x52, 0x73, 0x6b, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x52, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x62, 0x6c, 0x6c, 0x75, 0x5a, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b,
+  0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x62, 0x52, 0x73, 0x6b, 0x73,
+  0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x62, 0x62, 0x52, 0x6b, 0x73, 0x6b,
+  0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x6c, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x6b, 0x73, 0x6b,
+  0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x62, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x6b, 0x73,
+  0x62, 0x6c, 0x6c, 0x75, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x62, 0x62, 0x52, 0x73, 0x6b,
+  0x6b, 0x73, 0xfd, 0xff, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0xfd, 0xfd, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0xfd, 0xff, 0x73, 0x6b,
+  0xfd, 0xff, 0x6f, 0xaf, 0xfd, 0xff, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0xfd, 0xfd, 0x6b, 0x73,
+  0xfd, 0xfd, 0x26, 0x6f, 0xfd, 0xfd, 0x73, 0x6b, 0x73, 0x6b, 0xfd, 0xff, 0x6f, 0xaf, 0xfd, 0xff,
+  0x6a, 0x6a, 0xfd, 0xff, 0x6a, 0x6a, 0x6b, 0x73, 0x6b, 0x73, 0xfd, 0xfd, 0x26, 0x6f, 0xfd, 0xfd,
+  0x73, 0x6b, 0xfd, 0xfd, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0xfd, 0xff, 0x6a, 0x6a,
+  0x6b, 0x73, 0x6a, 0x6a, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0xfd, 0xfd, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0xfd, 0xff, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0xfd, 0xfd, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0xfd, 0xff, 0x6b, 0x73, 0x6b,
+  0x6b, 0xfd, 0xff, 0x6f, 0xaf, 0xfd, 0xff, 0x73, 0x6b, 0x73, 0x6b, 0xfd, 0xfd, 0x73, 0x6b, 0x73,
+  0x73, 0xfd, 0xfd, 0x26, 0x6f, 0xfd, 0xfd, 0x6b, 0x73, 0xfd, 0xff, 0x6f, 0xaf, 0xfd, 0xff, 0x6b,
+  0x6b, 0x6a, 0x6a, 0xfd, 0xff, 0x6a, 0x6a, 0x73, 0x6b, 0xfd, 0xfd, 0x26, 0x6f, 0xfd, 0xfd, 0x73,
+  0x73, 0x6b, 0x73, 0xfd, 0xfd, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0xfd, 0xff, 0x6a, 0x6a, 0x6b,
+  0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0xfd, 0xfd, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x14, 0x14, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x6b, 0x6b, 0x6b, 0x14, 0x5d, 0x5d, 0x6b, 0x73, 0x6b,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x14, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x14, 0x14, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x73, 0x6b, 0x66, 0x5d, 0x5d, 0x6b, 0x6b, 0x6b, 0x6b, 0x14, 0x14, 0x14, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x6b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x6b,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b, 0x73,
+  0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0x55, 0x55, 0x52, 0x52, 0x55, 0x55, 0x52, 0x52, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x52, 0xff, 0xaf, 0x52, 0x55, 0x52, 0x52, 0x55, 0x52, 0xaf, 0xff, 0x52, 0x6b, 0x73,
+  0x73, 0x52, 0x55, 0xaf, 0x5e, 0x55, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5e, 0xaf, 0x55, 0x52, 0x6b,
+  0x6b, 0x52, 0x52, 0x55, 0x55, 0x52, 0x52, 0x55, 0x55, 0x55, 0x52, 0x55, 0x55, 0x52, 0x52, 0x73,
+  0x73, 0x52, 0x55, 0x52, 0x52, 0x55, 0x55, 0x5e, 0xaf, 0x5e, 0x55, 0x52, 0x52, 0x55, 0x52, 0x6b,
+  0x6b, 0x73, 0x52, 0x55, 0x52, 0x52, 0x52, 0xaf, 0xff, 0xaf, 0x55, 0x52, 0x55, 0x52, 0x6b, 0x73,
+  0x73, 0xa5, 0x52, 0x52, 0x52, 0x55, 0x55, 0x5e, 0xaf, 0x5e, 0x52, 0x52, 0x52, 0xa5, 0x73, 0x6b,
+  0x6b, 0x52, 0x75, 0x6c, 0x62, 0x52, 0x55, 0x55, 0x52, 0x55, 0x55, 0x52, 0x5a, 0x52, 0x6b, 0x73,
+  0x73, 0x52, 0x6c, 0x62, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52, 0x73, 0x6b,
+  0x6b, 0xa5, 0x52, 0x52, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x75, 0x6c, 0x62, 0x52, 0xa5, 0x6b, 0x73,
+  0x73, 0x6b, 0xa5, 0x52, 0x6c, 0x62, 0x62, 0x5a, 0x52, 0x6c, 0x62, 0x5a, 0x52, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0xa5, 0x52, 0x52, 0x52, 0x52, 0xa5, 0x52, 0x52, 0x52, 0xa5, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0xff, 0xff, 0x52, 0x52, 0xff, 0xff, 0x52, 0x52, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x52, 0xfe, 0xfd, 0x52, 0xf6, 0x52, 0x52, 0xff, 0x52, 0xfd, 0xfe, 0x52, 0x6b, 0x73,
+  0x73, 0x52, 0xff, 0xfd, 0xea, 0xf6, 0x52, 0x52, 0x52, 0x52, 0xf6, 0xea, 0xfd, 0xff, 0x52, 0x6b,
+  0x6b, 0x52, 0x52, 0xf6, 0xf6, 0x52, 0x52, 0xff, 0xff, 0xff, 0x52, 0xf6, 0xf6, 0x52, 0x52, 0x73,
+  0x73, 0x52, 0xf6, 0x52, 0x52, 0xff, 0xff, 0xea, 0xfd, 0xea, 0xff, 0x52, 0x52, 0xff, 0x52, 0x6b,
+  0x6b, 0x73, 0x52, 0xf6, 0x52, 0x52, 0x52, 0xfd, 0xfe, 0xfd, 0xff, 0x52, 0xff, 0x52, 0x6b, 0x73,
+  0x73, 0xa5, 0x52, 0x52, 0x52, 0xff, 0xff, 0xea, 0xfd, 0xea, 0x52, 0x52, 0x52, 0xa5, 0x73, 0x6b,
+  0x6b, 0x52, 0x75, 0x6c, 0x62, 0x52, 0xf6, 0xf6, 0x52, 0xf6, 0xf6, 0x52, 0x5a, 0x52, 0x6b, 0x73,
+  0x73, 0x52, 0x6c, 0x62, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52, 0x73, 0x6b,
+  0x6b, 0xa5, 0x52, 0x52, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x75, 0x6c, 0x62, 0x52, 0xa5, 0x6b, 0x73,
+  0x73, 0x6b, 0xa5, 0x52, 0x6c, 0x62, 0x62, 0x5a, 0x52, 0x6c, 0x62, 0x5a, 0x52, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0xa5, 0x52, 0x52, 0x52, 0x52, 0xa5, 0x52, 0x52, 0x52, 0xa5, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x5d, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x5d, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x5d, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x5d, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x5d, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x66, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x66, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x5d, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x5d, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x5d, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x66, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x66, 0x5d, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5a, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x75,
+  0x73, 0x6b, 0x52, 0x52, 0x5a, 0x5a, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x75,
+  0x6b, 0x52, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c,
+  0x52, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c,
+  0x5a, 0x52, 0x52, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x6c, 0x6c, 0x62,
+  0x73, 0x6b, 0x52, 0x6c, 0x62, 0x62, 0x5a, 0x75, 0x62, 0x5a, 0x5a, 0x6c, 0x6c, 0x6c, 0x62, 0x5a,
+  0x6b, 0x73, 0x52, 0x62, 0x62, 0x62, 0x75, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x62,
+  0x73, 0x52, 0x52, 0x52, 0x5a, 0x5a, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x52, 0x62, 0x62, 0x62, 0x52, 0x5a, 0x5a, 0x62, 0x75, 0x75, 0x6c, 0x5a, 0x62, 0x5a, 0x5a, 0x5a,
+  0x52, 0x5a, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x62, 0x6c, 0x5a, 0x62, 0x5a, 0x62, 0x62, 0x62,
+  0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c,
+  0x73, 0x6b, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x75, 0x75,
+  0x6b, 0x73, 0x52, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x5a, 0x5a, 0x62, 0x62, 0x6c, 0x75, 0x75,
+  0x73, 0x52, 0x5a, 0x6c, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x5a, 0x62, 0x6c,
+  0x6b, 0x52, 0x5a, 0x62, 0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x62, 0x62,
+  0x73, 0x5a, 0x52, 0x52, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62,
+  0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x62, 0x62, 0x52, 0x6c, 0x62, 0x5a,
+  0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x6c, 0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x62,
+  0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x62,
+  0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x62, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x5a, 0x5a,
+  0x62, 0x6c, 0x6c, 0x75, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x62, 0x62, 0x52, 0x62, 0x62,
+  0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x62, 0x52, 0x6c, 0x6c,
+  0x5a, 0x6c, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x75, 0x75,
+  0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x6c, 0x52, 0x5a, 0x5a, 0x52, 0x75,
+  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x52,
+  0x5a, 0x62, 0x62, 0x5a, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x62, 0x52,
+  0x62, 0x6c, 0x62, 0x5a, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x52, 0x5a,
+  0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x52, 0x52, 0x52,
+  0x75, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x5a,
+  0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x5a, 0x52,
+  0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x62, 0x62, 0x52,
+  0x52, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52,
+  0x62, 0x6c, 0x6c, 0x6c, 0x52, 0x5a, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x75,
+  0x5a, 0x6c, 0x52, 0x52, 0x5a, 0x5a, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x75,
+  0x5a, 0x52, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c,
+  0x52, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c,
+  0x5a, 0x52, 0x52, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x6c, 0x6c, 0x62,
+  0x62, 0x6c, 0x52, 0x6c, 0x62, 0x62, 0x5a, 0x75, 0x62, 0x5a, 0x5a, 0x6c, 0x6c, 0x6c, 0x62, 0x5a,
+  0x6c, 0x6c, 0x52, 0x62, 0x62, 0x62, 0x75, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x62,
+  0x75, 0x52, 0x52, 0x52, 0x5a, 0x5a, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x52, 0x62, 0x62, 0x62, 0x52, 0x5a, 0x5a, 0x62, 0x75, 0x75, 0x6c, 0x5a, 0x62, 0x5a, 0x5a, 0x5a,
+  0x52, 0x5a, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x62, 0x6c, 0x5a, 0x62, 0x5a, 0x62, 0x62, 0x62,
+  0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c,
+  0x52, 0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x75, 0x75,
+  0x52, 0x52, 0x52, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x5a, 0x5a, 0x62, 0x62, 0x6c, 0x75, 0x75,
+  0x52, 0x52, 0x5a, 0x6c, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x5a, 0x62, 0x6c,
+  0x5a, 0x52, 0x5a, 0x62, 0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x62, 0x62,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62,
+  0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x62, 0x62, 0x52, 0x6c, 0x62, 0x5a,
+  0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x6c, 0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x62,
+  0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x62,
+  0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x62, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x5a, 0x5a,
+  0x62, 0x6c, 0x6c, 0x75, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x62, 0x62, 0x52, 0x62, 0x62,
+  0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x62, 0x52, 0x6c, 0x6c,
+  0x5a, 0x6c, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x75, 0x75,
+  0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x6c, 0x52, 0x5a, 0x5a, 0x52, 0x75,
+  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x52,
+  0x5a, 0x62, 0x62, 0x5a, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x62, 0x52,
+  0x62, 0x6c, 0x62, 0x5a, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x52, 0x5a,
+  0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x52, 0x52, 0x52,
+  0x75, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x5a,
+  0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x5a, 0x52,
+  0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x62, 0x62, 0x52,
+  0x52, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52,
+  0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x62, 0x52, 0x6b, 0x73,
+  0x5a, 0x6c, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x73, 0x6b,
+  0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x6c, 0x52, 0x5a, 0x5a, 0x52, 0x73,
+  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x52,
+  0x5a, 0x62, 0x62, 0x5a, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x62, 0x52,
+  0x62, 0x6c, 0x62, 0x5a, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x52, 0x5a,
+  0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x52, 0x6b, 0x73,
+  0x75, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x6b,
+  0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x5a, 0x52,
+  0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x62, 0x62, 0x52,
+  0x52, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x62, 0x5a, 0x52, 0x73, 0x6b,
+  0x52, 0x52, 0x5a, 0x52, 0x5a, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x5a, 0x5a, 0x52, 0x73,
+  0x52, 0x52, 0x5a, 0x52, 0x62, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x6b,
+  0x5a, 0x5a, 0x52, 0x62, 0x62, 0x52, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x6b, 0x52, 0x5a, 0x73,
+  0x52, 0x13, 0x52, 0x62, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x55, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5e, 0x6f, 0x6f, 0x6f, 0x55, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6f, 0x6f, 0x6f, 0x6f, 0x5e, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6f, 0x6f, 0xaf, 0x6f, 0x5e, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x6f, 0x6f, 0x66, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6f, 0x6f, 0x6f, 0x6f, 0x5e, 0x55, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6f, 0x6f, 0x6f, 0x6f, 0x5e, 0x55, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6f, 0xaf, 0x6f, 0x6f, 0x5e, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6f, 0x6f, 0x6f, 0x6f, 0x5e, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b,
+  0x6b, 0x52, 0xb7, 0xb7, 0xb7, 0xb7, 0x6e, 0xb7, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0x73,
+  0x73, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0x6b,
+  0x6b, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x52, 0x73,
+  0x73, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x52, 0x6b,
+  0x6b, 0x52, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x5d, 0x55, 0x65, 0x65, 0x55, 0x65, 0x5d, 0x52, 0x73,
+  0x73, 0x52, 0x65, 0x55, 0x55, 0x5d, 0x55, 0x55, 0x5d, 0x55, 0x5d, 0x55, 0x55, 0x5d, 0x52, 0x6b,
+  0x6b, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x52, 0x73,
+  0x73, 0x52, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x52, 0x6b,
+  0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5d, 0x5d, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0xa5, 0x52, 0x65, 0x5d, 0x52, 0xa5, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0xa5, 0xa5, 0x52, 0x65, 0x5d, 0x52, 0xa5, 0xa5, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 0xa5, 0xa5, 0xa5, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73, 0x6b,
+  0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b, 0x73,
+  0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x6b, 0x6b,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5d,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x14, 0x14, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x6b, 0x6b, 0x6b, 0x14, 0x14, 0x14, 0x6b, 0x73, 0x6b,
+  0x6b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x6b,
+  0x5d, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x14, 0x14, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x6b, 0x6b, 0x6b, 0x14, 0x14, 0x14, 0x6b, 0x73, 0x6b,
+  0x6b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6b, 0x6b,
+  0x5d, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0xae, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x73, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xae, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x5d, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x5d, 0x66, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x5d, 0x66, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x66, 0x5d, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x6b, 0x5d, 0x66, 0xfd, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x73, 0x66, 0x5d, 0x66, 0xfd, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0x73, 0x6b, 0x73, 0x66, 0x5d, 0x5d, 0xfd, 0xfd, 0xfd, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea,
+  0x6b, 0x73, 0x6b, 0x73, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x66, 0xfd, 0xfd, 0xf2, 0xf2, 0xf2, 0xf2,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x66, 0x66, 0xfd, 0xfd, 0xfd,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
+  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0x5d, 0x5d, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x5d, 0x5d,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x5d, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0x66, 0x5d, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0x66, 0x5d, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x5d, 0x66, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xfd, 0x66, 0x5d, 0x73, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xfd, 0x66, 0x5d, 0x66, 0x6b, 0x73,
+  0xea, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xfd, 0xfd, 0xfd, 0x5d, 0x5d, 0x66, 0x6b, 0x73, 0x6b,
+  0xf2, 0xf2, 0xf2, 0xf2, 0xfd, 0xfd, 0x66, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73,
+  0xfd, 0xfd, 0xfd, 0x66, 0x66, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x75, 0x75, 0x6c, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6c, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x5a,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x13, 0x13, 0x52, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x13, 0x13, 0x13, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x66, 0x5d, 0x5d,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x66, 0x66, 0x6f, 0x5d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5d, 0x6f, 0x6f, 0x5d,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x66, 0x66, 0x66, 0x6f,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x5d, 0x13, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6b, 0x13, 0x6a, 0x13, 0x52, 0x52, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x62, 0x5a, 0x52, 0x52, 0x5a,
+  0x52, 0x52, 0x5a, 0x52, 0x5a, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x5a, 0x5a, 0x52, 0x52,
+  0x52, 0x52, 0x5a, 0x52, 0x62, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x5d,
+  0x5a, 0x5a, 0x52, 0x62, 0x62, 0x52, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x66, 0x52, 0x5a, 0x5d,
+  0x52, 0x13, 0x52, 0x62, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x5d, 0x6f, 0x6f, 0x5d,
+  0x52, 0x13, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x73, 0x52, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x66,
+  0x52, 0x13, 0x13, 0x13, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x66, 0x6f, 0x66, 0x66, 0x66, 0x6f,
+  0x66, 0x66, 0x5d, 0x13, 0x52, 0x6b, 0x73, 0x6a, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x5d, 0x13, 0x66,
+  0x66, 0x5d, 0x66, 0x5d, 0x52, 0x73, 0x6b, 0x6a, 0x6a, 0x6b, 0x13, 0x6a, 0x13, 0x52, 0x52, 0x66,
+  0x66, 0x66, 0x66, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x52,
+  0x5d, 0x5d, 0x13, 0x66, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b,
+  0x6f, 0x5d, 0x5d, 0x13, 0x5d, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6f, 0x66, 0x5d, 0x13, 0x6a, 0x13, 0x52, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6a, 0x66, 0x6a, 0x5d, 0x52, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6a, 0x6b, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x13, 0x52, 0x52, 0x52, 0x75, 0x75, 0x6c, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x52, 0x52,
+  0x52, 0x13, 0x13, 0x13, 0x52, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x5a,
+  0x66, 0x66, 0x5d, 0x13, 0x52, 0x6c, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52,
+  0x66, 0x5d, 0x66, 0x5d, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x66, 0x66, 0x66, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x5a,
+  0x5d, 0x5d, 0x13, 0x66, 0x13, 0x52, 0x73, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x13, 0x13, 0x52, 0x5a,
+  0x6f, 0x5d, 0x5d, 0x13, 0x5d, 0x13, 0x52, 0x73, 0x52, 0x52, 0x52, 0x52, 0x13, 0x13, 0x13, 0x52,
+  0x6f, 0x6f, 0x66, 0x5d, 0x13, 0x6a, 0x13, 0x52, 0x6b, 0x6b, 0x73, 0x52, 0x66, 0x66, 0x5d, 0x5d,
+  0x6a, 0x66, 0x6a, 0x5d, 0x52, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x52, 0x66, 0x66, 0x6f, 0x5d,
+  0x6a, 0x6b, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x52, 0x5d, 0x6f, 0x6f, 0x5d,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x66, 0x66, 0x66, 0x6f,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x5d, 0x13, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6b, 0x13, 0x6a, 0x13, 0x52, 0x52, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x62, 0x5a, 0x52, 0x52, 0x5a,
+  0x52, 0x52, 0x5a, 0x52, 0x5a, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x5a, 0x5a, 0x52, 0x52,
+  0x52, 0x52, 0x5a, 0x52, 0x62, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x5d,
+  0x5a, 0x5a, 0x52, 0x62, 0x62, 0x52, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x66, 0x52, 0x5a, 0x5d,
+  0x52, 0x13, 0x52, 0x62, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x5d, 0x6f, 0x6f, 0x5d,
+  0x52, 0x13, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x73, 0x52, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x66,
+  0x52, 0x13, 0x13, 0x13, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x66, 0x6f, 0x66, 0x66, 0x66, 0x6f,
+  0x66, 0x66, 0x5d, 0x13, 0x52, 0x6b, 0x73, 0x6a, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x5d, 0x13, 0x66,
+  0x66, 0x5d, 0x66, 0x5d, 0x52, 0x73, 0x6b, 0x6a, 0x6a, 0x6b, 0x13, 0x6a, 0x13, 0x52, 0x52, 0x66,
+  0x66, 0x66, 0x66, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x52,
+  0x5d, 0x5d, 0x13, 0x66, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b,
+  0x6f, 0x5d, 0x5d, 0x13, 0x5d, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6f, 0x66, 0x5d, 0x13, 0x6a, 0x13, 0x52, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6a, 0x66, 0x6a, 0x5d, 0x52, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6a, 0x6b, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x13, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x6b, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x13, 0x13, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x5d, 0x13, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x5d, 0x66, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x66, 0x66, 0x5d, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x5d, 0x13, 0x66, 0x13, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x5d, 0x5d, 0x13, 0x5d, 0x13, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6f, 0x6f, 0x66, 0x5d, 0x13, 0x6a, 0x13, 0x52, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6a, 0x66, 0x6a, 0x5d, 0x52, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6a, 0x6b, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x66, 0x6f, 0x6f, 0x6f, 0x66, 0x6b, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6f, 0x6f, 0xaf, 0x6f, 0x5e, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6f, 0x6f, 0x6f, 0x6f, 0x5e, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6f, 0x5e, 0x5e, 0x55, 0x5e, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5e, 0x6f, 0x6f, 0xff, 0x55, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x55, 0x6f, 0x6f, 0x6b, 0x55, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0xa5, 0x52, 0x52, 0x6b, 0x52, 0x52, 0xa5, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x64, 0x65, 0x6d, 0x6d, 0x6d, 0xae,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x64, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0x6d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5b, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xae, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xae, 0xae, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6d, 0x6d, 0xae, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x65, 0x64, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x57,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x56,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x56, 0x56,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x57, 0x56, 0x56,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x52, 0x73,
+  0x73, 0x6b, 0x52, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4e, 0x52,
+  0x6b, 0x52, 0x56, 0x57, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x4e,
+  0x52, 0x56, 0x57, 0x4e, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x56,
+  0x56, 0x57, 0x4e, 0x4e, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x4e,
+  0x57, 0x57, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4e, 0x4e,
+  0x56, 0x57, 0x4e, 0x57, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x4e,
+  0x56, 0x57, 0x57, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x56,
+  0x56, 0x57, 0x56, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x4e,
+  0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4e, 0x4e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x4e, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x4e, 0x4e, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x62, 0x5a, 0x5a, 0x62, 0x52, 0x52, 0x62, 0x5a,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52,
+  0x5a, 0x62, 0x52, 0x52, 0x62, 0x5a, 0x5a, 0x62, 0x52, 0x52, 0x62, 0x5a, 0x5a, 0x62, 0x52, 0x52,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a,
+  0x62, 0x5a, 0x5a, 0x62, 0x52, 0x52, 0x62, 0x5a, 0x5a, 0x62, 0x52, 0x52, 0x62, 0x5a, 0x5a, 0x62,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52,
+  0x52, 0x52, 0x62, 0x52, 0x52, 0x62, 0x5a, 0x5a, 0x62, 0x52, 0x52, 0x62, 0x5a, 0x5a, 0x62, 0x52,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x62, 0x5a, 0x5a, 0x62, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xe2,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xf2, 0xf2, 0xf2, 0xe2,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xea, 0xf2, 0xe2,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xea, 0xea, 0xf2, 0xf2,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xea,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xea, 0xea,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xf2, 0xf2, 0xe2, 0xf2, 0xea, 0xf2, 0xea, 0xea, 0xea,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0xea, 0xe2, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0x52, 0x73, 0x52, 0x52,
+  0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe2, 0x52, 0xac, 0xac,
+  0xe2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xea, 0x52, 0xac, 0x52,
+  0xe2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xe2, 0x52, 0xa4, 0x52,
+  0xe2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0x52, 0xa4, 0xa4,
+  0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe2, 0x52, 0x9b, 0x9b,
+  0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xea, 0x52, 0x9b, 0x9b,
+  0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xe2, 0xea, 0x52, 0x52,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe2, 0x52, 0x9b,
+  0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe2, 0xe2, 0x52, 0x9b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xac, 0xa4, 0xa4, 0x9b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x9b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x9b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa4, 0xa4, 0xa4, 0x9b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa4, 0x9b, 0x9b, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa4, 0x9b, 0x9b, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa4, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa4, 0x52, 0x52, 0x52, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x62, 0x62, 0x52, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x62, 0x6c, 0x62, 0x52,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x73, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x6c, 0x52,
+  0x6b, 0x73, 0x6b, 0x52, 0x62, 0x62, 0x52, 0x52, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x62,
+  0x73, 0x6b, 0x73, 0x52, 0x62, 0x75, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0x62, 0x52, 0x6b, 0x73, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x52, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x52, 0x62, 0x62, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x62, 0x6c, 0x6c, 0x75, 0x5a, 0x62, 0x62, 0x6c, 0x62, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73,
+  0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x62, 0x52, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x5b, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x5b,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x64, 0x64, 0x64, 0x5b, 0x5b, 0x5b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x5b, 0x64, 0x5b, 0x5b, 0x5b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x64,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x5b,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x52, 0x6b, 0x52, 0x52, 0x52, 0x6b, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x52, 0x6b, 0x52, 0x6b, 0x52, 0x52, 0x5b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x52, 0x5b, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5b, 0x5b, 0x5b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0xae, 0xae, 0x64, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0xae, 0xae, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x64, 0x65, 0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5b, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5b, 0x5b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x64, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x5b, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x6b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x52, 0x52, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x6b, 0x52, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x57, 0x57, 0x4e, 0x57, 0x56, 0x57,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x4e, 0x4e, 0x57, 0x57, 0x57,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x4e, 0x4e, 0x4e, 0x57, 0x56, 0x57,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x4e, 0x4e, 0x4e, 0x57, 0x56, 0x56, 0x57,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x57, 0x4e, 0x4e, 0x4e, 0x57, 0x56, 0x56, 0x56, 0x57,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x4e, 0x4e, 0x4e, 0x57, 0x56, 0x56, 0x56, 0x57, 0x4e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x4e, 0x4e, 0x57, 0x57, 0x56, 0x56, 0x57, 0x4e, 0x4e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x4e, 0x57, 0x56, 0x57, 0x56, 0x57, 0x57, 0x4e, 0x4e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x57, 0x56, 0x56, 0x57, 0x57, 0x56, 0x57, 0x4e, 0x57,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56, 0x57, 0x57, 0x57,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x56, 0x56, 0x57, 0x56, 0x56, 0x56, 0x57, 0x56, 0x57,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56, 0x0c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x57, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56, 0x0c, 0x56,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56, 0x0c, 0x56, 0x4e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x56, 0x56, 0x57, 0x57, 0x56, 0x0c, 0x56, 0x4e, 0x4e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x56, 0x57, 0x4e, 0x57, 0x0c, 0x56, 0x4e, 0x4e, 0x52,
+  0x56, 0x56, 0x56, 0x57, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x4e,
+  0x56, 0x56, 0x57, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x56,
+  0x56, 0x57, 0x56, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x4e,
+  0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4e, 0x4e,
+  0x4e, 0x57, 0x56, 0x57, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x4e,
+  0x4e, 0x57, 0x57, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4e, 0x56,
+  0x4e, 0x57, 0x56, 0x56, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x4e, 0x4e,
+  0x57, 0x56, 0x56, 0x0c, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x0d, 0x4e,
+  0x56, 0x56, 0x0c, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4e, 0x0d,
+  0x56, 0x0c, 0x56, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x0d, 0x4e,
+  0x0c, 0x56, 0x4e, 0x4e, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x0c, 0x0d,
+  0x56, 0x4e, 0x4e, 0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52, 0x0c,
+  0x4e, 0x4e, 0x52, 0x5d, 0x5d, 0x5d, 0x65, 0x52, 0x65, 0x5d, 0x52, 0x65, 0x5d, 0x5d, 0x5d, 0x52,
+  0x4e, 0x52, 0x5d, 0x65, 0x5d, 0x65, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x65, 0x5d, 0x65, 0x5d,
+  0x52, 0x5d, 0x65, 0x6f, 0x65, 0x52, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x5d, 0x6f, 0x65,
+  0x5d, 0x65, 0x6e, 0x6e, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x65, 0x65, 0x65, 0x5d, 0x6e, 0x6e,
+  0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x4e, 0x4e, 0x56, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x56, 0x56, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x56, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x0d, 0x52, 0x52, 0x52, 0x52,
+  0x56, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x0d, 0x4e, 0x56, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x57, 0x57, 0x57, 0x57,
+  0x4e, 0x0d, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56,
+  0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x56, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56,
+  0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x57, 0x57, 0x57, 0x57,
+  0x52, 0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x56, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56,
+  0x5d, 0x52, 0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56,
+  0x65, 0x5d, 0x52, 0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x52, 0x52,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x62, 0x62,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x62, 0x62,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x62, 0x62,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x62, 0x62,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52,
+  0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x62,
+  0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x62,
+  0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x5a, 0x62, 0x62,
+  0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x52, 0x62, 0x52,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x5a, 0x62, 0x52, 0x52,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x5a, 0x52, 0x52, 0x55,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x6b, 0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a, 0x5a, 0x6b,
+  0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b,
+  0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b,
+  0x6b, 0x5a, 0x5a, 0x62, 0x5a, 0x5a, 0x62, 0x5a, 0x5a, 0x62, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x6b,
+  0x6b, 0x52, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x52, 0x62, 0x62, 0x6b,
+  0x5a, 0x62, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x5a, 0x5a, 0x62, 0x6b,
+  0x52, 0x62, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x5a, 0x52, 0x62, 0x6b,
+  0x62, 0x62, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x5a, 0x5a, 0x5a, 0x6b,
+  0x62, 0x62, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x5a, 0x5a, 0x52, 0x6b,
+  0x62, 0x62, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+  0x62, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x5a, 0x52,
+  0x52, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x5a, 0x5a,
+  0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x5a,
+  0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x52, 0x52,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x55, 0x52,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x52,
+  0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x5a, 0x5a, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x62, 0x62, 0x6b, 0x52, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a,
+  0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52,
+  0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52,
+  0x5a, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52,
+  0x52, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x52,
+  0x5a, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x52, 0x5a, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xe2, 0xe2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf2,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xe2, 0xe2, 0xe2, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea,
+  0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xe2, 0xe2, 0xe2, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xea,
+  0x73, 0x6b, 0x73, 0x52, 0xf2, 0xe2, 0xe2, 0xe2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xe2, 0xf2, 0xea,
+  0x6b, 0x73, 0x6b, 0x52, 0xe2, 0xe2, 0xe2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xe2, 0xe2, 0xf2, 0xf2,
+  0x73, 0x6b, 0x73, 0x52, 0xe2, 0xe2, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xe2, 0xe2, 0xe2, 0xf2, 0xea,
+  0x6b, 0x73, 0x6b, 0x52, 0xe2, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xe2, 0xe2, 0xf2, 0xea, 0xea,
+  0x73, 0x6b, 0x73, 0x52, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xea, 0xf2, 0xe2, 0xf2, 0xea, 0xea, 0x9a,
+  0x6b, 0x73, 0x6b, 0x52, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xea, 0x9a, 0xea,
+  0x73, 0x6b, 0x73, 0x52, 0xea, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xf2, 0x9a, 0xea, 0xe2,
+  0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xea, 0x9a, 0xea, 0xe2, 0xe2,
+  0x73, 0x6b, 0x73, 0x52, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xea, 0x9a, 0xea, 0xe2, 0xe2, 0x52,
+  0x6b, 0x73, 0x6b, 0x52, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xea, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d,
+  0x73, 0x6b, 0x73, 0x52, 0xea, 0xea, 0xf2, 0xf2, 0xea, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65,
+  0x6b, 0x73, 0x6b, 0x52, 0xea, 0xf2, 0xe2, 0xf2, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65, 0x6e,
+  0x73, 0x6b, 0x73, 0x52, 0xf2, 0xe2, 0xe2, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65, 0x6e, 0x6e,
+  0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xea, 0xe2, 0x52, 0x9b,
+  0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xe2, 0xea, 0x9a, 0x9b,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xea, 0xea, 0x9a,
+  0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe2, 0xea, 0xe2, 0xea,
+  0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe2, 0xea, 0xea, 0xe2, 0xe2,
+  0xea, 0x9a, 0xe2, 0x9a, 0xe2, 0xe2, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0xe2, 0xe2, 0xea, 0xe2, 0xe2,
+  0x9a, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x9a, 0xe2, 0xe2, 0xea, 0xe2,
+  0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0x9a, 0xe2, 0xe2, 0xea,
+  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x9a, 0xe2, 0x9a, 0xe2, 0xea,
+  0xe2, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x9a, 0x9a, 0xe2, 0x9a, 0xea,
+  0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52, 0x9a, 0x9a, 0xe2, 0x9a,
+  0x5d, 0x5d, 0x5d, 0x65, 0x52, 0x65, 0x5d, 0x52, 0x65, 0x5d, 0x5d, 0x5d, 0x52, 0x9a, 0x9a, 0xe2,
+  0x65, 0x5d, 0x65, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x65, 0x5d, 0x65, 0x5d, 0x52, 0x9a, 0x9a,
+  0x6f, 0x65, 0x52, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x5d, 0x6f, 0x65, 0x5d, 0x52, 0x9a,
+  0x6e, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x65, 0x65, 0x65, 0x5d, 0x6e, 0x6e, 0x65, 0x5d, 0x52,
+  0x6e, 0x65, 0x52, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x5d, 0x6e, 0x6e, 0x6e, 0x65, 0x5d,
+  0xa4, 0x52, 0x52, 0x52, 0xea, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa4, 0x52, 0x52, 0x52, 0xe2, 0xea, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0xe2, 0xea, 0xea, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x9a, 0x52, 0x52, 0x52, 0xe2, 0xea, 0xe2, 0xea, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xea, 0x9a, 0x9a, 0x9a, 0xea, 0xea, 0xe2, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xe2, 0xea, 0xe2, 0xea, 0xe2, 0xea, 0xe2, 0xe2, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xe2, 0xe2, 0xea, 0xea, 0xe2, 0xe2, 0xea, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xe2, 0xe2, 0xe2, 0xea, 0xe2, 0xe2, 0xe2, 0xea, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xea, 0xe2, 0xe2, 0xe2, 0xea, 0xe2, 0xe2, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xe2, 0xea, 0xe2, 0xe2, 0xe2, 0xea, 0xe2, 0xe2, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xe2, 0xe2, 0xea, 0xe2, 0xe2, 0xea, 0xea, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x9a, 0xe2, 0xe2, 0xea, 0xe2, 0xea, 0xe2, 0xea, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xe2, 0x9a, 0xe2, 0xe2, 0xea, 0xea, 0xe2, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x9a, 0xe2, 0x9a, 0xe2, 0xe2, 0xea, 0xe2, 0xe2, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x9a, 0x9a, 0xe2, 0x9a, 0xe2, 0xe2, 0xea, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x9a, 0x9a, 0xe2, 0x9a, 0xe2, 0xe2, 0xea, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5a, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x75,
+  0x73, 0x6b, 0x52, 0x52, 0x5a, 0x5a, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x75,
+  0x6b, 0x52, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c,
+  0x52, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x75, 0x6c,
+  0x5a, 0x52, 0x52, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x75, 0x6c, 0x6c, 0x62,
+  0x73, 0x6b, 0x52, 0x6c, 0x62, 0x62, 0x5a, 0x75, 0x62, 0x5a, 0x5a, 0x6c, 0x6c, 0x6c, 0x62, 0x5a,
+  0x6b, 0x73, 0x52, 0x62, 0x62, 0x62, 0x75, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x62,
+  0x73, 0x52, 0x52, 0x52, 0x5a, 0x5a, 0x6c, 0x6c, 0x62, 0x75, 0x75, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x52, 0x62, 0x62, 0x62, 0x52, 0x5a, 0x5a, 0x62, 0x75, 0x75, 0x6c, 0x5a, 0x62, 0x5a, 0x5a, 0x5a,
+  0x52, 0x5a, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x62, 0x6c, 0x5a, 0x62, 0x5a, 0x62, 0x62, 0x62,
+  0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c,
+  0x73, 0x6b, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x75, 0x75,
+  0x6b, 0x73, 0x52, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x5a, 0x5a, 0x62, 0x62, 0x6c, 0x75, 0x75,
+  0x73, 0x52, 0x5a, 0x6c, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x62, 0x6c, 0x5a, 0x62, 0x6c,
+  0x6b, 0x52, 0x5a, 0x62, 0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x62, 0x62,
+  0x73, 0x5a, 0x52, 0x52, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62,
+  0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x62, 0x62, 0x52, 0x73, 0x6b, 0x73,
+  0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x75, 0x6c, 0x6c, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x73, 0x6b, 0x73,
+  0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x62, 0x6c, 0x6c, 0x75, 0x75, 0x6c, 0x62, 0x52, 0x52, 0x73, 0x6b,
+  0x62, 0x6c, 0x6c, 0x75, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x62, 0x62, 0x52, 0x6b, 0x73,
+  0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x62, 0x52, 0x73, 0x6b,
+  0x5a, 0x6c, 0x6c, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x6b, 0x73,
+  0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5a, 0x5a, 0x6c, 0x52, 0x5a, 0x5a, 0x52, 0x6b,
+  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x6c, 0x6c, 0x52,
+  0x5a, 0x62, 0x62, 0x5a, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x62, 0x6c, 0x62, 0x6c, 0x6c, 0x62, 0x52,
+  0x62, 0x6c, 0x62, 0x5a, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x52, 0x5a,
+  0x6c, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x52, 0x73, 0x6b,
+  0x75, 0x6c, 0x62, 0x6c, 0x62, 0x62, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x6c, 0x6c, 0x62, 0x52, 0x73,
+  0x6c, 0x62, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x62, 0x62, 0x6c, 0x5a, 0x52,
+  0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x62, 0x62, 0x52,
+  0x52, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x52, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x5b, 0x5b, 0x64, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x5b, 0x5b, 0x64, 0x65, 0x65, 0x6d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x5b, 0x5b, 0x64, 0x65, 0x65, 0x65, 0x6d, 0xae,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x64, 0x65, 0x6d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x65, 0x65, 0x65, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x65, 0x65, 0x6d, 0x6d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x65, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6d, 0xae, 0xae, 0xae, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6d, 0x6d, 0xae, 0xae, 0xae, 0xae, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6d, 0x6d, 0x6d, 0x6d, 0xae, 0xae, 0xae, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6d, 0x6d, 0xae, 0x6d, 0x6d, 0x6d, 0xae, 0xae, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6d, 0x65, 0x65, 0x6d, 0xae, 0x6d, 0x6d, 0xae, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x5b, 0x5b, 0x5b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x64, 0x64, 0x5b, 0x5b, 0x5b, 0x64, 0x64, 0x5b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x57, 0x4e, 0x4e, 0x0c, 0x56, 0x4e, 0x4e, 0x52, 0x5d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x4e, 0x4e, 0x0c, 0x56, 0x4e, 0x4e, 0x52, 0x5d, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x4e, 0x0c, 0x56, 0x4e, 0x4e, 0x52, 0x5d, 0x65, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0x52, 0x0c, 0x56, 0x4e, 0x4e, 0x52, 0x5d, 0x65, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0x52, 0x56, 0x4e, 0x4e, 0x52, 0x5d, 0x65, 0xb7, 0xb7, 0xb7,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xa5, 0x55, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6a, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x5d, 0x6e, 0x6e,
+  0xb7, 0xb7, 0xb7, 0xb7, 0x65, 0x9b, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x9b, 0x5d, 0x6f, 0x6f,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0xb7, 0xb7, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6e, 0x52, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d,
+  0x52, 0x6f, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x52, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5d,
+  0x52, 0x65, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x55, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x55, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x2f, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x27, 0x27, 0x55, 0x52,
+  0x6e, 0x65, 0x5d, 0x52, 0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x4e, 0x56, 0x57, 0x57, 0x57, 0x57,
+  0x6f, 0x6f, 0x65, 0x5d, 0x52, 0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56,
+  0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x52, 0x0c, 0x0d, 0x4e, 0x0d, 0x4e, 0x0d, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x52, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x65, 0x5d, 0x52, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x5d, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x55, 0x5d, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x65, 0x52, 0x65, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x5d, 0x52, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x65, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x5d, 0x52, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x5d, 0x65, 0x6e, 0x52, 0x52, 0x65,
+  0x5d, 0x52, 0x65, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x65, 0x52, 0x5d, 0x65, 0x6e, 0x52, 0x52, 0x65,
+  0x5d, 0x52, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x65, 0x6e, 0x6f, 0x5d, 0x5d, 0x5d,
+  0x5d, 0x52, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x5d, 0x65, 0x6e, 0x52, 0x9b, 0x65,
+  0x5d, 0x52, 0x65, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x65, 0x52, 0x5d, 0x65, 0x6e, 0x52, 0x9b, 0x65,
+  0x5d, 0x52, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x65, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x5d, 0x52, 0x65, 0x65, 0x6f, 0x6f, 0x6f, 0x6e, 0x65, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x52, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x52, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x52, 0x52, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5d, 0x52, 0x52, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x5d, 0x5d, 0x6f, 0x6f, 0x6e, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5d, 0x52, 0x52, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x52, 0x52, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x6a, 0x6a, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x6a, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x6a, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x55, 0x65, 0x65, 0x65, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x5a, 0x52, 0x52, 0x55, 0x65,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x65, 0x65,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x65, 0x6e, 0x6e,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6e, 0x6e, 0x6e, 0x52,
+  0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x6e, 0x6e, 0x6e, 0x52, 0x6f,
+  0x52, 0x52, 0x5d, 0x65, 0x52, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6e, 0x6e, 0x52, 0x65,
+  0x52, 0x52, 0x5d, 0x65, 0x52, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6e, 0x6e, 0x52, 0x65,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x6e, 0x6e, 0x6e, 0x52, 0x65,
+  0x52, 0x52, 0x5d, 0x65, 0x9b, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6f, 0x6f, 0x52, 0x65,
+  0x52, 0x52, 0x5d, 0x65, 0x9b, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6e, 0x6e, 0x52, 0x65,
+  0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x6e, 0x6e, 0x6e, 0x52, 0x65,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6f, 0x6f, 0x52, 0x65,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x6e, 0x6e, 0x52, 0x65,
+  0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x6e, 0x6e, 0x6e, 0x52, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x55,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6f, 0x6f,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x52, 0x6e,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x52,
+  0x5d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x65, 0x52,
+  0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x55, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x55, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x2f, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x27, 0x27, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x52, 0x5a, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a,
+  0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x65, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6e, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x6f, 0x6f, 0x55, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x6e, 0x6e, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x65, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x6e, 0x6f, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x6e, 0x6e,
+  0x65, 0x6e, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x6e, 0x6e,
+  0x65, 0x6e, 0x65, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6f, 0x6f,
+  0x65, 0x6f, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x52, 0x9b, 0x65, 0x5d, 0x52, 0x52, 0x6e, 0x6e,
+  0x65, 0x6e, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x52, 0x9b, 0x65, 0x5d, 0x52, 0x52, 0x6e, 0x6e,
+  0x65, 0x6e, 0x65, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x65, 0x6f, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x65, 0x6e, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x65, 0x6e, 0x65, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x5a, 0x6b, 0x62, 0x62, 0x6b, 0x5a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x55, 0x55, 0x55, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x65, 0x65, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6e, 0x6e, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6f, 0x6e, 0x6e, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6e, 0x6e, 0x52, 0x5c, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6f, 0x6e, 0x6e, 0x52, 0x5c, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0xe2, 0xe2, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65, 0xb7, 0xb7, 0xb7,
+  0x73, 0x6b, 0x73, 0x52, 0xe2, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x52, 0x9a, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x52, 0xea, 0xe2, 0xe2, 0x52, 0x5d, 0x65, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x52,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x6f,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x55, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x6f, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x52, 0x65, 0x5d,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x52, 0x65, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x52, 0x65, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0x52, 0x65, 0x52,
+  0xb7, 0x65, 0x9b, 0x52, 0x52, 0x65, 0x5d, 0x52, 0x52, 0x9b, 0x5d, 0x6f, 0x6f, 0x6f, 0x6f, 0x65,
+  0x6e, 0x6e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6f, 0x6f, 0x6f,
+  0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x52, 0x6e, 0x6e,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x5d, 0x52, 0x6e,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x65, 0x52, 0x65,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x55, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x55, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x2f, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x27, 0x27, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x65,
+  0x5d, 0x52, 0x9a, 0x9a, 0xe2, 0x9a, 0xe2, 0xe2, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x5d, 0x52, 0x9a, 0x9a, 0xe2, 0x9a, 0xe2, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x65, 0x5d, 0x52, 0x9a, 0x9a, 0xe2, 0x9a, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6f, 0x6f, 0x65, 0x5d, 0x52, 0x9a, 0x9a, 0xe2, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x5d, 0x55, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x52, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x52, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x65, 0x6e, 0x6e, 0x65, 0x52, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0x52, 0x75, 0x75, 0x6c, 0x62, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6c, 0x6c, 0x62, 0x5a, 0x62, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6c, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x52, 0x5a, 0x5a,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5a, 0x5a, 0x5a, 0x52, 0x13, 0x13, 0x52, 0x5a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x13, 0x13, 0x13, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x66, 0x5d, 0x5d,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x66, 0x66, 0x6f, 0x5d,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5d, 0x6f, 0x6f, 0x5d,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x66, 0x6f, 0x66, 0x66, 0x66, 0x6f,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x52, 0x66, 0x6f, 0x6f, 0x5d, 0x5d, 0x13, 0x66,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6b, 0x13, 0x6a, 0x13, 0x52, 0x52, 0x66,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x5a, 0x52, 0x52, 0x5a, 0x62, 0x6c, 0x6c, 0x6c, 0x6c, 0x62, 0x62, 0x5a, 0x52, 0x6b, 0x73,
+  0x52, 0x52, 0x5a, 0x52, 0x5a, 0x62, 0x62, 0x6c, 0x6c, 0x62, 0x52, 0x62, 0x5a, 0x5a, 0x52, 0x6b,
+  0x52, 0x52, 0x5a, 0x52, 0x62, 0x5a, 0x62, 0x6c, 0x6c, 0x62, 0x5a, 0x52, 0x52, 0x5a, 0x52, 0x73,
+  0x5a, 0x5a, 0x52, 0x62, 0x62, 0x52, 0x5a, 0x62, 0x62, 0x5a, 0x5a, 0x52, 0x73, 0x52, 0x5a, 0x6b,
+  0x52, 0x13, 0x52, 0x62, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x5a, 0x5a, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x13, 0x52, 0x5a, 0x5a, 0x52, 0x52, 0x52, 0x73, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x13, 0x13, 0x13, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x5d, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x66, 0x5d, 0x66, 0x5d, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x66, 0x66, 0x66, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5d, 0x5d, 0x13, 0x66, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6f, 0x5d, 0x5d, 0x13, 0x5d, 0x13, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6f, 0x6f, 0x66, 0x5d, 0x13, 0x6a, 0x13, 0x52, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6a, 0x66, 0x6a, 0x5d, 0x52, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6a, 0x6b, 0x6a, 0x13, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x5b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x52, 0x5b, 0x5b,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x52, 0x5b, 0x64, 0x5b,
+  0x6b, 0x73, 0x6b, 0x52, 0x64, 0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0xae, 0xae, 0x52, 0x5b, 0x5b,
+  0x73, 0x6b, 0x52, 0x52, 0x5b, 0x65, 0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0xae, 0xae, 0x52, 0x5b,
+  0x6b, 0x73, 0x52, 0x52, 0x52, 0x64, 0x65, 0x65, 0x65, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x52, 0x5b,
+  0x73, 0x6b, 0x52, 0x52, 0x52, 0x5b, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x52, 0x52,
+  0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5b, 0x5b, 0x52, 0x52,
+  0x73, 0x6b, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x64, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0x6b,
+  0x6b, 0x6b, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x5b, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0x6b,
+  0x73, 0x6b, 0x52, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x5b, 0x5b, 0x6b, 0x52, 0x52, 0x6b,
+  0x6b, 0x73, 0x6b, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x6b, 0x52, 0x5b, 0x52, 0x6b, 0x52, 0x6b, 0x6b,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x6b, 0x52, 0x6b, 0x52, 0x52, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x64, 0x5b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5b, 0x5b, 0x5b, 0x64, 0x5b, 0x5b, 0x5b, 0x64, 0x5b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5b, 0x5b, 0x5b, 0x5b, 0x64, 0x5b, 0x5b, 0x64, 0x5b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5b, 0x5b, 0x5b, 0x64, 0x65, 0x5b, 0x5b, 0x5b, 0x5b, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5b, 0x5b, 0x5b, 0x64, 0x65, 0x5b, 0x5b, 0x6b, 0x5b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5b, 0x5b, 0x5b, 0x64, 0x5b, 0x5b, 0x5b, 0x5b, 0x6b, 0x52, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5b, 0x6b, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x64, 0x6d, 0x6d, 0xae, 0xae, 0x6d, 0x52, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x5b, 0x64, 0x64, 0x65, 0x65, 0x65, 0x52, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x5b, 0x64, 0x52, 0x52, 0x52, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x52, 0x6b, 0x52, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0xae, 0xa5, 0x52, 0x6e, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+  0x73, 0x6b, 0x73, 0x6b, 0x6a, 0xae, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xa5, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xa5, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xa5, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x6a, 0x6a, 0x52, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52,
+  0x52, 0x65, 0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52,
+  0x52, 0x5d, 0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52,
+  0x52, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x5c, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x5c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x5c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x52, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x52, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x52, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x52, 0x52, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x52,
+  0x5d, 0x52, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x65, 0x65, 0x52, 0x5d, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x5d, 0x52, 0x5d, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x52, 0x65, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x5d, 0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x65, 0x65, 0x65, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x5d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x52, 0x52, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xae, 0x5c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xa5, 0x5c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xa5, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x52, 0x6a, 0x6a, 0x6a, 0x52, 0x52, 0x52,
+  0xae, 0x52, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x73, 0x6b,
+  0xae, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa5, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x6a, 0x6a, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x52, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x65, 0xb7, 0xb7, 0x52, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6e, 0x6e, 0x52, 0x65,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x65, 0x65, 0x52, 0x5d,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x52, 0x52, 0x5d,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x5c, 0x52, 0x52,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0xae,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0xa5,
+  0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa5,
+  0x6a, 0x6a, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x52, 0x52, 0x52, 0x5c, 0x5c,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xa5,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52,
+  0x52, 0x55, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x52,
+  0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x52, 0x52,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x52,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x52,
+  0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0x52,
+  0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x52,
+  0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x52,
+  0x65, 0x6f, 0x55, 0x65, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x5d, 0x65, 0x55, 0x55, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x55, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x52, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x52, 0x52, 0x52, 0x6a, 0x52, 0x52, 0x52, 0x52,
+  0x6a, 0x6a, 0x6a, 0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x73, 0x6a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6e, 0x65, 0x65, 0x52, 0x5c, 0xa5, 0x5c, 0x6a, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x65, 0x65, 0x65, 0x52, 0x5c, 0xa5, 0x5c, 0x6a, 0x6a, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x5c, 0xa5, 0x5c, 0x52, 0x6a, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6a, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x6a, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xa5, 0x52, 0x65, 0x6e, 0x6e, 0x6e, 0x6e, 0x52, 0x65, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xa5, 0x52, 0x65, 0x65, 0x65, 0x65, 0x65, 0x52, 0x5d, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xa5, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x52,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 0x52,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0xae, 0xae,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0xa5, 0xa5, 0x6a, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0xa5, 0xa5,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0x5c, 0x6a, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x6a, 0x52, 0x52, 0x5c, 0x5c, 0x5c,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x52, 0xae, 0xae,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0xae, 0xae,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0xa5, 0xa5,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5c, 0x6a,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x6a,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x5d,
+  0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x55,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x52, 0x52,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 0x52, 0xa5,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c, 0xa5,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0xa5,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x52, 0x73,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x52, 0x6b,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x52, 0x73,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6a, 0x52, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6a, 0x73, 0x6b,
+  0x65, 0x65, 0x65, 0x65, 0x52, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x52, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0xa5, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0xa5, 0xa5, 0xa5, 0xa5, 0x6a, 0xa5, 0x5c, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x5c, 0x5c, 0x5c, 0x6a, 0x6a, 0x5c, 0x5c, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x52, 0x52, 0x52, 0x6a, 0x6a, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x73, 0x6b,
+  0x6b, 0x73, 0x52, 0x65, 0x52, 0x52, 0x6b, 0x52, 0x6b, 0x73, 0x52, 0x52, 0x65, 0x52, 0x6b, 0x73,
+  0x73, 0x52, 0x52, 0x52, 0x5d, 0x55, 0x52, 0x5d, 0x52, 0x52, 0x55, 0x5d, 0x52, 0x52, 0x52, 0x6b,
+  0x6b, 0x52, 0x65, 0x65, 0x52, 0x52, 0x52, 0x55, 0x5d, 0x52, 0x52, 0x52, 0x5d, 0x5d, 0x52, 0x73,
+  0x73, 0x6b, 0x52, 0x5d, 0x65, 0x65, 0x65, 0x52, 0x52, 0x5d, 0x5d, 0x5d, 0x5d, 0x52, 0x73, 0x6b,
+  0x6b, 0x73, 0xa5, 0x52, 0x52, 0x52, 0x65, 0x5d, 0x55, 0x5d, 0x52, 0x52, 0x52, 0xa5, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0xa5, 0x52, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0xa5, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x52, 0x5d, 0x52, 0x52, 0xa5, 0xa5, 0x52, 0x52, 0x5d, 0x52, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x52, 0x52, 0xa5, 0x73, 0x6b, 0x73, 0x6b, 0xa5, 0x52, 0x52, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x52, 0x52, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0xb7, 0x6e, 0xb7, 0x6e, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x6e, 0xb7, 0x6e, 0xb7, 0x6e, 0x6e, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x6e, 0xb7, 0x6e, 0xb7, 0x6e, 0x6e, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x65, 0x5d, 0x5d, 0x5d, 0x5d, 0x65, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5d, 0x6e, 0x6e, 0x6e, 0x6e, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x5d, 0x52, 0x52, 0x52, 0x52, 0x5d, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x52, 0x5d, 0x5d, 0x52, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b, 0x52, 0x65, 0x5d, 0x52, 0x73, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0x6b, 0xa5, 0x52, 0x65, 0x5d, 0x52, 0xa5, 0x73, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0xa5, 0xa5, 0x52, 0x65, 0x5d, 0x52, 0xa5, 0xa5, 0x73, 0x6b, 0x73, 0x6b,
+  0x6b, 0x73, 0x6b, 0x73, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 0xa5, 0xa5, 0xa5, 0x6b, 0x73, 0x6b, 0x73,
+  0x73, 0x6b, 0x73, 0x6b, 0x73, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x6b, 0x73, 0x6b, 0x73, 0x6b,
+};
@@ -3,7 +3,7 @@
 
 #define AUDIO_SAMPLES 50
 
-uint16_t audio_buffer[] = {
+const uint16_t audio_buffer[] = {
 127,
 143,
 159,
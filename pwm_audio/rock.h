@@ -5,7 +5,7 @@
 
 #define AUDIO_SAMPLES 62294
 
-uint8_t audio_buffer[] = {
+const uint8_t audio_buffer[] = {
 127,
 127,
 127,
@@ -1,4 +1,4 @@
-uint32_t pwm_data[] = {
+const uint32_t pwm_data[] = {
 0x0a300a30,
 0x0a30ffff,
 0xc1e5ffff,